@@ -34,6 +34,8 @@
 #include <liblangutil/Exceptions.h>
 
 #include <libsolutil/JSON.h>
+#include <libsolutil/Parallel.h>
+#include <libsolutil/PhaseTracer.h>
 #include <libsolutil/StringUtils.h>
 
 #include <fmt/format.h>
@@ -46,6 +48,7 @@
 #include <fstream>
 #include <limits>
 #include <iterator>
+#include <mutex>
 
 using namespace solidity;
 using namespace solidity::evmasm;
@@ -59,8 +62,21 @@ AssemblyItem const& Assembly::append(AssemblyItem _i)
 	assertThrow(m_deposit >= 0, AssemblyException, "Stack underflow.");
 	m_deposit += static_cast<int>(_i.deposit());
 	m_items.emplace_back(std::move(_i));
-	if (!m_items.back().location().isValid() && m_currentSourceLocation.isValid())
-		m_items.back().setLocation(m_currentSourceLocation);
+	AssemblyItem& item = m_items.back();
+	if (!item.location().isValid() && m_currentSourceLocation.isValid())
+	{
+		DebugData::ConstPtr debugData = item.debugData();
+		if (!debugData->originLocation.isValid() && !debugData->astID.has_value())
+		{
+			// Most items are appended without debug data of their own. The ones appended
+			// at the same source location share their debug data.
+			if (!m_currentSourceLocationDebugData || m_currentSourceLocationDebugData->nativeLocation != m_currentSourceLocation)
+				m_currentSourceLocationDebugData = DebugData::create(m_currentSourceLocation);
+			item.setDebugData(m_currentSourceLocationDebugData);
+		}
+		else
+			item.setLocation(m_currentSourceLocation);
+	}
 	m_items.back().m_modifierDepth = m_currentModifierDepth;
 	return m_items.back();
 }
@@ -273,6 +289,13 @@ AssemblyItem Assembly::createAssemblyItemFromJSON(Json const& _json, std::vector
 			AssemblyItem item(fromHex(value), 0, 0);
 			result = item;
 		}
+		else if (name == "DUPN" || name == "SWAPN")
+		{
+			requireValueDefinedForInstruction(name, value);
+			u256 depth(value);
+			solRequire(1 <= depth && depth <= 256, AssemblyImportException, "Invalid stack access depth of " + name + ".");
+			result = {name == "DUPN" ? AssemblyItemType::DupN : AssemblyItemType::SwapN, depth};
+		}
 		else
 			solThrow(InvalidOpcode, "Invalid opcode: " + name);
 	}
@@ -644,6 +667,8 @@ void Assembly::encodeAllPossibleSubPathsInAssemblyTree(std::vector<size_t> _path
 
 std::shared_ptr<std::string const> Assembly::sharedSourceName(std::string const& _name) const
 {
+	static std::mutex mutex;
+	std::lock_guard lock(mutex);
 	if (s_sharedSourceNames.find(_name) == s_sharedSourceNames.end())
 		s_sharedSourceNames[_name] = std::make_shared<std::string>(_name);
 
@@ -691,6 +716,26 @@ Assembly& Assembly::optimise(OptimiserSettings const& _settings)
 	return *this;
 }
 
+bool Assembly::subAssembliesAreIndependent(std::function<bool(Assembly const&)> const& _isDone) const
+{
+	std::set<Assembly const*> seen;
+	std::function<bool(Assembly const&)> collect = [&](Assembly const& _assembly) {
+		// Assemblies that are done are only read.
+		if (_isDone(_assembly))
+			return true;
+		if (!seen.insert(&_assembly).second)
+			return false;
+		for (auto const& sub: _assembly.m_subs)
+			if (!collect(*sub))
+				return false;
+		return true;
+	};
+	for (auto const& sub: m_subs)
+		if (!collect(*sub))
+			return false;
+	return true;
+}
+
 std::map<u256, u256> const& Assembly::optimiseInternal(
 	OptimiserSettings const& _settings,
 	std::set<size_t> _tagsReferencedFromOutside
@@ -700,17 +745,27 @@ std::map<u256, u256> const& Assembly::optimiseInternal(
 		return *m_tagReplacements;
 
 	// Run optimisation for sub-assemblies.
-	for (size_t subId = 0; subId < m_subs.size(); ++subId)
-	{
-		OptimiserSettings settings = _settings;
-		Assembly& sub = *m_subs[subId];
-		std::map<u256, u256> const& subTagReplacements = sub.optimiseInternal(
+	// The tags of a sub-assembly referenced from here do not depend on the replacements
+	// in the other sub-assemblies, so they can all be collected up front.
+	std::vector<std::set<size_t>> subTagsReferencedFromHere = JumpdestRemover::referencedTagsOfSubs(m_items, m_subs.size());
+	// An assembly that is reachable through more than one sub-assembly is optimised with the tags
+	// referenced from the first of them, so sub-assemblies are only optimised concurrently if they
+	// do not share anything that still has to be optimised.
+	size_t const jobs = subAssembliesAreIndependent([](Assembly const& _assembly) {
+		return _assembly.m_tagReplacements.has_value();
+	}) ? _settings.parallelism : 1;
+	OptimiserSettings settings = _settings;
+	settings.parallelism = std::max<size_t>(1, jobs / std::max<size_t>(1, m_subs.size()));
+	std::vector<std::map<u256, u256> const*> subTagReplacements(m_subs.size(), nullptr);
+	util::runInParallel(jobs, m_subs.size(), [&](size_t _subId) {
+		subTagReplacements[_subId] = &m_subs[_subId]->optimiseInternal(
 			settings,
-			JumpdestRemover::referencedTags(m_items, subId)
+			std::move(subTagsReferencedFromHere[_subId])
 		);
+	});
+	for (size_t subId = 0; subId < m_subs.size(); ++subId)
 		// Apply the replacements (can be empty).
-		BlockDeduplicator::applyTagReplacement(m_items, subTagReplacements, subId);
-	}
+		BlockDeduplicator::applyTagReplacement(m_items, *subTagReplacements[subId], subId);
 
 	std::map<u256, u256> tagReplacements;
 	// Iterate until no new optimisation possibilities are found.
@@ -719,6 +774,8 @@ std::map<u256, u256> const& Assembly::optimiseInternal(
 		count = 0;
 
 		if (_settings.runInliner)
+		{
+			util::PhaseTracer::Scope inlinerScope("Assembly::optimise: Inliner", m_name);
 			Inliner{
 				m_items,
 				_tagsReferencedFromOutside,
@@ -726,6 +783,7 @@ std::map<u256, u256> const& Assembly::optimiseInternal(
 				isCreation(),
 				_settings.evmVersion
 			}.optimise();
+		}
 
 		if (_settings.runJumpdestRemover)
 		{
@@ -781,13 +839,22 @@ std::map<u256, u256> const& Assembly::optimiseInternal(
 				return _i == AssemblyItem{Instruction::MSIZE} || _i.type() == VerbatimBytecode;
 			});
 
+			size_t splitBlocks = 0;
 			auto iter = m_items.begin();
 			while (iter != m_items.end())
 			{
 				KnownState emptyState;
 				CommonSubexpressionEliminator eliminator{emptyState};
 				auto orig = iter;
-				iter = eliminator.feedItems(iter, m_items.end(), usesMSize);
+				iter = eliminator.feedItems(
+					iter,
+					m_items.end(),
+					usesMSize,
+					_settings.maxCSEBlockSize,
+					_settings.maxCSEExpressionClasses
+				);
+				if (eliminator.budgetExceeded())
+					splitBlocks++;
 				bool shouldReplace = false;
 				AssemblyItems optimisedChunk;
 				try
@@ -814,6 +881,14 @@ std::map<u256, u256> const& Assembly::optimiseInternal(
 				else
 					copy(orig, iter, back_inserter(optimisedItems));
 			}
+			if (splitBlocks > 0 && util::PhaseTracer::current())
+			{
+				// Only recorded to make the trade-off visible in the trace, the scope itself is empty.
+				util::PhaseTracer::Scope budgetScope(
+					"Assembly::optimise: CSE split " + std::to_string(splitBlocks) + " block(s) exceeding the budget",
+					m_name
+				);
+			}
 			if (optimisedItems.size() < m_items.size())
 			{
 				m_items = std::move(optimisedItems);
@@ -834,7 +909,7 @@ std::map<u256, u256> const& Assembly::optimiseInternal(
 	return *m_tagReplacements;
 }
 
-LinkerObject const& Assembly::assemble() const
+LinkerObject const& Assembly::assemble(size_t _parallelism) const
 {
 	assertThrow(!m_invalid, AssemblyException, "Attempted to assemble invalid Assembly object.");
 	// Return the already assembled object, if present.
@@ -845,6 +920,16 @@ LinkerObject const& Assembly::assemble() const
 
 	LinkerObject& ret = m_assembledObject;
 
+	// Assemble the sub-assemblies up front. Like for the optimisation, this is only
+	// done concurrently if they do not share anything that still has to be assembled.
+	size_t const jobs = subAssembliesAreIndependent([](Assembly const& _assembly) {
+		return !_assembly.m_assembledObject.bytecode.empty();
+	}) ? _parallelism : 1;
+	size_t const subParallelism = std::max<size_t>(1, jobs / std::max<size_t>(1, m_subs.size()));
+	util::runInParallel(jobs, m_subs.size(), [&](size_t _subId) {
+		m_subs[_subId]->assemble(subParallelism);
+	});
+
 	size_t subTagSize = 1;
 	std::map<u256, std::pair<std::string, std::vector<size_t>>> immutableReferencesBySub;
 	for (auto const& sub: m_subs)
@@ -884,8 +969,10 @@ LinkerObject const& Assembly::assemble() const
 
 	unsigned bytesRequiredForCode = codeSize(static_cast<unsigned>(subTagSize));
 	m_tagPositionsInBytecode = std::vector<size_t>(m_usedTags, std::numeric_limits<size_t>::max());
-	std::map<size_t, std::pair<size_t, size_t>> tagRef;
-	std::multimap<h256, unsigned> dataRef;
+	// Relocation tables: positions in the bytecode that are filled in once the layout is known.
+	// Tag references are recorded in the order of their positions.
+	std::vector<std::pair<size_t, std::pair<size_t, size_t>>> tagRef;
+	std::map<h256, std::vector<unsigned>> dataRef;
 	std::multimap<size_t, size_t> subRef;
 	std::vector<unsigned> sizeRef; ///< Pointers to code locations where the size of the program is inserted
 	unsigned bytesPerTag = numberEncodingSize(bytesRequiredForCode);
@@ -909,9 +996,15 @@ LinkerObject const& Assembly::assemble() const
 
 	unsigned bytesPerDataRef = numberEncodingSize(bytesRequiredIncludingData);
 	uint8_t dataRefPush = static_cast<uint8_t>(pushInstruction(bytesPerDataRef));
-	ret.bytecode.reserve(bytesRequiredIncludingData);
+	// Also reserve space for the data, so that the bytecode does not have to be reallocated at all.
+	size_t bytesReserved = bytesRequiredIncludingData;
+	for (auto const& dataItem: m_data)
+		bytesReserved += dataItem.second.size();
+	ret.bytecode.reserve(bytesReserved);
 
-	for (AssemblyItem const& i: m_items)
+	// Indices of the tags in the items, for the function debug data.
+	std::map<size_t, size_t> tagIndices;
+	for (auto&& [index, i]: m_items | ranges::views::enumerate)
 	{
 		// store position of the invalid jump destination
 		if (i.type() != Tag && m_tagPositionsInBytecode[0] == std::numeric_limits<size_t>::max())
@@ -941,13 +1034,13 @@ LinkerObject const& Assembly::assemble() const
 		case PushTag:
 		{
 			ret.bytecode.push_back(tagPush);
-			tagRef[ret.bytecode.size()] = i.splitForeignPushTag();
+			tagRef.emplace_back(ret.bytecode.size(), i.splitForeignPushTag());
 			ret.bytecode.resize(ret.bytecode.size() + bytesPerTag);
 			break;
 		}
 		case PushData:
 			ret.bytecode.push_back(dataRefPush);
-			dataRef.insert(std::make_pair(h256(i.data()), ret.bytecode.size()));
+			dataRef[h256(i.data())].push_back(static_cast<unsigned>(ret.bytecode.size()));
 			ret.bytecode.resize(ret.bytecode.size() + bytesPerDataRef);
 			break;
 		case PushSub:
@@ -960,7 +1053,7 @@ LinkerObject const& Assembly::assemble() const
 		{
 			assertThrow(i.data() <= std::numeric_limits<size_t>::max(), AssemblyException, "");
 			auto s = subAssemblyById(static_cast<size_t>(i.data()))->assemble().bytecode.size();
-			i.setPushedValue(u256(s));
+			i.setPushedValue(s);
 			unsigned b = std::max<unsigned>(1, numberEncodingSize(s));
 			ret.bytecode.push_back(static_cast<uint8_t>(pushInstruction(b)));
 			ret.bytecode.resize(ret.bytecode.size() + b);
@@ -992,6 +1085,13 @@ LinkerObject const& Assembly::assemble() const
 		case VerbatimBytecode:
 			ret.bytecode += i.verbatimData();
 			break;
+		case DupN:
+		case SwapN:
+			// The immediate argument is the depth reduced by one, s.t. DUPN 0 acts like DUP1 and SWAPN 0 like SWAP1.
+			assertThrow(1 <= i.data() && i.data() <= 256, AssemblyException, "Invalid stack access depth.");
+			ret.bytecode.push_back(static_cast<uint8_t>(i.type() == DupN ? Instruction::DUPN : Instruction::SWAPN));
+			ret.bytecode.push_back(static_cast<uint8_t>(i.data() - 1));
+			break;
 		case AssignImmutable:
 		{
 			// Expect 2 elements on stack (source, dest_base)
@@ -1004,9 +1104,11 @@ LinkerObject const& Assembly::assemble() const
 					ret.bytecode.push_back(uint8_t(Instruction::DUP2));
 				}
 				// TODO: should we make use of the constant optimizer methods for pushing the offsets?
-				bytes offsetBytes = toCompactBigEndian(u256(offsets[i]));
-				ret.bytecode.push_back(static_cast<uint8_t>(pushInstruction(static_cast<unsigned>(offsetBytes.size()))));
-				ret.bytecode += offsetBytes;
+				unsigned offsetSize = numberEncodingSize(offsets[i]);
+				ret.bytecode.push_back(static_cast<uint8_t>(pushInstruction(offsetSize)));
+				ret.bytecode.resize(ret.bytecode.size() + offsetSize);
+				bytesRef offsetBytes(ret.bytecode.data() + ret.bytecode.size() - offsetSize, offsetSize);
+				toBigEndian(offsets[i], offsetBytes);
 				ret.bytecode.push_back(uint8_t(Instruction::ADD));
 				ret.bytecode.push_back(uint8_t(Instruction::MSTORE));
 			}
@@ -1030,6 +1132,7 @@ LinkerObject const& Assembly::assemble() const
 			assertThrow(ret.bytecode.size() < 0xffffffffL, AssemblyException, "Tag too large.");
 			assertThrow(m_tagPositionsInBytecode[tagId] == std::numeric_limits<size_t>::max(), AssemblyException, "Duplicate tag position.");
 			m_tagPositionsInBytecode[tagId] = ret.bytecode.size();
+			tagIndices.emplace(tagId, index);
 			ret.bytecode.push_back(static_cast<uint8_t>(Instruction::JUMPDEST));
 			break;
 		}
@@ -1053,7 +1156,8 @@ LinkerObject const& Assembly::assemble() const
 	std::map<LinkerObject, size_t> subAssemblyOffsets;
 	for (auto const& [subIdPath, bytecodeOffset]: subRef)
 	{
-		LinkerObject subObject = subAssemblyById(subIdPath)->assemble();
+		// The sub-assembly is already assembled, so this refers to its cached object.
+		LinkerObject const& subObject = subAssemblyById(subIdPath)->assemble();
 		bytesRef r(ret.bytecode.data() + bytecodeOffset, bytesPerDataRef);
 
 		// In order for de-duplication to kick in, not only must the bytecode be identical, but
@@ -1090,12 +1194,8 @@ LinkerObject const& Assembly::assemble() const
 	{
 		size_t position = m_tagPositionsInBytecode.at(tagInfo.id);
 		std::optional<size_t> tagIndex;
-		for (auto&& [index, item]: m_items | ranges::views::enumerate)
-			if (item.type() == Tag && static_cast<size_t>(item.data()) == tagInfo.id)
-			{
-				tagIndex = index;
-				break;
-			}
+		if (size_t const* index = util::valueOrNullptr(tagIndices, tagInfo.id))
+			tagIndex = *index;
 		ret.functionDebugData[name] = {
 			position == std::numeric_limits<size_t>::max() ? std::nullopt : std::optional<size_t>{position},
 			tagIndex,
@@ -1107,12 +1207,12 @@ LinkerObject const& Assembly::assemble() const
 
 	for (auto const& dataItem: m_data)
 	{
-		auto references = dataRef.equal_range(dataItem.first);
-		if (references.first == references.second)
+		std::vector<unsigned> const* references = util::valueOrNullptr(dataRef, dataItem.first);
+		if (!references)
 			continue;
-		for (auto ref = references.first; ref != references.second; ++ref)
+		for (unsigned ref: *references)
 		{
-			bytesRef r(ret.bytecode.data() + ref->second, bytesPerDataRef);
+			bytesRef r(ret.bytecode.data() + ref, bytesPerDataRef);
 			toBigEndian(ret.bytecode.size(), r);
 		}
 		ret.bytecode += dataItem.second;
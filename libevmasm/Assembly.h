@@ -34,7 +34,9 @@
 
 #include <libsolidity/interface/OptimiserSettings.h>
 
+#include <functional>
 #include <iostream>
+#include <limits>
 #include <sstream>
 #include <memory>
 #include <map>
@@ -114,7 +116,9 @@ public:
 	langutil::EVMVersion const& evmVersion() const { return m_evmVersion; }
 
 	/// Assembles the assembly into bytecode. The assembly should not be modified after this call, since the assembled version is cached.
-	LinkerObject const& assemble() const;
+	/// Sub-assemblies that do not share anything that still has to be assembled are assembled
+	/// concurrently, using at most @a _parallelism threads.
+	LinkerObject const& assemble(size_t _parallelism = 1) const;
 
 	struct OptimiserSettings
 	{
@@ -128,6 +132,13 @@ public:
 		/// This specifies an estimate on how often each opcode in this assembly will be executed,
 		/// i.e. use a small value to optimise for size and a large value to optimise for runtime gas usage.
 		size_t expectedExecutionsPerDeployment = frontend::OptimiserSettings{}.expectedExecutionsPerDeployment;
+		/// Maximum number of threads used to optimise independent sub-assemblies concurrently.
+		size_t parallelism = 1;
+		/// Length after which basic blocks are split for the common subexpression eliminator.
+		size_t maxCSEBlockSize = 2000;
+		/// Number of expression classes after which basic blocks are split for the common
+		/// subexpression eliminator. Bounds the time spent on long blocks that create many classes.
+		size_t maxCSEExpressionClasses = std::numeric_limits<size_t>::max();
 
 		static OptimiserSettings translateSettings(frontend::OptimiserSettings const& _settings, langutil::EVMVersion const& _evmVersion);
 	};
@@ -180,6 +191,9 @@ protected:
 	/// returns the replaced tags. Also takes an argument containing the tags of this assembly
 	/// that are referenced in a super-assembly.
 	std::map<u256, u256> const& optimiseInternal(OptimiserSettings const& _settings, std::set<size_t> _tagsReferencedFromOutside);
+	/// @returns true if no assembly for which @a _isDone returns false is reachable through more
+	/// than one path starting at the sub-assemblies of this assembly.
+	bool subAssembliesAreIndependent(std::function<bool(Assembly const&)> const& _isDone) const;
 
 	unsigned codeSize(unsigned subTagSize) const;
 
@@ -246,6 +260,8 @@ protected:
 	/// currently
 	std::string m_name;
 	langutil::SourceLocation m_currentSourceLocation;
+	/// Debug data of the items appended at @a m_currentSourceLocation without debug data of their own.
+	langutil::DebugData::ConstPtr m_currentSourceLocationDebugData;
 
 	// FIXME: This being static means that the strings won't be freed when they're no longer needed
 	static std::map<std::string, std::shared_ptr<std::string const>> s_sharedSourceNames;
@@ -27,6 +27,7 @@
 #include <libsolutil/FixedHash.h>
 #include <liblangutil/SourceLocation.h>
 
+#include <charconv>
 #include <fstream>
 #include <limits>
 
@@ -74,7 +75,7 @@ std::pair<std::string, std::string> AssemblyItem::nameAndData(langutil::EVMVersi
 	switch (type())
 	{
 	case Operation:
-		return {instructionInfo(instruction(), _evmVersion).name, m_data != nullptr ? toStringInHex(*m_data) : ""};
+		return {instructionInfo(instruction(), _evmVersion).name, ""};
 	case Push:
 		return {"PUSH", toStringInHex(data())};
 	case PushTag:
@@ -102,6 +103,10 @@ std::pair<std::string, std::string> AssemblyItem::nameAndData(langutil::EVMVersi
 		return {"PUSH data", toStringInHex(data())};
 	case VerbatimBytecode:
 		return {"VERBATIM", util::toHex(verbatimData())};
+	case DupN:
+		return {"DUPN", util::toString(data())};
+	case SwapN:
+		return {"SWAPN", util::toString(data())};
 	default:
 		assertThrow(false, InvalidOpcode, "");
 	}
@@ -159,6 +164,9 @@ size_t AssemblyItem::bytesRequired(size_t _addressLength, Precision _precision)
 	}
 	case VerbatimBytecode:
 		return std::get<2>(*m_verbatimBytecode).size();
+	case DupN:
+	case SwapN:
+		return 2; // opcode and immediate depth
 	default:
 		break;
 	}
@@ -175,6 +183,10 @@ size_t AssemblyItem::arguments() const
 		return std::get<0>(*m_verbatimBytecode);
 	else if (type() == AssignImmutable)
 		return 2;
+	else if (type() == DupN)
+		return static_cast<size_t>(data());
+	else if (type() == SwapN)
+		return static_cast<size_t>(data()) + 1;
 	else
 		return 0;
 }
@@ -201,6 +213,9 @@ size_t AssemblyItem::returnValues() const
 		return 0;
 	case VerbatimBytecode:
 		return std::get<1>(*m_verbatimBytecode);
+	case DupN:
+	case SwapN:
+		return static_cast<size_t>(data()) + 1;
 	default:
 		break;
 	}
@@ -325,6 +340,12 @@ std::string AssemblyItem::toAssemblyText(Assembly const& _assembly) const
 	case VerbatimBytecode:
 		text = std::string("verbatimbytecode_") + util::toHex(std::get<2>(*m_verbatimBytecode));
 		break;
+	case DupN:
+		text = std::string("dupn(") + util::toString(data()) + ")";
+		break;
+	case SwapN:
+		text = std::string("swapn(") + util::toString(data()) + ")";
+		break;
 	default:
 		assertThrow(false, InvalidOpcode, "");
 	}
@@ -394,6 +415,12 @@ std::ostream& solidity::evmasm::operator<<(std::ostream& _out, AssemblyItem cons
 	case VerbatimBytecode:
 		_out << " Verbatim " << util::toHex(_item.verbatimData());
 		break;
+	case DupN:
+		_out << " DUPN " << _item.data();
+		break;
+	case SwapN:
+		_out << " SWAPN " << _item.data();
+		break;
 	case UndefinedItem:
 		_out << " ???";
 		break;
@@ -429,6 +456,15 @@ std::string AssemblyItem::computeSourceMapping(
 )
 {
 	std::string ret;
+	// Most entries of a compressed source mapping consist of a few characters only.
+	ret.reserve(_items.size() * 4);
+
+	auto appendNumber = [&](int _value) {
+		char buffer[16];
+		auto [end, error] = std::to_chars(std::begin(buffer), std::end(buffer), _value);
+		solAssert(error == std::errc{});
+		ret.append(buffer, end);
+	};
 
 	int prevStart = -1;
 	int prevLength = -1;
@@ -443,10 +479,10 @@ std::string AssemblyItem::computeSourceMapping(
 
 		SourceLocation const& location = item.location();
 		int length = location.start != -1 && location.end != -1 ? location.end - location.start : -1;
-		int sourceIndex =
-			(location.sourceName && _sourceIndicesMap.count(*location.sourceName)) ?
-			static_cast<int>(_sourceIndicesMap.at(*location.sourceName)) :
-			-1;
+		int sourceIndex = -1;
+		if (location.sourceName)
+			if (auto it = _sourceIndicesMap.find(*location.sourceName); it != _sourceIndicesMap.end())
+				sourceIndex = static_cast<int>(it->second);
 		char jump = '-';
 		if (item.getJumpType() == evmasm::AssemblyItem::JumpType::IntoFunction)
 			jump = 'i';
@@ -477,17 +513,17 @@ std::string AssemblyItem::computeSourceMapping(
 		if (components-- > 0)
 		{
 			if (location.start != prevStart)
-				ret += std::to_string(location.start);
+				appendNumber(location.start);
 			if (components-- > 0)
 			{
 				ret += ':';
 				if (length != prevLength)
-					ret += std::to_string(length);
+					appendNumber(length);
 				if (components-- > 0)
 				{
 					ret += ':';
 					if (sourceIndex != prevSourceIndex)
-						ret += std::to_string(sourceIndex);
+						appendNumber(sourceIndex);
 					if (components-- > 0)
 					{
 						ret += ':';
@@ -497,7 +533,7 @@ std::string AssemblyItem::computeSourceMapping(
 						{
 							ret += ':';
 							if (modifierDepth != prevModifierDepth)
-								ret += std::to_string(modifierDepth);
+								appendNumber(modifierDepth);
 						}
 					}
 				}
@@ -505,7 +541,7 @@ std::string AssemblyItem::computeSourceMapping(
 		}
 
 		if (item.opcodeCount() > 1)
-			ret += std::string(item.opcodeCount() - 1, ';');
+			ret.append(item.opcodeCount() - 1, ';');
 
 		prevStart = location.start;
 		prevLength = length;
@@ -51,7 +51,9 @@ enum AssemblyItemType
 	PushDeployTimeAddress, ///< Push an address to be filled at deploy time. Should not be touched by the optimizer.
 	PushImmutable, ///< Push the currently unknown value of an immutable variable. The actual value will be filled in by the constructor.
 	AssignImmutable, ///< Assigns the current value on the stack to an immutable variable. Only valid during creation code.
-	VerbatimBytecode ///< Contains data that is inserted into the bytecode code section without modification.
+	VerbatimBytecode, ///< Contains data that is inserted into the bytecode code section without modification.
+	DupN, ///< Duplicates the stack slot at the depth given by the data, i.e. acts like DUP<data>. EOF only.
+	SwapN ///< Swaps the stack top with the slot at the depth given by the data, i.e. acts like SWAP<data>. EOF only.
 };
 
 enum class Precision { Precise , Approximate };
@@ -79,12 +81,12 @@ public:
 		if (m_type == Operation)
 			m_instruction = Instruction(uint8_t(_data));
 		else
-			m_data = std::make_shared<u256>(std::move(_data));
+			m_data = std::move(_data);
 	}
 	explicit AssemblyItem(bytes _verbatimData, size_t _arguments, size_t _returnVariables):
 		m_type(VerbatimBytecode),
 		m_instruction{},
-		m_verbatimBytecode{{_arguments, _returnVariables, std::move(_verbatimData)}},
+		m_verbatimBytecode{std::make_shared<VerbatimBytecodeData const>(_arguments, _returnVariables, std::move(_verbatimData))},
 		m_debugData{langutil::DebugData::create()}
 	{}
 
@@ -105,8 +107,8 @@ public:
 	void setPushTagSubIdAndTag(size_t _subId, size_t _tag);
 
 	AssemblyItemType type() const { return m_type; }
-	u256 const& data() const { assertThrow(m_type != Operation, util::Exception, ""); return *m_data; }
-	void setData(u256 const& _data) { assertThrow(m_type != Operation, util::Exception, ""); m_data = std::make_shared<u256>(_data); }
+	u256 const& data() const { assertThrow(m_type != Operation, util::Exception, ""); return m_data; }
+	void setData(u256 const& _data) { assertThrow(m_type != Operation, util::Exception, ""); m_data = _data; }
 
 	/// This function is used in `Assembly::assemblyJSON`.
 	/// It returns the name & data of the current assembly item.
@@ -201,8 +203,8 @@ public:
 	JumpType getJumpType() const { return m_jumpType; }
 	std::string getJumpTypeAsString() const;
 
-	void setPushedValue(u256 const& _value) const { m_pushedValue = std::make_shared<u256>(_value); }
-	u256 const* pushedValue() const { return m_pushedValue.get(); }
+	void setPushedValue(size_t _value) const { m_pushedValue = _value; }
+	std::optional<size_t> pushedValue() const { return m_pushedValue; }
 
 	std::string toAssemblyText(Assembly const& _assembly) const;
 
@@ -213,17 +215,22 @@ public:
 private:
 	size_t opcodeCount() const noexcept;
 
+	/// Number of arguments, number of return variables and verbatim bytecode.
+	using VerbatimBytecodeData = std::tuple<size_t, size_t, bytes>;
+
+	/// The small fields are grouped in front so that they share a single word.
 	AssemblyItemType m_type;
 	Instruction m_instruction; ///< Only valid if m_type == Operation
-	std::shared_ptr<u256> m_data; ///< Only valid if m_type != Operation
-	/// If m_type == VerbatimBytecode, this holds number of arguments, number of
-	/// return variables and verbatim bytecode.
-	std::optional<std::tuple<size_t, size_t, bytes>> m_verbatimBytecode;
-	langutil::DebugData::ConstPtr m_debugData;
 	JumpType m_jumpType = JumpType::Ordinary;
+	/// Stored inline, items are copied a lot by the optimiser and a separate
+	/// allocation per item would dominate.
+	u256 m_data; ///< Only valid if m_type != Operation
+	/// Only set if m_type == VerbatimBytecode. The data is immutable and thus shared between copies.
+	std::shared_ptr<VerbatimBytecodeData const> m_verbatimBytecode;
+	langutil::DebugData::ConstPtr m_debugData;
 	/// Pushed value for operations with data to be determined during assembly stage,
-	/// e.g. PushSubSize, PushTag, PushSub, etc.
-	mutable std::shared_ptr<u256> m_pushedValue;
+	/// i.e. PushSubSize.
+	mutable std::optional<size_t> m_pushedValue;
 	/// Number of PushImmutable's with the same hash. Only used for AssignImmutable.
 	mutable std::optional<size_t> m_immutableOccurrences;
 };
@@ -27,13 +27,48 @@
 #include <libevmasm/AssemblyItem.h>
 #include <libevmasm/SemanticInformation.h>
 
+#include <boost/container_hash/hash.hpp>
+
+#include <algorithm>
 #include <functional>
-#include <set>
+#include <unordered_map>
 
 using namespace solidity;
 using namespace solidity::evmasm;
 
 
+namespace
+{
+
+/// Base of the polynomial hash of blocks. Odd, so that it is invertible modulo 2**64.
+uint64_t constexpr hashBase = 0x100000001b3;
+
+/// @returns the multiplicative inverse of the odd number @a _x modulo 2**64.
+uint64_t inverse(uint64_t _x)
+{
+	// Newton's iteration doubles the number of correct low bits in each step.
+	uint64_t result = _x;
+	for (size_t i = 0; i < 5; ++i)
+		result *= 2 - _x * result;
+	return result;
+}
+
+/// @returns a hash of @a _item that is consistent with AssemblyItem::operator==.
+uint64_t itemHash(AssemblyItem const& _item)
+{
+	size_t seed = 0;
+	boost::hash_combine(seed, static_cast<int>(_item.type()));
+	if (_item.type() == Operation)
+		boost::hash_combine(seed, _item.instruction());
+	else if (_item.type() == VerbatimBytecode)
+		boost::hash_range(seed, _item.verbatimData().begin(), _item.verbatimData().end());
+	else
+		boost::hash_combine(seed, _item.data());
+	return seed;
+}
+
+}
+
 bool BlockDeduplicator::deduplicate()
 {
 	// Compares indices based on the suffix that starts there, ignoring tags and stopping at
@@ -48,48 +83,90 @@ bool BlockDeduplicator::deduplicate()
 	)
 		return false;
 
-	std::function<bool(size_t, size_t)> comparator = [&](size_t _i, size_t _j)
+	auto blocksEqual = [&](size_t _i, size_t _j)
 	{
-		if (_i == _j)
-			return false;
-
 		// To compare recursive loops, we have to already unify PushTag opcodes of the
 		// block's own tag.
-		AssemblyItem pushFirstTag{pushSelf};
-		AssemblyItem pushSecondTag{pushSelf};
-
-		if (_i < m_items.size() && m_items.at(_i).type() == Tag)
-			pushFirstTag = m_items.at(_i).pushTag();
-		if (_j < m_items.size() && m_items.at(_j).type() == Tag)
-			pushSecondTag = m_items.at(_j).pushTag();
+		AssemblyItem pushFirstTag = m_items.at(_i).pushTag();
+		AssemblyItem pushSecondTag = m_items.at(_j).pushTag();
 
 		using diff_type = BlockIterator::difference_type;
 		BlockIterator first{m_items.begin() + diff_type(_i), m_items.end(), &pushFirstTag, &pushSelf};
 		BlockIterator second{m_items.begin() + diff_type(_j), m_items.end(), &pushSecondTag, &pushSelf};
 		BlockIterator end{m_items.end(), m_items.end()};
 
-		if (first != end && (*first).type() == Tag)
-			++first;
-		if (second != end && (*second).type() == Tag)
-			++second;
-
-		return std::lexicographical_compare(first, end, second, end);
+		return std::equal(++first, end, ++second, end);
 	};
 
+	// The blocks are hashed with a polynomial hash over the non-tag items, which allows
+	// to compute the hash of every block from prefix sums in constant time (plus the
+	// occurrences of the block's own tag), instead of walking the block each time.
+	uint64_t const inverseBase = inverse(hashBase);
+	uint64_t const pushSelfHash = itemHash(pushSelf);
+	// The number of items does not change, only the values of tag pushes.
+	std::vector<uint64_t> powers{1};
+	std::vector<uint64_t> inversePowers{1};
+	for (size_t i = 0; i < m_items.size(); ++i)
+	{
+		powers.push_back(powers.back() * hashBase);
+		inversePowers.push_back(inversePowers.back() * inverseBase);
+	}
+
 	size_t iterations = 0;
 	for (; ; ++iterations)
 	{
-		//@todo this should probably be optimized.
-		std::set<size_t, std::function<bool(size_t, size_t)>> blocksSeen(comparator);
+		// Prefix sums of the item hashes, weighed by the power of their position.
+		// Positions only count non-tag items.
+		std::vector<uint64_t> prefixHashes{0};
+		// Position of the first non-tag item at or after the respective item.
+		std::vector<size_t> positions(m_items.size() + 1);
+		// Position after the end of the block continuing at the respective item.
+		std::vector<size_t> blockEnds(m_items.size() + 1);
+		// Positions of the pushes of each tag.
+		std::map<u256, std::vector<size_t>> tagPushes;
+		for (size_t i = 0; i < m_items.size(); ++i)
+		{
+			AssemblyItem const& item = m_items[i];
+			size_t position = prefixHashes.size() - 1;
+			positions[i] = position;
+			if (item.type() == Tag)
+				continue;
+			if (item.type() == PushTag)
+				tagPushes[item.data()].push_back(position);
+			prefixHashes.push_back(prefixHashes.back() + itemHash(item) * powers[position]);
+		}
+		positions[m_items.size()] = prefixHashes.size() - 1;
+		blockEnds[m_items.size()] = positions[m_items.size()];
+		for (size_t i = m_items.size(); i-- > 0;)
+			if (m_items[i].type() != Tag && SemanticInformation::altersControlFlow(m_items[i]) && m_items[i] != Instruction::JUMPI)
+				blockEnds[i] = positions[i] + 1;
+			else
+				blockEnds[i] = blockEnds[i + 1];
+
+		std::unordered_map<uint64_t, std::vector<size_t>> blocksSeen;
 		for (size_t i = 0; i < m_items.size(); ++i)
 		{
 			if (m_items.at(i).type() != Tag)
 				continue;
-			auto it = blocksSeen.find(i);
-			if (it == blocksSeen.end())
-				blocksSeen.insert(i);
+			size_t begin = positions[i];
+			size_t end = blockEnds[i];
+			uint64_t hash = prefixHashes[end] - prefixHashes[begin];
+			auto pushes = tagPushes.find(m_items[i].data());
+			if (pushes != tagPushes.end())
+				for (
+					auto it = std::lower_bound(pushes->second.begin(), pushes->second.end(), begin);
+					it != pushes->second.end() && *it < end;
+					++it
+				)
+					hash += (pushSelfHash - itemHash(m_items[i].pushTag())) * powers[*it];
+			hash *= inversePowers[begin];
+
+			std::vector<size_t>& candidates = blocksSeen[hash];
+			auto equal = std::find_if(candidates.begin(), candidates.end(), [&](size_t _j) { return blocksEqual(_j, i); });
+			if (equal == candidates.end())
+				candidates.push_back(i);
 			else
-				m_replacedTags[m_items.at(i).data()] = m_items.at(*it).data();
+				m_replacedTags[m_items.at(i).data()] = m_items.at(*equal).data();
 		}
 
 		if (!applyTagReplacement(m_items, m_replacedTags))
@@ -24,6 +24,7 @@
 
 #pragma once
 
+#include <limits>
 #include <map>
 #include <ostream>
 #include <set>
@@ -71,8 +72,20 @@ public:
 	/// Feeds AssemblyItems into the eliminator and @returns the iterator pointing at the first
 	/// item that must be fed into a new instance of the eliminator.
 	/// @param _msizeImportant if false, do not consider modification of MSIZE a side-effect
+	/// @param _maxBlockSize the number of items after which the block is split.
+	/// @param _maxExpressionClasses the number of expression classes in the known state
+	///        after which the block is split.
 	template <class AssemblyItemIterator>
-	AssemblyItemIterator feedItems(AssemblyItemIterator _iterator, AssemblyItemIterator _end, bool _msizeImportant);
+	AssemblyItemIterator feedItems(
+		AssemblyItemIterator _iterator,
+		AssemblyItemIterator _end,
+		bool _msizeImportant,
+		size_t _maxBlockSize = 2000,
+		size_t _maxExpressionClasses = std::numeric_limits<size_t>::max()
+	);
+
+	/// @returns true if the last call to feedItems split the block because one of the limits was reached.
+	bool budgetExceeded() const { return m_budgetExceeded; }
 
 	/// @returns the resulting items after optimization.
 	AssemblyItems getOptimizedItems();
@@ -93,6 +106,7 @@ private:
 	/// The item that breaks the basic block, can be nullptr.
 	/// It is usually appended to the block but can be optimized in some cases.
 	AssemblyItem const* m_breakingItem = nullptr;
+	bool m_budgetExceeded = false;
 };
 
 /**
@@ -175,20 +189,26 @@ template <class AssemblyItemIterator>
 AssemblyItemIterator CommonSubexpressionEliminator::feedItems(
 	AssemblyItemIterator _iterator,
 	AssemblyItemIterator _end,
-	bool _msizeImportant
+	bool _msizeImportant,
+	size_t _maxBlockSize,
+	size_t _maxExpressionClasses
 )
 {
 	assertThrow(!m_breakingItem, OptimizerException, "Invalid use of CommonSubexpressionEliminator.");
-	unsigned const maxChunkSize = 2000;
-	unsigned chunkSize = 0;
-	for (
-		;
-		_iterator != _end && !SemanticInformation::breaksCSEAnalysisBlock(*_iterator, _msizeImportant) && chunkSize < maxChunkSize;
-		++_iterator, ++chunkSize
-	)
+	for (size_t blockSize = 0; _iterator != _end; ++_iterator, ++blockSize)
+	{
+		if (blockSize >= _maxBlockSize || m_state.expressionClasses().size() >= _maxExpressionClasses)
+		{
+			m_budgetExceeded = true;
+			break;
+		}
+		if (SemanticInformation::breaksCSEAnalysisBlock(*_iterator, _msizeImportant))
+		{
+			m_breakingItem = &(*_iterator++);
+			break;
+		}
 		feedItem(*_iterator);
-	if (_iterator != _end && chunkSize < maxChunkSize)
-		m_breakingItem = &(*_iterator++);
+	}
 	return _iterator;
 }
 
@@ -24,9 +24,72 @@
 #include <libevmasm/Assembly.h>
 #include <libevmasm/GasMeter.h>
 
+#include <map>
+#include <mutex>
+#include <optional>
+#include <tuple>
+
 using namespace solidity;
 using namespace solidity::evmasm;
 
+namespace
+{
+
+/// Process-wide cache of the representations found by ComputeMethod.
+/// The same constants (especially masks) appear in many assemblies and searching for
+/// their representation is the most expensive part of the constant optimiser.
+/// The result only depends on the value and the parameters, so it can be shared freely
+/// (including between assemblies optimised concurrently).
+class RepresentationCache
+{
+public:
+	/// Value, whether it is creation code, runs, multiplicity and EVM version.
+	using Key = std::tuple<u256, bool, size_t, size_t, langutil::EVMVersion>;
+
+	static RepresentationCache& instance()
+	{
+		static RepresentationCache cache;
+		return cache;
+	}
+
+	std::optional<AssemblyItems> find(Key const& _key)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		auto it = m_representations.find(_key);
+		if (it == m_representations.end())
+		{
+			m_statistics.misses++;
+			return std::nullopt;
+		}
+		m_statistics.hits++;
+		return it->second;
+	}
+
+	void insert(Key _key, AssemblyItems _routine)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		// Keep long-running processes from growing without bound.
+		if (m_representations.size() >= maxSize)
+			m_representations.clear();
+		m_representations.emplace(std::move(_key), std::move(_routine));
+	}
+
+	ConstantOptimisationMethod::CacheStatistics statistics()
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		return m_statistics;
+	}
+
+private:
+	static size_t constexpr maxSize = 0x10000;
+
+	std::mutex m_mutex;
+	std::map<Key, AssemblyItems> m_representations;
+	ConstantOptimisationMethod::CacheStatistics m_statistics;
+};
+
+}
+
 unsigned ConstantOptimisationMethod::optimiseConstants(
 	bool _isCreation,
 	size_t _runs,
@@ -78,6 +141,11 @@ unsigned ConstantOptimisationMethod::optimiseConstants(
 	return optimisations;
 }
 
+ConstantOptimisationMethod::CacheStatistics ConstantOptimisationMethod::cacheStatistics()
+{
+	return RepresentationCache::instance().statistics();
+}
+
 bigint ConstantOptimisationMethod::simpleRunGas(AssemblyItems const& _items, langutil::EVMVersion _evmVersion)
 {
 	bigint gas = 0;
@@ -186,6 +254,31 @@ AssemblyItems const& CodeCopyMethod::copyRoutine()
 	return copyRoutine;
 }
 
+ComputeMethod::ComputeMethod(Params const& _params, u256 const& _value):
+	ConstantOptimisationMethod(_params, _value)
+{
+	RepresentationCache::Key key{
+		m_value,
+		m_params.isCreation,
+		m_params.runs,
+		m_params.multiplicity,
+		m_params.evmVersion
+	};
+	RepresentationCache& cache = RepresentationCache::instance();
+	if (std::optional<AssemblyItems> cached = cache.find(key))
+		m_routine = std::move(*cached);
+	else
+	{
+		m_routine = findRepresentation(m_value);
+		assertThrow(
+			checkRepresentation(m_value, m_routine),
+			OptimizerException,
+			"Invalid constant expression created."
+		);
+		cache.insert(std::move(key), m_routine);
+	}
+}
+
 AssemblyItems ComputeMethod::findRepresentation(u256 const& _value)
 {
 	if (_value < 0x10000)
@@ -208,15 +301,16 @@ AssemblyItems ComputeMethod::findRepresentation(u256 const& _value)
 
 			u256 powerOfTwo = u256(1) << bits;
 			u256 upperPart = _value >> bits;
-			bigint lowerPart = _value & (powerOfTwo - 1);
-			if ((powerOfTwo - lowerPart) < lowerPart)
+			// bits is at most 255, so both signs of the lower part fit into s256.
+			s256 lowerPart = s256(_value & (powerOfTwo - 1));
+			if (s256(powerOfTwo) - lowerPart < lowerPart)
 			{
-				lowerPart = lowerPart - powerOfTwo; // make it negative
+				lowerPart = lowerPart - s256(powerOfTwo); // make it negative
 				upperPart++;
 			}
 			if (upperPart == 0)
 				continue;
-			if (abs(lowerPart) >= (powerOfTwo >> 8))
+			if (abs(lowerPart) >= s256(powerOfTwo >> 8))
 				continue;
 
 			AssemblyItems newRoutine;
@@ -290,7 +384,7 @@ bool ComputeMethod::checkRepresentation(u256 const& _value, AssemblyItems const&
 					"Shift generated for invalid EVM version."
 				);
 				assertThrow(sp[0] <= u256(255), OptimizerException, "Invalid shift generated.");
-				sp[-1] = u256(bigint(sp[-1]) << unsigned(sp[0]));
+				sp[-1] = u256(u512(sp[-1]) << unsigned(sp[0]));
 				break;
 			case Instruction::SHR:
 				assertThrow(
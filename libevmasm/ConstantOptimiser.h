@@ -54,6 +54,15 @@ public:
 		Assembly& _assembly
 	);
 
+	/// Number of lookups in the cache of computed representations that were (not) answered
+	/// from the cache. The cache is shared by all assemblies optimised in this process.
+	struct CacheStatistics
+	{
+		size_t hits = 0;
+		size_t misses = 0;
+	};
+	static CacheStatistics cacheStatistics();
+
 protected:
 	/// This is the public API for the optimiser methods, but it doesn't need to be exposed to the caller.
 
@@ -132,16 +141,9 @@ protected:
 class ComputeMethod: public ConstantOptimisationMethod
 {
 public:
-	explicit ComputeMethod(Params const& _params, u256 const& _value):
-		ConstantOptimisationMethod(_params, _value)
-	{
-		m_routine = findRepresentation(m_value);
-		assertThrow(
-			checkRepresentation(m_value, m_routine),
-			OptimizerException,
-			"Invalid constant expression created."
-		);
-	}
+	/// Looks up the representation of @a _value in the cache and only computes
+	/// it if it has not yet been computed for equal parameters.
+	explicit ComputeMethod(Params const& _params, u256 const& _value);
 
 	bigint gasNeeded() const override { return gasNeeded(m_routine); }
 	AssemblyItems execute(Assembly&) const override
@@ -20,6 +20,7 @@
 
 #include <libsolutil/Common.h>
 #include <libsolutil/CommonIO.h>
+#include <algorithm>
 #include <functional>
 
 using namespace solidity;
@@ -27,50 +28,128 @@ using namespace solidity::util;
 using namespace solidity::evmasm;
 
 
+InstructionIterator::InstructionIterator(bytesConstRef _code, langutil::EVMVersion _evmVersion, size_t _offset):
+	m_code(_code),
+	m_evmVersion(_evmVersion)
+{
+	m_current.offset = _offset;
+	decode();
+}
+
+InstructionIterator& InstructionIterator::operator++()
+{
+	m_current.offset = std::min(m_code.size(), m_current.offset + 1 + m_current.immediate.size());
+	decode();
+	return *this;
+}
+
+void InstructionIterator::decode()
+{
+	if (m_current.offset >= m_code.size())
+	{
+		m_current.immediate = {};
+		return;
+	}
+	m_current.instruction = Instruction{m_code[m_current.offset]};
+	size_t additional = 0;
+	if (isValidInstruction(m_current.instruction))
+		additional = static_cast<size_t>(instructionInfo(m_current.instruction, m_evmVersion).additional);
+	m_current.immediate = m_code.cropped(
+		m_current.offset + 1,
+		std::min(additional, m_code.size() - m_current.offset - 1)
+	);
+}
+
 void solidity::evmasm::eachInstruction(
 	bytes const& _mem,
 	langutil::EVMVersion _evmVersion,
 	std::function<void(Instruction,u256 const&)> const& _onInstruction
 )
 {
-	for (auto it = _mem.begin(); it < _mem.end(); ++it)
+	for (DisassembledInstruction const& instruction: instructions(bytesConstRef(&_mem), _evmVersion))
 	{
-		Instruction const instr{*it};
-		int additional = 0;
-		if (isValidInstruction(instr))
-			additional = instructionInfo(instr, _evmVersion).additional;
+		size_t additional = 0;
+		if (isValidInstruction(instruction.instruction))
+			additional = static_cast<size_t>(instructionInfo(instruction.instruction, _evmVersion).additional);
 
 		u256 data{};
-
 		// fill the data with the additional data bytes from the instruction stream
-		while (additional > 0 && std::next(it) < _mem.end())
-		{
-			data <<= 8;
-			data |= *++it;
-			--additional;
-		}
-
+		for (uint8_t byte: instruction.immediate)
+			data = (data << 8) | byte;
 		// pad the remaining number of additional octets with zeros
-		data <<= 8 * additional;
+		data <<= 8 * (additional - instruction.immediate.size());
 
-		_onInstruction(instr, data);
+		_onInstruction(instruction.instruction, data);
 	}
 }
 
+namespace
+{
+
+/// Appends the bytes as an upper case hex number without leading zeros and with "0x" prefix.
+void appendHexNumber(std::string& o_output, bytesConstRef _bigEndian)
+{
+	static char const digits[] = "0123456789ABCDEF";
+	o_output += "0x";
+	size_t const lengthBefore = o_output.size();
+	for (uint8_t byte: _bigEndian)
+		for (unsigned nibble: {unsigned(byte >> 4), unsigned(byte & 0xf)})
+			if (nibble != 0 || o_output.size() != lengthBefore)
+				o_output += digits[nibble];
+	if (o_output.size() == lengthBefore)
+		o_output += '0';
+}
+
+}
+
 std::string solidity::evmasm::disassemble(bytes const& _mem, langutil::EVMVersion _evmVersion, std::string const& _delimiter)
 {
-	std::stringstream ret;
-	eachInstruction(_mem, _evmVersion, [&](Instruction _instr, u256 const& _data) {
-		if (!isValidInstruction(_instr))
-			ret << "0x" << std::uppercase << std::hex << static_cast<int>(_instr) << _delimiter;
+	std::string output;
+	disassemble(bytesConstRef(&_mem), _evmVersion, output, _delimiter);
+	return output;
+}
+
+void solidity::evmasm::disassemble(
+	bytesConstRef _code,
+	langutil::EVMVersion _evmVersion,
+	std::string& o_output,
+	std::string const& _delimiter
+)
+{
+	for (DisassembledInstruction const& instruction: instructions(_code, _evmVersion))
+	{
+		uint8_t const opcode = static_cast<uint8_t>(instruction.instruction);
+		if (!isValidInstruction(instruction.instruction))
+			appendHexNumber(o_output, bytesConstRef(&opcode, 1));
 		else
 		{
-			InstructionInfo info = instructionInfo(_instr, _evmVersion);
-			ret << info.name;
+			InstructionInfo const& info = instructionInfo(instruction.instruction, _evmVersion);
+			o_output += info.name;
 			if (info.additional)
-				ret << " 0x" << std::uppercase << std::hex << _data;
-			ret << _delimiter;
+			{
+				o_output += ' ';
+				appendHexNumber(o_output, instruction.immediate);
+				// Missing immediate bytes at the end of the code count as trailing zeros.
+				if (std::any_of(instruction.immediate.begin(), instruction.immediate.end(), [](uint8_t _byte) { return _byte != 0; }))
+					o_output.append(2 * (static_cast<size_t>(info.additional) - instruction.immediate.size()), '0');
+			}
 		}
-	});
-	return ret.str();
+		o_output += _delimiter;
+	}
+}
+
+void solidity::evmasm::disassemble(
+	std::vector<bytesConstRef> const& _codes,
+	langutil::EVMVersion _evmVersion,
+	std::function<void(size_t, std::string_view)> const& _onDisassembly,
+	std::string const& _delimiter
+)
+{
+	std::string buffer;
+	for (size_t index = 0; index < _codes.size(); ++index)
+	{
+		buffer.clear();
+		disassemble(_codes[index], _evmVersion, buffer, _delimiter);
+		_onDisassembly(index, buffer);
+	}
 }
@@ -23,16 +23,95 @@
 
 #include <libevmasm/Instruction.h>
 
+#include <cstddef>
 #include <functional>
+#include <iterator>
 #include <string>
+#include <string_view>
+#include <vector>
 
 namespace solidity::evmasm
 {
 
+/// An instruction in EVM code together with its immediate data.
+struct DisassembledInstruction
+{
+	/// Position of the opcode in the code.
+	size_t offset = 0;
+	Instruction instruction = Instruction::STOP;
+	/// The immediate data following the opcode. Shorter than required by the instruction
+	/// if the code ends prematurely.
+	bytesConstRef immediate;
+};
+
+/**
+ * Forward iterator over the instructions of EVM code. Does not allocate and does not copy
+ * the code, which has to outlive the iterator.
+ */
+class InstructionIterator
+{
+public:
+	using iterator_category = std::forward_iterator_tag;
+	using value_type = DisassembledInstruction;
+	using difference_type = std::ptrdiff_t;
+	using pointer = DisassembledInstruction const*;
+	using reference = DisassembledInstruction const&;
+
+	/// Creates an iterator pointing at the instruction at @a _offset, which has to be
+	/// the start of an instruction or the end of @a _code.
+	InstructionIterator(bytesConstRef _code, langutil::EVMVersion _evmVersion, size_t _offset);
+
+	reference operator*() const { return m_current; }
+	pointer operator->() const { return &m_current; }
+	InstructionIterator& operator++();
+	InstructionIterator operator++(int) { InstructionIterator copy = *this; ++*this; return copy; }
+	bool operator==(InstructionIterator const& _other) const { return m_current.offset == _other.m_current.offset; }
+	bool operator!=(InstructionIterator const& _other) const { return !(*this == _other); }
+
+private:
+	void decode();
+
+	bytesConstRef m_code;
+	langutil::EVMVersion m_evmVersion;
+	DisassembledInstruction m_current;
+};
+
+/// Range of the instructions of EVM code for use in range-based for loops.
+class InstructionRange
+{
+public:
+	InstructionRange(bytesConstRef _code, langutil::EVMVersion _evmVersion): m_code(_code), m_evmVersion(_evmVersion) {}
+	InstructionIterator begin() const { return {m_code, m_evmVersion, 0}; }
+	InstructionIterator end() const { return {m_code, m_evmVersion, m_code.size()}; }
+
+private:
+	bytesConstRef m_code;
+	langutil::EVMVersion m_evmVersion;
+};
+
+/// @returns the instructions of @a _code, which has to outlive the result.
+inline InstructionRange instructions(bytesConstRef _code, langutil::EVMVersion _evmVersion)
+{
+	return {_code, _evmVersion};
+}
+
 /// Iterate through EVM code and call a function on each instruction.
 void eachInstruction(bytes const& _mem, langutil::EVMVersion _evmVersion, std::function<void(Instruction, u256 const&)> const& _onInstruction);
 
 /// Convert from EVM code to simple EVM assembly language.
 std::string disassemble(bytes const& _mem, langutil::EVMVersion _evmVersion, std::string const& _delimiter = " ");
 
+/// Appends the simple EVM assembly language for @a _code to @a o_output.
+void disassemble(bytesConstRef _code, langutil::EVMVersion _evmVersion, std::string& o_output, std::string const& _delimiter = " ");
+
+/// Disassembles each of @a _codes and calls @a _onDisassembly with its index and disassembly.
+/// All codes are disassembled into the same buffer, so the view passed to @a _onDisassembly
+/// is only valid during the call.
+void disassemble(
+	std::vector<bytesConstRef> const& _codes,
+	langutil::EVMVersion _evmVersion,
+	std::function<void(size_t, std::string_view)> const& _onDisassembly,
+	std::string const& _delimiter = " "
+);
+
 }
@@ -30,6 +30,8 @@
 
 #include <boost/container_hash/hash.hpp>
 
+#include <algorithm>
+#include <cstdint>
 #include <functional>
 #include <limits>
 #include <tuple>
@@ -92,26 +94,25 @@ ExpressionClasses::Id ExpressionClasses::find(
 	if (SemanticInformation::isCommutativeOperation(_item))
 		sort(exp.arguments.begin(), exp.arguments.end());
 
+	size_t const hash = Expression::ExpressionHash{}(exp);
 	if (SemanticInformation::isDeterministic(_item))
-	{
-		auto it = m_expressions.find(exp);
-		if (it != m_expressions.end())
-			return it->id;
-	}
+		if (Expression const* existing = findExpression(exp, hash))
+			return existing->id;
 
 	if (_copyItem)
 		exp.item = storeItem(_item);
 
-	ExpressionClasses::Id id = tryToSimplify(exp);
-	if (id < m_representatives.size())
-		exp.id = id;
+	Id const simplified = tryToSimplify(exp);
+	if (simplified < m_representatives.size())
+		exp.id = simplified;
 	else
 	{
 		exp.id = static_cast<Id>(m_representatives.size());
 		m_representatives.push_back(exp);
 	}
-	m_expressions.insert(exp);
-	return exp.id;
+	Id const id = exp.id;
+	insertExpression(std::move(exp), hash);
+	return id;
 }
 
 void ExpressionClasses::forceEqual(
@@ -132,7 +133,8 @@ void ExpressionClasses::forceEqual(
 	if (_copyItem)
 		exp.item = storeItem(_item);
 
-	m_expressions.insert(exp);
+	size_t const hash = Expression::ExpressionHash{}(exp);
+	insertExpression(std::move(exp), hash);
 }
 
 ExpressionClasses::Id ExpressionClasses::newClass(langutil::DebugData::ConstPtr _debugData)
@@ -141,8 +143,9 @@ ExpressionClasses::Id ExpressionClasses::newClass(langutil::DebugData::ConstPtr
 	exp.id = static_cast<Id>(m_representatives.size());
 	exp.item = storeItem(AssemblyItem(UndefinedItem, (u256(1) << 255) + exp.id, std::move(_debugData)));
 	m_representatives.push_back(exp);
-	m_expressions.insert(exp);
-	return exp.id;
+	size_t const hash = Expression::ExpressionHash{}(exp);
+	insertExpression(std::move(exp), hash);
+	return m_representatives.back().id;
 }
 
 bool ExpressionClasses::knownToBeDifferent(ExpressionClasses::Id _a, ExpressionClasses::Id _b)
@@ -171,7 +174,7 @@ bool ExpressionClasses::knownNonZero(Id _c)
 
 u256 const* ExpressionClasses::knownConstant(Id _c)
 {
-	std::map<unsigned, Expression const*> matchGroups;
+	MatchGroups<Expression> matchGroups;
 	Pattern constant(Push);
 	constant.setMatchGroup(1, matchGroups);
 	if (!constant.matches(representative(_c), *this))
@@ -202,9 +205,57 @@ std::string ExpressionClasses::fullDAGToString(ExpressionClasses::Id _id) const
 	return str.str();
 }
 
+ExpressionClasses::Expression const* ExpressionClasses::findExpression(Expression const& _expression, size_t _hash) const
+{
+	if (m_expressionTable.empty())
+		return nullptr;
+	size_t const mask = m_expressionTable.size() - 1;
+	for (size_t slot = initialSlot(_hash); m_expressionTable[slot] != 0; slot = (slot + 1) & mask)
+	{
+		size_t const index = m_expressionTable[slot] - 1;
+		if (m_expressionHashes[index] == _hash && m_expressions[index] == _expression)
+			return &m_expressions[index];
+	}
+	return nullptr;
+}
+
+void ExpressionClasses::insertExpression(Expression _expression, size_t _hash)
+{
+	if (findExpression(_expression, _hash))
+		return;
+
+	assertThrow(m_expressions.size() < std::numeric_limits<unsigned>::max(), OptimizerException, "");
+	m_expressions.emplace_back(std::move(_expression));
+	m_expressionHashes.emplace_back(_hash);
+
+	// Keep the load factor at most one half, so that the probe sequences stay short.
+	size_t first = m_expressions.size() - 1;
+	if (2 * m_expressions.size() > m_expressionTable.size())
+	{
+		m_expressionTableBits = std::max(4u, m_expressionTableBits + 1);
+		m_expressionTable.assign(size_t(1) << m_expressionTableBits, 0);
+		first = 0;
+	}
+	size_t const mask = m_expressionTable.size() - 1;
+	for (size_t index = first; index < m_expressions.size(); ++index)
+	{
+		size_t slot = initialSlot(m_expressionHashes[index]);
+		while (m_expressionTable[slot] != 0)
+			slot = (slot + 1) & mask;
+		m_expressionTable[slot] = static_cast<unsigned>(index + 1);
+	}
+}
+
+size_t ExpressionClasses::initialSlot(size_t _hash) const
+{
+	// Fibonacci hashing spreads hashes that only differ in their high bits over the table.
+	return static_cast<size_t>((uint64_t(_hash) * 0x9E3779B97F4A7C15ull) >> (64 - m_expressionTableBits));
+}
+
 ExpressionClasses::Id ExpressionClasses::tryToSimplify(Expression const& _expr)
 {
-	static Rules rules;
+	// The rules keep track of the current match state, so each thread needs its own copy.
+	static thread_local Rules rules;
 	assertThrow(rules.isInitialized(), OptimizerException, "Rule list not properly initialized.");
 
 	if (
@@ -29,7 +29,6 @@
 #include <libsolutil/Common.h>
 
 #include <memory>
-#include <unordered_set>
 #include <vector>
 
 namespace solidity::langutil
@@ -125,10 +124,25 @@ private:
 
 	std::vector<std::pair<Pattern, std::function<Pattern()>>> createRules() const;
 
+	/// @returns the stored expression equal to @a _expression, which has the hash @a _hash,
+	/// or nullptr if there is none.
+	Expression const* findExpression(Expression const& _expression, size_t _hash) const;
+	/// Stores @a _expression, which has the hash @a _hash, unless an equal expression is already stored.
+	void insertExpression(Expression _expression, size_t _hash);
+	/// @returns the first slot in m_expressionTable to probe for an expression with hash @a _hash.
+	size_t initialSlot(size_t _hash) const;
+
 	/// Expression equivalence class representatives - we only store one item of an equivalence.
 	std::vector<Expression> m_representatives;
-	/// All expression ever encountered.
-	std::unordered_set<Expression, Expression::ExpressionHash> m_expressions;
+	/// All expression ever encountered, each stored once.
+	std::vector<Expression> m_expressions;
+	/// The hashes of the elements of m_expressions.
+	std::vector<size_t> m_expressionHashes;
+	/// Open addressing hash table with linear probing over m_expressions. A slot contains
+	/// the index of an expression plus one or zero if it is empty. The size is a power of two.
+	std::vector<unsigned> m_expressionTable;
+	/// Binary logarithm of the size of m_expressionTable.
+	unsigned m_expressionTableBits = 0;
 	std::vector<std::shared_ptr<AssemblyItem>> m_spareAssemblyItems;
 };
 
@@ -62,6 +62,11 @@ GasMeter::GasConsumption GasMeter::estimateMax(AssemblyItem const& _item, bool _
 	case Tag:
 		gas = runGas(Instruction::JUMPDEST, m_evmVersion);
 		break;
+	case DupN:
+	case SwapN:
+		// DUPN and SWAPN are priced like all other DUP and SWAP instructions.
+		gas = runGas(Instruction::SWAP1, m_evmVersion);
+		break;
 	case Operation:
 	{
 		ExpressionClasses& classes = m_state->expressionClasses();
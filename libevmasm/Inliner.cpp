@@ -65,6 +65,25 @@ uint64_t codeSize(RangeType const& _itemRange)
 		[](auto const& _item) { return _item.bytesRequired(2, Precision::Approximate); }
 	), 0u);
 }
+AssemblyItems const& uninlinedCallSitePattern()
+{
+	static AssemblyItems const pattern = {
+		AssemblyItem{PushTag},
+		AssemblyItem{PushTag},
+		AssemblyItem{Instruction::JUMP},
+		AssemblyItem{Tag}
+	};
+	return pattern;
+}
+AssemblyItems const& uninlinedFunctionPattern()
+{
+	static AssemblyItems const pattern = {
+		AssemblyItem{Tag},
+		// Actual function body. Handled separately.
+		AssemblyItem{Instruction::JUMP}
+	};
+	return pattern;
+}
 /// @returns the tag id, if @a _item is a PushTag or Tag into the current subassembly, std::nullopt otherwise.
 std::optional<size_t> getLocalTag(AssemblyItem const& _item)
 {
@@ -100,7 +119,7 @@ bool Inliner::isInlineCandidate(size_t _tag, ranges::span<AssemblyItem const> _i
 
 std::map<size_t, Inliner::InlinableBlock> Inliner::determineInlinableBlocks(AssemblyItems const& _items) const
 {
-	std::map<size_t, ranges::span<AssemblyItem const>> inlinableBlockItems;
+	std::map<size_t, InlinableBlock> blocks;
 	std::map<size_t, uint64_t> numPushTags;
 	std::optional<size_t> lastTag;
 	for (auto&& [index, item]: _items | ranges::views::enumerate)
@@ -117,7 +136,14 @@ std::map<size_t, Inliner::InlinableBlock> Inliner::determineInlinableBlocks(Asse
 			ranges::span<AssemblyItem const> block = _items | ranges::views::slice(*lastTag + 1, index + 1);
 			if (std::optional<size_t> tag = getLocalTag(_items[*lastTag]))
 				if (isInlineCandidate(*tag, block))
-					inlinableBlockItems[*tag] = block;
+					// The sizes are needed for every call site, so they are computed right away.
+					blocks[*tag] = InlinableBlock{
+						block,
+						0,
+						codeSize(block),
+						codeSize(ranges::views::drop_last(block, 1)),
+						std::nullopt
+					};
 			lastTag.reset();
 		}
 
@@ -129,54 +155,40 @@ std::map<size_t, Inliner::InlinableBlock> Inliner::determineInlinableBlocks(Asse
 	}
 
 	// Store the number of PushTags alongside the assembly items and discard tags that are never pushed.
-	std::map<size_t, InlinableBlock> result;
-	for (auto&& [tag, items]: inlinableBlockItems)
-		if (uint64_t const* numPushes = util::valueOrNullptr(numPushTags, tag))
-			result.emplace(tag, InlinableBlock{items, *numPushes});
-	return result;
+	for (auto it = blocks.begin(); it != blocks.end();)
+		if (uint64_t const* numPushes = util::valueOrNullptr(numPushTags, it->first))
+		{
+			it->second.pushTagCount = *numPushes;
+			++it;
+		}
+		else
+			it = blocks.erase(it);
+	return blocks;
 }
 
-bool Inliner::shouldInlineFullFunctionBody(size_t _tag, ranges::span<AssemblyItem const> _block, uint64_t _pushTagCount) const
+bool Inliner::shouldInlineFullFunctionBody(size_t _tag, uint64_t _functionBodySize, uint64_t _pushTagCount) const
 {
-	// Accumulate size of the inline candidate block in bytes (without the return jump).
-	uint64_t functionBodySize = codeSize(ranges::views::drop_last(_block, 1));
-
 	// Use the number of push tags as approximation of the average number of calls to the function per run.
 	uint64_t numberOfCalls = _pushTagCount;
 	// Also use the number of push tags as approximation of the number of call sites to the function.
 	uint64_t numberOfCallSites = _pushTagCount;
 
-	static AssemblyItems const uninlinedCallSitePattern = {
-		AssemblyItem{PushTag},
-		AssemblyItem{PushTag},
-		AssemblyItem{Instruction::JUMP},
-		AssemblyItem{Tag}
-	};
-	static AssemblyItems const uninlinedFunctionPattern = {
-		AssemblyItem{Tag},
-		// Actual function body of size functionBodySize. Handled separately below.
-		AssemblyItem{Instruction::JUMP}
-	};
-
 	// Both the call site and jump site pattern is executed for each call.
 	// Since the function body has to be executed equally often both with and without inlining,
 	// it can be ignored.
-	bigint uninlinedExecutionCost = numberOfCalls * (
-		executionCost(uninlinedCallSitePattern, m_evmVersion) +
-		executionCost(uninlinedFunctionPattern, m_evmVersion)
-	);
+	bigint uninlinedExecutionCost = numberOfCalls * m_uninlinedCallExecutionCost;
 	// Each call site deposits the call site pattern, whereas the jump site pattern and the function itself are deposited once.
 	bigint uninlinedDepositCost = GasMeter::dataGas(
-		numberOfCallSites * codeSize(uninlinedCallSitePattern) +
-		codeSize(uninlinedFunctionPattern) +
-		functionBodySize,
+		numberOfCallSites * codeSize(uninlinedCallSitePattern()) +
+		codeSize(uninlinedFunctionPattern()) +
+		_functionBodySize,
 		m_isCreation,
 		m_evmVersion
 	);
 	// When inlining the execution cost beyond the actual function execution is zero,
 	// but for each call site a copy of the function is deposited.
 	bigint inlinedDepositCost = GasMeter::dataGas(
-		numberOfCallSites * functionBodySize,
+		numberOfCallSites * _functionBodySize,
 		m_isCreation,
 		m_evmVersion
 	);
@@ -185,7 +197,7 @@ bool Inliner::shouldInlineFullFunctionBody(size_t _tag, ranges::span<AssemblyIte
 	// the heuristics is optimistic.
 	if (m_tagsReferencedFromOutside.count(_tag))
 		inlinedDepositCost += GasMeter::dataGas(
-			codeSize(uninlinedFunctionPattern) + functionBodySize,
+			codeSize(uninlinedFunctionPattern()) + _functionBodySize,
 			m_isCreation,
 			m_evmVersion
 		);
@@ -198,7 +210,7 @@ bool Inliner::shouldInlineFullFunctionBody(size_t _tag, ranges::span<AssemblyIte
 	return false;
 }
 
-std::optional<AssemblyItem> Inliner::shouldInline(size_t _tag, AssemblyItem const& _jump, InlinableBlock const& _block) const
+std::optional<AssemblyItem> Inliner::shouldInline(size_t _tag, AssemblyItem const& _jump, InlinableBlock& _block) const
 {
 	assertThrow(_jump == Instruction::JUMP, OptimizerException, "");
 	AssemblyItem blockExit = _block.items.back();
@@ -206,12 +218,19 @@ std::optional<AssemblyItem> Inliner::shouldInline(size_t _tag, AssemblyItem cons
 	if (
 		_jump.getJumpType() == AssemblyItem::JumpType::IntoFunction &&
 		blockExit == Instruction::JUMP &&
-		blockExit.getJumpType() == AssemblyItem::JumpType::OutOfFunction &&
-		shouldInlineFullFunctionBody(_tag, _block.items, _block.pushTagCount)
+		blockExit.getJumpType() == AssemblyItem::JumpType::OutOfFunction
 	)
 	{
-		blockExit.setJumpType(AssemblyItem::JumpType::Ordinary);
-		return blockExit;
+		if (!_block.fullFunctionBodyDecision || _block.fullFunctionBodyDecision->first != _block.pushTagCount)
+			_block.fullFunctionBodyDecision = std::make_pair(
+				_block.pushTagCount,
+				shouldInlineFullFunctionBody(_tag, _block.bodySize, _block.pushTagCount)
+			);
+		if (_block.fullFunctionBodyDecision->second)
+		{
+			blockExit.setJumpType(AssemblyItem::JumpType::Ordinary);
+			return blockExit;
+		}
 	}
 
 	// Inline small blocks, if the jump to it is ordinary or the blockExit is a terminating instruction.
@@ -225,7 +244,7 @@ std::optional<AssemblyItem> Inliner::shouldInline(size_t _tag, AssemblyItem cons
 			AssemblyItem{Instruction::JUMP},
 		};
 		if (
-			GasMeter::dataGas(codeSize(_block.items), m_isCreation, m_evmVersion) <=
+			GasMeter::dataGas(_block.size, m_isCreation, m_evmVersion) <=
 			GasMeter::dataGas(codeSize(jumpPattern), m_isCreation, m_evmVersion)
 		)
 			return blockExit;
@@ -242,6 +261,10 @@ void Inliner::optimise()
 	if (inlinableBlocks.empty())
 		return;
 
+	m_uninlinedCallExecutionCost =
+		executionCost(uninlinedCallSitePattern(), m_evmVersion) +
+		executionCost(uninlinedFunctionPattern(), m_evmVersion);
+
 	AssemblyItems newItems;
 	for (auto it = m_items.begin(); it != m_items.end(); ++it)
 	{
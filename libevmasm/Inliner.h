@@ -28,6 +28,7 @@
 
 #include <range/v3/view/span.hpp>
 #include <map>
+#include <optional>
 #include <set>
 #include <vector>
 
@@ -60,14 +61,21 @@ private:
 	{
 		ranges::span<AssemblyItem const> items;
 		uint64_t pushTagCount = 0;
+		/// Code size of the items, computed once when the block is determined.
+		uint64_t size = 0;
+		/// Code size of the items without the exit item.
+		uint64_t bodySize = 0;
+		/// Push tag count for which shouldInlineFullFunctionBody was last evaluated and its result.
+		/// The push tag count only changes when the block is inlined somewhere or duplicated by that.
+		std::optional<std::pair<uint64_t, bool>> fullFunctionBodyDecision;
 	};
 
 	/// @returns the exit item for the block to be inlined, if a particular jump to it should be inlined, otherwise nullopt.
-	std::optional<AssemblyItem> shouldInline(size_t _tag, AssemblyItem const& _jump, InlinableBlock const& _block) const;
-	/// @returns true, if the full function at tag @a _tag with body @a _block that is referenced @a _pushTagCount times
-	/// should be inlined, false otherwise. @a _block should start at the first instruction after the function entry tag
-	/// up to and including the return jump.
-	bool shouldInlineFullFunctionBody(size_t _tag, ranges::span<AssemblyItem const> _block, uint64_t _pushTagCount) const;
+	std::optional<AssemblyItem> shouldInline(size_t _tag, AssemblyItem const& _jump, InlinableBlock& _block) const;
+	/// @returns true, if the full function at tag @a _tag with a body of @a _functionBodySize bytes that is referenced
+	/// @a _pushTagCount times should be inlined, false otherwise. The body starts at the first instruction after the
+	/// function entry tag and does not include the return jump.
+	bool shouldInlineFullFunctionBody(size_t _tag, uint64_t _functionBodySize, uint64_t _pushTagCount) const;
 	/// @returns true, if the @a _items at @a _tag are a potential candidate for inlining.
 	bool isInlineCandidate(size_t _tag, ranges::span<AssemblyItem const> _items) const;
 	/// @returns a map from tags that can potentially be inlined to the inlinable item range behind that tag and the
@@ -79,6 +87,9 @@ private:
 	size_t const m_runs = Assembly::OptimiserSettings{}.expectedExecutionsPerDeployment;
 	bool const m_isCreation = false;
 	langutil::EVMVersion const m_evmVersion;
+	/// Execution cost of the call site and function patterns of an uninlined call.
+	/// Only depends on the EVM version and is computed once in optimise().
+	u256 m_uninlinedCallExecutionCost = 0;
 };
 
 }
@@ -22,6 +22,8 @@
 
 #include <libevmasm/Instruction.h>
 
+#include <array>
+
 using namespace solidity;
 using namespace solidity::util;
 using namespace solidity::evmasm;
@@ -322,6 +324,9 @@ static std::map<Instruction, InstructionInfo> const c_instructionInfo =
 	{Instruction::LOG2,           {"LOG2",            0,  4,   0,  true,       Tier::Special}},
 	{Instruction::LOG3,           {"LOG3",            0,  5,   0,  true,       Tier::Special}},
 	{Instruction::LOG4,           {"LOG4",            0,  6,   0,  true,       Tier::Special}},
+	// The stack depth reached by DUPN and SWAPN is given by their immediate, only the net effect is listed.
+	{Instruction::DUPN,           {"DUPN",            1,  0,   1,  false,      Tier::VeryLow}},
+	{Instruction::SWAPN,          {"SWAPN",           1,  0,   0,  false,      Tier::VeryLow}},
 	{Instruction::CREATE,         {"CREATE",          0,  3,   1,  true,       Tier::Special}},
 	{Instruction::CALL,           {"CALL",            0,  7,   1,  true,       Tier::Special}},
 	{Instruction::CALLCODE,       {"CALLCODE",        0,  7,   1,  true,       Tier::Special}},
@@ -334,21 +339,43 @@ static std::map<Instruction, InstructionInfo> const c_instructionInfo =
 	{Instruction::SELFDESTRUCT,   {"SELFDESTRUCT",    0,  1,   0,  true,       Tier::Special}}
 };
 
-InstructionInfo solidity::evmasm::instructionInfo(Instruction _inst, langutil::EVMVersion _evmVersion)
+namespace
 {
-	try
-	{
-		if (_inst == Instruction::PREVRANDAO && _evmVersion < langutil::EVMVersion::paris())
-			return InstructionInfo({ "DIFFICULTY", 0, 0, 1, false, Tier::Base });
-		return c_instructionInfo.at(_inst);
-	}
-	catch (...)
+
+/// Information on all 256 opcodes, indexed by opcode, so that looking it up neither searches
+/// nor allocates. Unassigned opcodes have the tier Tier::Invalid.
+struct InstructionInfoTable
+{
+	InstructionInfoTable()
 	{
-		return InstructionInfo({"<INVALID_INSTRUCTION: " + std::to_string(static_cast<unsigned>(_inst)) + ">", 0, 0, 0, false, Tier::Invalid});
+		for (size_t opcode = 0; opcode < entries.size(); ++opcode)
+			entries[opcode] = {"<INVALID_INSTRUCTION: " + std::to_string(opcode) + ">", 0, 0, 0, false, Tier::Invalid};
+		for (auto const& [instruction, info]: c_instructionInfo)
+			entries[static_cast<uint8_t>(instruction)] = info;
 	}
+
+	std::array<InstructionInfo, 256> entries;
+	/// Name of PREVRANDAO before Paris.
+	InstructionInfo difficulty{"DIFFICULTY", 0, 0, 1, false, Tier::Base};
+};
+
+InstructionInfoTable const& instructionInfoTable()
+{
+	static InstructionInfoTable const table;
+	return table;
+}
+
+}
+
+InstructionInfo const& solidity::evmasm::instructionInfo(Instruction _inst, langutil::EVMVersion _evmVersion)
+{
+	InstructionInfoTable const& table = instructionInfoTable();
+	if (_inst == Instruction::PREVRANDAO && _evmVersion < langutil::EVMVersion::paris())
+		return table.difficulty;
+	return table.entries[static_cast<uint8_t>(_inst)];
 }
 
 bool solidity::evmasm::isValidInstruction(Instruction _inst)
 {
-	return !!c_instructionInfo.count(_inst);
+	return instructionInfoTable().entries[static_cast<uint8_t>(_inst)].gasPriceTier != Tier::Invalid;
 }
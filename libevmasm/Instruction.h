@@ -182,6 +182,9 @@ enum class Instruction: uint8_t
 	LOG3,                     ///< Makes a log entry; 3 topics.
 	LOG4,                     ///< Makes a log entry; 4 topics.
 
+	DUPN = 0xe6,              ///< copies the (n + 1)th highest item in the stack to the top of the stack, only valid in EOF code (EIP-663)
+	SWAPN,                    ///< swaps the highest and (n + 2)th highest value on the stack, only valid in EOF code (EIP-663)
+
 	CREATE = 0xf0,            ///< create a new account with associated code
 	CALL,                     ///< message-call into an account
 	CALLCODE,                 ///< message-call with another account's code only
@@ -317,7 +320,8 @@ struct InstructionInfo
 };
 
 /// Information on all the instructions.
-InstructionInfo instructionInfo(Instruction _inst, langutil::EVMVersion _evmVersion);
+/// @returns a reference to a table entry that is valid for the lifetime of the program.
+InstructionInfo const& instructionInfo(Instruction _inst, langutil::EVMVersion _evmVersion);
 
 /// check whether instructions exists.
 bool isValidInstruction(Instruction _inst);
@@ -24,6 +24,7 @@
 
 #include <libevmasm/AssemblyItem.h>
 
+#include <algorithm>
 #include <limits>
 
 using namespace solidity;
@@ -32,8 +33,18 @@ using namespace solidity::evmasm;
 
 bool JumpdestRemover::optimise(std::set<size_t> const& _tagsReferencedFromOutside)
 {
-	std::set<size_t> references{referencedTags(m_items, std::numeric_limits<size_t>::max())};
-	references.insert(_tagsReferencedFromOutside.begin(), _tagsReferencedFromOutside.end());
+	// A sorted vector instead of a set avoids allocating a node per reference
+	// each time the optimiser loop runs this step.
+	std::vector<size_t> references(_tagsReferencedFromOutside.begin(), _tagsReferencedFromOutside.end());
+	for (AssemblyItem const& item: m_items)
+		if (item.type() == PushTag)
+		{
+			auto [subId, tag] = item.splitForeignPushTag();
+			if (subId == std::numeric_limits<size_t>::max())
+				references.push_back(tag);
+		}
+	std::sort(references.begin(), references.end());
+	references.erase(std::unique(references.begin(), references.end()), references.end());
 
 	size_t initialSize = m_items.size();
 	/// Remove tags which are never referenced.
@@ -47,7 +58,7 @@ bool JumpdestRemover::optimise(std::set<size_t> const& _tagsReferencedFromOutsid
 			auto asmIdAndTag = _item.splitForeignPushTag();
 			assertThrow(asmIdAndTag.first == std::numeric_limits<size_t>::max(), OptimizerException, "Sub-assembly tag used as label.");
 			size_t tag = asmIdAndTag.second;
-			return !references.count(tag);
+			return !std::binary_search(references.begin(), references.end(), tag);
 		}
 	);
 	m_items.erase(pend, m_items.end());
@@ -66,3 +77,16 @@ std::set<size_t> JumpdestRemover::referencedTags(AssemblyItems const& _items, si
 		}
 	return ret;
 }
+
+std::vector<std::set<size_t>> JumpdestRemover::referencedTagsOfSubs(AssemblyItems const& _items, size_t _numSubs)
+{
+	std::vector<std::set<size_t>> ret(_numSubs);
+	for (auto const& item: _items)
+		if (item.type() == PushTag)
+		{
+			auto [subId, tag] = item.splitForeignPushTag();
+			if (subId < _numSubs)
+				ret[subId].insert(tag);
+		}
+	return ret;
+}
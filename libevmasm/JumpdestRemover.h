@@ -40,6 +40,9 @@ public:
 	/// @returns a set of all tags from the given sub-assembly that are referenced
 	/// from the given list of items.
 	static std::set<size_t> referencedTags(AssemblyItems const& _items, size_t _subId);
+	/// @returns for each of the first @a _numSubs sub-assemblies the set of its tags that are
+	/// referenced from the given list of items. Only iterates over the items once.
+	static std::vector<std::set<size_t>> referencedTagsOfSubs(AssemblyItems const& _items, size_t _numSubs);
 
 private:
 	AssemblyItems& m_items;
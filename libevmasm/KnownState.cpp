@@ -118,12 +118,22 @@ KnownState::StoreOperation KnownState::feedItem(AssemblyItem const& _item, bool
 				m_expressionClasses->newClass(_item.debugData())
 			);
 	}
+	else if (_item.type() == DupN)
+	{
+		setStackElement(
+			m_stackHeight + 1,
+			stackElement(m_stackHeight + 1 - static_cast<int>(_item.data()), _item.debugData())
+		);
+		++m_stackHeight;
+	}
+	else if (_item.type() == SwapN)
+		swapStackElements(m_stackHeight, m_stackHeight - static_cast<int>(_item.data()), _item.debugData());
 	else if (_item.type() != Operation)
 	{
 		assertThrow(_item.deposit() == 1, InvalidDeposit, "");
 		if (_item.pushedValue())
 			// only available after assembly stage, should not be used for optimisation
-			setStackElement(++m_stackHeight, m_expressionClasses->find(*_item.pushedValue()));
+			setStackElement(++m_stackHeight, m_expressionClasses->find(u256(*_item.pushedValue())));
 		else
 			setStackElement(++m_stackHeight, m_expressionClasses->find(_item, {}, _copyItem));
 	}
@@ -132,7 +142,7 @@ KnownState::StoreOperation KnownState::feedItem(AssemblyItem const& _item, bool
 		Instruction instruction = _item.instruction();
 		// The latest EVMVersion is used here, since the InstructionInfo is assumed to be
 		// the same across all EVM versions except for the instruction name.
-		InstructionInfo info = instructionInfo(instruction, EVMVersion());
+		InstructionInfo const& info = instructionInfo(instruction, EVMVersion());
 		if (SemanticInformation::isDupInstruction(_item))
 			setStackElement(
 				m_stackHeight + 1,
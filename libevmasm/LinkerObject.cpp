@@ -37,13 +37,17 @@ void LinkerObject::append(LinkerObject const& _other)
 
 void LinkerObject::link(std::map<std::string, h160> const& _libraryAddresses)
 {
-	std::map<size_t, std::string> remainingRefs;
-	for (auto const& linkRef: linkReferences)
-		if (h160 const* address = matchLibrary(linkRef.second, _libraryAddresses))
-			copy(address->data(), address->data() + 20, bytecode.begin() + std::vector<uint8_t>::difference_type(linkRef.first));
+	if (_libraryAddresses.empty())
+		return;
+	// Linked references are removed in place, all others (and their names) are left untouched.
+	for (auto it = linkReferences.begin(); it != linkReferences.end();)
+		if (h160 const* address = matchLibrary(it->second, _libraryAddresses))
+		{
+			copy(address->data(), address->data() + 20, bytecode.begin() + std::vector<uint8_t>::difference_type(it->first));
+			it = linkReferences.erase(it);
+		}
 		else
-			remainingRefs.insert(linkRef);
-	linkReferences.swap(remainingRefs);
+			++it;
 }
 
 std::string LinkerObject::toHex() const
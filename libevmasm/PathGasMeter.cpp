@@ -27,12 +27,15 @@
 using namespace solidity;
 using namespace solidity::evmasm;
 
-PathGasMeter::PathGasMeter(AssemblyItems const& _items, langutil::EVMVersion _evmVersion):
-	m_items(_items), m_evmVersion(_evmVersion)
+PathGasMeter::PathGasMeter(
+	AssemblyItems const& _items,
+	langutil::EVMVersion _evmVersion,
+	std::shared_ptr<TagPositions const> _tagPositions
+):
+	m_tagPositions(_tagPositions ? std::move(_tagPositions) : tagPositions(_items)),
+	m_items(_items),
+	m_evmVersion(_evmVersion)
 {
-	for (size_t i = 0; i < m_items.size(); ++i)
-		if (m_items[i].type() == Tag)
-			m_tagPositions[m_items[i].data()] = i;
 }
 
 GasMeter::GasConsumption PathGasMeter::estimateMax(
@@ -122,8 +125,8 @@ GasMeter::GasConsumption PathGasMeter::handleQueueItem()
 		{
 			auto newPath = std::make_unique<GasPath>();
 			newPath->index = m_items.size();
-			if (m_tagPositions.count(tag))
-				newPath->index = m_tagPositions.at(tag);
+			if (auto position = m_tagPositions->find(tag); position != m_tagPositions->end())
+				newPath->index = position->second;
 			newPath->gas = gas;
 			newPath->largestMemoryAccess = meter.largestMemoryAccess();
 			newPath->state = state->copy();
@@ -137,3 +140,12 @@ GasMeter::GasConsumption PathGasMeter::handleQueueItem()
 
 	return gas;
 }
+
+std::shared_ptr<PathGasMeter::TagPositions const> PathGasMeter::tagPositions(AssemblyItems const& _items)
+{
+	auto positions = std::make_shared<TagPositions>();
+	for (size_t i = 0; i < _items.size(); ++i)
+		if (_items[i].type() == Tag)
+			(*positions)[_items[i].data()] = i;
+	return positions;
+}
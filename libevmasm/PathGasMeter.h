@@ -26,6 +26,7 @@
 
 #include <liblangutil/EVMVersion.h>
 
+#include <map>
 #include <set>
 #include <vector>
 #include <memory>
@@ -52,7 +53,16 @@ struct GasPath
 class PathGasMeter
 {
 public:
-	explicit PathGasMeter(AssemblyItems const& _items, langutil::EVMVersion _evmVersion);
+	/// Map from tag to the position of the tag in the list of items.
+	using TagPositions = std::map<u256, size_t>;
+
+	/// @param _tagPositions the result of tagPositions(_items), which is computed if not given.
+	/// Can be used to share it between the meters for different starting points.
+	explicit PathGasMeter(
+		AssemblyItems const& _items,
+		langutil::EVMVersion _evmVersion,
+		std::shared_ptr<TagPositions const> _tagPositions = nullptr
+	);
 
 	GasMeter::GasConsumption estimateMax(size_t _startIndex, std::shared_ptr<KnownState> const& _state);
 
@@ -60,12 +70,16 @@ public:
 		AssemblyItems const& _items,
 		langutil::EVMVersion _evmVersion,
 		size_t _startIndex,
-		std::shared_ptr<KnownState> const& _state
+		std::shared_ptr<KnownState> const& _state,
+		std::shared_ptr<TagPositions const> _tagPositions = nullptr
 	)
 	{
-		return PathGasMeter(_items, _evmVersion).estimateMax(_startIndex, _state);
+		return PathGasMeter(_items, _evmVersion, std::move(_tagPositions)).estimateMax(_startIndex, _state);
 	}
 
+	/// @returns the positions of all tags in @a _items.
+	static std::shared_ptr<TagPositions const> tagPositions(AssemblyItems const& _items);
+
 private:
 	/// Adds a new path item to the queue, but only if we do not already have
 	/// a higher gas usage at that point.
@@ -78,7 +92,7 @@ private:
 	/// item per jumpdest, because of the behaviour of `queue` above.
 	std::map<size_t, std::unique_ptr<GasPath>> m_queue;
 	std::map<size_t, GasMeter::GasConsumption> m_highestGasUsagePerJumpdest;
-	std::map<u256, size_t> m_tagPositions;
+	std::shared_ptr<TagPositions const> m_tagPositions;
 	AssemblyItems const& m_items;
 	langutil::EVMVersion m_evmVersion;
 };
@@ -60,9 +60,14 @@ struct SimplePeepholeOptimizerMethod
 	{
 		return Method::applySimple(_in[Indices]..., _out);
 	}
+	/// @returns the number of items the method looks at.
+	static constexpr size_t lookahead()
+	{
+		return FunctionParameterCount<decltype(Method::applySimple)>::value - 1;
+	}
 	static bool apply(OptimiserState& _state)
 	{
-		static constexpr size_t WindowSize = FunctionParameterCount<decltype(Method::applySimple)>::value - 1;
+		static constexpr size_t WindowSize = lookahead();
 		if (
 			_state.i + WindowSize <= _state.items.size() &&
 			applyRule(_state.items.begin() + static_cast<ptrdiff_t>(_state.i), _state.out, std::make_index_sequence<WindowSize>{})
@@ -76,18 +81,6 @@ struct SimplePeepholeOptimizerMethod
 	}
 };
 
-struct Identity: SimplePeepholeOptimizerMethod<Identity>
-{
-	static bool applySimple(
-		AssemblyItem const& _item,
-		std::back_insert_iterator<AssemblyItems> _out
-	)
-	{
-		*_out = _item;
-		return true;
-	}
-};
-
 struct PushPop: SimplePeepholeOptimizerMethod<PushPop>
 {
 	static bool applySimple(
@@ -457,6 +450,8 @@ struct TruthyAnd: SimplePeepholeOptimizerMethod<TruthyAnd>
 /// Removes everything after a JUMP (or similar) until the next JUMPDEST.
 struct UnreachableCode
 {
+	/// If the method does not apply, this was decided by looking at the first two items.
+	static constexpr size_t lookahead() { return 2; }
 	static bool apply(OptimiserState& _state)
 	{
 		auto it = _state.items.begin() + static_cast<ptrdiff_t>(_state.i);
@@ -487,47 +482,116 @@ struct UnreachableCode
 	}
 };
 
-void applyMethods(OptimiserState&)
+/// A list of methods that are tried in order at each position.
+template <typename... Methods>
+struct MethodList
 {
-	assertThrow(false, OptimizerException, "Peephole optimizer failed to apply identity.");
-}
+	/// Upper bound on the number of items any of the methods looks at to decide that it does not apply.
+	static constexpr size_t lookahead = std::max({Methods::lookahead()...});
+	/// Applies the first method that matches at the current position, which consumes the
+	/// items it replaces and writes their replacement.
+	/// @returns false if no method applies, in which case the item at the current position is kept.
+	static bool apply(OptimiserState& _state) { return (Methods::apply(_state) || ...); }
+};
 
-template <typename Method, typename... OtherMethods>
-void applyMethods(OptimiserState& _state, Method, OtherMethods... _other)
+using PeepholeMethods = MethodList<
+	PushPop, OpPop, OpStop, OpReturnRevert, DoublePush, DoubleSwap, CommutativeSwap, SwapComparison,
+	DupSwap, IsZeroIsZeroJumpI, EqIsZeroJumpI, DoubleJump, JumpToNext, UnreachableCode,
+	TagConjunctions, TruthyAnd
+>;
+
+/// Replacement of the items [position, position + length) by the items
+/// [replacementBegin, replacementEnd) of a separate buffer.
+struct Rewrite
 {
-	if (!Method::apply(_state))
-		applyMethods(_state, _other...);
+	size_t position;
+	size_t length;
+	size_t replacementBegin;
+	size_t replacementEnd;
+};
+
+ptrdiff_t approximateBytesRequired(AssemblyItems::const_iterator _begin, AssemblyItems::const_iterator _end)
+{
+	// Avoid referencing immutables too early by using approx. counting in bytesRequired()
+	size_t size = 0;
+	for (auto it = _begin; it != _end; ++it)
+		size += it->bytesRequired(3, Precision::Approximate);
+	return static_cast<ptrdiff_t>(size);
 }
 
-size_t numberOfPops(AssemblyItems const& _items)
+ptrdiff_t numberOfPops(AssemblyItems::const_iterator _begin, AssemblyItems::const_iterator _end)
 {
-	return static_cast<size_t>(std::count(_items.begin(), _items.end(), Instruction::POP));
+	return std::count(_begin, _end, Instruction::POP);
 }
 
 }
 
 bool PeepholeOptimiser::optimise()
 {
-	// Avoid referencing immutables too early by using approx. counting in bytesRequired()
-	auto const approx = evmasm::Precision::Approximate;
-	OptimiserState state {m_items, 0, back_inserter(m_optimisedItems)};
-	while (state.i < m_items.size())
-		applyMethods(
-			state,
-			PushPop(), OpPop(), OpStop(), OpReturnRevert(), DoublePush(), DoubleSwap(), CommutativeSwap(), SwapComparison(),
-			DupSwap(), IsZeroIsZeroJumpI(), EqIsZeroJumpI(), DoubleJump(), JumpToNext(), UnreachableCode(),
-			TagConjunctions(), TruthyAnd(), Identity()
-		);
-	if (m_optimisedItems.size() < m_items.size() || (
-		m_optimisedItems.size() == m_items.size() && (
-			evmasm::bytesRequired(m_optimisedItems, 3, approx) < evmasm::bytesRequired(m_items, 3, approx) ||
-			numberOfPops(m_optimisedItems) > numberOfPops(m_items)
-		)
-	))
+	// Positions outside of the pending ranges were examined by the previous run without any
+	// method applying and neither they nor the items following them within the lookahead have
+	// changed since, so nothing applies there now either and only the pending ranges are visited.
+	AssemblyItems replacements;
+	std::vector<Rewrite> rewrites;
+	OptimiserState state{m_items, 0, back_inserter(replacements)};
+	for (auto const& [begin, end]: m_pendingRanges)
+		for (state.i = std::max(state.i, begin); state.i < std::min(end, m_items.size());)
+		{
+			size_t const position = state.i;
+			size_t const replacementBegin = replacements.size();
+			if (PeepholeMethods::apply(state))
+				rewrites.push_back({position, state.i - position, replacementBegin, replacements.size()});
+			else
+				state.i++;
+		}
+
+	// Only accept the changes if the code gets smaller, cheaper or has more POPs
+	// (which are likely to be removed by the next run).
+	ptrdiff_t sizeDelta = 0;
+	ptrdiff_t bytesDelta = 0;
+	ptrdiff_t popsDelta = 0;
+	for (Rewrite const& rewrite: rewrites)
 	{
-		m_items = std::move(m_optimisedItems);
-		return true;
+		auto const oldBegin = m_items.cbegin() + static_cast<ptrdiff_t>(rewrite.position);
+		auto const oldEnd = oldBegin + static_cast<ptrdiff_t>(rewrite.length);
+		auto const newBegin = replacements.cbegin() + static_cast<ptrdiff_t>(rewrite.replacementBegin);
+		auto const newEnd = replacements.cbegin() + static_cast<ptrdiff_t>(rewrite.replacementEnd);
+		sizeDelta += (newEnd - newBegin) - (oldEnd - oldBegin);
+		bytesDelta += approximateBytesRequired(newBegin, newEnd) - approximateBytesRequired(oldBegin, oldEnd);
+		popsDelta += numberOfPops(newBegin, newEnd) - numberOfPops(oldBegin, oldEnd);
 	}
-	else
+	if (!(sizeDelta < 0 || (sizeDelta == 0 && (bytesDelta < 0 || popsDelta > 0))))
 		return false;
+
+	// Move the unchanged items and the replacements into place and record the positions where
+	// a method might apply in the next run: the replacements and the items just before them.
+	AssemblyItems optimisedItems;
+	optimisedItems.reserve(static_cast<size_t>(static_cast<ptrdiff_t>(m_items.size()) + sizeDelta));
+	std::vector<std::pair<size_t, size_t>> pendingRanges;
+	size_t consumed = 0;
+	for (Rewrite const& rewrite: rewrites)
+	{
+		std::move(
+			m_items.begin() + static_cast<ptrdiff_t>(consumed),
+			m_items.begin() + static_cast<ptrdiff_t>(rewrite.position),
+			back_inserter(optimisedItems)
+		);
+		size_t const begin = optimisedItems.size() - std::min(optimisedItems.size(), PeepholeMethods::lookahead - 1);
+		std::move(
+			replacements.begin() + static_cast<ptrdiff_t>(rewrite.replacementBegin),
+			replacements.begin() + static_cast<ptrdiff_t>(rewrite.replacementEnd),
+			back_inserter(optimisedItems)
+		);
+		size_t const end = optimisedItems.size();
+		if (!pendingRanges.empty() && begin <= pendingRanges.back().second)
+			pendingRanges.back().second = std::max(pendingRanges.back().second, end);
+		else if (begin < end)
+			pendingRanges.emplace_back(begin, end);
+		consumed = rewrite.position + rewrite.length;
+	}
+	std::move(m_items.begin() + static_cast<ptrdiff_t>(consumed), m_items.end(), back_inserter(optimisedItems));
+
+	m_items = std::move(optimisedItems);
+	m_pendingRanges = std::move(pendingRanges);
+	return true;
 }
@@ -24,6 +24,7 @@
 #include <vector>
 #include <cstddef>
 #include <iterator>
+#include <utility>
 
 namespace solidity::evmasm
 {
@@ -41,14 +42,18 @@ public:
 class PeepholeOptimiser
 {
 public:
-	explicit PeepholeOptimiser(AssemblyItems& _items): m_items(_items) {}
+	explicit PeepholeOptimiser(AssemblyItems& _items): m_items(_items), m_pendingRanges{{0, _items.size()}} {}
 	virtual ~PeepholeOptimiser() = default;
 
+	/// Runs the optimisation once over the items. Repeated calls only re-examine the
+	/// items close to the changes of the previous call.
+	/// @returns true if the items were changed.
 	bool optimise();
 
 private:
 	AssemblyItems& m_items;
-	AssemblyItems m_optimisedItems;
+	/// Ranges of positions in m_items that have to be examined by the next call to optimise().
+	std::vector<std::pair<size_t, size_t>> m_pendingRanges;
 };
 
 }
@@ -89,7 +89,7 @@ std::vector<SimplificationRule<Pattern>> simplificationRuleListPart1(
 		{Builtins::SDIV(A, B), [=]{ return B.d() == 0 ? 0 : s2u(divWorkaround(u2s(A.d()), u2s(B.d()))); }},
 		{Builtins::MOD(A, B), [=]{ return B.d() == 0 ? 0 : modWorkaround(A.d(), B.d()); }},
 		{Builtins::SMOD(A, B), [=]{ return B.d() == 0 ? 0 : s2u(modWorkaround(u2s(A.d()), u2s(B.d()))); }},
-		{Builtins::EXP(A, B), [=]{ return Word(boost::multiprecision::powm(bigint(A.d()), bigint(B.d()), bigint(1) << Pattern::WordSize)); }},
+		{Builtins::EXP(A, B), [=]{ return exp256(A.d(), B.d()); }},
 		{Builtins::NOT(A), [=]{ return ~A.d(); }},
 		{Builtins::LT(A, B), [=]() -> Word { return A.d() < B.d() ? 1 : 0; }},
 		{Builtins::GT(A, B), [=]() -> Word { return A.d() > B.d() ? 1 : 0; }},
@@ -106,8 +106,8 @@ std::vector<SimplificationRule<Pattern>> simplificationRuleListPart1(
 				0 :
 				(B.d() >> unsigned(8 * (Pattern::WordSize / 8 - 1 - A.d()))) & 0xff;
 		}},
-		{Builtins::ADDMOD(A, B, C), [=]{ return C.d() == 0 ? 0 : Word((bigint(A.d()) + bigint(B.d())) % C.d()); }},
-		{Builtins::MULMOD(A, B, C), [=]{ return C.d() == 0 ? 0 : Word((bigint(A.d()) * bigint(B.d())) % C.d()); }},
+		{Builtins::ADDMOD(A, B, C), [=]{ return C.d() == 0 ? 0 : Word((u512(A.d()) + u512(B.d())) % C.d()); }},
+		{Builtins::MULMOD(A, B, C), [=]{ return C.d() == 0 ? 0 : Word((u512(A.d()) * u512(B.d())) % C.d()); }},
 		{Builtins::SIGNEXTEND(A, B), [=]() -> Word {
 			if (A.d() >= Pattern::WordSize / 8 - 1)
 				return B.d();
@@ -489,11 +489,11 @@ std::vector<SimplificationRule<Pattern>> simplificationRuleListPart7(
 		// SHL(B, SHL(A, X)) -> SHL(min(A+B, 256), X)
 		Builtins::SHL(B, Builtins::SHL(A, X)),
 		[=]() -> Pattern {
-			bigint sum = bigint(A.d()) + B.d();
-			if (sum >= Pattern::WordSize)
+			// Checks A + B >= WordSize without overflowing.
+			if (A.d() >= Pattern::WordSize || B.d() >= Pattern::WordSize - A.d())
 				return Builtins::AND(X, Word(0));
 			else
-				return Builtins::SHL(Word(sum), X);
+				return Builtins::SHL(Word(A.d() + B.d()), X);
 		}
 	});
 
@@ -502,11 +502,11 @@ std::vector<SimplificationRule<Pattern>> simplificationRuleListPart7(
 		// SHR(B, SHR(A, X)) -> SHR(min(A+B, 256), X)
 		Builtins::SHR(B, Builtins::SHR(A, X)),
 		[=]() -> Pattern {
-			bigint sum = bigint(A.d()) + B.d();
-			if (sum >= Pattern::WordSize)
+			// Checks A + B >= WordSize without overflowing.
+			if (A.d() >= Pattern::WordSize || B.d() >= Pattern::WordSize - A.d())
 				return Builtins::AND(X, Word(0));
 			else
-				return Builtins::SHR(Word(sum), X);
+				return Builtins::SHR(Word(A.d() + B.d()), X);
 		}
 	});
 
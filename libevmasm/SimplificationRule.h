@@ -23,7 +23,12 @@
 
 #include <libevmasm/Instruction.h>
 #include <libsolutil/CommonData.h>
+
+#include <array>
 #include <functional>
+#include <map>
+#include <utility>
+#include <vector>
 
 namespace solidity::evmasm
 {
@@ -51,26 +56,186 @@ struct SimplificationRule
 	std::function<bool()> feasible;
 };
 
+/**
+ * Expressions bound to the match groups of the patterns of a rule while it is matched.
+ * Rules only use a few match groups with small identifiers, so they are kept in a fixed
+ * table that is reset for every rule instead of a map that allocates a node for every
+ * group bound while matching.
+ */
+template <class Expression>
+class MatchGroups
+{
+public:
+	/// Largest identifier of a match group.
+	static constexpr unsigned maxGroup = 7;
+
+	/// @returns the expression bound to @a _group or nullptr if it is not bound yet.
+	Expression const* get(unsigned _group) const
+	{
+		assertThrow(0 < _group && _group <= maxGroup, OptimizerException, "Invalid match group.");
+		return m_expressions[_group];
+	}
+	void set(unsigned _group, Expression const* _expression)
+	{
+		assertThrow(0 < _group && _group <= maxGroup, OptimizerException, "Invalid match group.");
+		m_expressions[_group] = _expression;
+	}
+	void clear() { m_expressions.fill(nullptr); }
+
+private:
+	std::array<Expression const*, maxGroup + 1> m_expressions{};
+};
+
+/**
+ * Coarse description of an argument of a pattern or of an expression to be matched.
+ * It is used to discard rules that cannot match an expression before attempting the
+ * full match, which has to resolve variables and compare whole subexpressions.
+ */
+struct ArgumentShape
+{
+	enum class Kind: uint8_t
+	{
+		/// As a pattern: matches everything. As an expression: neither a constant nor an operation.
+		Any,
+		Constant,
+		Operation,
+		/// Only used for expressions: not matched by any pattern.
+		None
+	};
+
+	Kind kind = Kind::Any;
+	Instruction instruction = Instruction::STOP; ///< Only valid if kind is Operation.
+
+	/// @returns false if a pattern argument of this shape cannot match an expression
+	/// argument of shape @a _expression.
+	bool admits(ArgumentShape const& _expression) const
+	{
+		if (_expression.kind == Kind::None)
+			return false;
+		if (kind == Kind::Any)
+			return true;
+		return kind == _expression.kind && (kind != Kind::Operation || instruction == _expression.instruction);
+	}
+
+	bool operator<(ArgumentShape const& _other) const
+	{
+		return std::make_pair(kind, instruction) < std::make_pair(_other.kind, _other.instruction);
+	}
+};
+
+/**
+ * Rules indexed by their root instruction and, inside each instruction, by the shape
+ * of their first argument. A lookup only visits the rules whose arguments are compatible
+ * with the shapes of the arguments of the expression, in the order they were added.
+ *
+ * The pattern type has to provide ``arguments()``, ``instruction()`` and ``shape()``.
+ */
+template <class Pattern>
+class SimplificationRuleTable
+{
+public:
+	using Rule = SimplificationRule<Pattern>;
+
+	void add(Rule _rule)
+	{
+		Bucket& bucket = m_buckets[uint8_t(_rule.pattern.instruction())];
+		size_t const index = bucket.rules.size();
+
+		std::vector<ArgumentShape> shapes;
+		shapes.reserve(_rule.pattern.arguments().size());
+		for (Pattern const& argument: _rule.pattern.arguments())
+			shapes.emplace_back(argument.shape());
+		bucket.rules.emplace_back(std::move(_rule));
+		ArgumentShape const firstShape = shapes.empty() ? ArgumentShape{} : shapes.front();
+		bucket.argumentShapes.emplace_back(std::move(shapes));
+
+		if (firstShape.kind == ArgumentShape::Kind::Any)
+		{
+			bucket.unrestrictedRules.push_back(index);
+			for (auto& [shape, rules]: bucket.rulesByFirstArgument)
+				rules.push_back(index);
+		}
+		else
+			bucket.rulesByFirstArgument.try_emplace(firstShape, bucket.unrestrictedRules).first->second.push_back(index);
+	}
+
+	std::vector<Rule> const& rules(Instruction _instruction) const
+	{
+		return m_buckets[uint8_t(_instruction)].rules;
+	}
+
+	/// @returns the first rule for @a _instruction that is compatible with @a _argumentShapes
+	/// and for which @a _match returns true, or nullptr if there is none.
+	template <class Match>
+	Rule const* findFirst(
+		Instruction _instruction,
+		std::vector<ArgumentShape> const& _argumentShapes,
+		Match const& _match
+	) const
+	{
+		Bucket const& bucket = m_buckets[uint8_t(_instruction)];
+		std::vector<size_t> const* candidates = &bucket.unrestrictedRules;
+		if (!_argumentShapes.empty())
+			if (auto it = bucket.rulesByFirstArgument.find(_argumentShapes.front()); it != bucket.rulesByFirstArgument.end())
+				candidates = &it->second;
+
+		for (size_t index: *candidates)
+		{
+			std::vector<ArgumentShape> const& shapes = bucket.argumentShapes[index];
+			bool admitted = true;
+			for (size_t i = 0; i < shapes.size() && i < _argumentShapes.size() && admitted; ++i)
+				admitted = shapes[i].admits(_argumentShapes[i]);
+			if (admitted && _match(bucket.rules[index]))
+				return &bucket.rules[index];
+		}
+		return nullptr;
+	}
+
+private:
+	struct Bucket
+	{
+		std::vector<Rule> rules;
+		/// Shapes of the arguments of each rule's pattern.
+		std::vector<std::vector<ArgumentShape>> argumentShapes;
+		/// Indices of the rules whose first argument matches everything.
+		std::vector<size_t> unrestrictedRules;
+		/// Indices of the rules that can match an expression by the shape of its first argument.
+		std::map<ArgumentShape, std::vector<size_t>> rulesByFirstArgument;
+	};
+
+	std::array<Bucket, 256> m_buckets;
+};
+
 template <typename Pattern>
 struct EVMBuiltins
 {
 	using InstrType = Instruction;
 
+	/// @returns the arguments as a vector. In contrast to an initializer list,
+	/// this moves the temporary patterns of nested operations instead of copying them.
+	template<typename... Args> static std::vector<Pattern> arguments(Args&&... _args)
+	{
+		std::vector<Pattern> result;
+		result.reserve(sizeof...(Args));
+		(result.emplace_back(std::forward<Args>(_args)), ...);
+		return result;
+	}
+
 	template<Instruction inst>
 	struct PatternGenerator
 	{
-		template<typename... Args> constexpr Pattern operator()(Args&&... _args) const
+		template<typename... Args> Pattern operator()(Args&&... _args) const
 		{
-			return {inst, {std::forward<Args>(_args)...}};
+			return {inst, arguments(std::forward<Args>(_args)...)};
 		}
 	};
 
 	struct PatternGeneratorInstance
 	{
 		Instruction instruction;
-		template<typename... Args> constexpr Pattern operator()(Args&&... _args) const
+		template<typename... Args> Pattern operator()(Args&&... _args) const
 		{
-			return {instruction, {std::forward<Args>(_args)...}};
+			return {instruction, arguments(std::forward<Args>(_args)...)};
 		}
 	};
 
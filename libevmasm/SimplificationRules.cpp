@@ -41,34 +41,41 @@ SimplificationRule<Pattern> const* Rules::findFirstMatch(
 	ExpressionClasses const& _classes
 )
 {
-	resetMatchGroups();
-
 	assertThrow(_expr.item, OptimizerException, "");
-	for (auto const& rule: m_rules[uint8_t(_expr.item->instruction())])
+
+	std::vector<ArgumentShape> argumentShapes;
+	argumentShapes.reserve(_expr.arguments.size());
+	for (ExpressionClasses::Id argument: _expr.arguments)
 	{
-		if (rule.pattern.matches(_expr, _classes))
-			if (!rule.feasible || rule.feasible())
-				return &rule;
+		AssemblyItem const* item = _classes.representative(argument).item;
+		if (item && item->type() == Operation)
+			argumentShapes.push_back({ArgumentShape::Kind::Operation, item->instruction()});
+		else if (item && item->type() == Push)
+			argumentShapes.push_back({ArgumentShape::Kind::Constant, {}});
+		else
+			argumentShapes.push_back({});
+	}
 
+	return m_rules.findFirst(_expr.item->instruction(), argumentShapes, [&](SimplificationRule<Pattern> const& _rule) {
 		resetMatchGroups();
-	}
-	return nullptr;
+		return _rule.pattern.matches(_expr, _classes) && (!_rule.feasible || _rule.feasible());
+	});
 }
 
 bool Rules::isInitialized() const
 {
-	return !m_rules[uint8_t(Instruction::ADD)].empty();
+	return !m_rules.rules(Instruction::ADD).empty();
 }
 
-void Rules::addRules(std::vector<SimplificationRule<Pattern>> const& _rules)
+void Rules::addRules(std::vector<SimplificationRule<Pattern>> _rules)
 {
-	for (auto const& r: _rules)
-		addRule(r);
+	for (auto& r: _rules)
+		addRule(std::move(r));
 }
 
-void Rules::addRule(SimplificationRule<Pattern> const& _rule)
+void Rules::addRule(SimplificationRule<Pattern> _rule)
 {
-	m_rules[uint8_t(_rule.pattern.instruction())].push_back(_rule);
+	m_rules.add(std::move(_rule));
 }
 
 Rules::Rules()
@@ -95,14 +102,14 @@ Rules::Rules()
 	assertThrow(isInitialized(), OptimizerException, "Rule list not properly initialized.");
 }
 
-Pattern::Pattern(Instruction _instruction, std::initializer_list<Pattern> _arguments):
+Pattern::Pattern(Instruction _instruction, std::vector<Pattern> _arguments):
 	m_type(Operation),
 	m_instruction(_instruction),
-	m_arguments(_arguments)
+	m_arguments(std::move(_arguments))
 {
 }
 
-void Pattern::setMatchGroup(unsigned _group, std::map<unsigned, Expression const*>& _matchGroups)
+void Pattern::setMatchGroup(unsigned _group, MatchGroups<Expression>& _matchGroups)
 {
 	m_matchGroup = _group;
 	m_matchGroups = &_matchGroups;
@@ -114,10 +121,13 @@ bool Pattern::matches(Expression const& _expr, ExpressionClasses const& _classes
 		return false;
 	if (m_matchGroup)
 	{
-		if (!m_matchGroups->count(m_matchGroup))
-			(*m_matchGroups)[m_matchGroup] = &_expr;
-		else if ((*m_matchGroups)[m_matchGroup]->id != _expr.id)
-			return false;
+		if (Expression const* firstMatch = m_matchGroups->get(m_matchGroup))
+		{
+			if (firstMatch->id != _expr.id)
+				return false;
+		}
+		else
+			m_matchGroups->set(m_matchGroup, &_expr);
 	}
 	assertThrow(m_arguments.size() == 0 || _expr.arguments.size() == m_arguments.size(), OptimizerException, "");
 	for (size_t i = 0; i < m_arguments.size(); ++i)
@@ -170,6 +180,16 @@ std::string Pattern::toString() const
 	return s.str();
 }
 
+ArgumentShape Pattern::shape() const
+{
+	if (m_type == Operation)
+		return {ArgumentShape::Kind::Operation, m_instruction};
+	else if (m_type == Push)
+		return {ArgumentShape::Kind::Constant, {}};
+	// Patterns for other item types are not distinguished.
+	return {};
+}
+
 bool Pattern::matchesBaseItem(AssemblyItem const* _item) const
 {
 	if (m_type == UndefinedItem)
@@ -189,8 +209,9 @@ Pattern::Expression const& Pattern::matchGroupValue() const
 {
 	assertThrow(m_matchGroup > 0, OptimizerException, "");
 	assertThrow(!!m_matchGroups, OptimizerException, "");
-	assertThrow((*m_matchGroups)[m_matchGroup], OptimizerException, "");
-	return *(*m_matchGroups)[m_matchGroup];
+	Expression const* value = m_matchGroups->get(m_matchGroup);
+	assertThrow(value, OptimizerException, "");
+	return *value;
 }
 
 u256 const& Pattern::data() const
@@ -102,18 +102,11 @@ std::string CharStream::lineAtPosition(int _position) const
 LineColumn CharStream::translatePositionToLineColumn(int _position) const
 {
 	using size_type = std::string::size_type;
-	using diff_type = std::string::difference_type;
 	size_type searchPosition = std::min<size_type>(m_source.size(), size_type(_position));
-	int lineNumber = static_cast<int>(count(m_source.begin(), m_source.begin() + diff_type(searchPosition), '\n'));
-	size_type lineStart;
-	if (searchPosition == 0)
-		lineStart = 0;
-	else
-	{
-		lineStart = m_source.rfind('\n', searchPosition - 1);
-		lineStart = lineStart == std::string::npos ? 0 : lineStart + 1;
-	}
-	return LineColumn{lineNumber, static_cast<int>(searchPosition - lineStart)};
+	std::vector<size_t> const& starts = lineStarts();
+	auto line = std::upper_bound(starts.begin(), starts.end(), searchPosition) - starts.begin() - 1;
+	size_type lineStart = starts[static_cast<size_t>(line)];
+	return LineColumn{static_cast<int>(line), static_cast<int>(searchPosition - lineStart)};
 }
 
 std::string_view CharStream::text(SourceLocation const& _location) const
@@ -146,7 +139,19 @@ std::string CharStream::singleLineSnippet(std::string const& _sourceCode, Source
 
 std::optional<int> CharStream::translateLineColumnToPosition(LineColumn const& _lineColumn) const
 {
-	return translateLineColumnToPosition(m_source, _lineColumn);
+	if (_lineColumn.line < 0)
+		return std::nullopt;
+
+	std::vector<size_t> const& starts = lineStarts();
+	size_t line = static_cast<size_t>(_lineColumn.line);
+	if (line >= starts.size())
+		return std::nullopt;
+
+	size_t offset = starts[line];
+	size_t endOfLine = line + 1 < starts.size() ? starts[line + 1] - 1 : m_source.size();
+	if (offset + static_cast<size_t>(_lineColumn.column) > endOfLine)
+		return std::nullopt;
+	return offset + static_cast<size_t>(_lineColumn.column);
 }
 
 std::optional<int> CharStream::translateLineColumnToPosition(std::string const& _text, LineColumn const& _input)
@@ -172,3 +177,14 @@ std::optional<int> CharStream::translateLineColumnToPosition(std::string const&
 	return offset + static_cast<size_t>(_input.column);
 }
 
+std::vector<size_t> const& CharStream::lineStarts() const
+{
+	if (m_lineStarts.empty())
+	{
+		m_lineStarts.emplace_back(0);
+		for (size_t i = 0; i < m_source.size(); ++i)
+			if (m_source[i] == '\n')
+				m_lineStarts.emplace_back(i + 1);
+	}
+	return m_lineStarts;
+}
@@ -50,11 +50,14 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstdint>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <tuple>
 #include <utility>
+#include <vector>
 
 namespace solidity::langutil
 {
@@ -96,6 +99,11 @@ public:
 	void reset() { m_position = 0; }
 
 	std::string const& source() const noexcept { return m_source; }
+	/// @returns the part of the source that starts at the current position.
+	std::string_view remainingSource() const noexcept
+	{
+		return std::string_view(m_source).substr(std::min(m_position, m_source.size()));
+	}
 	std::string const& name() const noexcept { return m_name; }
 
 	size_t size() const { return m_source.size(); }
@@ -105,9 +113,12 @@ public:
 	/// Functions that help pretty-printing parse errors
 	/// Do only use in error cases, they are quite expensive.
 	std::string lineAtPosition(int _position) const;
-	LineColumn translatePositionToLineColumn(int _position) const;
 	///@}
 
+	/// Translates an absolute position to line:column.
+	/// Uses a binary search over the line starts, which are computed on first use.
+	LineColumn translatePositionToLineColumn(int _position) const;
+
 	/// Translates a line:column to the absolute position.
 	std::optional<int> translateLineColumnToPosition(LineColumn const& _lineColumn) const;
 
@@ -142,10 +153,15 @@ public:
 	static std::string singleLineSnippet(std::string const& _sourceCode, SourceLocation const& _location);
 
 private:
+	/// @returns the offsets at which the lines of the source start, computing them on first use.
+	std::vector<size_t> const& lineStarts() const;
+
 	std::string m_source;
 	std::string m_name;
 	bool m_importedFromAST{false};
 	size_t m_position{0};
+	/// Start offsets of all lines in m_source, empty until first requested by @a lineStarts.
+	mutable std::vector<size_t> m_lineStarts;
 };
 
 }
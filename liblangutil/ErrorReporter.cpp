@@ -29,6 +29,16 @@
 using namespace solidity;
 using namespace solidity::langutil;
 
+namespace
+{
+
+/// IDs of the notes added when the number of warnings, infos or errors exceeds its limit.
+ErrorId constexpr tooManyWarnings = 4591_error;
+ErrorId constexpr tooManyInfos = 2833_error;
+ErrorId constexpr tooManyErrors = 4013_error;
+
+}
+
 ErrorReporter& ErrorReporter::operator=(ErrorReporter const& _errorReporter)
 {
 	if (&_errorReporter == this)
@@ -77,6 +87,22 @@ void ErrorReporter::error(ErrorId _errorId, Error::Type _type, SourceLocation co
 	m_errorList.push_back(std::make_shared<Error>(_errorId, _type, _description, _location, _secondaryLocation));
 }
 
+void ErrorReporter::report(ErrorList const& _errorList)
+{
+	for (auto const& error: _errorList)
+	{
+		if (
+			error->errorId() == tooManyWarnings ||
+			error->errorId() == tooManyInfos ||
+			error->errorId() == tooManyErrors
+		)
+			continue;
+		if (checkForExcessiveErrors(error->type()))
+			continue;
+		m_errorList.push_back(error);
+	}
+}
+
 bool ErrorReporter::hasExcessiveErrors() const
 {
 	return m_errorCount > c_maxErrorsAllowed;
@@ -99,7 +125,7 @@ bool ErrorReporter::checkForExcessiveErrors(Error::Type _type)
 		m_warningCount++;
 
 		if (m_warningCount == c_maxWarningsAllowed)
-			m_errorList.push_back(std::make_shared<Error>(4591_error, Error::Type::Warning, "There are more than 256 warnings. Ignoring the rest."));
+			m_errorList.push_back(std::make_shared<Error>(tooManyWarnings, Error::Type::Warning, "There are more than 256 warnings. Ignoring the rest."));
 
 		if (m_warningCount >= c_maxWarningsAllowed)
 			return true;
@@ -109,7 +135,7 @@ bool ErrorReporter::checkForExcessiveErrors(Error::Type _type)
 		m_infoCount++;
 
 		if (m_infoCount == c_maxInfosAllowed)
-			m_errorList.push_back(std::make_shared<Error>(2833_error, Error::Type::Info, "There are more than 256 infos. Ignoring the rest."));
+			m_errorList.push_back(std::make_shared<Error>(tooManyInfos, Error::Type::Info, "There are more than 256 infos. Ignoring the rest."));
 
 		if (m_infoCount >= c_maxInfosAllowed)
 			return true;
@@ -120,7 +146,7 @@ bool ErrorReporter::checkForExcessiveErrors(Error::Type _type)
 
 		if (m_errorCount > c_maxErrorsAllowed)
 		{
-			m_errorList.push_back(std::make_shared<Error>(4013_error, Error::Type::Warning, "There are more than 256 errors. Aborting."));
+			m_errorList.push_back(std::make_shared<Error>(tooManyErrors, Error::Type::Warning, "There are more than 256 errors. Aborting."));
 			BOOST_THROW_EXCEPTION(FatalError());
 		}
 	}
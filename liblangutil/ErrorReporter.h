@@ -53,6 +53,11 @@ public:
 		m_errorList += _errorList;
 	}
 
+	/// Adds the errors collected by a different reporter as if they had been reported to this one,
+	/// i.e. subject to the limits on the number of warnings, infos and errors. The notes about
+	/// reaching these limits in @a _errorList are dropped, since this reporter adds its own.
+	void report(ErrorList const& _errorList);
+
 	void warning(ErrorId _error, std::string const& _description);
 
 	void warning(ErrorId _error, SourceLocation const& _location, std::string const& _description);
@@ -248,8 +248,13 @@ Token Scanner::selectToken(char _next, Token _then, Token _else)
 bool Scanner::skipWhitespace()
 {
 	size_t const startPosition = sourcePos();
-	while (isWhiteSpace(m_char))
+	// The current character is checked on its own, since it does not always match the source,
+	// e.g. after multi-line comments.
+	if (isWhiteSpace(m_char))
+	{
 		advance();
+		advanceWhile(isWhiteSpace);
+	}
 	// Return whether or not we skipped any characters.
 	return sourcePos() != startPosition;
 }
@@ -312,8 +317,14 @@ Token Scanner::skipSingleLineComment()
 	// non-ascii line terminator, it will result in a parser error.
 	size_t startPosition = m_source.position();
 	while (!isUnicodeLinebreak())
-		if (!advance())
+	{
+		// Skip all characters that cannot start a line terminator at once.
+		advanceWhile([](char _c) {
+			return (_c < 0x0a || _c > 0x0d) && uint8_t(_c) != 0xc2 && uint8_t(_c) != 0xe2;
+		});
+		if (isUnicodeLinebreak() || !advance())
 			break;
+	}
 
 	ScannerError unicodeDirectionError = validateBiDiMarkup(m_source, startPosition);
 	if (unicodeDirectionError != ScannerError::NoError)
@@ -391,26 +402,25 @@ size_t Scanner::scanSingleLineDocComment()
 Token Scanner::skipMultiLineComment()
 {
 	size_t startPosition = m_source.position();
-	while (!isSourcePastEndOfInput())
+	std::string_view const source = m_source.remainingSource();
+	size_t const endOfComment = source.find("*/");
+	if (endOfComment == std::string_view::npos)
 	{
-		char prevChar = m_char;
-		advance();
+		// Unterminated multi-line comment.
+		m_char = m_source.advanceAndGet(source.size());
+		return setError(ScannerError::IllegalCommentTerminator);
+	}
 
-		// If we have reached the end of the multi-line comment, we
-		// consume the '/' and insert a whitespace. This way all
-		// multi-line comments are treated as whitespace.
-		if (prevChar == '*' && m_char == '/')
-		{
-			ScannerError unicodeDirectionError = validateBiDiMarkup(m_source, startPosition);
-			if (unicodeDirectionError != ScannerError::NoError)
-				return setError(unicodeDirectionError);
+	// We have reached the end of the multi-line comment, we
+	// consume the '/' and insert a whitespace. This way all
+	// multi-line comments are treated as whitespace.
+	m_char = m_source.advanceAndGet(endOfComment + 1);
+	ScannerError unicodeDirectionError = validateBiDiMarkup(m_source, startPosition);
+	if (unicodeDirectionError != ScannerError::NoError)
+		return setError(unicodeDirectionError);
 
-			m_char = ' ';
-			return Token::Whitespace;
-		}
-	}
-	// Unterminated multi-line comment.
-	return setError(ScannerError::IllegalCommentTerminator);
+	m_char = ' ';
+	return Token::Whitespace;
 }
 
 Token Scanner::scanMultiLineDocComment()
@@ -828,6 +838,17 @@ Token Scanner::scanString(bool const _isUnicode)
 	LiteralScope literal(this, LITERAL_TYPE_STRING);
 	while (m_char != quote && !isSourcePastEndOfInput() && !isUnicodeLinebreak())
 	{
+		// Printable ASCII characters other than the quote and the backslash are valid in
+		// all string literals and taken over unchanged.
+		std::string_view const plainCharacters = advanceWhile([quote](char _c) {
+			return 0x20 <= _c && _c < 0x7f && _c != quote && _c != '\\';
+		});
+		if (!plainCharacters.empty())
+		{
+			addLiteral(plainCharacters);
+			continue;
+		}
+
 		char c = m_char;
 		advance();
 		if (c == '\\')
@@ -875,6 +896,21 @@ Token Scanner::scanHexString()
 	bool allowUnderscore = false;
 	while (m_char != quote && !isSourcePastEndOfInput())
 	{
+		// Decode runs of complete hex bytes at once.
+		std::string_view const source = m_source.remainingSource();
+		size_t digits = 0;
+		while (digits < source.size() && hexValue(source[digits]) >= 0)
+			++digits;
+		digits -= digits % 2;
+		if (digits > 0)
+		{
+			for (size_t i = 0; i < digits; i += 2)
+				addLiteralChar(static_cast<char>(hexValue(source[i]) * 16 + hexValue(source[i + 1])));
+			m_char = m_source.advanceAndGet(digits);
+			allowUnderscore = true;
+			continue;
+		}
+
 		char c = m_char;
 
 		if (scanHexByte(c))
@@ -1016,8 +1052,9 @@ std::tuple<Token, unsigned, unsigned> Scanner::scanIdentifierOrKeyword()
 	LiteralScope literal(this, LITERAL_TYPE_STRING);
 	addLiteralCharAndAdvance();
 	// Scan the rest of the identifier characters.
-	while (isIdentifierPart(m_char) || (m_char == '.' && m_kind == ScannerKind::Yul))
-		addLiteralCharAndAdvance();
+	addLiteral(advanceWhile([this](char _c) {
+		return isIdentifierPart(_c) || (_c == '.' && m_kind == ScannerKind::Yul);
+	}));
 	literal.complete();
 
 	auto const token = TokenTraits::fromIdentifierOrKeyword(m_tokens[NextNext].literal);
@@ -58,6 +58,7 @@
 
 #include <optional>
 #include <iosfwd>
+#include <string_view>
 
 namespace solidity::langutil
 {
@@ -200,10 +201,25 @@ private:
 	inline void addLiteralChar(char c) { m_tokens[NextNext].literal.push_back(c); }
 	inline void addCommentLiteralChar(char c) { m_skippedComments[NextNext].literal.push_back(c); }
 	inline void addLiteralCharAndAdvance() { addLiteralChar(m_char); advance(); }
+	inline void addLiteral(std::string_view _characters) { m_tokens[NextNext].literal.append(_characters); }
 	void addUnicodeAsUTF8(unsigned codepoint);
 	///@}
 
 	bool advance() { m_char = m_source.advanceAndGet(); return !m_source.isPastEndOfInput(); }
+	/// Advances past all characters starting at the current position for which @a _predicate holds.
+	/// Used to skip runs of characters without the bookkeeping of advancing one by one.
+	/// @returns the characters that were skipped.
+	template <typename Predicate>
+	std::string_view advanceWhile(Predicate _predicate)
+	{
+		std::string_view const source = m_source.remainingSource();
+		size_t length = 0;
+		while (length < source.size() && _predicate(source[length]))
+			++length;
+		if (length > 0)
+			m_char = m_source.advanceAndGet(length);
+		return source.substr(0, length);
+	}
 	void rollback(size_t _amount) { m_char = m_source.rollback(_amount); }
 	/// Rolls back to the start of the current token and re-runs the scanner.
 	void rescan();
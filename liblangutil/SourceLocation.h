@@ -49,7 +49,7 @@ struct SourceLocation
 		if (!sourceName || !_other.sourceName)
 			return std::make_tuple(int(!!sourceName), start, end) < std::make_tuple(int(!!_other.sourceName), _other.start, _other.end);
 		else
-			return std::make_tuple(*sourceName, start, end) < std::make_tuple(*_other.sourceName, _other.start, _other.end);
+			return std::tie(*sourceName, start, end) < std::tie(*_other.sourceName, _other.start, _other.end);
 	}
 
 	bool contains(SourceLocation const& _other) const
@@ -82,18 +82,17 @@ public:
 
 	bool seen(ErrorId _error, SourceLocation const& _location, std::string const& _description) const
 	{
-		if (m_seenErrors.count({_error, _location}))
-		{
-			solAssert(m_seenErrors.at({_error, _location}) == _description, "");
-			return true;
-		}
-		return false;
+		auto it = m_seenErrors.find({_error, _location});
+		if (it == m_seenErrors.end())
+			return false;
+		solAssert(it->second == _description, "");
+		return true;
 	}
 
 	void markAsSeen(ErrorId _error, SourceLocation const& _location, std::string const& _description)
 	{
 		if (_location != SourceLocation{})
-			m_seenErrors[{_error, _location}] = _description;
+			m_seenErrors.emplace(std::make_pair(_error, _location), _description);
 	}
 
 	ErrorList const& errors() const { return m_errorReporter.errors(); }
@@ -21,6 +21,7 @@
 #include <libsmtutil/SMTLib2Parser.h>
 
 #include <libsolutil/Keccak256.h>
+#include <libsolutil/Parallel.h>
 #include <libsolutil/StringUtils.h>
 #include <libsolutil/Visitor.h>
 
@@ -49,7 +50,7 @@ CHCSmtLib2Interface::CHCSmtLib2Interface(
 ):
 	CHCSolverInterface(_queryTimeout),
 	m_smtlib2(std::make_unique<SMTLib2Interface>(_queryResponses, _smtCallback, m_queryTimeout)),
-	m_queryResponses(std::move(_queryResponses)),
+	m_queryResponses(std::make_move_iterator(_queryResponses.begin()), std::make_move_iterator(_queryResponses.end())),
 	m_smtCallback(_smtCallback)
 {
 	reset();
@@ -85,28 +86,68 @@ void CHCSmtLib2Interface::registerRelation(Expression const& _expr)
 
 void CHCSmtLib2Interface::addRule(Expression const& _expr, std::string const& /*_name*/)
 {
-	write(
-		"(assert\n(forall " + forall() + "\n" +
-		m_smtlib2->toSExpr(_expr) +
-		"))\n\n"
-	);
+	// The expression is serialized first, since this can write declarations of its sorts.
+	std::string rule = "(assert\n(forall " + forall() + "\n";
+	m_smtlib2->toSExpr(_expr, rule);
+	rule += "))\n\n";
+	write(std::move(rule));
 }
 
 std::tuple<CheckResult, Expression, CHCSolverInterface::CexGraph> CHCSmtLib2Interface::query(Expression const& _block)
 {
-	std::string query = dumpQuery(_block);
-	std::string response = querySolver(query);
+	return queryResult(querySolver(dumpQuery(_block)));
+}
 
+std::vector<std::tuple<CheckResult, Expression, CHCSolverInterface::CexGraph>> CHCSmtLib2Interface::queryInParallel(
+	std::vector<std::string> const& _queries,
+	size_t _jobs
+)
+{
+	std::vector<std::optional<std::string>> responses(_queries.size());
+	std::vector<size_t> queriesForCallback;
+	for (size_t i = 0; i < _queries.size(); ++i)
+		if (auto const* response = util::valueOrNullptr(m_queryResponses, util::keccak256(_queries[i])))
+			responses[i] = *response;
+		else if (m_smtCallback)
+			queriesForCallback.emplace_back(i);
+
+	if (!queriesForCallback.empty())
+	{
+		setupSmtCallback();
+		util::runInParallel(_jobs, queriesForCallback.size(), [&](size_t _index) {
+			size_t queryIndex = queriesForCallback[_index];
+			auto result = m_smtCallback(ReadCallback::kindString(ReadCallback::Kind::SMTQuery), _queries[queryIndex]);
+			if (result.success)
+				responses[queryIndex] = std::move(result.responseOrErrorMessage);
+		});
+	}
+
+	std::vector<std::tuple<CheckResult, Expression, CexGraph>> results;
+	results.reserve(_queries.size());
+	for (size_t i = 0; i < _queries.size(); ++i)
+	{
+		if (!responses[i])
+		{
+			m_unhandledQueries.push_back(_queries[i]);
+			responses[i] = "unknown\n";
+		}
+		results.emplace_back(queryResult(*responses[i]));
+	}
+	return results;
+}
+
+std::tuple<CheckResult, Expression, CHCSolverInterface::CexGraph> CHCSmtLib2Interface::queryResult(std::string const& _response) const
+{
 	CheckResult result;
 	// TODO proper parsing
-	if (boost::starts_with(response, "sat"))
+	if (boost::starts_with(_response, "sat"))
 	{
-		auto maybeInvariants = invariantsFromSolverResponse(response);
+		auto maybeInvariants = invariantsFromSolverResponse(_response);
 		return {CheckResult::UNSATISFIABLE, maybeInvariants.value_or(Expression(true)), {}};
 	}
-	else if (boost::starts_with(response, "unsat"))
+	else if (boost::starts_with(_response, "unsat"))
 		result = CheckResult::SATISFIABLE;
-	else if (boost::starts_with(response, "unknown"))
+	else if (boost::starts_with(_response, "unknown"))
 		result = CheckResult::UNKNOWN;
 	else
 		result = CheckResult::ERROR;
@@ -175,7 +216,8 @@ void CHCSmtLib2Interface::declareFunction(std::string const& _name, SortPointer
 
 void CHCSmtLib2Interface::write(std::string _data)
 {
-	m_accumulatedOutput += std::move(_data) + "\n";
+	m_accumulatedOutput += _data;
+	m_accumulatedOutput += '\n';
 }
 
 std::string CHCSmtLib2Interface::querySolver(std::string const& _input)
@@ -243,8 +285,7 @@ public:
 		auto const& userSorts = m_chcInterface.smtlib2Interface()->userSorts();
 		for (auto const& declaration: userSorts | ranges::views::values)
 		{
-			std::stringstream ss(declaration);
-			SMTLib2Parser parser(ss);
+			SMTLib2Parser parser(declaration);
 			auto expr = parser.parseExpression();
 			smtAssert(parser.isEOF());
 			smtAssert(!isAtom(expr));
@@ -439,15 +480,14 @@ public:
 #define precondition(CONDITION) if (!(CONDITION)) return {}
 std::optional<smtutil::Expression> CHCSmtLib2Interface::invariantsFromSolverResponse(std::string const& _response) const
 {
-	std::stringstream ss(_response);
-	std::string answer;
-	ss >> answer;
-	precondition(answer == "sat");
-	SMTLib2Parser parser(ss);
-	precondition(!parser.isEOF()); // There has to be a model
+	SMTLib2Parser parser(_response);
 	std::vector<SMTLib2Expression> parsedOutput;
 	try
 	{
+		precondition(!parser.isEOF());
+		SMTLib2Expression answer = parser.parseExpression();
+		precondition(isAtom(answer) && asAtom(answer) == "sat");
+		precondition(!parser.isEOF()); // There has to be a model
 		while (!parser.isEOF())
 			parsedOutput.push_back(parser.parseExpression());
 	}
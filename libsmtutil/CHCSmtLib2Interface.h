@@ -52,6 +52,14 @@ public:
 
 	std::string dumpQuery(Expression const& _expr);
 
+	/// Sends the queries @a _queries created by ``dumpQuery`` to the solver, with up to @a _jobs
+	/// solver calls running concurrently. The SMT callback must be safe to call from multiple threads.
+	/// @returns the results of the queries in the order of @a _queries.
+	std::vector<std::tuple<CheckResult, Expression, CexGraph>> queryInParallel(
+		std::vector<std::string> const& _queries,
+		size_t _jobs
+	);
+
 	std::vector<std::string> unhandledQueries() const { return m_unhandledQueries; }
 
 	SMTLib2Interface* smtlib2Interface() const { return m_smtlib2.get(); }
@@ -75,6 +83,9 @@ protected:
 	/// Communicates with the solver via the callback. Throws SMTSolverError on error.
 	std::string querySolver(std::string const& _input);
 
+	/// Translates the response of the solver to a query to the result of ``query``.
+	std::tuple<CheckResult, Expression, CexGraph> queryResult(std::string const& _response) const;
+
 	/// Translates CHC solver response with a model to our representation of invariants. Returns None on error.
 	std::optional<smtutil::Expression> invariantsFromSolverResponse(std::string const& response) const;
 
@@ -87,7 +98,7 @@ protected:
 	std::string m_accumulatedOutput;
 	std::set<std::string> m_variables;
 
-	std::map<util::h256, std::string> m_queryResponses;
+	std::unordered_map<util::h256, std::string> m_queryResponses;
 	std::vector<std::string> m_unhandledQueries;
 
 	frontend::ReadCallback::Callback m_smtCallback;
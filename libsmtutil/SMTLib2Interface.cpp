@@ -44,7 +44,7 @@ SMTLib2Interface::SMTLib2Interface(
 	std::optional<unsigned> _queryTimeout
 ):
 	SolverInterface(_queryTimeout),
-	m_queryResponses(std::move(_queryResponses)),
+	m_queryResponses(std::make_move_iterator(_queryResponses.begin()), std::make_move_iterator(_queryResponses.end())),
 	m_smtCallback(std::move(_smtCallback))
 {
 	reset();
@@ -111,7 +111,11 @@ void SMTLib2Interface::declareFunction(std::string const& _name, SortPointer con
 
 void SMTLib2Interface::addAssertion(Expression const& _expr)
 {
-	write("(assert " + toSExpr(_expr) + ")");
+	// The expression is serialized first, since this can write declarations of its sorts.
+	std::string assertion = "(assert ";
+	toSExpr(_expr, assertion);
+	assertion += ")";
+	write(std::move(assertion));
 }
 
 std::pair<CheckResult, std::vector<std::string>> SMTLib2Interface::check(std::vector<Expression> const& _expressionsToEvaluate)
@@ -139,53 +143,66 @@ std::pair<CheckResult, std::vector<std::string>> SMTLib2Interface::check(std::ve
 }
 
 std::string SMTLib2Interface::toSExpr(Expression const& _expr)
+{
+	std::string sexpr;
+	toSExpr(_expr, sexpr);
+	return sexpr;
+}
+
+void SMTLib2Interface::toSExpr(Expression const& _expr, std::string& o_sexpr)
 {
 	if (_expr.arguments.empty())
-		return _expr.name;
+	{
+		o_sexpr += _expr.name;
+		return;
+	}
 
-	std::string sexpr = "(";
 	if (_expr.name == "int2bv")
 	{
 		size_t size = std::stoul(_expr.arguments[1].name);
-		auto arg = toSExpr(_expr.arguments.front());
-		auto int2bv = "(_ int2bv " + std::to_string(size) + ")";
+		std::string arg = toSExpr(_expr.arguments.front());
+		std::string int2bv = "(_ int2bv " + std::to_string(size) + ")";
 		// Some solvers treat all BVs as unsigned, so we need to manually apply 2's complement if needed.
-		sexpr += std::string("ite ") +
-			"(>= " + arg + " 0) " +
-			"(" + int2bv + " " + arg + ") " +
-			"(bvneg (" + int2bv + " (- " + arg + ")))";
+		o_sexpr += "(ite (>= " + arg + " 0) ";
+		o_sexpr += "(" + int2bv + " " + arg + ") ";
+		o_sexpr += "(bvneg (" + int2bv + " (- " + arg + "))))";
+		return;
 	}
 	else if (_expr.name == "bv2int")
 	{
 		auto intSort = std::dynamic_pointer_cast<IntSort>(_expr.sort);
 		smtAssert(intSort, "");
 
-		auto arg = toSExpr(_expr.arguments.front());
-		auto nat = "(bv2nat " + arg + ")";
+		std::string arg = toSExpr(_expr.arguments.front());
+		std::string nat = "(bv2nat " + arg + ")";
 
 		if (!intSort->isSigned)
-			return nat;
+		{
+			o_sexpr += nat;
+			return;
+		}
 
 		auto bvSort = std::dynamic_pointer_cast<BitVectorSort>(_expr.arguments.front().sort);
 		smtAssert(bvSort, "");
-		auto size = std::to_string(bvSort->size);
 		auto pos = std::to_string(bvSort->size - 1);
 
 		// Some solvers treat all BVs as unsigned, so we need to manually apply 2's complement if needed.
-		sexpr += std::string("ite ") +
-			"(= ((_ extract " + pos + " " + pos + ")" + arg + ") #b0) " +
-			nat + " " +
-			"(- (bv2nat (bvneg " + arg + ")))";
+		o_sexpr += "(ite (= ((_ extract " + pos + " " + pos + ")" + arg + ") #b0) ";
+		o_sexpr += nat;
+		o_sexpr += " (- (bv2nat (bvneg " + arg + "))))";
+		return;
 	}
-	else if (_expr.name == "const_array")
+
+	o_sexpr += "(";
+	if (_expr.name == "const_array")
 	{
 		smtAssert(_expr.arguments.size() == 2, "");
 		auto sortSort = std::dynamic_pointer_cast<SortSort>(_expr.arguments.at(0).sort);
 		smtAssert(sortSort, "");
 		auto arraySort = std::dynamic_pointer_cast<ArraySort>(sortSort->inner);
 		smtAssert(arraySort, "");
-		sexpr += "(as const " + toSmtLibSort(arraySort) + ") ";
-		sexpr += toSExpr(_expr.arguments.at(1));
+		o_sexpr += "(as const " + toSmtLibSort(arraySort) + ") ";
+		toSExpr(_expr.arguments.at(1), o_sexpr);
 	}
 	else if (_expr.name == "tuple_get")
 	{
@@ -193,24 +210,30 @@ std::string SMTLib2Interface::toSExpr(Expression const& _expr)
 		auto tupleSort = std::dynamic_pointer_cast<TupleSort>(_expr.arguments.at(0).sort);
 		size_t index = std::stoul(_expr.arguments.at(1).name);
 		smtAssert(index < tupleSort->members.size(), "");
-		sexpr += "|" + tupleSort->members.at(index) + "| " + toSExpr(_expr.arguments.at(0));
+		o_sexpr += "|" + tupleSort->members.at(index) + "| ";
+		toSExpr(_expr.arguments.at(0), o_sexpr);
 	}
 	else if (_expr.name == "tuple_constructor")
 	{
 		auto tupleSort = std::dynamic_pointer_cast<TupleSort>(_expr.sort);
 		smtAssert(tupleSort, "");
-		sexpr += "|" + tupleSort->name + "|";
+		o_sexpr += "|" + tupleSort->name + "|";
 		for (auto const& arg: _expr.arguments)
-			sexpr += " " + toSExpr(arg);
+		{
+			o_sexpr += " ";
+			toSExpr(arg, o_sexpr);
+		}
 	}
 	else
 	{
-		sexpr += _expr.name;
+		o_sexpr += _expr.name;
 		for (auto const& arg: _expr.arguments)
-			sexpr += " " + toSExpr(arg);
+		{
+			o_sexpr += " ";
+			toSExpr(arg, o_sexpr);
+		}
 	}
-	sexpr += ")";
-	return sexpr;
+	o_sexpr += ")";
 }
 
 std::string SMTLib2Interface::toSmtLibSort(solidity::smtutil::SortPointer _sort)
@@ -271,7 +294,8 @@ std::string SMTLib2Interface::toSmtLibSort(std::vector<SortPointer> const& _sort
 void SMTLib2Interface::write(std::string _data)
 {
 	smtAssert(!m_accumulatedOutput.empty(), "");
-	m_accumulatedOutput.back() += std::move(_data) + "\n";
+	m_accumulatedOutput.back() += _data;
+	m_accumulatedOutput.back() += '\n';
 }
 
 std::string SMTLib2Interface::checkSatAndGetValuesCommand(std::vector<Expression> const& _expressionsToEvaluate)
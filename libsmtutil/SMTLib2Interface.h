@@ -29,6 +29,7 @@
 #include <map>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace solidity::smtutil
@@ -61,10 +62,12 @@ public:
 
 	// Used by CHCSmtLib2Interface
 	std::string toSExpr(Expression const& _expr);
+	/// Appends the serialization of @a _expr to @a o_sexpr.
+	void toSExpr(Expression const& _expr, std::string& o_sexpr);
 	std::string toSmtLibSort(SortPointer _sort);
 	std::string toSmtLibSort(std::vector<SortPointer> const& _sort);
 
-	std::map<std::string, SortPointer> variables() { return m_variables; }
+	std::map<std::string, SortPointer> const& variables() const { return m_variables; }
 
 	std::vector<std::pair<std::string, std::string>> const& userSorts() const { return m_userSorts; }
 	std::map<SortPointer, std::string> const& sortNames() const { return m_sortNames; }
@@ -99,7 +102,7 @@ protected:
 	/// Remembers all declared sorts and is used as a cache as well.
 	std::map<SortPointer, std::string> m_sortNames;
 
-	std::map<util::h256, std::string> m_queryResponses;
+	std::unordered_map<util::h256, std::string> m_queryResponses;
 	std::vector<std::string> m_unhandledQueries;
 
 	frontend::ReadCallback::Callback m_smtCallback;
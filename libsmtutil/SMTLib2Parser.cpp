@@ -23,6 +23,8 @@
 #include <libsolutil/Visitor.h>
 #include <libsolutil/StringUtils.h>
 
+#include <algorithm>
+
 
 using namespace solidity::langutil;
 using namespace solidity::smtutil;
@@ -53,45 +55,49 @@ SMTLib2Expression SMTLib2Parser::parseExpression() {
 		}
 		if (token() != ')')
 			throw ParsingException{};
-		// Simulate whitespace because we do not want to read the next token since it might block.
-		m_token = ' ';
+		advance();
 		return {std::move(subExpressions)};
 	} else
 		return {parseToken()};
 }
 
 std::string SMTLib2Parser::parseToken() {
-	std::string result;
-
 	skipWhitespace();
-	bool isPipe = token() == '|';
-	if (isPipe)
-		advance();
+	if (token() == '|')
+	{
+		// Quoted symbols extend to the next pipe and may contain whitespace, parentheses and semicolons.
+		size_t start = m_position + 1;
+		size_t end = std::min(m_input.find('|', start), m_input.size());
+		m_position = std::min(end + 1, m_input.size());
+		return std::string(m_input.substr(start, end - start));
+	}
+
+	size_t start = m_position;
 	while (token() != 0)
 	{
 		char c = token();
-		if (isPipe && c == '|')
-		{
-			advance();
-			break;
-		} else if (!isPipe && (isWhiteSpace(c) || c == '(' || c == ')'))
+		if (isWhiteSpace(c) || c == '(' || c == ')' || c == ';')
 			break;
-		result.push_back(c);
-		advance();
+		++m_position;
 	}
-	return result;
+	// Only happens for an unmatched closing parenthesis.
+	if (m_position == start)
+		throw ParsingException{};
+	return std::string(m_input.substr(start, m_position - start));
 }
 
 void SMTLib2Parser::advance() {
-	if (!m_input.good())
+	if (m_position >= m_input.size())
 		throw ParsingException{};
-	m_token = static_cast<char>(m_input.get());
-	if (token() == ';')
-		while (token() != '\n' && token() != 0)
-			m_token = static_cast<char>(m_input.get());
+	++m_position;
 }
 
 void SMTLib2Parser::skipWhitespace() {
-	while (isWhiteSpace(token()))
-		advance();
+	while (token() != 0)
+		if (isWhiteSpace(token()))
+			++m_position;
+		else if (token() == ';')
+			m_position = std::min(m_input.find('\n', m_position), m_input.size());
+		else
+			break;
 }
@@ -20,8 +20,8 @@
 
 #include <libsmtutil/Exceptions.h>
 
-#include <iostream>
 #include <string>
+#include <string_view>
 #include <variant>
 #include <vector>
 
@@ -66,31 +66,32 @@ class SMTLib2Parser {
 public:
 	class ParsingException {};
 
-	explicit SMTLib2Parser(std::istream& _input) :
-			m_input(_input),
-			m_token(static_cast<char>(m_input.get())) {}
+	/// Parses directly from @a _input, which has to outlive the parser.
+	explicit SMTLib2Parser(std::string_view _input): m_input(_input) {}
 
 	SMTLib2Expression parseExpression();
 
 	bool isEOF()
 	{
 		skipWhitespace();
-		return m_input.eof();
+		return m_position >= m_input.size();
 	}
 
 private:
 	std::string parseToken();
 
+	/// Skips whitespace and comments.
 	void skipWhitespace();
 
+	/// @returns the current character or zero at the end of the input.
 	[[nodiscard]] char token() const
 	{
-		return m_token;
+		return m_position < m_input.size() ? m_input[m_position] : 0;
 	}
 
 	void advance();
 
-	std::istream& m_input;
-	char m_token = 0;
+	std::string_view m_input;
+	size_t m_position = 0;
 };
 }
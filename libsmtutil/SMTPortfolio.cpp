@@ -20,6 +20,10 @@
 
 #include <libsmtutil/SMTLib2Interface.h>
 
+#include <libsolutil/Parallel.h>
+
+#include <mutex>
+
 using namespace solidity;
 using namespace solidity::util;
 using namespace solidity::frontend;
@@ -27,9 +31,10 @@ using namespace solidity::smtutil;
 
 SMTPortfolio::SMTPortfolio(
 	std::vector<std::unique_ptr<SolverInterface>> _solvers,
-	std::optional<unsigned> _queryTimeout
+	std::optional<unsigned> _queryTimeout,
+	bool _raceSolvers
 ):
-	SolverInterface(_queryTimeout), m_solvers(std::move(_solvers))
+	SolverInterface(_queryTimeout), m_solvers(std::move(_solvers)), m_raceSolvers(_raceSolvers)
 {}
 
 
@@ -93,9 +98,15 @@ void SMTPortfolio::addAssertion(Expression const& _expr)
  *   when it is told that this is a hard query to solve.
  *
  *   If all solvers return ERROR, the result is ERROR.
+ *
+ * In racing mode, the result of the first solver that answers the query is used
+ * and conflicts are not detected. If no solver answers, 3) applies.
 */
 std::pair<CheckResult, std::vector<std::string>> SMTPortfolio::check(std::vector<Expression> const& _expressionsToEvaluate)
 {
+	if (m_raceSolvers && m_solvers.size() > 1)
+		return raceSolvers(_expressionsToEvaluate);
+
 	CheckResult lastResult = CheckResult::ERROR;
 	std::vector<std::string> finalValues;
 	for (auto const& s: m_solvers)
@@ -122,6 +133,54 @@ std::pair<CheckResult, std::vector<std::string>> SMTPortfolio::check(std::vector
 	return std::make_pair(lastResult, finalValues);
 }
 
+std::pair<CheckResult, std::vector<std::string>> SMTPortfolio::raceSolvers(std::vector<Expression> const& _expressionsToEvaluate)
+{
+	// Solvers based on SMT-LIB2 send their queries through the same callback,
+	// so they are queried one after another by a single task.
+	std::vector<std::vector<SolverInterface*>> tasks;
+	std::vector<SolverInterface*> smtlib2Solvers;
+	for (auto const& s: m_solvers)
+		if (dynamic_cast<SMTLib2Interface*>(s.get()))
+			smtlib2Solvers.emplace_back(s.get());
+		else
+			tasks.push_back({s.get()});
+	if (!smtlib2Solvers.empty())
+		tasks.emplace_back(std::move(smtlib2Solvers));
+
+	std::mutex mutex;
+	std::optional<std::pair<CheckResult, std::vector<std::string>>> answer;
+	CheckResult lastResult = CheckResult::ERROR;
+	util::runInParallel(tasks.size(), tasks.size(), [&](size_t _index) {
+		for (SolverInterface* solver: tasks[_index])
+		{
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+				if (answer)
+					return;
+			}
+			auto [result, values] = solver->check(_expressionsToEvaluate);
+
+			std::lock_guard<std::mutex> lock(mutex);
+			if (answer)
+				return;
+			if (solverAnswered(result))
+			{
+				answer = std::make_pair(result, std::move(values));
+				for (auto const& s: m_solvers)
+					if (s.get() != solver)
+						s->interrupt();
+				return;
+			}
+			else if (result == CheckResult::UNKNOWN)
+				lastResult = result;
+		}
+	});
+
+	if (answer)
+		return std::move(*answer);
+	return std::make_pair(lastResult, std::vector<std::string>{});
+}
+
 std::vector<std::string> SMTPortfolio::unhandledQueries()
 {
 	// This code assumes that the constructor guarantees that
@@ -34,6 +34,8 @@ namespace solidity::smtutil
  * propagating the functionalities to all solvers.
  * It also checks whether different solvers give conflicting answers
  * to SMT queries.
+ * In racing mode, queries are instead sent to all solvers concurrently and
+ * the first definitive answer is used, interrupting the remaining solvers.
  */
 class SMTPortfolio: public SolverInterface
 {
@@ -42,7 +44,11 @@ public:
 	SMTPortfolio(SMTPortfolio const&) = delete;
 	SMTPortfolio& operator=(SMTPortfolio const&) = delete;
 
-	SMTPortfolio(std::vector<std::unique_ptr<SolverInterface>> solvers, std::optional<unsigned> _queryTimeout);
+	SMTPortfolio(
+		std::vector<std::unique_ptr<SolverInterface>> solvers,
+		std::optional<unsigned> _queryTimeout,
+		bool _raceSolvers = false
+	);
 
 	void reset() override;
 
@@ -63,7 +69,11 @@ public:
 private:
 	static bool solverAnswered(CheckResult result);
 
+	/// Implementation of ``check`` in racing mode.
+	std::pair<CheckResult, std::vector<std::string>> raceSolvers(std::vector<Expression> const& _expressionsToEvaluate);
+
 	std::vector<std::unique_ptr<SolverInterface>> m_solvers;
+	bool m_raceSolvers = false;
 
 	std::vector<Expression> m_assertions;
 };
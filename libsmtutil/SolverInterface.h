@@ -119,6 +119,45 @@ class Expression
 {
 	friend class SolverInterface;
 public:
+	/// Immutable list of the arguments of an expression.
+	/// Copies of an expression share the storage of its arguments, so that copying an expression
+	/// does not copy all its subexpressions and repeated subexpressions form a DAG instead of a tree.
+	class Arguments
+	{
+	public:
+		Arguments() = default;
+		Arguments(std::vector<Expression> _arguments):
+			m_arguments(
+				_arguments.empty() ?
+				nullptr :
+				std::make_shared<std::vector<Expression> const>(std::move(_arguments))
+			)
+		{}
+
+		operator std::vector<Expression> const&() const { return get(); }
+
+		bool empty() const { return !m_arguments; }
+		size_t size() const { return get().size(); }
+		Expression const& at(size_t _index) const { return get().at(_index); }
+		Expression const& operator[](size_t _index) const { return get()[_index]; }
+		Expression const& front() const { return get().front(); }
+		Expression const& back() const { return get().back(); }
+		std::vector<Expression>::const_iterator begin() const { return get().begin(); }
+		std::vector<Expression>::const_iterator end() const { return get().end(); }
+
+		/// @returns true if both lists use the same storage, which implies that they are equal.
+		bool sharesStorageWith(Arguments const& _other) const { return m_arguments == _other.m_arguments; }
+
+	private:
+		std::vector<Expression> const& get() const
+		{
+			static std::vector<Expression> const noArguments;
+			return m_arguments ? *m_arguments : noArguments;
+		}
+
+		std::shared_ptr<std::vector<Expression> const> m_arguments;
+	};
+
 	explicit Expression(bool _v): Expression(_v ? "true" : "false", Kind::Bool) {}
 	explicit Expression(std::shared_ptr<SortSort> _sort, std::string _name = ""): Expression(std::move(_name), {}, _sort) {}
 	explicit Expression(std::string _name, std::vector<Expression> _arguments, SortPointer _sort):
@@ -485,7 +524,7 @@ public:
 	}
 
 	std::string name;
-	std::vector<Expression> arguments;
+	Arguments arguments;
 	SortPointer sort;
 
 private:
@@ -536,6 +575,11 @@ public:
 	virtual std::pair<CheckResult, std::vector<std::string>>
 	check(std::vector<Expression> const& _expressionsToEvaluate) = 0;
 
+	/// Asks a call to ``check`` that is running on another thread to stop as soon as possible,
+	/// in which case it reports an UNKNOWN result. Has no effect if no check is running or if
+	/// the solver does not support it.
+	virtual void interrupt() {}
+
 	/// @returns a list of queries that the system was not able to respond to.
 	virtual std::vector<std::string> unhandledQueries() { return {}; }
 
@@ -111,6 +111,12 @@ std::string compile(std::string _input, CStyleReadFileCallback _readCallback, vo
 	return compiler.compile(std::move(_input));
 }
 
+std::string compileBatch(std::string const& _inputs, CStyleReadFileCallback _readCallback, void* _readContext)
+{
+	StandardCompiler compiler(wrapReadCallback(_readCallback, _readContext));
+	return compiler.compileBatch(_inputs);
+}
+
 }
 
 extern "C"
@@ -131,6 +137,11 @@ extern char* solidity_compile(char const* _input, CStyleReadFileCallback _readCa
 	return solidityAllocations.emplace_back(compile(_input, _readCallback, _readContext)).data();
 }
 
+extern char* solidity_compile_batch(char const* _inputs, CStyleReadFileCallback _readCallback, void* _readContext) noexcept
+{
+	return solidityAllocations.emplace_back(compileBatch(_inputs, _readCallback, _readContext)).data();
+}
+
 extern char* solidity_alloc(size_t _size) noexcept
 {
 	try
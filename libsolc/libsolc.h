@@ -90,6 +90,21 @@ void solidity_free(char* _data) SOLC_NOEXCEPT;
 /// @returns A pointer to the result. The pointer returned must be freed by the caller using solidity_free() or solidity_reset().
 char* solidity_compile(char const* _input, CStyleReadFileCallback _readCallback, void* _readContext) SOLC_NOEXCEPT;
 
+/// Takes a JSON array of "Standard Input JSON" documents and an optional callback (can be set
+/// to null). Returns a JSON array of the corresponding "Standard Output JSON" documents in the
+/// same order. Both are to be UTF-8 encoded.
+///
+/// The inputs are compiled one after the other, like by consecutive calls to solidity_compile(),
+/// but the internal state of the compiler is set up and kept only once for all of them.
+/// If the input is not an array, a single "Standard Output JSON" reporting the error is returned.
+///
+/// @param _inputs The array of input JSONs to process.
+/// @param _readCallback The optional callback pointer, used for all inputs. See solidity_compile().
+/// @param _readContext An optional context pointer passed to _readCallback. Can be NULL.
+///
+/// @returns A pointer to the result. The pointer returned must be freed by the caller using solidity_free() or solidity_reset().
+char* solidity_compile_batch(char const* _inputs, CStyleReadFileCallback _readCallback, void* _readContext) SOLC_NOEXCEPT;
+
 /// Frees up any allocated memory.
 ///
 /// NOTE: the pointer returned by solidity_compile as well as any other pointer retrieved via solidity_alloc()
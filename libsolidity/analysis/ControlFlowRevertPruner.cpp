@@ -53,6 +53,10 @@ void ControlFlowRevertPruner::run()
 
 	findRevertStates();
 	modifyFunctionFlows();
+
+	for (auto const& [item, revertState]: m_functions)
+		if (revertState == RevertState::AllPathsRevert)
+			item.function->annotation().nonReturningIn.insert(item.contract);
 }
 
 void ControlFlowRevertPruner::findRevertStates()
@@ -29,6 +29,7 @@ namespace solidity::frontend
 /**
  * Analyses all function flows and recursively removes all exit edges from CFG
  * nodes that make function calls that will always revert.
+ * Stores the contexts in which functions never return to their caller in their annotations.
  */
 class ControlFlowRevertPruner
 {
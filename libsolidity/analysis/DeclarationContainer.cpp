@@ -41,10 +41,10 @@ Declaration const* DeclarationContainer::conflictingDeclaration(
 		_name = &_declaration.name();
 	solAssert(!_name->empty(), "");
 	std::vector<Declaration const*> declarations;
-	if (m_declarations.count(*_name))
-		declarations += m_declarations.at(*_name);
-	if (m_invisibleDeclarations.count(*_name))
-		declarations += m_invisibleDeclarations.at(*_name);
+	if (auto const* visible = visibleDeclarations(*_name))
+		declarations += *visible;
+	if (auto it = m_invisibleDeclarations.find(*_name); it != m_invisibleDeclarations.end())
+		declarations += it->second;
 
 	if (
 		dynamic_cast<FunctionDefinition const*>(&_declaration) ||
@@ -84,13 +84,15 @@ Declaration const* DeclarationContainer::conflictingDeclaration(
 
 void DeclarationContainer::activateVariable(ASTString const& _name)
 {
+	auto invisible = m_invisibleDeclarations.find(_name);
 	solAssert(
-		m_invisibleDeclarations.count(_name) && m_invisibleDeclarations.at(_name).size() == 1,
+		invisible != m_invisibleDeclarations.end() && invisible->second.size() == 1,
 		"Tried to activate a non-inactive variable or multiple inactive variables with the same name."
 	);
-	solAssert(m_declarations.count(_name) == 0 || m_declarations.at(_name).empty(), "");
-	m_declarations[_name].emplace_back(m_invisibleDeclarations.at(_name).front());
-	m_invisibleDeclarations.erase(_name);
+	std::vector<Declaration const*>& declarations = visibleDeclarationsForInsertion(_name);
+	solAssert(declarations.empty(), "");
+	declarations.emplace_back(invisible->second.front());
+	m_invisibleDeclarations.erase(invisible);
 }
 
 bool DeclarationContainer::isInvisible(ASTString const& _name) const
@@ -114,7 +116,7 @@ bool DeclarationContainer::registerDeclaration(
 	if (_update)
 	{
 		solAssert(!dynamic_cast<FunctionDefinition const*>(&_declaration), "Attempt to update function definition.");
-		m_declarations.erase(*_name);
+		eraseVisibleDeclarations(*_name);
 		m_invisibleDeclarations.erase(*_name);
 	}
 	else
@@ -126,7 +128,7 @@ bool DeclarationContainer::registerDeclaration(
 			m_homonymCandidates.emplace_back(*_name, _location ? _location : &_declaration.location());
 	}
 
-	std::vector<Declaration const*>& decls = _invisible ? m_invisibleDeclarations[*_name] : m_declarations[*_name];
+	std::vector<Declaration const*>& decls = _invisible ? m_invisibleDeclarations[*_name] : visibleDeclarationsForInsertion(*_name);
 	if (!util::contains(decls, &_declaration))
 		decls.push_back(&_declaration);
 	return true;
@@ -147,28 +149,42 @@ std::vector<Declaration const*> DeclarationContainer::resolveName(
 ) const
 {
 	solAssert(!_name.empty(), "Attempt to resolve empty name.");
-	std::vector<Declaration const*> result;
 
-	if (m_declarations.count(_name))
+	for (
+		DeclarationContainer const* container = this;
+		container;
+		container = _settings.recursive ? container->m_enclosingContainer : nullptr
+	)
 	{
-		if (_settings.onlyVisibleAsUnqualifiedNames)
-			result += m_declarations.at(_name) | ranges::views::filter(&Declaration::isVisibleAsUnqualifiedName) | ranges::to_vector;
-		else
-			result += m_declarations.at(_name);
-	}
+		std::vector<Declaration const*> const* visible = container->visibleDeclarations(_name);
+		std::vector<Declaration const*> const* invisible = nullptr;
+		if (_settings.alsoInvisible)
+			if (auto it = container->m_invisibleDeclarations.find(_name); it != container->m_invisibleDeclarations.end())
+				invisible = &it->second;
 
-	if (_settings.alsoInvisible && m_invisibleDeclarations.count(_name))
-	{
-		if (_settings.onlyVisibleAsUnqualifiedNames)
-			result += m_invisibleDeclarations.at(_name) | ranges::views::filter(&Declaration::isVisibleAsUnqualifiedName) | ranges::to_vector;
-		else
-			result += m_invisibleDeclarations.at(_name);
-	}
+		// Fast path for the common case of a name that is only declared once.
+		if (
+			visible &&
+			!invisible &&
+			visible->size() == 1 &&
+			(!_settings.onlyVisibleAsUnqualifiedNames || visible->front()->isVisibleAsUnqualifiedName())
+		)
+			return *visible;
 
-	if (result.empty() && _settings.recursive && m_enclosingContainer)
-		result = m_enclosingContainer->resolveName(_name, _settings);
+		std::vector<Declaration const*> result;
+		for (auto const* declarations: {visible, invisible})
+			if (declarations)
+			{
+				if (_settings.onlyVisibleAsUnqualifiedNames)
+					result += *declarations | ranges::views::filter(&Declaration::isVisibleAsUnqualifiedName) | ranges::to_vector;
+				else
+					result += *declarations;
+			}
+		if (!result.empty())
+			return result;
+	}
 
-	return result;
+	return {};
 }
 
 std::vector<ASTString> DeclarationContainer::similarNames(ASTString const& _name) const
@@ -199,6 +215,31 @@ std::vector<ASTString> DeclarationContainer::similarNames(ASTString const& _name
 	return similar;
 }
 
+std::vector<Declaration const*> const* DeclarationContainer::visibleDeclarations(ASTString const& _name) const
+{
+	if (auto it = m_declarationIndex.find(_name); it != m_declarationIndex.end())
+		return it->second;
+	return nullptr;
+}
+
+std::vector<Declaration const*>& DeclarationContainer::visibleDeclarationsForInsertion(ASTString const& _name)
+{
+	if (auto it = m_declarationIndex.find(_name); it != m_declarationIndex.end())
+		return *it->second;
+	auto& [name, declarations] = *m_declarations.emplace(_name, std::vector<Declaration const*>{}).first;
+	m_declarationIndex.emplace(name, &declarations);
+	return declarations;
+}
+
+void DeclarationContainer::eraseVisibleDeclarations(ASTString const& _name)
+{
+	if (auto it = m_declarations.find(_name); it != m_declarations.end())
+	{
+		m_declarationIndex.erase(it->first);
+		m_declarations.erase(it);
+	}
+}
+
 void DeclarationContainer::populateHomonyms(std::back_insert_iterator<Homonyms> _it) const
 {
 	for (DeclarationContainer const* innerContainer: m_innerContainers)
@@ -27,7 +27,11 @@
 #include <liblangutil/Exceptions.h>
 #include <liblangutil/SourceLocation.h>
 
+#include <map>
 #include <memory>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
 
 namespace solidity::frontend
 {
@@ -65,6 +69,10 @@ public:
 		if (_enclosingContainer)
 			_enclosingContainer->m_innerContainers.emplace_back(this);
 	}
+	/// Not copyable, since the inner containers and the declaration index refer to this instance.
+	DeclarationContainer(DeclarationContainer const&) = delete;
+	DeclarationContainer& operator=(DeclarationContainer const&) = delete;
+
 	/// Registers the declaration in the scope unless its name is already declared or the name is empty.
 	/// @param _name the name to register, if nullptr the intrinsic name of @a _declaration is used.
 	/// @param _location alternative location, used to point at homonymous declarations.
@@ -100,10 +108,20 @@ public:
 	void populateHomonyms(std::back_insert_iterator<Homonyms> _it) const;
 
 private:
+	/// @returns the visible declarations registered under @a _name or nullptr if there are none.
+	std::vector<Declaration const*> const* visibleDeclarations(ASTString const& _name) const;
+	/// @returns the list of visible declarations for @a _name, creating it if there is none yet.
+	std::vector<Declaration const*>& visibleDeclarationsForInsertion(ASTString const& _name);
+	void eraseVisibleDeclarations(ASTString const& _name);
+
 	ASTNode const* m_enclosingNode = nullptr;
 	DeclarationContainer const* m_enclosingContainer = nullptr;
 	std::vector<DeclarationContainer const*> m_innerContainers;
 	std::map<ASTString, std::vector<Declaration const*>> m_declarations;
+	/// Hashed index into m_declarations, used for the lookups in resolveName. m_declarations
+	/// stays ordered for iteration. Names and lists of a map entry stay at the same address
+	/// as long as the entry exists.
+	std::unordered_map<std::string_view, std::vector<Declaration const*>*> m_declarationIndex;
 	std::map<ASTString, std::vector<Declaration const*>> m_invisibleDeclarations;
 	/// List of declarations (name and location) to check later for homonymity.
 	std::vector<std::pair<std::string, langutil::SourceLocation const*>> m_homonymCandidates;
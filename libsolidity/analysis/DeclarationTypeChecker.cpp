@@ -177,10 +177,9 @@ void DeclarationTypeChecker::endVisit(UserDefinedTypeName const& _typeName)
 			structDef->accept(*this);
 		_typeName.annotation().type = TypeProvider::structType(*structDef, DataLocation::Storage);
 	}
-	else if (EnumDefinition const* enumDef = dynamic_cast<EnumDefinition const*>(declaration))
-		_typeName.annotation().type = TypeProvider::enumType(*enumDef);
-	else if (ContractDefinition const* contract = dynamic_cast<ContractDefinition const*>(declaration))
-		_typeName.annotation().type = TypeProvider::contract(*contract);
+	else if (dynamic_cast<EnumDefinition const*>(declaration) || dynamic_cast<ContractDefinition const*>(declaration))
+		// Use the type of the declaration itself, so that its member lists are shared.
+		_typeName.annotation().type = dynamic_cast<TypeType const&>(*declaration->type()).actualType();
 	else if (auto userDefinedValueType = dynamic_cast<UserDefinedValueTypeDefinition const*>(declaration))
 		_typeName.annotation().type = TypeProvider::userDefinedValueType(*userDefinedValueType);
 	else
@@ -408,6 +407,7 @@ void DeclarationTypeChecker::endVisit(VariableDeclaration const& _variable)
 				case Location::Memory: return "\"memory\"";
 				case Location::Storage: return "\"storage\"";
 				case Location::CallData: return "\"calldata\"";
+				case Location::Transient: return "\"transient\"";
 				case Location::Unspecified: return "none";
 			}
 			return {};
@@ -443,6 +443,34 @@ void DeclarationTypeChecker::endVisit(VariableDeclaration const& _variable)
 		varLoc = *allowedDataLocations.begin();
 	}
 
+	if (varLoc == Location::Transient)
+	{
+		if (_variable.isConstant() || _variable.immutable())
+			m_errorReporter.declarationError(
+				2502_error,
+				_variable.location(),
+				"Transient cannot be used as data location for constant or immutable variables."
+			);
+		else if (_variable.hasReferenceOrMappingType())
+			m_errorReporter.typeError(
+				8838_error,
+				_variable.location(),
+				"Transient storage is only implemented for state variables of value type."
+			);
+		else if (_variable.value())
+			m_errorReporter.declarationError(
+				5059_error,
+				_variable.value()->location(),
+				"Initialization of transient storage state variables is not supported."
+			);
+		if (!m_evmVersion.supportsTransientStorage())
+			m_errorReporter.typeError(
+				3938_error,
+				_variable.location(),
+				"Transient storage is only available for EVM versions cancun and later."
+			);
+	}
+
 	// Find correct data location.
 	if (_variable.isEventOrErrorParameter())
 	{
@@ -456,7 +484,7 @@ void DeclarationTypeChecker::endVisit(VariableDeclaration const& _variable)
 	}
 	else if (_variable.isStateVariable())
 	{
-		solAssert(varLoc == Location::Unspecified, "");
+		solAssert(varLoc == Location::Unspecified || varLoc == Location::Transient, "");
 		typeLoc = (_variable.isConstant() || _variable.immutable()) ? DataLocation::Memory : DataLocation::Storage;
 	}
 	else if (
@@ -479,6 +507,9 @@ void DeclarationTypeChecker::endVisit(VariableDeclaration const& _variable)
 				break;
 			case Location::Unspecified:
 				solAssert(!_variable.hasReferenceOrMappingType(), "Data location not properly set.");
+				break;
+			case Location::Transient:
+				solAssert(false, "Transient storage is only allowed for state variables.");
 		}
 
 	Type const* type = _variable.typeName().annotation().type;
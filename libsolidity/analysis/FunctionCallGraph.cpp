@@ -19,6 +19,7 @@
 #include <libsolidity/analysis/FunctionCallGraph.h>
 
 #include <libsolutil/StringUtils.h>
+#include <libsolutil/Visitor.h>
 
 #include <range/v3/range/conversion.hpp>
 #include <range/v3/view/reverse.hpp>
@@ -27,10 +28,11 @@
 using namespace solidity::frontend;
 using namespace solidity::util;
 
-CallGraph FunctionCallGraphBuilder::buildCreationGraph(ContractDefinition const& _contract)
+CallGraph FunctionCallGraphBuilder::buildCreationGraph(ContractDefinition const& _contract, VisitEffects* o_visitEffects)
 {
 	FunctionCallGraphBuilder builder(_contract);
 	solAssert(builder.m_currentNode == CallGraph::Node(CallGraph::SpecialNode::Entry), "");
+	builder.m_effectsToRecord = o_visitEffects;
 
 	// Create graph for constructor, state vars, etc
 	for (ContractDefinition const* base: _contract.annotation().linearizedBaseContracts | ranges::views::reverse)
@@ -65,11 +67,13 @@ CallGraph FunctionCallGraphBuilder::buildCreationGraph(ContractDefinition const&
 
 CallGraph FunctionCallGraphBuilder::buildDeployedGraph(
 	ContractDefinition const& _contract,
-	CallGraph const& _creationGraph
+	CallGraph const& _creationGraph,
+	VisitEffects const* _visitEffects
 )
 {
 	FunctionCallGraphBuilder builder(_contract);
 	solAssert(builder.m_currentNode == CallGraph::Node(CallGraph::SpecialNode::Entry), "");
+	builder.m_recordedEffects = _visitEffects;
 
 	auto getSecondElement = [](auto const& _tuple){ return std::get<1>(_tuple); };
 
@@ -123,9 +127,9 @@ bool FunctionCallGraphBuilder::visit(FunctionCall const& _functionCall)
 		// If it's not a direct call, we don't really know which function will be called (it may even
 		// change at runtime). All we can do is to add an edge to the dispatch which in turn has
 		// edges to all functions could possibly be called.
-		add(m_currentNode, CallGraph::SpecialNode::InternalDispatch);
+		apply(InternalDispatchCall{});
 	else if (functionType->kind() == FunctionType::Kind::Error)
-		m_graph.usedErrors.insert(&dynamic_cast<ErrorDefinition const&>(functionType->declaration()));
+		apply(&dynamic_cast<ErrorDefinition const&>(functionType->declaration()));
 
 	return true;
 }
@@ -135,7 +139,7 @@ bool FunctionCallGraphBuilder::visit(EmitStatement const& _emitStatement)
 	auto const* functionType = dynamic_cast<FunctionType const*>(_emitStatement.eventCall().expression().annotation().type);
 	solAssert(functionType, "");
 
-	m_graph.emittedEvents.insert(&dynamic_cast<EventDefinition const&>(functionType->declaration()));
+	apply(&dynamic_cast<EventDefinition const&>(functionType->declaration()));
 
 	return true;
 }
@@ -175,7 +179,7 @@ bool FunctionCallGraphBuilder::visit(MemberAccess const& _memberAccess)
 		))
 		{
 			ContractType const& accessedContractType = dynamic_cast<ContractType const&>(*magicType->typeArgument());
-			m_graph.bytecodeDependency.emplace(&accessedContractType.contractDefinition(), &_memberAccess);
+			apply(BytecodeDependency{&accessedContractType.contractDefinition(), &_memberAccess});
 		}
 
 	auto functionType = dynamic_cast<FunctionType const*>(_memberAccess.annotation().type);
@@ -238,7 +242,7 @@ bool FunctionCallGraphBuilder::visit(ModifierInvocation const& _modifierInvocati
 bool FunctionCallGraphBuilder::visit(NewExpression const& _newExpression)
 {
 	if (ContractType const* contractType = dynamic_cast<ContractType const*>(_newExpression.typeName().annotation().type))
-		m_graph.bytecodeDependency.emplace(&contractType->contractDefinition(), &_newExpression);
+		apply(BytecodeDependency{&contractType->contractDefinition(), &_newExpression});
 
 	return true;
 }
@@ -264,7 +268,17 @@ void FunctionCallGraphBuilder::processQueue()
 		solAssert(std::holds_alternative<CallableDeclaration const*>(m_currentNode), "");
 
 		m_visitQueue.pop_front();
-		std::get<CallableDeclaration const*>(m_currentNode)->accept(*this);
+		CallableDeclaration const* callable = std::get<CallableDeclaration const*>(m_currentNode);
+		if (auto const* effects = m_recordedEffects ? util::valueOrNullptr(*m_recordedEffects, callable) : nullptr)
+			for (VisitEffect const& effect: *effects)
+				apply(effect);
+		else
+		{
+			if (m_effectsToRecord)
+				m_currentEffects = &(*m_effectsToRecord)[callable];
+			callable->accept(*this);
+			m_currentEffects = nullptr;
+		}
 	}
 
 	m_currentNode = CallGraph::SpecialNode::Entry;
@@ -277,19 +291,43 @@ void FunctionCallGraphBuilder::add(CallGraph::Node _caller, CallGraph::Node _cal
 
 void FunctionCallGraphBuilder::functionReferenced(CallableDeclaration const& _callable, bool _calledDirectly)
 {
-	if (_calledDirectly)
-	{
-		solAssert(
-			std::holds_alternative<CallGraph::SpecialNode>(m_currentNode) || m_graph.edges.count(m_currentNode) > 0,
-			"Adding an edge from a node that has not been visited yet."
-		);
+	apply(FunctionReference{&_callable, _calledDirectly});
+}
 
-		add(m_currentNode, &_callable);
-	}
-	else
-		add(CallGraph::SpecialNode::InternalDispatch, &_callable);
+void FunctionCallGraphBuilder::apply(VisitEffect const& _effect)
+{
+	if (m_currentEffects)
+		m_currentEffects->emplace_back(_effect);
+
+	std::visit(GenericVisitor{
+		[&](FunctionReference const& _reference) {
+			if (_reference.calledDirectly)
+			{
+				solAssert(
+					std::holds_alternative<CallGraph::SpecialNode>(m_currentNode) || m_graph.edges.count(m_currentNode) > 0,
+					"Adding an edge from a node that has not been visited yet."
+				);
 
-	enqueueCallable(_callable);
+				add(m_currentNode, _reference.callable);
+			}
+			else
+				add(CallGraph::SpecialNode::InternalDispatch, _reference.callable);
+
+			enqueueCallable(*_reference.callable);
+		},
+		[&](InternalDispatchCall) {
+			add(m_currentNode, CallGraph::SpecialNode::InternalDispatch);
+		},
+		[&](ErrorDefinition const* _error) {
+			m_graph.usedErrors.insert(_error);
+		},
+		[&](EventDefinition const* _event) {
+			m_graph.emittedEvents.insert(_event);
+		},
+		[&](BytecodeDependency const& _dependency) {
+			m_graph.bytecodeDependency.emplace(_dependency);
+		}
+	}, _effect);
 }
 
 std::ostream& solidity::frontend::operator<<(std::ostream& _out, CallGraph::Node const& _node)
@@ -23,7 +23,11 @@
 #include <libsolidity/ast/CallGraph.h>
 
 #include <deque>
+#include <map>
 #include <ostream>
+#include <utility>
+#include <variant>
+#include <vector>
 
 namespace solidity::frontend
 {
@@ -57,10 +61,33 @@ namespace solidity::frontend
 class FunctionCallGraphBuilder: private ASTConstVisitor
 {
 public:
-	static CallGraph buildCreationGraph(ContractDefinition const& _contract);
+	struct FunctionReference
+	{
+		CallableDeclaration const* callable = nullptr;
+		bool calledDirectly = true;
+	};
+	struct InternalDispatchCall {};
+	using BytecodeDependency = std::pair<ContractDefinition const*, ASTNode const*>;
+	/// A change to the graph caused by visiting the body of a callable.
+	using VisitEffect = std::variant<
+		FunctionReference,
+		InternalDispatchCall,
+		ErrorDefinition const*,
+		EventDefinition const*,
+		BytecodeDependency
+	>;
+	/// The effects of visiting each callable, in the order in which they occurred.
+	/// Visiting a callable has the same effects in the creation and the deployed graph of a
+	/// contract, so the effects recorded for one graph can be replayed for the other.
+	using VisitEffects = std::map<CallableDeclaration const*, std::vector<VisitEffect>>;
+
+	/// @param o_visitEffects if not null, the effects of visiting the callables are stored there.
+	static CallGraph buildCreationGraph(ContractDefinition const& _contract, VisitEffects* o_visitEffects = nullptr);
+	/// @param _visitEffects if not null, callables with recorded effects are not visited again.
 	static CallGraph buildDeployedGraph(
 		ContractDefinition const& _contract,
-		CallGraph const& _creationGraph
+		CallGraph const& _creationGraph,
+		VisitEffects const* _visitEffects = nullptr
 	);
 
 private:
@@ -82,11 +109,18 @@ private:
 
 	void add(CallGraph::Node _caller, CallGraph::Node _callee);
 	void functionReferenced(CallableDeclaration const& _callable, bool _calledDirectly = true);
+	/// Applies @a _effect to the graph and records it for the callable currently being visited.
+	void apply(VisitEffect const& _effect);
 
 	CallGraph::Node m_currentNode = CallGraph::SpecialNode::Entry;
 	ContractDefinition const& m_contract;
 	CallGraph m_graph;
 	std::deque<CallableDeclaration const*> m_visitQueue;
+	/// Effects of callables visited while building another graph of the same contract.
+	VisitEffects const* m_recordedEffects = nullptr;
+	/// Where to record the effects of the visited callables, if anywhere.
+	VisitEffects* m_effectsToRecord = nullptr;
+	std::vector<VisitEffect>* m_currentEffects = nullptr;
 };
 
 std::ostream& operator<<(std::ostream& _out, CallGraph::Node const& _node);
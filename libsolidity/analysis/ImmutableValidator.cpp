@@ -18,28 +18,38 @@
 
 #include <libsolidity/analysis/ImmutableValidator.h>
 
-#include <range/v3/view/reverse.hpp>
-
 using namespace solidity::frontend;
 using namespace solidity::langutil;
 
 void ImmutableValidator::analyze()
 {
-	auto linearizedContracts = m_mostDerivedContract.annotation().linearizedBaseContracts | ranges::views::reverse;
+	// The checks do not depend on the most derived contract, so visiting the code
+	// of base contracts again would only report the same errors again.
+	// Apart from the functions and modifiers, this also visits the inheritance specifiers
+	// and state variable initializers, in order to record all assignments to immutables.
+	m_contract.accept(*this);
+}
+
+bool ImmutableValidator::visit(FunctionDefinition const& _functionDefinition)
+{
+	m_inCreationContext = _functionDefinition.isConstructor();
+	return true;
+}
 
-	for (ContractDefinition const* contract: linearizedContracts)
-	{
-		for (FunctionDefinition const* function: contract->definedFunctions())
-			function->accept(*this);
+void ImmutableValidator::endVisit(FunctionDefinition const&)
+{
+	m_inCreationContext = true;
+}
 
-		for (ModifierDefinition const* modifier: contract->functionModifiers())
-			modifier->accept(*this);
-	}
+bool ImmutableValidator::visit(ModifierDefinition const&)
+{
+	m_inCreationContext = false;
+	return true;
 }
 
-bool ImmutableValidator::visit(FunctionDefinition const& _functionDefinition)
+void ImmutableValidator::endVisit(ModifierDefinition const&)
 {
-	return !_functionDefinition.isConstructor();
+	m_inCreationContext = true;
 }
 
 void ImmutableValidator::endVisit(MemberAccess const& _memberAccess)
@@ -59,7 +69,11 @@ void ImmutableValidator::analyseVariableReference(Declaration const* _reference,
 		return;
 
 	// If this is not an ordinary assignment, we write and read at the same time.
-	if (_expression.annotation().willBeWrittenTo)
+	if (!_expression.annotation().willBeWrittenTo)
+		return;
+
+	variable->annotation().assigned = true;
+	if (!m_inCreationContext)
 		m_errorReporter.typeError(
 			1581_error,
 			_expression.location(),
@@ -32,20 +32,28 @@ class ImmutableValidator: private ASTConstVisitor
 {
 public:
 	ImmutableValidator(langutil::ErrorReporter& _errorReporter, ContractDefinition const& _contractDefinition):
-		m_mostDerivedContract(_contractDefinition),
+		m_contract(_contractDefinition),
 		m_errorReporter(_errorReporter)
 	{ }
 
+	/// Analyzes the code defined in the contract itself, the code of
+	/// its base contracts has to be analyzed separately.
 	void analyze();
 
 private:
 	bool visit(FunctionDefinition const& _functionDefinition);
+	void endVisit(FunctionDefinition const& _functionDefinition);
+	bool visit(ModifierDefinition const& _modifierDefinition);
+	void endVisit(ModifierDefinition const& _modifierDefinition);
 	void endVisit(MemberAccess const& _memberAccess);
 	void endVisit(Identifier const& _identifier);
 
 	void analyseVariableReference(Declaration const* _variableReference, Expression const& _expression);
 
-	ContractDefinition const& m_mostDerivedContract;
+	ContractDefinition const& m_contract;
+	/// Whether the visited code is only executed during construction, i.e. it is not part
+	/// of a function or modifier other than the constructor.
+	bool m_inCreationContext = true;
 
 	langutil::ErrorReporter& m_errorReporter;
 };
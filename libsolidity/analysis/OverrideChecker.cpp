@@ -924,53 +924,49 @@ void OverrideChecker::checkOverrideList(OverrideProxy _item, OverrideProxyBySign
 
 OverrideChecker::OverrideProxyBySignatureMultiSet const& OverrideChecker::inheritedFunctions(ContractDefinition const& _contract) const
 {
-	if (!m_inheritedFunctions.count(&_contract))
-	{
-		OverrideProxyBySignatureMultiSet result;
+	if (auto it = m_inheritedFunctions.find(&_contract); it != m_inheritedFunctions.end())
+		return it->second;
 
-		for (auto const* base: resolveDirectBaseContracts(_contract))
-		{
-			std::set<OverrideProxy, OverrideProxy::CompareBySignature> functionsInBase;
-			for (FunctionDefinition const* fun: base->definedFunctions())
-				if (!fun->isConstructor())
-					functionsInBase.emplace(OverrideProxy{fun});
-			for (VariableDeclaration const* var: base->stateVariables())
-				if (var->isPublic())
-					functionsInBase.emplace(OverrideProxy{var});
-
-			result += functionsInBase;
-
-			for (OverrideProxy const& func: inheritedFunctions(*base))
-				if (!functionsInBase.count(func))
-					result.insert(func);
-		}
+	OverrideProxyBySignatureMultiSet result;
 
-		m_inheritedFunctions[&_contract] = result;
+	for (auto const* base: resolveDirectBaseContracts(_contract))
+	{
+		std::set<OverrideProxy, OverrideProxy::CompareBySignature> functionsInBase;
+		for (FunctionDefinition const* fun: base->definedFunctions())
+			if (!fun->isConstructor())
+				functionsInBase.emplace(OverrideProxy{fun});
+		for (VariableDeclaration const* var: base->stateVariables())
+			if (var->isPublic())
+				functionsInBase.emplace(OverrideProxy{var});
+
+		result += functionsInBase;
+
+		for (OverrideProxy const& func: inheritedFunctions(*base))
+			if (!functionsInBase.count(func))
+				result.insert(func);
 	}
 
-	return m_inheritedFunctions[&_contract];
+	return m_inheritedFunctions[&_contract] = std::move(result);
 }
 
 OverrideChecker::OverrideProxyBySignatureMultiSet const& OverrideChecker::inheritedModifiers(ContractDefinition const& _contract) const
 {
-	if (!m_inheritedModifiers.count(&_contract))
-	{
-		OverrideProxyBySignatureMultiSet result;
+	if (auto it = m_inheritedModifiers.find(&_contract); it != m_inheritedModifiers.end())
+		return it->second;
 
-		for (auto const* base: resolveDirectBaseContracts(_contract))
-		{
-			std::set<OverrideProxy, OverrideProxy::CompareBySignature> modifiersInBase;
-			for (ModifierDefinition const* mod: base->functionModifiers())
-				modifiersInBase.emplace(OverrideProxy{mod});
+	OverrideProxyBySignatureMultiSet result;
 
-			for (OverrideProxy const& mod: inheritedModifiers(*base))
-				modifiersInBase.insert(mod);
+	for (auto const* base: resolveDirectBaseContracts(_contract))
+	{
+		std::set<OverrideProxy, OverrideProxy::CompareBySignature> modifiersInBase;
+		for (ModifierDefinition const* mod: base->functionModifiers())
+			modifiersInBase.emplace(OverrideProxy{mod});
 
-			result += modifiersInBase;
-		}
+		for (OverrideProxy const& mod: inheritedModifiers(*base))
+			modifiersInBase.insert(mod);
 
-		m_inheritedModifiers[&_contract] = result;
+		result += modifiersInBase;
 	}
 
-	return m_inheritedModifiers[&_contract];
+	return m_inheritedModifiers[&_contract] = std::move(result);
 }
@@ -525,28 +525,38 @@ struct SimpleCounterForLoopChecker: public PostTypeChecker::Checker
 	bool isSimpleCounterLoop(ForStatement const& _forStatement) const
 	{
 		auto const* simpleCondition = dynamic_cast<BinaryOperation const*>(_forStatement.condition());
-		if (!simpleCondition || simpleCondition->getOperator() != Token::LessThan || simpleCondition->userDefinedFunctionType())
+		if (!simpleCondition || simpleCondition->userDefinedFunctionType())
+			return false;
+		// This matches both conditions i < n and n > i
+		Expression const* counter = nullptr;
+		Expression const* bound = nullptr;
+		if (simpleCondition->getOperator() == Token::LessThan)
+		{
+			counter = &simpleCondition->leftExpression();
+			bound = &simpleCondition->rightExpression();
+		}
+		else if (simpleCondition->getOperator() == Token::GreaterThan)
+		{
+			counter = &simpleCondition->rightExpression();
+			bound = &simpleCondition->leftExpression();
+		}
+		else
 			return false;
 		if (!_forStatement.loopExpression())
 			return false;
 
-		auto const* simplePostExpression = dynamic_cast<UnaryOperation const*>(&_forStatement.loopExpression()->expression());
-		// This matches both operators ++i and i++
-		if (!simplePostExpression || simplePostExpression->getOperator() != Token::Inc || simplePostExpression->userDefinedFunctionType())
+		Identifier const* incExpressionIdentifier = incrementedIdentifier(_forStatement.loopExpression()->expression());
+		if (!incExpressionIdentifier)
 			return false;
 
-		auto const* lhsIdentifier = dynamic_cast<Identifier const*>(&simpleCondition->leftExpression());
-		auto const* lhsIntegerType = dynamic_cast<IntegerType const*>(simpleCondition->leftExpression().annotation().type);
+		auto const* lhsIdentifier = dynamic_cast<Identifier const*>(counter);
+		auto const* lhsIntegerType = dynamic_cast<IntegerType const*>(counter->annotation().type);
 		auto const* commonIntegerType = dynamic_cast<IntegerType const*>(simpleCondition->annotation().commonType);
 
 		if (!lhsIdentifier || !lhsIntegerType || !commonIntegerType || *lhsIntegerType != *commonIntegerType)
 			return false;
 
-		auto const* incExpressionIdentifier = dynamic_cast<Identifier const*>(&simplePostExpression->subExpression());
-		if (
-			!incExpressionIdentifier ||
-			incExpressionIdentifier->annotation().referencedDeclaration != lhsIdentifier->annotation().referencedDeclaration
-		)
+		if (incExpressionIdentifier->annotation().referencedDeclaration != lhsIdentifier->annotation().referencedDeclaration)
 			return false;
 
 		solAssert(incExpressionIdentifier->annotation().referencedDeclaration);
@@ -561,12 +571,54 @@ struct SimpleCounterForLoopChecker: public PostTypeChecker::Checker
 
 		solAssert(lhsIdentifier);
 		LValueChecker lValueChecker{*lhsIdentifier};
-		simpleCondition->rightExpression().accept(lValueChecker);
+		bound->accept(lValueChecker);
 		if (!lValueChecker.willBeWrittenTo())
 			_forStatement.body().accept(lValueChecker);
 
 		return !lValueChecker.willBeWrittenTo();
 	}
+
+	/// @returns the identifier incremented by one in @a _expression if it is of the form
+	/// ++i, i++, i += 1 or i = i + 1.
+	static Identifier const* incrementedIdentifier(Expression const& _expression)
+	{
+		if (auto const* unaryOperation = dynamic_cast<UnaryOperation const*>(&_expression))
+		{
+			// This matches both operators ++i and i++
+			if (unaryOperation->getOperator() != Token::Inc || unaryOperation->userDefinedFunctionType())
+				return nullptr;
+			return dynamic_cast<Identifier const*>(&unaryOperation->subExpression());
+		}
+
+		auto const* assignment = dynamic_cast<Assignment const*>(&_expression);
+		if (!assignment)
+			return nullptr;
+		auto const* assigned = dynamic_cast<Identifier const*>(&assignment->leftHandSide());
+		if (!assigned)
+			return nullptr;
+		if (assignment->assignmentOperator() == Token::AssignAdd)
+			return isOne(assignment->rightHandSide()) ? assigned : nullptr;
+		if (assignment->assignmentOperator() != Token::Assign)
+			return nullptr;
+
+		auto const* addition = dynamic_cast<BinaryOperation const*>(&assignment->rightHandSide());
+		if (!addition || addition->getOperator() != Token::Add || addition->userDefinedFunctionType())
+			return nullptr;
+		auto const* summand = dynamic_cast<Identifier const*>(&addition->leftExpression());
+		if (
+			!summand ||
+			summand->annotation().referencedDeclaration != assigned->annotation().referencedDeclaration ||
+			!isOne(addition->rightExpression())
+		)
+			return nullptr;
+		return assigned;
+	}
+
+	static bool isOne(Expression const& _expression)
+	{
+		auto const* rationalType = dynamic_cast<RationalNumberType const*>(_expression.annotation().type);
+		return rationalType && rationalType->value() == 1;
+	}
 };
 
 }
@@ -317,7 +317,7 @@ uint32_t ContractDefinition::interfaceId() const
 
 Type const* ContractDefinition::type() const
 {
-	return TypeProvider::typeType(TypeProvider::contract(*this));
+	return m_type.init([&]{ return TypeProvider::typeType(TypeProvider::contract(*this)); });
 }
 
 ContractDefinitionAnnotation& ContractDefinition::annotation() const
@@ -375,7 +375,7 @@ TypeNameAnnotation& TypeName::annotation() const
 Type const* UserDefinedValueTypeDefinition::type() const
 {
 	solAssert(m_underlyingType->annotation().type, "");
-	return TypeProvider::typeType(TypeProvider::userDefinedValueType(*this));
+	return m_type.init([&]{ return TypeProvider::typeType(TypeProvider::userDefinedValueType(*this)); });
 }
 
 TypeDeclarationAnnotation& UserDefinedValueTypeDefinition::annotation() const
@@ -391,7 +391,7 @@ std::vector<std::pair<ASTPointer<IdentifierPath>, std::optional<Token>>> UsingFo
 Type const* StructDefinition::type() const
 {
 	solAssert(annotation().recursive.has_value(), "Requested struct type before DeclarationTypeChecker.");
-	return TypeProvider::typeType(TypeProvider::structType(*this, DataLocation::Storage));
+	return m_type.init([&]{ return TypeProvider::typeType(TypeProvider::structType(*this, DataLocation::Storage)); });
 }
 
 StructDeclarationAnnotation& StructDefinition::annotation() const
@@ -403,12 +403,12 @@ Type const* EnumValue::type() const
 {
 	auto parentDef = dynamic_cast<EnumDefinition const*>(scope());
 	solAssert(parentDef, "Enclosing Scope of EnumValue was not set");
-	return TypeProvider::enumType(*parentDef);
+	return dynamic_cast<TypeType const&>(*parentDef->type()).actualType();
 }
 
 Type const* EnumDefinition::type() const
 {
-	return TypeProvider::typeType(TypeProvider::enumType(*this));
+	return m_type.init([&]{ return TypeProvider::typeType(TypeProvider::enumType(*this)); });
 }
 
 TypeDeclarationAnnotation& EnumDefinition::annotation() const
@@ -514,6 +514,11 @@ FunctionDefinition const& FunctionDefinition::resolveVirtual(
 	solAssert(isOrdinary(), "");
 	solAssert(!libraryFunction(), "");
 
+	auto& resolutions = annotation().virtualResolutions;
+	auto const key = std::make_pair(&_mostDerivedContract, _searchStart);
+	if (auto it = resolutions.find(key); it != resolutions.end())
+		return *it->second;
+
 	// We actually do not want the externally callable function here.
 	// This is just to add an assertion since the comparison used to be less strict.
 	FunctionType const* externalFunctionType = TypeProvider::function(*this)->asExternallyCallableFunction(false);
@@ -535,6 +540,7 @@ FunctionDefinition const& FunctionDefinition::resolveVirtual(
 			)
 			{
 				solAssert(FunctionType(*function).hasEqualParameterTypes(*TypeProvider::function(*this)));
+				resolutions[key] = function;
 				return *function;
 			}
 	}
@@ -567,10 +573,17 @@ ModifierDefinition const& ModifierDefinition::resolveVirtual(
 
 	solAssert(!dynamic_cast<ContractDefinition const&>(*scope()).isLibrary(), "");
 
+	auto& resolutions = annotation().virtualResolutions;
+	if (auto it = resolutions.find(&_mostDerivedContract); it != resolutions.end())
+		return *it->second;
+
 	for (ContractDefinition const* c: _mostDerivedContract.annotation().linearizedBaseContracts)
 		for (ModifierDefinition const* modifier: c->functionModifiers())
 			if (modifier->name() == name())
+			{
+				resolutions[&_mostDerivedContract] = modifier;
 				return *modifier;
+			}
 
 	solAssert(false, "Virtual modifier " + name() + " not found.");
 	return *this; // not reached
@@ -816,7 +829,9 @@ std::set<VariableDeclaration::Location> VariableDeclaration::allowedDataLocation
 {
 	using Location = VariableDeclaration::Location;
 
-	if (!hasReferenceOrMappingType() || isStateVariable() || isEventOrErrorParameter())
+	if (isStateVariable())
+		return std::set<Location>{ Location::Unspecified, Location::Transient };
+	else if (!hasReferenceOrMappingType() || isEventOrErrorParameter())
 		return std::set<Location>{ Location::Unspecified };
 	else if (isCallableOrCatchParameter())
 	{
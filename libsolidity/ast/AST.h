@@ -595,6 +595,8 @@ private:
 	util::LazyInit<std::vector<std::pair<util::FixedHash<4>, FunctionTypePointer>>> m_interfaceFunctionList[2];
 	util::LazyInit<std::vector<EventDefinition const*>> m_interfaceEvents;
 	util::LazyInit<std::multimap<std::string, FunctionDefinition const*>> m_definedFunctionsByName;
+	/// The type is created only once, so that all references to the contract share its member lists.
+	util::LazyInit<Type const*> m_type;
 };
 
 /**
@@ -755,6 +757,7 @@ public:
 
 private:
 	std::vector<ASTPointer<VariableDeclaration>> m_members;
+	util::LazyInit<Type const*> m_type;
 };
 
 class EnumDefinition: public Declaration, public StructurallyDocumented, public ScopeOpener
@@ -787,6 +790,7 @@ public:
 
 private:
 	std::vector<ASTPointer<EnumValue>> m_members;
+	util::LazyInit<Type const*> m_type;
 };
 
 /**
@@ -836,6 +840,7 @@ public:
 private:
 	/// The name of the underlying type
 	ASTPointer<TypeName> m_underlyingType;
+	util::LazyInit<Type const*> m_type;
 };
 
 /**
@@ -1052,7 +1057,7 @@ private:
 class VariableDeclaration: public Declaration, public StructurallyDocumented
 {
 public:
-	enum Location { Unspecified, Storage, Memory, CallData };
+	enum Location { Unspecified, Storage, Memory, CallData, Transient };
 	enum class Mutability { Mutable, Immutable, Constant };
 	static std::string mutabilityToString(Mutability _mutability)
 	{
@@ -1141,6 +1146,8 @@ public:
 	bool immutable() const { return m_mutability == Mutability::Immutable; }
 	ASTPointer<OverrideSpecifier> const& overrides() const { return m_overrides; }
 	Location referenceLocation() const { return m_location; }
+	/// @returns true if this is a state variable stored in transient storage.
+	bool isTransient() const { return m_location == Location::Transient; }
 	/// @returns a set of allowed storage locations for the variable.
 	std::set<Location> allowedDataLocations() const;
 
@@ -1168,7 +1175,8 @@ private:
 	/// Whether the variable is "constant", "immutable" or non-marked (mutable).
 	Mutability m_mutability = Mutability::Mutable;
 	ASTPointer<OverrideSpecifier> m_overrides; ///< Contains the override specifier node
-	Location m_location = Location::Unspecified; ///< Location of the variable if it is of reference type.
+	/// Location of the variable if it is of reference type or transient if it is a state variable in transient storage.
+	Location m_location = Location::Unspecified;
 	ASTPointer<Expression> m_typeExpression;
 };
 
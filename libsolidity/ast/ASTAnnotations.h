@@ -181,6 +181,14 @@ struct CallableDeclarationAnnotation: DeclarationAnnotation
 
 struct FunctionDefinitionAnnotation: CallableDeclarationAnnotation, StructurallyDocumentedAnnotation
 {
+	/// Results of FunctionDefinition::resolveVirtual, keyed by the most derived contract and
+	/// the contract the search starts at (null for virtual lookup).
+	/// Filled in on demand, the code generators resolve the same functions over and over again.
+	std::map<std::pair<ContractDefinition const*, ContractDefinition const*>, FunctionDefinition const*> virtualResolutions;
+	/// Contracts in the context of which no path through the function returns to the caller,
+	/// as found by the ControlFlowRevertPruner. These are the most derived contract for functions
+	/// of contracts, the library for library functions and nullptr for free functions.
+	std::set<ContractDefinition const*> nonReturningIn;
 };
 
 struct EventDefinitionAnnotation: CallableDeclarationAnnotation, StructurallyDocumentedAnnotation
@@ -194,6 +202,8 @@ struct ErrorDefinitionAnnotation: CallableDeclarationAnnotation, StructurallyDoc
 
 struct ModifierDefinitionAnnotation: CallableDeclarationAnnotation, StructurallyDocumentedAnnotation
 {
+	/// Results of ModifierDefinition::resolveVirtual, keyed by the most derived contract.
+	std::map<ContractDefinition const*, ModifierDefinition const*> virtualResolutions;
 };
 
 struct VariableDeclarationAnnotation: DeclarationAnnotation, StructurallyDocumentedAnnotation
@@ -202,6 +212,9 @@ struct VariableDeclarationAnnotation: DeclarationAnnotation, StructurallyDocumen
 	Type const* type = nullptr;
 	/// The set of functions this (public state) variable overrides.
 	std::set<CallableDeclaration const*> baseFunctions;
+	/// Whether this immutable state variable is assigned to anywhere in the code, i.e. it
+	/// can have a value different from its initial value. Set by the ImmutableValidator.
+	bool assigned = false;
 };
 
 struct StatementAnnotation: ASTAnnotation
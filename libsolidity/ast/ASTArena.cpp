@@ -0,0 +1,42 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <libsolidity/ast/ASTArena.h>
+
+#include <liblangutil/Exceptions.h>
+
+#include <algorithm>
+
+using namespace solidity::frontend;
+
+void* ASTArena::allocate(size_t _size, size_t _alignment)
+{
+	void* position = m_position;
+	if (!position || !std::align(_alignment, _size, position, m_available))
+	{
+		// Objects larger than a block get a block of their own.
+		size_t const blockSize = std::max(c_blockSize, _size + _alignment);
+		m_blocks.emplace_back(new char[blockSize]);
+		position = m_blocks.back().get();
+		m_available = blockSize;
+		solAssert(std::align(_alignment, _size, position, m_available));
+	}
+	m_position = static_cast<char*>(position) + _size;
+	m_available -= _size;
+	return position;
+}
@@ -0,0 +1,92 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Memory arena for the AST nodes of a source unit.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace solidity::frontend
+{
+
+/**
+ * Bump allocator for the AST nodes of one source unit.
+ *
+ * Nodes are allocated together with their reference count from large blocks. Destroying a node
+ * runs its destructor but does not release its memory, all blocks are released at once when
+ * the last node created from the arena is destroyed.
+ *
+ * The arena is not thread-safe and is meant to be filled by a single parser or importer.
+ */
+class ASTArena: public std::enable_shared_from_this<ASTArena>
+{
+public:
+	/// @returns a new arena. Arenas can only be created as shared pointers since the nodes keep them alive.
+	static std::shared_ptr<ASTArena> create() { return std::shared_ptr<ASTArena>(new ASTArena()); }
+
+	ASTArena(ASTArena const&) = delete;
+	ASTArena& operator=(ASTArena const&) = delete;
+
+	/// Creates a shared pointer to a new @a T whose memory is taken from the arena.
+	template <typename T, typename... Args>
+	std::shared_ptr<T> make(Args&&... _args)
+	{
+		return std::allocate_shared<T>(Allocator<T>{shared_from_this()}, std::forward<Args>(_args)...);
+	}
+
+private:
+	/// Standard allocator handing out memory of an arena. It holds a reference
+	/// to the arena, so that the arena outlives all control blocks using it.
+	template <typename T>
+	struct Allocator
+	{
+		using value_type = T;
+
+		explicit Allocator(std::shared_ptr<ASTArena> _arena): arena(std::move(_arena)) {}
+		template <typename U>
+		Allocator(Allocator<U> const& _other): arena(_other.arena) {}
+
+		T* allocate(size_t _count) { return static_cast<T*>(arena->allocate(_count * sizeof(T), alignof(T))); }
+		void deallocate(T*, size_t) noexcept {}
+
+		template <typename U>
+		bool operator==(Allocator<U> const& _other) const { return arena == _other.arena; }
+		template <typename U>
+		bool operator!=(Allocator<U> const& _other) const { return arena != _other.arena; }
+
+		std::shared_ptr<ASTArena> arena;
+	};
+
+	ASTArena() = default;
+
+	void* allocate(size_t _size, size_t _alignment);
+
+	static size_t constexpr c_blockSize = 64 * 1024;
+
+	std::vector<std::unique_ptr<char[]>> m_blocks;
+	/// Start and size of the unused part of the last block.
+	void* m_position = nullptr;
+	size_t m_available = 0;
+};
+
+}
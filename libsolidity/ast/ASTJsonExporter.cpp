@@ -51,6 +51,18 @@ using namespace solidity;
 namespace
 {
 
+/// Creates a list of attributes from pairs of names and values. In contrast to a braced
+/// initializer list, the values (which include the complete JSON of child nodes) are moved
+/// into the list instead of being copied.
+template<typename... Attributes>
+std::vector<std::pair<std::string, Json>> attributeList(Attributes&&... _attributes)
+{
+	std::vector<std::pair<std::string, Json>> attributes;
+	attributes.reserve(sizeof...(_attributes));
+	(attributes.emplace_back(std::forward<Attributes>(_attributes)), ...);
+	return attributes;
+}
+
 template<typename V, template<typename> typename C>
 void addIfSet(std::vector<std::pair<std::string, Json>>& _attributes, std::string const& _name, C<V> const& _value)
 {
@@ -168,10 +180,10 @@ void ASTJsonExporter::appendExpressionAttributes(
 	ExpressionAnnotation const& _annotation
 )
 {
-	std::vector<std::pair<std::string, Json>> exprAttributes = {
+	std::vector<std::pair<std::string, Json>> exprAttributes = attributeList(
 		std::make_pair("typeDescriptions", typePointerToJson(_annotation.type)),
 		std::make_pair("argumentTypes", typePointerToJson(_annotation.arguments))
-	};
+	);
 
 	addIfSet(exprAttributes, "isLValue", _annotation.isLValue);
 	addIfSet(exprAttributes, "isPure", _annotation.isPure);
@@ -180,7 +192,7 @@ void ASTJsonExporter::appendExpressionAttributes(
 	if (m_stackState > CompilerStack::State::ParsedAndImported)
 		exprAttributes.emplace_back("lValueRequested", _annotation.willBeWrittenTo);
 
-	_attributes += exprAttributes;
+	_attributes += std::move(exprAttributes);
 }
 
 Json ASTJsonExporter::inlineAssemblyIdentifierToJson(std::pair<yul::Identifier const*, InlineAssemblyAnnotation::ExternalIdentifierInfo> _info) const
@@ -206,16 +218,24 @@ void ASTJsonExporter::print(std::ostream& _stream, ASTNode const& _node, util::J
 
 Json ASTJsonExporter::toJson(ASTNode const& _node)
 {
-	_node.accept(*this);
-	return util::removeNullMembers(std::move(m_currentValue));
+	bool const outermost = m_nodeDepth == 0;
+	{
+		++m_nodeDepth;
+		ScopeGuard depthGuard([&]() { --m_nodeDepth; });
+		_node.accept(*this);
+	}
+	// Null members are removed recursively, so this is only needed for the outermost node.
+	if (outermost)
+		return util::removeNullMembers(std::move(m_currentValue));
+	return std::move(m_currentValue);
 }
 
 bool ASTJsonExporter::visit(SourceUnit const& _node)
 {
-	std::vector<std::pair<std::string, Json>> attributes = {
+	std::vector<std::pair<std::string, Json>> attributes = attributeList(
 		std::make_pair("license", _node.licenseString() ? Json(*_node.licenseString()) : Json()),
-		std::make_pair("nodes", toJson(_node.nodes())),
-	};
+		std::make_pair("nodes", toJson(_node.nodes()))
+	);
 
 	if (_node.experimentalSolidity())
 		attributes.emplace_back("experimentalSolidity", Json(_node.experimentalSolidity()));
@@ -230,7 +250,7 @@ bool ASTJsonExporter::visit(SourceUnit const& _node)
 				exportedSymbols[sym.first].emplace_back(nodeId(*overload));
 		}
 
-		attributes.emplace_back("exportedSymbols", exportedSymbols);
+		attributes.emplace_back("exportedSymbols", std::move(exportedSymbols));
 	};
 
 	addIfSet(attributes, "absolutePath", _node.annotation().path);
@@ -245,19 +265,19 @@ bool ASTJsonExporter::visit(PragmaDirective const& _node)
 	Json literals = Json::array();
 	for (auto const& literal: _node.literals())
 		literals.emplace_back(literal);
-	setJsonNode(_node, "PragmaDirective", {
+	setJsonNode(_node, "PragmaDirective", attributeList(
 		std::make_pair("literals", std::move(literals))
-	});
+	));
 	return false;
 }
 
 bool ASTJsonExporter::visit(ImportDirective const& _node)
 {
-	std::vector<std::pair<std::string, Json>> attributes = {
+	std::vector<std::pair<std::string, Json>> attributes = attributeList(
 		std::make_pair("file", _node.path()),
 		std::make_pair("sourceUnit", idOrNull(_node.annotation().sourceUnit)),
 		std::make_pair("scope", idOrNull(_node.scope()))
-	};
+	);
 
 	addIfSet(attributes, "absolutePath", _node.annotation().absolutePath);
 
@@ -272,7 +292,7 @@ bool ASTJsonExporter::visit(ImportDirective const& _node)
 		tuple["foreign"] = toJson(*symbolAlias.symbol);
 		tuple["local"] =  symbolAlias.alias ? Json(*symbolAlias.alias) : Json();
 		tuple["nameLocation"] = sourceLocationToString(_node.nameLocation());
-		symbolAliases.emplace_back(tuple);
+		symbolAliases.emplace_back(std::move(tuple));
 	}
 	attributes.emplace_back("symbolAliases", std::move(symbolAliases));
 	setJsonNode(_node, "ImportDirective", std::move(attributes));
@@ -281,7 +301,7 @@ bool ASTJsonExporter::visit(ImportDirective const& _node)
 
 bool ASTJsonExporter::visit(ContractDefinition const& _node)
 {
-	std::vector<std::pair<std::string, Json>> attributes = {
+	std::vector<std::pair<std::string, Json>> attributes = attributeList(
 		std::make_pair("name", _node.name()),
 		std::make_pair("nameLocation", sourceLocationToString(_node.nameLocation())),
 		std::make_pair("documentation", _node.documentation() ? toJson(*_node.documentation()) : Json()),
@@ -294,7 +314,7 @@ bool ASTJsonExporter::visit(ContractDefinition const& _node)
 		std::make_pair("usedErrors", getContainerIds(_node.interfaceErrors(false))),
 		std::make_pair("nodes", toJson(_node.subNodes())),
 		std::make_pair("scope", idOrNull(_node.scope()))
-	};
+	);
 	addIfSet(attributes, "canonicalName", _node.annotation().canonicalName);
 
 	if (_node.annotation().unimplementedDeclarations.has_value())
@@ -321,28 +341,28 @@ bool ASTJsonExporter::visit(IdentifierPath const& _node)
 	for (SourceLocation location: _node.pathLocations())
 		nameLocations.emplace_back(sourceLocationToString(location));
 
-	setJsonNode(_node, "IdentifierPath", {
+	setJsonNode(_node, "IdentifierPath", attributeList(
 		std::make_pair("name", namePathToString(_node.path())),
-		std::make_pair("nameLocations", nameLocations),
+		std::make_pair("nameLocations", std::move(nameLocations)),
 		std::make_pair("referencedDeclaration", idOrNull(_node.annotation().referencedDeclaration))
-	});
+	));
 	return false;
 }
 
 bool ASTJsonExporter::visit(InheritanceSpecifier const& _node)
 {
-	setJsonNode(_node, "InheritanceSpecifier", {
+	setJsonNode(_node, "InheritanceSpecifier", attributeList(
 		std::make_pair("baseName", toJson(_node.name())),
 		std::make_pair("arguments", _node.arguments() ? toJson(*_node.arguments()) : Json())
-	});
+	));
 	return false;
 }
 
 bool ASTJsonExporter::visit(UsingForDirective const& _node)
 {
-	std::vector<std::pair<std::string, Json>> attributes = {
+	std::vector<std::pair<std::string, Json>> attributes = attributeList(
 		std::make_pair("typeName", _node.typeName() ? toJson(*_node.typeName()) : Json())
-	};
+	);
 
 	if (_node.usesBraces())
 	{
@@ -377,14 +397,14 @@ bool ASTJsonExporter::visit(UsingForDirective const& _node)
 
 bool ASTJsonExporter::visit(StructDefinition const& _node)
 {
-	std::vector<std::pair<std::string, Json>> attributes = {
+	std::vector<std::pair<std::string, Json>> attributes = attributeList(
 		std::make_pair("name", _node.name()),
 		std::make_pair("nameLocation", sourceLocationToString(_node.nameLocation())),
 		std::make_pair("documentation", _node.documentation() ? toJson(*_node.documentation()) : Json()),
 		std::make_pair("visibility", Declaration::visibilityToString(_node.visibility())),
 		std::make_pair("members", toJson(_node.members())),
 		std::make_pair("scope", idOrNull(_node.scope()))
-	};
+	);
 
 	addIfSet(attributes,"canonicalName", _node.annotation().canonicalName);
 
@@ -395,12 +415,12 @@ bool ASTJsonExporter::visit(StructDefinition const& _node)
 
 bool ASTJsonExporter::visit(EnumDefinition const& _node)
 {
-	std::vector<std::pair<std::string, Json>> attributes = {
+	std::vector<std::pair<std::string, Json>> attributes = attributeList(
 		std::make_pair("name", _node.name()),
 		std::make_pair("nameLocation", sourceLocationToString(_node.nameLocation())),
 		std::make_pair("documentation", _node.documentation() ? toJson(*_node.documentation()) : Json()),
 		std::make_pair("members", toJson(_node.members()))
-	};
+	);
 
 	addIfSet(attributes,"canonicalName", _node.annotation().canonicalName);
 
@@ -411,21 +431,21 @@ bool ASTJsonExporter::visit(EnumDefinition const& _node)
 
 bool ASTJsonExporter::visit(EnumValue const& _node)
 {
-	setJsonNode(_node, "EnumValue", {
+	setJsonNode(_node, "EnumValue", attributeList(
 		std::make_pair("name", _node.name()),
-		std::make_pair("nameLocation", sourceLocationToString(_node.nameLocation())),
-	});
+		std::make_pair("nameLocation", sourceLocationToString(_node.nameLocation()))
+	));
 	return false;
 }
 
 bool ASTJsonExporter::visit(UserDefinedValueTypeDefinition const& _node)
 {
 	solAssert(_node.underlyingType(), "");
-	std::vector<std::pair<std::string, Json>> attributes = {
+	std::vector<std::pair<std::string, Json>> attributes = attributeList(
 		std::make_pair("name", _node.name()),
 		std::make_pair("nameLocation", sourceLocationToString(_node.nameLocation())),
 		std::make_pair("underlyingType", toJson(*_node.underlyingType()))
-	};
+	);
 	addIfSet(attributes, "canonicalName", _node.annotation().canonicalName);
 
 	setJsonNode(_node, "UserDefinedValueTypeDefinition", std::move(attributes));
@@ -435,23 +455,23 @@ bool ASTJsonExporter::visit(UserDefinedValueTypeDefinition const& _node)
 
 bool ASTJsonExporter::visit(ParameterList const& _node)
 {
-	setJsonNode(_node, "ParameterList", {
+	setJsonNode(_node, "ParameterList", attributeList(
 		std::make_pair("parameters", toJson(_node.parameters()))
-	});
+	));
 	return false;
 }
 
 bool ASTJsonExporter::visit(OverrideSpecifier const& _node)
 {
-	setJsonNode(_node, "OverrideSpecifier", {
+	setJsonNode(_node, "OverrideSpecifier", attributeList(
 		std::make_pair("overrides", toJson(_node.overrides()))
-	});
+	));
 	return false;
 }
 
 bool ASTJsonExporter::visit(FunctionDefinition const& _node)
 {
-	std::vector<std::pair<std::string, Json>> attributes = {
+	std::vector<std::pair<std::string, Json>> attributes = attributeList(
 		std::make_pair("name", _node.name()),
 		std::make_pair("nameLocation", sourceLocationToString(_node.nameLocation())),
 		std::make_pair("documentation", _node.documentation() ? toJson(*_node.documentation()) : Json()),
@@ -465,7 +485,7 @@ bool ASTJsonExporter::visit(FunctionDefinition const& _node)
 		std::make_pair("body", _node.isImplemented() ? toJson(_node.body()) : Json()),
 		std::make_pair("implemented", _node.isImplemented()),
 		std::make_pair("scope", idOrNull(_node.scope()))
-	};
+	);
 
 	std::optional<Visibility> visibility;
 	if (_node.isConstructor())
@@ -490,7 +510,7 @@ bool ASTJsonExporter::visit(FunctionDefinition const& _node)
 
 bool ASTJsonExporter::visit(VariableDeclaration const& _node)
 {
-	std::vector<std::pair<std::string, Json>> attributes = {
+	std::vector<std::pair<std::string, Json>> attributes = attributeList(
 		std::make_pair("name", _node.name()),
 		std::make_pair("nameLocation", sourceLocationToString(_node.nameLocation())),
 		std::make_pair("typeName", toJson(_node.typeName())),
@@ -503,7 +523,7 @@ bool ASTJsonExporter::visit(VariableDeclaration const& _node)
 		std::make_pair("value", _node.value() ? toJson(*_node.value()) : Json()),
 		std::make_pair("scope", idOrNull(_node.scope())),
 		std::make_pair("typeDescriptions", typePointerToJson(_node.annotation().type, true))
-	};
+	);
 	if (_node.isStateVariable() && _node.isPublic())
 		attributes.emplace_back("functionSelector", _node.externalIdentifierHex());
 	if (_node.isStateVariable() && _node.documentation())
@@ -518,7 +538,7 @@ bool ASTJsonExporter::visit(VariableDeclaration const& _node)
 
 bool ASTJsonExporter::visit(ModifierDefinition const& _node)
 {
-	std::vector<std::pair<std::string, Json>> attributes = {
+	std::vector<std::pair<std::string, Json>> attributes = attributeList(
 		std::make_pair("name", _node.name()),
 		std::make_pair("nameLocation", sourceLocationToString(_node.nameLocation())),
 		std::make_pair("documentation", _node.documentation() ? toJson(*_node.documentation()) : Json()),
@@ -527,7 +547,7 @@ bool ASTJsonExporter::visit(ModifierDefinition const& _node)
 		std::make_pair("virtual", _node.markedVirtual()),
 		std::make_pair("overrides", _node.overrides() ? toJson(*_node.overrides()) : Json()),
 		std::make_pair("body", _node.isImplemented() ? toJson(_node.body()) : Json())
-	};
+	);
 	if (!_node.annotation().baseFunctions.empty())
 		attributes.emplace_back(std::make_pair("baseModifiers", getContainerIds(_node.annotation().baseFunctions, true)));
 	setJsonNode(_node, "ModifierDefinition", std::move(attributes));
@@ -536,10 +556,10 @@ bool ASTJsonExporter::visit(ModifierDefinition const& _node)
 
 bool ASTJsonExporter::visit(ModifierInvocation const& _node)
 {
-	std::vector<std::pair<std::string, Json>> attributes{
+	std::vector<std::pair<std::string, Json>> attributes = attributeList(
 		std::make_pair("modifierName", toJson(_node.name())),
 		std::make_pair("arguments", _node.arguments() ? toJson(*_node.arguments()) : Json())
-	};
+	);
 	if (Declaration const* declaration = _node.name().annotation().referencedDeclaration)
 	{
 		if (dynamic_cast<ModifierDefinition const*>(declaration))
@@ -554,13 +574,13 @@ bool ASTJsonExporter::visit(ModifierInvocation const& _node)
 bool ASTJsonExporter::visit(EventDefinition const& _node)
 {
 	m_inEvent = true;
-	std::vector<std::pair<std::string, Json>> _attributes = {
+	std::vector<std::pair<std::string, Json>> _attributes = attributeList(
 		std::make_pair("name", _node.name()),
 		std::make_pair("nameLocation", sourceLocationToString(_node.nameLocation())),
 		std::make_pair("documentation", _node.documentation() ? toJson(*_node.documentation()) : Json()),
 		std::make_pair("parameters", toJson(_node.parameterList())),
 		std::make_pair("anonymous", _node.isAnonymous())
-	};
+	);
 	if (m_stackState >= CompilerStack::State::AnalysisSuccessful)
 			_attributes.emplace_back(
 				std::make_pair(
@@ -574,12 +594,12 @@ bool ASTJsonExporter::visit(EventDefinition const& _node)
 
 bool ASTJsonExporter::visit(ErrorDefinition const& _node)
 {
-	std::vector<std::pair<std::string, Json>> _attributes = {
+	std::vector<std::pair<std::string, Json>> _attributes = attributeList(
 		std::make_pair("name", _node.name()),
 		std::make_pair("nameLocation", sourceLocationToString(_node.nameLocation())),
 		std::make_pair("documentation", _node.documentation() ? toJson(*_node.documentation()) : Json()),
 		std::make_pair("parameters", toJson(_node.parameterList()))
-	};
+	);
 	if (m_stackState >= CompilerStack::State::AnalysisSuccessful)
 		_attributes.emplace_back(std::make_pair("errorSelector", _node.functionType(true)->externalIdentifierHex()));
 
@@ -589,10 +609,10 @@ bool ASTJsonExporter::visit(ErrorDefinition const& _node)
 
 bool ASTJsonExporter::visit(ElementaryTypeName const& _node)
 {
-	std::vector<std::pair<std::string, Json>> attributes = {
+	std::vector<std::pair<std::string, Json>> attributes = attributeList(
 		std::make_pair("name", _node.typeName().toString()),
 		std::make_pair("typeDescriptions", typePointerToJson(_node.annotation().type, true))
-	};
+	);
 
 	if (_node.stateMutability())
 		attributes.emplace_back(std::make_pair("stateMutability", stateMutabilityToString(*_node.stateMutability())));
@@ -603,29 +623,29 @@ bool ASTJsonExporter::visit(ElementaryTypeName const& _node)
 
 bool ASTJsonExporter::visit(UserDefinedTypeName const& _node)
 {
-	setJsonNode(_node, "UserDefinedTypeName", {
+	setJsonNode(_node, "UserDefinedTypeName", attributeList(
 		std::make_pair("pathNode", toJson(_node.pathNode())),
 		std::make_pair("referencedDeclaration", idOrNull(_node.pathNode().annotation().referencedDeclaration)),
 		std::make_pair("typeDescriptions", typePointerToJson(_node.annotation().type, true))
-	});
+	));
 	return false;
 }
 
 bool ASTJsonExporter::visit(FunctionTypeName const& _node)
 {
-	setJsonNode(_node, "FunctionTypeName", {
+	setJsonNode(_node, "FunctionTypeName", attributeList(
 		std::make_pair("visibility", Declaration::visibilityToString(_node.visibility())),
 		std::make_pair("stateMutability", stateMutabilityToString(_node.stateMutability())),
 		std::make_pair("parameterTypes", toJson(*_node.parameterTypeList())),
 		std::make_pair("returnParameterTypes", toJson(*_node.returnParameterTypeList())),
 		std::make_pair("typeDescriptions", typePointerToJson(_node.annotation().type, true))
-	});
+	));
 	return false;
 }
 
 bool ASTJsonExporter::visit(Mapping const& _node)
 {
-	setJsonNode(_node, "Mapping", {
+	setJsonNode(_node, "Mapping", attributeList(
 		std::make_pair("keyType", toJson(_node.keyType())),
 		std::make_pair("keyName", _node.keyName()),
 		std::make_pair("keyNameLocation", sourceLocationToString(_node.keyNameLocation())),
@@ -633,17 +653,17 @@ bool ASTJsonExporter::visit(Mapping const& _node)
 		std::make_pair("valueName", _node.valueName()),
 		std::make_pair("valueNameLocation", sourceLocationToString(_node.valueNameLocation())),
 		std::make_pair("typeDescriptions", typePointerToJson(_node.annotation().type, true))
-	});
+	));
 	return false;
 }
 
 bool ASTJsonExporter::visit(ArrayTypeName const& _node)
 {
-	setJsonNode(_node, "ArrayTypeName", {
+	setJsonNode(_node, "ArrayTypeName", attributeList(
 		std::make_pair("baseType", toJson(_node.baseType())),
 		std::make_pair("length", toJsonOrNull(_node.length())),
 		std::make_pair("typeDescriptions", typePointerToJson(_node.annotation().type, true))
-	});
+	));
 	return false;
 }
 
@@ -664,11 +684,11 @@ bool ASTJsonExporter::visit(InlineAssembly const& _node)
 	for (Json& it: externalReferences | ranges::views::values)
 		externalReferencesJson.emplace_back(std::move(it));
 
-	std::vector<std::pair<std::string, Json>> attributes = {
+	std::vector<std::pair<std::string, Json>> attributes = attributeList(
 		std::make_pair("AST", Json(yul::AsmJsonConverter(sourceIndexFromLocation(_node.location()))(_node.operations()))),
 		std::make_pair("externalReferences", std::move(externalReferencesJson)),
 		std::make_pair("evmVersion", dynamic_cast<solidity::yul::EVMDialect const&>(_node.dialect()).evmVersion().name())
-	};
+	);
 
 	if (_node.flags())
 	{
@@ -687,9 +707,9 @@ bool ASTJsonExporter::visit(InlineAssembly const& _node)
 
 bool ASTJsonExporter::visit(Block const& _node)
 {
-	setJsonNode(_node, _node.unchecked() ? "UncheckedBlock" : "Block", {
+	setJsonNode(_node, _node.unchecked() ? "UncheckedBlock" : "Block", attributeList(
 		std::make_pair("statements", toJson(_node.statements()))
-	});
+	));
 	return false;
 }
 
@@ -701,30 +721,30 @@ bool ASTJsonExporter::visit(PlaceholderStatement const& _node)
 
 bool ASTJsonExporter::visit(IfStatement const& _node)
 {
-	setJsonNode(_node, "IfStatement", {
+	setJsonNode(_node, "IfStatement", attributeList(
 		std::make_pair("condition", toJson(_node.condition())),
 		std::make_pair("trueBody", toJson(_node.trueStatement())),
 		std::make_pair("falseBody", toJsonOrNull(_node.falseStatement()))
-	});
+	));
 	return false;
 }
 
 bool ASTJsonExporter::visit(TryCatchClause const& _node)
 {
-	setJsonNode(_node, "TryCatchClause", {
+	setJsonNode(_node, "TryCatchClause", attributeList(
 		std::make_pair("errorName", _node.errorName()),
 		std::make_pair("parameters", toJsonOrNull(_node.parameters())),
 		std::make_pair("block", toJson(_node.block()))
-	});
+	));
 	return false;
 }
 
 bool ASTJsonExporter::visit(TryStatement const& _node)
 {
-	setJsonNode(_node, "TryStatement", {
+	setJsonNode(_node, "TryStatement", attributeList(
 		std::make_pair("externalCall", toJson(_node.externalCall())),
 		std::make_pair("clauses", toJson(_node.clauses()))
-	});
+	));
 	return false;
 }
 
@@ -733,10 +753,10 @@ bool ASTJsonExporter::visit(WhileStatement const& _node)
 	setJsonNode(
 		_node,
 		_node.isDoWhile() ? "DoWhileStatement" : "WhileStatement",
-		{
+		attributeList(
 			std::make_pair("condition", toJson(_node.condition())),
 			std::make_pair("body", toJson(_node.body()))
-		}
+		)
 	);
 	return false;
 }
@@ -744,12 +764,12 @@ bool ASTJsonExporter::visit(WhileStatement const& _node)
 bool ASTJsonExporter::visit(ForStatement const& _node)
 {
 
-	std::vector<std::pair<std::string, Json>> attributes = {
+	std::vector<std::pair<std::string, Json>> attributes = attributeList(
 		std::make_pair("initializationExpression", toJsonOrNull(_node.initializationExpression())),
 		std::make_pair("condition", toJsonOrNull(_node.condition())),
 		std::make_pair("loopExpression", toJsonOrNull(_node.loopExpression())),
 		std::make_pair("body", toJson(_node.body()))
-	};
+	);
 
 	if (_node.annotation().isSimpleCounterLoop.set())
 		attributes.emplace_back("isSimpleCounterLoop", *_node.annotation().isSimpleCounterLoop);
@@ -772,10 +792,10 @@ bool ASTJsonExporter::visit(Break const& _node)
 
 bool ASTJsonExporter::visit(Return const& _node)
 {
-	setJsonNode(_node, "Return", {
+	setJsonNode(_node, "Return", attributeList(
 		std::make_pair("expression", toJsonOrNull(_node.expression())),
 		std::make_pair("functionReturnParameters", idOrNull(_node.annotation().functionReturnParameters))
-	});
+	));
 	return false;
 }
 
@@ -787,17 +807,17 @@ bool ASTJsonExporter::visit(Throw const& _node)
 
 bool ASTJsonExporter::visit(EmitStatement const& _node)
 {
-	setJsonNode(_node, "EmitStatement", {
+	setJsonNode(_node, "EmitStatement", attributeList(
 		std::make_pair("eventCall", toJson(_node.eventCall()))
-	});
+	));
 	return false;
 }
 
 bool ASTJsonExporter::visit(RevertStatement const& _node)
 {
-	setJsonNode(_node, "RevertStatement", {
+	setJsonNode(_node, "RevertStatement", attributeList(
 		std::make_pair("errorCall", toJson(_node.errorCall()))
-	});
+	));
 	return false;
 }
 
@@ -806,29 +826,29 @@ bool ASTJsonExporter::visit(VariableDeclarationStatement const& _node)
 	Json varDecs = Json::array();
 	for (auto const& v: _node.declarations())
 		appendMove(varDecs, idOrNull(v.get()));
-	setJsonNode(_node, "VariableDeclarationStatement", {
+	setJsonNode(_node, "VariableDeclarationStatement", attributeList(
 		std::make_pair("assignments", std::move(varDecs)),
 		std::make_pair("declarations", toJson(_node.declarations())),
 		std::make_pair("initialValue", toJsonOrNull(_node.initialValue()))
-	});
+	));
 	return false;
 }
 
 bool ASTJsonExporter::visit(ExpressionStatement const& _node)
 {
-	setJsonNode(_node, "ExpressionStatement", {
+	setJsonNode(_node, "ExpressionStatement", attributeList(
 		std::make_pair("expression", toJson(_node.expression()))
-	});
+	));
 	return false;
 }
 
 bool ASTJsonExporter::visit(Conditional const& _node)
 {
-	std::vector<std::pair<std::string, Json>> attributes = {
+	std::vector<std::pair<std::string, Json>> attributes = attributeList(
 		std::make_pair("condition", toJson(_node.condition())),
 		std::make_pair("trueExpression", toJson(_node.trueExpression())),
 		std::make_pair("falseExpression", toJson(_node.falseExpression()))
-	};
+	);
 	appendExpressionAttributes(attributes, _node.annotation());
 	setJsonNode(_node, "Conditional", std::move(attributes));
 	return false;
@@ -836,11 +856,11 @@ bool ASTJsonExporter::visit(Conditional const& _node)
 
 bool ASTJsonExporter::visit(Assignment const& _node)
 {
-	std::vector<std::pair<std::string, Json>> attributes = {
+	std::vector<std::pair<std::string, Json>> attributes = attributeList(
 		std::make_pair("operator", TokenTraits::toString(_node.assignmentOperator())),
 		std::make_pair("leftHandSide", toJson(_node.leftHandSide())),
 		std::make_pair("rightHandSide", toJson(_node.rightHandSide()))
-	};
+	);
 	appendExpressionAttributes(attributes, _node.annotation());
 	setJsonNode(_node, "Assignment", std::move(attributes));
 	return false;
@@ -848,10 +868,10 @@ bool ASTJsonExporter::visit(Assignment const& _node)
 
 bool ASTJsonExporter::visit(TupleExpression const& _node)
 {
-	std::vector<std::pair<std::string, Json>> attributes = {
+	std::vector<std::pair<std::string, Json>> attributes = attributeList(
 		std::make_pair("isInlineArray", Json(_node.isInlineArray())),
-		std::make_pair("components", toJson(_node.components())),
-	};
+		std::make_pair("components", toJson(_node.components()))
+	);
 	appendExpressionAttributes(attributes, _node.annotation());
 	setJsonNode(_node, "TupleExpression", std::move(attributes));
 	return false;
@@ -859,11 +879,11 @@ bool ASTJsonExporter::visit(TupleExpression const& _node)
 
 bool ASTJsonExporter::visit(UnaryOperation const& _node)
 {
-	std::vector<std::pair<std::string, Json>> attributes = {
+	std::vector<std::pair<std::string, Json>> attributes = attributeList(
 		std::make_pair("prefix", _node.isPrefixOperation()),
 		std::make_pair("operator", TokenTraits::toString(_node.getOperator())),
 		std::make_pair("subExpression", toJson(_node.subExpression()))
-	};
+	);
 	// NOTE: This annotation is guaranteed to be set but only if we didn't stop at the parsing stage.
 	if (_node.annotation().userDefinedFunction.set() && *_node.annotation().userDefinedFunction != nullptr)
 		attributes.emplace_back("function", nodeId(**_node.annotation().userDefinedFunction));
@@ -874,12 +894,12 @@ bool ASTJsonExporter::visit(UnaryOperation const& _node)
 
 bool ASTJsonExporter::visit(BinaryOperation const& _node)
 {
-	std::vector<std::pair<std::string, Json>> attributes = {
+	std::vector<std::pair<std::string, Json>> attributes = attributeList(
 		std::make_pair("operator", TokenTraits::toString(_node.getOperator())),
 		std::make_pair("leftExpression", toJson(_node.leftExpression())),
 		std::make_pair("rightExpression", toJson(_node.rightExpression())),
-		std::make_pair("commonType", typePointerToJson(_node.annotation().commonType)),
-	};
+		std::make_pair("commonType", typePointerToJson(_node.annotation().commonType))
+	);
 	// NOTE: This annotation is guaranteed to be set but only if we didn't stop at the parsing stage.
 	if (_node.annotation().userDefinedFunction.set() && *_node.annotation().userDefinedFunction != nullptr)
 		attributes.emplace_back("function", nodeId(**_node.annotation().userDefinedFunction));
@@ -893,13 +913,13 @@ bool ASTJsonExporter::visit(FunctionCall const& _node)
 	Json names = Json::array();
 	for (auto const& name: _node.names())
 		names.push_back(Json(*name));
-	std::vector<std::pair<std::string, Json>> attributes = {
+	std::vector<std::pair<std::string, Json>> attributes = attributeList(
 		std::make_pair("expression", toJson(_node.expression())),
 		std::make_pair("names", std::move(names)),
 		std::make_pair("nameLocations", sourceLocationsToJson(_node.nameLocations())),
 		std::make_pair("arguments", toJson(_node.arguments())),
 		std::make_pair("tryCall", _node.annotation().tryCall)
-	};
+	);
 
 	if (_node.annotation().kind.set())
 	{
@@ -918,11 +938,11 @@ bool ASTJsonExporter::visit(FunctionCallOptions const& _node)
 	for (auto const& name: _node.names())
 		names.emplace_back(Json(*name));
 
-	std::vector<std::pair<std::string, Json>> attributes = {
+	std::vector<std::pair<std::string, Json>> attributes = attributeList(
 		std::make_pair("expression", toJson(_node.expression())),
 		std::make_pair("names", std::move(names)),
-		std::make_pair("options", toJson(_node.options())),
-	};
+		std::make_pair("options", toJson(_node.options()))
+	);
 	appendExpressionAttributes(attributes, _node.annotation());
 
 	setJsonNode(_node, "FunctionCallOptions", std::move(attributes));
@@ -931,9 +951,9 @@ bool ASTJsonExporter::visit(FunctionCallOptions const& _node)
 
 bool ASTJsonExporter::visit(NewExpression const& _node)
 {
-	std::vector<std::pair<std::string, Json>> attributes = {
+	std::vector<std::pair<std::string, Json>> attributes = attributeList(
 		std::make_pair("typeName", toJson(_node.typeName()))
-	};
+	);
 	appendExpressionAttributes(attributes, _node.annotation());
 	setJsonNode(_node, "NewExpression", std::move(attributes));
 	return false;
@@ -941,12 +961,12 @@ bool ASTJsonExporter::visit(NewExpression const& _node)
 
 bool ASTJsonExporter::visit(MemberAccess const& _node)
 {
-	std::vector<std::pair<std::string, Json>> attributes = {
+	std::vector<std::pair<std::string, Json>> attributes = attributeList(
 		std::make_pair("memberName", _node.memberName()),
 		std::make_pair("memberLocation", Json(sourceLocationToString(_node.memberLocation()))),
 		std::make_pair("expression", toJson(_node.expression())),
-		std::make_pair("referencedDeclaration", idOrNull(_node.annotation().referencedDeclaration)),
-	};
+		std::make_pair("referencedDeclaration", idOrNull(_node.annotation().referencedDeclaration))
+	);
 	appendExpressionAttributes(attributes, _node.annotation());
 	setJsonNode(_node, "MemberAccess", std::move(attributes));
 	return false;
@@ -954,10 +974,10 @@ bool ASTJsonExporter::visit(MemberAccess const& _node)
 
 bool ASTJsonExporter::visit(IndexAccess const& _node)
 {
-	std::vector<std::pair<std::string, Json>> attributes = {
+	std::vector<std::pair<std::string, Json>> attributes = attributeList(
 		std::make_pair("baseExpression", toJson(_node.baseExpression())),
-		std::make_pair("indexExpression", toJsonOrNull(_node.indexExpression())),
-	};
+		std::make_pair("indexExpression", toJsonOrNull(_node.indexExpression()))
+	);
 	appendExpressionAttributes(attributes, _node.annotation());
 	setJsonNode(_node, "IndexAccess", std::move(attributes));
 	return false;
@@ -965,11 +985,11 @@ bool ASTJsonExporter::visit(IndexAccess const& _node)
 
 bool ASTJsonExporter::visit(IndexRangeAccess const& _node)
 {
-	std::vector<std::pair<std::string, Json>> attributes = {
+	std::vector<std::pair<std::string, Json>> attributes = attributeList(
 		std::make_pair("baseExpression", toJson(_node.baseExpression())),
 		std::make_pair("startExpression", toJsonOrNull(_node.startExpression())),
-		std::make_pair("endExpression", toJsonOrNull(_node.endExpression())),
-	};
+		std::make_pair("endExpression", toJsonOrNull(_node.endExpression()))
+	);
 	appendExpressionAttributes(attributes, _node.annotation());
 	setJsonNode(_node, "IndexRangeAccess", std::move(attributes));
 	return false;
@@ -980,21 +1000,21 @@ bool ASTJsonExporter::visit(Identifier const& _node)
 	Json overloads = Json::array();
 	for (auto const& dec: _node.annotation().overloadedDeclarations)
 		overloads.emplace_back(nodeId(*dec));
-	setJsonNode(_node, "Identifier", {
+	setJsonNode(_node, "Identifier", attributeList(
 		std::make_pair("name", _node.name()),
 		std::make_pair("referencedDeclaration", idOrNull(_node.annotation().referencedDeclaration)),
-		std::make_pair("overloadedDeclarations", overloads),
+		std::make_pair("overloadedDeclarations", std::move(overloads)),
 		std::make_pair("typeDescriptions", typePointerToJson(_node.annotation().type)),
 		std::make_pair("argumentTypes", typePointerToJson(_node.annotation().arguments))
-	});
+	));
 	return false;
 }
 
 bool ASTJsonExporter::visit(ElementaryTypeNameExpression const& _node)
 {
-	std::vector<std::pair<std::string, Json>> attributes = {
+	std::vector<std::pair<std::string, Json>> attributes = attributeList(
 		std::make_pair("typeName", toJson(_node.type()))
-	};
+	);
 	appendExpressionAttributes(attributes, _node.annotation());
 	setJsonNode(_node, "ElementaryTypeNameExpression", std::move(attributes));
 	return false;
@@ -1006,9 +1026,9 @@ bool ASTJsonExporter::visit(Literal const& _node)
 	if (!util::validateUTF8(_node.value()))
 		value = Json();
 	Token subdenomination = Token(_node.subDenomination());
-	std::vector<std::pair<std::string, Json>> attributes = {
+	std::vector<std::pair<std::string, Json>> attributes = attributeList(
 		std::make_pair("kind", literalTokenKind(_node.token())),
-		std::make_pair("value", value),
+		std::make_pair("value", std::move(value)),
 		std::make_pair("hexValue", util::toHex(util::asBytes(_node.value()))),
 		std::make_pair(
 			"subdenomination",
@@ -1016,7 +1036,7 @@ bool ASTJsonExporter::visit(Literal const& _node)
 			Json() :
 			Json(TokenTraits::toString(subdenomination))
 		)
-	};
+	);
 	appendExpressionAttributes(attributes, _node.annotation());
 	setJsonNode(_node, "Literal", std::move(attributes));
 	return false;
@@ -1025,9 +1045,9 @@ bool ASTJsonExporter::visit(Literal const& _node)
 bool ASTJsonExporter::visit(StructuredDocumentation const& _node)
 {
 	Json text = *_node.text();
-	std::vector<std::pair<std::string, Json>> attributes = {
-		std::make_pair("text", text)
-	};
+	std::vector<std::pair<std::string, Json>> attributes = attributeList(
+		std::make_pair("text", std::move(text))
+	);
 	setJsonNode(_node, "StructuredDocumentation", std::move(attributes));
 	return false;
 }
@@ -1058,6 +1078,8 @@ std::string ASTJsonExporter::location(VariableDeclaration::Location _location)
 		return "memory";
 	case VariableDeclaration::Location::CallData:
 		return "calldata";
+	case VariableDeclaration::Location::Transient:
+		return "transient";
 	}
 	// To make the compiler happy
 	return {};
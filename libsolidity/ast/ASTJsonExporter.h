@@ -197,6 +197,7 @@ private:
 
 	CompilerStack::State m_stackState = CompilerStack::State::Empty; ///< Used to only access information that already exists
 	bool m_inEvent = false; ///< whether we are currently inside an event or not
+	size_t m_nodeDepth = 0; ///< number of nested calls to toJson
 	Json m_currentValue;
 	std::map<std::string, unsigned> m_sourceIndices;
 };
@@ -80,7 +80,7 @@ ASTPointer<T> ASTJsonImporter::createASTNode(Json const& _node, Args&&... _args)
 
 	astAssert(m_usedIDs.insert(id).second, "Found duplicate node ID!");
 
-	auto n = std::make_shared<T>(
+	auto n = m_arena->make<T>(
 		id,
 		createSourceLocation(_node),
 		std::forward<Args>(_args)...
@@ -92,7 +92,7 @@ SourceLocation const ASTJsonImporter::createSourceLocation(Json const& _node)
 {
 	astAssert(member(_node, "src").is_string(), "'src' must be a string");
 
-	return solidity::langutil::parseSourceLocation(_node["src"].get<std::string>(), m_sourceNames);
+	return solidity::langutil::parseSourceLocation(_node["src"].get_ref<std::string const&>(), m_sourceNames);
 }
 
 std::optional<std::vector<SourceLocation>> ASTJsonImporter::createSourceLocations(Json const& _node) const
@@ -102,7 +102,7 @@ std::optional<std::vector<SourceLocation>> ASTJsonImporter::createSourceLocation
 	if (_node.contains("nameLocations") && _node["nameLocations"].is_array())
 	{
 		for (auto const& val: _node["nameLocations"])
-			locations.emplace_back(langutil::parseSourceLocation(val.get<std::string>(), m_sourceNames));
+			locations.emplace_back(langutil::parseSourceLocation(val.get_ref<std::string const&>(), m_sourceNames));
 		return locations;
 	}
 
@@ -113,21 +113,21 @@ SourceLocation ASTJsonImporter::createNameSourceLocation(Json const& _node)
 {
 	astAssert(member(_node, "nameLocation").is_string(), "'nameLocation' must be a string");
 
-	return solidity::langutil::parseSourceLocation(_node["nameLocation"].get<std::string>(), m_sourceNames);
+	return solidity::langutil::parseSourceLocation(_node["nameLocation"].get_ref<std::string const&>(), m_sourceNames);
 }
 
 SourceLocation ASTJsonImporter::createKeyNameSourceLocation(Json const& _node)
 {
 	astAssert(member(_node, "keyNameLocation").is_string(), "'keyNameLocation' must be a string");
 
-	return solidity::langutil::parseSourceLocation(_node["keyNameLocation"].get<std::string>(), m_sourceNames);
+	return solidity::langutil::parseSourceLocation(_node["keyNameLocation"].get_ref<std::string const&>(), m_sourceNames);
 }
 
 SourceLocation ASTJsonImporter::createValueNameSourceLocation(Json const& _node)
 {
 	astAssert(member(_node, "valueNameLocation").is_string(), "'valueNameLocation' must be a string");
 
-	return solidity::langutil::parseSourceLocation(_node["valueNameLocation"].get<std::string>(), m_sourceNames);
+	return solidity::langutil::parseSourceLocation(_node["valueNameLocation"].get_ref<std::string const&>(), m_sourceNames);
 }
 
 template<class T>
@@ -142,7 +142,7 @@ ASTPointer<T> ASTJsonImporter::convertJsonToASTNode(Json const& _node)
 ASTPointer<ASTNode> ASTJsonImporter::convertJsonToASTNode(Json const& _json)
 {
 	astAssert(_json["nodeType"].is_string() && _json.contains("id"), "JSON-Node needs to have 'nodeType' and 'id' fields.");
-	std::string nodeType = _json["nodeType"].get<std::string>();
+	std::string const& nodeType = _json["nodeType"].get_ref<std::string const&>();
 	if (nodeType == "PragmaDirective")
 		return createPragmaDirective(_json);
 	if (nodeType == "ImportDirective")
@@ -370,7 +370,7 @@ ASTPointer<IdentifierPath> ASTJsonImporter::createIdentifierPath(Json const& _no
 
 	if (_node.contains("nameLocations") && _node["nameLocations"].is_array())
 		for (auto const& val: _node["nameLocations"])
-			namePathLocations.emplace_back(langutil::parseSourceLocation(val.get<std::string>(), m_sourceNames));
+			namePathLocations.emplace_back(langutil::parseSourceLocation(val.get_ref<std::string const&>(), m_sourceNames));
 	else
 		namePathLocations.resize(namePath.size());
 
@@ -1005,7 +1005,7 @@ ASTPointer<MemberAccess> ASTJsonImporter::createMemberAccess(Json const&  _node)
 {
 	SourceLocation memberLocation;
 	if (member(_node, "memberLocation").is_string())
-		memberLocation = solidity::langutil::parseSourceLocation(_node["memberLocation"].get<std::string>(), m_sourceNames);
+		memberLocation = solidity::langutil::parseSourceLocation(_node["memberLocation"].get_ref<std::string const&>(), m_sourceNames);
 
 	return createASTNode<MemberAccess>(
 		_node,
@@ -1080,11 +1080,11 @@ ASTPointer<StructuredDocumentation> ASTJsonImporter::createDocumentation(Json co
 
 // ===== helper functions ==========
 
-Json ASTJsonImporter::member(Json const& _node, std::string const& _name)
+Json const& ASTJsonImporter::member(Json const& _node, std::string const& _name)
 {
-	if (!_node.contains(_name))
-		return Json();
-	return _node[_name];
+	static Json const null;
+	auto it = _node.find(_name);
+	return it != _node.end() ? *it : null;
 }
 
 Token ASTJsonImporter::scanSingleToken(Json const& _node)
@@ -1102,16 +1102,16 @@ ASTPointer<ASTString> ASTJsonImporter::nullOrASTString(Json const& _json, std::s
 
 ASTPointer<ASTString> ASTJsonImporter::memberAsASTString(Json const& _node, std::string const& _name)
 {
-	Json value = member(_node, _name);
+	Json const& value = member(_node, _name);
 	astAssert(value.is_string(), "field " + _name + " must be of type string.");
-	return std::make_shared<ASTString>(_node[_name].get<std::string>());
+	return std::make_shared<ASTString>(value.get<std::string>());
 }
 
 bool ASTJsonImporter::memberAsBool(Json const& _node, std::string const& _name)
 {
-	Json value = member(_node, _name);
+	Json const& value = member(_node, _name);
 	astAssert(value.is_boolean(), "field " + _name + " must be of type boolean.");
-	return _node[_name].get<bool>();
+	return value.get<bool>();
 }
 
 
@@ -1121,11 +1121,11 @@ ContractKind ASTJsonImporter::contractKind(Json const& _node)
 {
 	ContractKind kind;
 	astAssert(!member(_node, "contractKind").is_null(), "'Contract-kind' can not be null.");
-	if (_node["contractKind"].get<std::string>() == "interface")
+	if (_node["contractKind"].get_ref<std::string const&>() == "interface")
 		kind = ContractKind::Interface;
-	else if (_node["contractKind"].get<std::string>() == "contract")
+	else if (_node["contractKind"].get_ref<std::string const&>() == "contract")
 		kind = ContractKind::Contract;
-	else if (_node["contractKind"].get<std::string>() == "library")
+	else if (_node["contractKind"].get_ref<std::string const&>() == "library")
 		kind = ContractKind::Library;
 	else
 		astAssert(false, "Unknown ContractKind");
@@ -1136,15 +1136,15 @@ Token ASTJsonImporter::literalTokenKind(Json const& _node)
 {
 	astAssert(member(_node, "kind").is_string(), "Token-'kind' expected to be a string.");
 	Token tok;
-	if (_node["kind"].get<std::string>() == "number")
+	if (_node["kind"].get_ref<std::string const&>() == "number")
 		tok = Token::Number;
-	else if (_node["kind"].get<std::string>() == "string")
+	else if (_node["kind"].get_ref<std::string const&>() == "string")
 		tok = Token::StringLiteral;
-	else if (_node["kind"].get<std::string>() == "unicodeString")
+	else if (_node["kind"].get_ref<std::string const&>() == "unicodeString")
 		tok = Token::UnicodeStringLiteral;
-	else if (_node["kind"].get<std::string>() == "hexString")
+	else if (_node["kind"].get_ref<std::string const&>() == "hexString")
 		tok = Token::HexStringLiteral;
-	else if (_node["kind"].get<std::string>() == "bool")
+	else if (_node["kind"].get_ref<std::string const&>() == "bool")
 		tok = (member(_node, "value").get<std::string>() == "true") ? Token::TrueLiteral : Token::FalseLiteral;
 	else
 		astAssert(false, "Unknown kind of literalString");
@@ -1153,7 +1153,7 @@ Token ASTJsonImporter::literalTokenKind(Json const& _node)
 
 Visibility ASTJsonImporter::visibility(Json const& _node)
 {
-	Json visibility = member(_node, "visibility");
+	Json const& visibility = member(_node, "visibility");
 	astAssert(visibility.is_string(), "'visibility' expected to be a string.");
 
 	std::string const visibilityStr = visibility.get<std::string>();
@@ -1177,7 +1177,7 @@ Visibility ASTJsonImporter::visibility(Json const& _node)
 
 VariableDeclaration::Location ASTJsonImporter::location(Json const& _node)
 {
-	Json storageLoc = member(_node, "storageLocation");
+	Json const& storageLoc = member(_node, "storageLocation");
 	astAssert(storageLoc.is_string(), "'storageLocation' expected to be a string.");
 
 	std::string const storageLocStr = storageLoc.get<std::string>();
@@ -1190,6 +1190,8 @@ VariableDeclaration::Location ASTJsonImporter::location(Json const& _node)
 		return VariableDeclaration::Location::Memory;
 	else if (storageLocStr == "calldata")
 		return VariableDeclaration::Location::CallData;
+	else if (storageLocStr == "transient")
+		return VariableDeclaration::Location::Transient;
 	else
 		astAssert(false, "Unknown location declaration");
 
@@ -1199,7 +1201,7 @@ VariableDeclaration::Location ASTJsonImporter::location(Json const& _node)
 
 Literal::SubDenomination ASTJsonImporter::subdenomination(Json const& _node)
 {
-	Json subDen = member(_node, "subdenomination");
+	Json const& subDen = member(_node, "subdenomination");
 
 	if (subDen.is_null())
 		return Literal::SubDenomination::None;
@@ -26,6 +26,7 @@
 #include <vector>
 #include <libsolutil/JSON.h>
 #include <libsolidity/ast/AST.h>
+#include <libsolidity/ast/ASTArena.h>
 #include <libsolidity/ast/ASTAnnotations.h>
 #include <liblangutil/EVMVersion.h>
 #include <liblangutil/Exceptions.h>
@@ -134,8 +135,8 @@ private:
 	///@}
 
 	// =============== general helper functions ===================
-	/// @returns the member of a given JSON object, throws if member does not exist
-	Json member(Json const& _node, std::string const& _name);
+	/// @returns the member of a given JSON object or null if the member does not exist
+	Json const& member(Json const& _node, std::string const& _name);
 	/// @returns the appropriate TokenObject used in parsed Strings (pragma directive or operator)
 	Token scanSingleToken(Json const& _node);
 	template<class T>
@@ -166,6 +167,8 @@ private:
 	std::set<int64_t> m_usedIDs;
 	/// Configured EVM version
 	langutil::EVMVersion m_evmVersion;
+	/// Arena the imported nodes are allocated from.
+	std::shared_ptr<ASTArena> m_arena = ASTArena::create();
 };
 
 }
@@ -22,6 +22,8 @@
 
 #include <libsolutil/Algorithms.h>
 
+#include <algorithm>
+
 namespace solidity::frontend
 {
 
@@ -47,6 +49,53 @@ ASTNode const* locateInnermostASTNode(int _offsetInFile, SourceUnit const& _sour
 	return innermostMatch;
 }
 
+ASTNodeLocationIndex::ASTNodeLocationIndex(SourceUnit const& _sourceUnit)
+{
+	auto collector = SimpleASTVisitor(
+		[&](ASTNode const& _node) -> bool
+		{
+			if (_node.location().hasText())
+				m_entries.push_back({_node.location().start, _node.location().end, &_node, 0});
+			return true;
+		},
+		[](ASTNode const&) {}
+	);
+	_sourceUnit.accept(collector);
+
+	// Enclosing nodes come first. Nodes with the same location stay in visiting order,
+	// so that the last of them is the innermost one like in locateInnermostASTNode().
+	std::stable_sort(m_entries.begin(), m_entries.end(), [](Entry const& _a, Entry const& _b) {
+		return std::make_pair(_a.start, -_a.end) < std::make_pair(_b.start, -_b.end);
+	});
+
+	std::vector<size_t> enclosing;
+	for (size_t i = 0; i < m_entries.size(); ++i)
+	{
+		while (!enclosing.empty() && m_entries[enclosing.back()].end < m_entries[i].end)
+			enclosing.pop_back();
+		m_entries[i].parent = enclosing.empty() ? m_entries.size() : enclosing.back();
+		enclosing.push_back(i);
+	}
+}
+
+ASTNode const* ASTNodeLocationIndex::innermostNode(int _offsetInFile) const
+{
+	// The last node starting at or before the offset either contains the offset itself
+	// or is nested in the innermost node containing it.
+	auto it = std::upper_bound(
+		m_entries.begin(),
+		m_entries.end(),
+		_offsetInFile,
+		[](int _offset, Entry const& _entry) { return _offset < _entry.start; }
+	);
+	if (it == m_entries.begin())
+		return nullptr;
+	for (size_t i = static_cast<size_t>(it - m_entries.begin()) - 1; i < m_entries.size(); i = m_entries[i].parent)
+		if (_offsetInFile < m_entries[i].end)
+			return m_entries[i].node;
+	return nullptr;
+}
+
 bool isConstantVariableRecursive(VariableDeclaration const& _varDecl)
 {
 	solAssert(_varDecl.isConstant(), "Constant variable expected");
@@ -18,6 +18,9 @@
 
 #pragma once
 
+#include <cstddef>
+#include <vector>
+
 namespace solidity::frontend
 {
 
@@ -25,6 +28,7 @@ class ASTNode;
 class Declaration;
 class Expression;
 class SourceUnit;
+class Type;
 class VariableDeclaration;
 
 /// Find the topmost referenced constant variable declaration when the given variable
@@ -38,6 +42,31 @@ bool isConstantVariableRecursive(VariableDeclaration const& _varDecl);
 /// Returns the innermost AST node that covers the given location or nullptr if not found.
 ASTNode const* locateInnermostASTNode(int _offsetInFile, SourceUnit const& _sourceUnit);
 
+/**
+ * Index of the source locations of all nodes in a source unit, sorted by their start.
+ * Finds the same node as locateInnermostASTNode() without visiting the AST again,
+ * for repeated lookups in the same source unit.
+ */
+class ASTNodeLocationIndex
+{
+public:
+	explicit ASTNodeLocationIndex(SourceUnit const& _sourceUnit);
+
+	/// @returns the innermost AST node that covers the given offset or nullptr if not found.
+	ASTNode const* innermostNode(int _offsetInFile) const;
+
+private:
+	struct Entry
+	{
+		int start;
+		int end;
+		ASTNode const* node;
+		/// Index of the innermost entry enclosing this one, or the number of entries if there is none.
+		size_t parent;
+	};
+	std::vector<Entry> m_entries;
+};
+
 /// @returns @a _expr itself, in case it is not a unary tuple expression. Otherwise it descends recursively
 /// into unary tuples and returns the contained expression.
 Expression const* resolveOuterUnaryTuples(Expression const* _expr);
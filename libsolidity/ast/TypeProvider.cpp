@@ -191,6 +191,14 @@ void TypeProvider::reset()
 	clearCaches(instance().m_bytesM);
 	clearCaches(instance().m_magics);
 
+	instance().m_byteArrayTypes.clear();
+	instance().m_dynamicArrayTypes.clear();
+	instance().m_staticArrayTypes.clear();
+	instance().m_mappingTypes.clear();
+	instance().m_tupleTypes.clear();
+	instance().m_locationCopies.clear();
+	instance().m_typeTypes.clear();
+	instance().m_metaTypes.clear();
 	instance().m_generalTypes.clear();
 	instance().m_stringLiteralTypes.clear();
 	instance().m_ufixedMxN.clear();
@@ -204,6 +212,18 @@ inline T const* TypeProvider::createAndGet(Args&& ... _args)
 	return static_cast<T const*>(instance().m_generalTypes.back().get());
 }
 
+template <typename T, typename Index, typename Key, typename... Args>
+inline T const* TypeProvider::getOrCreate(Index& _index, Key _key, Args&& ... _args)
+{
+	if (auto it = _index.find(_key); it != _index.end())
+		return static_cast<T const*>(it->second);
+	// Creating the type can recursively request other types from the same index,
+	// so it is only inserted after construction.
+	T const* type = createAndGet<T>(std::forward<Args>(_args)...);
+	_index.emplace(std::move(_key), type);
+	return type;
+}
+
 Type const* TypeProvider::fromElementaryTypeName(ElementaryTypeNameToken const& _type, std::optional<StateMutability> _stateMutability)
 {
 	solAssert(
@@ -404,7 +424,7 @@ TupleType const* TypeProvider::tuple(std::vector<Type const*> members)
 	if (members.empty())
 		return &m_emptyTuple;
 
-	return createAndGet<TupleType>(std::move(members));
+	return getOrCreate<TupleType>(instance().m_tupleTypes, members, std::move(members));
 }
 
 ReferenceType const* TypeProvider::withLocation(ReferenceType const* _type, DataLocation _location, bool _isPointer)
@@ -412,8 +432,15 @@ ReferenceType const* TypeProvider::withLocation(ReferenceType const* _type, Data
 	if (_type->location() == _location && _type->isPointer() == _isPointer)
 		return _type;
 
+	auto& index = instance().m_locationCopies;
+	auto key = std::make_tuple(_type, _location, _isPointer);
+	if (auto it = index.find(key); it != index.end())
+		return static_cast<ReferenceType const*>(it->second);
+
 	instance().m_generalTypes.emplace_back(_type->copyForLocation(_location, _isPointer));
-	return static_cast<ReferenceType const*>(instance().m_generalTypes.back().get());
+	auto const* copy = static_cast<ReferenceType const*>(instance().m_generalTypes.back().get());
+	index.emplace(key, copy);
+	return copy;
 }
 
 FunctionType const* TypeProvider::function(FunctionDefinition const& _function, FunctionType::Kind _kind)
@@ -504,17 +531,23 @@ ArrayType const* TypeProvider::array(DataLocation _location, bool _isString)
 		if (_location == DataLocation::Memory)
 			return bytesMemory();
 	}
-	return createAndGet<ArrayType>(_location, _isString);
+	return getOrCreate<ArrayType>(instance().m_byteArrayTypes, std::make_tuple(_location, _isString), _location, _isString);
 }
 
 ArrayType const* TypeProvider::array(DataLocation _location, Type const* _baseType)
 {
-	return createAndGet<ArrayType>(_location, _baseType);
+	return getOrCreate<ArrayType>(instance().m_dynamicArrayTypes, std::make_tuple(_location, _baseType), _location, _baseType);
 }
 
 ArrayType const* TypeProvider::array(DataLocation _location, Type const* _baseType, u256 const& _length)
 {
-	return createAndGet<ArrayType>(_location, _baseType, _length);
+	return getOrCreate<ArrayType>(
+		instance().m_staticArrayTypes,
+		std::make_tuple(_location, _baseType, _length),
+		_location,
+		_baseType,
+		_length
+	);
 }
 
 ArraySliceType const* TypeProvider::arraySlice(ArrayType const& _arrayType)
@@ -539,7 +572,7 @@ ModuleType const* TypeProvider::module(SourceUnit const& _source)
 
 TypeType const* TypeProvider::typeType(Type const* _actualType)
 {
-	return createAndGet<TypeType>(_actualType);
+	return getOrCreate<TypeType>(instance().m_typeTypes, _actualType, _actualType);
 }
 
 StructType const* TypeProvider::structType(StructDefinition const& _struct, DataLocation _location)
@@ -568,12 +601,19 @@ MagicType const* TypeProvider::meta(Type const* _type)
 		),
 		"Only enum, contracts or integer types supported for now."
 	);
-	return createAndGet<MagicType>(_type);
+	return getOrCreate<MagicType>(instance().m_metaTypes, _type, _type);
 }
 
 MappingType const* TypeProvider::mapping(Type const* _keyType, ASTString _keyName, Type const* _valueType, ASTString _valueName)
 {
-	return createAndGet<MappingType>(_keyType, _keyName, _valueType, _valueName);
+	return getOrCreate<MappingType>(
+		instance().m_mappingTypes,
+		std::make_tuple(_keyType, _keyName, _valueType, _valueName),
+		_keyType,
+		std::move(_keyName),
+		_valueType,
+		std::move(_valueName)
+	);
 }
 
 UserDefinedValueType const* TypeProvider::userDefinedValueType(UserDefinedValueTypeDefinition const& _definition)
@@ -20,10 +20,14 @@
 
 #include <libsolidity/ast/Types.h>
 
+#include <boost/container_hash/hash.hpp>
+
 #include <array>
 #include <map>
 #include <memory>
 #include <optional>
+#include <tuple>
+#include <unordered_map>
 #include <utility>
 
 namespace solidity::frontend
@@ -210,6 +214,14 @@ private:
 	template <typename T, typename... Args>
 	static inline T const* createAndGet(Args&& ... _args);
 
+	/// Returns the type stored under @a _key in @a _index or creates it from @a _args
+	/// and stores it there.
+	template <typename T, typename Index, typename Key, typename... Args>
+	static inline T const* getOrCreate(Index& _index, Key _key, Args&& ... _args);
+
+	template <typename Key>
+	using TypeIndex = std::unordered_map<Key, Type const*, boost::hash<Key>>;
+
 	static BoolType const m_boolean;
 	static InaccessibleDynamicType const m_inaccessibleDynamic;
 
@@ -232,6 +244,17 @@ private:
 	std::map<std::pair<unsigned, unsigned>, std::unique_ptr<FixedPointType>> m_fixedMxN{};
 	std::map<std::string, std::unique_ptr<StringLiteralType>> m_stringLiteralTypes{};
 	std::vector<std::unique_ptr<Type>> m_generalTypes{};
+
+	/// Indexes into m_generalTypes for composite types, keyed by their construction arguments,
+	/// so that requesting the same type again does not create another instance.
+	TypeIndex<std::tuple<DataLocation, bool>> m_byteArrayTypes{};
+	TypeIndex<std::tuple<DataLocation, Type const*>> m_dynamicArrayTypes{};
+	TypeIndex<std::tuple<DataLocation, Type const*, u256>> m_staticArrayTypes{};
+	TypeIndex<std::tuple<Type const*, ASTString, Type const*, ASTString>> m_mappingTypes{};
+	TypeIndex<std::vector<Type const*>> m_tupleTypes{};
+	TypeIndex<std::tuple<ReferenceType const*, DataLocation, bool>> m_locationCopies{};
+	TypeIndex<Type const*> m_typeTypes{};
+	TypeIndex<Type const*> m_metaTypes{};
 };
 
 }
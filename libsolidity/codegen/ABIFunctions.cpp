@@ -30,6 +30,8 @@
 
 #include <boost/algorithm/string/join.hpp>
 
+#include <range/v3/algorithm/all_of.hpp>
+
 using namespace solidity;
 using namespace solidity::util;
 using namespace solidity::frontend;
@@ -202,6 +204,19 @@ std::string ABIFunctions::tupleDecoder(TypePointers const& _types, bool _fromMem
 		for (auto const& t: _types)
 			decodingTypes.emplace_back(t->decodingType());
 
+		if (
+			_types.size() > 1 &&
+			ranges::all_of(decodingTypes, [](Type const* _type) {
+				solAssert(_type, "");
+				return
+					_type->isValueType() &&
+					_type->sizeOnStack() == 1 &&
+					!_type->isDynamicallyEncoded() &&
+					_type->calldataEncodedSize() == 32;
+			})
+		)
+			return staticValueTupleDecoder(functionName, _types, _fromMemory);
+
 		Whiskers templ(R"(
 			function <functionName>(headStart, dataEnd) <arrow> <valueReturnParams> {
 				if slt(sub(dataEnd, headStart), <minimumSize>) { <revertString>() }
@@ -259,6 +274,59 @@ std::string ABIFunctions::tupleDecoder(TypePointers const& _types, bool _fromMem
 	});
 }
 
+std::string ABIFunctions::staticValueTupleDecoder(
+	std::string const& _functionName,
+	TypePointers const& _types,
+	bool _fromMemory
+)
+{
+	Whiskers templ(R"(
+		function <functionName>(headStart, dataEnd) -> <values> {
+			if slt(sub(dataEnd, headStart), <size>) { <revertString>() }
+			<#elements>
+				<value> := <load>(add(headStart, <pos>))
+			</elements>
+			<?validate>
+				if iszero(<condition>) { revert(0, 0) }
+			</validate>
+		}
+	)");
+	templ("functionName", _functionName);
+	templ("revertString", revertReasonIfDebugFunction("ABI decoding: tuple data too short"));
+	templ("size", std::to_string(_types.size() * 32));
+	templ("load", _fromMemory ? "mload" : "calldataload");
+
+	std::vector<std::string> values;
+	std::vector<std::map<std::string, std::string>> elements;
+	std::string condition;
+	for (size_t i = 0; i < _types.size(); ++i)
+	{
+		std::string value = "value" + std::to_string(i);
+		values.emplace_back(value);
+		elements.push_back({{"value", value}, {"pos", std::to_string(i * 32)}});
+		// Full-width values are always valid.
+		Type const* decodingType = _types[i]->decodingType();
+		if (
+			_types[i]->category() != Type::Category::Enum &&
+			(
+				*decodingType == *TypeProvider::uint256() ||
+				*decodingType == *TypeProvider::int256() ||
+				*decodingType == FixedBytesType(32)
+			)
+		)
+			continue;
+		// Validation should use the type and not decodingType, because e.g.
+		// the decoding type of an enum is a plain int.
+		std::string elementCondition = m_utils.validationCondition(*_types[i], value);
+		condition = condition.empty() ? elementCondition : "and(" + elementCondition + ", " + condition + ")";
+	}
+	templ("values", boost::algorithm::join(values, ", "));
+	templ("elements", elements);
+	templ("validate", !condition.empty());
+	templ("condition", condition);
+	return templ.render();
+}
+
 std::string ABIFunctions::EncodingOptions::toFunctionNameSuffix() const
 {
 	std::string suffix;
@@ -321,6 +389,11 @@ std::string ABIFunctions::abiEncodingFunction(
 			case DataLocation::Memory:
 				if (fromArray->isByteArrayOrString())
 					return abiEncodingFunctionMemoryByteArray(*fromArray, *toArray, _options);
+				else if (
+					*fromArray->baseType() == *TypeProvider::uint256() ||
+					*fromArray->baseType() == FixedBytesType(32)
+				)
+					return abiEncodingFunctionMemoryArrayWithoutCleanup(*fromArray, *toArray, _options);
 				else
 					return abiEncodingFunctionSimpleArray(*fromArray, *toArray, _options);
 			case DataLocation::Storage:
@@ -521,6 +594,64 @@ std::string ABIFunctions::abiEncodingFunctionCalldataArrayWithoutCleanup(
 	});
 }
 
+std::string ABIFunctions::abiEncodingFunctionMemoryArrayWithoutCleanup(
+	ArrayType const& _from,
+	ArrayType const& _to,
+	EncodingOptions const& _options
+)
+{
+	solAssert(_from.dataStoredIn(DataLocation::Memory));
+	solAssert(!_from.isByteArrayOrString());
+	solAssert(
+		*_from.baseType() == *TypeProvider::uint256() ||
+		*_from.baseType() == FixedBytesType(32)
+	);
+	solAssert(_from.isDynamicallySized() == _to.isDynamicallySized());
+	solAssert(_from.length() == _to.length());
+	solAssert(_from.memoryStride() == 32 && _to.memoryStride() == 32);
+
+	std::string functionName =
+		"abi_encode_" +
+		_from.identifier() +
+		"_to_" +
+		_to.identifier() +
+		_options.toFunctionNameSuffix();
+	return createFunction(functionName, [&]() {
+		if (_from.isDynamicallySized())
+			return Whiskers(R"(
+				// <readableTypeNameFrom> -> <readableTypeNameTo>
+				function <functionName>(value, pos) -> end {
+					let length := <lengthFun>(value)
+					pos := <storeLength>(pos, length)
+					length := mul(length, 0x20)
+					<copyFun>(<dataAreaFun>(value), pos, length)
+					end := add(pos, length)
+				}
+			)")
+			("functionName", functionName)
+			("readableTypeNameFrom", _from.toString(true))
+			("readableTypeNameTo", _to.toString(true))
+			("lengthFun", m_utils.arrayLengthFunction(_from))
+			("storeLength", arrayStoreLengthForEncodingFunction(_to, _options))
+			("copyFun", m_utils.copyToMemoryFunction(false, /*cleanup*/false))
+			("dataAreaFun", m_utils.arrayDataAreaFunction(_from))
+			.render();
+		else
+			return Whiskers(R"(
+				// <readableTypeNameFrom> -> <readableTypeNameTo>
+				function <functionName>(value, pos) {
+					<copyFun>(value, pos, <byteLength>)
+				}
+			)")
+			("functionName", functionName)
+			("readableTypeNameFrom", _from.toString(true))
+			("readableTypeNameTo", _to.toString(true))
+			("copyFun", m_utils.copyToMemoryFunction(false, /*cleanup*/false))
+			("byteLength", toCompactHexWithPrefix(_from.length() * 32))
+			.render();
+	});
+}
+
 std::string ABIFunctions::abiEncodingFunctionSimpleArray(
 	ArrayType const& _from,
 	ArrayType const& _to,
@@ -175,6 +175,13 @@ public:
 	std::string abiDecodingFunctionStruct(StructType const& _type, bool _fromMemory);
 
 private:
+	/// Part of @a tupleDecoder for tuples of at least two static value types that each occupy one word.
+	/// Checks the size of the data once and validates all values in a single condition.
+	std::string staticValueTupleDecoder(
+		std::string const& _functionName,
+		TypePointers const& _types,
+		bool _fromMemory
+	);
 	/// Part of @a abiEncodingFunction for array target type and given calldata array.
 	/// Uses calldatacopy and does not perform cleanup or validation and can therefore only
 	/// be used for byte arrays and arrays with the base type uint256 or bytes32.
@@ -183,6 +190,14 @@ private:
 		Type const& _targetType,
 		EncodingOptions const& _options
 	);
+	/// Part of @a abiEncodingFunction for array target type and given memory array with the
+	/// base type uint256 or bytes32. Since these arrays are already in ABI layout in memory,
+	/// their data is copied as a whole without cleanup.
+	std::string abiEncodingFunctionMemoryArrayWithoutCleanup(
+		ArrayType const& _givenType,
+		ArrayType const& _targetType,
+		EncodingOptions const& _options
+	);
 	/// Part of @a abiEncodingFunction for array target type and given memory array or
 	/// a given storage array with every item occupies one or multiple full slots.
 	std::string abiEncodingFunctionSimpleArray(
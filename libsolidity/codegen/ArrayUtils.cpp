@@ -98,6 +98,25 @@ void ArrayUtils::copyArrayToStorage(ArrayType const& _targetType, ArrayType cons
 		return;
 	}
 
+	if (
+		_sourceType.location() == DataLocation::Memory &&
+		targetBaseType->isValueType() &&
+		targetBaseType->storageBytes() <= 16
+	)
+	{
+		// Several elements share a slot, so combine them and store each slot only once.
+		// stack: target_ref source_ref
+		m_context << Instruction::DUP2;
+		// stack: target_ref source_ref target_ref
+		m_context.callYulFunction(
+			m_context.utilFunctions().copyValueArrayToStorageFunction(_sourceType, _targetType),
+			2,
+			0
+		);
+		// stack: target_ref
+		return;
+	}
+
 	// retrieve source length
 	if (_sourceType.location() != DataLocation::CallData || !_sourceType.isDynamicallySized())
 		retrieveLength(_sourceType); // otherwise, length is already there
@@ -355,7 +374,7 @@ void ArrayUtils::copyArrayToMemory(ArrayType const& _sourceType, bool _padToWord
 			return;
 		}
 
-		// memcpy using the built-in contract
+		// memcpy using a loop or mcopy
 		if (_sourceType.isDynamicallySized())
 		{
 			// change pointer to data part
@@ -427,21 +446,22 @@ void ArrayUtils::copyArrayToMemory(ArrayType const& _sourceType, bool _padToWord
 		u256 storageSize = _sourceType.baseType()->storageSize();
 		solAssert(storageSize > 1 || (storageSize == 1 && storageBytes > 0), "");
 
-		retrieveLength(_sourceType);
-		// stack here: memory_offset storage_offset length
-		// jump to end if length is zero
-		m_context << Instruction::DUP1 << Instruction::ISZERO;
-		evmasm::AssemblyItem loopEnd = m_context.appendConditionalJump();
+		evmasm::AssemblyItem loopEnd = m_context.newTag();
 		// Special case for tightly-stored byte arrays
 		if (_sourceType.isByteArrayOrString())
 		{
-			// stack here: memory_offset storage_offset length
-			m_context << Instruction::DUP1 << u256(31) << Instruction::LT;
+			// Short byte arrays are stored together with their length, so the slot is loaded only once.
+			// stack here: memory_offset storage_offset
+			m_context << Instruction::DUP1 << Instruction::SLOAD << Instruction::DUP1;
+			m_context.callYulFunction(m_context.utilFunctions().extractByteArrayLengthFunction(), 1, 1);
+			m_context << Instruction::SWAP1;
+			// stack here: memory_offset storage_offset length slot_value
+			m_context << Instruction::DUP2 << Instruction::ISZERO;
+			evmasm::AssemblyItem emptyByteArray = m_context.appendConditionalJump();
+			m_context << Instruction::DUP1 << u256(1) << Instruction::AND;
 			evmasm::AssemblyItem longByteArray = m_context.appendConditionalJump();
 			// store the short byte array (discard lower-order byte)
-			m_context << u256(0x100) << Instruction::DUP1;
-			m_context << Instruction::DUP4 << Instruction::SLOAD;
-			m_context << Instruction::DIV << Instruction::MUL;
+			m_context << ~u256(0xff) << Instruction::AND;
 			m_context << Instruction::DUP4 << Instruction::MSTORE;
 			// stack here: memory_offset storage_offset length
 			// add 32 or length to memory offset
@@ -453,11 +473,22 @@ void ArrayUtils::copyArrayToMemory(ArrayType const& _sourceType, bool _padToWord
 			m_context << Instruction::ADD;
 			m_context << Instruction::SWAP2;
 			m_context.appendJumpTo(loopEnd);
-			m_context << longByteArray;
+			m_context.adjustStackOffset(1);
+			m_context << emptyByteArray << Instruction::POP;
+			m_context.appendJumpTo(loopEnd);
+			m_context.adjustStackOffset(1);
+			m_context << longByteArray << Instruction::POP;
 		}
 		else
+		{
+			retrieveLength(_sourceType);
+			// stack here: memory_offset storage_offset length
+			// jump to end if length is zero
+			m_context << Instruction::DUP1 << Instruction::ISZERO;
+			m_context.appendConditionalJumpTo(loopEnd);
 			// convert length to memory size
 			m_context << _sourceType.baseType()->memoryHeadSize() << Instruction::MUL;
+		}
 
 		m_context << Instruction::DUP3 << Instruction::ADD << Instruction::SWAP2;
 		if (_sourceType.isDynamicallySized())
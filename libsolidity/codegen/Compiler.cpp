@@ -25,6 +25,7 @@
 
 #include <libsolidity/codegen/ContractCompiler.h>
 #include <libevmasm/Assembly.h>
+#include <libsolutil/PhaseTracer.h>
 
 using namespace solidity;
 using namespace solidity::frontend;
@@ -48,7 +49,10 @@ void Compiler::compileContract(
 	ContractCompiler creationCompiler(&runtimeCompiler, m_context, creationSettings);
 	m_runtimeSub = creationCompiler.compileConstructor(_contract, _otherCompilers);
 
-	m_context.optimise(m_optimiserSettings);
+	{
+		util::PhaseTracer::Scope tracerScope("Assembly::optimise", _contract.fullyQualifiedName());
+		m_context.optimise(m_optimiserSettings);
+	}
 
 	solAssert(m_context.appendYulUtilityFunctionsRan(), "appendYulUtilityFunctions() was not called.");
 	solAssert(m_runtimeContext.appendYulUtilityFunctionsRan(), "appendYulUtilityFunctions() was not called.");
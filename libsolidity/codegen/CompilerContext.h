@@ -63,13 +63,15 @@ public:
 	explicit CompilerContext(
 		langutil::EVMVersion _evmVersion,
 		RevertStrings _revertStrings,
-		CompilerContext* _runtimeContext = nullptr
+		CompilerContext* _runtimeContext = nullptr,
+		std::shared_ptr<MultiUseYulFunctionCache> _yulFunctionCache = {}
 	):
 		m_asm(std::make_shared<evmasm::Assembly>(_evmVersion, _runtimeContext != nullptr, std::string{})),
 		m_evmVersion(_evmVersion),
 		m_revertStrings(_revertStrings),
 		m_reservedMemory{0},
 		m_runtimeContext(_runtimeContext),
+		m_yulFunctionCollector(std::move(_yulFunctionCache)),
 		m_abiFunctions(m_evmVersion, m_revertStrings, m_yulFunctionCollector),
 		m_yulUtilFunctions(m_evmVersion, m_revertStrings, m_yulFunctionCollector)
 	{
@@ -101,7 +103,11 @@ public:
 	unsigned numberOfLocalVariables() const;
 
 	void setOtherCompilers(std::map<ContractDefinition const*, std::shared_ptr<Compiler const>> const& _otherCompilers) { m_otherCompilers = _otherCompilers; }
+	/// @returns the creation assembly of a contract compiled before. All contracts creating
+	/// @a _contract share this assembly as a sub-assembly. It is optimised and assembled only
+	/// once, since evmasm::Assembly caches the results of both.
 	std::shared_ptr<evmasm::Assembly> compiledContract(ContractDefinition const& _contract) const;
+	/// @returns the shared runtime assembly of a contract compiled before, see compiledContract.
 	std::shared_ptr<evmasm::Assembly> compiledContractRuntime(ContractDefinition const& _contract) const;
 
 	void setStackOffset(int _offset) { m_asm->setDeposit(_offset); }
@@ -109,13 +109,31 @@ void CompilerUtils::revertWithError(
 	std::vector<Type const*> const& _argumentTypes
 )
 {
-	fetchFreeMemoryPointer();
+	// If the encoded error fits, it is written to the scratch space starting at zero,
+	// since memory is not used anymore after the revert.
+	bool useScratchSpace = true;
+	size_t encodedSize = 4;
+	for (Type const* type: _parameterTypes)
+		if (type->isValueType())
+			encodedSize += type->calldataHeadSize();
+		else
+			useScratchSpace = false;
+	useScratchSpace = useScratchSpace && encodedSize <= generalPurposeMemoryStart;
+
+	if (useScratchSpace)
+		m_context << u256(0);
+	else
+		fetchFreeMemoryPointer();
 	m_context << util::selectorFromSignatureU256(_signature);
 	m_context << Instruction::DUP2 << Instruction::MSTORE;
 	m_context << u256(4) << Instruction::ADD;
 	// Stack: <arguments...> <mem pos of encoding start>
 	abiEncode(_argumentTypes, _parameterTypes);
-	toSizeAfterFreeMemoryPointer();
+	// Stack: <mem pos of encoding end>
+	if (useScratchSpace)
+		m_context << u256(0);
+	else
+		toSizeAfterFreeMemoryPointer();
 	m_context << Instruction::REVERT;
 }
 
@@ -666,6 +684,13 @@ void CompilerUtils::memoryCopy32()
 {
 	// Stack here: size target source
 
+	if (m_context.evmVersion().hasMcopy())
+	{
+		// Copying exactly size bytes is allowed as well.
+		m_context << Instruction::SWAP1 << Instruction::MCOPY;
+		return;
+	}
+
 	m_context.appendInlineAssembly(R"(
 		{
 			for { let i := 0 } lt(i, len) { i := add(i, 32) } {
@@ -682,6 +707,12 @@ void CompilerUtils::memoryCopy()
 {
 	// Stack here: size target source
 
+	if (m_context.evmVersion().hasMcopy())
+	{
+		m_context << Instruction::SWAP1 << Instruction::MCOPY;
+		return;
+	}
+
 	m_context.appendInlineAssembly(R"(
 		{
 			// copy 32 bytes at once
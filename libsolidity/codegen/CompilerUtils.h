@@ -70,6 +70,11 @@ public:
 	/// Stack post:
 	void revertWithStringData(Type const& _argumentType);
 
+	/// Reverts with the error @a _errorName, ABI-encoding the arguments on the stack.
+	/// If all parameters are value types and the encoding fits, it is written to memory
+	/// starting at zero instead of at the free memory pointer.
+	/// Stack pre: <arguments...>
+	/// Stack post:
 	void revertWithError(
 		std::string const& _errorName,
 		std::vector<Type const*> const& _parameterTypes,
@@ -205,11 +210,13 @@ public:
 
 	/// Copies full 32 byte words in memory (regions cannot overlap), i.e. may copy more than length.
 	/// Length can be zero, in this case, it copies nothing.
+	/// Uses ``mcopy`` if the EVM version supports it, which copies exactly length bytes.
 	/// Stack pre: <size> <target> <source>
 	/// Stack post:
 	void memoryCopy32();
 	/// Copies data in memory (regions cannot overlap).
 	/// Length can be zero, in this case, it copies nothing.
+	/// Uses ``mcopy`` if the EVM version supports it.
 	/// Stack pre: <size> <target> <source>
 	/// Stack post:
 	void memoryCopy();
@@ -322,6 +322,75 @@ void ContractCompiler::appendDelegatecallCheck()
 	// "We have not been called via DELEGATECALL".
 }
 
+namespace
+{
+
+/// @returns true if the selection from @a _count functions should be split,
+/// see ContractCompiler::appendInternalSelector for the cost model.
+bool splitSelection(size_t _count, size_t _runs)
+{
+	// Start with some comparisons to avoid overflow, then do the actual comparison.
+	if (_count <= 4)
+		return false;
+	else if (_runs > (17 * evmasm::GasCosts::createDataGas) / 6)
+		return true;
+	else
+		return _runs * 6 * (_count - 4) > 17 * evmasm::GasCosts::createDataGas;
+}
+
+/// @returns the average execution cost of selecting from @a _count functions.
+size_t averageSelectionCost(size_t _count, size_t _runs)
+{
+	if (splitSelection(_count, _runs))
+		return 24 + averageSelectionCost(_count - _count / 2, _runs);
+	return 12 * _count;
+}
+
+/// Removes the functions from @a _ids that are called so often according to @a _calls
+/// that checking them before selecting from the others is cheaper on average and
+/// @returns them, the most frequently called first.
+std::vector<FixedHash<4>> extractFrequentlyCalled(
+	std::vector<FixedHash<4>>& _ids,
+	std::map<FixedHash<4>, size_t> const& _calls,
+	size_t _runs
+)
+{
+	std::vector<FixedHash<4>> byCalls;
+	bigint remainingCalls = 0;
+	for (FixedHash<4> const& id: _ids)
+		if (size_t const* calls = util::valueOrNullptr(_calls, id))
+		{
+			byCalls.emplace_back(id);
+			remainingCalls += *calls;
+		}
+	std::stable_sort(byCalls.begin(), byCalls.end(), [&](FixedHash<4> const& _a, FixedHash<4> const& _b) {
+		return _calls.at(_a) > _calls.at(_b);
+	});
+
+	// A check costs 24 gas (dup1, push4, eq, push2/3, jumpi). Checking a function first saves
+	// the selection cost for its calls and adds the check to the calls of all the others.
+	std::vector<FixedHash<4>> result;
+	for (FixedHash<4> const& id: byCalls)
+	{
+		bigint const calls = _calls.at(id);
+		size_t const count = _ids.size() - result.size();
+		bigint const costBefore = remainingCalls * averageSelectionCost(count, _runs);
+		bigint const costAfter = calls * 24 + (remainingCalls - calls) * (24 + averageSelectionCost(count - 1, _runs));
+		if (costAfter >= costBefore)
+			break;
+		result.emplace_back(id);
+		remainingCalls -= calls;
+	}
+	std::set<FixedHash<4>> const extracted{result.begin(), result.end()};
+	_ids.erase(
+		std::remove_if(_ids.begin(), _ids.end(), [&](FixedHash<4> const& _id) { return extracted.count(_id); }),
+		_ids.end()
+	);
+	return result;
+}
+
+}
+
 void ContractCompiler::appendInternalSelector(
 	std::map<FixedHash<4>, evmasm::AssemblyItem const> const& _entryPoints,
 	std::vector<FixedHash<4>> const& _ids,
@@ -351,17 +420,7 @@ void ContractCompiler::appendInternalSelector(
 	//
 	// Which also means that the execution itself is not profitable
 	// unless we have at least 5 functions.
-
-	// Start with some comparisons to avoid overflow, then do the actual comparison.
-	bool split = false;
-	if (_ids.size() <= 4)
-		split = false;
-	else if (_runs > (17 * evmasm::GasCosts::createDataGas) / 6)
-		split = true;
-	else
-		split = (_runs * 6 * (_ids.size() - 4) > 17 * evmasm::GasCosts::createDataGas);
-
-	if (split)
+	if (splitSelection(_ids.size(), _runs))
 	{
 		size_t pivotIndex = _ids.size() / 2;
 		FixedHash<4> pivot{_ids.at(pivotIndex)};
@@ -454,6 +513,16 @@ void ContractCompiler::appendFunctionSelector(ContractDefinition const& _contrac
 			sortedIDs.emplace_back(it.first);
 		}
 		std::sort(sortedIDs.begin(), sortedIDs.end());
+
+		std::map<FixedHash<4>, size_t> calls;
+		for (auto const& [id, type]: interfaceFunctions)
+			if (size_t const* profiledCalls = util::valueOrNullptr(m_optimiserSettings.dispatchProfile, type->externalSignature()))
+				calls[id] = *profiledCalls;
+		for (FixedHash<4> const& id: extractFrequentlyCalled(sortedIDs, calls, m_optimiserSettings.expectedExecutionsPerDeployment))
+		{
+			m_context << dupInstruction(1) << u256(FixedHash<4>::Arith(id)) << Instruction::EQ;
+			m_context.appendConditionalJumpTo(callDataUnpackerEntryPoints.at(id));
+		}
 		appendInternalSelector(callDataUnpackerEntryPoints, sortedIDs, notFound, m_optimiserSettings.expectedExecutionsPerDeployment);
 	}
 
@@ -570,8 +639,9 @@ void ContractCompiler::appendReturnValuePacker(TypePointers const& _typeParamete
 
 void ContractCompiler::registerStateVariables(ContractDefinition const& _contract)
 {
-	for (auto const& var: ContractType(_contract).stateVariables())
-		m_context.addStateVariable(*std::get<0>(var), std::get<1>(var), std::get<2>(var));
+	for (bool transient: {false, true})
+		for (auto const& var: ContractType(_contract).stateVariables(transient))
+			m_context.addStateVariable(*std::get<0>(var), std::get<1>(var), std::get<2>(var));
 }
 
 void ContractCompiler::registerImmutableVariables(ContractDefinition const& _contract)
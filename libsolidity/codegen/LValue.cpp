@@ -198,15 +198,18 @@ void ImmutableItem::setToZero(SourceLocation const&, bool _removeReference) cons
 	m_context << Instruction::POP;
 }
 
-StorageItem::StorageItem(CompilerContext& _compilerContext, VariableDeclaration const& _declaration):
-	StorageItem(_compilerContext, *_declaration.annotation().type)
+template<bool IsTransient>
+GenericStorageItem<IsTransient>::GenericStorageItem(CompilerContext& _compilerContext, VariableDeclaration const& _declaration):
+	GenericStorageItem(_compilerContext, *_declaration.annotation().type)
 {
 	solAssert(!_declaration.immutable(), "");
+	solAssert(_declaration.isTransient() == IsTransient, "");
 	auto const& location = m_context.storageLocationOfVariable(_declaration);
 	m_context << location.first << u256(location.second);
 }
 
-StorageItem::StorageItem(CompilerContext& _compilerContext, Type const& _type):
+template<bool IsTransient>
+GenericStorageItem<IsTransient>::GenericStorageItem(CompilerContext& _compilerContext, Type const& _type):
 	LValue(_compilerContext, &_type)
 {
 	if (m_dataType->isValueType())
@@ -217,7 +220,8 @@ StorageItem::StorageItem(CompilerContext& _compilerContext, Type const& _type):
 	}
 }
 
-void StorageItem::retrieveValue(SourceLocation const&, bool _remove) const
+template<bool IsTransient>
+void GenericStorageItem<IsTransient>::retrieveValue(SourceLocation const&, bool _remove) const
 {
 	// stack: storage_key storage_offset
 	if (!m_dataType->isValueType())
@@ -232,7 +236,7 @@ void StorageItem::retrieveValue(SourceLocation const&, bool _remove) const
 	if (!_remove)
 		CompilerUtils(m_context).copyToStackTop(sizeOnStack(), sizeOnStack());
 	if (m_dataType->storageBytes() == 32)
-		m_context << Instruction::POP << Instruction::SLOAD;
+		m_context << Instruction::POP << s_loadInstruction;
 	else
 	{
 		Type const* type = m_dataType;
@@ -240,7 +244,7 @@ void StorageItem::retrieveValue(SourceLocation const&, bool _remove) const
 			type = type->encodingType();
 		bool cleaned = false;
 		m_context
-			<< Instruction::SWAP1 << Instruction::SLOAD << Instruction::SWAP1
+			<< Instruction::SWAP1 << s_loadInstruction << Instruction::SWAP1
 			<< u256(0x100) << Instruction::EXP << Instruction::SWAP1 << Instruction::DIV;
 		if (type->category() == Type::Category::FixedPoint)
 			// implementation should be very similar to the integer case.
@@ -281,7 +285,8 @@ void StorageItem::retrieveValue(SourceLocation const&, bool _remove) const
 	}
 }
 
-void StorageItem::storeValue(Type const& _sourceType, SourceLocation const& _location, bool _move) const
+template<bool IsTransient>
+void GenericStorageItem<IsTransient>::storeValue(Type const& _sourceType, SourceLocation const& _location, bool _move) const
 {
 	CompilerUtils utils(m_context);
 	solAssert(m_dataType, "");
@@ -303,7 +308,7 @@ void StorageItem::storeValue(Type const& _sourceType, SourceLocation const& _loc
 			utils.convertType(_sourceType, *m_dataType, true);
 			m_context << Instruction::SWAP1;
 
-			m_context << Instruction::SSTORE;
+			m_context << s_storeInstruction;
 		}
 		else
 		{
@@ -311,7 +316,7 @@ void StorageItem::storeValue(Type const& _sourceType, SourceLocation const& _loc
 			m_context << u256(0x100) << Instruction::EXP;
 			// stack: value storage_ref multiplier
 			// fetch old value
-			m_context << Instruction::DUP2 << Instruction::SLOAD;
+			m_context << Instruction::DUP2 << s_loadInstruction;
 			// stack: value storage_ref multiplier old_full_value
 			// clear bytes in old value
 			m_context
@@ -358,7 +363,7 @@ void StorageItem::storeValue(Type const& _sourceType, SourceLocation const& _loc
 			}
 			m_context  << Instruction::MUL << Instruction::OR;
 			// stack: value storage_ref updated_value
-			m_context << Instruction::SWAP1 << Instruction::SSTORE;
+			m_context << Instruction::SWAP1 << s_storeInstruction;
 			if (_move)
 				utils.popStackElement(*m_dataType);
 		}
@@ -448,7 +453,8 @@ void StorageItem::storeValue(Type const& _sourceType, SourceLocation const& _loc
 	}
 }
 
-void StorageItem::setToZero(SourceLocation const&, bool _removeReference) const
+template<bool IsTransient>
+void GenericStorageItem<IsTransient>::setToZero(SourceLocation const&, bool _removeReference) const
 {
 	if (m_dataType->category() == Type::Category::Array)
 	{
@@ -487,14 +493,14 @@ void StorageItem::setToZero(SourceLocation const&, bool _removeReference) const
 			// offset should be zero
 			m_context
 				<< Instruction::POP << u256(0)
-				<< Instruction::SWAP1 << Instruction::SSTORE;
+				<< Instruction::SWAP1 << s_storeInstruction;
 		}
 		else
 		{
 			m_context << u256(0x100) << Instruction::EXP;
 			// stack: storage_ref multiplier
 			// fetch old value
-			m_context << Instruction::DUP2 << Instruction::SLOAD;
+			m_context << Instruction::DUP2 << s_loadInstruction;
 			// stack: storage_ref multiplier old_full_value
 			// clear bytes in old value
 			m_context
@@ -502,11 +508,14 @@ void StorageItem::setToZero(SourceLocation const&, bool _removeReference) const
 				<< Instruction::MUL;
 			m_context << Instruction::NOT << Instruction::AND;
 			// stack: storage_ref cleared_value
-			m_context << Instruction::SWAP1 << Instruction::SSTORE;
+			m_context << Instruction::SWAP1 << s_storeInstruction;
 		}
 	}
 }
 
+template class solidity::frontend::GenericStorageItem<false>;
+template class solidity::frontend::GenericStorageItem<true>;
+
 StorageByteArrayElement::StorageByteArrayElement(CompilerContext& _compilerContext):
 	LValue(_compilerContext, TypeProvider::byte())
 {
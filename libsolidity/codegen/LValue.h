@@ -24,6 +24,7 @@
 #pragma once
 
 #include <libsolidity/codegen/ArrayUtils.h>
+#include <libevmasm/Instruction.h>
 #include <libsolutil/Common.h>
 #include <liblangutil/SourceLocation.h>
 #include <memory>
@@ -149,17 +150,19 @@ private:
 };
 
 /**
- * Reference to some item in storage. On the stack this is <storage key> <offset_inside_value>,
- * where 0 <= offset_inside_value < 32 and an offset of i means that the value is multiplied
- * by 2**i before storing it.
+ * Reference to some item in storage or, if @a IsTransient is true, in transient storage.
+ * On the stack this is <storage key> <offset_inside_value>, where 0 <= offset_inside_value < 32
+ * and an offset of i means that the value is multiplied by 2**i before storing it.
+ * Only value types are supported in transient storage.
  */
-class StorageItem: public LValue
+template<bool IsTransient>
+class GenericStorageItem: public LValue
 {
 public:
 	/// Constructs the LValue and pushes the location of @a _declaration onto the stack.
-	StorageItem(CompilerContext& _compilerContext, VariableDeclaration const& _declaration);
+	GenericStorageItem(CompilerContext& _compilerContext, VariableDeclaration const& _declaration);
 	/// Constructs the LValue and assumes that the storage reference is already on the stack.
-	StorageItem(CompilerContext& _compilerContext, Type const& _type);
+	GenericStorageItem(CompilerContext& _compilerContext, Type const& _type);
 	unsigned sizeOnStack() const override { return 2; }
 	void retrieveValue(langutil::SourceLocation const& _location, bool _remove = false) const override;
 	void storeValue(
@@ -171,8 +174,15 @@ public:
 		langutil::SourceLocation const& _location = {},
 		bool _removeReference = true
 	) const override;
+
+private:
+	static constexpr evmasm::Instruction s_loadInstruction = IsTransient ? evmasm::Instruction::TLOAD : evmasm::Instruction::SLOAD;
+	static constexpr evmasm::Instruction s_storeInstruction = IsTransient ? evmasm::Instruction::TSTORE : evmasm::Instruction::SSTORE;
 };
 
+using StorageItem = GenericStorageItem<false>;
+using TransientStorageItem = GenericStorageItem<true>;
+
 /**
  * Reference to a single byte inside a storage byte array.
  * Stack: <storage_ref> <byte_number>
@@ -23,6 +23,7 @@
 #include <libsolidity/codegen/MultiUseYulFunctionCollector.h>
 
 #include <liblangutil/Exceptions.h>
+#include <libsolutil/CommonData.h>
 #include <libsolutil/Whiskers.h>
 #include <libsolutil/StringUtils.h>
 
@@ -30,25 +31,38 @@ using namespace solidity;
 using namespace solidity::frontend;
 using namespace solidity::util;
 
+std::shared_ptr<MultiUseYulFunctionCache::Function const> MultiUseYulFunctionCache::find(std::string const& _name) const
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	if (auto const* function = util::valueOrNullptr(m_functions, _name))
+		return *function;
+	return nullptr;
+}
+
+void MultiUseYulFunctionCache::store(std::string const& _name, std::shared_ptr<Function const> _function)
+{
+	solAssert(_function);
+	std::lock_guard<std::mutex> lock(m_mutex);
+	m_functions.emplace(_name, std::move(_function));
+}
+
 std::string MultiUseYulFunctionCollector::requestedFunctions()
 {
-	std::string result = std::move(m_code);
-	m_code.clear();
+	size_t size = 0;
+	for (auto const& function: m_generatedFunctions)
+		size += function->code.size();
+	std::string result;
+	result.reserve(size);
+	for (auto const& function: m_generatedFunctions)
+		result += function->code;
+	m_generatedFunctions.clear();
 	m_requestedFunctions.clear();
 	return result;
 }
 
 std::string MultiUseYulFunctionCollector::createFunction(std::string const& _name, std::function<std::string()> const& _creator)
 {
-	if (!m_requestedFunctions.count(_name))
-	{
-		m_requestedFunctions.insert(_name);
-		std::string fun = _creator();
-		solAssert(!fun.empty(), "");
-		solAssert(fun.find("function " + _name + "(") != std::string::npos, "Function not properly named.");
-		m_code += std::move(fun);
-	}
-	return _name;
+	return addFunction(_name, true, _creator);
 }
 
 std::string MultiUseYulFunctionCollector::createFunction(
@@ -57,24 +71,101 @@ std::string MultiUseYulFunctionCollector::createFunction(
 )
 {
 	solAssert(!_name.empty(), "");
-	if (!m_requestedFunctions.count(_name))
+	return addFunction(_name, true, [&]() { return assembleFunction(_name, _creator); });
+}
+
+std::string MultiUseYulFunctionCollector::createUncachedFunction(std::string const& _name, std::function<std::string()> const& _creator)
+{
+	return addFunction(_name, false, _creator);
+}
+
+std::string MultiUseYulFunctionCollector::createUncachedFunction(
+	std::string const& _name,
+	std::function<std::string(std::vector<std::string>&, std::vector<std::string>&)> const& _creator
+)
+{
+	solAssert(!_name.empty(), "");
+	return addFunction(_name, false, [&]() { return assembleFunction(_name, _creator); });
+}
+
+std::string MultiUseYulFunctionCollector::addFunction(
+	std::string const& _name,
+	bool _cached,
+	std::function<std::string()> const& _generator
+)
+{
+	bool const useCache = _cached && m_cache;
+	// The code of a cached function cannot depend on functions that are not cached.
+	solAssert(useCache || m_pendingDependencies.empty(), "Uncached function " + _name + " requested by cached function.");
+	if (useCache && !m_pendingDependencies.empty())
+		m_pendingDependencies.back().push_back(_name);
+
+	if (m_requestedFunctions.count(_name))
+		return _name;
+
+	if (useCache)
+		if (std::shared_ptr<MultiUseYulFunctionCache::Function const> cachedFunction = m_cache->find(_name))
+		{
+			addCachedFunction(_name, cachedFunction);
+			return _name;
+		}
+
+	m_requestedFunctions.insert(_name);
+	auto function = std::make_shared<MultiUseYulFunctionCache::Function>();
+	if (useCache)
 	{
-		m_requestedFunctions.insert(_name);
-		std::vector<std::string> arguments;
-		std::vector<std::string> returnParameters;
-		std::string body = _creator(arguments, returnParameters);
-		solAssert(!body.empty(), "");
-
-		m_code += Whiskers(R"(
-			function <functionName>(<args>)<?+retParams> -> <retParams></+retParams> {
-				<body>
-			}
-		)")
-		("functionName", _name)
-		("args", joinHumanReadable(arguments))
-		("retParams", joinHumanReadable(returnParameters))
-		("body", body)
-		.render();
+		m_pendingDependencies.emplace_back();
+		ScopeGuard popDependencies([&]() {
+			function->dependencies = std::move(m_pendingDependencies.back());
+			m_pendingDependencies.pop_back();
+		});
+		function->code = _generator();
 	}
+	else
+		function->code = _generator();
+	solAssert(!function->code.empty(), "");
+	solAssert(function->code.find("function " + _name + "(") != std::string::npos, "Function not properly named.");
+	m_generatedFunctions.push_back(function);
+	if (useCache)
+		m_cache->store(_name, std::move(function));
 	return _name;
 }
+
+void MultiUseYulFunctionCollector::addCachedFunction(
+	std::string const& _name,
+	std::shared_ptr<MultiUseYulFunctionCache::Function const> const& _function
+)
+{
+	// Add the dependencies in the same order in which generating the code would add them.
+	m_requestedFunctions.insert(_name);
+	for (std::string const& dependency: _function->dependencies)
+		if (!m_requestedFunctions.count(dependency))
+		{
+			std::shared_ptr<MultiUseYulFunctionCache::Function const> cachedDependency = m_cache->find(dependency);
+			solAssert(cachedDependency, "Dependency " + dependency + " of cached function " + _name + " not cached.");
+			addCachedFunction(dependency, cachedDependency);
+		}
+	m_generatedFunctions.push_back(_function);
+}
+
+std::string MultiUseYulFunctionCollector::assembleFunction(
+	std::string const& _name,
+	std::function<std::string(std::vector<std::string>&, std::vector<std::string>&)> const& _creator
+)
+{
+	std::vector<std::string> arguments;
+	std::vector<std::string> returnParameters;
+	std::string body = _creator(arguments, returnParameters);
+	solAssert(!body.empty(), "");
+
+	return Whiskers(R"(
+		function <functionName>(<args>)<?+retParams> -> <retParams></+retParams> {
+			<body>
+		}
+	)")
+	("functionName", _name)
+	("args", joinHumanReadable(arguments))
+	("retParams", joinHumanReadable(returnParameters))
+	("body", body)
+	.render();
+}
@@ -24,19 +24,57 @@
 
 #include <functional>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <set>
+#include <vector>
 
 namespace solidity::frontend
 {
 
+/**
+ * Code of multi-use Yul functions, shared between the function collectors of all contracts
+ * of a compilation, so that the same utility function is generated only once.
+ * All collectors using the same cache have to generate the functions for the same
+ * EVM version and revert strings setting.
+ */
+class MultiUseYulFunctionCache
+{
+public:
+	struct Function
+	{
+		std::string code;
+		/// Names of the functions requested while generating the code, in the order of their requests.
+		std::vector<std::string> dependencies;
+	};
+
+	/// @returns the function called @a _name or null if it is not in the cache.
+	std::shared_ptr<Function const> find(std::string const& _name) const;
+	/// Stores @a _function as the function called @a _name unless it is already present.
+	void store(std::string const& _name, std::shared_ptr<Function const> _function);
+
+private:
+	mutable std::mutex m_mutex;
+	std::map<std::string, std::shared_ptr<Function const>> m_functions;
+};
+
 /**
  * Container of (unparsed) Yul functions identified by name which are meant to be generated
  * only once.
+ *
+ * If a cache is given, the code of functions created via ``createFunction`` is taken from
+ * and stored in it, so their code has to depend only on the name and the settings of the cache.
+ * Functions whose code depends on the contract being compiled have to be created via
+ * ``createUncachedFunction``.
  */
 class MultiUseYulFunctionCollector
 {
 public:
+	explicit MultiUseYulFunctionCollector(std::shared_ptr<MultiUseYulFunctionCache> _cache = {}):
+		m_cache(std::move(_cache))
+	{}
+
 	/// Helper function that uses @a _creator to create a function and add it to
 	/// @a m_requestedFunctions if it has not been created yet and returns @a _name in both
 	/// cases.
@@ -47,6 +85,14 @@ public:
 		std::function<std::string(std::vector<std::string>&, std::vector<std::string>&)> const& _creator
 	);
 
+	/// Same as the first variant of @a createFunction, but never uses the cache.
+	std::string createUncachedFunction(std::string const& _name, std::function<std::string()> const& _creator);
+	/// Same as the second variant of @a createFunction, but never uses the cache.
+	std::string createUncachedFunction(
+		std::string const& _name,
+		std::function<std::string(std::vector<std::string>&, std::vector<std::string>&)> const& _creator
+	);
+
 	/// @returns concatenation of all generated functions in the order in which they were
 	/// generated.
 	/// Clears the internal list, i.e. calling it again will result in an
@@ -56,9 +102,27 @@ public:
 	/// @returns true IFF a function with the specified name has already been collected.
 	bool contains(std::string const& _name) const { return m_requestedFunctions.count(_name) > 0; }
 
+	std::shared_ptr<MultiUseYulFunctionCache> const& cache() const { return m_cache; }
+
 private:
+	/// Adds the code produced by @a _generator for the function @a _name, using and filling
+	/// the cache unless @a _cached is false.
+	std::string addFunction(std::string const& _name, bool _cached, std::function<std::string()> const& _generator);
+	/// Adds @a _function taken from the cache and the functions it depends on.
+	void addCachedFunction(std::string const& _name, std::shared_ptr<MultiUseYulFunctionCache::Function const> const& _function);
+
+	static std::string assembleFunction(
+		std::string const& _name,
+		std::function<std::string(std::vector<std::string>&, std::vector<std::string>&)> const& _creator
+	);
+
+	std::shared_ptr<MultiUseYulFunctionCache> m_cache;
+	/// Functions requested by each of the cached functions that are currently being generated.
+	std::vector<std::vector<std::string>> m_pendingDependencies;
 	std::set<std::string> m_requestedFunctions;
-	std::string m_code;
+	/// The generated functions in the order of their generation. Their code is only
+	/// concatenated once in @a requestedFunctions and shared with the cache.
+	std::vector<std::shared_ptr<MultiUseYulFunctionCache::Function const>> m_generatedFunctions;
 };
 
 }
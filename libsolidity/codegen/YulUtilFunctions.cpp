@@ -761,6 +761,43 @@ std::string YulUtilFunctions::overflowCheckedIntAddFunction(IntegerType const& _
 	});
 }
 
+std::string YulUtilFunctions::overflowCheckedIntAddConstantFunction(IntegerType const& _type, bigint const& _constant)
+{
+	bigint const range = _type.maxValue() - _type.minValue();
+	solAssert(-range <= _constant && _constant <= range, "Constant out of range.");
+
+	std::string functionName =
+		"checked_add_constant_" +
+		std::string(_constant < 0 ? "minus_" : "") +
+		toCompactHexWithPrefix(u256(abs(_constant))) +
+		"_" +
+		_type.identifier();
+	return m_functionCollector.createFunction(functionName, [&]() {
+		std::string comparison = _type.isSigned() ? "s" : "";
+		comparison += _constant > 0 ? "gt" : "lt";
+		return
+			Whiskers(R"(
+			function <functionName>(x) -> sum {
+				x := <cleanupFunction>(x)
+				<?check>
+					if <comparison>(x, <bound>) { <panic>() }
+				</check>
+				sum := add(x, <constant>)
+			}
+			)")
+			("functionName", functionName)
+			("cleanupFunction", cleanupFunction(_type))
+			("check", _constant != 0)
+			("comparison", comparison)
+			// The result is out of range if x > max - c for positive and if x < min - c
+			// for negative constants.
+			("bound", toCompactHexWithPrefix(u256((_constant > 0 ? _type.maxValue() : _type.minValue()) - _constant)))
+			("constant", toCompactHexWithPrefix(u256(_constant)))
+			("panic", panicFunction(PanicCode::UnderOverflow))
+			.render();
+	});
+}
+
 std::string YulUtilFunctions::wrappingIntAddFunction(IntegerType const& _type)
 {
 	std::string functionName = "wrapping_add_" + _type.identifier();
@@ -2743,21 +2780,28 @@ std::string YulUtilFunctions::mappingIndexAccessFunction(MappingType const& _map
 	});
 }
 
-std::string YulUtilFunctions::readFromStorage(Type const& _type, size_t _offset, bool _splitFunctionTypes)
+std::string YulUtilFunctions::readFromStorage(
+	Type const& _type,
+	size_t _offset,
+	bool _splitFunctionTypes,
+	bool _transient
+)
 {
 	if (_type.isValueType())
-		return readFromStorageValueType(_type, _offset, _splitFunctionTypes);
+		return readFromStorageValueType(_type, _offset, _splitFunctionTypes, _transient);
 	else
 	{
 		solAssert(_offset == 0, "");
+		solAssert(!_transient, "Transient storage is only supported for value types.");
 		return readFromStorageReferenceType(_type);
 	}
 }
 
-std::string YulUtilFunctions::readFromStorageDynamic(Type const& _type, bool _splitFunctionTypes)
+std::string YulUtilFunctions::readFromStorageDynamic(Type const& _type, bool _splitFunctionTypes, bool _transient)
 {
 	if (_type.isValueType())
-		return readFromStorageValueType(_type, {}, _splitFunctionTypes);
+		return readFromStorageValueType(_type, {}, _splitFunctionTypes, _transient);
+	solAssert(!_transient, "Transient storage is only supported for value types.");
 	std::string functionName =
 		"read_from_storage__dynamic_" +
 		std::string(_splitFunctionTypes ? "split_" : "") +
@@ -2777,12 +2821,17 @@ std::string YulUtilFunctions::readFromStorageDynamic(Type const& _type, bool _sp
 	});
 }
 
-std::string YulUtilFunctions::readFromStorageValueType(Type const& _type, std::optional<size_t> _offset, bool _splitFunctionTypes)
+std::string YulUtilFunctions::readFromStorageValueType(
+	Type const& _type,
+	std::optional<size_t> _offset,
+	bool _splitFunctionTypes,
+	bool _transient
+)
 {
 	solAssert(_type.isValueType(), "");
 
 	std::string functionName =
-			"read_from_storage_" +
+			std::string(_transient ? "read_from_transient_storage_" : "read_from_storage_") +
 			std::string(_splitFunctionTypes ? "split_" : "") + (
 				_offset.has_value() ?
 				"offset_" + std::to_string(*_offset) :
@@ -2794,7 +2843,7 @@ std::string YulUtilFunctions::readFromStorageValueType(Type const& _type, std::o
 	return m_functionCollector.createFunction(functionName, [&] {
 		Whiskers templ(R"(
 			function <functionName>(slot<?dynamic>, offset</dynamic>) -> <?split>addr, selector<!split>value</split> {
-				<?split>let</split> value := <extract>(sload(slot)<?dynamic>, offset</dynamic>)
+				<?split>let</split> value := <extract>(<load>(slot)<?dynamic>, offset</dynamic>)
 				<?split>
 					addr, selector := <splitFunction>(value)
 				</split>
@@ -2802,6 +2851,7 @@ std::string YulUtilFunctions::readFromStorageValueType(Type const& _type, std::o
 		)");
 		templ("functionName", functionName);
 		templ("dynamic", !_offset.has_value());
+		templ("load", _transient ? "tload" : "sload");
 		if (_offset.has_value())
 			templ("extract", extractFromStorageValue(_type, *_offset));
 		else
@@ -2881,11 +2931,12 @@ std::string YulUtilFunctions::readFromCalldata(Type const& _type)
 std::string YulUtilFunctions::updateStorageValueFunction(
 	Type const& _fromType,
 	Type const& _toType,
-	std::optional<unsigned> const& _offset
+	std::optional<unsigned> const& _offset,
+	bool _transient
 )
 {
 	std::string const functionName =
-		"update_storage_value_" +
+		std::string(_transient ? "update_transient_storage_value_" : "update_storage_value_") +
 		(_offset.has_value() ? ("offset_" + std::to_string(*_offset)) : "") +
 		_fromType.identifier() +
 		"_to_" +
@@ -2901,11 +2952,13 @@ std::string YulUtilFunctions::updateStorageValueFunction(
 			return Whiskers(R"(
 				function <functionName>(slot, <offset><fromValues>) {
 					let <toValues> := <convert>(<fromValues>)
-					sstore(slot, <update>(sload(slot), <offset><prepare>(<toValues>)))
+					<store>(slot, <update>(<load>(slot), <offset><prepare>(<toValues>)))
 				}
 
 			)")
 			("functionName", functionName)
+			("load", _transient ? "tload" : "sload")
+			("store", _transient ? "tstore" : "sstore")
 			("update",
 				_offset.has_value() ?
 					updateByteSliceFunction(_toType.storageBytes(), *_offset) :
@@ -2919,6 +2972,7 @@ std::string YulUtilFunctions::updateStorageValueFunction(
 			.render();
 		}
 
+		solAssert(!_transient, "Transient storage is only supported for value types.");
 		auto const* toReferenceType = dynamic_cast<ReferenceType const*>(&_toType);
 		auto const* fromReferenceType = dynamic_cast<ReferenceType const*>(&_fromType);
 		solAssert(toReferenceType, "");
@@ -3203,6 +3257,21 @@ std::string YulUtilFunctions::finalizeAllocationFunction()
 	});
 }
 
+std::string YulUtilFunctions::releaseMemoryFunction()
+{
+	std::string functionName = "release_memory";
+	return m_functionCollector.createFunction(functionName, [&]() {
+		return Whiskers(R"(
+			function <functionName>(memPtr) {
+				mstore(<freeMemoryPointer>, memPtr)
+			}
+		)")
+		("functionName", functionName)
+		("freeMemoryPointer", std::to_string(CompilerUtils::freeMemoryPointer))
+		.render();
+	});
+}
+
 std::string YulUtilFunctions::zeroMemoryArrayFunction(ArrayType const& _type)
 {
 	if (_type.baseType()->hasSimpleZeroValueInMemory())
@@ -3705,9 +3774,11 @@ std::string YulUtilFunctions::copyStructToStorageFunction(StructType const& _fro
 		Whiskers templ(R"(
 			<?fromStorage> if iszero(eq(slot, value)) { </fromStorage>
 			<#member>
+			<slotPrologue>
 			{
 				<updateMemberCall>
 			}
+			<slotEpilogue>
 			</member>
 			<?fromStorage> } </fromStorage>
 		)");
@@ -3716,6 +3787,13 @@ std::string YulUtilFunctions::copyStructToStorageFunction(StructType const& _fro
 		MemberList::MemberMap structMembers = _from.nativeMembers(nullptr);
 		MemberList::MemberMap toStructMembers = _to.nativeMembers(nullptr);
 
+		// Value type members that share a slot are combined into a single word that is written
+		// with one sstore instead of reading and writing the slot once per member.
+		std::map<u256, std::vector<size_t>> packedMembersBySlot;
+		for (size_t i = 0; i < toStructMembers.size(); ++i)
+			if (toStructMembers[i].type->isValueType())
+				packedMembersBySlot[_to.storageOffsetsOfMember(toStructMembers[i].name).first].push_back(i);
+
 		std::vector<std::map<std::string, std::string>> memberParams(structMembers.size());
 		for (size_t i = 0; i < structMembers.size(); ++i)
 		{
@@ -3723,6 +3801,25 @@ std::string YulUtilFunctions::copyStructToStorageFunction(StructType const& _fro
 			solAssert(memberType.memoryHeadSize() == 32, "");
 			auto const&[slotDiff, offset] = _to.storageOffsetsOfMember(structMembers[i].name);
 
+			std::vector<size_t> const* slotMembers = nullptr;
+			if (auto it = packedMembersBySlot.find(slotDiff); it != packedMembersBySlot.end() && it->second.size() > 1)
+				slotMembers = &it->second;
+			std::string slotValue = "slotValue_" + slotDiff.str();
+			memberParams[i]["slotPrologue"] = "";
+			memberParams[i]["slotEpilogue"] = "";
+			if (slotMembers && slotMembers->front() == i)
+			{
+				size_t slotBytes = 0;
+				for (size_t member: *slotMembers)
+					slotBytes += toStructMembers[member].type->storageBytes();
+				// The slot does not need to be read if it is entirely covered by the members.
+				memberParams[i]["slotPrologue"] =
+					"let " + slotValue + " := " +
+					(slotBytes == 32 ? "0" : "sload(add(slot, " + slotDiff.str() + "))");
+			}
+			if (slotMembers && slotMembers->back() == i)
+				memberParams[i]["slotEpilogue"] = "sstore(add(slot, " + slotDiff.str() + "), " + slotValue + ")";
+
 			Whiskers t(R"(
 				let memberSlot := add(slot, <memberStorageSlotDiff>)
 				let memberSrcPtr := add(value, <memberOffset>)
@@ -3753,7 +3850,11 @@ std::string YulUtilFunctions::copyStructToStorageFunction(StructType const& _fro
 						</isValueType>
 				</fromStorage>
 
-				<updateStorageValue>(memberSlot, <memberValues>)
+				<?combined>
+					<slotValue> := <updateByteSlice>(<slotValue>, <prepare>(<convert>(<memberValues>)))
+				<!combined>
+					<updateStorageValue>(memberSlot, <memberValues>)
+				</combined>
 			)");
 			bool fromCalldata = _from.location() == DataLocation::CallData;
 			t("fromCalldata", fromCalldata);
@@ -3789,11 +3890,21 @@ std::string YulUtilFunctions::copyStructToStorageFunction(StructType const& _fro
 					solAssert(srcOffset == 0, "");
 
 			}
-			t("updateStorageValue", updateStorageValueFunction(
-				memberType,
-				*toStructMembers[i].type,
-				std::optional<unsigned>{offset}
-			));
+			t("combined", slotMembers != nullptr);
+			if (slotMembers)
+			{
+				Type const& toMemberType = *toStructMembers[i].type;
+				t("slotValue", slotValue);
+				t("updateByteSlice", updateByteSliceFunction(toMemberType.storageBytes(), offset));
+				t("prepare", prepareStoreFunction(toMemberType));
+				t("convert", conversionFunction(memberType, toMemberType));
+			}
+			else
+				t("updateStorageValue", updateStorageValueFunction(
+					memberType,
+					*toStructMembers[i].type,
+					std::optional<unsigned>{offset}
+				));
 			memberParams[i]["updateMemberCall"] = t.render();
 		}
 		templ("member", memberParams);
@@ -3994,50 +4105,49 @@ std::string YulUtilFunctions::validatorFunction(Type const& _type, bool _revertO
 			}
 		)");
 		templ("functionName", functionName);
-		PanicCode panicCode = PanicCode::Generic;
-
-		switch (_type.category())
-		{
-		case Type::Category::Address:
-		case Type::Category::Integer:
-		case Type::Category::RationalNumber:
-		case Type::Category::Bool:
-		case Type::Category::FixedPoint:
-		case Type::Category::Function:
-		case Type::Category::Array:
-		case Type::Category::Struct:
-		case Type::Category::Mapping:
-		case Type::Category::FixedBytes:
-		case Type::Category::Contract:
-		case Type::Category::UserDefinedValueType:
-		{
-			templ("condition", "eq(value, " + cleanupFunction(_type) + "(value))");
-			break;
-		}
-		case Type::Category::Enum:
-		{
-			size_t members = dynamic_cast<EnumType const&>(_type).numberOfMembers();
-			solAssert(members > 0, "empty enum should have caused a parser error.");
-			panicCode = PanicCode::EnumConversionError;
-			templ("condition", "lt(value, " + std::to_string(members) + ")");
-			break;
-		}
-		case Type::Category::InaccessibleDynamic:
-			templ("condition", "1");
-			break;
-		default:
-			solAssert(false, "Validation of type " + _type.identifier() + " requested.");
-		}
+		templ("condition", validationCondition(_type, "value"));
 
 		if (_revertOnFailure)
 			templ("failure", "revert(0, 0)");
 		else
-			templ("failure", panicFunction(panicCode) + "()");
+			templ("failure", panicFunction(
+				_type.category() == Type::Category::Enum ? PanicCode::EnumConversionError : PanicCode::Generic
+			) + "()");
 
 		return templ.render();
 	});
 }
 
+std::string YulUtilFunctions::validationCondition(Type const& _type, std::string const& _value)
+{
+	switch (_type.category())
+	{
+	case Type::Category::Address:
+	case Type::Category::Integer:
+	case Type::Category::RationalNumber:
+	case Type::Category::Bool:
+	case Type::Category::FixedPoint:
+	case Type::Category::Function:
+	case Type::Category::Array:
+	case Type::Category::Struct:
+	case Type::Category::Mapping:
+	case Type::Category::FixedBytes:
+	case Type::Category::Contract:
+	case Type::Category::UserDefinedValueType:
+		return "eq(" + _value + ", " + cleanupFunction(_type) + "(" + _value + "))";
+	case Type::Category::Enum:
+	{
+		size_t members = dynamic_cast<EnumType const&>(_type).numberOfMembers();
+		solAssert(members > 0, "empty enum should have caused a parser error.");
+		return "lt(" + _value + ", " + std::to_string(members) + ")";
+	}
+	case Type::Category::InaccessibleDynamic:
+		return "1";
+	default:
+		solAssert(false, "Validation of type " + _type.identifier() + " requested.");
+	}
+}
+
 std::string YulUtilFunctions::packedHashFunction(
 	std::vector<Type const*> const& _givenTypes,
 	std::vector<Type const*> const& _targetTypes
@@ -4297,9 +4407,12 @@ std::string YulUtilFunctions::zeroValueFunction(Type const& _type, bool _splitFu
 	});
 }
 
-std::string YulUtilFunctions::storageSetToZeroFunction(Type const& _type)
+std::string YulUtilFunctions::storageSetToZeroFunction(Type const& _type, bool _transient)
 {
-	std::string const functionName = "storage_set_to_zero_" + _type.identifier();
+	solAssert(!_transient || _type.isValueType(), "Transient storage is only supported for value types.");
+	std::string const functionName =
+		std::string(_transient ? "transient_storage_set_to_zero_" : "storage_set_to_zero_") +
+		_type.identifier();
 
 	return m_functionCollector.createFunction(functionName, [&]() {
 		if (_type.isValueType())
@@ -4310,7 +4423,7 @@ std::string YulUtilFunctions::storageSetToZeroFunction(Type const& _type)
 				}
 			)")
 			("functionName", functionName)
-			("store", updateStorageValueFunction(_type, _type))
+			("store", updateStorageValueFunction(_type, _type, std::nullopt, _transient))
 			("values", suffixedVariableNameList("zero_", 0, _type.sizeOnStack()))
 			("zeroValue", zeroValueFunction(_type))
 			.render();
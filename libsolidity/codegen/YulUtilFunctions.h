@@ -167,6 +167,11 @@ public:
 
 	/// signature: (x, y) -> sum
 	std::string overflowCheckedIntAddFunction(IntegerType const& _type);
+	/// @returns the name of a function that adds the constant @a _constant, which may be
+	/// negative, to a value of the given type and reverts on overflow. The overflow check
+	/// is a single comparison against a bound computed at compile time.
+	/// signature: (x) -> sum
+	std::string overflowCheckedIntAddConstantFunction(IntegerType const& _type, bigint const& _constant);
 	/// signature: (x, y) -> sum
 	std::string wrappingIntAddFunction(IntegerType const& _type);
 
@@ -349,8 +354,9 @@ public:
 	/// @returns a function that reads a type from storage.
 	/// @param _splitFunctionTypes if false, returns the address and function signature in a
 	/// single variable.
-	std::string readFromStorage(Type const& _type, size_t _offset, bool _splitFunctionTypes);
-	std::string readFromStorageDynamic(Type const& _type, bool _splitFunctionTypes);
+	/// @param _transient if true, reads from transient storage, which only supports value types.
+	std::string readFromStorage(Type const& _type, size_t _offset, bool _splitFunctionTypes, bool _transient = false);
+	std::string readFromStorageDynamic(Type const& _type, bool _splitFunctionTypes, bool _transient = false);
 
 	/// @returns a function that reads a value type from memory. Performs cleanup.
 	/// signature: (addr) -> value
@@ -372,11 +378,13 @@ public:
 	/// the specified slot and offset. If offset is not given, it is expected as
 	/// runtime parameter.
 	/// For reference types, offset is checked to be zero at runtime.
+	/// If @a _transient is true, writes to transient storage, which only supports value types.
 	/// signature: (slot, [offset,] value)
 	std::string updateStorageValueFunction(
 		Type const& _fromType,
 		Type const& _toType,
-		std::optional<unsigned> const& _offset = std::optional<unsigned>()
+		std::optional<unsigned> const& _offset = std::optional<unsigned>(),
+		bool _transient = false
 	);
 
 	/// Returns the name of a function that will write the given value to
@@ -416,6 +424,12 @@ public:
 	/// signature: (memPtr, size) ->
 	std::string finalizeAllocationFunction();
 
+	/// @returns the name of the function that resets the free memory pointer to a previous value,
+	/// i.e. releases all memory allocated after memPtr.
+	/// Must only be used if none of the released memory is referenced afterwards.
+	/// signature: (memPtr) ->
+	std::string releaseMemoryFunction();
+
 	/// @returns the name of a function that zeroes an array.
 	/// signature: (dataStart, dataSizeInBytes) ->
 	std::string zeroMemoryArrayFunction(ArrayType const& _type);
@@ -474,6 +488,10 @@ public:
 	/// This is used for data decoded from external sources.
 	std::string validatorFunction(Type const& _type, bool _revertOnFailure);
 
+	/// @returns a Yul expression that evaluates to 1 if the variable @a _value holds a valid
+	/// value of the given type and to 0 otherwise, as checked by @a validatorFunction.
+	std::string validationCondition(Type const& _type, std::string const& _value);
+
 	std::string packedHashFunction(std::vector<Type const*> const& _givenTypes, std::vector<Type const*> const& _targetTypes);
 
 	/// @returns the name of a function that reverts and uses returndata (if available)
@@ -494,9 +512,9 @@ public:
 	std::string zeroValueFunction(Type const& _type, bool _splitFunctionTypes = true);
 
 	/// @returns the name of a function that will set the given storage item to
-	/// zero
+	/// zero, in transient storage if @a _transient is true.
 	/// signature: (slot, offset) ->
-	std::string storageSetToZeroFunction(Type const& _type);
+	std::string storageSetToZeroFunction(Type const& _type, bool _transient = false);
 
 	/// If revertStrings is debug, @returns the name of a function that
 	/// stores @param _message in memory position 0 and reverts.
@@ -573,7 +591,12 @@ private:
 	/// @param _splitFunctionTypes if false, returns the address and function signature in a
 	/// single variable.
 	/// @param _offset if provided, read from static offset, otherwise offset is a parameter of the Yul function.
-	std::string readFromStorageValueType(Type const& _type, std::optional<size_t> _offset, bool _splitFunctionTypes);
+	std::string readFromStorageValueType(
+		Type const& _type,
+		std::optional<size_t> _offset,
+		bool _splitFunctionTypes,
+		bool _transient = false
+	);
 
 	/// @returns a function that reads a reference type from storage to memory (performing a deep copy).
 	std::string readFromStorageReferenceType(Type const& _type);
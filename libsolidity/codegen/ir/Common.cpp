@@ -105,7 +105,7 @@ std::string IRNames::libraryAddressImmutable()
 
 std::string IRNames::constantValueFunction(VariableDeclaration const& _constant)
 {
-	solAssert(_constant.isConstant(), "");
+	solAssert(_constant.isConstant() || _constant.immutable(), "");
 	return "constant_" + _constant.name() + "_" + std::to_string(_constant.id());
 }
 
@@ -98,6 +98,15 @@ void IRGenerationContext::registerImmutableVariable(VariableDeclaration const& _
 	*m_reservedMemory += _variable.annotation().type->memoryHeadSize();
 }
 
+bool IRGenerationContext::isConstantImmutable(VariableDeclaration const& _variable)
+{
+	return
+		_variable.immutable() &&
+		_variable.value() &&
+		!_variable.annotation().assigned &&
+		_variable.value()->annotation().type->category() == Type::Category::RationalNumber;
+}
+
 size_t IRGenerationContext::immutableMemoryOffset(VariableDeclaration const& _variable) const
 {
 	solAssert(
@@ -62,12 +62,14 @@ public:
 		RevertStrings _revertStrings,
 		std::map<std::string, unsigned> _sourceIndices,
 		langutil::DebugInfoSelection const& _debugInfoSelection,
-		langutil::CharStreamProvider const* _soliditySourceProvider
+		langutil::CharStreamProvider const* _soliditySourceProvider,
+		std::shared_ptr<MultiUseYulFunctionCache> _functionCache = {}
 	):
 		m_evmVersion(_evmVersion),
 		m_executionContext(_executionContext),
 		m_revertStrings(_revertStrings),
 		m_sourceIndices(std::move(_sourceIndices)),
+		m_functions(std::move(_functionCache)),
 		m_debugInfoSelection(_debugInfoSelection),
 		m_soliditySourceProvider(_soliditySourceProvider)
 	{}
@@ -99,6 +101,11 @@ public:
 	/// Registers an immutable variable of the contract.
 	/// Should only be called at construction time.
 	void registerImmutableVariable(VariableDeclaration const& _varDecl);
+	/// @returns true if @a _variable is an immutable that is initialized with a compile-time
+	/// constant in its declaration and never assigned to afterwards. The deployed code uses
+	/// the constant instead of loading the immutable. During construction, it is still read
+	/// from memory, since it can be read before its initialization.
+	static bool isConstantImmutable(VariableDeclaration const& _variable);
 	/// @returns the reserved memory for storing the value of the
 	/// immutable @a _variable during contract creation.
 	size_t immutableMemoryOffset(VariableDeclaration const& _variable) const;
@@ -30,6 +30,8 @@
 #include <libsolidity/codegen/ABIFunctions.h>
 #include <libsolidity/codegen/CompilerUtils.h>
 
+#include <libevmasm/GasMeter.h>
+
 #include <libyul/YulStack.h>
 #include <libyul/Utilities.h>
 
@@ -84,6 +86,52 @@ std::set<CallableDeclaration const*, ASTNode::CompareByID> collectReachableCalla
 	return reachableCallables;
 }
 
+/// @returns code that calls the function in @a _cases whose selector is the value of the
+/// variable ``selector`` and does nothing if there is none. The cases have to be sorted by
+/// selector.
+/// The selectors are split into halves by a comparison if the lower cost of the calls pays
+/// for the larger code, following the model of ContractCompiler::appendInternalSelector.
+std::string selectorDispatch(std::vector<std::map<std::string, std::string>> const& _cases, size_t _runs)
+{
+	// Start with some comparisons to avoid overflow, then do the actual comparison.
+	bool split = false;
+	if (_cases.size() <= 4)
+		split = false;
+	else if (_runs > (17 * evmasm::GasCosts::createDataGas) / 6)
+		split = true;
+	else
+		split = (_runs * 6 * (_cases.size() - 4) > 17 * evmasm::GasCosts::createDataGas);
+
+	if (split)
+	{
+		auto pivot = _cases.begin() + static_cast<ptrdiff_t>(_cases.size() / 2);
+		return Whiskers(R"(
+			switch lt(selector, <pivot>)
+			case 0 { <larger> }
+			default { <smaller> }
+		)")
+		("pivot", pivot->at("functionSelector"))
+		("larger", selectorDispatch({pivot, _cases.end()}, _runs))
+		("smaller", selectorDispatch({_cases.begin(), pivot}, _runs))
+		.render();
+	}
+
+	return Whiskers(R"(
+		switch selector
+		<#cases>
+		case <functionSelector>
+		{
+			// <functionName>
+			<delegatecallCheck>
+			<externalFunction>()
+		}
+		</cases>
+		default {}
+	)")
+	("cases", _cases)
+	.render();
+}
+
 }
 
 std::string IRGenerator::run(
@@ -256,7 +304,7 @@ InternalDispatchMap IRGenerator::generateInternalDispatchFunctions(ContractDefin
 	for (YulArity const& arity: internalDispatchMap | ranges::views::keys)
 	{
 		std::string funName = IRNames::internalDispatch(arity);
-		m_context.functionCollector().createFunction(funName, [&]() {
+		m_context.functionCollector().createUncachedFunction(funName, [&]() {
 			Whiskers templ(R"(
 				<sourceLocationComment>
 				function <functionName>(fun<?+in>, <in></+in>) <?+out>-> <out></+out> {
@@ -316,7 +364,7 @@ InternalDispatchMap IRGenerator::generateInternalDispatchFunctions(ContractDefin
 std::string IRGenerator::generateFunction(FunctionDefinition const& _function)
 {
 	std::string functionName = IRNames::function(_function);
-	return m_context.functionCollector().createFunction(functionName, [&]() {
+	return m_context.functionCollector().createUncachedFunction(functionName, [&]() {
 		m_context.resetLocalVariables();
 		Whiskers t(R"(
 			<astIDComment><sourceLocationComment>
@@ -387,7 +435,7 @@ std::string IRGenerator::generateModifier(
 )
 {
 	std::string functionName = IRNames::modifierInvocation(_modifierInvocation);
-	return m_context.functionCollector().createFunction(functionName, [&]() {
+	return m_context.functionCollector().createUncachedFunction(functionName, [&]() {
 		m_context.resetLocalVariables();
 		Whiskers t(R"(
 			<astIDComment><sourceLocationComment>
@@ -479,7 +527,7 @@ std::string IRGenerator::generateModifier(
 std::string IRGenerator::generateFunctionWithModifierInner(FunctionDefinition const& _function)
 {
 	std::string functionName = IRNames::functionWithModifierInner(_function);
-	return m_context.functionCollector().createFunction(functionName, [&]() {
+	return m_context.functionCollector().createUncachedFunction(functionName, [&]() {
 		m_context.resetLocalVariables();
 		Whiskers t(R"(
 			<sourceLocationComment>
@@ -519,14 +567,14 @@ std::string IRGenerator::generateFunctionWithModifierInner(FunctionDefinition co
 std::string IRGenerator::generateGetter(VariableDeclaration const& _varDecl)
 {
 	std::string functionName = IRNames::function(_varDecl);
-	return m_context.functionCollector().createFunction(functionName, [&]() {
+	return m_context.functionCollector().createUncachedFunction(functionName, [&]() {
 		Type const* type = _varDecl.annotation().type;
 
 		solAssert(_varDecl.isStateVariable(), "");
 
 		FunctionType accessorType(_varDecl);
 		TypePointers paramTypes = accessorType.parameterTypes();
-		if (_varDecl.immutable())
+		if (_varDecl.immutable() && !IRGenerationContext::isConstantImmutable(_varDecl))
 		{
 			solAssert(paramTypes.empty(), "");
 			solUnimplementedAssert(type->sizeOnStack() == 1);
@@ -552,7 +600,7 @@ std::string IRGenerator::generateGetter(VariableDeclaration const& _varDecl)
 			("id", std::to_string(_varDecl.id()))
 			.render();
 		}
-		else if (_varDecl.isConstant())
+		else if (_varDecl.isConstant() || IRGenerationContext::isConstantImmutable(_varDecl))
 		{
 			solAssert(paramTypes.empty(), "");
 			return Whiskers(R"(
@@ -679,7 +727,7 @@ std::string IRGenerator::generateGetter(VariableDeclaration const& _varDecl)
 				<ret> := <readStorage>(slot, offset)
 			)")
 			("ret", joinHumanReadable(retVars))
-			("readStorage", m_utils.readFromStorageDynamic(*returnTypes.front(), true))
+			("readStorage", m_utils.readFromStorageDynamic(*returnTypes.front(), true, _varDecl.isTransient()))
 			.render();
 		}
 
@@ -712,7 +760,7 @@ std::string IRGenerator::generateGetter(VariableDeclaration const& _varDecl)
 std::string IRGenerator::generateExternalFunction(ContractDefinition const& _contract, FunctionType const& _functionType)
 {
 	std::string functionName = IRNames::externalFunctionABIWrapper(_functionType.declaration());
-	return m_context.functionCollector().createFunction(functionName, [&](std::vector<std::string>&, std::vector<std::string>&) -> std::string {
+	return m_context.functionCollector().createUncachedFunction(functionName, [&](std::vector<std::string>&, std::vector<std::string>&) -> std::string {
 		Whiskers t(R"X(
 			<callValueCheck>
 			<?+params>let <params> := </+params> <abiDecode>(4, calldatasize())
@@ -847,7 +895,7 @@ void IRGenerator::generateConstructors(ContractDefinition const& _contract)
 		baseConstructorParams.erase(contract);
 
 		m_context.resetLocalVariables();
-		m_context.functionCollector().createFunction(IRNames::constructor(*contract), [&]() {
+		m_context.functionCollector().createUncachedFunction(IRNames::constructor(*contract), [&]() {
 			Whiskers t(R"(
 				<astIDComment><sourceLocationComment>
 				function <functionName>(<params><comma><baseParams>) {
@@ -960,6 +1008,9 @@ std::string IRGenerator::deployCode(ContractDefinition const& _contract)
 	else
 		for (VariableDeclaration const* immutable: ContractType(_contract).immutableVariables())
 		{
+			// Not referenced by the deployed code.
+			if (IRGenerationContext::isConstantImmutable(*immutable))
+				continue;
 			solUnimplementedAssert(immutable->type()->isValueType());
 			solUnimplementedAssert(immutable->type()->sizeOnStack() == 1);
 			immutables.emplace_back(std::map<std::string, std::string>{
@@ -979,20 +1030,11 @@ std::string IRGenerator::callValueCheck()
 std::string IRGenerator::dispatchRoutine(ContractDefinition const& _contract)
 {
 	Whiskers t(R"X(
-		<?+cases>if iszero(lt(calldatasize(), 4))
+		<?hasFunctions>if iszero(lt(calldatasize(), 4))
 		{
 			let selector := <shr224>(calldataload(0))
-			switch selector
-			<#cases>
-			case <functionSelector>
-			{
-				// <functionName>
-				<delegatecallCheck>
-				<externalFunction>()
-			}
-			</cases>
-			default {}
-		}</+cases>
+			<selectorDispatch>
+		}</hasFunctions>
 		<?+receiveEther>if iszero(calldatasize()) { <receiveEther> }</+receiveEther>
 		<fallback>
 	)X");
@@ -1021,7 +1063,9 @@ std::string IRGenerator::dispatchRoutine(ContractDefinition const& _contract)
 
 		templ["externalFunction"] = generateExternalFunction(_contract, *type);
 	}
-	t("cases", functions);
+	t("hasFunctions", !functions.empty());
+	if (!functions.empty())
+		t("selectorDispatch", selectorDispatch(functions, m_optimiserSettings.expectedExecutionsPerDeployment));
 	FunctionDefinition const* etherReceiver = _contract.receiveFunction();
 	if (etherReceiver)
 	{
@@ -1095,13 +1139,15 @@ void IRGenerator::resetContext(ContractDefinition const& _contract, ExecutionCon
 		m_context.revertStrings(),
 		m_context.sourceIndices(),
 		m_context.debugInfoSelection(),
-		m_context.soliditySourceProvider()
+		m_context.soliditySourceProvider(),
+		m_context.functionCollector().cache()
 	);
 	m_context = std::move(newContext);
 
 	m_context.setMostDerivedContract(_contract);
-	for (auto const& var: ContractType(_contract).stateVariables())
-		m_context.addStateVariable(*std::get<0>(var), std::get<1>(var), std::get<2>(var));
+	for (bool transient: {false, true})
+		for (auto const& var: ContractType(_contract).stateVariables(transient))
+			m_context.addStateVariable(*std::get<0>(var), std::get<1>(var), std::get<2>(var));
 }
 
 std::string IRGenerator::dispenseLocationComment(ASTNode const& _node)
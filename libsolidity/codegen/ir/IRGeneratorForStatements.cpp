@@ -213,6 +213,30 @@ private:
 	ExternalRefsMap const& m_references;
 };
 
+/// @returns true if @a _expression is a call to one of the ``abi.encode...`` functions.
+/// Its result is a newly allocated memory array that is not referenced anywhere else
+/// and that is the last allocation made while evaluating the expression.
+bool isABIEncodingCall(Expression const& _expression)
+{
+	auto const* functionCall = dynamic_cast<FunctionCall const*>(&_expression);
+	if (!functionCall || *functionCall->annotation().kind != FunctionCallKind::FunctionCall)
+		return false;
+	auto const* functionType = dynamic_cast<FunctionType const*>(functionCall->expression().annotation().type);
+	if (!functionType)
+		return false;
+	switch (functionType->kind())
+	{
+	case FunctionType::Kind::ABIEncode:
+	case FunctionType::Kind::ABIEncodePacked:
+	case FunctionType::Kind::ABIEncodeWithSelector:
+	case FunctionType::Kind::ABIEncodeCall:
+	case FunctionType::Kind::ABIEncodeWithSignature:
+		return true;
+	default:
+		return false;
+	}
+}
+
 }
 
 std::string IRGeneratorForStatementsBase::code() const
@@ -270,6 +294,7 @@ void IRGeneratorForStatements::initializeStateVar(VariableDeclaration const& _va
 		if (!_varDecl.value())
 			return;
 
+		solAssert(!_varDecl.isTransient(), "Transient state variables cannot be initialized.");
 		_varDecl.value()->accept(*this);
 
 		writeToLValue(
@@ -342,7 +367,7 @@ std::string IRGeneratorForStatements::constantValueFunction(VariableDeclaration
 	try
 	{
 		std::string functionName = IRNames::constantValueFunction(_constant);
-		return m_context.functionCollector().createFunction(functionName, [&] {
+		return m_context.functionCollector().createUncachedFunction(functionName, [&] {
 			Whiskers templ(R"(
 				<sourceLocationComment>
 				function <functionName>() -> <ret> {
@@ -464,11 +489,19 @@ bool IRGeneratorForStatements::visit(Assignment const& _assignment)
 		IRVariable leftIntermediate = readFromLValue(*m_currentLValue);
 		solAssert(type(_assignment) == leftIntermediate.type());
 
-		define(_assignment) << (
-			TokenTraits::isShiftOp(binaryOperator) ?
-			shiftOperation(binaryOperator, leftIntermediate, value) :
-			binaryOperation(binaryOperator, type(_assignment), leftIntermediate.name(), value.name())
-		) << "\n";
+		if (TokenTraits::isShiftOp(binaryOperator))
+			define(_assignment) << shiftOperation(binaryOperator, leftIntermediate, value) << "\n";
+		else if (auto constant = checkedConstantSummand(binaryOperator, _assignment.rightHandSide(), type(_assignment)))
+			define(_assignment) <<
+				m_utils.overflowCheckedIntAddConstantFunction(
+					dynamic_cast<IntegerType const&>(type(_assignment)),
+					binaryOperator == Token::Sub ? -*constant : *constant
+				) <<
+				"(" <<
+				leftIntermediate.name() <<
+				")\n";
+		else
+			define(_assignment) << binaryOperation(binaryOperator, type(_assignment), leftIntermediate.name(), value.name()) << "\n";
 
 		writeToLValue(*m_currentLValue, IRVariable(_assignment));
 	}
@@ -569,16 +602,21 @@ bool IRGeneratorForStatements::visit(Block const& _block)
 		solAssert(m_context.arithmetic() == Arithmetic::Checked);
 		m_context.setArithmetic(Arithmetic::Wrapping);
 	}
-	return true;
-}
 
-void IRGeneratorForStatements::endVisit(Block const& _block)
-{
+	for (ASTPointer<Statement> const& statement: _block.statements())
+	{
+		statement->accept(*this);
+		// The remaining statements are unreachable.
+		if (callsNonReturningFunction(*statement))
+			break;
+	}
+
 	if (_block.unchecked())
 	{
 		solAssert(m_context.arithmetic() == Arithmetic::Wrapping);
 		m_context.setArithmetic(Arithmetic::Checked);
 	}
+	return false;
 }
 
 bool IRGeneratorForStatements::visit(IfStatement const& _ifStatement)
@@ -716,7 +754,7 @@ bool IRGeneratorForStatements::visit(UnaryOperation const& _unaryOperation)
 			util::GenericVisitor{
 				[&](IRLValue::Storage const& _storage) {
 					appendCode() <<
-						m_utils.storageSetToZeroFunction(m_currentLValue->type) <<
+						m_utils.storageSetToZeroFunction(m_currentLValue->type, _storage.transient) <<
 						"(" <<
 						_storage.slot <<
 						", " <<
@@ -935,6 +973,21 @@ bool IRGeneratorForStatements::visit(BinaryOperation const& _binOp)
 		IRVariable right = convert(_binOp.rightExpression(), *type(_binOp.rightExpression()).mobileType());
 		define(_binOp) << shiftOperation(_binOp.getOperator(), left, right) << "\n";
 	}
+	else if (auto constant = checkedConstantSummand(op, _binOp.rightExpression(), *commonType))
+		define(_binOp) <<
+			m_utils.overflowCheckedIntAddConstantFunction(
+				dynamic_cast<IntegerType const&>(*commonType),
+				op == Token::Sub ? -*constant : *constant
+			) <<
+			"(" <<
+			expressionAsType(_binOp.leftExpression(), *commonType) <<
+			")\n";
+	else if (auto constant = op == Token::Add ? checkedConstantSummand(op, _binOp.leftExpression(), *commonType) : std::nullopt)
+		define(_binOp) <<
+			m_utils.overflowCheckedIntAddConstantFunction(dynamic_cast<IntegerType const&>(*commonType), *constant) <<
+			"(" <<
+			expressionAsType(_binOp.rightExpression(), *commonType) <<
+			")\n";
 	else
 	{
 		std::string left = expressionAsType(_binOp.leftExpression(), *commonType);
@@ -1413,6 +1466,9 @@ void IRGeneratorForStatements::endVisit(FunctionCall const& _functionCall)
 				", " <<
 				(arrayLengthFunction + "(" + array.commaSeparatedList() +")") <<
 				")\n";
+			// The encoded data is only needed for the hash, so its memory can be reused.
+			if (isABIEncodingCall(*arguments[0]))
+				appendCode() << m_utils.releaseMemoryFunction() << "(" << array.commaSeparatedList() << ")\n";
 		}
 		break;
 	}
@@ -2533,7 +2589,13 @@ void IRGeneratorForStatements::handleVariableReference(
 	Expression const& _referencingExpression
 )
 {
-	if ((_variable.isStateVariable() || _variable.isFileLevelVariable()) && _variable.isConstant())
+	if (
+		((_variable.isStateVariable() || _variable.isFileLevelVariable()) && _variable.isConstant()) ||
+		(
+			m_context.executionContext() == IRGenerationContext::ExecutionContext::Deployed &&
+			IRGenerationContext::isConstantImmutable(_variable)
+		)
+	)
 		define(_referencingExpression) << constantValueFunction(_variable) << "()\n";
 	else if (_variable.isStateVariable() && _variable.immutable())
 		setLValue(_referencingExpression, IRLValue{
@@ -2550,7 +2612,8 @@ void IRGeneratorForStatements::handleVariableReference(
 			*_variable.annotation().type,
 			IRLValue::Storage{
 				toCompactHexWithPrefix(m_context.storageLocationOfStateVariable(_variable).first),
-				m_context.storageLocationOfStateVariable(_variable).second
+				m_context.storageLocationOfStateVariable(_variable).second,
+				_variable.isTransient()
 			}
 		});
 	else
@@ -2756,6 +2819,9 @@ void IRGeneratorForStatements::appendBareCall(
 		</needsEncoding>
 
 		let <success> := <call>(<gas>, <address>, <?+value> <value>, </+value> <pos>, <length>, 0, 0)
+		<?releaseArgument>
+			<releaseMemory>(<arg>)
+		</releaseArgument>
 		let <returndataVar> := <extractReturndataFunction>()
 	)");
 
@@ -2766,10 +2832,19 @@ void IRGeneratorForStatements::appendBareCall(
 	templ("arg", IRVariable(*_arguments.front()).commaSeparatedList());
 	Type const& argType = type(*_arguments.front());
 	if (argType == *TypeProvider::bytesMemory() || argType == *TypeProvider::stringMemory())
+	{
 		templ("needsEncoding", false);
+		// The encoded call data is not needed after the call, so its memory can be reused
+		// for the return data.
+		bool releaseArgument = isABIEncodingCall(*_arguments.front());
+		templ("releaseArgument", releaseArgument);
+		if (releaseArgument)
+			templ("releaseMemory", m_utils.releaseMemoryFunction());
+	}
 	else
 	{
 		templ("needsEncoding", true);
+		templ("releaseArgument", false);
 		ABIFunctions abi(m_context.evmVersion(), m_context.revertStrings(), m_context.functionCollector());
 		templ("encode", abi.tupleEncoderPacked({&argType}, {TypeProvider::bytesMemory()}));
 	}
@@ -2996,6 +3071,24 @@ std::string IRGeneratorForStatements::binaryOperation(
 	return fun + "(" + _left + ", " + _right + ")\n";
 }
 
+std::optional<bigint> IRGeneratorForStatements::checkedConstantSummand(
+	langutil::Token _op,
+	Expression const& _operand,
+	Type const& _type
+) const
+{
+	if (
+		(_op != Token::Add && _op != Token::Sub) ||
+		m_context.arithmetic() != Arithmetic::Checked ||
+		_type.category() != Type::Category::Integer
+	)
+		return std::nullopt;
+	auto const* constantType = dynamic_cast<RationalNumberType const*>(_operand.annotation().type);
+	if (!constantType || constantType->isFractional())
+		return std::nullopt;
+	return constantType->value().numerator();
+}
+
 std::string IRGeneratorForStatements::shiftOperation(
 	langutil::Token _operator,
 	IRVariable const& _value,
@@ -3060,7 +3153,7 @@ void IRGeneratorForStatements::writeToLValue(IRLValue const& _lvalue, IRVariable
 				}, _storage.offset);
 
 				appendCode() <<
-					m_utils.updateStorageValueFunction(_value.type(), _lvalue.type, offsetStatic) <<
+					m_utils.updateStorageValueFunction(_value.type(), _lvalue.type, offsetStatic, _storage.transient) <<
 					"(" <<
 					_storage.slot <<
 					offsetArgument <<
@@ -3145,7 +3238,7 @@ IRVariable IRGeneratorForStatements::readFromLValue(IRLValue const& _lvalue)
 				define(result) << _storage.slot << "\n";
 			else if (std::holds_alternative<std::string>(_storage.offset))
 				define(result) <<
-					m_utils.readFromStorageDynamic(_lvalue.type, true) <<
+					m_utils.readFromStorageDynamic(_lvalue.type, true, _storage.transient) <<
 					"(" <<
 					_storage.slot <<
 					", " <<
@@ -3153,7 +3246,7 @@ IRVariable IRGeneratorForStatements::readFromLValue(IRLValue const& _lvalue)
 					")\n";
 			else
 				define(result) <<
-					m_utils.readFromStorage(_lvalue.type, std::get<unsigned>(_storage.offset), true) <<
+					m_utils.readFromStorage(_lvalue.type, std::get<unsigned>(_storage.offset), true, _storage.transient) <<
 					"(" <<
 					_storage.slot <<
 					")\n";
@@ -3303,6 +3396,30 @@ bool IRGeneratorForStatements::visit(TryStatement const& _tryStatement)
 	return false;
 }
 
+bool IRGeneratorForStatements::callsNonReturningFunction(Statement const& _statement) const
+{
+	auto const* expressionStatement = dynamic_cast<ExpressionStatement const*>(&_statement);
+	if (!expressionStatement)
+		return false;
+	auto const* functionCall = dynamic_cast<FunctionCall const*>(&expressionStatement->expression());
+	if (!functionCall || *functionCall->annotation().kind != FunctionCallKind::FunctionCall)
+		return false;
+	auto const* functionType = dynamic_cast<FunctionType const*>(functionCall->expression().annotation().type);
+	if (!functionType || functionType->kind() != FunctionType::Kind::Internal)
+		return false;
+
+	ContractDefinition const& mostDerivedContract = m_context.mostDerivedContract();
+	FunctionDefinition const* functionDef = ASTNode::resolveFunctionCall(*functionCall, &mostDerivedContract);
+	if (!functionDef)
+		return false;
+
+	// Same context as used by the ControlFlowRevertPruner.
+	ContractDefinition const* context = functionDef->annotation().contract;
+	if (context && mostDerivedContract.derivesFrom(*context))
+		context = &mostDerivedContract;
+	return functionDef->annotation().nonReturningIn.count(context);
+}
+
 void IRGeneratorForStatements::handleCatch(TryStatement const& _tryStatement)
 {
 	setLocation(_tryStatement);
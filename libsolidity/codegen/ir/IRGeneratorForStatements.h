@@ -114,7 +114,6 @@ public:
 	bool visit(TupleExpression const& _tuple) override;
 	void endVisit(PlaceholderStatement const& _placeholder) override;
 	bool visit(Block const& _block) override;
-	void endVisit(Block const& _block) override;
 	bool visit(IfStatement const& _ifStatement) override;
 	bool visit(ForStatement const& _forStatement) override;
 	bool visit(WhileStatement const& _whileStatement) override;
@@ -138,6 +137,10 @@ public:
 	bool visit(TryCatchClause const& _tryCatchClause) override;
 
 private:
+	/// @returns true if @a _statement is a call to an internal function that never returns
+	/// to its caller in the current contract according to the control flow analysis.
+	bool callsNonReturningFunction(Statement const& _statement) const;
+
 	/// Handles all catch cases of a try statement, except the success-case.
 	void handleCatch(TryStatement const& _tryStatement);
 	void handleCatchFallback(TryCatchClause const& _fallback);
@@ -221,6 +224,15 @@ private:
 		std::string const& _right
 	);
 
+	/// @returns the value of @a _operand if it is an integer constant added to or
+	/// subtracted from a value of type @a _type in checked arithmetic, so that the
+	/// operation can be performed with a single comparison against a bound.
+	std::optional<bigint> checkedConstantSummand(
+		langutil::Token _op,
+		Expression const& _operand,
+		Type const& _type
+	) const;
+
 	/// @returns code to perform the given shift operation.
 	/// The operation itself will be performed in the type of the value,
 	/// while the amount to shift can have its own type.
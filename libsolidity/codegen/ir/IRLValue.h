@@ -47,6 +47,8 @@ struct IRLValue
 		///           functions
 		/// string: Used when the offset is determined at run time
 		std::variant<std::string, unsigned> const offset;
+		/// True for state variables in transient storage, which are always of value type.
+		bool const transient = false;
 		std::string offsetString() const
 		{
 			if (std::holds_alternative<unsigned>(offset))
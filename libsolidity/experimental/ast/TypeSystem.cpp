@@ -204,11 +204,20 @@ std::vector<TypeEnvironment::UnificationFailure> TypeEnvironment::instantiate(Ty
 experimental::Type TypeEnvironment::resolve(Type _type) const
 {
 	Type result = _type;
+	std::vector<Type*> chain;
 	while (auto const* var = std::get_if<TypeVariable>(&result))
-		if (Type const* resolvedType = util::valueOrNullptr(m_typeVariables, var->index()))
+		if (Type* resolvedType = util::valueOrNullptr(m_typeVariables, var->index()))
+		{
+			chain.emplace_back(resolvedType);
 			result = *resolvedType;
+		}
 		else
 			break;
+	// Path compression: point every variable on the chain directly at the result,
+	// so that resolving any of them again takes a single lookup.
+	if (chain.size() > 1)
+		for (Type* resolvedType: chain)
+			*resolvedType = result;
 	return result;
 }
 
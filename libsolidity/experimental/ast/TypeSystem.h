@@ -90,7 +90,8 @@ private:
 	/// For each @a TypeVariable (identified by its index) stores the type is has been successfully
 	/// unified with. Used for type resolution. Note that @a Type may itself be a type variable
 	/// or may contain type variables so resolution must be recursive.
-	std::map<size_t, Type> m_typeVariables;
+	/// Mutable, since @a resolve compresses chains of variables bound to variables.
+	mutable std::map<size_t, Type> m_typeVariables;
 
 	/// Type variables marked as fixed free type variables (as opposed to generic type variables).
 	/// Identified by their indices.
@@ -30,6 +30,7 @@
 #include <liblangutil/CharStream.h>
 #include <liblangutil/CharStreamProvider.h>
 
+#include <optional>
 #include <utility>
 
 #ifdef HAVE_Z3_DLOPEN
@@ -43,6 +44,52 @@ using namespace solidity::frontend;
 using namespace solidity::frontend::smt;
 using namespace solidity::smtutil;
 
+namespace
+{
+
+/// Appends the conjuncts of @a _expression to @a o_conjuncts, looking through nested
+/// conjunctions. Since assertions are accumulated as `_new && _old`, the right operand
+/// is visited first, so that earlier assertions come first.
+void collectConjuncts(smtutil::Expression const& _expression, std::vector<smtutil::Expression const*>& o_conjuncts)
+{
+	if (_expression.name == "and" && _expression.arguments.size() == 2)
+	{
+		collectConjuncts(_expression.arguments.at(1), o_conjuncts);
+		collectConjuncts(_expression.arguments.at(0), o_conjuncts);
+	}
+	else
+		o_conjuncts.push_back(&_expression);
+}
+
+bool structurallyEqual(smtutil::Expression const& _a, smtutil::Expression const& _b)
+{
+	if (&_a == &_b)
+		return true;
+	if (
+		_a.name != _b.name ||
+		_a.arguments.size() != _b.arguments.size() ||
+		!_a.sort != !_b.sort ||
+		(_a.sort && !(*_a.sort == *_b.sort))
+	)
+		return false;
+	if (_a.arguments.sharesStorageWith(_b.arguments))
+		return true;
+	for (size_t i = 0; i < _a.arguments.size(); ++i)
+		if (!structurallyEqual(_a.arguments[i], _b.arguments[i]))
+			return false;
+	return true;
+}
+
+smtutil::Expression conjunction(std::vector<smtutil::Expression const*> const& _conjuncts, size_t _begin, size_t _end)
+{
+	std::optional<smtutil::Expression> result;
+	for (size_t i = _begin; i < _end; ++i)
+		result = result ? *_conjuncts[i] && std::move(*result) : *_conjuncts[i];
+	return result ? std::move(*result) : smtutil::Expression(true);
+}
+
+}
+
 BMC::BMC(
 	smt::EncodingContext& _context,
 	UniqueErrorReporter& _errorReporter,
@@ -64,7 +111,7 @@ BMC::BMC(
 	if (_settings.solvers.z3 && Z3Interface::available())
 		solvers.emplace_back(std::make_unique<Z3Interface>(_settings.timeout));
 #endif
-	m_interface = std::make_unique<SMTPortfolio>(std::move(solvers), _settings.timeout);
+	m_interface = std::make_unique<SMTPortfolio>(std::move(solvers), _settings.timeout, _settings.raceSolvers);
 #if defined (HAVE_Z3)
 	if (m_settings.solvers.z3)
 		if (!_smtlib2Responses.empty())
@@ -102,6 +149,7 @@ void BMC::analyze(SourceUnit const& _source, std::map<ASTNode const*, std::set<V
 	m_variableUsage.setFunctionInlining(shouldInlineFunctionCall);
 	createFreeConstants(sourceDependencies(_source));
 	m_unprovedAmt = 0;
+	m_targetsOutOfTimeBudget = 0;
 
 	_source.accept(*this);
 
@@ -117,6 +165,16 @@ void BMC::analyze(SourceUnit const& _source, std::map<ASTNode const*, std::set<V
 			" Consider increasing the timeout per query."
 		);
 
+	if (m_targetsOutOfTimeBudget > 0)
+		m_errorReporter.warning(
+			6718_error,
+			{},
+			"BMC: " +
+			std::to_string(m_targetsOutOfTimeBudget) +
+			" verification condition(s) were not checked because the time budget of the model checker ran out." +
+			" Consider increasing the time budget."
+		);
+
 	if (!m_settings.showProvedSafe && !m_safeTargets.empty())
 		m_errorReporter.info(
 			6002_error,
@@ -931,8 +989,56 @@ std::string BMC::targetDescription(BMCVerificationTarget const& _target)
 
 void BMC::checkVerificationTargets()
 {
+	std::vector<BMCVerificationTarget*> targets;
 	for (auto& target: m_verificationTargets)
-		checkVerificationTarget(target);
+		if (!(
+			m_solvedTargets.count(target.expression) &&
+			m_solvedTargets.at(target.expression).count(target.type)
+		))
+			targets.push_back(&target);
+
+	// The constraints of the targets of a function share the assertions that were
+	// accumulated before their paths diverged. Those are asserted only once in an
+	// outer solver scope, so that incremental solvers can reuse their work between
+	// the targets. The query is not split when it is printed, to keep it self-contained.
+	if (targets.size() > 1 && !m_settings.printQuery)
+	{
+		std::vector<std::vector<smtutil::Expression const*>> conjuncts(targets.size());
+		for (size_t i = 0; i < targets.size(); ++i)
+			collectConjuncts(targets[i]->constraints, conjuncts[i]);
+
+		size_t sharedAmount = conjuncts.front().size();
+		for (size_t i = 1; i < targets.size(); ++i)
+		{
+			size_t j = 0;
+			while (
+				j < sharedAmount &&
+				j < conjuncts[i].size() &&
+				structurallyEqual(*conjuncts.front()[j], *conjuncts[i][j])
+			)
+				++j;
+			sharedAmount = j;
+		}
+
+		if (sharedAmount > 0)
+		{
+			m_interface->push();
+			m_interface->addAssertion(conjunction(conjuncts.front(), 0, sharedAmount));
+			for (size_t i = 0; i < targets.size(); ++i)
+			{
+				// The remaining conjuncts point into the target's constraints,
+				// so they are built before the constraints are replaced.
+				smtutil::Expression remaining = conjunction(conjuncts[i], sharedAmount, conjuncts[i].size());
+				targets[i]->constraints = std::move(remaining);
+				checkVerificationTarget(*targets[i]);
+			}
+			m_interface->pop();
+			return;
+		}
+	}
+
+	for (auto target: targets)
+		checkVerificationTarget(*target);
 }
 
 void BMC::checkVerificationTarget(BMCVerificationTarget& _target)
@@ -943,6 +1049,12 @@ void BMC::checkVerificationTarget(BMCVerificationTarget& _target)
 	)
 		return;
 
+	if (timeBudgetExhausted())
+	{
+		++m_targetsOutOfTimeBudget;
+		return;
+	}
+
 	switch (_target.type)
 	{
 		case VerificationTargetType::ConstantCondition:
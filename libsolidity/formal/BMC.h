@@ -218,6 +218,9 @@ private:
 	/// Number of verification conditions that could not be proved.
 	size_t m_unprovedAmt = 0;
 
+	/// Number of verification conditions that were not checked because the time budget had run out.
+	size_t m_targetsOutOfTimeBudget = 0;
+
 	enum class LoopControlKind
 	{
 		Continue,
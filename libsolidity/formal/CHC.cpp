@@ -1260,6 +1260,7 @@ void CHC::resetSourceAnalysis()
 	SMTEncoder::resetSourceAnalysis();
 
 	m_unprovedTargets.clear();
+	m_targetsOutOfTimeBudget = 0;
 	m_invariants.clear();
 	m_functionTargetIds.clear();
 	m_verificationTargets.clear();
@@ -1964,19 +1965,23 @@ std::tuple<CheckResult, smtutil::Expression, CHCSolverInterface::CexGraph> CHC::
 		break;
 	}
 	case CheckResult::UNSATISFIABLE:
-		break;
 	case CheckResult::UNKNOWN:
-		break;
 	case CheckResult::CONFLICTING:
-		m_errorReporter.warning(1988_error, _location, "CHC: At least two SMT solvers provided conflicting answers. Results might not be sound.");
-		break;
 	case CheckResult::ERROR:
-		m_errorReporter.warning(1218_error, _location, "CHC: Error trying to invoke SMT solver.");
+		reportSolverFailure(result, _location);
 		break;
 	}
 	return {result, invariant, cex};
 }
 
+void CHC::reportSolverFailure(CheckResult _result, langutil::SourceLocation const& _location)
+{
+	if (_result == CheckResult::CONFLICTING)
+		m_errorReporter.warning(1988_error, _location, "CHC: At least two SMT solvers provided conflicting answers. Results might not be sound.");
+	else if (_result == CheckResult::ERROR)
+		m_errorReporter.warning(1218_error, _location, "CHC: Error trying to invoke SMT solver.");
+}
+
 void CHC::verificationTargetEncountered(
 	ASTNode const* const _errorNode,
 	VerificationTargetType _type,
@@ -2077,14 +2082,22 @@ void CHC::checkVerificationTargets()
 	}
 
 	std::set<unsigned> checkedErrorIds;
-	for (auto const& [targetId, placeholders]: targetEntryPoints)
-	{
-		auto const& target = m_verificationTargets.at(targetId);
-		auto [errorType, errorReporterId] = targetDescription(target);
+	if (
+		m_settings.parallelQueries > 1 &&
+		!m_settings.printQuery &&
+		dynamic_cast<CHCSmtLib2Interface*>(m_interface.get())
+	)
+		checkVerificationTargetsInParallel(targetEntryPoints);
+	else
+		for (auto const& [targetId, placeholders]: targetEntryPoints)
+		{
+			auto const& target = m_verificationTargets.at(targetId);
+			auto [errorType, errorReporterId] = targetDescription(target);
 
-		checkAndReportTarget(target, placeholders, errorReporterId, errorType + " happens here.", errorType + " might happen here.");
-		checkedErrorIds.insert(target.errorId);
-	}
+			checkAndReportTarget(target, placeholders, errorReporterId, errorType + " happens here.", errorType + " might happen here.");
+		}
+	for (unsigned targetId: targetEntryPoints | ranges::views::keys)
+		checkedErrorIds.insert(m_verificationTargets.at(targetId).errorId);
 
 	auto toReport = m_unsafeTargets;
 	if (m_settings.showUnproved)
@@ -2112,6 +2125,16 @@ void CHC::checkVerificationTargets()
 			" Consider increasing the timeout per query."
 		);
 
+	if (m_targetsOutOfTimeBudget > 0)
+		m_errorReporter.warning(
+			3411_error,
+			{},
+			"CHC: " +
+			std::to_string(m_targetsOutOfTimeBudget) +
+			" verification condition(s) were not checked because the time budget of the model checker ran out." +
+			" Consider increasing the time budget."
+		);
+
 	if (!m_settings.showProvedSafe && !m_safeTargets.empty())
 		m_errorReporter.info(
 			1391_error,
@@ -2203,6 +2226,70 @@ void CHC::checkAndReportTarget(
 	if (m_unsafeTargets.count(_target.errorNode) && m_unsafeTargets.at(_target.errorNode).count(_target.type))
 		return;
 
+	if (timeBudgetExhausted())
+	{
+		++m_targetsOutOfTimeBudget;
+		return;
+	}
+
+	addErrorRulesForTarget(_target, _placeholders);
+	reportTarget(
+		_target,
+		query(error(), _target.errorNode->location()),
+		error().name,
+		_errorReporterId,
+		_satMsg,
+		_unknownMsg
+	);
+}
+
+void CHC::checkVerificationTargetsInParallel(std::map<unsigned, std::vector<CHCQueryPlaceholder>> const& _targetEntryPoints)
+{
+	auto* smtlib2Interface = dynamic_cast<CHCSmtLib2Interface*>(m_interface.get());
+	solAssert(smtlib2Interface);
+
+	// Unlike ``checkAndReportTarget``, a query is also created for a target whose error node is already
+	// known to be unsafe, because that depends on the results of the previous queries.
+	// Such targets are skipped when reporting, so that the results do not change.
+	// The queries are all built before any of them is solved, so the time budget
+	// can only exclude targets if it has already run out at this point.
+	if (timeBudgetExhausted())
+	{
+		m_targetsOutOfTimeBudget += _targetEntryPoints.size();
+		return;
+	}
+
+	std::vector<std::string> queries;
+	std::vector<std::string> errorNames;
+	for (auto const& [targetId, placeholders]: _targetEntryPoints)
+	{
+		addErrorRulesForTarget(m_verificationTargets.at(targetId), placeholders);
+		queries.emplace_back(smtlib2Interface->dumpQuery(error()));
+		errorNames.emplace_back(error().name);
+	}
+
+	auto results = smtlib2Interface->queryInParallel(queries, m_settings.parallelQueries);
+
+	for (auto&& [index, targetId]: _targetEntryPoints | ranges::views::keys | ranges::views::enumerate)
+	{
+		auto const& target = m_verificationTargets.at(targetId);
+		if (m_unsafeTargets.count(target.errorNode) && m_unsafeTargets.at(target.errorNode).count(target.type))
+			continue;
+		reportSolverFailure(std::get<CheckResult>(results[index]), target.errorNode->location());
+		auto [errorType, errorReporterId] = targetDescription(target);
+		reportTarget(
+			target,
+			results[index],
+			errorNames[index],
+			errorReporterId,
+			errorType + " happens here.",
+			errorType + " might happen here."
+		);
+	}
+}
+
+void CHC::addErrorRulesForTarget(CHCVerificationTarget const& _target, std::vector<CHCQueryPlaceholder> const& _placeholders)
+{
 	createErrorBlock();
 	for (auto const& placeholder: _placeholders)
 		connectBlocks(
@@ -2210,8 +2297,19 @@ void CHC::checkAndReportTarget(
 			error(),
 			placeholder.constraints && placeholder.errorExpression == _target.errorId
 		);
+}
+
+void CHC::reportTarget(
+	CHCVerificationTarget const& _target,
+	std::tuple<CheckResult, smtutil::Expression, CHCSolverInterface::CexGraph> const& _queryResult,
+	std::string const& _errorName,
+	ErrorId _errorReporterId,
+	std::string const& _satMsg,
+	std::string const& _unknownMsg
+)
+{
+	auto const& [result, invariant, model] = _queryResult;
 	auto const& location = _target.errorNode->location();
-	auto [result, invariant, model] = query(error(), location);
 	if (result == CheckResult::UNSATISFIABLE)
 	{
 		m_safeTargets[_target.errorNode].insert(_target);
@@ -2227,7 +2325,7 @@ void CHC::checkAndReportTarget(
 	else if (result == CheckResult::SATISFIABLE)
 	{
 		solAssert(!_satMsg.empty(), "");
-		auto cex = generateCounterexample(model, error().name);
+		auto cex = generateCounterexample(model, _errorName);
 		if (cex)
 			m_unsafeTargets[_target.errorNode][_target.type] = {
 				_errorReporterId,
@@ -286,11 +286,17 @@ private:
 	/// @returns <true, invariant, empty> if query is unsatisfiable (safe).
 	/// @returns <false, Expression(true), model> otherwise.
 	std::tuple<smtutil::CheckResult, smtutil::Expression, smtutil::CHCSolverInterface::CexGraph> query(smtutil::Expression const& _query, langutil::SourceLocation const& _location);
+	/// Reports a warning if @a _result indicates that the solvers failed to answer a query.
+	void reportSolverFailure(smtutil::CheckResult _result, langutil::SourceLocation const& _location);
 
 	void verificationTargetEncountered(ASTNode const* const _errorNode, VerificationTargetType _type, smtutil::Expression const& _errorCondition);
 
 	void checkVerificationTargets();
 	struct CHCQueryPlaceholder;
+	/// Checks the targets of @a _targetEntryPoints by creating the queries for all of them first and
+	/// sending them to the SMT-LIB2 based solver concurrently afterwards.
+	/// The results are reported in the same order as by ``checkAndReportTarget``.
+	void checkVerificationTargetsInParallel(std::map<unsigned, std::vector<CHCQueryPlaceholder>> const& _targetEntryPoints);
 	void checkAssertTarget(ASTNode const* _scope, CHCVerificationTarget const& _target);
 	void checkAndReportTarget(
 		CHCVerificationTarget const& _target,
@@ -299,6 +305,17 @@ private:
 		std::string _satMsg,
 		std::string _unknownMsg = ""
 	);
+	/// Creates a new error block that is reachable if @a _target can be violated from the given placeholders.
+	void addErrorRulesForTarget(CHCVerificationTarget const& _target, std::vector<CHCQueryPlaceholder> const& _placeholders);
+	/// Records the result of the query for @a _target, where @a _errorName is the name of its error block.
+	void reportTarget(
+		CHCVerificationTarget const& _target,
+		std::tuple<smtutil::CheckResult, smtutil::Expression, smtutil::CHCSolverInterface::CexGraph> const& _queryResult,
+		std::string const& _errorName,
+		langutil::ErrorId _errorReporterId,
+		std::string const& _satMsg,
+		std::string const& _unknownMsg
+	);
 
 	std::pair<std::string, langutil::ErrorId> targetDescription(CHCVerificationTarget const& _target);
 
@@ -428,6 +445,8 @@ private:
 	std::map<ASTNode const*, std::map<VerificationTargetType, ReportTargetInfo>, smt::EncodingContext::IdCompare> m_unsafeTargets;
 	/// Targets not proved.
 	std::map<ASTNode const*, std::map<VerificationTargetType, ReportTargetInfo>, smt::EncodingContext::IdCompare> m_unprovedTargets;
+	/// Number of targets that were not checked because the time budget had run out.
+	size_t m_targetsOutOfTimeBudget = 0;
 
 	/// Inferred invariants.
 	std::map<Predicate const*, std::set<std::string>, PredicateCompare> m_invariants;
@@ -30,6 +30,11 @@ public:
 		frontend::ReadCallback::Callback _smtCallback = {},
 		std::optional<unsigned> _queryTimeout = {}
 	);
+
+	/// Terminates the cvc5 process answering the current query, if the query is sent
+	/// via the SMT solver command of the universal callback.
+	void interrupt() override;
+
 private:
 	void setupSmtCallback() override;
 };
@@ -129,8 +129,10 @@ smtutil::Expression substitute(smtutil::Expression _from, std::map<std::string,
 		return smtutil::Expression(true);
 	if (_subst.count(_from.name))
 		_from.name = _subst.at(_from.name);
-	for (auto& arg: _from.arguments)
+	std::vector<smtutil::Expression> arguments = _from.arguments;
+	for (auto& arg: arguments)
 		arg = substitute(arg, _subst);
+	_from.arguments = std::move(arguments);
 	return _from;
 }
 
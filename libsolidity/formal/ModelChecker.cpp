@@ -48,6 +48,12 @@ ModelChecker::ModelChecker(
 	m_bmc(m_context, m_uniqueErrorReporter, m_unsupportedErrorReporter, _smtlib2Responses, _smtCallback, m_settings, _charStreamProvider),
 	m_chc(m_context, m_uniqueErrorReporter, m_unsupportedErrorReporter, _smtlib2Responses, _smtCallback, m_settings, _charStreamProvider)
 {
+	if (m_settings.timeBudget)
+	{
+		auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(*m_settings.timeBudget);
+		m_bmc.setDeadline(deadline);
+		m_chc.setDeadline(deadline);
+	}
 }
 
 // TODO This should be removed for 0.9.0.
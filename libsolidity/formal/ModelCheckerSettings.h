@@ -169,12 +169,20 @@ struct ModelCheckerSettings
 	ModelCheckerEngine engine = ModelCheckerEngine::None();
 	ModelCheckerExtCalls externalCalls = {};
 	ModelCheckerInvariants invariants = ModelCheckerInvariants::Default();
+	/// Maximum number of CHC queries that are sent to an SMT-LIB2 based Horn solver concurrently.
+	unsigned parallelQueries = 1;
 	bool printQuery = false;
+	/// If enabled, BMC queries are sent to all enabled solvers concurrently and the first
+	/// definitive answer is used, instead of querying the solvers one after another.
+	bool raceSolvers = false;
 	bool showProvedSafe = false;
 	bool showUnproved = false;
 	bool showUnsupported = false;
 	smtutil::SMTSolverChoice solvers = smtutil::SMTSolverChoice::Z3();
 	ModelCheckerTargets targets = ModelCheckerTargets::Default();
+	/// Total time that the queries of both engines may take, in milliseconds.
+	/// Once it has run out, the remaining verification targets are not checked.
+	std::optional<unsigned> timeBudget;
 	std::optional<unsigned> timeout; // in milliseconds
 
 	bool operator!=(ModelCheckerSettings const& _other) const noexcept { return !(*this == _other); }
@@ -187,12 +195,15 @@ struct ModelCheckerSettings
 			engine == _other.engine &&
 			externalCalls.mode == _other.externalCalls.mode &&
 			invariants == _other.invariants &&
+			parallelQueries == _other.parallelQueries &&
 			printQuery == _other.printQuery &&
+			raceSolvers == _other.raceSolvers &&
 			showProvedSafe == _other.showProvedSafe &&
 			showUnproved == _other.showUnproved &&
 			showUnsupported == _other.showUnsupported &&
 			solvers == _other.solvers &&
 			targets == _other.targets &&
+			timeBudget == _other.timeBudget &&
 			timeout == _other.timeout;
 	}
 };
@@ -46,6 +46,11 @@ using namespace solidity::langutil;
 using namespace solidity::frontend;
 using namespace std::string_literals;
 
+std::map<
+	std::pair<FunctionDefinition const*, ContractDefinition const*>,
+	std::vector<VariableDeclaration const*>
+> SMTEncoder::m_localVariablesIncludingModifiers;
+
 SMTEncoder::SMTEncoder(
 	smt::EncodingContext& _context,
 	ModelCheckerSettings _settings,
@@ -64,6 +69,7 @@ SMTEncoder::SMTEncoder(
 void SMTEncoder::resetSourceAnalysis()
 {
 	m_freeFunctions.clear();
+	m_localVariablesIncludingModifiers.clear();
 }
 
 bool SMTEncoder::visit(ContractDefinition const& _contract)
@@ -2949,9 +2955,16 @@ std::vector<VariableDeclaration const*> SMTEncoder::stateVariablesIncludingInher
 	return {};
 }
 
-std::vector<VariableDeclaration const*> SMTEncoder::localVariablesIncludingModifiers(FunctionDefinition const& _function, ContractDefinition const* _contract)
+std::vector<VariableDeclaration const*> const& SMTEncoder::localVariablesIncludingModifiers(FunctionDefinition const& _function, ContractDefinition const* _contract)
 {
-	return _function.localVariables() + tryCatchVariables(_function) + modifiersVariables(_function, _contract);
+	auto key = std::make_pair(&_function, _contract);
+	auto it = m_localVariablesIncludingModifiers.find(key);
+	if (it == m_localVariablesIncludingModifiers.end())
+		it = m_localVariablesIncludingModifiers.emplace(
+			key,
+			_function.localVariables() + tryCatchVariables(_function) + modifiersVariables(_function, _contract)
+		).first;
+	return it->second;
 }
 
 std::vector<VariableDeclaration const*> SMTEncoder::tryCatchVariables(FunctionDefinition const& _function)
@@ -34,6 +34,8 @@
 #include <libsolidity/interface/ReadFile.h>
 #include <liblangutil/UniqueErrorReporter.h>
 
+#include <chrono>
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -107,7 +109,11 @@ public:
 	static std::vector<VariableDeclaration const*> stateVariablesIncludingInheritedAndPrivate(ContractDefinition const& _contract);
 	static std::vector<VariableDeclaration const*> stateVariablesIncludingInheritedAndPrivate(FunctionDefinition const& _function);
 
-	static std::vector<VariableDeclaration const*> localVariablesIncludingModifiers(FunctionDefinition const& _function, ContractDefinition const* _contract);
+	/// @returns the local variables of _function, including the ones declared
+	/// in try/catch clauses and in the modifiers it invokes when resolved in _contract.
+	/// The result only depends on the AST, so it is cached per function and context
+	/// contract and shared by every contract that inherits or calls _function.
+	static std::vector<VariableDeclaration const*> const& localVariablesIncludingModifiers(FunctionDefinition const& _function, ContractDefinition const* _contract);
 	static std::vector<VariableDeclaration const*> modifiersVariables(FunctionDefinition const& _function, ContractDefinition const* _contract);
 	static std::vector<VariableDeclaration const*> tryCatchVariables(FunctionDefinition const& _function);
 
@@ -128,9 +134,15 @@ public:
 	/// including itself.
 	static std::set<SourceUnit const*, ASTNode::CompareByID> sourceDependencies(SourceUnit const& _source);
 
+	/// Sets the point in time after which no more verification targets are sent to the solvers.
+	void setDeadline(std::optional<std::chrono::steady_clock::time_point> _deadline) { m_deadline = _deadline; }
+
 protected:
 	void resetSourceAnalysis();
 
+	/// @returns true if a deadline was set and it has passed.
+	bool timeBudgetExhausted() const { return m_deadline && std::chrono::steady_clock::now() >= *m_deadline; }
+
 	// TODO: Check that we do not have concurrent reads and writes to a variable,
 	// because the order of expression evaluation is undefined
 	// TODO: or just force a certain order, but people might have a different idea about that.
@@ -492,6 +504,13 @@ protected:
 	/// Those need to be encoded repeatedely for every analyzed contract.
 	std::set<FunctionDefinition const*, ASTNode::CompareByID> m_freeFunctions;
 
+	/// Cache for the method localVariablesIncludingModifiers.
+	/// Cleared in resetSourceAnalysis, since it is keyed by AST nodes.
+	static std::map<
+		std::pair<FunctionDefinition const*, ContractDefinition const*>,
+		std::vector<VariableDeclaration const*>
+	> m_localVariablesIncludingModifiers;
+
 	/// Stores the context of the encoding.
 	smt::EncodingContext& m_context;
 
@@ -501,6 +520,9 @@ protected:
 	/// used for retrieving source text of expressions for e.g. counter-examples.
 	langutil::CharStreamProvider const& m_charStreamProvider;
 
+	/// End of the time budget of the model checker, shared by both engines.
+	std::optional<std::chrono::steady_clock::time_point> m_deadline;
+
 	smt::SymbolicState& state();
 
 private:
@@ -0,0 +1,81 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <libsolidity/interface/CompilationCache.h>
+
+#include <libsolutil/CommonIO.h>
+#include <libsolutil/Exceptions.h>
+
+#include <fstream>
+
+using namespace solidity;
+using namespace solidity::frontend;
+using namespace solidity::util;
+
+namespace fs = boost::filesystem;
+
+std::optional<std::string> CompilationCache::load(h256 const& _key) const
+{
+	try
+	{
+		fs::path path = entryPath(_key);
+		if (!fs::is_regular_file(path))
+			return std::nullopt;
+		return readFileAsString(path);
+	}
+	catch (fs::filesystem_error const&)
+	{
+		return std::nullopt;
+	}
+	catch (util::Exception const&)
+	{
+		return std::nullopt;
+	}
+}
+
+void CompilationCache::store(h256 const& _key, std::string const& _content) const
+{
+	boost::system::error_code error;
+	fs::create_directories(m_directory, error);
+	if (error)
+		return;
+
+	// Write to a temporary file first and move it into place afterwards, so that readers
+	// never see partially written entries.
+	fs::path path = entryPath(_key);
+	fs::path temporaryPath = path;
+	temporaryPath += fs::unique_path(".%%%%-%%%%-%%%%-%%%%.tmp");
+	{
+		std::ofstream file(temporaryPath.string(), std::ios::binary);
+		file << _content;
+		if (!file)
+		{
+			file.close();
+			fs::remove(temporaryPath, error);
+			return;
+		}
+	}
+	fs::rename(temporaryPath, path, error);
+	if (error)
+		fs::remove(temporaryPath, error);
+}
+
+fs::path CompilationCache::entryPath(h256 const& _key) const
+{
+	return m_directory / _key.hex();
+}
@@ -0,0 +1,61 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Persistent cache for the results of expensive compilation steps.
+ */
+
+#pragma once
+
+#include <libsolutil/FixedHash.h>
+
+#include <boost/filesystem.hpp>
+
+#include <optional>
+#include <string>
+
+namespace solidity::frontend
+{
+
+/**
+ * Content-addressed cache that stores its entries as files in a directory on disk, so that
+ * the results of a compilation step can be reused by subsequent compiler runs.
+ * The key of an entry has to be derived from everything that influences its content.
+ *
+ * Errors while accessing the cache are not fatal: an entry that cannot be read is treated
+ * as missing and failing to write an entry is ignored.
+ * The cache can be used from multiple threads and processes at the same time.
+ */
+class CompilationCache
+{
+public:
+	explicit CompilationCache(boost::filesystem::path _directory): m_directory(std::move(_directory)) {}
+
+	/// @returns the content of the entry with the given key or nullopt if there is none.
+	std::optional<std::string> load(util::h256 const& _key) const;
+	/// Stores an entry under the given key, replacing any existing entry.
+	void store(util::h256 const& _key, std::string const& _content) const;
+
+	boost::filesystem::path const& directory() const { return m_directory; }
+
+private:
+	boost::filesystem::path entryPath(util::h256 const& _key) const;
+
+	boost::filesystem::path m_directory;
+};
+
+}
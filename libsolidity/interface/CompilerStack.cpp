@@ -84,8 +84,12 @@
 #include <libsolutil/JSON.h>
 #include <libsolutil/Algorithms.h>
 #include <libsolutil/FunctionSelector.h>
+#include <libsolutil/Parallel.h>
+#include <libsolutil/CommonIO.h>
+#include <libsolutil/Keccak256.h>
 
 #include <boost/algorithm/string/replace.hpp>
+#include <boost/algorithm/string/trim.hpp>
 
 #include <range/v3/algorithm/all_of.hpp>
 #include <range/v3/view/concat.hpp>
@@ -137,13 +141,15 @@ void CompilerStack::createAndAssignCallGraphs()
 			ContractDefinitionAnnotation& annotation =
 				m_contracts.at(contract->fullyQualifiedName()).contract->annotation();
 
+			FunctionCallGraphBuilder::VisitEffects visitEffects;
 			annotation.creationCallGraph = std::make_unique<CallGraph>(
-				FunctionCallGraphBuilder::buildCreationGraph(*contract)
+				FunctionCallGraphBuilder::buildCreationGraph(*contract, &visitEffects)
 			);
 			annotation.deployedCallGraph = std::make_unique<CallGraph>(
 				FunctionCallGraphBuilder::buildDeployedGraph(
 					*contract,
-					**annotation.creationCallGraph
+					**annotation.creationCallGraph,
+					&visitEffects
 				)
 			);
 
@@ -229,6 +235,41 @@ void CompilerStack::setViaIR(bool _viaIR)
 	m_viaIR = _viaIR;
 }
 
+void CompilerStack::setParallelism(size_t _jobs)
+{
+	solAssert(_jobs >= 1);
+	m_parallelism = _jobs;
+}
+
+void CompilerStack::setConcurrentImportReads(bool _concurrentImportReads)
+{
+	if (m_stackState >= ParsedAndImported)
+		solThrow(CompilerError, "Must set concurrent import reads before parsing.");
+	m_concurrentImportReads = _concurrentImportReads;
+}
+
+void CompilerStack::setBatchImportReads(bool _batchImportReads)
+{
+	if (m_stackState >= ParsedAndImported)
+		solThrow(CompilerError, "Must set batch import reads before parsing.");
+	m_batchImportReads = _batchImportReads;
+}
+
+void CompilerStack::setImportPrefetchHints(std::vector<std::string> _paths)
+{
+	if (m_stackState >= ParsedAndImported)
+		solThrow(CompilerError, "Must set import prefetch hints before parsing.");
+	m_importPrefetchHints = std::move(_paths);
+}
+
+void CompilerStack::setCacheDirectory(boost::filesystem::path const& _directory)
+{
+	if (_directory.empty())
+		m_compilationCache.reset();
+	else
+		m_compilationCache = std::make_unique<CompilationCache>(_directory);
+}
+
 void CompilerStack::setEVMVersion(langutil::EVMVersion _version)
 {
 	if (m_stackState >= ParsedAndImported)
@@ -324,9 +365,17 @@ void CompilerStack::reset(bool _keepSettings)
 		m_importRemapper.clear();
 		m_libraries.clear();
 		m_viaIR = false;
+		m_parallelism = 1;
+		m_concurrentImportReads = false;
+		m_batchImportReads = false;
+		m_importPrefetchHints.clear();
+		m_compilationCache.reset();
 		m_evmVersion = langutil::EVMVersion();
 		m_modelCheckerSettings = ModelCheckerSettings{};
 		m_generateIR = false;
+		m_optimizerProfiling = false;
+		m_irGasEstimation = false;
+		m_tracer.reset();
 		m_revertStrings = RevertStrings::Default;
 		m_optimiserSettings = OptimiserSettings::minimal();
 		m_metadataLiteralSources = false;
@@ -348,7 +397,7 @@ void CompilerStack::setSources(StringMap _sources)
 		solThrow(CompilerError, "Cannot change sources once set.");
 	if (m_stackState != Empty)
 		solThrow(CompilerError, "Must set sources before parsing.");
-	for (auto source: _sources)
+	for (auto& source: _sources)
 		m_sources[source.first].charStream = std::make_unique<CharStream>(/*content*/std::move(source.second), /*name*/source.first);
 	m_stackState = SourcesSet;
 }
@@ -359,6 +408,9 @@ bool CompilerStack::parse()
 		solThrow(CompilerError, "Must call parse only after the SourcesSet state.");
 	m_errorReporter.clear();
 
+	util::PhaseTracer::Activation tracerActivation(m_tracer.get());
+	util::PhaseTracer::Scope tracerScope("CompilerStack::parse");
+
 	if (SemVerVersion{std::string(VersionString)}.isPrerelease())
 		m_errorReporter.warning(3805_error, "This is a pre-release compiler version, please do not use it in production.");
 
@@ -368,48 +420,74 @@ bool CompilerStack::parse()
 	for (auto const& s: m_sources)
 		sourcesToParse.push_back(s.first);
 
-	for (size_t i = 0; i < sourcesToParse.size(); ++i)
+	// Prefetched sources are only added once they are actually imported.
+	std::vector<std::string> prefetch = m_importPrefetchHints;
+	StringMap prefetchedSources;
+	// Standard library sources are parsed only once, no matter how many sources import them.
+	std::set<std::string> addedStdlibSources;
+	for (size_t groupBegin = 0; groupBegin < sourcesToParse.size();)
 	{
-		std::string const& path = sourcesToParse[i];
-		Source& source = m_sources[path];
-		source.ast = parser.parse(*source.charStream);
-		if (!source.ast)
-			solAssert(Error::containsErrors(m_errorReporter.errors()), "Parser returned null but did not report error.");
-		else
+		// With batched import reads, all sources known so far, i.e. one level of the import graph,
+		// are parsed before their missing imports are read together. Otherwise each source is
+		// parsed and its imports are loaded before the next one. Either way, the sources end up
+		// in the same order.
+		size_t const groupEnd = m_batchImportReads ? sourcesToParse.size() : groupBegin + 1;
+		std::vector<SourceUnit const*> asts;
+		std::vector<std::vector<std::string>> stdlibImports;
+		for (size_t i = groupBegin; i < groupEnd; ++i)
 		{
-			source.ast->annotation().path = path;
-
-			for (auto const& import: ASTNode::filteredNodes<ImportDirective>(source.ast->nodes()))
+			std::string const path = sourcesToParse[i];
+			Source& source = m_sources[path];
 			{
-				solAssert(!import->path().empty(), "Import path cannot be empty.");
-				// Check whether the import directive is for the standard library,
-				// and if yes, add specified file to source units to be parsed.
-				auto it = stdlib::sources.find(import->path());
-				if (it != stdlib::sources.end())
-				{
-					auto [name, content] = *it;
-					m_sources[name].charStream = std::make_unique<CharStream>(content, name);
-					sourcesToParse.push_back(name);
-				}
-
-				// The current value of `path` is the absolute path as seen from this source file.
-				// We first have to apply remappings before we can store the actual absolute path
-				// as seen globally.
-				import->annotation().absolutePath = applyRemapping(util::absolutePath(
-					import->path(),
-					path
-				), path);
+				util::PhaseTracer::Scope parserScope("Parser", path);
+				source.ast = parser.parse(*source.charStream);
 			}
+			asts.push_back(source.ast.get());
+			stdlibImports.emplace_back();
+			if (!source.ast)
+				solAssert(Error::containsErrors(m_errorReporter.errors()), "Parser returned null but did not report error.");
+			else
+			{
+				source.ast->annotation().path = path;
 
-			if (m_stopAfter >= ParsedAndImported)
-				for (auto const& newSource: loadMissingSources(*source.ast))
+				for (auto const& import: ASTNode::filteredNodes<ImportDirective>(source.ast->nodes()))
 				{
-					std::string const& newPath = newSource.first;
-					std::string const& newContents = newSource.second;
-					m_sources[newPath].charStream = std::make_shared<CharStream>(newContents, newPath);
-					sourcesToParse.push_back(newPath);
+					solAssert(!import->path().empty(), "Import path cannot be empty.");
+					// Check whether the import directive is for the standard library,
+					// and if yes, add specified file to source units to be parsed.
+					auto it = stdlib::sources.find(import->path());
+					if (it != stdlib::sources.end() && addedStdlibSources.insert(it->first).second)
+					{
+						auto const& [name, content] = *it;
+						m_sources[name].charStream = std::make_unique<CharStream>(content, name);
+						stdlibImports.back().push_back(name);
+					}
+
+					// The current value of `path` is the absolute path as seen from this source file.
+					// We first have to apply remappings before we can store the actual absolute path
+					// as seen globally.
+					import->annotation().absolutePath = applyRemapping(util::absolutePath(
+						import->path(),
+						path
+					), path);
 				}
+			}
 		}
+
+		std::vector<StringMap> newSources(asts.size());
+		if (m_stopAfter >= ParsedAndImported)
+			newSources = loadMissingSources(asts, prefetch, prefetchedSources);
+		for (size_t i = 0; i < asts.size(); ++i)
+		{
+			sourcesToParse += stdlibImports[i];
+			for (auto& newSource: newSources[i])
+			{
+				std::string const& newPath = newSource.first;
+				m_sources[newPath].charStream = std::make_shared<CharStream>(std::move(newSource.second), newPath);
+				sourcesToParse.push_back(newPath);
+			}
+		}
+		groupBegin = groupEnd;
 	}
 
 	if (Error::containsErrors(m_errorReporter.errors()))
@@ -453,6 +531,9 @@ bool CompilerStack::analyze()
 	if (m_stackState != ParsedAndImported)
 		solThrow(CompilerError, "Must call analyze only after parsing was successful.");
 
+	util::PhaseTracer::Activation tracerActivation(m_tracer.get());
+	util::PhaseTracer::Scope tracerScope("CompilerStack::analyze");
+
 	if (!resolveImports())
 		return false;
 
@@ -466,38 +547,48 @@ bool CompilerStack::analyze()
 	{
 		bool experimentalSolidity = isExperimentalSolidity();
 
-		SyntaxChecker syntaxChecker(m_errorReporter, m_optimiserSettings.runYulOptimiser);
-		for (Source const* source: m_sourceOrder)
-			if (source->ast && !syntaxChecker.checkSyntax(*source->ast))
+		{
+			util::PhaseTracer::Scope syntaxCheckerScope("SyntaxChecker");
+			if (!checkSourcesIndependently([&](SourceUnit const& _sourceUnit, ErrorReporter& _errorReporter) {
+				return SyntaxChecker(_errorReporter, m_optimiserSettings.runYulOptimiser).checkSyntax(_sourceUnit);
+			}))
 				noErrors = false;
+		}
 
 		m_globalContext = std::make_shared<GlobalContext>(m_evmVersion);
 		// We need to keep the same resolver during the whole process.
 		NameAndTypeResolver resolver(*m_globalContext, m_evmVersion, m_errorReporter, experimentalSolidity);
-		for (Source const* source: m_sourceOrder)
-			if (source->ast && !resolver.registerDeclarations(*source->ast))
-				return false;
+		{
+			util::PhaseTracer::Scope resolverScope("NameAndTypeResolver::registerDeclarations");
+			for (Source const* source: m_sourceOrder)
+				if (source->ast && !resolver.registerDeclarations(*source->ast))
+					return false;
 
-		std::map<std::string, SourceUnit const*> sourceUnitsByName;
-		for (auto& source: m_sources)
-			sourceUnitsByName[source.first] = source.second.ast.get();
-		for (Source const* source: m_sourceOrder)
-			if (source->ast && !resolver.performImports(*source->ast, sourceUnitsByName))
-				return false;
+			std::map<std::string, SourceUnit const*> sourceUnitsByName;
+			for (auto& source: m_sources)
+				sourceUnitsByName[source.first] = source.second.ast.get();
+			for (Source const* source: m_sourceOrder)
+				if (source->ast && !resolver.performImports(*source->ast, sourceUnitsByName))
+					return false;
 
-		resolver.warnHomonymDeclarations();
+			resolver.warnHomonymDeclarations();
+		}
 
 		{
-			DocStringTagParser docStringTagParser(m_errorReporter);
-			for (Source const* source: m_sourceOrder)
-				if (source->ast && !docStringTagParser.parseDocStrings(*source->ast))
-					noErrors = false;
+			util::PhaseTracer::Scope docStringTagParserScope("DocStringTagParser");
+			if (!checkSourcesIndependently([](SourceUnit const& _sourceUnit, ErrorReporter& _errorReporter) {
+				return DocStringTagParser(_errorReporter).parseDocStrings(_sourceUnit);
+			}))
+				noErrors = false;
 		}
 
-		// Requires DocStringTagParser
-		for (Source const* source: m_sourceOrder)
-			if (source->ast && !resolver.resolveNamesAndTypes(*source->ast))
-				return false;
+		{
+			util::PhaseTracer::Scope resolverScope("NameAndTypeResolver::resolveNamesAndTypes");
+			// Requires DocStringTagParser
+			for (Source const* source: m_sourceOrder)
+				if (source->ast && !resolver.resolveNamesAndTypes(*source->ast))
+					return false;
+		}
 
 		if (experimentalSolidity)
 		{
@@ -522,14 +613,58 @@ bool CompilerStack::analyze()
 }
 
 
+bool CompilerStack::checkSourcesIndependently(std::function<bool(SourceUnit const&, ErrorReporter&)> const& _check)
+{
+	bool noErrors = true;
+	if (m_parallelism == 1)
+	{
+		for (Source const* source: m_sourceOrder)
+			if (source->ast && !_check(*source->ast, m_errorReporter))
+				noErrors = false;
+		return noErrors;
+	}
+
+	std::vector<ErrorList> errors(m_sourceOrder.size());
+	std::vector<uint8_t> success(m_sourceOrder.size(), true);
+	std::vector<std::exception_ptr> exceptions(m_sourceOrder.size());
+	util::runInParallel(m_parallelism, m_sourceOrder.size(), [&](size_t _index) {
+		Source const* source = m_sourceOrder[_index];
+		if (!source->ast)
+			return;
+		ErrorReporter errorReporter(errors[_index]);
+		try
+		{
+			success[_index] = _check(*source->ast, errorReporter);
+		}
+		catch (...)
+		{
+			exceptions[_index] = std::current_exception();
+		}
+	});
+
+	// Report everything up to the first source whose check threw, like a sequential run would.
+	for (size_t index = 0; index < m_sourceOrder.size(); ++index)
+	{
+		m_errorReporter.report(errors[index]);
+		if (exceptions[index])
+			std::rethrow_exception(exceptions[index]);
+		if (!success[index])
+			noErrors = false;
+	}
+	return noErrors;
+}
+
 bool CompilerStack::analyzeLegacy(bool _noErrorsSoFar)
 {
 	bool noErrors = _noErrorsSoFar;
 
-	DeclarationTypeChecker declarationTypeChecker(m_errorReporter, m_evmVersion);
-	for (Source const* source: m_sourceOrder)
-		if (source->ast && !declarationTypeChecker.check(*source->ast))
-			return false;
+	{
+		util::PhaseTracer::Scope tracerScope("DeclarationTypeChecker");
+		DeclarationTypeChecker declarationTypeChecker(m_errorReporter, m_evmVersion);
+		for (Source const* source: m_sourceOrder)
+			if (source->ast && !declarationTypeChecker.check(*source->ast))
+				return false;
+	}
 
 	// Requires DeclarationTypeChecker to have run
 	DocStringTagParser docStringTagParser(m_errorReporter);
@@ -541,11 +676,14 @@ bool CompilerStack::analyzeLegacy(bool _noErrorsSoFar)
 	// contract or function level.
 	// This also calculates whether a contract is abstract, which is needed by the
 	// type checker.
-	ContractLevelChecker contractLevelChecker(m_errorReporter);
+	{
+		util::PhaseTracer::Scope tracerScope("ContractLevelChecker");
+		ContractLevelChecker contractLevelChecker(m_errorReporter);
 
-	for (Source const* source: m_sourceOrder)
-		if (auto sourceAst = source->ast)
-			noErrors = contractLevelChecker.check(*sourceAst);
+		for (Source const* source: m_sourceOrder)
+			if (auto sourceAst = source->ast)
+				noErrors = contractLevelChecker.check(*sourceAst);
+	}
 
 	// Now we run full type checks that go down to the expression level. This
 	// cannot be done earlier, because we need cross-contract types and information
@@ -554,10 +692,13 @@ bool CompilerStack::analyzeLegacy(bool _noErrorsSoFar)
 	//
 	// Note: this does not resolve overloaded functions. In order to do that, types of arguments are needed,
 	// which is only done one step later.
-	TypeChecker typeChecker(m_evmVersion, m_errorReporter);
-	for (Source const* source: m_sourceOrder)
-		if (source->ast && !typeChecker.checkTypeRequirements(*source->ast))
-			noErrors = false;
+	{
+		util::PhaseTracer::Scope tracerScope("TypeChecker");
+		TypeChecker typeChecker(m_evmVersion, m_errorReporter);
+		for (Source const* source: m_sourceOrder)
+			if (source->ast && !typeChecker.checkTypeRequirements(*source->ast))
+				noErrors = false;
+	}
 
 	if (noErrors)
 	{
@@ -571,6 +712,7 @@ bool CompilerStack::analyzeLegacy(bool _noErrorsSoFar)
 	if (noErrors)
 	{
 		// Checks that can only be done when all types of all AST nodes are known.
+		util::PhaseTracer::Scope tracerScope("PostTypeChecker");
 		PostTypeChecker postTypeChecker(m_errorReporter);
 		for (Source const* source: m_sourceOrder)
 			if (source->ast && !postTypeChecker.check(*source->ast))
@@ -605,6 +747,7 @@ bool CompilerStack::analyzeLegacy(bool _noErrorsSoFar)
 	{
 		// Control flow graph generator and analyzer. It can check for issues such as
 		// variable is used before it is assigned to.
+		util::PhaseTracer::Scope tracerScope("ControlFlowAnalyzer");
 		CFG cfg(m_errorReporter);
 		for (Source const* source: m_sourceOrder)
 			if (source->ast && !cfg.constructFlow(*source->ast))
@@ -624,6 +767,7 @@ bool CompilerStack::analyzeLegacy(bool _noErrorsSoFar)
 	if (noErrors)
 	{
 		// Checks for common mistakes. Only generates warnings.
+		util::PhaseTracer::Scope tracerScope("StaticAnalyzer");
 		StaticAnalyzer staticAnalyzer(m_errorReporter);
 		for (Source const* source: m_sourceOrder)
 			if (source->ast && !staticAnalyzer.analyze(*source->ast))
@@ -633,6 +777,7 @@ bool CompilerStack::analyzeLegacy(bool _noErrorsSoFar)
 	if (noErrors)
 	{
 		// Check for state mutability in every function.
+		util::PhaseTracer::Scope tracerScope("ViewPureChecker");
 		std::vector<ASTPointer<ASTNode>> ast;
 		for (Source const* source: m_sourceOrder)
 			if (source->ast)
@@ -645,6 +790,7 @@ bool CompilerStack::analyzeLegacy(bool _noErrorsSoFar)
 	if (noErrors)
 	{
 		// Run SMTChecker
+		util::PhaseTracer::Scope tracerScope("SMTChecker");
 
 		auto allSources = util::applyMap(m_sourceOrder, [](Source const* _source) { return _source->ast; });
 		if (ModelChecker::isPragmaPresent(allSources))
@@ -725,61 +871,82 @@ bool CompilerStack::compile(State _stopAfter)
 	if (m_stackState >= m_stopAfter)
 		return true;
 
-	// Only compile contracts individually which have been requested.
-	std::map<ContractDefinition const*, std::shared_ptr<Compiler const>> otherCompilers;
+	util::PhaseTracer::Activation tracerActivation(m_tracer.get());
+	util::PhaseTracer::Scope tracerScope("CompilerStack::compile");
 
+	// Only compile contracts individually which have been requested.
+	std::vector<ContractDefinition const*> requestedContracts;
 	for (Source const* source: m_sourceOrder)
 		for (ASTPointer<ASTNode> const& node: source->ast->nodes())
 			if (auto contract = dynamic_cast<ContractDefinition const*>(node.get()))
 				if (isRequestedContract(*contract))
-				{
-					try
-					{
-						if ((m_generateEvmBytecode && m_viaIR) || m_generateIR)
-							generateIR(*contract);
-						if (m_generateEvmBytecode)
-						{
-							if (m_viaIR)
-								generateEVMFromIR(*contract);
-							else
-							{
-								if (m_experimentalAnalysis)
-									solThrow(CompilerError, "Legacy codegen after experimental analysis is unsupported.");
-								compileContract(*contract, otherCompilers);
-							}
-						}
-					}
-					catch (Error const& _error)
-					{
-						if (_error.type() != Error::Type::CodeGenerationError)
-							throw;
-						m_errorReporter.error(_error.errorId(), _error.type(), SourceLocation(), _error.what());
-						return false;
-					}
-					catch (UnimplementedFeatureError const& _unimplementedError)
-					{
-						if (
-							SourceLocation const* sourceLocation =
-							boost::get_error_info<langutil::errinfo_sourceLocation>(_unimplementedError)
-						)
-						{
-							std::string const* comment = _unimplementedError.comment();
-							m_errorReporter.error(
-								1834_error,
-								Error::Type::CodeGenerationError,
-								*sourceLocation,
-								fmt::format(
-									"Unimplemented feature error {} in {}",
-									(comment && !comment->empty()) ? ": " + *comment : "",
-									_unimplementedError.lineInfo()
-								)
-							);
-							return false;
-						}
-						else
-							throw;
-					}
-				}
+					requestedContracts.push_back(contract);
+
+	std::map<ContractDefinition const*, std::shared_ptr<Compiler const>> otherCompilers;
+	m_yulFunctionCache = std::make_shared<MultiUseYulFunctionCache>();
+	ScopeGuard releaseYulFunctionCache([&]() { m_yulFunctionCache.reset(); });
+
+	try
+	{
+		if ((m_generateEvmBytecode && m_viaIR) || m_generateIR)
+		{
+			for (ContractDefinition const* contract: requestedContracts)
+				generateIR(*contract);
+			optimizeIR();
+		}
+		if (m_generateEvmBytecode)
+		{
+			if (m_viaIR)
+			{
+				// Code generation from the optimized IR only touches the state of the contract
+				// being compiled, so independent contracts can be processed concurrently.
+				// Threads not needed for that are used to optimise the sub-assemblies of each contract.
+				size_t const parallelismPerContract = std::max<size_t>(1, m_parallelism / std::max<size_t>(1, requestedContracts.size()));
+				util::runInParallel(m_parallelism, requestedContracts.size(), [&](size_t _index) {
+					generateEVMFromIR(*requestedContracts[_index], parallelismPerContract);
+				});
+				for (ContractDefinition const* contract: requestedContracts)
+					checkCodeSizeLimits(*contract);
+			}
+			else
+			{
+				if (m_experimentalAnalysis)
+					solThrow(CompilerError, "Legacy codegen after experimental analysis is unsupported.");
+				for (ContractDefinition const* contract: requestedContracts)
+					compileContract(*contract, otherCompilers);
+			}
+		}
+	}
+	catch (Error const& _error)
+	{
+		if (_error.type() != Error::Type::CodeGenerationError)
+			throw;
+		m_errorReporter.error(_error.errorId(), _error.type(), SourceLocation(), _error.what());
+		return false;
+	}
+	catch (UnimplementedFeatureError const& _unimplementedError)
+	{
+		if (
+			SourceLocation const* sourceLocation =
+			boost::get_error_info<langutil::errinfo_sourceLocation>(_unimplementedError)
+		)
+		{
+			std::string const* comment = _unimplementedError.comment();
+			m_errorReporter.error(
+				1834_error,
+				Error::Type::CodeGenerationError,
+				*sourceLocation,
+				fmt::format(
+					"Unimplemented feature error {} in {}",
+					(comment && !comment->empty()) ? ": " + *comment : "",
+					_unimplementedError.lineInfo()
+				)
+			);
+			return false;
+		}
+		else
+			throw;
+	}
 	m_stackState = CompilationSuccessful;
 	this->link();
 	return true;
@@ -968,6 +1135,26 @@ Json const& CompilerStack::yulIROptimizedAst(std::string const& _contractName) c
 	return contract(_contractName).yulIROptimizedAst;
 }
 
+Json const& CompilerStack::yulIROptimizerProfile(std::string const& _contractName) const
+{
+	if (m_stackState != CompilationSuccessful)
+		solThrow(CompilerError, "Compilation was not successful.");
+
+	solUnimplementedAssert(!isExperimentalSolidity());
+
+	return contract(_contractName).yulIROptimizerProfile;
+}
+
+Json const& CompilerStack::yulIROptimizedGasEstimates(std::string const& _contractName) const
+{
+	if (m_stackState != CompilationSuccessful)
+		solThrow(CompilerError, "Compilation was not successful.");
+
+	solUnimplementedAssert(!isExperimentalSolidity());
+
+	return contract(_contractName).yulIROptimizedGasEstimates;
+}
+
 evmasm::LinkerObject const& CompilerStack::object(std::string const& _contractName) const
 {
 	if (m_stackState != CompilationSuccessful)
@@ -1105,36 +1292,41 @@ Json const& CompilerStack::natspecDev(Contract const& _contract) const
 	return _contract.devDocumentation.init([&]{ return Natspec::devDocumentation(*_contract.contract); });
 }
 
-Json CompilerStack::interfaceSymbols(std::string const& _contractName) const
+Json const& CompilerStack::interfaceSymbols(std::string const& _contractName) const
 {
 	if (m_stackState < AnalysisSuccessful)
 		solThrow(CompilerError, "Analysis was not successful.");
 
 	solUnimplementedAssert(!isExperimentalSolidity());
 
-	Json interfaceSymbols;
-	// Always have a methods object
-	interfaceSymbols["methods"] = Json::object();
-
-	for (auto const& it: contractDefinition(_contractName).interfaceFunctions())
-		interfaceSymbols["methods"][it.second->externalSignature()] = it.first.hex();
-	for (ErrorDefinition const* error: contractDefinition(_contractName).interfaceErrors())
-	{
-		std::string signature = error->functionType(true)->externalSignature();
-		interfaceSymbols["errors"][signature] = util::toHex(toCompactBigEndian(util::selectorFromSignatureU32(signature), 4));
-	}
-
-	for (EventDefinition const* event: ranges::concat_view(
-		contractDefinition(_contractName).definedInterfaceEvents(),
-		contractDefinition(_contractName).usedInterfaceEvents()
-	))
-		if (!event->isAnonymous())
+	Contract const& compiledContract = contract(_contractName);
+	solAssert(compiledContract.contract);
+	return compiledContract.interfaceSymbols.init([&]{
+		ContractDefinition const& contractDefinition = *compiledContract.contract;
+		Json interfaceSymbols;
+		// Always have a methods object
+		interfaceSymbols["methods"] = Json::object();
+
+		for (auto const& it: contractDefinition.interfaceFunctions())
+			interfaceSymbols["methods"][it.second->externalSignature()] = it.first.hex();
+		for (ErrorDefinition const* error: contractDefinition.interfaceErrors())
 		{
-			std::string signature = event->functionType(true)->externalSignature();
-			interfaceSymbols["events"][signature] = toHex(u256(h256::Arith(util::keccak256(signature))));
+			std::string signature = error->functionType(true)->externalSignature();
+			interfaceSymbols["errors"][signature] = util::toHex(toCompactBigEndian(util::selectorFromSignatureU32(signature), 4));
 		}
 
-	return interfaceSymbols;
+		for (EventDefinition const* event: ranges::concat_view(
+			contractDefinition.definedInterfaceEvents(),
+			contractDefinition.usedInterfaceEvents()
+		))
+			if (!event->isAnonymous())
+			{
+				std::string signature = event->functionType(true)->externalSignature();
+				interfaceSymbols["events"][signature] = toHex(u256(h256::Arith(util::keccak256(signature))));
+			}
+
+		return interfaceSymbols;
+	});
 }
 
 bytes CompilerStack::cborMetadata(std::string const& _contractName, bool _forIR) const
@@ -1209,49 +1401,88 @@ h256 const& CompilerStack::Source::keccak256() const
 	return keccak256HashCached;
 }
 
-h256 const& CompilerStack::Source::swarmHash() const
+h256 const& CompilerStack::Source::swarmHash(size_t _parallelism) const
 {
 	if (swarmHashCached == h256{})
-		swarmHashCached = util::bzzr1Hash(charStream->source());
+		swarmHashCached = util::bzzr1Hash(charStream->source(), _parallelism);
 	return swarmHashCached;
 }
 
-std::string const& CompilerStack::Source::ipfsUrl() const
+std::string const& CompilerStack::Source::ipfsUrl(size_t _parallelism) const
 {
 	if (ipfsUrlCached.empty())
-		ipfsUrlCached = "dweb:/ipfs/" + util::ipfsHashBase58(charStream->source());
+		ipfsUrlCached = "dweb:/ipfs/" + util::ipfsHashBase58(charStream->source(), _parallelism);
 	return ipfsUrlCached;
 }
 
-StringMap CompilerStack::loadMissingSources(SourceUnit const& _ast)
+std::vector<StringMap> CompilerStack::loadMissingSources(
+	std::vector<SourceUnit const*> const& _asts,
+	std::vector<std::string>& _prefetch,
+	StringMap& _prefetchedSources
+)
 {
 	solAssert(m_stackState < ParsedAndImported, "");
-	StringMap newSources;
+	std::vector<StringMap> newSources(_asts.size());
 	try
 	{
-		for (auto const& node: _ast.nodes())
-			if (ImportDirective const* import = dynamic_cast<ImportDirective*>(node.get()))
+		std::vector<std::vector<ImportDirective const*>> imports(_asts.size());
+		std::vector<std::string> pathsToRead;
+		std::map<std::string, size_t> readIndices;
+		for (size_t i = 0; i < _asts.size(); ++i)
+			if (_asts[i])
+				for (auto const& node: _asts[i]->nodes())
+					if (ImportDirective const* import = dynamic_cast<ImportDirective*>(node.get()))
+					{
+						std::string const& importPath = *import->annotation().absolutePath;
+						if (m_sources.count(importPath))
+							continue;
+						imports[i].push_back(import);
+						if (!_prefetchedSources.count(importPath) && readIndices.emplace(importPath, pathsToRead.size()).second)
+							pathsToRead.push_back(importPath);
+					}
+
+		size_t const importsToRead = pathsToRead.size();
+		if (importsToRead > 0)
+		{
+			for (std::string const& path: _prefetch)
+				if (!m_sources.count(path) && readIndices.emplace(path, pathsToRead.size()).second)
+					pathsToRead.push_back(path);
+			_prefetch.clear();
+		}
+
+		std::vector<ReadCallback::Result> results = readSources(pathsToRead);
+		for (size_t i = importsToRead; i < pathsToRead.size(); ++i)
+			if (results[i].success)
+				_prefetchedSources[pathsToRead[i]] = std::move(results[i].responseOrErrorMessage);
+
+		std::set<std::string> loadedPaths;
+		for (size_t i = 0; i < _asts.size(); ++i)
+			for (ImportDirective const* import: imports[i])
 			{
 				std::string const& importPath = *import->annotation().absolutePath;
-
-				if (m_sources.count(importPath) || newSources.count(importPath))
+				if (loadedPaths.count(importPath))
 					continue;
 
-				ReadCallback::Result result{false, std::string("File not supplied initially.")};
-				if (m_readFile)
-					result = m_readFile(ReadCallback::kindString(ReadCallback::Kind::ReadFile), importPath);
+				if (auto prefetched = _prefetchedSources.find(importPath); prefetched != _prefetchedSources.end())
+				{
+					newSources[i][importPath] = std::move(prefetched->second);
+					_prefetchedSources.erase(prefetched);
+					loadedPaths.insert(importPath);
+					continue;
+				}
 
+				ReadCallback::Result& result = results[readIndices.at(importPath)];
 				if (result.success)
-					newSources[importPath] = result.responseOrErrorMessage;
-				else
 				{
+					newSources[i][importPath] = std::move(result.responseOrErrorMessage);
+					loadedPaths.insert(importPath);
+				}
+				else
 					m_errorReporter.parserError(
 						6275_error,
 						import->location(),
 						std::string("Source \"" + importPath + "\" not found: " + result.responseOrErrorMessage)
 					);
-					continue;
-				}
 			}
 	}
 	catch (FatalError const&)
@@ -1261,6 +1492,46 @@ StringMap CompilerStack::loadMissingSources(SourceUnit const& _ast)
 	return newSources;
 }
 
+std::vector<ReadCallback::Result> CompilerStack::readSources(std::vector<std::string> const& _paths)
+{
+	std::vector<ReadCallback::Result> results(
+		_paths.size(),
+		ReadCallback::Result{false, std::string("File not supplied initially.")}
+	);
+	if (!m_readFile || _paths.empty())
+		return results;
+
+	std::vector<size_t> remaining;
+	if (m_batchImportReads)
+	{
+		ReadCallback::Result batch = m_readFile(
+			ReadCallback::kindString(ReadCallback::Kind::ReadFiles),
+			util::jsonCompactPrint(Json(_paths))
+		);
+		Json contents;
+		// Anything not returned by the batch, including everything if it failed, is read on its own.
+		bool const valid = batch.success && util::jsonParseStrict(batch.responseOrErrorMessage, contents) && contents.is_object();
+		for (size_t i = 0; i < _paths.size(); ++i)
+			if (valid && contents.contains(_paths[i]) && contents[_paths[i]].is_string())
+				results[i] = ReadCallback::Result{true, contents[_paths[i]].get<std::string>()};
+			else
+				remaining.push_back(i);
+	}
+	else
+		for (size_t i = 0; i < _paths.size(); ++i)
+			remaining.push_back(i);
+
+	util::runInParallel(
+		m_concurrentImportReads ? m_parallelism : 1,
+		remaining.size(),
+		[&](size_t _index) {
+			size_t const i = remaining[_index];
+			results[i] = m_readFile(ReadCallback::kindString(ReadCallback::Kind::ReadFile), _paths[i]);
+		}
+	);
+	return results;
+}
+
 std::string CompilerStack::applyRemapping(std::string const& _path, std::string const& _context)
 {
 	solAssert(m_stackState < ParsedAndImported, "");
@@ -1384,11 +1655,13 @@ bool onlySafeExperimentalFeaturesActivated(std::set<ExperimentalFeature> const&
 void CompilerStack::assembleYul(
 	ContractDefinition const& _contract,
 	std::shared_ptr<evmasm::Assembly> _assembly,
-	std::shared_ptr<evmasm::Assembly> _runtimeAssembly
+	std::shared_ptr<evmasm::Assembly> _runtimeAssembly,
+	size_t _parallelism
 )
 {
 	solAssert(m_stackState >= AnalysisSuccessful, "");
 
+	util::PhaseTracer::Scope tracerScope("Assembly::assemble", _contract.fullyQualifiedName());
 	Contract& compiledContract = m_contracts.at(_contract.fullyQualifiedName());
 
 	compiledContract.evmAssembly = _assembly;
@@ -1396,7 +1669,7 @@ void CompilerStack::assembleYul(
 	try
 	{
 		// Assemble deployment (incl. runtime)  object.
-		compiledContract.object = compiledContract.evmAssembly->assemble();
+		compiledContract.object = compiledContract.evmAssembly->assemble(_parallelism);
 	}
 	catch (evmasm::AssemblyException const&)
 	{
@@ -1409,12 +1682,17 @@ void CompilerStack::assembleYul(
 	try
 	{
 		// Assemble runtime object.
-		compiledContract.runtimeObject = compiledContract.evmRuntimeAssembly->assemble();
+		compiledContract.runtimeObject = compiledContract.evmRuntimeAssembly->assemble(_parallelism);
 	}
 	catch (evmasm::AssemblyException const&)
 	{
 		solAssert(false, "Assembly exception for deployed bytecode");
 	}
+}
+
+void CompilerStack::checkCodeSizeLimits(ContractDefinition const& _contract)
+{
+	Contract const& compiledContract = m_contracts.at(_contract.fullyQualifiedName());
 
 	// Throw a warning if EIP-170 limits are exceeded:
 	//   If contract creation returns data with length greater than 0x6000 (2^14 + 2^13) bytes,
@@ -1473,18 +1751,22 @@ void CompilerStack::compileContract(
 
 	Contract& compiledContract = m_contracts.at(_contract.fullyQualifiedName());
 
-	std::shared_ptr<Compiler> compiler = std::make_shared<Compiler>(m_evmVersion, m_revertStrings, m_optimiserSettings);
+	std::shared_ptr<Compiler> compiler = std::make_shared<Compiler>(m_evmVersion, m_revertStrings, m_optimiserSettings, m_yulFunctionCache);
 	compiledContract.compiler = compiler;
 
 	solAssert(!m_viaIR, "");
-	bytes cborEncodedMetadata = createCBORMetadata(compiledContract, /* _forIR */ false);
+	bytes const& cborEncodedMetadata = createCBORMetadata(compiledContract, /* _forIR */ false);
 
 	// Run optimiser and compile the contract.
-	compiler->compileContract(_contract, _otherCompilers, cborEncodedMetadata);
+	{
+		util::PhaseTracer::Scope tracerScope("ContractCompiler", _contract.fullyQualifiedName());
+		compiler->compileContract(_contract, _otherCompilers, cborEncodedMetadata);
+	}
 
 	_otherCompilers[compiledContract.contract] = compiler;
 
-	assembleYul(_contract, compiler->assemblyPtr(), compiler->runtimeAssemblyPtr());
+	assembleYul(_contract, compiler->assemblyPtr(), compiler->runtimeAssemblyPtr(), m_parallelism);
+	checkCodeSizeLimits(_contract);
 }
 
 void CompilerStack::generateIR(ContractDefinition const& _contract)
@@ -1510,6 +1792,7 @@ void CompilerStack::generateIR(ContractDefinition const& _contract)
 	if (!_contract.canBeDeployed())
 		return;
 
+	util::PhaseTracer::Scope tracerScope("IRGenerator", _contract.fullyQualifiedName());
 	std::map<ContractDefinition const*, std::string_view const> otherYulSources;
 	for (auto const& pair: m_contracts)
 		otherYulSources.emplace(pair.second.contract, pair.second.yulIR);
@@ -1540,7 +1823,8 @@ void CompilerStack::generateIR(ContractDefinition const& _contract)
 			sourceIndices(),
 			m_debugInfoSelection,
 			this,
-			m_optimiserSettings
+			m_optimiserSettings,
+			m_yulFunctionCache
 		);
 		compiledContract.yulIR = generator.run(
 			_contract,
@@ -1548,29 +1832,174 @@ void CompilerStack::generateIR(ContractDefinition const& _contract)
 			otherYulSources
 		);
 	}
+}
 
-	yul::YulStack stack(
-		m_evmVersion,
-		m_eofVersion,
-		yul::YulStack::Language::StrictAssembly,
-		m_optimiserSettings,
-		m_debugInfoSelection
-	);
-	bool yulAnalysisSuccessful = stack.parseAndAnalyze("", compiledContract.yulIR);
-	solAssert(
-		yulAnalysisSuccessful,
-		compiledContract.yulIR + "\n\n"
-		"Invalid IR generated:\n" +
-		langutil::SourceReferenceFormatter::formatErrorInformation(stack.errors(), stack) + "\n"
-	);
+void CompilerStack::optimizeIR()
+{
+	solAssert(m_stackState >= AnalysisSuccessful, "");
+
+	// The IR of dependencies is generated only to be embedded into the IR of the requested
+	// contracts, which is where it gets optimized, so it is not optimized on its own.
+	std::vector<Contract*> contractsToOptimize;
+	for (Contract& contract: m_contracts | ranges::views::values)
+		if (
+			!contract.yulIR.empty() &&
+			contract.yulIROptimized.empty() &&
+			!contract.yulIROptimizedStack &&
+			isRequestedContract(*contract.contract)
+		)
+			contractsToOptimize.push_back(&contract);
+
+	// The Yul optimiser works only on the IR of the respective contract, which includes copies
+	// of the IR of all its dependencies, so the contracts can be optimized concurrently.
+	// Threads not needed for that are used to optimize the sub-objects of each contract concurrently.
+	size_t const parallelismPerContract = std::max<size_t>(1, m_parallelism / std::max<size_t>(1, contractsToOptimize.size()));
+	Json const cacheKeySettings = m_compilationCache ? irOptimizationCacheSettings() : Json{};
+	// The IR of a contract contains copies of the IR of all contracts it creates,
+	// which are optimized only once.
+	auto objectOptimizer = std::make_shared<yul::ObjectOptimizer>();
+	std::map<std::string, unsigned> const indices = m_irGasEstimation ? sourceIndices() : std::map<std::string, unsigned>{};
+	OptimiserSettings optimiserSettings = m_optimiserSettings;
+	optimiserSettings.yulExecutionProfile = yulExecutionProfile();
+	util::runInParallel(m_parallelism, contractsToOptimize.size(), [&](size_t _index) {
+		Contract& compiledContract = *contractsToOptimize[_index];
+		util::PhaseTracer::Scope tracerScope("CompilerStack::optimizeIR", compiledContract.contract->fullyQualifiedName());
+
+		auto stack = std::make_shared<yul::YulStack>(
+			m_evmVersion,
+			m_eofVersion,
+			yul::YulStack::Language::StrictAssembly,
+			optimiserSettings,
+			m_debugInfoSelection
+		);
+		stack->setParallelism(parallelismPerContract);
+		stack->setObjectOptimizer(objectOptimizer);
+		stack->enableOptimizerProfiling(m_optimizerProfiling);
+		bool yulAnalysisSuccessful = stack->parseAndAnalyze("", compiledContract.yulIR);
+		solAssert(
+			yulAnalysisSuccessful,
+			compiledContract.yulIR + "\n\n"
+			"Invalid IR generated:\n" +
+			langutil::SourceReferenceFormatter::formatErrorInformation(stack->errors(), *stack) + "\n"
+		);
+
+		if (m_generateIR)
+			compiledContract.yulIRAst = stack->astJson();
 
-	compiledContract.yulIRAst = stack.astJson();
-	stack.optimize();
-	compiledContract.yulIROptimized = stack.print(this);
-	compiledContract.yulIROptimizedAst = stack.astJson();
+		std::optional<util::h256> cacheKey;
+		if (m_compilationCache)
+		{
+			Json key = cacheKeySettings;
+			key["ir"] = compiledContract.yulIR;
+			cacheKey = util::keccak256(util::jsonCompactPrint(key));
+			// The gas estimates are computed on the optimized AST, which is not restored from the cache.
+			if (std::optional<std::string> cachedEntry = m_irGasEstimation ? std::nullopt : m_compilationCache->load(*cacheKey))
+			{
+				Json entry;
+				if (
+					util::jsonParseStrict(*cachedEntry, entry) &&
+					entry.is_object() &&
+					entry.contains("irOptimized") && entry["irOptimized"].is_string() &&
+					entry.contains("irOptimizedAst") && entry["irOptimizedAst"].is_object()
+				)
+				{
+					compiledContract.yulIROptimized = entry["irOptimized"].get<std::string>();
+					compiledContract.yulIROptimizedAst = std::move(entry["irOptimizedAst"]);
+					return;
+				}
+			}
+		}
+
+		stack->optimize();
+		// The bytecode is generated from the kept stack, so the printed code and its AST
+		// are only needed as outputs and for the compilation cache.
+		if (m_generateIR || m_compilationCache)
+		{
+			compiledContract.yulIROptimized = stack->print(this);
+			compiledContract.yulIROptimizedAst = stack->astJson();
+		}
+		compiledContract.yulIROptimizerProfile = stack->optimizerProfilesJson();
+		compiledContract.yulIROptimizerTimeBudgetExceeded = stack->optimizerTimeBudgetExceeded();
+		if (m_irGasEstimation)
+			compiledContract.yulIROptimizedGasEstimates = stack->functionGasEstimatesJson(indices);
+		if (m_generateEvmBytecode && m_viaIR)
+			compiledContract.yulIROptimizedStack = stack;
+
+		// Code that was not fully optimized is not cached, so that the next compilation can improve on it.
+		if (m_compilationCache && !compiledContract.yulIROptimizerTimeBudgetExceeded)
+		{
+			Json entry;
+			entry["irOptimized"] = compiledContract.yulIROptimized;
+			entry["irOptimizedAst"] = compiledContract.yulIROptimizedAst;
+			m_compilationCache->store(*cacheKey, util::jsonCompactPrint(entry));
+		}
+	});
+
+	for (Contract const* compiledContract: contractsToOptimize)
+		if (compiledContract->yulIROptimizerTimeBudgetExceeded)
+			m_errorReporter.warning(
+				4521_error,
+				compiledContract->contract->location(),
+				"The Yul optimizer exceeded the time budget of " +
+				std::to_string(m_optimiserSettings.yulOptimiserTimeBudget->count()) +
+				" ms for this contract and skipped the remaining optimization steps. "
+				"The resulting bytecode depends on the speed of the machine and cannot be reproduced reliably."
+			);
 }
 
-void CompilerStack::generateEVMFromIR(ContractDefinition const& _contract)
+Json CompilerStack::irOptimizationCacheSettings() const
+{
+	Json key;
+	key["compiler"] = VersionString;
+	key["evmVersion"] = m_evmVersion.name();
+	if (m_eofVersion.has_value())
+		key["eofVersion"] = m_eofVersion.value();
+	key["debugInfo"] = util::toString(m_debugInfoSelection);
+	key["optimizeStackAllocation"] = m_optimiserSettings.optimizeStackAllocation;
+	// The exhaustive search changes the stack too deep errors the StackCompressor and the StackLimitEvader act on.
+	if (m_optimiserSettings.exhaustiveStackLayoutSearch)
+		key["exhaustiveStackLayoutSearch"] = true;
+	key["runYulOptimiser"] = m_optimiserSettings.runYulOptimiser;
+	key["yulOptimiserSteps"] = m_optimiserSettings.yulOptimiserSteps;
+	key["yulOptimiserCleanupSteps"] = m_optimiserSettings.yulOptimiserCleanupSteps;
+	key["runs"] = m_optimiserSettings.expectedExecutionsPerDeployment;
+	if (std::map<std::string, size_t> const profile = yulExecutionProfile(); !profile.empty())
+		key["yulExecutionProfile"] = profile;
+	// Snippets printed next to the source locations are not part of the IR.
+	if (m_debugInfoSelection.snippet)
+		for (auto const& [sourceName, source]: m_sources)
+			key["sources"][sourceName] = source.keccak256().hex();
+	return key;
+}
+
+std::map<std::string, size_t> CompilerStack::yulExecutionProfile() const
+{
+	// Explicitly given executions take precedence over the annotations.
+	std::map<std::string, size_t> profile = m_optimiserSettings.yulExecutionProfile;
+	size_t const hotExecutions = std::max<size_t>(m_optimiserSettings.expectedExecutionsPerDeployment, 1) * 100;
+	auto addFunction = [&](FunctionDefinition const& _function) {
+		auto const& docTags = _function.annotation().docTags;
+		for (auto [it, end] = docTags.equal_range("custom:gas"); it != end; ++it)
+		{
+			std::string const content = boost::trim_copy(it->second.content);
+			if (content == "hot")
+				profile.emplace(IRNames::function(_function), hotExecutions);
+			else if (content == "cold")
+				profile.emplace(IRNames::function(_function), 1);
+		}
+	};
+	for (Source const* source: m_sourceOrder)
+	{
+		for (auto const* function: ASTNode::filteredNodes<FunctionDefinition>(source->ast->nodes()))
+			addFunction(*function);
+		for (auto const* contract: ASTNode::filteredNodes<ContractDefinition>(source->ast->nodes()))
+			for (FunctionDefinition const* function: contract->definedFunctions())
+				addFunction(*function);
+	}
+	return profile;
+}
+
+void CompilerStack::generateEVMFromIR(ContractDefinition const& _contract, size_t _parallelism)
 {
 	solAssert(m_stackState >= AnalysisSuccessful, "");
 
@@ -1578,27 +2007,32 @@ void CompilerStack::generateEVMFromIR(ContractDefinition const& _contract)
 		return;
 
 	Contract& compiledContract = m_contracts.at(_contract.fullyQualifiedName());
-	solAssert(!compiledContract.yulIROptimized.empty(), "");
 	if (!compiledContract.object.bytecode.empty())
 		return;
+	solAssert(compiledContract.yulIROptimizedStack || !compiledContract.yulIROptimized.empty());
 
-	// Re-parse the Yul IR in EVM dialect
-	yul::YulStack stack(
-		m_evmVersion,
-		m_eofVersion,
-		yul::YulStack::Language::StrictAssembly,
-		m_optimiserSettings,
-		m_debugInfoSelection
-	);
-	bool analysisSuccessful = stack.parseAndAnalyze("", compiledContract.yulIROptimized);
-	solAssert(analysisSuccessful);
-
-	//cout << yul::AsmPrinter{}(*stack.parserResult()->code) << endl;
+	util::PhaseTracer::Scope tracerScope("CompilerStack::generateEVMFromIR", _contract.fullyQualifiedName());
+	// Use the optimized code kept by optimizeIR() and only re-parse the Yul IR
+	// if it is not available, i.e. if it was taken from the compilation cache.
+	std::shared_ptr<yul::YulStack> stack = std::move(compiledContract.yulIROptimizedStack);
+	if (!stack)
+	{
+		stack = std::make_shared<yul::YulStack>(
+			m_evmVersion,
+			m_eofVersion,
+			yul::YulStack::Language::StrictAssembly,
+			m_optimiserSettings,
+			m_debugInfoSelection
+		);
+		bool analysisSuccessful = stack->parseAndAnalyze("", compiledContract.yulIROptimized);
+		solAssert(analysisSuccessful);
+	}
+	stack->setParallelism(_parallelism);
 
 	std::string deployedName = IRNames::deployedObject(_contract);
 	solAssert(!deployedName.empty(), "");
-	tie(compiledContract.evmAssembly, compiledContract.evmRuntimeAssembly) = stack.assembleEVMWithDeployed(deployedName);
-	assembleYul(_contract, compiledContract.evmAssembly, compiledContract.evmRuntimeAssembly);
+	tie(compiledContract.evmAssembly, compiledContract.evmRuntimeAssembly) = stack->assembleEVMWithDeployed(deployedName);
+	assembleYul(_contract, compiledContract.evmAssembly, compiledContract.evmRuntimeAssembly, _parallelism);
 }
 
 CompilerStack::Contract const& CompilerStack::contract(std::string const& _contractName) const
@@ -1670,18 +2104,7 @@ std::string CompilerStack::createMetadata(Contract const& _contract, bool _forIR
 		if (!referencedSources.count(s.first))
 			continue;
 
-		solAssert(s.second.charStream, "Character stream not available");
-		meta["sources"][s.first]["keccak256"] = "0x" + util::toHex(s.second.keccak256().asBytes());
-		if (std::optional<std::string> licenseString = s.second.ast->licenseString())
-			meta["sources"][s.first]["license"] = *licenseString;
-		if (m_metadataLiteralSources)
-			meta["sources"][s.first]["content"] = s.second.charStream->source();
-		else
-		{
-			meta["sources"][s.first]["urls"] = Json::array();
-			meta["sources"][s.first]["urls"].emplace_back("bzz-raw://" + util::toHex(s.second.swarmHash().asBytes()));
-			meta["sources"][s.first]["urls"].emplace_back(s.second.ipfsUrl());
-		}
+		meta["sources"][s.first] = sourceMetadata(s.second);
 	}
 
 	static_assert(sizeof(m_optimiserSettings.expectedExecutionsPerDeployment) <= sizeof(Json::number_integer_t), "Invalid word size.");
@@ -1709,11 +2132,17 @@ std::string CompilerStack::createMetadata(Contract const& _contract, bool _forIR
 		details["constantOptimizer"] = m_optimiserSettings.runConstantOptimiser;
 		details["simpleCounterForLoopUncheckedIncrement"] = m_optimiserSettings.simpleCounterForLoopUncheckedIncrement;
 		details["yul"] = m_optimiserSettings.runYulOptimiser;
+		if (!m_optimiserSettings.dispatchProfile.empty())
+			details["dispatchProfile"] = m_optimiserSettings.dispatchProfile;
 		if (m_optimiserSettings.runYulOptimiser)
 		{
 			details["yulDetails"] = Json::object();
 			details["yulDetails"]["stackAllocation"] = m_optimiserSettings.optimizeStackAllocation;
 			details["yulDetails"]["optimizerSteps"] = m_optimiserSettings.yulOptimiserSteps + ":" + m_optimiserSettings.yulOptimiserCleanupSteps;
+			if (!m_optimiserSettings.yulExecutionProfile.empty())
+				details["yulDetails"]["executionProfile"] = m_optimiserSettings.yulExecutionProfile;
+			if (m_optimiserSettings.exhaustiveStackLayoutSearch)
+				details["yulDetails"]["exhaustiveStackLayoutSearch"] = true;
 		}
 		else if (OptimiserSuite::isEmptyOptimizerSequence(m_optimiserSettings.yulOptimiserSteps + ":" + m_optimiserSettings.yulOptimiserCleanupSteps))
 		{
@@ -1852,7 +2281,37 @@ private:
 	bytes m_data;
 };
 
-bytes CompilerStack::createCBORMetadata(Contract const& _contract, bool _forIR) const
+Json const& CompilerStack::sourceMetadata(Source const& _source) const
+{
+	if (!_source.metadataCached.is_null())
+		return _source.metadataCached;
+
+	solAssert(_source.charStream, "Character stream not available");
+	Json entry;
+	entry["keccak256"] = "0x" + util::toHex(_source.keccak256().asBytes());
+	if (std::optional<std::string> licenseString = _source.ast->licenseString())
+		entry["license"] = *licenseString;
+	if (m_metadataLiteralSources)
+		entry["content"] = _source.charStream->source();
+	else
+	{
+		entry["urls"] = Json::array();
+		entry["urls"].emplace_back("bzz-raw://" + util::toHex(_source.swarmHash(m_parallelism).asBytes()));
+		entry["urls"].emplace_back(_source.ipfsUrl(m_parallelism));
+	}
+	_source.metadataCached = std::move(entry);
+	return _source.metadataCached;
+}
+
+bytes const& CompilerStack::createCBORMetadata(Contract const& _contract, bool _forIR) const
+{
+	// The metadata of both pipelines is needed e.g. if IR is requested without compiling via IR.
+	return (_forIR ? _contract.cborMetadataForIR : _contract.cborMetadata).init([&]{
+		return encodeCBORMetadata(_contract, _forIR);
+	});
+}
+
+bytes CompilerStack::encodeCBORMetadata(Contract const& _contract, bool _forIR) const
 {
 	if (m_metadataFormat == MetadataFormat::NoMetadata)
 		return bytes{};
@@ -1866,9 +2325,9 @@ bytes CompilerStack::createCBORMetadata(Contract const& _contract, bool _forIR)
 	MetadataCBOREncoder encoder;
 
 	if (m_metadataHash == MetadataHash::IPFS)
-		encoder.pushBytes("ipfs", util::ipfsHash(meta));
+		encoder.pushBytes("ipfs", util::ipfsHash(meta, m_parallelism));
 	else if (m_metadataHash == MetadataHash::Bzzr1)
-		encoder.pushBytes("bzzr1", util::bzzr1Hash(meta).asBytes());
+		encoder.pushBytes("bzzr1", util::bzzr1Hash(meta, m_parallelism).asBytes());
 	else
 		solAssert(m_metadataHash == MetadataHash::None, "Invalid metadata hash");
 
@@ -1930,37 +2389,39 @@ Json CompilerStack::gasEstimates(std::string const& _contractName) const
 
 	if (evmasm::AssemblyItems const* items = runtimeAssemblyItems(_contractName))
 	{
-		/// External functions
 		ContractDefinition const& contract = contractDefinition(_contractName);
-		Json externalFunctions = Json::object();
+		struct Estimation
+		{
+			/// Key of the estimation in the output.
+			std::string key;
+			/// Signature of the external function to estimate.
+			std::string signature;
+			/// Internal function to estimate, null for external functions.
+			FunctionDefinition const* function = nullptr;
+			Gas gas;
+		};
+		std::vector<Estimation> estimations;
+
+		/// External functions
 		for (auto it: contract.interfaceFunctions())
 		{
 			std::string sig = it.second->externalSignature();
-			externalFunctions[sig] = gasToJson(gasEstimator.functionalEstimation(*items, sig));
+			estimations.push_back({sig, sig, nullptr, {}});
 		}
 
 		if (contract.fallbackFunction())
 			/// This needs to be set to an invalid signature in order to trigger the fallback,
 			/// without the shortcut (of CALLDATSIZE == 0), and therefore to receive the upper bound.
 			/// An empty string ("") would work to trigger the shortcut only.
-			externalFunctions[""] = gasToJson(gasEstimator.functionalEstimation(*items, "INVALID"));
-
-		if (!externalFunctions.empty())
-			output["external"] = externalFunctions;
+			estimations.push_back({"", "INVALID", nullptr, {}});
 
 		/// Internal functions
-		Json internalFunctions = Json::object();
 		for (auto const& it: contract.definedFunctions())
 		{
 			/// Exclude externally visible functions, constructor, fallback and receive ether function
 			if (it->isPartOfExternalInterface() || !it->isOrdinary())
 				continue;
 
-			size_t entry = functionEntryPoint(_contractName, *it);
-			GasEstimator::GasConsumption gas = GasEstimator::GasConsumption::infinite();
-			if (entry > 0)
-				gas = gasEstimator.functionalEstimation(*items, entry, *it);
-
 			/// TODO: This could move into a method shared with externalSignature()
 			FunctionType type(*it);
 			std::string sig = it->name() + "(";
@@ -1969,9 +2430,28 @@ Json CompilerStack::gasEstimates(std::string const& _contractName) const
 				sig += (*it)->toString() + (it + 1 == paramTypes.end() ? "" : ",");
 			sig += ")";
 
-			internalFunctions[sig] = gasToJson(gas);
+			estimations.push_back({sig, {}, it, {}});
 		}
 
+		// The estimations only read the items, so they can be run concurrently.
+		util::runInParallel(m_parallelism, estimations.size(), [&](size_t _index) {
+			Estimation& estimation = estimations[_index];
+			if (!estimation.function)
+				estimation.gas = gasEstimator.functionalEstimation(*items, estimation.signature);
+			else if (size_t entry = functionEntryPoint(_contractName, *estimation.function); entry > 0)
+				estimation.gas = gasEstimator.functionalEstimation(*items, entry, *estimation.function);
+			else
+				estimation.gas = Gas::infinite();
+		});
+
+		Json externalFunctions = Json::object();
+		Json internalFunctions = Json::object();
+		for (Estimation const& estimation: estimations)
+			(estimation.function ? internalFunctions : externalFunctions)[estimation.key] = gasToJson(estimation.gas);
+
+		if (!externalFunctions.empty())
+			output["external"] = externalFunctions;
+
 		if (!internalFunctions.empty())
 			output["internal"] = internalFunctions;
 	}
@@ -25,6 +25,7 @@
 #pragma once
 
 #include <libsolidity/analysis/FunctionCallGraph.h>
+#include <libsolidity/interface/CompilationCache.h>
 #include <libsolidity/interface/ReadFile.h>
 #include <libsolidity/interface/ImportRemapper.h>
 #include <libsolidity/interface/OptimiserSettings.h>
@@ -48,6 +49,7 @@
 #include <libsolutil/FixedHash.h>
 #include <libsolutil/LazyInit.h>
 #include <libsolutil/JSON.h>
+#include <libsolutil/PhaseTracer.h>
 
 #include <functional>
 #include <memory>
@@ -69,6 +71,11 @@ class AssemblyItem;
 using AssemblyItems = std::vector<AssemblyItem>;
 }
 
+namespace solidity::yul
+{
+class YulStack;
+}
+
 namespace solidity::frontend
 {
 
@@ -78,6 +85,7 @@ class ContractDefinition;
 class FunctionDefinition;
 class SourceUnit;
 class Compiler;
+class MultiUseYulFunctionCache;
 class GlobalContext;
 class Natspec;
 class DeclarationContainer;
@@ -168,6 +176,35 @@ public:
 	/// Must be set before parsing.
 	void setViaIR(bool _viaIR);
 
+	/// Sets the maximum number of threads used to compile independent contracts concurrently.
+	/// Only affects the optimization of the Yul IR and the code generation from it.
+	/// The output does not depend on this setting.
+	void setParallelism(size_t _jobs);
+
+	/// Enables invoking the read callback concurrently for the imports of a source unit
+	/// that are not loaded yet, using up to the number of threads set by @a setParallelism.
+	/// Only use this if the read callback is thread-safe. Sources are still parsed one by one
+	/// in the usual order and the output does not depend on this setting.
+	/// Must be set before parsing.
+	void setConcurrentImportReads(bool _concurrentImportReads);
+
+	/// Enables requesting all missing imports of one level of the import graph with a single
+	/// invocation of the read callback of kind ReadCallback::Kind::ReadFiles. Paths the callback
+	/// does not return are read one by one afterwards. The output does not depend on this setting.
+	/// Must be set before parsing.
+	void setBatchImportReads(bool _batchImportReads);
+
+	/// Sets paths that are requested together with the first imports read by the callback,
+	/// in anticipation of being imported further down the import graph. Paths that end up not
+	/// being imported are ignored, as are failures to read them. The output does not depend on
+	/// this setting. Must be set before parsing.
+	void setImportPrefetchHints(std::vector<std::string> _paths);
+
+	/// Sets the directory of a persistent cache for the optimized IR of contracts, which is
+	/// shared by all compiler runs using the same directory. An empty path disables the cache.
+	/// The output does not depend on this setting.
+	void setCacheDirectory(boost::filesystem::path const& _directory);
+
 	/// Set the EVM version used before running compile.
 	/// When called without an argument it will revert to the default version.
 	/// Must be set before parsing.
@@ -192,9 +229,21 @@ public:
 	/// Enable EVM Bytecode generation. This is enabled by default.
 	void enableEvmBytecodeGeneration(bool _enable = true) { m_generateEvmBytecode = _enable; }
 
-	/// Enable generation of Yul IR code.
+	/// Enable generation of Yul IR code as an output. Compilation via IR generates the code
+	/// regardless, but does not print it or export its AST unless this is enabled.
 	void enableIRGeneration(bool _enable = true) { m_generateIR = _enable; }
 
+	/// Enable collecting the resource usage of the Yul optimizer steps run on the IR.
+	void enableOptimizerProfiling(bool _enable = true) { m_optimizerProfiling = _enable; }
+
+	/// Enable estimating the gas costs of the functions of the optimized IR.
+	/// The optimized IR of the contracts is not taken from the compilation cache if this is enabled.
+	void enableIRGasEstimation(bool _enable = true) { m_irGasEstimation = _enable; }
+
+	/// Sets the tracer that records the time spent in the phases of parsing, analysis and
+	/// code generation. A null tracer disables tracing. The tracer is not cleared by @a reset.
+	void setTracer(std::shared_ptr<util::PhaseTracer> _tracer) { m_tracer = std::move(_tracer); }
+
 	/// @arg _metadataLiteralSources When true, store sources as literals in the contract metadata.
 	/// Must be set before parsing.
 	void useMetadataLiteralSources(bool _metadataLiteralSources);
@@ -259,6 +308,9 @@ public:
 	/// does not exist.
 	ContractDefinition const& contractDefinition(std::string const& _contractName) const;
 
+	/// @returns true if the contract is requested to be compiled.
+	bool isRequestedContract(ContractDefinition const& _contract) const;
+
 	/// @returns a list of unhandled queries to the SMT solver (has to be supplied in a second run
 	/// by calling @a addSMTLib2Response).
 	std::vector<std::string> const& unhandledSMTLib2Queries() const { return m_unhandledSMTLib2Queries; }
@@ -284,6 +336,14 @@ public:
 	/// @returns the optimized IR representation of a contract AST in JSON format.
 	Json const& yulIROptimizedAst(std::string const& _contractName) const;
 
+	/// @returns the resource usage of the Yul optimizer steps run on the IR of a contract by Yul object.
+	/// Empty unless optimizer profiling was enabled.
+	Json const& yulIROptimizerProfile(std::string const& _contractName) const;
+
+	/// @returns the estimated gas costs of running each function of the optimized IR of a contract once,
+	/// by Yul object and function name. Empty unless IR gas estimation was enabled.
+	Json const& yulIROptimizedGasEstimates(std::string const& _contractName) const;
+
 	/// @returns the assembled object for a contract.
 	virtual evmasm::LinkerObject const& object(std::string const& _contractName) const override;
 
@@ -335,7 +395,7 @@ public:
 	Json const& natspecDev(std::string const& _contractName) const;
 
 	/// @returns a JSON object with the three members ``methods``, ``events``, ``errors``. Each is a map, mapping identifiers (hashes) to function names.
-	Json interfaceSymbols(std::string const& _contractName) const;
+	Json const& interfaceSymbols(std::string const& _contractName) const;
 
 	/// @returns the Contract Metadata matching the pipeline selected using the viaIR setting.
 	std::string const& metadata(std::string const& _contractName) const { return metadata(contract(_contractName)); }
@@ -372,10 +432,13 @@ private:
 		util::h256 mutable keccak256HashCached;
 		util::h256 mutable swarmHashCached;
 		std::string mutable ipfsUrlCached;
+		/// Entry of the source in the metadata, which is the same for all contracts referencing it.
+		Json mutable metadataCached;
 		void reset() { *this = Source(); }
 		util::h256 const& keccak256() const;
-		util::h256 const& swarmHash() const;
-		std::string const& ipfsUrl() const;
+		/// The hashes of large sources are computed on up to @a _parallelism threads.
+		util::h256 const& swarmHash(size_t _parallelism = 1) const;
+		std::string const& ipfsUrl(size_t _parallelism = 1) const;
 	};
 
 	/// The state per contract. Filled gradually during compilation.
@@ -389,13 +452,24 @@ private:
 		evmasm::LinkerObject runtimeObject; ///< Runtime object.
 		std::string yulIR; ///< Yul IR code.
 		std::string yulIROptimized; ///< Optimized Yul IR code.
+		/// Stack holding the optimized Yul IR code until bytecode is generated from it,
+		/// which avoids parsing the printed code again. Not set if the code came from the cache.
+		std::shared_ptr<yul::YulStack> yulIROptimizedStack;
 		Json yulIRAst; ///< JSON AST of Yul IR code.
 		Json yulIROptimizedAst; ///< JSON AST of optimized Yul IR code.
+		Json yulIROptimizerProfile = Json::object(); ///< Resource usage of the Yul optimizer steps.
+		Json yulIROptimizedGasEstimates = Json::object(); ///< Gas estimates of the optimized Yul functions.
+		/// True if the Yul optimizer skipped steps because it exceeded its time budget.
+		bool yulIROptimizerTimeBudgetExceeded = false;
 		util::LazyInit<std::string const> metadata; ///< The metadata json that will be hashed into the chain.
+		/// CBOR encoded hash of the metadata appended to the bytecode of the legacy and of the IR codegen.
+		util::LazyInit<bytes const> cborMetadata;
+		util::LazyInit<bytes const> cborMetadataForIR;
 		util::LazyInit<Json const> abi;
 		util::LazyInit<Json const> storageLayout;
 		util::LazyInit<Json const> userDocumentation;
 		util::LazyInit<Json const> devDocumentation;
+		util::LazyInit<Json const> interfaceSymbols;
 		util::LazyInit<Json const> generatedSources;
 		util::LazyInit<Json const> runtimeGeneratedSources;
 		mutable std::optional<std::string const> sourceMapping;
@@ -405,10 +479,19 @@ private:
 	void createAndAssignCallGraphs();
 	void findAndReportCyclicContractDependencies();
 
-	/// Loads the missing sources from @a _ast (named @a _path) using the callback
-	/// @a m_readFile
-	/// @returns the newly loaded sources.
-	StringMap loadMissingSources(SourceUnit const& _ast);
+	/// Loads the missing sources imported by @a _asts using the callback @a m_readFile.
+	/// Entries of @a _asts may be null for sources that failed to parse.
+	/// Paths in @a _prefetch are read along with the first imports that need reading, after which
+	/// it is cleared. They are stored in @a _prefetchedSources, which is consulted before invoking
+	/// the callback.
+	/// @returns the newly loaded sources, for each element of @a _asts.
+	std::vector<StringMap> loadMissingSources(
+		std::vector<SourceUnit const*> const& _asts,
+		std::vector<std::string>& _prefetch,
+		StringMap& _prefetchedSources
+	);
+	/// Reads @a _paths through @a m_readFile, batched or concurrently if enabled.
+	std::vector<ReadCallback::Result> readSources(std::vector<std::string> const& _paths);
 	std::string applyRemapping(std::string const& _path, std::string const& _context);
 	bool resolveImports();
 
@@ -421,8 +504,12 @@ private:
 	/// @returns true if the source is requested to be compiled.
 	bool isRequestedSource(std::string const& _sourceName) const;
 
-	/// @returns true if the contract is requested to be compiled.
-	bool isRequestedContract(ContractDefinition const& _contract) const;
+	/// Runs @a _check on the AST of every source. With a parallelism above one, the sources are
+	/// checked concurrently, each reporting to an error list of its own, and the lists are merged
+	/// in source order afterwards, so that the result does not depend on the number of threads.
+	/// Only suitable for checks that do not touch the AST or the types of other sources.
+	/// @returns false if the check failed for any of the sources.
+	bool checkSourcesIndependently(std::function<bool(SourceUnit const&, langutil::ErrorReporter&)> const& _check);
 
 	/// Perform the analysis steps of legacy language mode.
 	/// @returns false on error.
@@ -434,12 +521,19 @@ private:
 
 	/// Assembles the contract.
 	/// This function should only be internally called by compileContract and generateEVMFromIR.
+	/// Does not access any state shared between contracts.
+	/// Uses at most @a _parallelism threads to assemble independent sub-assemblies.
 	void assembleYul(
 		ContractDefinition const& _contract,
 		std::shared_ptr<evmasm::Assembly> _assembly,
-		std::shared_ptr<evmasm::Assembly> _runtimeAssembly
+		std::shared_ptr<evmasm::Assembly> _runtimeAssembly,
+		size_t _parallelism = 1
 	);
 
+	/// Reports warnings about the size of the assembled code of the contract exceeding the limits
+	/// of the chosen EVM version.
+	void checkCodeSizeLimits(ContractDefinition const& _contract);
+
 	/// Compile a single contract.
 	/// @param _otherCompilers provides access to compilers of other contracts, to get
 	///                        their bytecode if needed. Only filled after they have been compiled.
@@ -448,13 +542,30 @@ private:
 		std::map<ContractDefinition const*, std::shared_ptr<Compiler const>>& _otherCompilers
 	);
 
-	/// Generate Yul IR for a single contract.
-	/// The IR is stored but otherwise unused.
+	/// Generate Yul IR for a single contract and all contracts it depends on.
+	/// The IR is stored but otherwise unused. It is not optimized, see optimizeIR.
 	void generateIR(ContractDefinition const& _contract);
 
+	/// Parses, analyzes and optimizes the IR of all contracts for which IR was generated
+	/// but not yet optimized. Uses up to m_parallelism threads.
+	/// Reuses and fills the compilation cache if one is set.
+	void optimizeIR();
+
+	/// @returns everything apart from the IR itself that influences the optimized IR and
+	/// hence has to be part of the key of its entry in the compilation cache.
+	Json irOptimizationCacheSettings() const;
+
+	/// @returns the expected executions of Yul functions used to optimize the IR: the execution profile
+	/// of the optimiser settings, complemented by the functions annotated with ``@custom:gas hot``
+	/// (many more executions than the number of runs) or ``@custom:gas cold`` (a single execution).
+	std::map<std::string, size_t> yulExecutionProfile() const;
+
 	/// Generate EVM representation for a single contract.
-	/// Depends on output generated by generateIR.
-	void generateEVMFromIR(ContractDefinition const& _contract);
+	/// Depends on output generated by generateIR and optimizeIR.
+	/// Does not access any state shared between contracts and can thus be called for
+	/// multiple contracts concurrently.
+	/// Uses up to @a _parallelism threads to optimise the sub-assemblies of the contract.
+	void generateEVMFromIR(ContractDefinition const& _contract, size_t _parallelism);
 
 	/// Links all the known library addresses in the available objects. Any unknown
 	/// library will still be kept as an unlinked placeholder in the objects.
@@ -472,9 +583,15 @@ private:
 	/// @returns the metadata JSON as a compact string for the given contract.
 	std::string createMetadata(Contract const& _contract, bool _forIR) const;
 
+	/// @returns the entry of the source in the metadata of the contracts referencing it.
+	/// This will generate the JSON object and store it in the Source object if it is not present yet.
+	Json const& sourceMetadata(Source const& _source) const;
+
 	/// @returns the metadata CBOR for the given serialised metadata JSON.
 	/// @param _forIR If true, use the metadata for the IR codegen. Otherwise the one for EVM codegen.
-	bytes createCBORMetadata(Contract const& _contract, bool _forIR) const;
+	/// This will be generated and stored in the Contract object if it is not present yet.
+	bytes const& createCBORMetadata(Contract const& _contract, bool _forIR) const;
+	bytes encodeCBORMetadata(Contract const& _contract, bool _forIR) const;
 
 	/// @returns the contract ABI as a JSON object.
 	/// This will generate the JSON object and store it in the Contract object if it is not present yet.
@@ -508,12 +625,20 @@ private:
 	RevertStrings m_revertStrings = RevertStrings::Default;
 	State m_stopAfter = State::CompilationSuccessful;
 	bool m_viaIR = false;
+	size_t m_parallelism = 1;
+	bool m_concurrentImportReads = false;
+	bool m_batchImportReads = false;
+	std::vector<std::string> m_importPrefetchHints;
+	std::unique_ptr<CompilationCache const> m_compilationCache;
 	langutil::EVMVersion m_evmVersion;
 	std::optional<uint8_t> m_eofVersion;
 	ModelCheckerSettings m_modelCheckerSettings;
 	std::map<std::string, std::set<std::string>> m_requestedContractNames;
 	bool m_generateEvmBytecode = true;
 	bool m_generateIR = false;
+	bool m_optimizerProfiling = false;
+	bool m_irGasEstimation = false;
+	std::shared_ptr<util::PhaseTracer> m_tracer;
 	std::map<std::string, util::h160> m_libraries;
 	ImportRemapper m_importRemapper;
 	std::map<std::string const, Source> m_sources;
@@ -523,6 +648,8 @@ private:
 	std::shared_ptr<GlobalContext> m_globalContext;
 	std::vector<Source const*> m_sourceOrder;
 	std::map<std::string const, Contract> m_contracts;
+	/// Yul utility functions generated during compile(), shared by the code generators of all contracts.
+	std::shared_ptr<MultiUseYulFunctionCache> m_yulFunctionCache;
 
 	langutil::ErrorList m_errorList;
 	langutil::ErrorReporter m_errorReporter;
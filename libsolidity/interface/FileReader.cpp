@@ -163,7 +163,7 @@ ReadCallback::Result FileReader::readFile(std::string const& _kind, std::string
 		auto contents = readFileAsString(candidates[0]);
 		solAssert(m_sourceCodes.count(_sourceUnitName) == 0, "");
 		m_sourceCodes[_sourceUnitName] = contents;
-		return ReadCallback::Result{true, contents};
+		return ReadCallback::Result{true, std::move(contents)};
 	}
 	catch (util::Exception const& _exception)
 	{
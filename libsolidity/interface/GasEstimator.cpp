@@ -78,7 +78,7 @@ GasEstimator::GasConsumption GasEstimator::functionalEstimation(
 		);
 	}
 
-	return PathGasMeter::estimateMax(_items, m_evmVersion, 0, state);
+	return PathGasMeter::estimateMax(_items, m_evmVersion, 0, state, tagPositions(_items));
 }
 
 GasEstimator::GasConsumption GasEstimator::functionalEstimation(
@@ -100,7 +100,16 @@ GasEstimator::GasConsumption GasEstimator::functionalEstimation(
 	if (parametersSize > 0)
 		state->feedItem(swapInstruction(parametersSize));
 
-	return PathGasMeter::estimateMax(_items, m_evmVersion, _offset, state);
+	return PathGasMeter::estimateMax(_items, m_evmVersion, _offset, state, tagPositions(_items));
+}
+
+std::shared_ptr<PathGasMeter::TagPositions const> GasEstimator::tagPositions(AssemblyItems const& _items) const
+{
+	std::lock_guard<std::mutex> lock(m_tagPositionsMutex);
+	auto& positions = m_tagPositions[&_items];
+	if (!positions)
+		positions = PathGasMeter::tagPositions(_items);
+	return positions;
 }
 
 std::set<ASTNode const*> GasEstimator::finestNodesAtLocation(
@@ -27,9 +27,12 @@
 
 #include <libevmasm/Assembly.h>
 #include <libevmasm/GasMeter.h>
+#include <libevmasm/PathGasMeter.h>
 
 #include <array>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <vector>
 
 namespace solidity::frontend
@@ -38,6 +41,8 @@ namespace solidity::frontend
 class ASTNode;
 class FunctionDefinition;
 
+/// Estimates the gas consumption of whole contracts and functions.
+/// The estimation methods can be called concurrently on the same object.
 struct GasEstimator
 {
 public:
@@ -67,7 +72,14 @@ public:
 private:
 	/// @returns the set of AST nodes which are the finest nodes at their location.
 	static std::set<ASTNode const*> finestNodesAtLocation(std::vector<ASTNode const*> const& _roots);
+	/// @returns the positions of the tags in @a _items, which are only computed once
+	/// for all estimations on the same list of items.
+	std::shared_ptr<evmasm::PathGasMeter::TagPositions const> tagPositions(evmasm::AssemblyItems const& _items) const;
+
 	langutil::EVMVersion m_evmVersion;
+	/// Tag positions by item list. The item lists must not change during the lifetime of the estimator.
+	mutable std::map<evmasm::AssemblyItems const*, std::shared_ptr<evmasm::PathGasMeter::TagPositions const>> m_tagPositions;
+	mutable std::mutex m_tagPositionsMutex;
 };
 
 }
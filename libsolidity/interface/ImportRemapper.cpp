@@ -19,6 +19,9 @@
 #include <libsolutil/CommonIO.h>
 #include <liblangutil/Exceptions.h>
 
+#include <algorithm>
+#include <functional>
+
 namespace solidity::frontend
 {
 
@@ -27,47 +30,51 @@ void ImportRemapper::setRemappings(std::vector<Remapping> _remappings)
 	for (auto const& remapping: _remappings)
 		solAssert(!remapping.prefix.empty(), "");
 	m_remappings = std::move(_remappings);
-}
 
-SourceUnitName ImportRemapper::apply(ImportPath const& _path, std::string const& _context) const
-{
-	// Try to find the longest prefix match in all remappings that are active in the current context.
-	auto isPrefixOf = [](std::string const& _a, std::string const& _b)
-	{
-		if (_a.length() > _b.length())
-			return false;
-		return equal(_a.begin(), _a.end(), _b.begin());
+	auto addLength = [](std::vector<size_t>& _lengths, size_t _length) {
+		auto it = std::lower_bound(_lengths.begin(), _lengths.end(), _length, std::greater<size_t>{});
+		if (it == _lengths.end() || *it != _length)
+			_lengths.insert(it, _length);
 	};
 
-	size_t longestPrefix = 0;
-	size_t longestContext = 0;
-	std::string bestMatchTarget;
-
+	m_remappingsByContext.clear();
+	m_contextLengths.clear();
 	for (auto const& redir: m_remappings)
 	{
 		std::string context = util::sanitizePath(redir.context);
 		std::string prefix = util::sanitizePath(redir.prefix);
+		addLength(m_contextLengths, context.length());
+		ContextRemappings& contextRemappings = m_remappingsByContext[std::move(context)];
+		addLength(contextRemappings.prefixLengths, prefix.length());
+		// Among remappings with the same context and prefix, the last one takes precedence.
+		contextRemappings.targets[std::move(prefix)] = util::sanitizePath(redir.target);
+	}
+}
 
-		// Skip if current context is closer
-		if (context.length() < longestContext)
-			continue;
-		// Skip if redir.context is not a prefix of _context
-		if (!isPrefixOf(context, _context))
-			continue;
-		// Skip if we already have a closer prefix match.
-		if (prefix.length() < longestPrefix && context.length() == longestContext)
+SourceUnitName ImportRemapper::apply(ImportPath const& _path, std::string const& _context) const
+{
+	// Find the longest prefix match among the remappings with the longest context
+	// that is a prefix of the current context and has any matching prefix.
+	for (size_t contextLength: m_contextLengths)
+	{
+		if (contextLength > _context.length())
 			continue;
-		// Skip if the prefix does not match.
-		if (!isPrefixOf(prefix, _path))
+		auto contextRemappings = m_remappingsByContext.find(_context.substr(0, contextLength));
+		if (contextRemappings == m_remappingsByContext.end())
 			continue;
-
-		longestContext = context.length();
-		longestPrefix = prefix.length();
-		bestMatchTarget = util::sanitizePath(redir.target);
+		for (size_t prefixLength: contextRemappings->second.prefixLengths)
+		{
+			if (prefixLength > _path.length())
+				continue;
+			auto target = contextRemappings->second.targets.find(_path.substr(0, prefixLength));
+			if (target == contextRemappings->second.targets.end())
+				continue;
+			std::string path = target->second;
+			path.append(_path.begin() + static_cast<std::string::difference_type>(prefixLength), _path.end());
+			return path;
+		}
 	}
-	std::string path = bestMatchTarget;
-	path.append(_path.begin() + static_cast<std::string::difference_type>(longestPrefix), _path.end());
-	return path;
+	return _path;
 }
 
 bool ImportRemapper::isRemapping(std::string_view _input)
@@ -19,6 +19,7 @@
 
 #include <optional>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace solidity::frontend
@@ -49,7 +50,7 @@ public:
 		std::string target;
 	};
 
-	void clear() { m_remappings.clear(); }
+	void clear() { setRemappings({}); }
 
 	void setRemappings(std::vector<Remapping> _remappings);
 	std::vector<Remapping> const& remappings() const noexcept { return m_remappings; }
@@ -66,6 +67,19 @@ private:
 	/// list of path prefix remappings, e.g. mylibrary: github.com/ethereum = /usr/local/ethereum
 	/// "context:prefix=target"
 	std::vector<Remapping> m_remappings = {};
+
+	/// The targets of the remappings with the same sanitized context, by sanitized prefix.
+	struct ContextRemappings
+	{
+		/// Lengths of the prefixes in @a targets, longest first.
+		std::vector<size_t> prefixLengths;
+		std::unordered_map<std::string, std::string> targets;
+	};
+	/// Index of m_remappings by sanitized context, which lets @a apply look up the candidate
+	/// contexts and prefixes of a path instead of comparing it to every remapping.
+	std::unordered_map<std::string, ContextRemappings> m_remappingsByContext;
+	/// Lengths of the contexts in m_remappingsByContext, longest first.
+	std::vector<size_t> m_contextLengths;
 };
 
 }
@@ -30,6 +30,9 @@
 
 #include <boost/algorithm/string.hpp>
 
+#include <map>
+#include <set>
+
 using namespace solidity;
 using namespace solidity::frontend;
 
@@ -255,31 +258,34 @@ Json Natspec::devDocumentation(std::multimap<std::string, DocTag> const& _tags)
 
 std::vector<EventDefinition const*>  Natspec::uniqueInterfaceEvents(ContractDefinition const& _contract)
 {
+	// The signature of each event is computed only once, it is a string built from all parameter types.
 	auto eventSignature = [](EventDefinition const* _event) -> std::string {
 		FunctionType const* functionType = _event->functionType(true);
 		solAssert(functionType, "");
 		return functionType->externalSignature();
 	};
-	auto compareBySignature =
-		[&](EventDefinition const* _lhs, EventDefinition const* _rhs) -> bool {
-			return eventSignature(_lhs) < eventSignature(_rhs);
-		};
 
-	std::set<EventDefinition const*, decltype(compareBySignature)> uniqueEvents{compareBySignature};
+	std::map<std::string, EventDefinition const*> uniqueEvents;
 	// Insert events defined in the contract first so that in case of a conflict
 	// they're the ones that get selected.
-	uniqueEvents += _contract.definedInterfaceEvents();
+	for (EventDefinition const* event: _contract.definedInterfaceEvents())
+		uniqueEvents.emplace(eventSignature(event), event);
 
-	std::set<EventDefinition const*, decltype(compareBySignature)> filteredUsedEvents{compareBySignature};
-	std::set<std::string> usedSignatures;
+	// Used events are only included if no other used event has the same signature.
+	std::map<std::string, EventDefinition const*> usedEvents;
+	std::set<std::string> ambiguousSignatures;
 	for (EventDefinition const* event: _contract.usedInterfaceEvents())
 	{
-		auto&& [eventIt, eventInserted] = filteredUsedEvents.insert(event);
-		auto&& [signatureIt, signatureInserted] = usedSignatures.insert(eventSignature(event));
-		if (!signatureInserted)
-			filteredUsedEvents.erase(eventIt);
+		std::string signature = eventSignature(event);
+		if (!usedEvents.emplace(signature, event).second)
+			ambiguousSignatures.insert(std::move(signature));
 	}
-
-	uniqueEvents += filteredUsedEvents;
-	return util::convertContainer<std::vector<EventDefinition const*>>(std::move(uniqueEvents));
+	for (auto const& [signature, event]: usedEvents)
+		if (!ambiguousSignatures.count(signature))
+			uniqueEvents.emplace(signature, event);
+
+	std::vector<EventDefinition const*> events;
+	for (auto const& [signature, event]: uniqueEvents)
+		events.push_back(event);
+	return events;
 }
@@ -25,7 +25,10 @@
 
 #include <liblangutil/Exceptions.h>
 
+#include <chrono>
 #include <cstddef>
+#include <map>
+#include <optional>
 #include <string>
 
 namespace solidity::frontend
@@ -125,7 +128,11 @@ struct OptimiserSettings
 			optimizeStackAllocation == _other.optimizeStackAllocation &&
 			runYulOptimiser == _other.runYulOptimiser &&
 			yulOptimiserSteps == _other.yulOptimiserSteps &&
-			expectedExecutionsPerDeployment == _other.expectedExecutionsPerDeployment;
+			expectedExecutionsPerDeployment == _other.expectedExecutionsPerDeployment &&
+			yulExecutionProfile == _other.yulExecutionProfile &&
+			exhaustiveStackLayoutSearch == _other.exhaustiveStackLayoutSearch &&
+			dispatchProfile == _other.dispatchProfile &&
+			yulOptimiserTimeBudget == _other.yulOptimiserTimeBudget;
 	}
 
 	bool operator!=(OptimiserSettings const& _other) const
@@ -167,6 +174,23 @@ struct OptimiserSettings
 	/// This specifies an estimate on how often each opcode in this assembly will be executed,
 	/// i.e. use a small value to optimise for size and a large value to optimise for runtime gas usage.
 	size_t expectedExecutionsPerDeployment = 200;
+	/// Expected number of executions per deployment of individual Yul functions of the deployed code,
+	/// keyed by function name. Replaces @a expectedExecutionsPerDeployment in the decisions
+	/// the Yul optimiser makes about the code of these functions.
+	std::map<std::string, size_t> yulExecutionProfile;
+	/// Try all orders of the slots when combining the stack layouts of two branches in the
+	/// optimized code transform from Yul to bytecode, if there are only few of them. This reduces
+	/// the stack shuffling at the cost of compilation time.
+	bool exhaustiveStackLayoutSearch = false;
+	/// Expected relative number of calls of the external functions, keyed by their signature.
+	/// The function dispatcher of the legacy code generator checks the most frequently called
+	/// functions first.
+	std::map<std::string, size_t> dispatchProfile;
+	/// Maximum time the Yul optimiser may spend on the IR of a contract, including the code of the
+	/// contracts it creates. Once it is exceeded, the remaining steps of @a yulOptimiserSteps are
+	/// skipped and @a DefaultYulOptimiserCleanupSteps is run instead of @a yulOptimiserCleanupSteps.
+	/// The resulting code then depends on the speed of the machine. Unlimited if nullopt.
+	std::optional<std::chrono::milliseconds> yulOptimiserTimeBudget;
 };
 
 }
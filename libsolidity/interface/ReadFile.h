@@ -43,6 +43,9 @@ public:
 	enum class Kind
 	{
 		ReadFile,
+		/// Reads several files at once. The query is a JSON array of paths and a successful
+		/// response is a JSON object mapping some or all of these paths to their contents.
+		ReadFiles,
 		SMTQuery
 	};
 
@@ -52,6 +55,8 @@ public:
 		{
 		case Kind::ReadFile:
 			return "source";
+		case Kind::ReadFiles:
+			return "sources";
 		case Kind::SMTQuery:
 			return "smt-query";
 		default:
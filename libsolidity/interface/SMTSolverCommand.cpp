@@ -19,6 +19,7 @@
 
 #include <liblangutil/Exceptions.h>
 
+#include <libsolutil/Common.h>
 #include <libsolutil/CommonIO.h>
 #include <libsolutil/Exceptions.h>
 #include <libsolutil/Keccak256.h>
@@ -30,6 +31,8 @@
 #include <boost/filesystem/fstream.hpp>
 #include <boost/process.hpp>
 
+#include <algorithm>
+
 using solidity::langutil::InternalCompilerError;
 using solidity::util::errinfo_comment;
 
@@ -37,10 +40,70 @@ using solidity::util::errinfo_comment;
 namespace solidity::frontend
 {
 
+/// A solver process that reads one query after another from its standard input.
+struct SMTSolverCommand::Session
+{
+	Session(
+		boost::filesystem::path const& _solverBin,
+		std::string _command,
+		std::vector<std::string> _arguments
+	):
+		command(std::move(_command)),
+		arguments(std::move(_arguments)),
+		process(
+			_solverBin,
+			sessionArguments(arguments),
+			boost::process::std_in < input,
+			boost::process::std_out > output,
+			boost::process::std_err > boost::process::null
+		)
+	{}
+
+	~Session()
+	{
+		std::error_code error;
+		process.terminate(error);
+	}
+
+	/// @returns the arguments to run the solver in interactive mode, given the arguments for solving a single query.
+	static std::vector<std::string> sessionArguments(std::vector<std::string> _arguments)
+	{
+		// A resource limit for the whole process would be exhausted after a few queries.
+		for (std::string& argument: _arguments)
+			if (argument == "--rlimit")
+				argument = "--rlimit-per";
+		_arguments.emplace_back("--lang");
+		_arguments.emplace_back("smt2");
+		_arguments.emplace_back("--incremental");
+		return _arguments;
+	}
+
+	std::string command;
+	std::vector<std::string> arguments;
+	boost::process::opstream input;
+	boost::process::ipstream output;
+	boost::process::child process;
+};
+
+SMTSolverCommand::SMTSolverCommand() = default;
+SMTSolverCommand::~SMTSolverCommand() = default;
+
+void SMTSolverCommand::setPersistentSessions(bool _enabled)
+{
+	m_persistentSessions = _enabled;
+	if (!_enabled)
+	{
+		std::lock_guard<std::mutex> lock(m_sessionMutex);
+		m_idleSessions.clear();
+	}
+}
+
 void SMTSolverCommand::setEldarica(std::optional<unsigned int> timeoutInMilliseconds, bool computeInvariants)
 {
 	m_arguments.clear();
 	m_solverCmd = "eld";
+	// Eldarica can only answer a single query per process.
+	m_supportsSessions = false;
 	if (timeoutInMilliseconds)
 	{
 		unsigned int timeoutInSeconds = timeoutInMilliseconds.value() / 1000u;
@@ -55,6 +118,7 @@ void SMTSolverCommand::setCvc5(std::optional<unsigned int> timeoutInMilliseconds
 {
 	m_arguments.clear();
 	m_solverCmd = "cvc5";
+	m_supportsSessions = true;
 	if (timeoutInMilliseconds)
 	{
 		m_arguments.push_back("--tlimit-per");
@@ -67,6 +131,24 @@ void SMTSolverCommand::setCvc5(std::optional<unsigned int> timeoutInMilliseconds
 	}
 }
 
+void SMTSolverCommand::interrupt()
+{
+	std::lock_guard<std::mutex> lock(m_processMutex);
+	if (m_runningProcess && m_runningProcess->running())
+	{
+		m_runningProcess->terminate();
+		m_interrupted = true;
+	}
+}
+
+void SMTSolverCommand::setCacheDirectory(boost::filesystem::path const& _directory)
+{
+	if (_directory.empty())
+		m_cache.reset();
+	else
+		m_cache = std::make_unique<CompilationCache>(_directory);
+}
+
 ReadCallback::Result SMTSolverCommand::solve(std::string const& _kind, std::string const& _query)
 {
 	try
@@ -77,43 +159,151 @@ ReadCallback::Result SMTSolverCommand::solve(std::string const& _kind, std::stri
 		if (m_solverCmd.empty())
 			return ReadCallback::Result{false, "No solver set."};
 
-		auto tempDir = solidity::util::TemporaryDirectory("smt");
-		util::h256 queryHash = util::keccak256(_query);
-		auto queryFileName = tempDir.path() / ("query_" + queryHash.hex() + ".smt2");
-
-		auto queryFile = boost::filesystem::ofstream(queryFileName);
-		queryFile << _query << std::flush;
+		// The arguments contain the timeout, which influences the answer.
+		std::optional<util::h256> cacheKey;
+		if (m_cache)
+		{
+			cacheKey = util::keccak256(
+				"smt-query\n" + m_solverCmd + "\n" + boost::join(m_arguments, " ") + "\n" + _query
+			);
+			if (std::optional<std::string> cachedAnswer = m_cache->load(*cacheKey))
+				return ReadCallback::Result{true, std::move(*cachedAnswer)};
+		}
 
 		auto solverBin = boost::process::search_path(m_solverCmd);
 
 		if (solverBin.empty())
 			return ReadCallback::Result{false, m_solverCmd + " binary not found."};
 
-		auto args = m_arguments;
-		args.push_back(queryFileName.string());
+		ReadCallback::Result result =
+			m_persistentSessions && m_supportsSessions ?
+			solveInSession(solverBin, _query) :
+			solveInProcess(solverBin, _query);
 
-		boost::process::ipstream pipe;
-		boost::process::child solverProcess(
-			solverBin,
-			args,
-			boost::process::std_out > pipe,
-			boost::process::std_err > boost::process::null
-		);
+		// Do not cache answers that may change if the solver is given more resources, e.g. due to a timeout.
+		std::string const& answer = result.responseOrErrorMessage;
+		if (cacheKey && result.success && (boost::starts_with(answer, "sat") || boost::starts_with(answer, "unsat")))
+			m_cache->store(*cacheKey, answer);
+		return result;
+	}
+	catch (...)
+	{
+		return ReadCallback::Result{false, "Unknown exception in SMTQuery callback: " + boost::current_exception_diagnostic_information()};
+	}
+}
 
-		std::vector<std::string> data;
-		std::string line;
-		while (solverProcess.running() && std::getline(pipe, line))
-			if (!line.empty())
-				data.push_back(line);
+ReadCallback::Result SMTSolverCommand::solveInProcess(boost::filesystem::path const& _solverBin, std::string const& _query)
+{
+	auto tempDir = solidity::util::TemporaryDirectory("smt");
+	util::h256 queryHash = util::keccak256(_query);
+	auto queryFileName = tempDir.path() / ("query_" + queryHash.hex() + ".smt2");
+
+	auto queryFile = boost::filesystem::ofstream(queryFileName);
+	queryFile << _query << std::flush;
 
-		solverProcess.wait();
+	auto args = m_arguments;
+	args.push_back(queryFileName.string());
 
-		return ReadCallback::Result{true, boost::join(data, "\n")};
+	boost::process::ipstream pipe;
+	boost::process::child solverProcess(
+		_solverBin,
+		args,
+		boost::process::std_out > pipe,
+		boost::process::std_err > boost::process::null
+	);
+	{
+		std::lock_guard<std::mutex> lock(m_processMutex);
+		m_runningProcess = &solverProcess;
+		m_interrupted = false;
 	}
-	catch (...)
+	ScopeGuard resetRunningProcess([&]() {
+		std::lock_guard<std::mutex> lock(m_processMutex);
+		m_runningProcess = nullptr;
+	});
+	auto running = [&]() {
+		std::lock_guard<std::mutex> lock(m_processMutex);
+		return solverProcess.running();
+	};
+
+	std::vector<std::string> data;
+	std::string line;
+	while (running() && std::getline(pipe, line))
+		if (!line.empty())
+			data.push_back(line);
+
 	{
-		return ReadCallback::Result{false, "Unknown exception in SMTQuery callback: " + boost::current_exception_diagnostic_information()};
+		std::lock_guard<std::mutex> lock(m_processMutex);
+		m_runningProcess = nullptr;
+		if (m_interrupted)
+			return ReadCallback::Result{true, "unknown"};
+	}
+	solverProcess.wait();
+
+	return ReadCallback::Result{true, boost::join(data, "\n")};
+}
+
+ReadCallback::Result SMTSolverCommand::solveInSession(boost::filesystem::path const& _solverBin, std::string const& _query)
+{
+	std::unique_ptr<Session> session;
+	{
+		std::lock_guard<std::mutex> lock(m_sessionMutex);
+		auto it = std::find_if(m_idleSessions.begin(), m_idleSessions.end(), [&](auto const& _session) {
+			return _session->command == m_solverCmd && _session->arguments == m_arguments;
+		});
+		if (it != m_idleSessions.end())
+		{
+			session = std::move(*it);
+			m_idleSessions.erase(it);
+		}
+	}
+	if (session && !session->process.running())
+		session.reset();
+	if (!session)
+		session = std::make_unique<Session>(_solverBin, m_solverCmd, m_arguments);
+
+	// Since a query consists of several commands, the end of the answer is marked by echoing a
+	// string that cannot be part of an answer.
+	static std::string const endOfAnswer = "solc-end-of-answer";
+	session->input << "(reset)\n" << _query << "\n(echo \"" << endOfAnswer << "\")" << std::endl;
+
+	{
+		std::lock_guard<std::mutex> lock(m_processMutex);
+		m_runningProcess = &session->process;
+		m_interrupted = false;
+	}
+	ScopeGuard resetRunningProcess([&]() {
+		std::lock_guard<std::mutex> lock(m_processMutex);
+		m_runningProcess = nullptr;
+	});
+
+	std::vector<std::string> data;
+	bool complete = false;
+	std::string line;
+	while (std::getline(session->output, line))
+	{
+		if (line == endOfAnswer || line == "\"" + endOfAnswer + "\"")
+		{
+			complete = true;
+			break;
+		}
+		if (!line.empty())
+			data.push_back(line);
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(m_processMutex);
+		m_runningProcess = nullptr;
+		if (m_interrupted)
+			return ReadCallback::Result{true, "unknown"};
+	}
+
+	// A session that did not finish its answer is discarded and a new one is started for the next query.
+	if (complete)
+	{
+		std::lock_guard<std::mutex> lock(m_sessionMutex);
+		m_idleSessions.emplace_back(std::move(session));
 	}
+	return ReadCallback::Result{true, boost::join(data, "\n")};
 }
 
 }
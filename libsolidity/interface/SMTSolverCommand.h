@@ -17,9 +17,14 @@
 // SPDX-License-Identifier: GPL-3.0
 #pragma once
 
+#include <libsolidity/interface/CompilationCache.h>
 #include <libsolidity/interface/ReadFile.h>
 
 #include <boost/filesystem.hpp>
+#include <boost/process/child.hpp>
+
+#include <memory>
+#include <mutex>
 
 namespace solidity::frontend
 {
@@ -28,8 +33,14 @@ namespace solidity::frontend
 class SMTSolverCommand
 {
 public:
+	SMTSolverCommand();
+	~SMTSolverCommand();
+
 	/// Calls an SMT solver with the given query.
 	frontend::ReadCallback::Result solve(std::string const& _kind, std::string const& _query);
+	/// Terminates the solver process started by a call to ``solve`` running on another thread.
+	/// The interrupted call reports ``unknown`` as the answer to its query.
+	void interrupt();
 
 	frontend::ReadCallback::Callback solver()
 	{
@@ -39,10 +50,41 @@ public:
 	void setEldarica(std::optional<unsigned int> timeoutInMilliseconds, bool computeInvariants);
 	void setCvc5(std::optional<unsigned int> timeoutInMilliseconds);
 
+	/// Stores the answers of the solver in the given directory and reuses them for identical
+	/// queries to the same solver with the same arguments. An empty path disables the cache.
+	void setCacheDirectory(boost::filesystem::path const& _directory);
+
+	/// If enabled, solvers that support it are started once and kept running, and all queries are sent
+	/// to them via their standard input. Otherwise a new process is started for every query.
+	/// Currently only cvc5 supports this.
+	void setPersistentSessions(bool _enabled);
+
 private:
+	struct Session;
+
+	/// Runs a new solver process to answer @a _query.
+	ReadCallback::Result solveInProcess(boost::filesystem::path const& _solverBin, std::string const& _query);
+	/// Sends @a _query to an idle session of the current solver, starting a new one if there is none.
+	ReadCallback::Result solveInSession(boost::filesystem::path const& _solverBin, std::string const& _query);
+
 	/// The name of the solver's binary.
 	std::string m_solverCmd;
 	std::vector<std::string> m_arguments;
+	std::unique_ptr<CompilationCache> m_cache;
+	/// True if the current solver can answer a sequence of queries read from its standard input.
+	bool m_supportsSessions = false;
+	bool m_persistentSessions = false;
+
+	/// Protects the access to m_idleSessions.
+	std::mutex m_sessionMutex;
+	/// Sessions that are not answering a query at the moment.
+	std::vector<std::unique_ptr<Session>> m_idleSessions;
+
+	/// Protects the access to m_runningProcess.
+	std::mutex m_processMutex;
+	/// The solver process of the currently running query, if any.
+	boost::process::child* m_runningProcess = nullptr;
+	bool m_interrupted = false;
 };
 
 }
@@ -164,6 +164,41 @@ std::map<std::string, std::set<std::string>> requestedContractNames(Json const&
 	return contracts;
 }
 
+/// Removes the contracts whose metadata still has the hash given in @a _previousMetadataHashes
+/// from the contracts requested from @a _compilerStack, so that no code is generated for them.
+/// The metadata covers the sources a contract depends on and all settings affecting its code.
+/// @returns the fully qualified names of the removed contracts.
+std::set<std::string> skipUnchangedContracts(
+	CompilerStack& _compilerStack,
+	std::map<std::string, std::map<std::string, util::h256>> const& _previousMetadataHashes
+)
+{
+	std::set<std::string> unchangedContracts;
+	std::map<std::string, std::set<std::string>> contractsToCompile;
+	for (std::string const& contractName: _compilerStack.contractNames())
+	{
+		ContractDefinition const& contract = _compilerStack.contractDefinition(contractName);
+		if (!_compilerStack.isRequestedContract(contract))
+			continue;
+
+		auto const* previousHashes = util::valueOrNullptr(_previousMetadataHashes, contract.sourceUnitName());
+		util::h256 const* previousHash = previousHashes ? util::valueOrNullptr(*previousHashes, contract.name()) : nullptr;
+		if (previousHash && *previousHash == util::keccak256(_compilerStack.metadata(contractName)))
+			unchangedContracts.insert(contractName);
+		else
+			contractsToCompile[contract.sourceUnitName()].insert(contract.name());
+	}
+
+	if (!unchangedContracts.empty())
+	{
+		// No names for all sources requests no contract at all, while no sources would request all of them.
+		if (contractsToCompile.empty())
+			contractsToCompile[""] = {};
+		_compilerStack.setRequestedContractNames(contractsToCompile);
+	}
+	return unchangedContracts;
+}
+
 /// Returns true iff @a _hash (hex with 0x prefix) is the Keccak256 hash of the binary data in @a _content.
 bool hashMatchesContent(std::string const& _hash, std::string const& _content)
 {
@@ -179,7 +214,7 @@ bool hashMatchesContent(std::string const& _hash, std::string const& _content)
 
 bool isArtifactRequested(Json const& _outputSelection, std::string const& _artifact, bool _wildcardMatchesExperimental)
 {
-	static std::set<std::string> experimental{"ir", "irAst", "irOptimized", "irOptimizedAst"};
+	static std::set<std::string> experimental{"ir", "irAst", "irOptimized", "irOptimizedAst", "irOptimizedGasEstimates"};
 	for (auto const& selectedArtifactJson: _outputSelection)
 	{
 		std::string const& selectedArtifact = selectedArtifactJson.get<std::string>();
@@ -191,7 +226,11 @@ bool isArtifactRequested(Json const& _outputSelection, std::string const& _artif
 		else if (selectedArtifact == "*")
 		{
 			// "ir", "irOptimized" can only be matched by "*" if activated.
-			if (experimental.count(_artifact) == 0 || _wildcardMatchesExperimental)
+			// "irOptimizerProfile" is not deterministic and has to be requested explicitly.
+			if (
+				_artifact != "irOptimizerProfile" &&
+				(experimental.count(_artifact) == 0 || _wildcardMatchesExperimental)
+			)
 				return true;
 		}
 	}
@@ -263,7 +302,7 @@ bool isBinaryRequested(Json const& _outputSelection)
 	// This does not include "evm.methodIdentifiers" on purpose!
 	static std::vector<std::string> const outputsThatRequireBinaries = std::vector<std::string>{
 		"*",
-		"ir", "irAst", "irOptimized", "irOptimizedAst",
+		"ir", "irAst", "irOptimized", "irOptimizedAst", "irOptimizedGasEstimates", "irOptimizerProfile",
 		"evm.gasEstimates", "evm.legacyAssembly", "evm.assembly"
 	} + evmObjectComponents("bytecode") + evmObjectComponents("deployedBytecode");
 
@@ -308,13 +347,45 @@ bool isIRRequested(Json const& _outputSelection)
 					request == "ir" ||
 					request == "irAst" ||
 					request == "irOptimized" ||
-					request == "irOptimizedAst"
+					request == "irOptimizedAst" ||
+					request == "irOptimizedGasEstimates" ||
+					request == "irOptimizerProfile"
 				)
 					return true;
 
 	return false;
 }
 
+/// @returns true if the profile of the Yul optimizer was requested for any contract.
+bool isOptimizerProfileRequested(Json const& _outputSelection)
+{
+	if (!_outputSelection.is_object())
+		return false;
+
+	for (auto const& fileRequests: _outputSelection)
+		for (auto const& requests: fileRequests)
+			for (auto const& request: requests)
+				if (request == "irOptimizerProfile")
+					return true;
+
+	return false;
+}
+
+/// @returns true if the gas estimates of the optimized Yul functions were requested for any contract.
+bool isIRGasEstimationRequested(Json const& _outputSelection)
+{
+	if (!_outputSelection.is_object())
+		return false;
+
+	for (auto const& fileRequests: _outputSelection)
+		for (auto const& requests: fileRequests)
+			for (auto const& request: requests)
+				if (request == "irOptimizedGasEstimates")
+					return true;
+
+	return false;
+}
+
 Json formatLinkReferences(std::map<size_t, std::string> const& linkReferences)
 {
 	Json ret = Json::object();
@@ -368,8 +439,8 @@ Json formatImmutableReferences(std::map<u256, std::pair<std::string, std::vector
 Json collectEVMObject(
 	langutil::EVMVersion _evmVersion,
 	evmasm::LinkerObject const& _object,
-	std::string const* _sourceMap,
-	Json _generatedSources,
+	std::function<std::string const*()> const& _sourceMap,
+	std::function<Json()> const& _generatedSources,
 	bool _runtimeObject,
 	std::function<bool(std::string)> const& _artifactRequested
 )
@@ -380,7 +451,10 @@ Json collectEVMObject(
 	if (_artifactRequested("opcodes"))
 		output["opcodes"] = evmasm::disassemble(_object.bytecode, _evmVersion);
 	if (_artifactRequested("sourceMap"))
-		output["sourceMap"] = _sourceMap ? *_sourceMap : "";
+	{
+		std::string const* sourceMap = _sourceMap();
+		output["sourceMap"] = sourceMap ? *sourceMap : "";
+	}
 	if (_artifactRequested("functionDebugData"))
 		output["functionDebugData"] = StandardCompiler::formatFunctionDebugData(_object.functionDebugData);
 	if (_artifactRequested("linkReferences"))
@@ -388,7 +462,7 @@ Json collectEVMObject(
 	if (_runtimeObject && _artifactRequested("immutableReferences"))
 		output["immutableReferences"] = formatImmutableReferences(_object.immutableReferences);
 	if (_artifactRequested("generatedSources"))
-		output["generatedSources"] = std::move(_generatedSources);
+		output["generatedSources"] = _generatedSources();
 	return output;
 }
 
@@ -424,25 +498,56 @@ std::optional<Json> checkAuxiliaryInputKeys(Json const& _input)
 
 std::optional<Json> checkSettingsKeys(Json const& _input)
 {
-	static std::set<std::string> keys{"debug", "evmVersion", "libraries", "metadata", "modelChecker", "optimizer", "outputSelection", "remappings", "stopAfter", "viaIR"};
+	static std::set<std::string> keys{"debug", "evmVersion", "importCallback", "libraries", "metadata", "modelChecker", "optimizer", "outputSelection", "parallelism", "previousMetadataHashes", "remappings", "stopAfter", "trace", "viaIR"};
 	return checkKeys(_input, keys, "settings");
 }
 
+std::optional<Json> checkImportCallbackKeys(Json const& _input)
+{
+	static std::set<std::string> keys{"batch", "prefetch"};
+	return checkKeys(_input, keys, "importCallback");
+}
+
 std::optional<Json> checkModelCheckerSettingsKeys(Json const& _input)
 {
-	static std::set<std::string> keys{"bmcLoopIterations", "contracts", "divModNoSlacks", "engine", "extCalls", "invariants", "printQuery", "showProvedSafe", "showUnproved", "showUnsupported", "solvers", "targets", "timeout"};
+	static std::set<std::string> keys{"bmcLoopIterations", "contracts", "divModNoSlacks", "engine", "extCalls", "invariants", "parallelQueries", "printQuery", "raceSolvers", "showProvedSafe", "showUnproved", "showUnsupported", "solvers", "targets", "timeBudget", "timeout"};
 	return checkKeys(_input, keys, "modelChecker");
 }
 
+std::optional<Json> checkOptimizerProfile(
+	Json const& _details,
+	std::string const& _path,
+	std::string const& _name,
+	std::map<std::string, size_t>& _setting
+)
+{
+	if (!_details.contains(_name))
+		return {};
+
+	Json const& profile = _details[_name];
+	if (!profile.is_object())
+		return formatFatalError(Error::Type::JSONError, "\"" + _path + "." + _name + "\" must be an object.");
+	for (auto const& [function, executions]: profile.items())
+	{
+		if (!executions.is_number_unsigned())
+			return formatFatalError(
+				Error::Type::JSONError,
+				"The number of executions of \"" + function + "\" in \"" + _path + "." + _name + "\" must be an unsigned number."
+			);
+		_setting[function] = executions.get<size_t>();
+	}
+	return {};
+}
+
 std::optional<Json> checkOptimizerKeys(Json const& _input)
 {
-	static std::set<std::string> keys{"details", "enabled", "runs"};
+	static std::set<std::string> keys{"details", "enabled", "runs", "timeBudget"};
 	return checkKeys(_input, keys, "settings.optimizer");
 }
 
 std::optional<Json> checkOptimizerDetailsKeys(Json const& _input)
 {
-	static std::set<std::string> keys{"peephole", "inliner", "jumpdestRemover", "orderLiterals", "deduplicate", "cse", "constantOptimizer", "yul", "yulDetails", "simpleCounterForLoopUncheckedIncrement"};
+	static std::set<std::string> keys{"peephole", "inliner", "jumpdestRemover", "orderLiterals", "deduplicate", "cse", "constantOptimizer", "yul", "yulDetails", "simpleCounterForLoopUncheckedIncrement", "dispatchProfile"};
 	return checkKeys(_input, keys, "settings.optimizer.details");
 }
 
@@ -582,6 +687,13 @@ std::variant<OptimiserSettings, Json> parseOptimizerSettings(Json const& _jsonIn
 		settings.expectedExecutionsPerDeployment = _jsonInput["runs"].get<size_t>();
 	}
 
+	if (_jsonInput.contains("timeBudget"))
+	{
+		if (!_jsonInput["timeBudget"].is_number_unsigned())
+			return formatFatalError(Error::Type::JSONError, "The \"timeBudget\" setting must be an unsigned number.");
+		settings.yulOptimiserTimeBudget = std::chrono::milliseconds(_jsonInput["timeBudget"].get<int64_t>());
+	}
+
 	if (_jsonInput.contains("details"))
 	{
 		Json const& details = _jsonInput["details"];
@@ -606,6 +718,8 @@ std::variant<OptimiserSettings, Json> parseOptimizerSettings(Json const& _jsonIn
 			return *error;
 		if (auto error = checkOptimizerDetail(details, "simpleCounterForLoopUncheckedIncrement", settings.simpleCounterForLoopUncheckedIncrement))
 			return *error;
+		if (auto error = checkOptimizerProfile(details, "settings.optimizer.details", "dispatchProfile", settings.dispatchProfile))
+			return *error;
 		settings.optimizeStackAllocation = settings.runYulOptimiser;
 		if (details.contains("yulDetails"))
 		{
@@ -618,12 +732,16 @@ std::variant<OptimiserSettings, Json> parseOptimizerSettings(Json const& _jsonIn
 				return {std::move(settings)};
 			}
 
-			if (auto result = checkKeys(details["yulDetails"], {"stackAllocation", "optimizerSteps"}, "settings.optimizer.details.yulDetails"))
+			if (auto result = checkKeys(details["yulDetails"], {"stackAllocation", "optimizerSteps", "executionProfile", "exhaustiveStackLayoutSearch"}, "settings.optimizer.details.yulDetails"))
 				return *result;
 			if (auto error = checkOptimizerDetail(details["yulDetails"], "stackAllocation", settings.optimizeStackAllocation))
 				return *error;
 			if (auto error = checkOptimizerDetailSteps(details["yulDetails"], "optimizerSteps", settings.yulOptimiserSteps, settings.yulOptimiserCleanupSteps, settings.runYulOptimiser))
 				return *error;
+			if (auto error = checkOptimizerProfile(details["yulDetails"], "settings.optimizer.details.yulDetails", "executionProfile", settings.yulExecutionProfile))
+				return *error;
+			if (auto error = checkOptimizerDetail(details["yulDetails"], "exhaustiveStackLayoutSearch", settings.exhaustiveStackLayoutSearch))
+				return *error;
 		}
 	}
 	return {std::move(settings)};
@@ -631,7 +749,7 @@ std::variant<OptimiserSettings, Json> parseOptimizerSettings(Json const& _jsonIn
 
 }
 
-std::variant<StandardCompiler::InputsAndSettings, Json> StandardCompiler::parseInput(Json const& _input)
+std::variant<StandardCompiler::InputsAndSettings, Json> StandardCompiler::parseInput(Json _input)
 {
 	InputsAndSettings ret;
 
@@ -643,7 +761,11 @@ std::variant<StandardCompiler::InputsAndSettings, Json> StandardCompiler::parseI
 
 	ret.language = _input.value<std::string>("language", "");
 
-	Json const& sources = _input.value<Json>("sources", Json());
+	// The sources and the auxiliary input can be large, so they are moved out of the input
+	// and their strings are moved into the result instead of being copied.
+	Json sources;
+	if (auto it = _input.find("sources"); it != _input.end())
+		sources = std::move(*it);
 
 	if (!sources.is_object() && !sources.is_null())
 		return formatFatalError(Error::Type::JSONError, "\"sources\" is not a JSON object.");
@@ -656,7 +778,7 @@ std::variant<StandardCompiler::InputsAndSettings, Json> StandardCompiler::parseI
 
 	if (ret.language == "Solidity" || ret.language == "Yul")
 	{
-		for (auto const& [sourceName, sourceValue]: sources.items())
+		for (auto& [sourceName, sourceValue]: sources.items())
 		{
 			std::string hash;
 
@@ -668,7 +790,7 @@ std::variant<StandardCompiler::InputsAndSettings, Json> StandardCompiler::parseI
 
 			if (sourceValue.contains("content") && sourceValue["content"].is_string())
 			{
-				std::string content = sourceValue["content"].get<std::string>();
+				std::string& content = sourceValue["content"].get_ref<std::string&>();
 				if (!hash.empty() && !hashMatchesContent(hash, content))
 					ret.errors.emplace_back(formatError(
 						Error::Type::IOError,
@@ -676,7 +798,7 @@ std::variant<StandardCompiler::InputsAndSettings, Json> StandardCompiler::parseI
 						"Mismatch between content and supplied hash for \"" + sourceName + "\""
 					));
 				else
-					ret.sources[sourceName] = content;
+					ret.sources[sourceName] = std::move(content);
 			}
 			else if (sourceValue["urls"].is_array())
 			{
@@ -703,7 +825,7 @@ std::variant<StandardCompiler::InputsAndSettings, Json> StandardCompiler::parseI
 							));
 						else
 						{
-							ret.sources[sourceName] = result.responseOrErrorMessage;
+							ret.sources[sourceName] = std::move(result.responseOrErrorMessage);
 							found = true;
 							break;
 						}
@@ -735,7 +857,7 @@ std::variant<StandardCompiler::InputsAndSettings, Json> StandardCompiler::parseI
 	}
 	else if (ret.language == "EVMAssembly")
 	{
-		for (auto const& [sourceName, sourceValue]: sources.items())
+		for (auto& [sourceName, sourceValue]: sources.items())
 		{
 			solAssert(sources.contains(sourceName));
 			if (
@@ -748,7 +870,7 @@ std::variant<StandardCompiler::InputsAndSettings, Json> StandardCompiler::parseI
 					"Invalid input source specified. Expected exactly one object, named 'assemblyJson', inside $.sources." + sourceName
 				);
 
-			ret.jsonSources[sourceName] = sourceValue["assemblyJson"];
+			ret.jsonSources[sourceName] = std::move(sourceValue["assemblyJson"]);
 		}
 		if (ret.jsonSources.size() != 1)
 			return formatFatalError(
@@ -756,20 +878,24 @@ std::variant<StandardCompiler::InputsAndSettings, Json> StandardCompiler::parseI
 				"EVMAssembly import only supports exactly one input file."
 			);
 	}
-	Json const& auxInputs = _input.value("auxiliaryInput", Json::object());
+	Json auxInputs = Json::object();
+	if (auto it = _input.find("auxiliaryInput"); it != _input.end())
+		auxInputs = std::move(*it);
 
 	if (auto result = checkAuxiliaryInputKeys(auxInputs))
 		return *result;
 
 	if (!auxInputs.empty())
 	{
-		Json const& smtlib2Responses = auxInputs.value("smtlib2responses", Json::object());
+		Json smtlib2Responses = Json::object();
+		if (auto it = auxInputs.find("smtlib2responses"); it != auxInputs.end())
+			smtlib2Responses = std::move(*it);
 		if (!smtlib2Responses.empty())
 		{
 			if (!smtlib2Responses.is_object())
 				return formatFatalError(Error::Type::JSONError, "\"auxiliaryInput.smtlib2responses\" must be an object.");
 
-			for (auto const& [hashString, response]: smtlib2Responses.items())
+			for (auto& [hashString, response]: smtlib2Responses.items())
 			{
 				util::h256 hash;
 				try
@@ -787,7 +913,7 @@ std::variant<StandardCompiler::InputsAndSettings, Json> StandardCompiler::parseI
 						"\"smtlib2Responses." + hashString + "\" must be a string."
 					);
 
-				ret.smtLib2Responses[hash] = response.get<std::string>();
+				ret.smtLib2Responses[hash] = std::move(response.get_ref<std::string&>());
 			}
 		}
 	}
@@ -815,6 +941,71 @@ std::variant<StandardCompiler::InputsAndSettings, Json> StandardCompiler::parseI
 		ret.viaIR = settings["viaIR"].get<bool>();
 	}
 
+	if (settings.contains("parallelism"))
+	{
+		if (!settings["parallelism"].is_number_unsigned() || settings["parallelism"].get<size_t>() == 0)
+			return formatFatalError(Error::Type::JSONError, "\"settings.parallelism\" must be a positive integer.");
+		ret.parallelism = settings["parallelism"].get<size_t>();
+	}
+
+	if (settings.contains("importCallback"))
+	{
+		Json const& importCallback = settings["importCallback"];
+		if (!importCallback.is_object())
+			return formatFatalError(Error::Type::JSONError, "\"settings.importCallback\" must be an object.");
+		if (auto result = checkImportCallbackKeys(importCallback))
+			return *result;
+		if (importCallback.contains("batch"))
+		{
+			if (!importCallback["batch"].is_boolean())
+				return formatFatalError(Error::Type::JSONError, "\"settings.importCallback.batch\" must be a Boolean.");
+			ret.batchImportReads = importCallback["batch"].get<bool>();
+		}
+		if (importCallback.contains("prefetch"))
+		{
+			if (!importCallback["prefetch"].is_array())
+				return formatFatalError(Error::Type::JSONError, "\"settings.importCallback.prefetch\" must be an array of strings.");
+			for (auto const& path: importCallback["prefetch"])
+			{
+				if (!path.is_string())
+					return formatFatalError(Error::Type::JSONError, "\"settings.importCallback.prefetch\" must be an array of strings.");
+				ret.importPrefetchHints.push_back(path.get<std::string>());
+			}
+		}
+	}
+
+	if (settings.contains("previousMetadataHashes"))
+	{
+		Json const& previousMetadataHashes = settings["previousMetadataHashes"];
+		if (!previousMetadataHashes.is_object())
+			return formatFatalError(Error::Type::JSONError, "\"settings.previousMetadataHashes\" must be an object.");
+		for (auto const& [sourceName, contracts]: previousMetadataHashes.items())
+		{
+			if (!contracts.is_object())
+				return formatFatalError(
+					Error::Type::JSONError,
+					"\"settings.previousMetadataHashes." + sourceName + "\" must be an object."
+				);
+			for (auto const& [contractName, hash]: contracts.items())
+			{
+				if (!hash.is_string() || hash.get<std::string>().size() != 66 || !util::isValidHex(hash.get<std::string>()))
+					return formatFatalError(
+						Error::Type::JSONError,
+						"\"settings.previousMetadataHashes." + sourceName + "." + contractName + "\" must be a 0x-prefixed Keccak-256 hash."
+					);
+				ret.previousMetadataHashes[sourceName][contractName] = util::h256(hash.get<std::string>());
+			}
+		}
+	}
+
+	if (settings.contains("trace"))
+	{
+		if (!settings["trace"].is_boolean())
+			return formatFatalError(Error::Type::JSONError, "\"settings.trace\" must be a Boolean.");
+		if (settings["trace"].get<bool>())
+			ret.tracer = std::make_shared<util::PhaseTracer>();
+	}
+
 	if (settings.contains("evmVersion"))
 	{
 		if (!settings["evmVersion"].is_string())
@@ -1088,6 +1279,22 @@ std::variant<StandardCompiler::InputsAndSettings, Json> StandardCompiler::parseI
 		ret.modelCheckerSettings.invariants = invariants;
 	}
 
+	if (modelCheckerSettings.contains("parallelQueries"))
+	{
+		auto const& parallelQueries = modelCheckerSettings["parallelQueries"];
+		if (!parallelQueries.is_number_unsigned() || parallelQueries.get<unsigned>() == 0)
+			return formatFatalError(Error::Type::JSONError, "settings.modelChecker.parallelQueries must be a positive integer.");
+		ret.modelCheckerSettings.parallelQueries = parallelQueries.get<unsigned>();
+	}
+
+	if (modelCheckerSettings.contains("raceSolvers"))
+	{
+		auto const& raceSolvers = modelCheckerSettings["raceSolvers"];
+		if (!raceSolvers.is_boolean())
+			return formatFatalError(Error::Type::JSONError, "settings.modelChecker.raceSolvers must be a Boolean value.");
+		ret.modelCheckerSettings.raceSolvers = raceSolvers.get<bool>();
+	}
+
 	if (modelCheckerSettings.contains("showProvedSafe"))
 	{
 		auto const& showProvedSafe = modelCheckerSettings["showProvedSafe"];
@@ -1163,6 +1370,13 @@ std::variant<StandardCompiler::InputsAndSettings, Json> StandardCompiler::parseI
 		ret.modelCheckerSettings.targets = targets;
 	}
 
+	if (modelCheckerSettings.contains("timeBudget"))
+	{
+		if (!modelCheckerSettings["timeBudget"].is_number_unsigned())
+			return formatFatalError(Error::Type::JSONError, "settings.modelChecker.timeBudget must be an unsigned integer.");
+		ret.modelCheckerSettings.timeBudget = modelCheckerSettings["timeBudget"].get<Json::number_unsigned_t>();
+	}
+
 	if (modelCheckerSettings.contains("timeout"))
 	{
 		if (!modelCheckerSettings["timeout"].is_number_unsigned())
@@ -1244,8 +1458,8 @@ Json StandardCompiler::importEVMAssembly(StandardCompiler::InputsAndSettings _in
 		evmData["bytecode"] = collectEVMObject(
 			_inputsAndSettings.evmVersion,
 			stack.object(sourceName),
-			stack.sourceMapping(sourceName),
-			{},
+			[&]() { return stack.sourceMapping(sourceName); },
+			[]() { return Json{}; },
 			false, // _runtimeObject
 			[&](std::string const& _element) {
 				return isArtifactRequested(
@@ -1268,8 +1482,8 @@ Json StandardCompiler::importEVMAssembly(StandardCompiler::InputsAndSettings _in
 		evmData["deployedBytecode"] = collectEVMObject(
 			_inputsAndSettings.evmVersion,
 			stack.runtimeObject(sourceName),
-			stack.runtimeSourceMapping(sourceName),
-			{},
+			[&]() { return stack.runtimeSourceMapping(sourceName); },
+			[]() { return Json{}; },
 			true, // _runtimeObject
 			[&](std::string const& _element) {
 				return isArtifactRequested(
@@ -1293,7 +1507,10 @@ Json StandardCompiler::importEVMAssembly(StandardCompiler::InputsAndSettings _in
 	return util::removeNullMembers(output);
 }
 
-Json StandardCompiler::compileSolidity(StandardCompiler::InputsAndSettings _inputsAndSettings)
+Json StandardCompiler::compileSolidity(
+	StandardCompiler::InputsAndSettings _inputsAndSettings,
+	util::JsonStreamWriter* _streamWriter
+)
 {
 	solAssert(_inputsAndSettings.jsonSources.empty());
 
@@ -1305,6 +1522,10 @@ Json StandardCompiler::compileSolidity(StandardCompiler::InputsAndSettings _inpu
 	for (auto const& smtLib2Response: _inputsAndSettings.smtLib2Responses)
 		compilerStack.addSMTLib2Response(smtLib2Response.first, smtLib2Response.second);
 	compilerStack.setViaIR(_inputsAndSettings.viaIR);
+	compilerStack.setParallelism(_inputsAndSettings.parallelism);
+	compilerStack.setBatchImportReads(_inputsAndSettings.batchImportReads);
+	compilerStack.setImportPrefetchHints(std::move(_inputsAndSettings.importPrefetchHints));
+	compilerStack.setTracer(_inputsAndSettings.tracer);
 	compilerStack.setEVMVersion(_inputsAndSettings.evmVersion);
 	compilerStack.setRemappings(std::move(_inputsAndSettings.remappings));
 	compilerStack.setOptimiserSettings(std::move(_inputsAndSettings.optimiserSettings));
@@ -1320,10 +1541,13 @@ Json StandardCompiler::compileSolidity(StandardCompiler::InputsAndSettings _inpu
 
 	compilerStack.enableEvmBytecodeGeneration(isEvmBytecodeRequested(_inputsAndSettings.outputSelection));
 	compilerStack.enableIRGeneration(isIRRequested(_inputsAndSettings.outputSelection));
+	compilerStack.enableOptimizerProfiling(isOptimizerProfileRequested(_inputsAndSettings.outputSelection));
+	compilerStack.enableIRGasEstimation(isIRGasEstimationRequested(_inputsAndSettings.outputSelection));
 
 	Json errors = std::move(_inputsAndSettings.errors);
 
 	bool const binariesRequested = isBinaryRequested(_inputsAndSettings.outputSelection);
+	std::set<std::string> unchangedContracts;
 
 	try
 	{
@@ -1345,7 +1569,14 @@ Json StandardCompiler::compileSolidity(StandardCompiler::InputsAndSettings _inpu
 		else
 		{
 			if (binariesRequested)
+			{
+				if (
+					!_inputsAndSettings.previousMetadataHashes.empty() &&
+					compilerStack.parseAndAnalyze(_inputsAndSettings.stopAfter)
+				)
+					unchangedContracts = skipUnchangedContracts(compilerStack, _inputsAndSettings.previousMetadataHashes);
 				compilerStack.compile();
+			}
 			else
 				compilerStack.parseAndAnalyze(_inputsAndSettings.stopAfter);
 
@@ -1471,6 +1702,8 @@ Json StandardCompiler::compileSolidity(StandardCompiler::InputsAndSettings _inpu
 	)
 		return formatFatalError(Error::Type::InternalCompilerError, "No error reported, but compilation failed.");
 
+	// Most of the artifacts are only generated on request while assembling the output.
+	util::PhaseTracer::Scope tracerScope("StandardCompiler::formatOutput");
 	Json output;
 
 	if (errors.size() > 0)
@@ -1482,30 +1715,15 @@ Json StandardCompiler::compileSolidity(StandardCompiler::InputsAndSettings _inpu
 
 	bool const wildcardMatchesExperimental = false;
 
-	output["sources"] = Json::object();
-	unsigned sourceIndex = 0;
-	// NOTE: A case that will pass `parsingSuccess && !analysisFailed` but not `analysisSuccess` is
-	// stopAfter: parsing with no parsing errors.
-	if (parsingSuccess && !analysisFailed)
-		for (std::string const& sourceName: compilerStack.sourceNames())
-		{
-			Json sourceResult;
-			sourceResult["id"] = sourceIndex++;
-			if (isArtifactRequested(_inputsAndSettings.outputSelection, sourceName, "", "ast", wildcardMatchesExperimental))
-				sourceResult["ast"] = ASTJsonExporter(compilerStack.state(), compilerStack.sourceIndices()).toJson(compilerStack.ast(sourceName));
-			output["sources"][sourceName] = sourceResult;
-		}
-
-	Json contractsOutput;
-	for (std::string const& contractName: analysisSuccess ? compilerStack.contractNames() : std::vector<std::string>())
-	{
-		size_t colon = contractName.rfind(':');
-		solAssert(colon != std::string::npos, "");
-		std::string file = contractName.substr(0, colon);
-		std::string name = contractName.substr(colon + 1);
+	auto contractOutput = [&](std::string const& file, std::string const& name) {
+		std::string const contractName = file + ":" + name;
+		bool const unchanged = unchangedContracts.count(contractName) > 0;
+		bool const codeGenerated = compilationSuccess && !unchanged;
 
 		// ABI, storage layout, documentation and metadata
 		Json contractData;
+		if (unchanged)
+			contractData["unchanged"] = true;
 		if (isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "abi", wildcardMatchesExperimental))
 			contractData["abi"] = compilerStack.contractABI(contractName);
 		if (isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "storageLayout", false))
@@ -1518,27 +1736,31 @@ Json StandardCompiler::compileSolidity(StandardCompiler::InputsAndSettings _inpu
 			contractData["devdoc"] = compilerStack.natspecDev(contractName);
 
 		// IR
-		if (compilationSuccess && isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "ir", wildcardMatchesExperimental))
+		if (codeGenerated && isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "ir", wildcardMatchesExperimental))
 			contractData["ir"] = compilerStack.yulIR(contractName);
-		if (compilationSuccess && isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "irAst", wildcardMatchesExperimental))
+		if (codeGenerated && isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "irAst", wildcardMatchesExperimental))
 			contractData["irAst"] = compilerStack.yulIRAst(contractName);
-		if (compilationSuccess && isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "irOptimized", wildcardMatchesExperimental))
+		if (codeGenerated && isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "irOptimized", wildcardMatchesExperimental))
 			contractData["irOptimized"] = compilerStack.yulIROptimized(contractName);
-		if (compilationSuccess && isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "irOptimizedAst", wildcardMatchesExperimental))
+		if (codeGenerated && isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "irOptimizedAst", wildcardMatchesExperimental))
 			contractData["irOptimizedAst"] = compilerStack.yulIROptimizedAst(contractName);
+		if (codeGenerated && isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "irOptimizedGasEstimates", wildcardMatchesExperimental))
+			contractData["irOptimizedGasEstimates"] = compilerStack.yulIROptimizedGasEstimates(contractName);
+		if (codeGenerated && isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "irOptimizerProfile", wildcardMatchesExperimental))
+			contractData["irOptimizerProfile"] = compilerStack.yulIROptimizerProfile(contractName);
 
 		// EVM
 		Json evmData;
-		if (compilationSuccess && isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "evm.assembly", wildcardMatchesExperimental))
+		if (codeGenerated && isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "evm.assembly", wildcardMatchesExperimental))
 			evmData["assembly"] = compilerStack.assemblyString(contractName, sourceList);
-		if (compilationSuccess && isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "evm.legacyAssembly", wildcardMatchesExperimental))
+		if (codeGenerated && isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "evm.legacyAssembly", wildcardMatchesExperimental))
 			evmData["legacyAssembly"] = compilerStack.assemblyJSON(contractName);
 		if (isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "evm.methodIdentifiers", wildcardMatchesExperimental))
 			evmData["methodIdentifiers"] = compilerStack.interfaceSymbols(contractName)["methods"];
-		if (compilationSuccess && isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "evm.gasEstimates", wildcardMatchesExperimental))
+		if (codeGenerated && isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "evm.gasEstimates", wildcardMatchesExperimental))
 			evmData["gasEstimates"] = compilerStack.gasEstimates(contractName);
 
-		if (compilationSuccess && isArtifactRequested(
+		if (codeGenerated && isArtifactRequested(
 			_inputsAndSettings.outputSelection,
 			file,
 			name,
@@ -1548,8 +1770,8 @@ Json StandardCompiler::compileSolidity(StandardCompiler::InputsAndSettings _inpu
 			evmData["bytecode"] = collectEVMObject(
 				_inputsAndSettings.evmVersion,
 				compilerStack.object(contractName),
-				compilerStack.sourceMapping(contractName),
-				compilerStack.generatedSources(contractName),
+				[&]() { return compilerStack.sourceMapping(contractName); },
+				[&]() { return compilerStack.generatedSources(contractName); },
 				false,
 				[&](std::string const& _element) { return isArtifactRequested(
 					_inputsAndSettings.outputSelection,
@@ -1560,7 +1782,7 @@ Json StandardCompiler::compileSolidity(StandardCompiler::InputsAndSettings _inpu
 				); }
 			);
 
-		if (compilationSuccess && isArtifactRequested(
+		if (codeGenerated && isArtifactRequested(
 			_inputsAndSettings.outputSelection,
 			file,
 			name,
@@ -1570,8 +1792,8 @@ Json StandardCompiler::compileSolidity(StandardCompiler::InputsAndSettings _inpu
 			evmData["deployedBytecode"] = collectEVMObject(
 				_inputsAndSettings.evmVersion,
 				compilerStack.runtimeObject(contractName),
-				compilerStack.runtimeSourceMapping(contractName),
-				compilerStack.generatedSources(contractName, true),
+				[&]() { return compilerStack.runtimeSourceMapping(contractName); },
+				[&]() { return compilerStack.generatedSources(contractName, true); },
 				true,
 				[&](std::string const& _element) { return isArtifactRequested(
 					_inputsAndSettings.outputSelection,
@@ -1585,16 +1807,92 @@ Json StandardCompiler::compileSolidity(StandardCompiler::InputsAndSettings _inpu
 		if (!evmData.empty())
 			contractData["evm"] = evmData;
 
-		if (!contractData.empty())
+		return contractData;
+	};
+
+	// When streaming, the members of the output are written in the order of their keys,
+	// which is the order in which they appear in the complete document.
+	if (_streamWriter)
+	{
+		_streamWriter->beginObject();
+		if (output.contains("auxiliaryInputRequested"))
+			_streamWriter->member("auxiliaryInputRequested", output["auxiliaryInputRequested"]);
+	}
+
+	std::vector<std::pair<std::string, std::string>> contracts;
+	for (std::string const& contractName: analysisSuccess ? compilerStack.contractNames() : std::vector<std::string>())
+	{
+		size_t colon = contractName.rfind(':');
+		solAssert(colon != std::string::npos, "");
+		contracts.emplace_back(contractName.substr(0, colon), contractName.substr(colon + 1));
+	}
+	std::sort(contracts.begin(), contracts.end());
+
+	Json contractsOutput;
+	std::optional<std::string> streamedFile;
+	for (auto const& [file, name]: contracts)
+	{
+		Json contractData = contractOutput(file, name);
+		if (contractData.empty())
+			continue;
+
+		if (!_streamWriter)
 		{
 			if (!contractsOutput.contains(file))
 				contractsOutput[file] = Json::object();
-			contractsOutput[file][name] = contractData;
+			contractsOutput[file][name] = std::move(contractData);
+			continue;
+		}
+
+		if (!streamedFile)
+			_streamWriter->beginObject("contracts");
+		if (streamedFile != file)
+		{
+			if (streamedFile)
+				_streamWriter->endObject();
+			_streamWriter->beginObject(file);
+			streamedFile = file;
 		}
+		_streamWriter->member(name, contractData);
 	}
 	if (!contractsOutput.empty())
 		output["contracts"] = contractsOutput;
 
+	if (_streamWriter)
+	{
+		if (streamedFile)
+		{
+			_streamWriter->endObject();
+			_streamWriter->endObject();
+		}
+		if (output.contains("errors"))
+			_streamWriter->member("errors", output["errors"]);
+		_streamWriter->beginObject("sources");
+	}
+	else
+		output["sources"] = Json::object();
+
+	unsigned sourceIndex = 0;
+	// NOTE: A case that will pass `parsingSuccess && !analysisFailed` but not `analysisSuccess` is
+	// stopAfter: parsing with no parsing errors.
+	if (parsingSuccess && !analysisFailed)
+		for (std::string const& sourceName: compilerStack.sourceNames())
+		{
+			Json sourceResult;
+			sourceResult["id"] = sourceIndex++;
+			if (isArtifactRequested(_inputsAndSettings.outputSelection, sourceName, "", "ast", wildcardMatchesExperimental))
+				sourceResult["ast"] = ASTJsonExporter(compilerStack.state(), compilerStack.sourceIndices()).toJson(compilerStack.ast(sourceName));
+			if (_streamWriter)
+				_streamWriter->member(sourceName, sourceResult);
+			else
+				output["sources"][sourceName] = std::move(sourceResult);
+		}
+
+	if (_streamWriter)
+	{
+		_streamWriter->endObject();
+		return Json();
+	}
 	return output;
 }
 
@@ -1652,6 +1950,7 @@ Json StandardCompiler::compileYul(InputsAndSettings _inputsAndSettings)
 			_inputsAndSettings.debugInfoSelection.value() :
 			DebugInfoSelection::Default()
 	);
+	stack.setParallelism(_inputsAndSettings.parallelism);
 	std::string const& sourceName = _inputsAndSettings.sources.begin()->first;
 	std::string const& sourceContents = _inputsAndSettings.sources.begin()->second;
 
@@ -1696,7 +1995,17 @@ Json StandardCompiler::compileYul(InputsAndSettings _inputsAndSettings)
 		sourceResult["ast"] = stack.astJson();
 		output["sources"][sourceName] = sourceResult;
 	}
+	stack.enableOptimizerProfiling(isOptimizerProfileRequested(_inputsAndSettings.outputSelection));
 	stack.optimize();
+	// There were no errors before, so these are warnings of the optimizer, e.g. about its time budget.
+	for (auto const& error: stack.errors())
+		output["errors"].emplace_back(formatErrorWithException(
+			stack,
+			*error,
+			error->type(),
+			"general",
+			""
+		));
 
 	MachineAssemblyObject object;
 	MachineAssemblyObject deployedObject;
@@ -1722,8 +2031,8 @@ Json StandardCompiler::compileYul(InputsAndSettings _inputsAndSettings)
 					collectEVMObject(
 						_inputsAndSettings.evmVersion,
 						*o.bytecode,
-						o.sourceMappings.get(),
-						Json::array(),
+						[&]() { return o.sourceMappings.get(); },
+						[]() { return Json::array(); },
 						isDeployed,
 						[&, kind = kind](std::string const& _element) { return isArtifactRequested(
 							_inputsAndSettings.outputSelection,
@@ -1737,6 +2046,10 @@ Json StandardCompiler::compileYul(InputsAndSettings _inputsAndSettings)
 
 	if (isArtifactRequested(_inputsAndSettings.outputSelection, sourceName, contractName, "irOptimized", wildcardMatchesExperimental))
 		output["contracts"][sourceName][contractName]["irOptimized"] = stack.print();
+	if (isArtifactRequested(_inputsAndSettings.outputSelection, sourceName, contractName, "irOptimizedGasEstimates", wildcardMatchesExperimental))
+		output["contracts"][sourceName][contractName]["irOptimizedGasEstimates"] = stack.functionGasEstimatesJson({{sourceName, 0}});
+	if (isArtifactRequested(_inputsAndSettings.outputSelection, sourceName, contractName, "irOptimizerProfile", wildcardMatchesExperimental))
+		output["contracts"][sourceName][contractName]["irOptimizerProfile"] = stack.optimizerProfilesJson();
 	if (isArtifactRequested(_inputsAndSettings.outputSelection, sourceName, contractName, "evm.assembly", wildcardMatchesExperimental))
 		output["contracts"][sourceName][contractName]["evm"]["assembly"] = object.assembly;
 
@@ -1744,25 +2057,47 @@ Json StandardCompiler::compileYul(InputsAndSettings _inputsAndSettings)
 }
 
 Json StandardCompiler::compile(Json const& _input) noexcept
+{
+	return compile(_input, nullptr);
+}
+
+Json StandardCompiler::compile(Json _input, util::JsonStreamWriter* _streamWriter) noexcept
 {
 	YulStringRepository::reset();
 
 	try
 	{
-		auto parsed = parseInput(_input);
+		auto parsed = parseInput(std::move(_input));
 		if (std::holds_alternative<Json>(parsed))
 			return std::get<Json>(std::move(parsed));
 		InputsAndSettings settings = std::get<InputsAndSettings>(std::move(parsed));
-		if (settings.language == "Solidity")
-			return compileSolidity(std::move(settings));
-		else if (settings.language == "Yul")
-			return compileYul(std::move(settings));
-		else if (settings.language == "SolidityAST")
-			return compileSolidity(std::move(settings));
-		else if (settings.language == "EVMAssembly")
-			return importEVMAssembly(std::move(settings));
-		else
-			return formatFatalError(Error::Type::JSONError, "Only \"Solidity\", \"Yul\", \"SolidityAST\" or \"EVMAssembly\" is supported as a language.");
+		std::shared_ptr<util::PhaseTracer> tracer = settings.tracer;
+		Json output;
+		{
+			util::PhaseTracer::Activation tracerActivation(tracer.get());
+			util::PhaseTracer::Scope tracerScope("StandardCompiler::compile");
+			if (settings.language == "Solidity")
+				output = compileSolidity(std::move(settings), _streamWriter);
+			else if (settings.language == "Yul")
+				output = compileYul(std::move(settings));
+			else if (settings.language == "SolidityAST")
+				output = compileSolidity(std::move(settings), _streamWriter);
+			else if (settings.language == "EVMAssembly")
+				output = importEVMAssembly(std::move(settings));
+			else
+				return formatFatalError(Error::Type::JSONError, "Only \"Solidity\", \"Yul\", \"SolidityAST\" or \"EVMAssembly\" is supported as a language.");
+		}
+		if (_streamWriter && _streamWriter->depth() > 0)
+		{
+			// The output has been streamed except for the members that follow.
+			if (tracer)
+				_streamWriter->member("trace", tracer->toJson());
+			_streamWriter->endObject();
+			return Json();
+		}
+		if (tracer)
+			output["trace"] = tracer->toJson();
+		return output;
 	}
 	catch (Json::parse_error const& _exception)
 	{
@@ -1816,7 +2151,7 @@ std::string StandardCompiler::compile(std::string const& _input) noexcept
 	}
 
 //	std::cout << "Input: " << solidity::util::jsonPrettyPrint(input) << std::endl;
-	Json output = compile(input);
+	Json output = compile(std::move(input), nullptr);
 //	std::cout << "Output: " << solidity::util::jsonPrettyPrint(output) << std::endl;
 
 	try
@@ -1829,6 +2164,83 @@ std::string StandardCompiler::compile(std::string const& _input) noexcept
 	}
 }
 
+std::string StandardCompiler::compileBatch(std::string const& _inputs) noexcept
+{
+	Json inputs;
+	std::string errors;
+	try
+	{
+		if (!util::jsonParseStrict(_inputs, inputs, &errors))
+			return util::jsonPrint(formatFatalError(Error::Type::JSONError, errors), m_jsonPrintingFormat);
+		if (!inputs.is_array())
+			return util::jsonPrint(
+				formatFatalError(Error::Type::JSONError, "Input must be an array of standard JSON inputs."),
+				m_jsonPrintingFormat
+			);
+	}
+	catch (...)
+	{
+		return "{\"errors\":[{\"type\":\"JSONError\",\"component\":\"general\",\"severity\":\"error\",\"message\":\"Error parsing input JSON.\"}]}";
+	}
+
+	try
+	{
+		Json outputs = Json::array();
+		for (Json& input: inputs)
+			outputs.emplace_back(compile(std::move(input), nullptr));
+		return util::jsonPrint(outputs, m_jsonPrintingFormat);
+	}
+	catch (...)
+	{
+		return "{\"errors\":[{\"type\":\"JSONError\",\"component\":\"general\",\"severity\":\"error\",\"message\":\"Error writing output JSON.\"}]}";
+	}
+}
+
+void StandardCompiler::compile(std::string const& _input, std::ostream& _output) noexcept
+{
+	Json input;
+	std::string errors;
+	try
+	{
+		if (!util::jsonParseStrict(_input, input, &errors))
+		{
+			_output << util::jsonPrint(formatFatalError(Error::Type::JSONError, errors), m_jsonPrintingFormat);
+			return;
+		}
+	}
+	catch (...)
+	{
+		_output << compile(_input);
+		return;
+	}
+
+	util::JsonStreamWriter writer(_output, m_jsonPrintingFormat);
+	Json output = compile(std::move(input), &writer);
+
+	try
+	{
+		if (writer.depth() == 0)
+		{
+			if (!output.is_null())
+				_output << util::jsonPrint(output, m_jsonPrintingFormat);
+		}
+		else
+		{
+			// Something went wrong after the output was partially written.
+			// Finish the document and report the error at its end.
+			solAssert(!output.is_null());
+			while (writer.depth() > 1)
+				writer.endObject();
+			writer.member("errors", output["errors"]);
+			writer.endObject();
+		}
+	}
+	catch (...)
+	{
+		_output << "{\"errors\":[{\"type\":\"JSONError\",\"component\":\"general\",\"severity\":\"error\",\"message\":\"Error writing output JSON.\"}]}";
+	}
+}
+
 Json StandardCompiler::formatFunctionDebugData(
 	std::map<std::string, evmasm::LinkerObject::FunctionDebugData> const& _debugInfo
 )
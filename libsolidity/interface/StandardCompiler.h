@@ -25,10 +25,12 @@
 
 #include <libsolidity/interface/CompilerStack.h>
 #include <libsolutil/JSON.h>
+#include <libsolutil/PhaseTracer.h>
 
 #include <liblangutil/DebugInfoSelection.h>
 
 #include <optional>
+#include <ostream>
 #include <utility>
 #include <variant>
 
@@ -62,6 +64,16 @@ public:
 	/// Parses input as JSON and performs the above processing steps, returning a serialized JSON
 	/// output. Parsing errors are returned as regular errors.
 	std::string compile(std::string const& _input) noexcept;
+	/// Performs the same processing steps as above, but writes the serialized output to @a _output
+	/// while it is produced. The output of each contract and source is written as soon as it is
+	/// available, so that the complete output is never held in memory. The output is the same
+	/// except when an internal error happens after a part has been written already. The error
+	/// is then reported in an additional "errors" member at the end.
+	void compile(std::string const& _input, std::ostream& _output) noexcept;
+	/// Parses @a _inputs as a JSON array of standardized inputs, compiles each of them like the
+	/// overloads above and returns the serialized array of their outputs in the same order.
+	/// If @a _inputs is not an array, returns a single output containing the error instead.
+	std::string compileBatch(std::string const& _inputs) noexcept;
 
 	static Json formatFunctionDebugData(
 		std::map<std::string, evmasm::LinkerObject::FunctionDebugData> const& _debugInfo
@@ -89,15 +101,33 @@ private:
 		Json outputSelection;
 		ModelCheckerSettings modelCheckerSettings = ModelCheckerSettings{};
 		bool viaIR = false;
+		size_t parallelism = 1;
+		/// Whether missing imports are requested from the read callback in batches.
+		bool batchImportReads = false;
+		/// Paths requested from the read callback along with the first imports.
+		std::vector<std::string> importPrefetchHints;
+		/// Keccak-256 hashes of the metadata of contracts from a previous compilation by source and
+		/// contract name. No code is generated for contracts whose metadata has the same hash now.
+		std::map<std::string, std::map<std::string, util::h256>> previousMetadataHashes;
+		/// Set if the time spent in the phases of the compilation was requested in the output.
+		std::shared_ptr<util::PhaseTracer> tracer;
 	};
 
 	/// Parses the input json (and potentially invokes the read callback) and either returns
 	/// it in condensed form or an error as a json object.
-	std::variant<InputsAndSettings, Json> parseInput(Json const& _input);
+	/// The source contents are moved out of @a _input instead of being copied.
+	std::variant<InputsAndSettings, Json> parseInput(Json _input);
+
+	/// Compiles like the public overload and, if @a _streamWriter is given, streams the output of
+	/// Solidity compilations to it. Returns a null value if the output has been written completely.
+	/// Takes the input by value, so that the overloads that parse it themselves can move it in.
+	Json compile(Json _input, util::JsonStreamWriter* _streamWriter) noexcept;
 
 	std::map<std::string, Json> parseAstFromInput(StringMap const& _sources);
 	Json importEVMAssembly(InputsAndSettings _inputsAndSettings);
-	Json compileSolidity(InputsAndSettings _inputsAndSettings);
+	/// Compiles the input and, if @a _streamWriter is given, writes the output to it.
+	/// Returns a null value if the output was written and leaves the root object open in that case.
+	Json compileSolidity(InputsAndSettings _inputsAndSettings, util::JsonStreamWriter* _streamWriter = nullptr);
 	Json compileYul(InputsAndSettings _inputsAndSettings);
 
 	ReadCallback::Callback m_readFile;
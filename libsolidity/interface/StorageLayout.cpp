@@ -63,11 +63,12 @@ Json StorageLayout::generate(VariableDeclaration const& _var, u256 const& _slot,
 
 void StorageLayout::generate(Type const* _type)
 {
-	if (m_types.contains(typeKeyName(_type)))
+	std::string const typeKey = typeKeyName(_type);
+	if (m_types.contains(typeKey))
 		return;
 
 	// Register it now to cut recursive visits.
-	Json& typeInfo = m_types[typeKeyName(_type)];
+	Json& typeInfo = m_types[typeKey];
 	typeInfo["label"] = _type->toString(true);
 	typeInfo["numberOfBytes"] = u256(_type->storageBytes() * _type->storageSize()).str();
 
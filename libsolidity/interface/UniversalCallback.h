@@ -41,6 +41,9 @@ public:
 				return ReadCallback::Result{false, "No import callback."};
 			else
 				return m_fileReader->readFile(_kind, _data);
+		else if (_kind == ReadCallback::kindString(ReadCallback::Kind::ReadFiles))
+			// Local files are not worth batching, the compiler falls back to reading them one by one.
+			return ReadCallback::Result{false, "Batched reads are not supported."};
 		else if (_kind == ReadCallback::kindString(ReadCallback::Kind::SMTQuery))
 			return m_solver.solve(_kind, _data);
 		solAssert(false, "Unknown callback kind.");
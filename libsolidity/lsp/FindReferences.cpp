@@ -0,0 +1,53 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+#include <libsolidity/lsp/FindReferences.h>
+#include <libsolidity/lsp/ReferenceIndex.h>
+#include <libsolidity/lsp/Transport.h> // for RequestError
+#include <libsolidity/lsp/Utils.h>
+
+#include <libsolidity/ast/AST.h>
+
+#include <vector>
+
+using namespace solidity::frontend;
+using namespace solidity::langutil;
+using namespace solidity::lsp;
+
+void FindReferences::operator()(MessageID _id, Json const& _args)
+{
+	auto const [sourceUnitName, lineColumn] = extractSourceUnitNameAndLineColumn(_args);
+	bool const includeDeclaration =
+		_args.contains("context") &&
+		_args["context"].value("includeDeclaration", false);
+
+	Json reply = Json::array();
+
+	auto const [sourceNode, cursorBytePosition] = m_server.astNodeAndOffsetAtSourceLocation(sourceUnitName, lineColumn);
+	if (sourceNode)
+		if (NamedDeclaration const declaration = namedDeclarationAt(*sourceNode, cursorBytePosition); declaration.declaration)
+		{
+			std::vector<SourceLocation> locations = m_server.referenceIndex().locations(declaration);
+			sort(locations.begin(), locations.end());
+			locations.erase(unique(locations.begin(), locations.end()), locations.end());
+			for (SourceLocation const& location: locations)
+				if (includeDeclaration || location != declaration.declaration->nameLocation())
+					reply.emplace_back(toJson(location));
+		}
+
+	client().reply(_id, reply);
+}
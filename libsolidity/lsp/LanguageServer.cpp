@@ -26,6 +26,7 @@
 
 // LSP feature implementations
 #include <libsolidity/lsp/DocumentHoverHandler.h>
+#include <libsolidity/lsp/FindReferences.h>
 #include <libsolidity/lsp/GotoDefinition.h>
 #include <libsolidity/lsp/RenameSymbol.h>
 #include <libsolidity/lsp/SemanticTokensBuilder.h>
@@ -148,11 +149,20 @@ LanguageServer::LanguageServer(Transport& _transport):
 		{"textDocument/hover", DocumentHoverHandler(*this) },
 		{"textDocument/rename", RenameSymbol(*this) },
 		{"textDocument/implementation", GotoDefinition(*this) },
+		{"textDocument/references", FindReferences(*this) },
 		{"textDocument/semanticTokens/full", std::bind(&LanguageServer::semanticTokensFull, this, _1, _2)},
+		{"textDocument/semanticTokens/full/delta", std::bind(&LanguageServer::semanticTokensFullDelta, this, _1, _2)},
+		{"textDocument/semanticTokens/range", std::bind(&LanguageServer::semanticTokensRange, this, _1, _2)},
 		{"workspace/didChangeConfiguration", std::bind(&LanguageServer::handleWorkspaceDidChangeConfiguration, this, _2)},
+		{"workspace/didChangeWatchedFiles", std::bind(&LanguageServer::handleWorkspaceDidChangeWatchedFiles, this, _2)},
 	},
 	m_fileRepository("/" /* basePath */, {} /* no search paths */),
-	m_compilerStack{m_fileRepository.reader()}
+	m_compilerStack{[this](std::string const& _kind, std::string const& _path) {
+		ReadCallback::Result result = m_fileRepository.readFile(_kind, _path);
+		if (!result.success)
+			m_failedToReadSources = true;
+		return result;
+	}}
 {
 }
 
@@ -168,6 +178,9 @@ Json LanguageServer::toJson(SourceLocation const& _location)
 
 void LanguageServer::changeConfiguration(Json const& _settings)
 {
+	m_compiledSources.reset();
+	m_projectFiles.reset();
+
 	// The settings item: "file-load-strategy" (enum) defaults to "project-directory" if not (or not correctly) set.
 	// It can be overridden during client's handshake or at runtime, as usual.
 	//
@@ -246,13 +259,10 @@ void LanguageServer::compile()
 
 	// Load all solidity files from project.
 	if (m_fileLoadStrategy == FileLoadStrategy::ProjectDirectory)
-		for (auto const& projectFile: allSolidityFilesFromProject())
+		for (auto const& [uri, content]: projectFiles())
 		{
-			lspDebug(fmt::format("adding project file: {}", projectFile.generic_string()));
-			m_fileRepository.setSourceByUri(
-				m_fileRepository.sourceUnitNameToUri(projectFile.generic_string()),
-				util::readFileAsString(projectFile)
-			);
+			lspDebug(fmt::format("adding project file: {}", uri));
+			m_fileRepository.setSourceByUri(uri, content);
 		}
 
 	// Overwrite all files as opened by the client, including the ones which might potentially have changes.
@@ -262,15 +272,70 @@ void LanguageServer::compile()
 			oldRepository.sourceUnits().at(oldRepository.uriToSourceUnitName(fileName))
 		);
 
-	// TODO: optimize! do not recompile if nothing has changed (file(s) not flagged dirty).
+	if (compiledSourcesUpToDate())
+	{
+		lspDebug("sources unchanged, skipping compilation");
+		return;
+	}
 
+	m_failedToReadSources = false;
+	m_locationIndices.clear();
+	m_referenceIndex.reset();
 	m_compilerStack.reset(false);
 	m_compilerStack.setSources(m_fileRepository.sourceUnits());
 	m_compilerStack.compile(CompilerStack::State::AnalysisSuccessful);
+
+	// A missing import may be created at any time, so we do not know whether the sources change.
+	if (m_failedToReadSources)
+		m_compiledSources.reset();
+	else
+		// Now also contains the sources loaded through the import callback.
+		m_compiledSources = m_fileRepository.sourceUnits();
+}
+
+StringMap const& LanguageServer::projectFiles()
+{
+	if (!m_projectFiles || !m_clientWatchesFiles)
+	{
+		m_projectFiles.emplace();
+		for (auto const& projectFile: allSolidityFilesFromProject())
+			(*m_projectFiles)[m_fileRepository.sourceUnitNameToUri(projectFile.generic_string())] =
+				util::readFileAsString(projectFile);
+	}
+	return *m_projectFiles;
+}
+
+bool LanguageServer::compiledSourcesUpToDate()
+{
+	if (!m_compiledSources.has_value())
+		return false;
+
+	for (auto const& [sourceUnitName, content]: m_fileRepository.sourceUnits())
+	{
+		auto it = m_compiledSources->find(sourceUnitName);
+		if (it == m_compiledSources->end() || it->second != content)
+			return false;
+	}
+
+	// Sources loaded through the import callback during the last compilation have to be
+	// loaded again to detect changes on disk.
+	for (auto const& [sourceUnitName, content]: *m_compiledSources)
+		if (!m_fileRepository.sourceUnits().count(sourceUnitName))
+		{
+			ReadCallback::Result result = m_fileRepository.readFile(
+				ReadCallback::kindString(ReadCallback::Kind::ReadFile),
+				sourceUnitName
+			);
+			if (!result.success || result.responseOrErrorMessage != content)
+				return false;
+		}
+
+	return true;
 }
 
 void LanguageServer::compileAndUpdateDiagnostics()
 {
+	m_diagnosticsOutdated = false;
 	compile();
 
 	// These are the source units we will sent diagnostics to the client for sure,
@@ -336,17 +401,34 @@ bool LanguageServer::run()
 		MessageID id;
 		try
 		{
+			if (m_diagnosticsOutdated && !m_client.hasPendingInput())
+				compileAndUpdateDiagnostics();
+
 			std::optional<Json> const jsonMessage = m_client.receive();
 			if (!jsonMessage)
 				continue;
 
-			if ((*jsonMessage).contains("method") && (*jsonMessage)["method"].is_string())
+			if (!(*jsonMessage).contains("method") && (*jsonMessage).contains("id"))
+			{
+				// Response to one of our requests.
+				lspDebug(fmt::format("received response: {}", util::jsonCompactPrint(*jsonMessage)));
+				if ((*jsonMessage)["id"] == "register-watched-files" && (*jsonMessage).contains("error"))
+				{
+					m_clientWatchesFiles = false;
+					m_projectFiles.reset();
+				}
+			}
+			else if ((*jsonMessage).contains("method") && (*jsonMessage)["method"].is_string())
 			{
 				std::string const methodName = (*jsonMessage)["method"].get<std::string>();
 				if ((*jsonMessage).contains("id"))
 					id = (*jsonMessage)["id"];
 				lspDebug(fmt::format("received method call: {}", methodName));
 
+				// All other messages have to see the changes.
+				if (m_diagnosticsOutdated && methodName != "textDocument/didChange")
+					compileAndUpdateDiagnostics();
+
 				if (auto handler = util::valueOrDefault(m_handlers, methodName))
 					handler(id, (*jsonMessage)["params"]);
 				else
@@ -413,6 +495,15 @@ void LanguageServer::handleInitialize(MessageID _id, Json const& _args)
 	if (_args.contains("initializationOptions") && _args["initializationOptions"].is_object())
 		changeConfiguration(_args["initializationOptions"]);
 
+	Json const* watchedFiles = nullptr;
+	if (_args.contains("capabilities") && _args["capabilities"].contains("workspace"))
+		if (Json const& workspace = _args["capabilities"]["workspace"]; workspace.contains("didChangeWatchedFiles"))
+			watchedFiles = &workspace["didChangeWatchedFiles"];
+	m_clientWatchesFiles =
+		watchedFiles &&
+		watchedFiles->contains("dynamicRegistration") &&
+		(*watchedFiles)["dynamicRegistration"] == true;
+
 	Json replyArgs;
 	replyArgs["serverInfo"]["name"] = "solc";
 	replyArgs["serverInfo"]["version"] = std::string(VersionNumber);
@@ -421,9 +512,10 @@ void LanguageServer::handleInitialize(MessageID _id, Json const& _args)
 	replyArgs["capabilities"]["textDocumentSync"]["change"] = 2; // 0=none, 1=full, 2=incremental
 	replyArgs["capabilities"]["textDocumentSync"]["openClose"] = true;
 	replyArgs["capabilities"]["semanticTokensProvider"]["legend"] = semanticTokensLegend();
-	replyArgs["capabilities"]["semanticTokensProvider"]["range"] = false;
-	replyArgs["capabilities"]["semanticTokensProvider"]["full"] = true; // XOR requests.full.delta = true
+	replyArgs["capabilities"]["semanticTokensProvider"]["range"] = true;
+	replyArgs["capabilities"]["semanticTokensProvider"]["full"]["delta"] = true;
 	replyArgs["capabilities"]["renameProvider"] = true;
+	replyArgs["capabilities"]["referencesProvider"] = true;
 	replyArgs["capabilities"]["hoverProvider"] = true;
 
 	m_client.reply(_id, std::move(replyArgs));
@@ -431,30 +523,123 @@ void LanguageServer::handleInitialize(MessageID _id, Json const& _args)
 
 void LanguageServer::handleInitialized(MessageID, Json const&)
 {
+	if (m_clientWatchesFiles)
+	{
+		// Without this registration the client does not send any notifications on file changes.
+		Json watcher;
+		watcher["globPattern"] = "**/*.sol";
+		Json registration;
+		registration["id"] = "solidity-files";
+		registration["method"] = "workspace/didChangeWatchedFiles";
+		registration["registerOptions"]["watchers"] = Json::array({watcher});
+		Json params;
+		params["registrations"] = Json::array({registration});
+		m_client.request("register-watched-files", "client/registerCapability", std::move(params));
+	}
+
 	if (m_fileLoadStrategy == FileLoadStrategy::ProjectDirectory)
 		compileAndUpdateDiagnostics();
 }
 
+std::pair<std::string, Json> const& LanguageServer::buildSemanticTokens(Json const& _args)
+{
+	lspRequire(
+		_args.contains("textDocument") && _args["textDocument"].contains("uri"),
+		ErrorCode::InvalidParams,
+		"Invalid parameter: textDocument.uri expected."
+	);
+	std::string const uri = _args["textDocument"]["uri"].get<std::string>();
+
+	compile();
+
+	auto const sourceName = m_fileRepository.uriToSourceUnitName(uri);
+	Json data = SemanticTokensBuilder().build(m_compilerStack.ast(sourceName), m_compilerStack.charStream(sourceName));
+	return m_semanticTokens[uri] = std::make_pair(std::to_string(m_nextSemanticTokensResultId++), std::move(data));
+}
+
 void LanguageServer::semanticTokensFull(MessageID _id, Json const& _args)
 {
-	if (_args.contains("textDocument") && _args["textDocument"].contains("uri"))
-	{
-		auto uri = _args["textDocument"]["uri"];
+	auto const& [resultId, data] = buildSemanticTokens(_args);
 
-		compile();
+	Json reply;
+	reply["resultId"] = resultId;
+	reply["data"] = data;
 
-		auto const sourceName = m_fileRepository.uriToSourceUnitName(uri.get<std::string>());
-		SourceUnit const& ast = m_compilerStack.ast(sourceName);
-		m_compilerStack.charStream(sourceName);
-		Json data = SemanticTokensBuilder().build(ast, m_compilerStack.charStream(sourceName));
+	m_client.reply(_id, std::move(reply));
+}
 
-		Json reply;
-		reply["data"] = data;
+void LanguageServer::semanticTokensFullDelta(MessageID _id, Json const& _args)
+{
+	std::optional<Json> previousData;
+	if (_args.contains("textDocument") && _args["textDocument"].contains("uri") && _args.contains("previousResultId"))
+		if (
+			auto previous = m_semanticTokens.find(_args["textDocument"]["uri"].get<std::string>());
+			previous != m_semanticTokens.end() && _args["previousResultId"] == previous->second.first
+		)
+			previousData = std::move(previous->second.second);
 
+	auto const& [resultId, data] = buildSemanticTokens(_args);
+
+	Json reply;
+	reply["resultId"] = resultId;
+	if (!previousData)
+	{
+		reply["data"] = data;
 		m_client.reply(_id, std::move(reply));
+		return;
 	}
-	else
-		m_client.error(_id, ErrorCode::InvalidParams, "Invalid parameter: textDocument.uri expected.");
+
+	// A single edit replacing everything between the common prefix and the common suffix.
+	// The tokens are encoded relative to their predecessor, so an edit in the source
+	// usually only changes the tokens around it.
+	size_t prefix = 0;
+	while (prefix < previousData->size() && prefix < data.size() && (*previousData)[prefix] == data[prefix])
+		++prefix;
+	size_t suffix = 0;
+	while (
+		suffix < previousData->size() - prefix &&
+		suffix < data.size() - prefix &&
+		(*previousData)[previousData->size() - 1 - suffix] == data[data.size() - 1 - suffix]
+	)
+		++suffix;
+
+	Json edits = Json::array();
+	if (prefix + suffix != previousData->size() || prefix + suffix != data.size())
+	{
+		Json edit;
+		edit["start"] = prefix;
+		edit["deleteCount"] = previousData->size() - prefix - suffix;
+		edit["data"] = Json::array();
+		for (size_t i = prefix; i < data.size() - suffix; ++i)
+			edit["data"].push_back(data[i]);
+		edits.push_back(std::move(edit));
+	}
+	reply["edits"] = std::move(edits);
+
+	m_client.reply(_id, std::move(reply));
+}
+
+void LanguageServer::semanticTokensRange(MessageID _id, Json const& _args)
+{
+	lspRequire(
+		_args.contains("textDocument") && _args["textDocument"].contains("uri") && _args.contains("range"),
+		ErrorCode::InvalidParams,
+		"Invalid parameters: textDocument.uri and range expected."
+	);
+
+	compile();
+
+	auto const sourceName = m_fileRepository.uriToSourceUnitName(_args["textDocument"]["uri"].get<std::string>());
+	std::optional<SourceLocation> range = parseRange(m_fileRepository, sourceName, _args["range"]);
+	lspRequire(range.has_value(), ErrorCode::InvalidParams, "Invalid source range.");
+
+	Json reply;
+	reply["data"] = SemanticTokensBuilder().build(
+		m_compilerStack.ast(sourceName),
+		m_compilerStack.charStream(sourceName),
+		range
+	);
+	m_client.reply(_id, std::move(reply));
 }
 
 void LanguageServer::handleWorkspaceDidChangeConfiguration(Json const& _args)
@@ -465,6 +650,15 @@ void LanguageServer::handleWorkspaceDidChangeConfiguration(Json const& _args)
 		changeConfiguration(_args["settings"]);
 }
 
+void LanguageServer::handleWorkspaceDidChangeWatchedFiles(Json const&)
+{
+	requireServerInitialized();
+
+	// Files may have been created or deleted, so the whole project is loaded again.
+	m_projectFiles.reset();
+	m_diagnosticsOutdated = true;
+}
+
 void LanguageServer::setTrace(Json const& _args)
 {
 	if (!_args.is_string())
@@ -543,7 +737,7 @@ void LanguageServer::handleTextDocumentDidChange(Json const& _args)
 				}
 			}
 
-		compileAndUpdateDiagnostics();
+		m_diagnosticsOutdated = true;
 	}
 }
 
@@ -582,5 +776,21 @@ std::tuple<ASTNode const*, int> LanguageServer::astNodeAndOffsetAtSourceLocation
 	if (!sourcePos)
 		return {nullptr, -1};
 
-	return {locateInnermostASTNode(*sourcePos, m_compilerStack.ast(_sourceUnitName)), *sourcePos};
+	auto index = m_locationIndices.find(_sourceUnitName);
+	if (index == m_locationIndices.end())
+		index = m_locationIndices.emplace(_sourceUnitName, m_compilerStack.ast(_sourceUnitName)).first;
+	return {index->second.innermostNode(*sourcePos), *sourcePos};
+}
+
+ReferenceIndex const& LanguageServer::referenceIndex()
+{
+	solAssert(m_compilerStack.state() >= CompilerStack::AnalysisSuccessful);
+	if (!m_referenceIndex)
+	{
+		std::vector<SourceUnit const*> sourceUnits;
+		for (std::string const& sourceName: m_compilerStack.sourceNames())
+			sourceUnits.emplace_back(&m_compilerStack.ast(sourceName));
+		m_referenceIndex.emplace(sourceUnits);
+	}
+	return *m_referenceIndex;
 }
@@ -19,6 +19,8 @@
 
 #include <libsolidity/lsp/Transport.h>
 #include <libsolidity/lsp/FileRepository.h>
+#include <libsolidity/lsp/ReferenceIndex.h>
+#include <libsolidity/ast/ASTUtils.h>
 #include <libsolidity/interface/CompilerStack.h>
 #include <libsolidity/interface/FileReader.h>
 
@@ -80,6 +82,9 @@ public:
 	std::tuple<frontend::ASTNode const*, int> astNodeAndOffsetAtSourceLocation(std::string const& _sourceUnitName, langutil::LineColumn const& _filePos);
 	frontend::ASTNode const* astNodeAtSourceLocation(std::string const& _sourceUnitName, langutil::LineColumn const& _filePos);
 	frontend::CompilerStack const& compilerStack() const noexcept { return m_compilerStack; }
+	/// @returns the index of all references to declarations in the last compilation,
+	/// created on first use.
+	ReferenceIndex const& referenceIndex();
 
 private:
 	/// Checks if the server is initialized (to be used by messages that need it to be initialized).
@@ -88,6 +93,7 @@ private:
 	void handleInitialize(MessageID _id, Json const& _args);
 	void handleInitialized(MessageID _id, Json const& _args);
 	void handleWorkspaceDidChangeConfiguration(Json const& _args);
+	void handleWorkspaceDidChangeWatchedFiles(Json const& _args);
 	void setTrace(Json const& _args);
 	void handleTextDocumentDidOpen(Json const& _args);
 	void handleTextDocumentDidChange(Json const& _args);
@@ -95,14 +101,26 @@ private:
 	void handleRename(Json const& _args);
 	void handleGotoDefinition(MessageID _id, Json const& _args);
 	void semanticTokensFull(MessageID _id, Json const& _args);
+	void semanticTokensFullDelta(MessageID _id, Json const& _args);
+	void semanticTokensRange(MessageID _id, Json const& _args);
+	/// @returns the semantic tokens of the given document with a new result ID and stores
+	/// them as the last result for it. Throws if the arguments do not refer to a document.
+	std::pair<std::string, Json> const& buildSemanticTokens(Json const& _args);
 
 	/// Invoked when the server user-supplied configuration changes (initiated by the client).
 	void changeConfiguration(Json const&);
 
 	/// Compile everything until after analysis phase.
+	/// Does nothing if neither the sources nor the configuration changed since the last compilation.
 	void compile();
+	/// @returns true if the current sources are the ones used in the last compilation.
+	/// Loads the sources that were loaded through the import callback during that compilation.
+	bool compiledSourcesUpToDate();
 
 	std::vector<boost::filesystem::path> allSolidityFilesFromProject() const;
+	/// @returns the contents of all Solidity files in the project directory by their URI.
+	/// They are read again from disk unless the client watches them for us.
+	StringMap const& projectFiles();
 
 	using MessageHandler = std::function<void(MessageID, Json const&)>;
 
@@ -123,8 +141,28 @@ private:
 	std::set<std::string> m_nonemptyDiagnostics;
 	FileRepository m_fileRepository;
 	FileLoadStrategy m_fileLoadStrategy = FileLoadStrategy::ProjectDirectory;
+	/// Whether the client notifies us of changes to the Solidity files in the project directory.
+	bool m_clientWatchesFiles = false;
+	/// Contents of the project files as loaded by projectFiles().
+	std::optional<StringMap> m_projectFiles;
 
 	frontend::CompilerStack m_compilerStack;
+	/// All sources used in the last compilation or nullopt if the next compilation must not be skipped.
+	std::optional<StringMap> m_compiledSources;
+	/// The last semantic tokens sent for each document (by URI) together with their result ID,
+	/// used to send only the difference on the next request.
+	std::map<std::string, std::pair<std::string, Json>> m_semanticTokens;
+	size_t m_nextSemanticTokensResultId = 0;
+	/// Location indices of the source units of the last compilation, created on first use.
+	std::map<std::string, frontend::ASTNodeLocationIndex> m_locationIndices;
+	/// Reference index of the last compilation, created on first use.
+	std::optional<ReferenceIndex> m_referenceIndex;
+	/// Whether the import callback failed to load a source during the current compilation.
+	bool m_failedToReadSources = false;
+	/// Whether documents changed since the diagnostics were last updated. Changes are only
+	/// compiled once no further message is waiting, so that a burst of changes while typing
+	/// results in a single compilation.
+	bool m_diagnosticsOutdated = false;
 
 	/// User-supplied custom configuration settings (such as EVM version).
 	Json m_settingsObject;
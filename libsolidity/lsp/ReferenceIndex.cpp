@@ -0,0 +1,226 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+#include <libsolidity/lsp/ReferenceIndex.h>
+
+#include <libsolidity/ast/AST.h>
+#include <libsolidity/ast/ASTVisitor.h>
+
+#include <libyul/AST.h>
+
+using namespace solidity::frontend;
+using namespace solidity::langutil;
+using namespace solidity::lsp;
+
+namespace
+{
+
+using LocationMap = std::map<std::pair<Declaration const*, std::string>, std::vector<SourceLocation>>;
+
+CallableDeclaration const* extractCallableDeclaration(FunctionCall const& _functionCall)
+{
+	if (
+		auto const* functionType = dynamic_cast<FunctionType const*>(_functionCall.expression().annotation().type);
+		functionType && functionType->hasDeclaration()
+	)
+		if (auto const* functionDefinition = dynamic_cast<FunctionDefinition const*>(&functionType->declaration()))
+			return functionDefinition;
+
+	return nullptr;
+}
+
+/// @returns the name of an inline assembly identifier referring to a Solidity declaration
+/// and its location, both without a suffix like `.slot`.
+std::pair<std::string, SourceLocation> externalReferenceNameAndLocation(
+	solidity::yul::Identifier const& _identifier,
+	InlineAssemblyAnnotation::ExternalIdentifierInfo const& _externalReference
+)
+{
+	std::string name = _identifier.name.str();
+	if (!_externalReference.suffix.empty())
+		name = name.substr(0, name.length() - _externalReference.suffix.size() - 1);
+	SourceLocation location = solidity::yul::nativeLocationOf(_identifier);
+	location.end -= static_cast<int>(_externalReference.suffix.size() + 1);
+	return {std::move(name), std::move(location)};
+}
+
+class ReferenceCollector: public ASTConstVisitor
+{
+public:
+	explicit ReferenceCollector(LocationMap& _locations): m_locations(_locations) {}
+
+	void endVisit(ImportDirective const& _node) override
+	{
+		// Handles SourceUnit aliases
+		addDeclaration(_node);
+
+		for (ImportDirective::SymbolAlias const& symbolAlias: _node.symbolAliases())
+			if (symbolAlias.alias)
+				add(symbolAlias.symbol->annotation().referencedDeclaration, *symbolAlias.alias, symbolAlias.location);
+	}
+	void endVisit(MemberAccess const& _node) override
+	{
+		add(_node.annotation().referencedDeclaration, _node.memberName(), _node.memberLocation());
+	}
+	void endVisit(Identifier const& _node) override
+	{
+		add(_node.annotation().referencedDeclaration, _node.name(), _node.location());
+	}
+	void endVisit(IdentifierPath const& _node) override
+	{
+		std::vector<Declaration const*> const& declarations = _node.annotation().pathDeclarations;
+		if (declarations.size() != _node.path().size())
+			// Analysis did not finish.
+			return;
+		for (size_t i = 0; i < _node.path().size(); i++)
+			add(declarations[i], _node.path()[i], _node.pathLocations()[i]);
+	}
+	void endVisit(FunctionCall const& _node) override
+	{
+		CallableDeclaration const* functionDefinition = extractCallableDeclaration(_node);
+		if (!functionDefinition)
+			return;
+		for (size_t i = 0; i < _node.names().size(); i++)
+			if (_node.names()[i])
+				for (ASTPointer<VariableDeclaration> const& parameter: functionDefinition->parameters())
+					if (parameter && parameter->name() == *_node.names()[i])
+						add(parameter.get(), *_node.names()[i], _node.nameLocations()[i]);
+	}
+	void endVisit(InlineAssembly const& _node) override
+	{
+		for (auto&& [identifier, externalReference]: _node.annotation().externalReferences)
+		{
+			auto [name, location] = externalReferenceNameAndLocation(*identifier, externalReference);
+			add(externalReference.declaration, name, location);
+		}
+	}
+
+	void endVisit(ContractDefinition const& _node) override { addDeclaration(_node); }
+	void endVisit(StructDefinition const& _node) override { addDeclaration(_node); }
+	void endVisit(EnumDefinition const& _node) override { addDeclaration(_node); }
+	void endVisit(EnumValue const& _node) override { addDeclaration(_node); }
+	void endVisit(UserDefinedValueTypeDefinition const& _node) override { addDeclaration(_node); }
+	void endVisit(VariableDeclaration const& _node) override { addDeclaration(_node); }
+	void endVisit(FunctionDefinition const& _node) override { addDeclaration(_node); }
+	void endVisit(ModifierDefinition const& _node) override { addDeclaration(_node); }
+	void endVisit(EventDefinition const& _node) override { addDeclaration(_node); }
+	void endVisit(ErrorDefinition const& _node) override { addDeclaration(_node); }
+
+private:
+	void addDeclaration(Declaration const& _declaration)
+	{
+		add(&_declaration, _declaration.name(), _declaration.nameLocation());
+	}
+	void add(Declaration const* _declaration, std::string const& _name, SourceLocation const& _location)
+	{
+		if (_declaration && !_name.empty() && _location.isValid())
+			m_locations[{_declaration, _name}].emplace_back(_location);
+	}
+
+	LocationMap& m_locations;
+};
+
+NamedDeclaration namedDeclarationAt(ImportDirective const& _importDirective, int _cursorBytePosition)
+{
+	for (ImportDirective::SymbolAlias const& symbolAlias: _importDirective.symbolAliases())
+		if (symbolAlias.location.containsOffset(_cursorBytePosition))
+		{
+			solAssert(symbolAlias.alias);
+			return {symbolAlias.symbol->annotation().referencedDeclaration, *symbolAlias.alias};
+		}
+	return {};
+}
+
+NamedDeclaration namedDeclarationAt(FunctionCall const& _functionCall, int _cursorBytePosition)
+{
+	if (auto const* functionDefinition = extractCallableDeclaration(_functionCall))
+		for (size_t i = 0; i < _functionCall.names().size(); i++)
+			if (_functionCall.nameLocations()[i].containsOffset(_cursorBytePosition))
+			{
+				NamedDeclaration result{nullptr, *_functionCall.names()[i]};
+				for (ASTPointer<VariableDeclaration> const& parameter: functionDefinition->parameters())
+					if (parameter && parameter->name() == result.name)
+						result.declaration = parameter.get();
+				return result;
+			}
+	return {};
+}
+
+NamedDeclaration namedDeclarationAt(IdentifierPath const& _identifierPath, int _cursorBytePosition)
+{
+	// iterate through the elements of the path to find the one the cursor is on
+	size_t numIdentifiers = _identifierPath.pathLocations().size();
+	for (size_t i = 0; i < numIdentifiers; i++)
+		if (_identifierPath.pathLocations()[i].containsOffset(_cursorBytePosition))
+		{
+			solAssert(_identifierPath.annotation().pathDeclarations.size() == numIdentifiers);
+			solAssert(_identifierPath.path().size() == numIdentifiers);
+
+			return {_identifierPath.annotation().pathDeclarations[i], _identifierPath.path()[i]};
+		}
+	return {};
+}
+
+NamedDeclaration namedDeclarationAt(InlineAssembly const& _inlineAssembly, int _cursorBytePosition)
+{
+	for (auto&& [identifier, externalReference]: _inlineAssembly.annotation().externalReferences)
+	{
+		auto [name, location] = externalReferenceNameAndLocation(*identifier, externalReference);
+		if (location.containsOffset(_cursorBytePosition))
+			return {externalReference.declaration, std::move(name)};
+	}
+	return {};
+}
+
+}
+
+NamedDeclaration solidity::lsp::namedDeclarationAt(ASTNode const& _node, int _cursorBytePosition)
+{
+	if (auto const* declaration = dynamic_cast<Declaration const*>(&_node))
+	{
+		if (declaration->nameLocation().containsOffset(_cursorBytePosition))
+			return {declaration, declaration->name()};
+		else if (auto const* importDirective = dynamic_cast<ImportDirective const*>(declaration))
+			return namedDeclarationAt(*importDirective, _cursorBytePosition);
+	}
+	else if (auto const* identifier = dynamic_cast<Identifier const*>(&_node))
+		return {identifier->annotation().referencedDeclaration, identifier->name()};
+	else if (auto const* identifierPath = dynamic_cast<IdentifierPath const*>(&_node))
+		return namedDeclarationAt(*identifierPath, _cursorBytePosition);
+	else if (auto const* memberAccess = dynamic_cast<MemberAccess const*>(&_node))
+		return {memberAccess->annotation().referencedDeclaration, memberAccess->memberName()};
+	else if (auto const* functionCall = dynamic_cast<FunctionCall const*>(&_node))
+		return namedDeclarationAt(*functionCall, _cursorBytePosition);
+	else if (auto const* inlineAssembly = dynamic_cast<InlineAssembly const*>(&_node))
+		return namedDeclarationAt(*inlineAssembly, _cursorBytePosition);
+	return {};
+}
+
+ReferenceIndex::ReferenceIndex(std::vector<SourceUnit const*> const& _sourceUnits)
+{
+	ReferenceCollector collector(m_locations);
+	for (SourceUnit const* sourceUnit: _sourceUnits)
+		sourceUnit->accept(collector);
+}
+
+std::vector<SourceLocation> const& ReferenceIndex::locations(NamedDeclaration const& _declaration) const
+{
+	static std::vector<SourceLocation> const empty;
+	if (auto it = m_locations.find({_declaration.declaration, _declaration.name}); it != m_locations.end())
+		return it->second;
+	return empty;
+}
@@ -0,0 +1,66 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+#pragma once
+
+#include <libsolidity/ast/ASTForward.h>
+
+#include <liblangutil/SourceLocation.h>
+
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace solidity::lsp
+{
+
+/**
+ * A declaration together with the name it is referred to by. The name differs from the name
+ * of the declaration for import aliases.
+ */
+struct NamedDeclaration
+{
+	frontend::Declaration const* declaration = nullptr;
+	std::string name;
+};
+
+/// @returns the declaration whose name is at @a _cursorBytePosition, where @a _node is the
+/// innermost node at that position. The declaration is null if there is none.
+NamedDeclaration namedDeclarationAt(frontend::ASTNode const& _node, int _cursorBytePosition);
+
+/**
+ * Index of all locations in a set of source units that name a declaration: the name of the
+ * declaration itself and all identifiers, member accesses, identifier paths, import aliases,
+ * named call arguments and inline assembly identifiers referring to it.
+ * Built once after the analysis, so that renaming and finding references does not need to
+ * visit the source units again.
+ */
+class ReferenceIndex
+{
+public:
+	explicit ReferenceIndex(std::vector<frontend::SourceUnit const*> const& _sourceUnits);
+
+	/// @returns the locations at which the given declaration is named by the given name,
+	/// including the name location of the declaration itself.
+	std::vector<langutil::SourceLocation> const& locations(NamedDeclaration const& _declaration) const;
+
+private:
+	std::map<std::pair<frontend::Declaration const*, std::string>, std::vector<langutil::SourceLocation>> m_locations;
+};
+
+}
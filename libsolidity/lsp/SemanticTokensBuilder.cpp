@@ -70,21 +70,38 @@ SemanticTokenType semanticTokenTypeForExpression(frontend::Type const* _type)
 
 } // end namespace
 
-Json SemanticTokensBuilder::build(SourceUnit const& _sourceUnit, CharStream const& _charStream)
+Json SemanticTokensBuilder::build(
+	SourceUnit const& _sourceUnit,
+	CharStream const& _charStream,
+	std::optional<SourceLocation> const& _range
+)
 {
-	reset(&_charStream);
+	reset(&_charStream, _range);
 	_sourceUnit.accept(*this);
 	return m_encodedTokens;
 }
 
-void SemanticTokensBuilder::reset(CharStream const* _charStream)
+void SemanticTokensBuilder::reset(CharStream const* _charStream, std::optional<SourceLocation> const& _range)
 {
 	m_encodedTokens = Json::array();
 	m_charStream = _charStream;
+	m_range = _range;
 	m_lastLine = 0;
 	m_lastStartChar = 0;
 }
 
+bool SemanticTokensBuilder::visitNode(ASTNode const& _node)
+{
+	// Nodes with their own visit function are always entered, but that
+	// still skips the statements and expressions of the functions outside the range.
+	return !_node.location().isValid() || inRange(_node.location());
+}
+
+bool SemanticTokensBuilder::inRange(SourceLocation const& _location) const
+{
+	return !m_range || (_location.start < m_range->end && m_range->start < _location.end);
+}
+
 void SemanticTokensBuilder::encode(
 	SourceLocation const& _sourceLocation,
 	SemanticTokenType _tokenType,
@@ -112,7 +129,7 @@ void SemanticTokensBuilder::encode(
 	*/
 
 	// solAssert(_sourceLocation.isValid());
-	if (!_sourceLocation.isValid())
+	if (!_sourceLocation.isValid() || !inRange(_sourceLocation))
 		return;
 
 	auto const [line, startChar] = m_charStream->translatePositionToLineColumn(_sourceLocation.start);
@@ -21,6 +21,8 @@
 
 #include <fmt/format.h>
 
+#include <optional>
+
 namespace solidity::langutil
 {
 class CharStream;
@@ -87,9 +89,15 @@ constexpr SemanticTokenModifiers operator|(SemanticTokenModifiers a, SemanticTok
 class SemanticTokensBuilder: public frontend::ASTConstVisitor
 {
 public:
-	Json build(frontend::SourceUnit const& _sourceUnit, langutil::CharStream const& _charStream);
+	/// @returns the encoded tokens of the source unit. If @a _range is given, only the tokens
+	/// overlapping it are returned and only the nodes overlapping it are visited.
+	Json build(
+		frontend::SourceUnit const& _sourceUnit,
+		langutil::CharStream const& _charStream,
+		std::optional<langutil::SourceLocation> const& _range = std::nullopt
+	);
 
-	void reset(langutil::CharStream const* _charStream);
+	void reset(langutil::CharStream const* _charStream, std::optional<langutil::SourceLocation> const& _range = std::nullopt);
 	void encode(
 		langutil::SourceLocation const& _sourceLocation,
 		SemanticTokenType _tokenType,
@@ -113,9 +121,16 @@ public:
 	bool visit(frontend::UserDefinedTypeName const&) override;
 	bool visit(frontend::VariableDeclaration const&) override;
 
+protected:
+	bool visitNode(frontend::ASTNode const& _node) override;
+
 private:
+	/// @returns false if a range was requested and @a _location does not overlap it.
+	bool inRange(langutil::SourceLocation const& _location) const;
+
 	Json m_encodedTokens;
 	langutil::CharStream const* m_charStream;
+	std::optional<langutil::SourceLocation> m_range;
 	int m_lastLine;
 	int m_lastStartChar;
 };
@@ -20,7 +20,6 @@
 
 #include <libsolutil/JSON.h>
 #include <libsolutil/Visitor.h>
-#include <libsolutil/CommonIO.h>
 #include <liblangutil/Exceptions.h>
 
 #include <fmt/format.h>
@@ -35,6 +34,8 @@
 #if defined(_WIN32)
 #include <io.h>
 #include <fcntl.h>
+#else
+#include <poll.h>
 #endif
 
 using namespace solidity::lsp;
@@ -56,11 +57,28 @@ std::optional<Json> Transport::receive()
 		return std::nullopt;
 	}
 
-	std::string const data = readBytes(stoul(headers->at("content-length")));
+	size_t const contentLength = stoul(headers->at("content-length"));
+	m_inputBuffer.resize(contentLength);
+	m_inputBuffer.resize(readBytes(m_inputBuffer.data(), contentLength));
 
+	// The payload is parsed in place. Unlike jsonParseStrict(), which is meant for hand-written
+	// input, this does not tolerate line breaks within strings, but LSP clients always escape them.
 	Json jsonMessage;
 	std::string jsonParsingErrors;
-	solidity::util::jsonParseStrict(data, jsonMessage, &jsonParsingErrors);
+	try
+	{
+		jsonMessage = Json::parse(
+			m_inputBuffer.begin(),
+			m_inputBuffer.end(),
+			/* callback */ nullptr,
+			/* allow exceptions */ true,
+			/* ignore_comments */ true
+		);
+	}
+	catch (Json::parse_error const& _exception)
+	{
+		jsonParsingErrors = util::removeNlohmannInternalErrorIdentifier(_exception.what());
+	}
 	if (!jsonParsingErrors.empty() || jsonMessage.empty() || !jsonMessage.is_object())
 	{
 		error({}, ErrorCode::ParseError, "Could not parse RPC JSON payload. " + jsonParsingErrors);
@@ -112,6 +130,14 @@ void Transport::notify(std::string _method, Json _message)
 	send(std::move(json));
 }
 
+void Transport::request(MessageID _id, std::string _method, Json _params)
+{
+	Json json;
+	json["method"] = std::move(_method);
+	json["params"] = std::move(_params);
+	send(std::move(json), _id);
+}
+
 void Transport::reply(MessageID _id, Json _message)
 {
 	Json json;
@@ -134,11 +160,15 @@ void Transport::send(Json _json, MessageID _id)
 	if (_id != Json())
 		_json["id"] = _id;
 
-	// Trailing CRLF only for easier readability.
-	std::string const jsonString = solidity::util::jsonCompactPrint(_json);
+	// Serialises like jsonCompactPrint(), but into the buffer of the previous message.
+	m_outputBuffer.clear();
+	nlohmann::detail::serializer<Json>(
+		nlohmann::detail::output_adapter<char, std::string>(m_outputBuffer),
+		/* indent_char */ ' '
+	).dump(_json, /* pretty_print */ false, /* ensure_ascii */ true, /* indent_step */ 0);
 
-	writeBytes(fmt::format("Content-Length: {}\r\n\r\n", jsonString.size()));
-	writeBytes(jsonString);
+	writeBytes(fmt::format("Content-Length: {}\r\n\r\n", m_outputBuffer.size()));
+	writeBytes(m_outputBuffer);
 	flushOutput();
 }
 // }}}
@@ -155,9 +185,15 @@ bool IOStreamTransport::closed() const noexcept
 	return m_input.eof();
 }
 
-std::string IOStreamTransport::readBytes(size_t _length)
+bool IOStreamTransport::hasPendingInput() const noexcept
 {
-	return util::readBytes(m_input, _length);
+	return m_input.rdbuf()->in_avail() > 0;
+}
+
+size_t IOStreamTransport::readBytes(char* _buffer, size_t _byteCount)
+{
+	m_input.read(_buffer, static_cast<std::streamsize>(_byteCount));
+	return static_cast<size_t>(m_input.gcount());
 }
 
 std::string IOStreamTransport::getline()
@@ -192,20 +228,37 @@ bool StdioTransport::closed() const noexcept
 	return feof(stdin);
 }
 
-std::string StdioTransport::readBytes(size_t _byteCount)
+bool StdioTransport::hasPendingInput() const noexcept
+{
+	#if defined(_WIN32)
+	return false;
+	#else
+	// Input that is already buffered by stdio is not seen here, which is fine
+	// since the result only needs to be a lower bound.
+	pollfd input{fileno(stdin), POLLIN, 0};
+	return poll(&input, 1, 0) > 0 && (input.revents & POLLIN);
+	#endif
+}
+
+size_t StdioTransport::readBytes(char* _buffer, size_t _byteCount)
 {
-	std::string buffer;
-	buffer.resize(_byteCount);
-	auto const n = fread(buffer.data(), 1, _byteCount, stdin);
-	if (n < _byteCount)
-		buffer.resize(n);
-	return buffer;
+	return fread(_buffer, 1, _byteCount, stdin);
 }
 
 std::string StdioTransport::getline()
 {
+	// Read through the buffer of stdin like readBytes(), instead of through std::cin.
 	std::string line;
-	std::getline(std::cin, line);
+	char buffer[256];
+	while (fgets(buffer, sizeof(buffer), stdin))
+	{
+		line += buffer;
+		if (line.back() == '\n')
+		{
+			line.pop_back();
+			break;
+		}
+	}
 	lspDebug(fmt::format("Received: {}", line));
 	return line;
 }
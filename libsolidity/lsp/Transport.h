@@ -99,11 +99,17 @@ public:
 
 	std::optional<Json> receive();
 	void notify(std::string _method, Json _params);
+	/// Sends a request to the client. The response is received like any other message.
+	void request(MessageID _id, std::string _method, Json _params);
 	void reply(MessageID _id, Json _result);
 	void error(MessageID _id, ErrorCode _code, std::string _message);
 
 	virtual bool closed() const noexcept = 0;
 
+	/// @returns true if more input is known to be available without blocking.
+	/// May return false even if there is more input.
+	virtual bool hasPendingInput() const noexcept = 0;
+
 	void trace(std::string _message, Json _extra = Json{});
 
 	TraceValue traceValue() const noexcept { return m_logTrace; }
@@ -111,15 +117,20 @@ public:
 
 private:
 	TraceValue m_logTrace = TraceValue::Off;
+	/// Payload of the last received message. Kept across messages, so that its memory can be reused.
+	std::string m_inputBuffer;
+	/// Serialised payload of the last sent message. Kept across messages, so that its memory can be reused.
+	std::string m_outputBuffer;
 
 protected:
 	/// Reads from the transport and parses the headers until the beginning
 	/// of the contents.
 	std::optional<std::map<std::string, std::string>> parseHeaders();
 
-	/// Consumes exactly @p _byteCount bytes, as needed for consuming
+	/// Consumes exactly @p _byteCount bytes into @p _buffer, as needed for consuming
 	/// the message body from the transport line.
-	virtual std::string readBytes(size_t _byteCount) = 0;
+	/// @returns the number of bytes read, which is less than @p _byteCount only at the end of the input.
+	virtual size_t readBytes(char* _buffer, size_t _byteCount) = 0;
 
 	// Mimics std::getline() on this Transport API.
 	virtual std::string getline() = 0;
@@ -150,9 +161,10 @@ public:
 	IOStreamTransport(std::istream& _in, std::ostream& _out);
 
 	bool closed() const noexcept override;
+	bool hasPendingInput() const noexcept override;
 
 protected:
-	std::string readBytes(size_t _byteCount) override;
+	size_t readBytes(char* _buffer, size_t _byteCount) override;
 	std::string getline() override;
 	void writeBytes(std::string_view _data) override;
 	void flushOutput() override;
@@ -171,9 +183,10 @@ public:
 	StdioTransport();
 
 	bool closed() const noexcept override;
+	bool hasPendingInput() const noexcept override;
 
 protected:
-	std::string readBytes(size_t _byteCount) override;
+	size_t readBytes(char* _buffer, size_t _byteCount) override;
 	std::string getline() override;
 	void writeBytes(std::string_view _data) override;
 	void flushOutput() override;
@@ -76,7 +76,7 @@ public:
 		solAssert(m_location.sourceName, "");
 		if (m_location.end < 0)
 			markEndPosition();
-		return std::make_shared<NodeType>(m_parser.nextID(), m_location, std::forward<Args>(_args)...);
+		return m_parser.m_arena->make<NodeType>(m_parser.nextID(), m_location, std::forward<Args>(_args)...);
 	}
 
 	SourceLocation const& location() const noexcept { return m_location; }
@@ -93,6 +93,7 @@ ASTPointer<SourceUnit> Parser::parse(CharStream& _charStream)
 	{
 		m_recursionDepth = 0;
 		m_scanner = std::make_shared<Scanner>(_charStream);
+		m_arena = ASTArena::create();
 		ASTNodeFactory nodeFactory(*this);
 		m_experimentalSolidityEnabledInCurrentSourceUnit = false;
 
@@ -842,6 +843,23 @@ ASTPointer<VariableDeclaration> Parser::parseVariableDeclaration(
 
 			overrides = parseOverrideSpecifier();
 		}
+		// "transient" is not a keyword, so that it can still be used as an identifier.
+		// It is only the data location if it is not followed by the end of the declaration.
+		else if (
+			_options.kind == VarDeclKind::State &&
+			token == Token::Identifier &&
+			m_scanner->currentLiteral() == "transient" &&
+			m_scanner->peekNextToken() != Token::Assign &&
+			m_scanner->peekNextToken() != Token::Semicolon
+		)
+		{
+			if (location != VariableDeclaration::Location::Unspecified)
+				parserError(9362_error, "Location already specified.");
+			else
+				location = VariableDeclaration::Location::Transient;
+			nodeFactory.markEndPosition();
+			advance();
+		}
 		else
 		{
 			if (_options.allowIndexed && token == Token::Indexed)
@@ -1466,7 +1484,7 @@ ASTPointer<InlineAssembly> Parser::parseInlineAssembly(ASTPointer<ASTString> con
 		BOOST_THROW_EXCEPTION(FatalError());
 
 	location.end = nativeLocationOf(*block).end;
-	return std::make_shared<InlineAssembly>(nextID(), location, _docString, dialect, std::move(flags), block);
+	return m_arena->make<InlineAssembly>(nextID(), location, _docString, dialect, std::move(flags), block);
 }
 
 ASTPointer<IfStatement> Parser::parseIfStatement(ASTPointer<ASTString> const& _docString)
@@ -24,6 +24,7 @@
 #pragma once
 
 #include <libsolidity/ast/AST.h>
+#include <libsolidity/ast/ASTArena.h>
 #include <liblangutil/ParserBase.h>
 #include <liblangutil/EVMVersion.h>
 
@@ -249,6 +250,8 @@ private:
 	langutil::EVMVersion m_evmVersion;
 	/// Counter for the next AST node ID
 	int64_t m_currentNodeID = 0;
+	/// Arena the nodes of the source unit currently being parsed are allocated from.
+	std::shared_ptr<ASTArena> m_arena;
 	/// Flag that indicates whether experimental mode is enabled in the current source unit
 	bool m_experimentalSolidityEnabledInCurrentSourceUnit = false;
 };
@@ -32,6 +32,7 @@
 
 #include <array>
 #include <cstdint>
+#include <cstring>
 #include <algorithm>
 
 namespace solidity::util
@@ -121,18 +122,25 @@ public:
 	operator Arith() const { return fromBigEndian<Arith>(m_data); }
 
 	// The obvious comparison operators.
-	bool operator==(FixedHash const& _c) const { return m_data == _c.m_data; }
-	bool operator!=(FixedHash const& _c) const { return m_data != _c.m_data; }
+	// memcmp compares unsigned bytes lexicographically and is lowered to word-wise
+	// comparisons for constant sizes, unlike a byte-by-byte loop.
+	bool operator==(FixedHash const& _c) const { return std::memcmp(m_data.data(), _c.m_data.data(), N) == 0; }
+	bool operator!=(FixedHash const& _c) const { return !operator==(_c); }
 	/// Required to sort objects of this type or use them as map keys.
-	bool operator<(FixedHash const& _c) const {
-		for (unsigned i = 0; i < N; ++i)
+	bool operator<(FixedHash const& _c) const { return std::memcmp(m_data.data(), _c.m_data.data(), N) < 0; }
+
+	/// @returns a hash of the data, combining it eight bytes at a time.
+	/// All bytes are used, since e.g. addresses of precompiles only differ in their last byte.
+	size_t hash() const
+	{
+		size_t seed = 0;
+		for (unsigned i = 0; i < N; i += sizeof(uint64_t))
 		{
-			if (m_data[i] < _c.m_data[i])
-				return true;
-			else if (m_data[i] > _c.m_data[i])
-				return false;
+			uint64_t word = 0;
+			std::memcpy(&word, m_data.data() + i, std::min<size_t>(sizeof(uint64_t), N - i));
+			boost::hash_combine(seed, word);
 		}
-		return false;
+		return seed;
 	}
 
 	/// @returns a particular byte from the hash.
@@ -179,3 +187,14 @@ using h256 = FixedHash<32>;
 using h160 = FixedHash<20>;
 
 }
+
+namespace std
+{
+template<unsigned N> struct hash<solidity::util::FixedHash<N>>
+{
+	size_t operator()(solidity::util::FixedHash<N> const& _value) const
+	{
+		return _value.hash();
+	}
+};
+}
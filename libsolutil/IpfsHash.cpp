@@ -22,6 +22,7 @@
 #include <libsolutil/picosha2.h>
 #include <libsolutil/CommonData.h>
 #include <libsolutil/Numeric.h>
+#include <libsolutil/Parallel.h>
 
 using namespace solidity;
 using namespace solidity::util;
@@ -152,31 +153,33 @@ bytes groupChunksBottomUp(Chunks _currentLevel)
 }
 }
 
-bytes solidity::util::ipfsHash(std::string _data)
+bytes solidity::util::ipfsHash(std::string _data, size_t _parallelism)
 {
 	size_t const maxChunkSize = 1024 * 256;
 	size_t chunkCount = _data.length() / maxChunkSize + (_data.length() % maxChunkSize > 0 ? 1 : 0);
 	chunkCount = chunkCount == 0 ? 1 : chunkCount;
 
-	Chunks allChunks;
-
-	for (size_t chunkIndex = 0; chunkIndex < chunkCount; chunkIndex++)
-	{
-		bytes chunkBytes = asBytes(
-			_data.substr(chunkIndex * maxChunkSize, std::min(maxChunkSize, _data.length() - chunkIndex * maxChunkSize))
-		);
-
-		bytes lengthAsVarint = varintEncoding(chunkBytes.size());
+	// The data nodes are independent, so they are encoded and hashed concurrently.
+	Chunks allChunks(chunkCount);
+	runInParallel(_parallelism, chunkCount, [&](size_t _chunkIndex) {
+		size_t const chunkOffset = _chunkIndex * maxChunkSize;
+		size_t const chunkSize = std::min(maxChunkSize, _data.length() - chunkOffset);
+		bytes lengthAsVarint = varintEncoding(chunkSize);
 
 		bytes protobufEncodedData;
+		protobufEncodedData.reserve(chunkSize + 2 * lengthAsVarint.size() + 4);
 		// Type: File
 		protobufEncodedData += bytes{0x08, 0x02};
-		if (!chunkBytes.empty())
+		if (chunkSize > 0)
 		{
 			// Data (length delimited bytes)
 			protobufEncodedData += bytes{0x12};
 			protobufEncodedData += lengthAsVarint;
-			protobufEncodedData += chunkBytes;
+			protobufEncodedData.insert(
+				protobufEncodedData.end(),
+				_data.begin() + static_cast<std::ptrdiff_t>(chunkOffset),
+				_data.begin() + static_cast<std::ptrdiff_t>(chunkOffset + chunkSize)
+			);
 		}
 		// filesize: length as varint
 		protobufEncodedData += bytes{0x18} + lengthAsVarint;
@@ -186,17 +189,17 @@ bytes solidity::util::ipfsHash(std::string _data)
 		bytes blockData = encodeByteArray(protobufEncodedData);
 
 		// Multihash: sha2-256, 256 bits
-		allChunks.emplace_back(
+		allChunks[_chunkIndex] = Chunk(
 			encodeHash(blockData),
-			chunkBytes.size(),
+			chunkSize,
 			blockData.size()
 		);
-	}
+	});
 
 	return groupChunksBottomUp(std::move(allChunks));
 }
 
-std::string solidity::util::ipfsHashBase58(std::string _data)
+std::string solidity::util::ipfsHashBase58(std::string _data, size_t _parallelism)
 {
-	return base58Encode(ipfsHash(std::move(_data)));
+	return base58Encode(ipfsHash(std::move(_data), _parallelism));
 }
@@ -30,9 +30,10 @@ namespace solidity::util
 /// As hash function it will use sha2-256.
 /// The effect is that the hash should be identical to the one produced by
 /// the command `ipfs add <filename>`.
-bytes ipfsHash(std::string _data);
+/// The chunks of large files are hashed on up to @a _parallelism threads.
+bytes ipfsHash(std::string _data, size_t _parallelism = 1);
 
 /// Compute the "ipfs hash" as above, but encoded in base58 as used by ipfs / bitcoin.
-std::string ipfsHashBase58(std::string _data);
+std::string ipfsHashBase58(std::string _data, size_t _parallelism = 1);
 
 }
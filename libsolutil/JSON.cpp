@@ -26,6 +26,7 @@
 
 #include <boost/algorithm/string.hpp>
 
+#include <ostream>
 #include <sstream>
 
 #ifdef STRICT_NLOHMANN_JSON_VERSION_CHECK
@@ -144,6 +145,51 @@ std::string jsonPrint(Json const& _input, JsonFormat const& _format)
 	return dumped;
 }
 
+void JsonStreamWriter::beginObject(std::optional<std::string> const& _key)
+{
+	assertThrow(m_nonEmptyObjects.empty() != _key.has_value(), Exception, "Only the root object has no key.");
+	if (_key)
+		writeKey(*_key);
+	m_stream << '{';
+	m_nonEmptyObjects.push_back(false);
+}
+
+void JsonStreamWriter::member(std::string const& _key, Json const& _value)
+{
+	assertThrow(!m_nonEmptyObjects.empty(), Exception, "No object to write to.");
+	writeKey(_key);
+	std::string dumped = jsonPrint(_value, m_format);
+	if (m_format.format == JsonFormat::Pretty)
+		// Line breaks within strings are escaped, so all of them belong to the structure of the value.
+		boost::replace_all(dumped, "\n", "\n" + std::string(m_nonEmptyObjects.size() * m_format.indent, ' '));
+	m_stream << dumped;
+}
+
+void JsonStreamWriter::endObject()
+{
+	assertThrow(!m_nonEmptyObjects.empty(), Exception, "No object to finish.");
+	bool const nonEmpty = m_nonEmptyObjects.back();
+	m_nonEmptyObjects.pop_back();
+	if (nonEmpty)
+		writeNewLine();
+	m_stream << '}';
+}
+
+void JsonStreamWriter::writeKey(std::string const& _key)
+{
+	if (m_nonEmptyObjects.back())
+		m_stream << ',';
+	m_nonEmptyObjects.back() = true;
+	writeNewLine();
+	m_stream << jsonPrint(Json(_key), m_format) << (m_format.format == JsonFormat::Pretty ? ": " : ":");
+}
+
+void JsonStreamWriter::writeNewLine()
+{
+	if (m_format.format == JsonFormat::Pretty)
+		m_stream << '\n' << std::string(m_nonEmptyObjects.size() * m_format.indent, ' ');
+}
+
 bool jsonParseStrict(std::string const& _input, Json& _json, std::string* _errs /* = nullptr */)
 {
 	try
@@ -26,10 +26,12 @@
 #include <libsolutil/Assertions.h>
 #include <nlohmann/json.hpp>
 
+#include <iosfwd>
 #include <string>
 #include <string_view>
 #include <optional>
 #include <limits>
+#include <vector>
 
 namespace solidity
 {
@@ -71,6 +73,35 @@ std::string jsonCompactPrint(Json const& _input);
 /// Serialise the JSON object (@a _input) using specified format (@a _format)
 std::string jsonPrint(Json const& _input, JsonFormat const& _format);
 
+/// Writes a JSON document piece by piece to a stream, so that it never has to be held in memory
+/// as a whole. The result is identical to @a jsonPrint of the complete document as long as the
+/// members of each object are written in the order of their keys.
+class JsonStreamWriter
+{
+public:
+	JsonStreamWriter(std::ostream& _stream, JsonFormat const& _format): m_stream(_stream), m_format(_format) {}
+
+	/// Starts an object. @a _key is the key of the object in the enclosing object
+	/// and must be given unless the object is the root value.
+	void beginObject(std::optional<std::string> const& _key = std::nullopt);
+	/// Writes a member of the current object.
+	void member(std::string const& _key, Json const& _value);
+	/// Finishes the current object.
+	void endObject();
+
+	/// @returns the number of objects that have been started but not yet finished.
+	size_t depth() const noexcept { return m_nonEmptyObjects.size(); }
+
+private:
+	void writeKey(std::string const& _key);
+	void writeNewLine();
+
+	std::ostream& m_stream;
+	JsonFormat m_format;
+	/// For each object that is not finished yet, whether a member has been written to it.
+	std::vector<bool> m_nonEmptyObjects;
+};
+
 /// Parse a JSON string (@a _input) with enabled strict-mode and writes resulting JSON object to (@a _json)
 /// \param _input JSON input string
 /// \param _json [out] resulting JSON object
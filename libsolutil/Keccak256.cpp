@@ -24,6 +24,8 @@
 
 #include <cstdint>
 #include <cstring>
+#include <map>
+#include <string_view>
 
 namespace solidity::util
 {
@@ -180,4 +182,20 @@ h256 keccak256(bytesConstRef _input)
 	return output;
 }
 
+std::vector<h256> keccak256Many(std::vector<bytesConstRef> const& _inputs)
+{
+	std::vector<h256> outputs;
+	outputs.reserve(_inputs.size());
+	std::map<std::string_view, h256> hashes;
+	for (bytesConstRef const& input: _inputs)
+	{
+		std::string_view const content(reinterpret_cast<char const*>(input.data()), input.size());
+		auto [it, inserted] = hashes.try_emplace(content);
+		if (inserted)
+			it->second = keccak256(input);
+		outputs.push_back(it->second);
+	}
+	return outputs;
+}
+
 }
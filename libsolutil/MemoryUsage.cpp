@@ -0,0 +1,96 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <libsolutil/MemoryUsage.h>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+
+#if defined(SOLC_TRACK_ALLOCATIONS)
+#include <cstdlib>
+#include <new>
+#endif
+
+using namespace solidity;
+using namespace solidity::util;
+
+namespace
+{
+
+thread_local size_t t_allocations = 0;
+thread_local size_t t_allocatedBytes = 0;
+
+}
+
+#if defined(SOLC_TRACK_ALLOCATIONS)
+
+// The counters are thread-local, so that the replacements do not need any synchronization.
+// The array, nothrow and sized variants of the default implementations call these.
+void* operator new(size_t _size)
+{
+	++t_allocations;
+	t_allocatedBytes += _size;
+	if (void* pointer = std::malloc(_size == 0 ? 1 : _size))
+		return pointer;
+	throw std::bad_alloc();
+}
+
+void operator delete(void* _pointer) noexcept
+{
+	std::free(_pointer);
+}
+
+void operator delete(void* _pointer, size_t) noexcept
+{
+	std::free(_pointer);
+}
+
+#endif
+
+std::optional<size_t> solidity::util::peakResidentMemory()
+{
+#if defined(__unix__) || defined(__APPLE__)
+	rusage usage{};
+	if (getrusage(RUSAGE_SELF, &usage) != 0)
+		return std::nullopt;
+	auto const maxResident = static_cast<size_t>(usage.ru_maxrss);
+#if defined(__APPLE__)
+	// Reported in bytes on macOS and in kilobytes elsewhere.
+	return maxResident;
+#else
+	return maxResident * 1024;
+#endif
+#else
+	return std::nullopt;
+#endif
+}
+
+bool solidity::util::allocationsTracked()
+{
+#if defined(SOLC_TRACK_ALLOCATIONS)
+	return true;
+#else
+	return false;
+#endif
+}
+
+AllocationCounters solidity::util::allocationCounters()
+{
+	return {t_allocations, t_allocatedBytes};
+}
@@ -0,0 +1,49 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Measurement of the memory used by the compiler process.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <optional>
+
+namespace solidity::util
+{
+
+/// @returns the largest amount of physical memory, in bytes, the process has used since it was
+/// started, or nullopt if this is not available on the platform.
+std::optional<size_t> peakResidentMemory();
+
+/// Number and total size of the allocations done through the global operator new.
+struct AllocationCounters
+{
+	size_t allocations = 0;
+	size_t bytes = 0;
+};
+
+/// @returns true if the allocations are counted, i.e. if the compiler was built with the CMake
+/// option SOLC_TRACK_ALLOCATIONS, which replaces the global operator new.
+bool allocationsTracked();
+
+/// @returns the allocations done by the current thread since it was started.
+/// The counters stay at zero unless @a allocationsTracked() is true.
+AllocationCounters allocationCounters();
+
+}
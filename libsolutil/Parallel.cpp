@@ -0,0 +1,85 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <libsolutil/Parallel.h>
+#include <libsolutil/PhaseTracer.h>
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+using namespace solidity;
+using namespace solidity::util;
+
+size_t solidity::util::availableHardwareThreads()
+{
+	return std::max<size_t>(std::thread::hardware_concurrency(), 1);
+}
+
+void solidity::util::runInParallel(size_t _jobs, size_t _count, std::function<void(size_t)> const& _task)
+{
+	if (_jobs <= 1 || _count <= 1)
+	{
+		for (size_t index = 0; index < _count; ++index)
+			_task(index);
+		return;
+	}
+
+	std::vector<std::exception_ptr> exceptions(_count);
+	std::atomic<size_t> nextIndex = 0;
+	std::atomic<bool> failed = false;
+	PhaseTracer* tracer = PhaseTracer::current();
+	auto worker = [&]()
+	{
+		PhaseTracer::Activation tracerActivation(tracer);
+		for (size_t index = nextIndex++; index < _count && !failed; index = nextIndex++)
+			try
+			{
+				_task(index);
+			}
+			catch (...)
+			{
+				exceptions[index] = std::current_exception();
+				failed = true;
+			}
+	};
+
+	std::vector<std::thread> threads;
+	size_t const threadCount = std::min(_jobs, _count);
+	// The calling thread acts as one of the workers.
+	for (size_t i = 1; i < threadCount; ++i)
+		try
+		{
+			threads.emplace_back(worker);
+		}
+		catch (std::system_error const&)
+		{
+			// Could not spawn any more threads, continue with the ones we have.
+			break;
+		}
+	worker();
+	for (std::thread& thread: threads)
+		thread.join();
+
+	for (std::exception_ptr const& exception: exceptions)
+		if (exception)
+			std::rethrow_exception(exception);
+}
@@ -0,0 +1,43 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Helpers for running independent pieces of work on multiple threads.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+namespace solidity::util
+{
+
+/// @returns the number of threads the hardware supports or 1 if it cannot be determined.
+size_t availableHardwareThreads();
+
+/// Calls @a _task once for each index in the range [0, @a _count), distributing the calls
+/// over at most @a _jobs threads. If @a _jobs is 1 or there is at most one task, all tasks are
+/// run in order on the calling thread.
+/// Tasks must not depend on each other and must only modify state that is private to them.
+/// If any of the tasks throws, the remaining tasks that have not been started are skipped and
+/// the exception of the task with the lowest index is rethrown once all threads have finished,
+/// so that the outcome does not depend on the scheduling of the tasks.
+/// The phase tracer active on the calling thread is also active while the tasks run.
+void runInParallel(size_t _jobs, size_t _count, std::function<void(size_t)> const& _task);
+
+}
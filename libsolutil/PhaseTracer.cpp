@@ -0,0 +1,167 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <libsolutil/PhaseTracer.h>
+
+using namespace solidity;
+using namespace solidity::util;
+
+namespace
+{
+
+thread_local PhaseTracer* t_currentTracer = nullptr;
+
+int64_t microsecondsBetween(std::chrono::steady_clock::time_point _from, std::chrono::steady_clock::time_point _to)
+{
+	return std::chrono::duration_cast<std::chrono::microseconds>(_to - _from).count();
+}
+
+}
+
+PhaseTracer::Activation::Activation(PhaseTracer* _tracer):
+	m_previous(t_currentTracer)
+{
+	t_currentTracer = _tracer;
+}
+
+PhaseTracer::Activation::~Activation()
+{
+	t_currentTracer = m_previous;
+}
+
+PhaseTracer::Scope::Scope(std::string_view _name, std::string_view _target):
+	m_tracer(t_currentTracer)
+{
+	if (!m_tracer)
+		return;
+	m_name = _name;
+	m_target = _target;
+	m_startPeakMemory = peakResidentMemory();
+	m_startAllocations = allocationCounters();
+	m_start = std::chrono::steady_clock::now();
+}
+
+PhaseTracer::Scope::~Scope()
+{
+	if (!m_tracer)
+		return;
+
+	auto const end = std::chrono::steady_clock::now();
+	Event event;
+	event.name = std::move(m_name);
+	event.target = std::move(m_target);
+	event.peakMemory = peakResidentMemory();
+	if (event.peakMemory && m_startPeakMemory)
+		event.peakMemoryIncrease = *event.peakMemory - *m_startPeakMemory;
+	if (allocationsTracked())
+	{
+		AllocationCounters const counters = allocationCounters();
+		event.allocations = AllocationCounters{
+			counters.allocations - m_startAllocations.allocations,
+			counters.bytes - m_startAllocations.bytes
+		};
+	}
+	m_tracer->record(std::move(event), m_start, end);
+}
+
+PhaseTracer::PhaseTracer():
+	m_origin(std::chrono::steady_clock::now())
+{
+}
+
+PhaseTracer* PhaseTracer::current()
+{
+	return t_currentTracer;
+}
+
+void PhaseTracer::clear()
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	m_events.clear();
+	m_threadIndices.clear();
+	m_origin = std::chrono::steady_clock::now();
+}
+
+std::vector<PhaseTracer::Event> PhaseTracer::events() const
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return m_events;
+}
+
+Json PhaseTracer::toJson() const
+{
+	std::vector<Event> const recordedEvents = events();
+	Json traceEvents = Json::array();
+	for (Event const& event: recordedEvents)
+	{
+		Json traceEvent;
+		traceEvent["name"] = event.name;
+		traceEvent["cat"] = "solc";
+		// Complete event, i.e. one with a start and a duration.
+		traceEvent["ph"] = "X";
+		traceEvent["ts"] = event.start;
+		traceEvent["dur"] = event.duration;
+		traceEvent["pid"] = 0;
+		traceEvent["tid"] = event.thread;
+		if (!event.target.empty())
+			traceEvent["args"]["target"] = event.target;
+		if (event.peakMemory)
+		{
+			traceEvent["args"]["peakMemory"] = *event.peakMemory;
+			traceEvent["args"]["peakMemoryIncrease"] = event.peakMemoryIncrease;
+		}
+		if (event.allocations)
+		{
+			traceEvent["args"]["allocations"] = event.allocations->allocations;
+			traceEvent["args"]["allocatedBytes"] = event.allocations->bytes;
+		}
+		traceEvents.emplace_back(std::move(traceEvent));
+	}
+
+	// Counter events showing the peak memory usage over time, after all the phases.
+	for (Event const& event: recordedEvents)
+		if (event.peakMemory)
+		{
+			Json counterEvent;
+			counterEvent["name"] = "peakMemory";
+			counterEvent["cat"] = "solc";
+			counterEvent["ph"] = "C";
+			counterEvent["ts"] = event.start + event.duration;
+			counterEvent["pid"] = 0;
+			counterEvent["args"]["bytes"] = *event.peakMemory;
+			traceEvents.emplace_back(std::move(counterEvent));
+		}
+
+	Json trace;
+	trace["traceEvents"] = std::move(traceEvents);
+	trace["displayTimeUnit"] = "ms";
+	return trace;
+}
+
+void PhaseTracer::record(
+	Event _event,
+	std::chrono::steady_clock::time_point _start,
+	std::chrono::steady_clock::time_point _end
+)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	_event.start = microsecondsBetween(m_origin, _start);
+	_event.duration = microsecondsBetween(_start, _end);
+	_event.thread = m_threadIndices.emplace(std::this_thread::get_id(), m_threadIndices.size()).first->second;
+	m_events.push_back(std::move(_event));
+}
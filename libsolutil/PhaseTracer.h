@@ -0,0 +1,140 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Recording of the time and memory spent in the phases of the compilation pipeline.
+ */
+
+#pragma once
+
+#include <libsolutil/JSON.h>
+#include <libsolutil/MemoryUsage.h>
+
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace solidity::util
+{
+
+/**
+ * Thread-safe collector of timed compilation phases.
+ *
+ * Phases are recorded by creating a @a PhaseTracer::Scope, which measures the time until it is
+ * destroyed and reports it to the tracer that is active on the current thread. A tracer is made
+ * active by a @a PhaseTracer::Activation, so that code deep inside the pipeline can mark its
+ * phases without the tracer being passed down to it. If no tracer is active, scopes do nothing.
+ * Tracers are propagated into the worker threads started by @a runInParallel.
+ *
+ * The result is available in the Chrome trace event format, which can be loaded into
+ * chrome://tracing, Perfetto or speedscope. Nested scopes on the same thread show up as a tree.
+ *
+ * Each phase also records the peak memory usage of the process at its end, so that the phases
+ * responsible for the growth of the peak can be identified. If the allocations are tracked, the
+ * allocations done by the thread of the phase are recorded as well, including those of nested phases.
+ */
+class PhaseTracer
+{
+public:
+	struct Event
+	{
+		std::string name;
+		/// Name of the contract, source or object the phase was applied to. Can be empty.
+		std::string target;
+		/// Start of the phase in microseconds since the creation of the tracer.
+		int64_t start = 0;
+		int64_t duration = 0;
+		/// Small index identifying the thread the phase ran on, 0 for the first thread seen.
+		size_t thread = 0;
+		/// Peak physical memory usage of the process in bytes at the end of the phase.
+		std::optional<size_t> peakMemory;
+		/// Growth of the peak memory usage during the phase in bytes. Note that phases running
+		/// concurrently on other threads contribute to it.
+		size_t peakMemoryIncrease = 0;
+		/// Allocations done by the phase, only available if @a allocationsTracked() is true.
+		std::optional<AllocationCounters> allocations;
+	};
+
+	/// Makes @a _tracer the tracer of the current thread for the lifetime of the object.
+	/// Restores the previously active tracer on destruction. @a _tracer can be null.
+	class Activation
+	{
+	public:
+		explicit Activation(PhaseTracer* _tracer);
+		~Activation();
+		Activation(Activation const&) = delete;
+		Activation& operator=(Activation const&) = delete;
+
+	private:
+		PhaseTracer* m_previous = nullptr;
+	};
+
+	/// Records the time from its construction to its destruction as a phase called @a _name
+	/// within the tracer that is active on the current thread at construction time.
+	/// The name and target are only copied if a tracer is active.
+	class Scope
+	{
+	public:
+		explicit Scope(std::string_view _name, std::string_view _target = {});
+		~Scope();
+		Scope(Scope const&) = delete;
+		Scope& operator=(Scope const&) = delete;
+
+	private:
+		PhaseTracer* m_tracer = nullptr;
+		std::string m_name;
+		std::string m_target;
+		std::chrono::steady_clock::time_point m_start;
+		std::optional<size_t> m_startPeakMemory;
+		AllocationCounters m_startAllocations;
+	};
+
+	PhaseTracer();
+
+	/// @returns the tracer active on the current thread or null if there is none.
+	static PhaseTracer* current();
+
+	/// Removes all recorded events and restarts the clock.
+	void clear();
+
+	/// @returns the events recorded so far, ordered by their completion.
+	std::vector<Event> events() const;
+
+	/// @returns the recorded events in the Chrome trace event format. The memory usage is part of
+	/// the arguments of each phase and is also reported as a counter.
+	Json toJson() const;
+
+private:
+	/// Records @a _event after filling in its start, duration and thread.
+	void record(
+		Event _event,
+		std::chrono::steady_clock::time_point _start,
+		std::chrono::steady_clock::time_point _end
+	);
+
+	mutable std::mutex m_mutex;
+	std::chrono::steady_clock::time_point m_origin;
+	std::vector<Event> m_events;
+	std::map<std::thread::id, size_t> m_threadIndices;
+};
+
+}
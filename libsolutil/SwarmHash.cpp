@@ -21,6 +21,9 @@
 #include <libsolutil/SwarmHash.h>
 
 #include <libsolutil/Keccak256.h>
+#include <libsolutil/Parallel.h>
+
+#include <liblangutil/Exceptions.h>
 
 using namespace solidity;
 using namespace solidity::util;
@@ -64,17 +67,28 @@ h256 swarmHashIntermediate(std::string const& _input, size_t _offset, size_t _le
 
 h256 bmtHash(bytesConstRef _data)
 {
-	if (_data.size() <= 64)
-		return keccak256(_data);
-
-	size_t midPoint = _data.size() / 2;
-	return keccak256(
-		bmtHash(_data.cropped(0, midPoint)).asBytes() +
-		bmtHash(_data.cropped(midPoint)).asBytes()
-	);
+	// The tree is complete, so it is hashed level by level. Chunks are
+	// mostly zero padding, whose equal segments are hashed only once per level.
+	solAssert(_data.size() == 0x1000);
+	std::vector<bytesConstRef> segments;
+	for (size_t i = 0; i < _data.size(); i += 64)
+		segments.push_back(_data.cropped(i, 64));
+	std::vector<h256> hashes = keccak256Many(segments);
+
+	while (hashes.size() > 1)
+	{
+		bytes level;
+		for (h256 const& hash: hashes)
+			level += hash.asBytes();
+		segments.clear();
+		for (size_t i = 0; i < level.size(); i += 64)
+			segments.push_back(bytesConstRef(&level).cropped(i, 64));
+		hashes = keccak256Many(segments);
+	}
+	return hashes.front();
 }
 
-h256 chunkHash(bytesConstRef const _data, bool _forceHigherLevel = false)
+h256 chunkHash(bytesConstRef const _data, bool _forceHigherLevel = false, size_t _parallelism = 1)
 {
 	bytes dataToHash;
 	if (_data.size() < 0x1000)
@@ -89,11 +103,15 @@ h256 chunkHash(bytesConstRef const _data, bool _forceHigherLevel = false)
 		// If remaining size is 0x1000, but maxRepresentedSize is not,
 		// we have to still do one level of the chunk hashes.
 		bool forceHigher = maxRepresentedSize > 0x1000;
-		for (size_t i = 0; i < _data.size(); i += maxRepresentedSize)
-		{
-			size_t size = std::min(maxRepresentedSize, _data.size() - i);
-			dataToHash += chunkHash(_data.cropped(i, size), forceHigher).asBytes();
-		}
+		// The subtrees are independent, so the ones below the root are hashed concurrently.
+		std::vector<h256> subtreeHashes((_data.size() + maxRepresentedSize - 1) / maxRepresentedSize);
+		runInParallel(_parallelism, subtreeHashes.size(), [&](size_t _index) {
+			size_t offset = _index * maxRepresentedSize;
+			size_t size = std::min(maxRepresentedSize, _data.size() - offset);
+			subtreeHashes[_index] = chunkHash(_data.cropped(offset, size), forceHigher);
+		});
+		for (h256 const& hash: subtreeHashes)
+			dataToHash += hash.asBytes();
 	}
 
 	dataToHash.resize(0x1000, 0);
@@ -109,9 +127,9 @@ h256 solidity::util::bzzr0Hash(std::string const& _input)
 }
 
 
-h256 solidity::util::bzzr1Hash(bytes const& _input)
+h256 solidity::util::bzzr1Hash(bytes const& _input, size_t _parallelism)
 {
 	if (_input.empty())
 		return h256{};
-	return chunkHash(&_input);
+	return chunkHash(&_input, false, _parallelism);
 }
@@ -31,11 +31,12 @@ namespace solidity::util
 h256 bzzr0Hash(std::string const& _input);
 
 /// Compute the "bzz hash" of @a _input (the NEW binary / BMT version)
-h256 bzzr1Hash(bytes const& _input);
+/// The subtrees below the root of large inputs are hashed on up to @a _parallelism threads.
+h256 bzzr1Hash(bytes const& _input, size_t _parallelism = 1);
 
-inline h256 bzzr1Hash(std::string const& _input)
+inline h256 bzzr1Hash(std::string const& _input, size_t _parallelism = 1)
 {
-	return bzzr1Hash(asBytes(_input));
+	return bzzr1Hash(asBytes(_input), _parallelism);
 }
 
 }
@@ -25,15 +25,55 @@
 #include <libsolutil/Whiskers.h>
 
 #include <libsolutil/Assertions.h>
+#include <libsolutil/CommonData.h>
 
+#include <algorithm>
+#include <mutex>
 #include <regex>
+#include <set>
+#include <unordered_map>
 
 using namespace solidity::util;
 
+struct Whiskers::Template
+{
+	struct Node
+	{
+		enum class Kind { Text, Parameter, List, Condition };
+		Kind kind;
+		/// Literal text for Kind::Text, otherwise the name of the parameter.
+		/// For conditional value parameters, the name includes the leading "+".
+		std::string text;
+		/// Body of a list or the part of a condition used if it is true.
+		std::shared_ptr<Template const> body = {};
+		/// Part of a condition used if it is false, null if there is none.
+		std::shared_ptr<Template const> elseBody = {};
+	};
+
+	std::string source;
+	std::vector<Node> nodes;
+	/// Contents of all "<...>" sequences in the source, used to check that tags exist.
+	std::set<std::string> tags;
+};
+
+namespace
+{
+
+bool isParameterCharacter(char _c)
+{
+	return
+		('a' <= _c && _c <= 'z') ||
+		('A' <= _c && _c <= 'Z') ||
+		('0' <= _c && _c <= '9') ||
+		_c == '_' || _c == '$' || _c == '-';
+}
+
+}
+
 Whiskers::Whiskers(std::string _template):
-	m_template(std::move(_template))
+	m_template(std::move(_template)),
+	m_compiled(compile(m_template))
 {
-	checkTemplateValid();
 }
 
 Whiskers& Whiskers::operator()(std::string _parameter, std::string _value)
@@ -71,15 +111,21 @@ Whiskers& Whiskers::operator()(
 
 std::string Whiskers::render() const
 {
-	return replace(m_template, m_parameters, m_conditions, m_listParameters);
+	size_t expectedSize = m_template.size();
+	for (auto const& parameter: m_parameters)
+		expectedSize += parameter.second.size();
+	std::string result;
+	result.reserve(expectedSize);
+	render(*m_compiled, m_parameters, nullptr, m_conditions, &m_listParameters, result);
+	return result;
 }
 
-void Whiskers::checkTemplateValid() const
+void Whiskers::checkTemplateValid(std::string const& _template)
 {
-	std::regex validTemplate("<[#?!\\/]\\+{0,1}[a-zA-Z0-9_$-]+(?:[^a-zA-Z0-9_$>-]|$)");
+	static std::regex const validTemplate("<[#?!\\/]\\+{0,1}[a-zA-Z0-9_$-]+(?:[^a-zA-Z0-9_$>-]|$)");
 	std::smatch match;
 	assertThrow(
-		!regex_search(m_template, match, validTemplate),
+		!regex_search(_template, match, validTemplate),
 		WhiskersError,
 		"Template contains an invalid/unclosed tag " + match.str()
 	);
@@ -87,9 +133,8 @@ void Whiskers::checkTemplateValid() const
 
 void Whiskers::checkParameterValid(std::string const& _parameter) const
 {
-	static std::regex validParam("^" + paramRegex() + "$");
 	assertThrow(
-		regex_match(_parameter, validParam),
+		!_parameter.empty() && std::all_of(_parameter.begin(), _parameter.end(), isParameterCharacter),
 		WhiskersError,
 		"Parameter" + _parameter + " contains invalid characters."
 	);
@@ -117,127 +162,204 @@ void Whiskers::checkParameterUnknown(std::string const& _parameter) const
 void Whiskers::checkTemplateContainsTags(std::string const& _parameter, std::vector<std::string> const& _prefixes) const
 {
 	for (auto const& prefix: _prefixes)
-	{
-		std::string tag{"<" + prefix + _parameter + ">"};
 		assertThrow(
-			m_template.find(tag) != std::string::npos,
+			m_compiled->tags.count(prefix + _parameter),
 			WhiskersError,
-			"Tag '" + tag + "' not found in template:\n" + m_template
+			"Tag '<" + prefix + _parameter + ">' not found in template:\n" + m_template
 		);
-	}
 }
 
-namespace
+std::shared_ptr<Whiskers::Template const> Whiskers::compile(std::string const& _template)
 {
-template<class ReplaceCallback>
-std::string regex_replace(
-	std::string const& _source,
-	std::regex const& _pattern,
-	ReplaceCallback _replace,
-	std::regex_constants::match_flag_type _flags = std::regex_constants::match_default
-)
+	// Templates are almost always string literals, so the number of distinct
+	// ones is small. The limit only guards against unbounded growth otherwise.
+	static size_t constexpr maxCachedTemplates = 4096;
+	static std::mutex mutex;
+	static std::unordered_map<std::string, std::shared_ptr<Template const>> cache;
+
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		if (auto const* compiled = valueOrNullptr(cache, _template))
+			return *compiled;
+	}
+
+	checkTemplateValid(_template);
+	std::shared_ptr<Template const> compiled = parse(_template);
+
+	std::lock_guard<std::mutex> lock(mutex);
+	if (cache.size() >= maxCachedTemplates)
+		cache.clear();
+	cache.emplace(_template, compiled);
+	return compiled;
+}
+
+std::shared_ptr<Whiskers::Template const> Whiskers::parse(std::string _source)
 {
-	std::sregex_iterator curMatch(_source.begin(), _source.end(), _pattern, _flags);
-	std::sregex_iterator matchEnd;
-	std::string::const_iterator lastMatchedPos(_source.cbegin());
-	std::string result;
-	while (curMatch != matchEnd)
+	auto result = std::make_shared<Template>();
+	result->source = std::move(_source);
+	std::string const& source = result->source;
+	using Node = Template::Node;
+
+	for (size_t open = source.find('<'); open != std::string::npos; open = source.find('<', open + 1))
+	{
+		size_t close = source.find_first_of("<>", open + 1);
+		if (close != std::string::npos && source[close] == '>')
+			result->tags.insert(source.substr(open + 1, close - open - 1));
+	}
+
+	// A tag is only recognized if it is complete, i.e. for lists and conditions,
+	// if the closing tag exists. Everything else is kept as literal text.
+	size_t textStart = 0;
+	auto appendText = [&](size_t _end) {
+		if (_end > textStart)
+			result->nodes.push_back({Node::Kind::Text, source.substr(textStart, _end - textStart)});
+	};
+	for (size_t position = source.find('<'); position != std::string::npos; position = source.find('<', position))
 	{
-		result.append(curMatch->prefix().first, curMatch->prefix().second);
-		result.append(_replace(*curMatch));
-		lastMatchedPos = (*curMatch)[0].second;
-		++curMatch;
+		size_t nameStart = position + 1;
+		char const kind = nameStart < source.size() ? source[nameStart] : '\0';
+		if (kind == '#' || kind == '?')
+			nameStart++;
+		size_t nameEnd = nameStart;
+		if (kind == '?' && nameEnd < source.size() && source[nameEnd] == '+')
+			nameEnd++;
+		size_t const identifierStart = nameEnd;
+		while (nameEnd < source.size() && isParameterCharacter(source[nameEnd]))
+			nameEnd++;
+		if (nameEnd == identifierStart || nameEnd == source.size() || source[nameEnd] != '>')
+		{
+			position++;
+			continue;
+		}
+
+		std::string name = source.substr(nameStart, nameEnd - nameStart);
+		size_t const bodyStart = nameEnd + 1;
+		if (kind != '#' && kind != '?')
+		{
+			appendText(position);
+			result->nodes.push_back({Node::Kind::Parameter, std::move(name)});
+			position = textStart = bodyStart;
+			continue;
+		}
+
+		std::string const closingTag = "</" + name + ">";
+		size_t const closingTagPosition = source.find(closingTag, bodyStart);
+		if (closingTagPosition == std::string::npos)
+		{
+			position++;
+			continue;
+		}
+
+		appendText(position);
+		if (kind == '#')
+			result->nodes.push_back({
+				Node::Kind::List,
+				std::move(name),
+				parse(source.substr(bodyStart, closingTagPosition - bodyStart))
+			});
+		else
+		{
+			std::string const elseTag = "<!" + name + ">";
+			size_t const elseTagPosition = source.find(elseTag, bodyStart);
+			if (elseTagPosition < closingTagPosition)
+			{
+				size_t const elseStart = elseTagPosition + elseTag.size();
+				result->nodes.push_back({
+					Node::Kind::Condition,
+					std::move(name),
+					parse(source.substr(bodyStart, elseTagPosition - bodyStart)),
+					parse(source.substr(elseStart, closingTagPosition - elseStart))
+				});
+			}
+			else
+				result->nodes.push_back({
+					Node::Kind::Condition,
+					std::move(name),
+					parse(source.substr(bodyStart, closingTagPosition - bodyStart))
+				});
+		}
+		position = textStart = closingTagPosition + closingTag.size();
 	}
-	result.append(lastMatchedPos, _source.cend());
+	appendText(source.size());
+
 	return result;
 }
-}
 
-std::string Whiskers::replace(
-	std::string const& _template,
+void Whiskers::render(
+	Template const& _template,
 	StringMap const& _parameters,
+	StringMap const* _listElement,
 	std::map<std::string, bool> const& _conditions,
-	std::map<std::string, std::vector<StringMap>> const& _listParameters
+	StringListMap const* _listParameters,
+	std::string& _output
 )
 {
-	static std::regex listOrTag(
-		"<(" + paramRegex() + ")>|"
-		"<#(" + paramRegex() + ")>((?:.|\\r|\\n)*?)</\\2>|"
-		"<\\?(\\+?" + paramRegex() + ")>((?:.|\\r|\\n)*?)(<!\\4>((?:.|\\r|\\n)*?))?</\\4>"
-	);
-	return regex_replace(_template, listOrTag, [&](std::match_results<std::string::const_iterator> _match) -> std::string
-	{
-		std::string tagName(_match[1]);
-		std::string listName(_match[2]);
-		std::string conditionName(_match[4]);
-		if (!tagName.empty())
+	auto findParameter = [&](std::string const& _name) -> std::string const* {
+		if (_listElement)
+			if (std::string const* value = valueOrNullptr(*_listElement, _name))
+				return value;
+		return valueOrNullptr(_parameters, _name);
+	};
+
+	for (Template::Node const& node: _template.nodes)
+		switch (node.kind)
 		{
+		case Template::Node::Kind::Text:
+			_output += node.text;
+			break;
+		case Template::Node::Kind::Parameter:
+		{
+			std::string const* value = findParameter(node.text);
 			assertThrow(
-				_parameters.count(tagName),
+				value,
 				WhiskersError,
-				"Value for tag " + tagName + " not provided.\n" +
+				"Value for tag " + node.text + " not provided.\n" +
 				"Template:\n" +
-				_template
+				_template.source
 			);
-			return _parameters.at(tagName);
+			_output += *value;
+			break;
 		}
-		else if (!listName.empty())
+		case Template::Node::Kind::List:
 		{
-			std::string templ(_match[3]);
-			assertThrow(
-				_listParameters.count(listName),
-				WhiskersError, "List parameter " + listName + " not set."
-			);
-			std::string replacement;
-			for (auto const& parameters: _listParameters.at(listName))
-				replacement += replace(templ, joinMaps(_parameters, parameters), _conditions);
-			return replacement;
+			std::vector<StringMap> const* elements =
+				_listParameters ? valueOrNullptr(*_listParameters, node.text) : nullptr;
+			assertThrow(elements, WhiskersError, "List parameter " + node.text + " not set.");
+			for (StringMap const& element: *elements)
+			{
+				for (auto const& parameter: element)
+					assertThrow(
+						!_parameters.count(parameter.first),
+						WhiskersError,
+						"Parameter collision"
+					);
+				render(*node.body, _parameters, &element, _conditions, nullptr, _output);
+			}
+			break;
 		}
-		else
+		case Template::Node::Kind::Condition:
 		{
-			assertThrow(!conditionName.empty(), WhiskersError, "");
 			bool conditionValue = false;
-			if (conditionName[0] == '+')
+			if (node.text[0] == '+')
 			{
-				std::string tag = conditionName.substr(1);
+				std::string tag = node.text.substr(1);
 
-				if (_parameters.count(tag))
-					conditionValue = !_parameters.at(tag).empty();
-				else if (_listParameters.count(tag))
-					conditionValue = !_listParameters.at(tag).empty();
+				if (std::string const* value = findParameter(tag))
+					conditionValue = !value->empty();
+				else if (auto const* list = _listParameters ? valueOrNullptr(*_listParameters, tag) : nullptr)
+					conditionValue = !list->empty();
 				else
 					assertThrow(false, WhiskersError, "Tag " + tag + " used as condition but was not set.");
 			}
 			else
 			{
-				assertThrow(
-					_conditions.count(conditionName),
-					WhiskersError, "Condition parameter " + conditionName + " not set."
-				);
-				conditionValue = _conditions.at(conditionName);
+				bool const* value = valueOrNullptr(_conditions, node.text);
+				assertThrow(value, WhiskersError, "Condition parameter " + node.text + " not set.");
+				conditionValue = *value;
 			}
-			return replace(
-				conditionValue ? _match[5] : _match[7],
-				_parameters,
-				_conditions,
-				_listParameters
-			);
+			if (Template const* branch = conditionValue ? node.body.get() : node.elseBody.get())
+				render(*branch, _parameters, _listElement, _conditions, _listParameters, _output);
+			break;
+		}
 		}
-	});
-}
-
-Whiskers::StringMap Whiskers::joinMaps(
-	Whiskers::StringMap const& _a,
-	Whiskers::StringMap const& _b
-)
-{
-	Whiskers::StringMap ret = _a;
-	for (auto const& x: _b)
-		assertThrow(
-			ret.insert(x).second,
-			WhiskersError,
-			"Parameter collision"
-		);
-	return ret;
 }
-
@@ -26,8 +26,9 @@
 
 #include <libsolutil/Exceptions.h>
 
-#include <string>
 #include <map>
+#include <memory>
+#include <string>
 #include <vector>
 
 namespace solidity::util
@@ -67,6 +68,9 @@ DEV_SIMPLE_EXCEPTION(WhiskersError);
  *    Works similar to a conditional parameter where the checked condition is
  *    that the string or list parameter called "name" is non-empty or contains
  *    no elements respectively.
+ *
+ * Templates are parsed only once per distinct template string and the parsed
+ * form is shared between all instances using the same template.
  */
 class Whiskers
 {
@@ -90,9 +94,12 @@ public:
 	std::string render() const;
 
 private:
+	/// Parsed form of a template, defined in Whiskers.cpp.
+	struct Template;
+
 	// Prevent implicit cast to bool
 	Whiskers& operator()(std::string _parameter, long long);
-	void checkTemplateValid() const;
+	static void checkTemplateValid(std::string const& _template);
 	void checkParameterValid(std::string const& _parameter) const;
 	void checkParameterUnknown(std::string const& _parameter) const;
 
@@ -102,19 +109,27 @@ private:
 	///        like `"<" + element + _parameter + ">"`. Each element of _prefixes is used as a prefix of the tag name.
 	void checkTemplateContainsTags(std::string const& _parameter, std::vector<std::string> const& _prefixes) const;
 
-	static std::string replace(
-		std::string const& _template,
+	/// @returns the parsed form of @a _template, parsing and validating it only
+	/// if it has not been seen before.
+	static std::shared_ptr<Template const> compile(std::string const& _template);
+	/// Splits @a _source into literal text, parameters, lists and conditions.
+	static std::shared_ptr<Template const> parse(std::string _source);
+
+	/// Appends the expansion of @a _template to @a _output.
+	/// @param _listElement the parameters of the current list element, if inside a list.
+	///        They take precedence over @a _parameters. Lists cannot be nested, so
+	///        @a _listParameters is null in that case.
+	static void render(
+		Template const& _template,
 		StringMap const& _parameters,
+		StringMap const* _listElement,
 		std::map<std::string, bool> const& _conditions,
-		StringListMap const& _listParameters = StringListMap()
+		StringListMap const* _listParameters,
+		std::string& _output
 	);
 
-	static std::string paramRegex() { return "[a-zA-Z0-9_$-]+"; }
-
-	/// Joins the two maps throwing an exception if two keys are equal.
-	static StringMap joinMaps(StringMap const& _a, StringMap const& _b);
-
 	std::string m_template;
+	std::shared_ptr<Template const> m_compiled;
 	StringMap m_parameters;
 	std::map<std::string, bool> m_conditions;
 	StringListMap m_listParameters;
@@ -31,7 +31,7 @@ namespace solidity::yul
 
 Json AsmJsonConverter::operator()(Block const& _node) const
 {
-	Json ret = createAstNode(originLocationOf(_node), nativeLocationOf(_node), "YulBlock");
+	Json ret = createAstNode(_node.debugData, "YulBlock");
 	ret["statements"] = vectorOfVariantsToJson(_node.statements);
 	return ret;
 }
@@ -39,7 +39,7 @@ Json AsmJsonConverter::operator()(Block const& _node) const
 Json AsmJsonConverter::operator()(TypedName const& _node) const
 {
 	yulAssert(!_node.name.empty(), "Invalid variable name.");
-	Json ret = createAstNode(originLocationOf(_node), nativeLocationOf(_node), "YulTypedName");
+	Json ret = createAstNode(_node.debugData, "YulTypedName");
 	ret["name"] = _node.name.str();
 	ret["type"] = _node.type.str();
 	return ret;
@@ -47,7 +47,7 @@ Json AsmJsonConverter::operator()(TypedName const& _node) const
 
 Json AsmJsonConverter::operator()(Literal const& _node) const
 {
-	Json ret = createAstNode(originLocationOf(_node), nativeLocationOf(_node), "YulLiteral");
+	Json ret = createAstNode(_node.debugData, "YulLiteral");
 	switch (_node.kind)
 	{
 	case LiteralKind::Number:
@@ -74,7 +74,7 @@ Json AsmJsonConverter::operator()(Literal const& _node) const
 Json AsmJsonConverter::operator()(Identifier const& _node) const
 {
 	yulAssert(!_node.name.empty(), "Invalid identifier");
-	Json ret = createAstNode(originLocationOf(_node), nativeLocationOf(_node), "YulIdentifier");
+	Json ret = createAstNode(_node.debugData, "YulIdentifier");
 	ret["name"] = _node.name.str();
 	return ret;
 }
@@ -82,7 +82,7 @@ Json AsmJsonConverter::operator()(Identifier const& _node) const
 Json AsmJsonConverter::operator()(Assignment const& _node) const
 {
 	yulAssert(_node.variableNames.size() >= 1, "Invalid assignment syntax");
-	Json ret = createAstNode(originLocationOf(_node), nativeLocationOf(_node), "YulAssignment");
+	Json ret = createAstNode(_node.debugData, "YulAssignment");
 	for (auto const& var: _node.variableNames)
 		ret["variableNames"].emplace_back((*this)(var));
 	ret["value"] = _node.value ? std::visit(*this, *_node.value) : Json();
@@ -91,7 +91,7 @@ Json AsmJsonConverter::operator()(Assignment const& _node) const
 
 Json AsmJsonConverter::operator()(FunctionCall const& _node) const
 {
-	Json ret = createAstNode(originLocationOf(_node), nativeLocationOf(_node), "YulFunctionCall");
+	Json ret = createAstNode(_node.debugData, "YulFunctionCall");
 	ret["functionName"] = (*this)(_node.functionName);
 	ret["arguments"] = vectorOfVariantsToJson(_node.arguments);
 	return ret;
@@ -99,14 +99,14 @@ Json AsmJsonConverter::operator()(FunctionCall const& _node) const
 
 Json AsmJsonConverter::operator()(ExpressionStatement const& _node) const
 {
-	Json ret = createAstNode(originLocationOf(_node), nativeLocationOf(_node), "YulExpressionStatement");
+	Json ret = createAstNode(_node.debugData, "YulExpressionStatement");
 	ret["expression"] = std::visit(*this, _node.expression);
 	return ret;
 }
 
 Json AsmJsonConverter::operator()(VariableDeclaration const& _node) const
 {
-	Json ret = createAstNode(originLocationOf(_node), nativeLocationOf(_node), "YulVariableDeclaration");
+	Json ret = createAstNode(_node.debugData, "YulVariableDeclaration");
 	for (auto const& var: _node.variables)
 		ret["variables"].emplace_back((*this)(var));
 	ret["value"] = _node.value ? std::visit(*this, *_node.value) : Json();
@@ -116,7 +116,7 @@ Json AsmJsonConverter::operator()(VariableDeclaration const& _node) const
 Json AsmJsonConverter::operator()(FunctionDefinition const& _node) const
 {
 	yulAssert(!_node.name.empty(), "Invalid function name.");
-	Json ret = createAstNode(originLocationOf(_node), nativeLocationOf(_node), "YulFunctionDefinition");
+	Json ret = createAstNode(_node.debugData, "YulFunctionDefinition");
 	ret["name"] = _node.name.str();
 	for (auto const& var: _node.parameters)
 		ret["parameters"].emplace_back((*this)(var));
@@ -129,7 +129,7 @@ Json AsmJsonConverter::operator()(FunctionDefinition const& _node) const
 Json AsmJsonConverter::operator()(If const& _node) const
 {
 	yulAssert(_node.condition, "Invalid if condition.");
-	Json ret = createAstNode(originLocationOf(_node), nativeLocationOf(_node), "YulIf");
+	Json ret = createAstNode(_node.debugData, "YulIf");
 	ret["condition"] = std::visit(*this, *_node.condition);
 	ret["body"] = (*this)(_node.body);
 	return ret;
@@ -138,7 +138,7 @@ Json AsmJsonConverter::operator()(If const& _node) const
 Json AsmJsonConverter::operator()(Switch const& _node) const
 {
 	yulAssert(_node.expression, "Invalid expression pointer.");
-	Json ret = createAstNode(originLocationOf(_node), nativeLocationOf(_node), "YulSwitch");
+	Json ret = createAstNode(_node.debugData, "YulSwitch");
 	ret["expression"] = std::visit(*this, *_node.expression);
 	for (auto const& var: _node.cases)
 		ret["cases"].emplace_back((*this)(var));
@@ -147,7 +147,7 @@ Json AsmJsonConverter::operator()(Switch const& _node) const
 
 Json AsmJsonConverter::operator()(Case const& _node) const
 {
-	Json ret = createAstNode(originLocationOf(_node), nativeLocationOf(_node), "YulCase");
+	Json ret = createAstNode(_node.debugData, "YulCase");
 	ret["value"] = _node.value ? (*this)(*_node.value) : "default";
 	ret["body"] = (*this)(_node.body);
 	return ret;
@@ -156,7 +156,7 @@ Json AsmJsonConverter::operator()(Case const& _node) const
 Json AsmJsonConverter::operator()(ForLoop const& _node) const
 {
 	yulAssert(_node.condition, "Invalid for loop condition.");
-	Json ret = createAstNode(originLocationOf(_node), nativeLocationOf(_node), "YulForLoop");
+	Json ret = createAstNode(_node.debugData, "YulForLoop");
 	ret["pre"] = (*this)(_node.pre);
 	ret["condition"] = std::visit(*this, *_node.condition);
 	ret["post"] = (*this)(_node.post);
@@ -166,33 +166,52 @@ Json AsmJsonConverter::operator()(ForLoop const& _node) const
 
 Json AsmJsonConverter::operator()(Break const& _node) const
 {
-	return createAstNode(originLocationOf(_node), nativeLocationOf(_node), "YulBreak");
+	return createAstNode(_node.debugData, "YulBreak");
 }
 
 Json AsmJsonConverter::operator()(Continue const& _node) const
 {
-	return createAstNode(originLocationOf(_node), nativeLocationOf(_node), "YulContinue");
+	return createAstNode(_node.debugData, "YulContinue");
 }
 
 Json AsmJsonConverter::operator()(Leave const& _node) const
 {
-	return createAstNode(originLocationOf(_node), nativeLocationOf(_node), "YulLeave");
+	return createAstNode(_node.debugData, "YulLeave");
 }
 
-Json AsmJsonConverter::createAstNode(langutil::SourceLocation const& _originLocation, langutil::SourceLocation const& _nativeLocation, std::string _nodeType) const
+Json AsmJsonConverter::createAstNode(langutil::DebugData::ConstPtr const& _debugData, std::string _nodeType) const
 {
+	auto const& [src, nativeSrc] = locations(_debugData.get());
 	Json ret;
 	ret["nodeType"] = std::move(_nodeType);
-	auto srcLocation = [&](int start, int end) -> std::string
-	{
-		int length = (start >= 0 && end >= 0 && end >= start) ? end - start : -1;
-		return std::to_string(start) + ":" + std::to_string(length) + ":" + (m_sourceIndex.has_value() ? std::to_string(m_sourceIndex.value()) : "-1");
-	};
-	ret["src"] = srcLocation(_originLocation.start, _originLocation.end);
-	ret["nativeSrc"] = srcLocation(_nativeLocation.start, _nativeLocation.end);
+	ret["src"] = src;
+	ret["nativeSrc"] = nativeSrc;
 	return ret;
 }
 
+std::pair<std::string, std::string> const& AsmJsonConverter::locations(langutil::DebugData const* _debugData) const
+{
+	// The optimizer shares the debug data of a node with the nodes derived from it,
+	// so the same locations are needed many times.
+	auto [it, inserted] = m_locations.try_emplace(_debugData);
+	if (inserted)
+	{
+		auto srcLocation = [&](langutil::SourceLocation const& _location) -> std::string
+		{
+			int start = _location.start;
+			int end = _location.end;
+			int length = (start >= 0 && end >= 0 && end >= start) ? end - start : -1;
+			return std::to_string(start) + ":" + std::to_string(length) + ":" + m_sourceIndexString;
+		};
+		langutil::SourceLocation const emptyLocation;
+		it->second = {
+			srcLocation(_debugData ? _debugData->originLocation : emptyLocation),
+			srcLocation(_debugData ? _debugData->nativeLocation : emptyLocation)
+		};
+	}
+	return it->second;
+}
+
 template <class T>
 Json AsmJsonConverter::vectorOfVariantsToJson(std::vector<T> const& _vec) const
 {
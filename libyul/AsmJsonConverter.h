@@ -24,10 +24,14 @@
 #pragma once
 
 #include <libyul/ASTForward.h>
+#include <liblangutil/DebugData.h>
 #include <liblangutil/SourceLocation.h>
 #include <libsolutil/JSON.h>
 #include <boost/variant/static_visitor.hpp>
 #include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace solidity::yul
@@ -41,7 +45,9 @@ class AsmJsonConverter: public boost::static_visitor<Json>
 public:
 	/// Create a converter to JSON for any block of inline assembly
 	/// @a _sourceIndex to be used to abbreviate source name in the source locations
-	explicit AsmJsonConverter(std::optional<size_t> _sourceIndex): m_sourceIndex(_sourceIndex) {}
+	explicit AsmJsonConverter(std::optional<size_t> _sourceIndex):
+		m_sourceIndexString(_sourceIndex.has_value() ? std::to_string(*_sourceIndex) : "-1")
+	{}
 
 	Json operator()(Block const& _node) const;
 	Json operator()(TypedName const& _node) const;
@@ -62,11 +68,15 @@ public:
 	Json operator()(Label const& _node) const;
 
 private:
-	Json createAstNode(langutil::SourceLocation const& _originLocation, langutil::SourceLocation const& _nativeLocation, std::string _nodeType) const;
+	Json createAstNode(langutil::DebugData::ConstPtr const& _debugData, std::string _nodeType) const;
+	/// @returns the values of "src" and "nativeSrc" of nodes with the debug data @a _debugData.
+	std::pair<std::string, std::string> const& locations(langutil::DebugData const* _debugData) const;
 	template <class T>
 	Json vectorOfVariantsToJson(std::vector<T> const& vec) const;
 
-	std::optional<size_t> const m_sourceIndex;
+	std::string const m_sourceIndexString;
+	/// Cache of the values of "src" and "nativeSrc" by debug data, only valid while the converted AST exists.
+	mutable std::unordered_map<langutil::DebugData const*, std::pair<std::string, std::string>> m_locations;
 };
 
 }
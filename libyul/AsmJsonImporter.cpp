@@ -45,7 +45,7 @@ SourceLocation const AsmJsonImporter::createSourceLocation(Json const& _node)
 {
 	yulAssert(member(_node, "src").is_string(), "'src' must be a string");
 
-	return solidity::langutil::parseSourceLocation(_node["src"].get<std::string>(), m_sourceNames);
+	return solidity::langutil::parseSourceLocation(_node["src"].get_ref<std::string const&>(), m_sourceNames);
 }
 
 template <class T>
@@ -61,11 +61,11 @@ T AsmJsonImporter::createAsmNode(Json const& _node)
 	return r;
 }
 
-Json AsmJsonImporter::member(Json const& _node, std::string const& _name)
+Json const& AsmJsonImporter::member(Json const& _node, std::string const& _name)
 {
-	if (!_node.contains(_name))
-		return Json();
-	return _node[_name];
+	static Json const null;
+	auto it = _node.find(_name);
+	return it != _node.end() ? *it : null;
 }
 
 TypedName AsmJsonImporter::createTypedName(Json const& _node)
@@ -78,7 +78,7 @@ TypedName AsmJsonImporter::createTypedName(Json const& _node)
 
 Statement AsmJsonImporter::createStatement(Json const& _node)
 {
-	Json jsonNodeType = member(_node, "nodeType");
+	Json const& jsonNodeType = member(_node, "nodeType");
 	yulAssert(jsonNodeType.is_string(), "Expected \"nodeType\" to be of type string!");
 	std::string nodeType = jsonNodeType.get<std::string>();
 
@@ -116,7 +116,7 @@ Statement AsmJsonImporter::createStatement(Json const& _node)
 
 Expression AsmJsonImporter::createExpression(Json const& _node)
 {
-	Json jsonNodeType = member(_node, "nodeType");
+	Json const& jsonNodeType = member(_node, "nodeType");
 	yulAssert(jsonNodeType.is_string(), "Expected \"nodeType\" to be of type string!");
 	std::string nodeType = jsonNodeType.get<std::string>();
 
@@ -49,7 +49,7 @@ private:
 	T createAsmNode(Json const& _node);
 	/// helper function to access member functions of the JSON
 	/// and throw an error if it does not exist
-	Json member(Json const& _node, std::string const& _name);
+	Json const& member(Json const& _node, std::string const& _name);
 
 	yul::Statement createStatement(Json const& _node);
 	yul::Expression createExpression(Json const& _node);
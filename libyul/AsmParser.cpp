@@ -66,7 +66,7 @@ langutil::DebugData::ConstPtr Parser::createDebugData() const
 		case UseSourceLocationFrom::Scanner:
 			return DebugData::create(ParserBase::currentLocation(), ParserBase::currentLocation());
 		case UseSourceLocationFrom::LocationOverride:
-			return DebugData::create(m_locationOverride, m_locationOverride);
+			return m_locationOverrideDebugData;
 		case UseSourceLocationFrom::Comments:
 			return DebugData::create(ParserBase::currentLocation(), m_locationFromComment, m_astIDFromComment);
 	}
@@ -152,6 +152,12 @@ void Parser::fetchDebugDataFromComment()
 	);
 
 	std::string_view commentLiteral = m_scanner->currentCommentLiteral();
+	// Fast path for the common case of a token without a tagged comment in front of it.
+	if (commentLiteral.find('@') == std::string_view::npos)
+	{
+		m_astIDFromComment = std::nullopt;
+		return;
+	}
 	std::match_results<std::string_view::const_iterator> match;
 
 	langutil::SourceLocation originLocation = m_locationFromComment;
@@ -66,7 +66,10 @@ public:
 			UseSourceLocationFrom::LocationOverride :
 			UseSourceLocationFrom::Scanner
 		}
-	{}
+	{
+		if (_locationOverride)
+			m_locationOverrideDebugData = langutil::DebugData::create(m_locationOverride, m_locationOverride);
+	}
 
 	/// Constructs a Yul parser that is using the debug data
 	/// from the comments (via @src and other tags).
@@ -158,6 +161,8 @@ private:
 
 	std::optional<std::map<unsigned, std::shared_ptr<std::string const>>> m_sourceNames;
 	langutil::SourceLocation m_locationOverride;
+	/// Debug data shared by all nodes if the location is overridden.
+	langutil::DebugData::ConstPtr m_locationOverrideDebugData;
 	langutil::SourceLocation m_locationFromComment;
 	std::optional<int64_t> m_astIDFromComment;
 	UseSourceLocationFrom m_useSourceLocationFrom = UseSourceLocationFrom::Scanner;
@@ -29,219 +29,297 @@
 #include <libsolutil/CommonData.h>
 #include <libsolutil/StringUtils.h>
 
-#include <boost/algorithm/string.hpp>
 #include <boost/algorithm/string/replace.hpp>
 
-#include <range/v3/view/transform.hpp>
-
 #include <memory>
-#include <functional>
+#include <utility>
 
 using namespace solidity;
 using namespace solidity::langutil;
 using namespace solidity::util;
 using namespace solidity::yul;
 
-std::string AsmPrinter::operator()(Literal const& _literal)
+std::string AsmPrinter::operator()(Literal const& _literal) { return toText(_literal); }
+std::string AsmPrinter::operator()(Identifier const& _identifier) { return toText(_identifier); }
+std::string AsmPrinter::operator()(ExpressionStatement const& _statement) { return toText(_statement); }
+std::string AsmPrinter::operator()(Assignment const& _assignment) { return toText(_assignment); }
+std::string AsmPrinter::operator()(VariableDeclaration const& _variableDeclaration) { return toText(_variableDeclaration); }
+std::string AsmPrinter::operator()(FunctionDefinition const& _functionDefinition) { return toText(_functionDefinition); }
+std::string AsmPrinter::operator()(FunctionCall const& _functionCall) { return toText(_functionCall); }
+std::string AsmPrinter::operator()(If const& _if) { return toText(_if); }
+std::string AsmPrinter::operator()(Switch const& _switch) { return toText(_switch); }
+std::string AsmPrinter::operator()(ForLoop const& _forLoop) { return toText(_forLoop); }
+std::string AsmPrinter::operator()(Break const& _break) { return toText(_break); }
+std::string AsmPrinter::operator()(Continue const& _continue) { return toText(_continue); }
+// '_leave' and '__leave' is reserved in VisualStudio
+std::string AsmPrinter::operator()(Leave const& leave_) { return toText(leave_); }
+std::string AsmPrinter::operator()(Block const& _block) { return toText(_block); }
+
+template <class T>
+std::string AsmPrinter::toText(T const& _node)
+{
+	std::string out;
+	std::swap(out, m_out);
+	size_t const depth = std::exchange(m_depth, 0);
+	print(_node);
+	m_depth = depth;
+	std::swap(out, m_out);
+	return out;
+}
+
+void AsmPrinter::print(Literal const& _literal)
 {
-	std::string const locationComment = formatDebugData(_literal);
+	printDebugData(_literal);
 
 	switch (_literal.kind)
 	{
 	case LiteralKind::Number:
 		yulAssert(isValidDecimal(_literal.value.str()) || isValidHex(_literal.value.str()), "Invalid number literal");
-		return locationComment + _literal.value.str() + appendTypeName(_literal.type);
+		m_out += _literal.value.str();
+		printTypeName(_literal.type);
+		return;
 	case LiteralKind::Boolean:
 		yulAssert(_literal.value == "true"_yulstring || _literal.value == "false"_yulstring, "Invalid bool literal.");
-		return locationComment + ((_literal.value == "true"_yulstring) ? "true" : "false") + appendTypeName(_literal.type, true);
+		m_out += (_literal.value == "true"_yulstring) ? "true" : "false";
+		printTypeName(_literal.type, true);
+		return;
 	case LiteralKind::String:
 		break;
 	}
 
-	return locationComment + escapeAndQuoteString(_literal.value.str()) + appendTypeName(_literal.type);
+	m_out += escapeAndQuoteString(_literal.value.str());
+	printTypeName(_literal.type);
 }
 
-std::string AsmPrinter::operator()(Identifier const& _identifier)
+void AsmPrinter::print(Identifier const& _identifier)
 {
 	yulAssert(!_identifier.name.empty(), "Invalid identifier.");
-	return formatDebugData(_identifier) + _identifier.name.str();
+	printDebugData(_identifier);
+	m_out += _identifier.name.str();
 }
 
-std::string AsmPrinter::operator()(ExpressionStatement const& _statement)
+void AsmPrinter::print(ExpressionStatement const& _statement)
 {
-	std::string const locationComment = formatDebugData(_statement);
-
-	return locationComment + std::visit(*this, _statement.expression);
+	printDebugData(_statement);
+	print(_statement.expression);
 }
 
-std::string AsmPrinter::operator()(Assignment const& _assignment)
+void AsmPrinter::print(Assignment const& _assignment)
 {
-	std::string const locationComment = formatDebugData(_assignment);
+	printDebugData(_assignment);
 
 	yulAssert(_assignment.variableNames.size() >= 1, "");
-	std::string variables = (*this)(_assignment.variableNames.front());
+	print(_assignment.variableNames.front());
 	for (size_t i = 1; i < _assignment.variableNames.size(); ++i)
-		variables += ", " + (*this)(_assignment.variableNames[i]);
+	{
+		m_out += ", ";
+		print(_assignment.variableNames[i]);
+	}
 
-	return locationComment + variables + " := " + std::visit(*this, *_assignment.value);
+	m_out += " := ";
+	print(*_assignment.value);
 }
 
-std::string AsmPrinter::operator()(VariableDeclaration const& _variableDeclaration)
+void AsmPrinter::print(VariableDeclaration const& _variableDeclaration)
 {
-	std::string out = formatDebugData(_variableDeclaration);
-
-	out += "let ";
-	out += boost::algorithm::join(
-		_variableDeclaration.variables | ranges::views::transform(
-			[this](TypedName argument) { return formatTypedName(argument); }
-		),
-		", "
-	);
+	printDebugData(_variableDeclaration);
+
+	m_out += "let ";
+	printTypedNames(_variableDeclaration.variables);
 	if (_variableDeclaration.value)
 	{
-		out += " := ";
-		out += std::visit(*this, *_variableDeclaration.value);
+		m_out += " := ";
+		print(*_variableDeclaration.value);
 	}
-	return out;
 }
 
-std::string AsmPrinter::operator()(FunctionDefinition const& _functionDefinition)
+void AsmPrinter::print(FunctionDefinition const& _functionDefinition)
 {
 	yulAssert(!_functionDefinition.name.empty(), "Invalid function name.");
 
-	std::string out = formatDebugData(_functionDefinition);
-	out += "function " + _functionDefinition.name.str() + "(";
-	out += boost::algorithm::join(
-		_functionDefinition.parameters | ranges::views::transform(
-			[this](TypedName argument) { return formatTypedName(argument); }
-		),
-		", "
-	);
-	out += ")";
+	printDebugData(_functionDefinition);
+	m_out += "function ";
+	m_out += _functionDefinition.name.str();
+	m_out += "(";
+	printTypedNames(_functionDefinition.parameters);
+	m_out += ")";
 	if (!_functionDefinition.returnVariables.empty())
 	{
-		out += " -> ";
-		out += boost::algorithm::join(
-			_functionDefinition.returnVariables | ranges::views::transform(
-				[this](TypedName argument) { return formatTypedName(argument); }
-			),
-			", "
-		);
+		m_out += " -> ";
+		printTypedNames(_functionDefinition.returnVariables);
 	}
 
-	return out + "\n" + (*this)(_functionDefinition.body);
+	newLine();
+	print(_functionDefinition.body);
 }
 
-std::string AsmPrinter::operator()(FunctionCall const& _functionCall)
+void AsmPrinter::print(FunctionCall const& _functionCall)
 {
-	std::string const locationComment = formatDebugData(_functionCall);
-	std::string const functionName = (*this)(_functionCall.functionName);
-	return
-		locationComment +
-		functionName + "(" +
-		boost::algorithm::join(
-			_functionCall.arguments | ranges::views::transform([&](auto&& _node) { return std::visit(*this, _node); }),
-			", " ) +
-		")";
+	printDebugData(_functionCall);
+	print(_functionCall.functionName);
+	m_out += "(";
+	for (size_t i = 0; i < _functionCall.arguments.size(); ++i)
+	{
+		if (i > 0)
+			m_out += ", ";
+		print(_functionCall.arguments[i]);
+	}
+	m_out += ")";
 }
 
-std::string AsmPrinter::operator()(If const& _if)
+void AsmPrinter::print(If const& _if)
 {
 	yulAssert(_if.condition, "Invalid if condition.");
 
-	std::string out = formatDebugData(_if);
-	out += "if " + std::visit(*this, *_if.condition);
-
-	std::string body = (*this)(_if.body);
-	char delim = '\n';
-	if (body.find('\n') == std::string::npos)
-		delim = ' ';
-
-	return out + delim + body;
+	printDebugData(_if);
+	m_out += "if ";
+	print(*_if.condition);
+
+	// The body is put on the same line if it fits on a single one, which is known only after printing it.
+	size_t const delimiter = m_out.size();
+	newLine();
+	size_t const bodyStart = m_out.size();
+	print(_if.body);
+	if (isSingleLine(bodyStart, m_out.size()))
+		m_out.replace(delimiter, bodyStart - delimiter, " ");
 }
 
-std::string AsmPrinter::operator()(Switch const& _switch)
+void AsmPrinter::print(Switch const& _switch)
 {
 	yulAssert(_switch.expression, "Invalid expression pointer.");
 
-	std::string out = formatDebugData(_switch);
-	out += "switch " + std::visit(*this, *_switch.expression);
+	printDebugData(_switch);
+	m_out += "switch ";
+	print(*_switch.expression);
 
 	for (auto const& _case: _switch.cases)
 	{
+		newLine();
 		if (!_case.value)
-			out += "\ndefault ";
+			m_out += "default ";
 		else
-			out += "\ncase " + (*this)(*_case.value) + " ";
-		out += (*this)(_case.body);
+		{
+			m_out += "case ";
+			print(*_case.value);
+			m_out += " ";
+		}
+		print(_case.body);
 	}
-	return out;
 }
 
-std::string AsmPrinter::operator()(ForLoop const& _forLoop)
+void AsmPrinter::print(ForLoop const& _forLoop)
 {
 	yulAssert(_forLoop.condition, "Invalid for loop condition.");
-	std::string const locationComment = formatDebugData(_forLoop);
-
-	std::string pre = (*this)(_forLoop.pre);
-	std::string condition = std::visit(*this, *_forLoop.condition);
-	std::string post = (*this)(_forLoop.post);
-
-	char delim = '\n';
+	printDebugData(_forLoop);
+
+	m_out += "for ";
+	size_t const preStart = m_out.size();
+	print(_forLoop.pre);
+	size_t const preEnd = m_out.size();
+	newLine();
+	size_t const conditionStart = m_out.size();
+	print(*_forLoop.condition);
+	size_t const conditionEnd = m_out.size();
+	newLine();
+	size_t const postStart = m_out.size();
+	print(_forLoop.post);
+	size_t const postEnd = m_out.size();
+
+	// Short headers are put on a single line. Since the delimiters are only replaced
+	// in that case, the text moved is short.
 	if (
-		pre.size() + condition.size() + post.size() < 60 &&
-		pre.find('\n') == std::string::npos &&
-		post.find('\n') == std::string::npos
+		(preEnd - preStart) + (conditionEnd - conditionStart) + (postEnd - postStart) < 60 &&
+		isSingleLine(preStart, preEnd) &&
+		isSingleLine(postStart, postEnd)
 	)
-		delim = ' ';
-	return
-		locationComment +
-		("for " + std::move(pre) + delim + std::move(condition) + delim + std::move(post) + "\n") +
-		(*this)(_forLoop.body);
+	{
+		m_out.replace(conditionEnd, postStart - conditionEnd, " ");
+		m_out.replace(preEnd, conditionStart - preEnd, " ");
+	}
+	newLine();
+	print(_forLoop.body);
 }
 
-std::string AsmPrinter::operator()(Break const& _break)
+void AsmPrinter::print(Break const& _break)
 {
-	return formatDebugData(_break) + "break";
+	printDebugData(_break);
+	m_out += "break";
 }
 
-std::string AsmPrinter::operator()(Continue const& _continue)
+void AsmPrinter::print(Continue const& _continue)
 {
-	return formatDebugData(_continue) + "continue";
+	printDebugData(_continue);
+	m_out += "continue";
 }
 
-// '_leave' and '__leave' is reserved in VisualStudio
-std::string AsmPrinter::operator()(Leave const& leave_)
+void AsmPrinter::print(Leave const& _leave)
 {
-	return formatDebugData(leave_) + "leave";
+	printDebugData(_leave);
+	m_out += "leave";
 }
 
-std::string AsmPrinter::operator()(Block const& _block)
+void AsmPrinter::print(Block const& _block)
 {
-	std::string const locationComment = formatDebugData(_block);
+	printDebugData(_block);
 
 	if (_block.statements.empty())
-		return locationComment + "{ }";
-	std::string body = boost::algorithm::join(
-		_block.statements | ranges::views::transform([&](auto&& _node) { return std::visit(*this, _node); }),
-		"\n"
-	);
-	if (body.size() < 30 && body.find('\n') == std::string::npos)
-		return locationComment + "{ " + body + " }";
+	{
+		m_out += "{ }";
+		return;
+	}
+
+	// The statements are printed on separate lines, unless they turn out to be short
+	// enough for a single line, in which case only a short text has to be moved.
+	m_out += "{";
+	size_t const delimiter = m_out.size();
+	++m_depth;
+	newLine();
+	size_t const bodyStart = m_out.size();
+	for (size_t i = 0; i < _block.statements.size(); ++i)
+	{
+		if (i > 0)
+			newLine();
+		print(_block.statements[i]);
+	}
+	--m_depth;
+
+	if (m_out.size() - bodyStart < 30 && isSingleLine(bodyStart, m_out.size()))
+	{
+		m_out.replace(delimiter, bodyStart - delimiter, " ");
+		m_out += " }";
+	}
 	else
 	{
-		boost::replace_all(body, "\n", "\n    ");
-		return locationComment + "{\n    " + body + "\n}";
+		newLine();
+		m_out += "}";
 	}
 }
 
-std::string AsmPrinter::formatTypedName(TypedName _variable)
+void AsmPrinter::print(Expression const& _expression)
 {
-	yulAssert(!_variable.name.empty(), "Invalid variable name.");
-	return formatDebugData(_variable) + _variable.name.str() + appendTypeName(_variable.type);
+	std::visit([&](auto const& _node) { print(_node); }, _expression);
+}
+
+void AsmPrinter::print(Statement const& _statement)
+{
+	std::visit([&](auto const& _node) { print(_node); }, _statement);
+}
+
+void AsmPrinter::printTypedNames(std::vector<TypedName> const& _variables)
+{
+	for (size_t i = 0; i < _variables.size(); ++i)
+	{
+		TypedName const& variable = _variables[i];
+		yulAssert(!variable.name.empty(), "Invalid variable name.");
+		if (i > 0)
+			m_out += ", ";
+		printDebugData(variable);
+		m_out += variable.name.str();
+		printTypeName(variable.type);
+	}
 }
 
-std::string AsmPrinter::appendTypeName(YulString _type, bool _isBoolLiteral) const
+void AsmPrinter::printTypeName(YulString _type, bool _isBoolLiteral)
 {
 	if (m_dialect && !_type.empty())
 	{
@@ -251,10 +329,11 @@ std::string AsmPrinter::appendTypeName(YulString _type, bool _isBoolLiteral) con
 			// Special case: If we have a bool type but empty default type, do not remove the type.
 			_type = {};
 	}
-	if (_type.empty())
-		return {};
-	else
-		return ":" + _type.str();
+	if (!_type.empty())
+	{
+		m_out += ":";
+		m_out += _type.str();
+	}
 }
 
 std::string AsmPrinter::formatSourceLocation(
@@ -305,15 +384,18 @@ std::string AsmPrinter::formatSourceLocation(
 	return sourceLocation + (solidityCodeSnippet.empty() ? "" : "  ") + solidityCodeSnippet;
 }
 
-std::string AsmPrinter::formatDebugData(langutil::DebugData::ConstPtr const& _debugData, bool _statement)
+void AsmPrinter::printDebugData(langutil::DebugData::ConstPtr const& _debugData, bool _statement)
 {
 	if (!_debugData || m_debugInfoSelection.none())
-		return "";
+		return;
+
+	size_t const commentStart = m_out.size();
+	m_out += _statement ? "/// " : "/** ";
+	size_t const bodyStart = m_out.size();
 
-	std::vector<std::string> items;
 	if (auto id = _debugData->astID)
 		if (m_debugInfoSelection.astID)
-			items.emplace_back("@ast-id " + std::to_string(*id));
+			m_out += "@ast-id " + std::to_string(*id);
 
 	if (
 		m_lastLocation != _debugData->originLocation &&
@@ -322,20 +404,34 @@ std::string AsmPrinter::formatDebugData(langutil::DebugData::ConstPtr const& _de
 	{
 		m_lastLocation = _debugData->originLocation;
 
-		items.emplace_back(formatSourceLocation(
-			_debugData->originLocation,
-			m_nameToSourceIndex,
-			m_debugInfoSelection,
-			m_soliditySourceProvider
-		));
+		auto [formattedLocation, inserted] = m_formattedLocations.try_emplace(_debugData.get());
+		if (inserted)
+			formattedLocation->second = formatSourceLocation(
+				_debugData->originLocation,
+				m_nameToSourceIndex,
+				m_debugInfoSelection,
+				m_soliditySourceProvider
+			);
+		if (m_out.size() > bodyStart)
+			m_out += " ";
+		m_out += formattedLocation->second;
 	}
 
-	std::string commentBody = joinHumanReadable(items, " ");
-	if (commentBody.empty())
-		return "";
+	if (m_out.size() == bodyStart)
+		m_out.resize(commentStart);
+	else if (_statement)
+		newLine();
 	else
-		return
-			_statement ?
-			"/// " + commentBody + "\n" :
-			"/** " + commentBody + " */ ";
+		m_out += " */ ";
+}
+
+void AsmPrinter::newLine()
+{
+	m_out += '\n';
+	m_out.append(4 * m_depth, ' ');
+}
+
+bool AsmPrinter::isSingleLine(size_t _begin, size_t _end) const
+{
+	return m_out.find('\n', _begin) >= _end;
 }
@@ -33,6 +33,7 @@
 #include <liblangutil/DebugData.h>
 
 #include <map>
+#include <unordered_map>
 
 namespace solidity::yul
 {
@@ -91,21 +92,52 @@ public:
 	);
 
 private:
-	std::string formatTypedName(TypedName _variable);
-	std::string appendTypeName(YulString _type, bool _isBoolLiteral = false) const;
-	std::string formatDebugData(langutil::DebugData::ConstPtr const& _debugData, bool _statement);
+	/// Prints @a _node into a fresh output buffer and @returns the buffer.
 	template <class T>
-	std::string formatDebugData(T const& _node)
+	std::string toText(T const& _node);
+
+	/// The functions below append the text of the node to m_out, indenting every new line
+	/// by the nesting depth of the enclosing blocks.
+	void print(Literal const& _literal);
+	void print(Identifier const& _identifier);
+	void print(ExpressionStatement const& _expr);
+	void print(Assignment const& _assignment);
+	void print(VariableDeclaration const& _variableDeclaration);
+	void print(FunctionDefinition const& _functionDefinition);
+	void print(FunctionCall const& _functionCall);
+	void print(If const& _if);
+	void print(Switch const& _switch);
+	void print(ForLoop const& _forLoop);
+	void print(Break const& _break);
+	void print(Continue const& _continue);
+	void print(Leave const& _leave);
+	void print(Block const& _block);
+	void print(Expression const& _expression);
+	void print(Statement const& _statement);
+	void printTypedNames(std::vector<TypedName> const& _variables);
+	void printTypeName(YulString _type, bool _isBoolLiteral = false);
+	void printDebugData(langutil::DebugData::ConstPtr const& _debugData, bool _statement);
+	template <class T>
+	void printDebugData(T const& _node)
 	{
 		bool isExpression = std::is_constructible<Expression, T>::value;
-		return formatDebugData(_node.debugData, !isExpression);
+		printDebugData(_node.debugData, !isExpression);
 	}
+	/// Appends a line break and the indentation of the current nesting depth.
+	void newLine();
+	/// @returns true if the output contains no line break from position @a _begin to @a _end.
+	bool isSingleLine(size_t _begin, size_t _end) const;
 
 	Dialect const* const m_dialect = nullptr;
 	std::map<std::string, unsigned> m_nameToSourceIndex;
 	langutil::SourceLocation m_lastLocation = {};
 	langutil::DebugInfoSelection m_debugInfoSelection = {};
 	langutil::CharStreamProvider const* m_soliditySourceProvider = nullptr;
+	/// Formatted source locations of the debug data printed so far, since the same debug data
+	/// is usually shared by many nodes and formatting the code snippets is expensive.
+	std::unordered_map<langutil::DebugData const*, std::string> m_formattedLocations;
+	std::string m_out;
+	size_t m_depth = 0;
 };
 
 }
@@ -22,6 +22,8 @@
 #include <libyul/Dialect.h>
 #include <libyul/AST.h>
 
+#include <mutex>
+
 using namespace solidity::yul;
 using namespace solidity::langutil;
 
@@ -52,8 +54,11 @@ bool Dialect::validTypeForLiteral(LiteralKind _kind, YulString, YulString _type)
 Dialect const& Dialect::yulDeprecated()
 {
 	static std::unique_ptr<Dialect> dialect;
+	static std::mutex mutex;
 	static YulStringRepository::ResetCallback callback{[&] { dialect.reset(); }};
 
+	std::lock_guard lock(mutex);
+
 	if (!dialect)
 	{
 		// TODO will probably change, especially the list of types.
@@ -81,6 +81,8 @@ struct Dialect
 	virtual BuiltinFunction const* memoryLoadFunction(YulString /* _type */) const { return nullptr; }
 	virtual BuiltinFunction const* storageStoreFunction(YulString /* _type */) const { return nullptr; }
 	virtual BuiltinFunction const* storageLoadFunction(YulString /* _type */) const { return nullptr; }
+	virtual BuiltinFunction const* transientStorageStoreFunction(YulString /* _type */) const { return nullptr; }
+	virtual BuiltinFunction const* transientStorageLoadFunction(YulString /* _type */) const { return nullptr; }
 	virtual YulString hashFunction(YulString /* _type */ ) const { return YulString{}; }
 
 	/// Check whether the given type is legal for the given literal value.
@@ -0,0 +1,57 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <libyul/ObjectOptimizer.h>
+
+#include <libyul/AsmPrinter.h>
+#include <libyul/AST.h>
+#include <libyul/Exceptions.h>
+#include <libyul/Object.h>
+
+#include <libsolutil/Keccak256.h>
+
+using namespace solidity;
+using namespace solidity::langutil;
+using namespace solidity::yul;
+
+util::h256 ObjectOptimizer::cacheKey(Object const& _object, Dialect const& _dialect, std::string const& _settings)
+{
+	yulAssert(_object.code);
+	yulAssert(_object.debugData);
+
+	// Debug information is included since it is preserved by the optimizer.
+	std::string rawKey = _settings + "\n";
+	for (YulString name: _object.qualifiedDataNames())
+		rawKey += name.str() + "\n";
+	rawKey += AsmPrinter(_dialect, _object.debugData->sourceNames, DebugInfoSelection::All())(*_object.code);
+	return util::keccak256(rawKey);
+}
+
+std::shared_ptr<Block const> ObjectOptimizer::cachedCode(util::h256 const& _key) const
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	auto it = m_cachedCode.find(_key);
+	return it != m_cachedCode.end() ? it->second : nullptr;
+}
+
+void ObjectOptimizer::storeCode(util::h256 const& _key, std::shared_ptr<Block const> _code)
+{
+	yulAssert(_code, "");
+	std::lock_guard<std::mutex> lock(m_mutex);
+	m_cachedCode.emplace(_key, std::move(_code));
+}
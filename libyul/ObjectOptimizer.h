@@ -0,0 +1,68 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Cache for the results of optimizing Yul objects.
+ */
+
+#pragma once
+
+#include <libyul/ASTForward.h>
+
+#include <libsolutil/FixedHash.h>
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace solidity::yul
+{
+
+struct Dialect;
+struct Object;
+
+/**
+ * Cache of the optimized code of Yul objects, keyed by their unoptimized code and everything
+ * else the optimizer depends on. It lets the optimizer skip objects that occur more than once,
+ * like the code of a contract that is created by several other contracts and hence copied into
+ * all of them.
+ *
+ * Objects are optimized as a whole because most optimizer steps, e.g. the inliners and the
+ * unused pruner, consider all functions of an object at once. The cache can be shared by
+ * multiple YulStacks and used from multiple threads at the same time.
+ */
+class ObjectOptimizer
+{
+public:
+	/// @returns the key identifying the result of optimizing the code of @a _object in
+	/// @a _dialect with the optimizer settings described by @a _settings.
+	static util::h256 cacheKey(Object const& _object, Dialect const& _dialect, std::string const& _settings);
+
+	/// @returns the optimized code stored under @a _key or nullptr if there is none.
+	/// The code is shared by all objects using it and must not be modified.
+	std::shared_ptr<Block const> cachedCode(util::h256 const& _key) const;
+	/// Stores the optimized code @a _code under @a _key without copying it, i.e. the code
+	/// must not be modified anymore by the object it belongs to.
+	void storeCode(util::h256 const& _key, std::shared_ptr<Block const> _code);
+
+private:
+	mutable std::mutex m_mutex;
+	std::map<util::h256, std::shared_ptr<Block const>> m_cachedCode;
+};
+
+}
@@ -27,10 +27,8 @@
 #include <libsolutil/CommonData.h>
 #include <libsolutil/FixedHash.h>
 
-#include <boost/algorithm/string.hpp>
-
 #include <algorithm>
-#include <sstream>
+#include <string_view>
 #include <vector>
 
 using namespace solidity;
@@ -41,58 +39,74 @@ std::string solidity::yul::reindent(std::string const& _code)
 {
 	int constexpr indentationWidth = 4;
 
-	auto constexpr static countBraces = [](std::string const& _s) noexcept -> int
+	auto constexpr static countBraces = [](std::string_view _s) noexcept -> int
 	{
-		auto const i = _s.find("//");
-		auto const e = i == _s.npos ? end(_s) : next(begin(_s), static_cast<ptrdiff_t>(i));
-		auto const opening = count_if(begin(_s), e, [](auto ch) { return ch == '{' || ch == '('; });
-		auto const closing = count_if(begin(_s), e, [](auto ch) { return ch == '}' || ch == ')'; });
+		std::string_view const code = _s.substr(0, _s.find("//"));
+		auto const opening = std::count_if(code.begin(), code.end(), [](auto ch) { return ch == '{' || ch == '('; });
+		auto const closing = std::count_if(code.begin(), code.end(), [](auto ch) { return ch == '}' || ch == ')'; });
 		return int(opening - closing);
 	};
+	auto constexpr static trim = [](std::string_view _s) noexcept -> std::string_view
+	{
+		auto const isSpace = [](char _ch) { return _ch == ' ' || ('\t' <= _ch && _ch <= '\r'); };
+		while (!_s.empty() && isSpace(_s.front()))
+			_s.remove_prefix(1);
+		while (!_s.empty() && isSpace(_s.back()))
+			_s.remove_suffix(1);
+		return _s;
+	};
 
-	std::vector<std::string> lines;
-	boost::split(lines, _code, boost::is_any_of("\n"));
-	for (std::string& line: lines)
-		boost::trim(line);
-
-	// Reduce multiple consecutive empty lines.
-	lines = fold(lines, std::vector<std::string>{}, [](auto&& _lines, auto&& _line) {
-		if (!(_line.empty() && !_lines.empty() && _lines.back().empty()))
-			_lines.emplace_back(std::move(_line));
-		return std::move(_lines);
-	});
-
-	std::stringstream out;
+	// The lines are processed in place and the result is written into a single buffer,
+	// since this is applied to the complete IR of contracts.
+	std::string out;
+	out.reserve(_code.size());
 	int depth = 0;
-
-	for (std::string const& line: lines)
+	bool previousLineEmpty = false;
+	bool firstLine = true;
+	for (size_t lineStart = 0; lineStart <= _code.size();)
 	{
+		size_t lineEnd = std::min(_code.find('\n', lineStart), _code.size());
+		std::string_view const line = trim(std::string_view(_code).substr(lineStart, lineEnd - lineStart));
+		lineStart = lineEnd + 1;
+
+		// Reduce multiple consecutive empty lines.
+		if (line.empty() && previousLineEmpty && !firstLine)
+			continue;
+		previousLineEmpty = line.empty();
+		firstLine = false;
+
 		int const diff = countBraces(line);
 		if (diff < 0)
 			depth += diff;
 
 		if (!line.empty())
 		{
-			for (int i = 0; i < depth * indentationWidth; ++i)
-				out << ' ';
-			out << line;
+			if (depth > 0)
+				out.append(static_cast<size_t>(depth * indentationWidth), ' ');
+			out += line;
 		}
-		out << '\n';
+		out += '\n';
 
 		if (diff > 0)
 			depth += diff;
 	}
 
-	return out.str();
+	return out;
 }
 
 u256 solidity::yul::valueOfNumberLiteral(Literal const& _literal)
 {
 	yulAssert(_literal.kind == LiteralKind::Number, "Expected number literal!");
 
-	static std::map<YulString, u256> numberCache;
-	static YulStringRepository::ResetCallback callback{[&] { numberCache.clear(); }};
-
+	// Thread-local, so that concurrent optimiser runs do not contend for it.
+	// Reset callbacks cannot refer to thread-local objects, so the generation is checked instead.
+	static thread_local std::map<YulString, u256> numberCache;
+	static thread_local size_t numberCacheGeneration = YulStringRepository::generation();
+	if (numberCacheGeneration != YulStringRepository::generation())
+	{
+		numberCache.clear();
+		numberCacheGeneration = YulStringRepository::generation();
+	}
 	auto&& [it, isNew] = numberCache.try_emplace(_literal.value, 0);
 	if (isNew)
 	{
@@ -30,14 +30,20 @@
 #include <libyul/backends/evm/EVMObjectCompiler.h>
 #include <libyul/backends/evm/EVMMetrics.h>
 #include <libyul/ObjectParser.h>
+#include <libyul/optimiser/ASTCopier.h>
 #include <libyul/optimiser/Semantics.h>
 #include <libyul/optimiser/Suite.h>
 #include <libevmasm/Assembly.h>
 #include <liblangutil/Scanner.h>
+#include <libsolutil/Parallel.h>
+#include <libsolutil/PhaseTracer.h>
 #include <libsolidity/interface/OptimiserSettings.h>
 
 #include <boost/algorithm/string.hpp>
 
+#include <algorithm>
+#include <chrono>
+#include <functional>
 #include <optional>
 
 using namespace solidity;
@@ -73,6 +79,7 @@ CharStream const& YulStack::charStream(std::string const& _sourceName) const
 
 bool YulStack::parseAndAnalyze(std::string const& _sourceName, std::string const& _source)
 {
+	util::PhaseTracer::Scope tracerScope("YulStack::parseAndAnalyze", _sourceName);
 	m_errors.clear();
 	m_analysisSuccessful = false;
 	m_charStream = std::make_unique<CharStream>(_source, _sourceName);
@@ -90,6 +97,9 @@ void YulStack::optimize()
 {
 	yulAssert(m_analysisSuccessful, "Analysis was not successful.");
 	yulAssert(m_parserResult);
+	m_optimizerProfiles.clear();
+	m_optimizerTimeBudgetExceeded = false;
+	util::PhaseTracer::Scope tracerScope("YulStack::optimize");
 
 	if (
 		!m_optimiserSettings.runYulOptimiser &&
@@ -99,7 +109,46 @@ void YulStack::optimize()
 
 	m_analysisSuccessful = false;
 	yulAssert(m_parserResult, "");
-	optimize(*m_parserResult, true);
+
+	std::vector<std::pair<Object*, bool>> objectsToOptimize;
+	collectObjectsToOptimize(*m_parserResult, true, objectsToOptimize);
+	std::vector<OptimiserProfile> profiles(m_optimizerProfiling ? objectsToOptimize.size() : 0);
+	// The optimization of an object only depends on the names of its sub-objects, not on their code,
+	// so all objects can be optimized concurrently. The threads that are not needed for that are
+	// shared by the functions of the objects.
+	size_t const functionParallelism = std::max<size_t>(1, m_parallelism / std::max<size_t>(1, objectsToOptimize.size()));
+	// The budget is shared by all objects.
+	std::optional<OptimiserSuite::TimeBudget> timeBudget;
+	if (m_optimiserSettings.yulOptimiserTimeBudget)
+		timeBudget = OptimiserSuite::TimeBudget{
+			std::chrono::steady_clock::now() + *m_optimiserSettings.yulOptimiserTimeBudget,
+			OptimiserSettings::DefaultYulOptimiserCleanupSteps
+		};
+	std::vector<uint8_t> withinTimeBudget(objectsToOptimize.size(), true);
+	util::runInParallel(m_parallelism, objectsToOptimize.size(), [&](size_t _index) {
+		auto const& [object, isCreation] = objectsToOptimize[_index];
+		withinTimeBudget[_index] = optimize(
+			*object,
+			isCreation,
+			m_optimizerProfiling ? &profiles[_index] : nullptr,
+			functionParallelism,
+			timeBudget
+		);
+	});
+	m_optimizerTimeBudgetExceeded = std::any_of(withinTimeBudget.begin(), withinTimeBudget.end(), [](uint8_t _within) { return !_within; });
+	if (m_optimizerTimeBudgetExceeded)
+		m_errorReporter.warning(
+			6832_error,
+			langutil::SourceLocation{},
+			"The Yul optimizer exceeded the time budget of " +
+			std::to_string(m_optimiserSettings.yulOptimiserTimeBudget->count()) +
+			" ms and skipped the remaining optimization steps. "
+			"The resulting code depends on the speed of the machine."
+		);
+
+	for (size_t index = 0; index < profiles.size(); ++index)
+		if (!profiles[index].steps.empty())
+			m_optimizerProfiles[objectsToOptimize[index].first->name.str()] += profiles[index];
 	yulAssert(analyzeParsed(), "Invalid source code after optimization.");
 }
 
@@ -147,20 +196,43 @@ void YulStack::compileEVM(AbstractAssembly& _assembly, bool _optimize) const
 			break;
 	}
 
-	EVMObjectCompiler::compile(*m_parserResult, _assembly, *dialect, _optimize, m_eofVersion);
+	EVMObjectCompiler::compile(
+		*m_parserResult,
+		_assembly,
+		*dialect,
+		_optimize,
+		m_eofVersion,
+		m_optimiserSettings.exhaustiveStackLayoutSearch
+	);
 }
 
-void YulStack::optimize(Object& _object, bool _isCreation)
+void YulStack::collectObjectsToOptimize(
+	Object& _object,
+	bool _isCreation,
+	std::vector<std::pair<Object*, bool>>& o_objects
+)
 {
-	yulAssert(_object.code, "");
-	yulAssert(_object.analysisInfo, "");
 	for (auto& subNode: _object.subObjects)
 		if (auto subObject = dynamic_cast<Object*>(subNode.get()))
 		{
 			bool isCreation = !boost::ends_with(subObject->name.str(), "_deployed");
-			optimize(*subObject, isCreation);
+			collectObjectsToOptimize(*subObject, isCreation, o_objects);
 		}
+	o_objects.emplace_back(&_object, _isCreation);
+}
+
+bool YulStack::optimize(
+	Object& _object,
+	bool _isCreation,
+	OptimiserProfile* o_profile,
+	size_t _parallelism,
+	std::optional<OptimiserSuite::TimeBudget> const& _timeBudget
+)
+{
+	yulAssert(_object.code, "");
+	yulAssert(_object.analysisInfo, "");
 
+	util::PhaseTracer::Scope tracerScope("OptimiserSuite", _object.name.str());
 	Dialect const& dialect = languageToDialect(m_language, m_evmVersion);
 	std::unique_ptr<GasMeter> meter;
 	if (EVMDialect const* evmDialect = dynamic_cast<EVMDialect const*>(&dialect))
@@ -191,7 +263,41 @@ void YulStack::optimize(Object& _object, bool _isCreation)
 		);
 	}();
 
-	OptimiserSuite::run(
+	std::string cacheSettings =
+		std::to_string(static_cast<int>(m_language)) + "\n" +
+		m_evmVersion.name() + "\n" +
+		(m_eofVersion.has_value() ? std::to_string(*m_eofVersion) : "") + "\n" +
+		(_isCreation ? "creation" : "deployed") + "\n" +
+		(optimizeStackAllocation ? "optimizeStackAllocation" : "") + "\n" +
+		(m_optimiserSettings.exhaustiveStackLayoutSearch ? "exhaustiveStackLayoutSearch" : "") + "\n" +
+		yulOptimiserSteps + "\n" +
+		yulOptimiserCleanupSteps + "\n" +
+		std::to_string(m_optimiserSettings.expectedExecutionsPerDeployment);
+	std::map<YulString, size_t> executionProfile;
+	if (!_isCreation)
+		for (auto const& [function, executions]: m_optimiserSettings.yulExecutionProfile)
+		{
+			cacheSettings += "\n" + function + ":" + std::to_string(executions);
+			executionProfile[YulString{function}] = executions;
+		}
+	util::h256 const cacheKey = ObjectOptimizer::cacheKey(_object, dialect, cacheSettings);
+	if (std::shared_ptr<Block const> cachedCode = m_objectOptimizer->cachedCode(cacheKey))
+	{
+		// The code is shared with the cache instead of being copied, since optimized code is only
+		// analyzed, printed and assembled. The analysis info is recomputed for all objects after
+		// the optimization.
+		_object.code = std::const_pointer_cast<Block>(cachedCode);
+		return true;
+	}
+	// Code shared with the cache is copied before it is optimized again. The optimizer modifies
+	// the code in place, starting with the Disambiguator, so the analysis has to refer to the copy.
+	if (_object.code.use_count() > 1)
+	{
+		_object.code = std::make_shared<Block>(std::get<Block>(ASTCopier{}(*_object.code)));
+		_object.analysisInfo = std::make_shared<AsmAnalysisInfo>(AsmAnalyzer::analyzeStrictAssertCorrect(dialect, _object));
+	}
+
+	bool const withinTimeBudget = OptimiserSuite::run(
 		dialect,
 		meter.get(),
 		_object,
@@ -200,8 +306,18 @@ void YulStack::optimize(Object& _object, bool _isCreation)
 		yulOptimiserSteps,
 		yulOptimiserCleanupSteps,
 		_isCreation ? std::nullopt : std::make_optional(m_optimiserSettings.expectedExecutionsPerDeployment),
-		{}
+		{},
+		o_profile,
+		_parallelism,
+		executionProfile,
+		_timeBudget,
+		m_eofVersion,
+		m_optimiserSettings.exhaustiveStackLayoutSearch
 	);
+	// Code that was not fully optimized must not be reused by other contracts.
+	if (withinTimeBudget)
+		m_objectOptimizer->storeCode(cacheKey, _object.code);
+	return withinTimeBudget;
 }
 
 MachineAssemblyObject YulStack::assemble(Machine _machine) const
@@ -227,8 +343,9 @@ YulStack::assembleWithDeployed(std::optional<std::string_view> _deployName) cons
 	yulAssert(creationAssembly, "");
 	yulAssert(m_charStream, "");
 
+	util::PhaseTracer::Scope tracerScope("Assembly::assemble");
 	MachineAssemblyObject creationObject;
-	creationObject.bytecode = std::make_shared<evmasm::LinkerObject>(creationAssembly->assemble());
+	creationObject.bytecode = std::make_shared<evmasm::LinkerObject>(creationAssembly->assemble(m_parallelism));
 	yulAssert(creationObject.bytecode->immutableReferences.empty(), "Leftover immutables.");
 	creationObject.assembly = creationAssembly->assemblyString(m_debugInfoSelection);
 	creationObject.sourceMappings = std::make_unique<std::string>(
@@ -241,7 +358,7 @@ YulStack::assembleWithDeployed(std::optional<std::string_view> _deployName) cons
 	MachineAssemblyObject deployedObject;
 	if (deployedAssembly)
 	{
-		deployedObject.bytecode = std::make_shared<evmasm::LinkerObject>(deployedAssembly->assemble());
+		deployedObject.bytecode = std::make_shared<evmasm::LinkerObject>(deployedAssembly->assemble(m_parallelism));
 		deployedObject.assembly = deployedAssembly->assemblyString(m_debugInfoSelection);
 		deployedObject.sourceMappings = std::make_unique<std::string>(
 			evmasm::AssemblyItem::computeSourceMapping(
@@ -272,9 +389,17 @@ YulStack::assembleEVMWithDeployed(std::optional<std::string_view> _deployName) c
 		!m_optimiserSettings.runYulOptimiser &&
 		!yul::MSizeFinder::containsMSize(languageToDialect(m_language, m_evmVersion), *m_parserResult)
 	);
-	compileEVM(adapter, optimize);
+	{
+		util::PhaseTracer::Scope tracerScope("CodeTransform");
+		compileEVM(adapter, optimize);
+	}
 
-	assembly.optimise(evmasm::Assembly::OptimiserSettings::translateSettings(m_optimiserSettings, m_evmVersion));
+	{
+		util::PhaseTracer::Scope tracerScope("Assembly::optimise");
+		auto settings = evmasm::Assembly::OptimiserSettings::translateSettings(m_optimiserSettings, m_evmVersion);
+		settings.parallelism = m_parallelism;
+		assembly.optimise(settings);
+	}
 
 	std::optional<size_t> subIndex;
 
@@ -319,6 +444,52 @@ Json YulStack::astJson() const
 	return  m_parserResult->toJson();
 }
 
+Json YulStack::optimizerProfilesJson() const
+{
+	Json result = Json::object();
+	for (auto const& [objectName, profile]: m_optimizerProfiles)
+		result[objectName] = profile.toJson();
+	return result;
+}
+
+Json YulStack::functionGasEstimatesJson(std::map<std::string, unsigned> const& _sourceIndices) const
+{
+	yulAssert(m_analysisSuccessful, "Analysis was not successful.");
+	yulAssert(m_parserResult, "");
+
+	auto const* dialect = dynamic_cast<EVMDialect const*>(&languageToDialect(m_language, m_evmVersion));
+	yulAssert(dialect, "");
+
+	Json result = Json::object();
+	std::function<void(Object const&)> addObject = [&](Object const& _object) {
+		yulAssert(_object.code, "");
+		Json functions = Json::object();
+		std::map<YulString, FunctionDefinition const*> definitions;
+		forEach<FunctionDefinition const>(*_object.code, [&](FunctionDefinition const& _function) {
+			definitions[_function.name] = &_function;
+		});
+		for (auto const& [name, costs]: FunctionGasEstimator::run(*dialect, *_object.code))
+		{
+			Json function;
+			function["gas"] = costs.str();
+			SourceLocation const location = originLocationOf(*definitions.at(name));
+			if (location.hasText())
+				if (auto index = _sourceIndices.find(*location.sourceName); index != _sourceIndices.end())
+					function["src"] =
+						std::to_string(location.start) + ":" +
+						std::to_string(location.end - location.start) + ":" +
+						std::to_string(index->second);
+			functions[name.str()] = std::move(function);
+		}
+		result[_object.name.str()] = std::move(functions);
+		for (auto const& subNode: _object.subObjects)
+			if (auto const* subObject = dynamic_cast<Object const*>(subNode.get()))
+				addObject(*subObject);
+	};
+	addObject(*m_parserResult);
+	return result;
+}
+
 std::shared_ptr<Object> YulStack::parserResult() const
 {
 	yulAssert(m_analysisSuccessful, "Analysis was not successful.");
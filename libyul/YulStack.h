@@ -28,7 +28,9 @@
 #include <libsolutil/JSON.h>
 
 #include <libyul/Object.h>
+#include <libyul/ObjectOptimizer.h>
 #include <libyul/ObjectParser.h>
+#include <libyul/optimiser/Suite.h>
 
 #include <libsolidity/interface/OptimiserSettings.h>
 
@@ -90,6 +92,7 @@ public:
 		m_eofVersion(_eofVersion),
 		m_optimiserSettings(std::move(_optimiserSettings)),
 		m_debugInfoSelection(_debugInfoSelection),
+		m_objectOptimizer(std::make_shared<ObjectOptimizer>()),
 		m_errorReporter(m_errors)
 	{}
 
@@ -100,10 +103,30 @@ public:
 	/// Multiple calls overwrite the previous state.
 	bool parseAndAnalyze(std::string const& _sourceName, std::string const& _source);
 
+	/// Sets the maximum number of threads used to optimize the object and its sub-objects
+	/// concurrently. The output does not depend on this setting.
+	void setParallelism(size_t _jobs) { yulAssert(_jobs >= 1); m_parallelism = _jobs; }
+
+	/// Sets the cache of optimized objects, which can be shared with other stacks to avoid
+	/// optimizing the same object more than once. The output does not depend on this setting.
+	void setObjectOptimizer(std::shared_ptr<ObjectOptimizer> _objectOptimizer)
+	{
+		yulAssert(_objectOptimizer);
+		m_objectOptimizer = std::move(_objectOptimizer);
+	}
+
+	/// Enables collecting the resource usage of the optimizer steps during optimize().
+	void enableOptimizerProfiling(bool _enable = true) { m_optimizerProfiling = _enable; }
+
 	/// Run the optimizer suite. Can only be used with Yul or strict assembly.
 	/// If the settings (see constructor) disabled the optimizer, nothing is done here.
+	/// Reports a warning if the time budget of the settings was exceeded.
 	void optimize();
 
+	/// @returns true if the last call to optimize() exceeded the time budget of the optimizer
+	/// settings and skipped part of the optimization.
+	bool optimizerTimeBudgetExceeded() const { return m_optimizerTimeBudgetExceeded; }
+
 	/// Run the assembly step (should only be called after parseAndAnalyze).
 	MachineAssemblyObject assemble(Machine _machine) const;
 
@@ -132,6 +155,14 @@ public:
 		langutil::CharStreamProvider const* _soliditySourceProvider = nullptr
 	) const;
 	Json astJson() const;
+	/// @returns the resource usage of the optimizer steps by object name, if optimizer profiling
+	/// was enabled. Objects whose optimized code was reused from the cache are not included.
+	std::map<std::string, OptimiserProfile> const& optimizerProfiles() const { return m_optimizerProfiles; }
+	Json optimizerProfilesJson() const;
+	/// @returns the estimated gas costs of running each function once by object name and function
+	/// name, see FunctionGasEstimator. Each function is annotated with the location of its origin
+	/// in the source with the given index, if known.
+	Json functionGasEstimatesJson(std::map<std::string, unsigned> const& _sourceIndices) const;
 	/// Return the parsed and analyzed object.
 	std::shared_ptr<Object> parserResult() const;
 
@@ -141,13 +172,37 @@ private:
 
 	void compileEVM(yul::AbstractAssembly& _assembly, bool _optimize) const;
 
-	void optimize(yul::Object& _object, bool _isCreation);
+	/// Appends @a _object and all its sub-objects, together with the information whether they
+	/// are creation objects, to @a o_objects. Sub-objects come before the objects containing them.
+	void collectObjectsToOptimize(
+		yul::Object& _object,
+		bool _isCreation,
+		std::vector<std::pair<yul::Object*, bool>>& o_objects
+	);
+	/// Optimizes the code of @a _object, but not the code of its sub-objects.
+	/// Reuses the result from the object optimizer cache if the same code was optimized before.
+	/// If @a o_profile is given, the resource usage of the optimizer steps is added to it.
+	/// Optimizes the code of @a _object, but not of its sub-objects, using up to @a _parallelism
+	/// threads for the steps that process functions independently.
+	/// @returns false if @a _timeBudget was exceeded.
+	bool optimize(
+		yul::Object& _object,
+		bool _isCreation,
+		OptimiserProfile* o_profile,
+		size_t _parallelism,
+		std::optional<OptimiserSuite::TimeBudget> const& _timeBudget
+	);
 
 	Language m_language = Language::Assembly;
 	langutil::EVMVersion m_evmVersion;
 	std::optional<uint8_t> m_eofVersion;
 	solidity::frontend::OptimiserSettings m_optimiserSettings;
 	langutil::DebugInfoSelection m_debugInfoSelection{};
+	size_t m_parallelism = 1;
+	std::shared_ptr<ObjectOptimizer> m_objectOptimizer;
+	bool m_optimizerProfiling = false;
+	std::map<std::string, OptimiserProfile> m_optimizerProfiles;
+	bool m_optimizerTimeBudgetExceeded = false;
 
 	std::unique_ptr<langutil::CharStream> m_charStream;
 
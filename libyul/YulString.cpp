@@ -0,0 +1,70 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <libyul/YulString.h>
+
+using namespace solidity::yul;
+
+YulStringRepository::Handle YulStringRepository::stringToHandle(std::string const& _string)
+{
+	if (_string.empty())
+		return { 0, emptyHash() };
+	std::uint64_t h = hash(_string);
+	size_t shard = static_cast<size_t>(h % ShardCount);
+	size_t index = m_shards[shard].findOrInsert(_string, h);
+	return Handle{index * ShardCount + shard, h};
+}
+
+void YulStringRepository::clear()
+{
+	for (Shard& shard: m_shards)
+		shard.clear();
+	// Occupies ID zero.
+	m_shards[0].findOrInsert({}, emptyHash());
+}
+
+size_t YulStringRepository::Shard::findOrInsert(std::string const& _string, std::uint64_t _hash)
+{
+	std::lock_guard lock(m_mutex);
+	auto range = m_hashToIndex.equal_range(_hash);
+	for (auto it = range.first; it != range.second; ++it)
+		if (at(it->second) == _string)
+			return it->second;
+
+	size_t index = m_size;
+	auto [segment, offset] = location(index);
+	std::string* strings = m_segments[segment].load(std::memory_order_relaxed);
+	if (!strings)
+	{
+		strings = new std::string[size_t(1) << (segment + FirstSegmentSizeBits)];
+		m_segments[segment].store(strings, std::memory_order_release);
+	}
+	strings[offset] = _string;
+	++m_size;
+	m_hashToIndex.emplace_hint(range.second, std::make_pair(_hash, index));
+	return index;
+}
+
+void YulStringRepository::Shard::clear()
+{
+	std::lock_guard lock(m_mutex);
+	for (std::atomic<std::string*>& segment: m_segments)
+		delete[] segment.exchange(nullptr);
+	m_hashToIndex.clear();
+	m_size = 0;
+}
@@ -23,8 +23,12 @@
 
 #include <fmt/format.h>
 
+#include <boost/integer/integer_log2.hpp>
+
+#include <array>
+#include <atomic>
 #include <unordered_map>
-#include <memory>
+#include <mutex>
 #include <vector>
 #include <string>
 #include <functional>
@@ -36,6 +40,11 @@ namespace solidity::yul
 /// Owns the string data for all YulStrings, which can be referenced by a Handle.
 /// A Handle consists of an ID (that depends on the insertion order of YulStrings and is potentially
 /// non-deterministic) and a deterministic string hash.
+///
+/// The repository can be used from multiple threads concurrently. Strings are distributed into
+/// shards based on their hash and each shard is synchronized separately, so threads
+/// only contend when they add strings to the same shard at the same time. Looking up the string
+/// of an ID does not require any synchronization, since strings never move once they are stored.
 class YulStringRepository
 {
 public:
@@ -51,22 +60,11 @@ public:
 		return inst;
 	}
 
-	Handle stringToHandle(std::string const& _string)
+	Handle stringToHandle(std::string const& _string);
+	std::string const& idToString(size_t _id) const
 	{
-		if (_string.empty())
-			return { 0, emptyHash() };
-		std::uint64_t h = hash(_string);
-		auto range = m_hashToID.equal_range(h);
-		for (auto it = range.first; it != range.second; ++it)
-			if (*m_strings[it->second] == _string)
-				return Handle{it->second, h};
-		m_strings.emplace_back(std::make_shared<std::string>(_string));
-		size_t id = m_strings.size() - 1;
-		m_hashToID.emplace_hint(range.second, std::make_pair(h, id));
-
-		return Handle{id, h};
+		return m_shards[_id % ShardCount].at(_id / ShardCount);
 	}
-	std::string const& idToString(size_t _id) const { return *m_strings.at(_id); }
 
 	static std::uint64_t hash(std::string const& v)
 	{
@@ -82,15 +80,21 @@ public:
 	}
 	static constexpr std::uint64_t emptyHash() { return 14695981039346656037u; }
 	/// Clear the repository.
-	/// Use with care - there cannot be any dangling YulString references.
+	/// Use with care - there cannot be any dangling YulString references and no other
+	/// thread may access the repository at the same time.
 	/// If references need to be cleared manually, register the callback via
 	/// resetCallback.
 	static void reset()
 	{
 		for (auto const& cb: resetCallbacks())
 			cb();
-		instance() = YulStringRepository{};
+		instance().clear();
+		++generationCounter();
 	}
+	/// @returns a number that changes whenever the repository is reset.
+	/// Can be used to invalidate caches for which no reset callback can be registered,
+	/// e.g. thread-local ones.
+	static size_t generation() { return generationCounter().load(std::memory_order_relaxed); }
 	/// Struct that registers a reset callback as a side-effect of its construction.
 	/// Useful as static local variable to register a reset callback once.
 	struct ResetCallback
@@ -102,11 +106,53 @@ public:
 	};
 
 private:
-	YulStringRepository() = default;
+	static size_t constexpr ShardCount = 16;
+
+	/// Part of the repository that stores the strings with hashes in the same residue class.
+	/// Strings are stored in segments of exponentially increasing size that are never
+	/// reallocated, so references to stored strings stay valid until the shard is cleared.
+	class Shard
+	{
+	public:
+		Shard() = default;
+		Shard(Shard const&) = delete;
+		Shard& operator=(Shard const&) = delete;
+		~Shard() { clear(); }
+
+		/// @returns the index of @a _string inside the shard, adding it if it is not present yet.
+		size_t findOrInsert(std::string const& _string, std::uint64_t _hash);
+		std::string const& at(size_t _index) const
+		{
+			auto [segment, offset] = location(_index);
+			std::string const* strings = m_segments[segment].load(std::memory_order_acquire);
+			return strings[offset];
+		}
+		void clear();
+
+	private:
+		static size_t constexpr FirstSegmentSizeBits = 6;
+		static size_t constexpr SegmentCount = 48;
+
+		/// @returns the segment and the offset inside the segment of the string with the given index.
+		static std::pair<size_t, size_t> location(size_t _index)
+		{
+			size_t position = _index + (size_t(1) << FirstSegmentSizeBits);
+			size_t segment = static_cast<size_t>(boost::integer_log2(position)) - FirstSegmentSizeBits;
+			return {segment, position - (size_t(1) << (segment + FirstSegmentSizeBits))};
+		}
+
+		std::mutex m_mutex;
+		std::unordered_multimap<std::uint64_t, size_t> m_hashToIndex;
+		size_t m_size = 0;
+		std::array<std::atomic<std::string*>, SegmentCount> m_segments{};
+	};
+
+	YulStringRepository() { clear(); }
 	YulStringRepository(YulStringRepository const&) = delete;
-	YulStringRepository(YulStringRepository&&) = default;
 	YulStringRepository& operator=(YulStringRepository const& _rhs) = delete;
-	YulStringRepository& operator=(YulStringRepository&& _rhs) = default;
+
+	/// Removes all strings apart from the empty string, which always has ID zero.
+	void clear();
 
 	static std::vector<std::function<void()>>& resetCallbacks()
 	{
@@ -114,8 +160,13 @@ private:
 		return callbacks;
 	}
 
-	std::vector<std::shared_ptr<std::string>> m_strings = {std::make_shared<std::string>()};
-	std::unordered_multimap<std::uint64_t, size_t> m_hashToID = {{emptyHash(), 0}};
+	static std::atomic<size_t>& generationCounter()
+	{
+		static std::atomic<size_t> counter = 0;
+		return counter;
+	}
+
+	std::array<Shard, ShardCount> m_shards;
 };
 
 /// Wrapper around handles into the YulString repository.
@@ -68,6 +68,12 @@ public:
 	virtual void setStackHeight(int height) = 0;
 	/// Append an EVM instruction.
 	virtual void appendInstruction(evmasm::Instruction _instruction) = 0;
+	/// Append a DUPN that duplicates the slot @a _depth slots below the top, i.e. acts like DUP<_depth>.
+	/// Only valid in EOF code.
+	virtual void appendDupN(size_t _depth) = 0;
+	/// Append a SWAPN that swaps the top with the slot @a _depth slots below it, i.e. acts like SWAP<_depth>.
+	/// Only valid in EOF code.
+	virtual void appendSwapN(size_t _depth) = 0;
 	/// Append a constant.
 	virtual void appendConstant(u256 const& _constant) = 0;
 	/// Append a label.
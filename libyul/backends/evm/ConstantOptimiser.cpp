@@ -89,6 +89,13 @@ struct MiniEVMInterpreter
 };
 }
 
+void ConstantOptimiser::operator()(FunctionDefinition& _function)
+{
+	GasMeter const* meter = util::valueOrNullptr(m_functionMeters, _function.name);
+	ScopedSaveAndRestore currentMeter(m_currentMeter, meter ? meter : &m_meter);
+	ASTModifier::operator()(_function);
+}
+
 void ConstantOptimiser::visit(Expression& _e)
 {
 	if (std::holds_alternative<Literal>(_e))
@@ -99,7 +106,7 @@ void ConstantOptimiser::visit(Expression& _e)
 
 		if (
 			Expression const* repr =
-				RepresentationFinder(m_dialect, m_meter, debugDataOf(_e), m_cache)
+				RepresentationFinder(m_dialect, *m_currentMeter, debugDataOf(_e), m_cache[m_currentMeter])
 				.tryFindRepresentation(valueOfLiteral(literal))
 		)
 			_e = ASTCopier{}.translate(*repr);
@@ -25,6 +25,7 @@
 #include <libyul/YulString.h>
 #include <libyul/Dialect.h>
 #include <libyul/backends/evm/EVMDialect.h>
+#include <libyul/backends/evm/EVMMetrics.h>
 #include <libyul/ASTForward.h>
 
 #include <liblangutil/DebugData.h>
@@ -38,21 +39,29 @@
 namespace solidity::yul
 {
 struct Dialect;
-class GasMeter;
 
 /**
  * Optimisation stage that replaces constants by expressions that compute them.
+ * The cost of the code of the functions in @a _functionMeters is measured by their own gas meter.
  *
  * Prerequisite: None
  */
 class ConstantOptimiser: public ASTModifier
 {
 public:
-	ConstantOptimiser(EVMDialect const& _dialect, GasMeter const& _meter):
+	ConstantOptimiser(
+		EVMDialect const& _dialect,
+		GasMeter const& _meter,
+		std::map<YulString, GasMeter> _functionMeters = {}
+	):
 		m_dialect(_dialect),
-		m_meter(_meter)
+		m_meter(_meter),
+		m_functionMeters(std::move(_functionMeters)),
+		m_currentMeter(&m_meter)
 	{}
 
+	using ASTModifier::operator();
+	void operator()(FunctionDefinition& _function) override;
 	void visit(Expression& _e) override;
 
 	struct Representation
@@ -64,7 +73,11 @@ public:
 private:
 	EVMDialect const& m_dialect;
 	GasMeter const& m_meter;
-	std::map<u256, Representation> m_cache;
+	std::map<YulString, GasMeter> m_functionMeters;
+	/// The gas meter for the function currently visited.
+	GasMeter const* m_currentMeter = nullptr;
+	/// The representations found so far, for each gas meter.
+	std::map<GasMeter const*, std::map<u256, Representation>> m_cache;
 };
 
 class RepresentationFinder
@@ -166,6 +166,9 @@ struct CFG
 		/// Stack slots this operation leaves on the stack as output.
 		Stack output;
 		std::variant<FunctionCall, BuiltinCall, Assignment> operation;
+		/// Position of the operation among all operations of the graph, assigned after the graph is built.
+		/// Can be used to store data per operation in vectors.
+		size_t index = 0;
 	};
 
 	struct FunctionInfo;
@@ -206,6 +209,8 @@ struct CFG
 		/// If the block starts a sub-graph and does not lead to a function return, we are free to add junk to it.
 		bool allowsJunk() const { return isStartOfSubGraph && !needsCleanStack; }
 		std::variant<MainExit, Jump, ConditionalJump, FunctionReturn, Terminated> exit = MainExit{};
+		/// Position of the block in ``CFG::blocks``. Can be used to store data per block in vectors and bitsets.
+		size_t index = 0;
 	};
 
 	struct FunctionInfo
@@ -229,6 +234,8 @@ struct CFG
 
 	/// Container for blocks for explicit ownership.
 	std::list<BasicBlock> blocks;
+	/// Number of operations in all blocks, i.e. one more than the largest ``Operation::index``.
+	size_t numOperations = 0;
 	/// Container for generated variables for explicit ownership.
 	/// Ghost variables are generated to store switch conditions when transforming the control flow
 	/// of a switch to a sequence of conditional jumps.
@@ -240,7 +247,9 @@ struct CFG
 
 	BasicBlock& makeBlock(langutil::DebugData::ConstPtr _debugData)
 	{
-		return blocks.emplace_back(BasicBlock{std::move(_debugData), {}, {}});
+		BasicBlock& block = blocks.emplace_back(BasicBlock{std::move(_debugData), {}, {}});
+		block.index = blocks.size() - 1;
+		return block;
 	}
 };
 
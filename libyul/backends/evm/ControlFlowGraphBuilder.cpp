@@ -203,6 +203,14 @@ void markNeedsCleanStack(CFG& _cfg)
 					_addChild(entry);
 			});
 }
+
+/// Assigns consecutive indices to all operations of the graph.
+void numberOperations(CFG& _cfg)
+{
+	for (CFG::BasicBlock& block: _cfg.blocks)
+		for (CFG::Operation& operation: block.operations)
+			operation.index = _cfg.numOperations++;
+}
 }
 
 std::unique_ptr<CFG> ControlFlowGraphBuilder::build(
@@ -223,6 +231,7 @@ std::unique_ptr<CFG> ControlFlowGraphBuilder::build(
 	markRecursiveCalls(*result);
 	markStartsOfSubGraphs(*result);
 	markNeedsCleanStack(*result);
+	numberOperations(*result);
 
 	// TODO: It might be worthwhile to run some further simplifications on the graph itself here.
 	// E.g. if there is a jump to a node that has the jumping node as its only entry, the nodes can be fused, etc.
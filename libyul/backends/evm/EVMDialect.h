@@ -28,7 +28,10 @@
 #include <liblangutil/EVMVersion.h>
 
 #include <map>
+#include <mutex>
 #include <set>
+#include <unordered_map>
+#include <unordered_set>
 
 namespace solidity::yul
 {
@@ -82,6 +85,8 @@ struct EVMDialect: public Dialect
 	BuiltinFunctionForEVM const* memoryLoadFunction(YulString /*_type*/) const override { return builtin("mload"_yulstring); }
 	BuiltinFunctionForEVM const* storageStoreFunction(YulString /*_type*/) const override { return builtin("sstore"_yulstring); }
 	BuiltinFunctionForEVM const* storageLoadFunction(YulString /*_type*/) const override { return builtin("sload"_yulstring); }
+	BuiltinFunctionForEVM const* transientStorageStoreFunction(YulString /*_type*/) const override { return builtin("tstore"_yulstring); }
+	BuiltinFunctionForEVM const* transientStorageLoadFunction(YulString /*_type*/) const override { return builtin("tload"_yulstring); }
 	YulString hashFunction(YulString /*_type*/) const override { return "keccak256"_yulstring; }
 
 	static EVMDialect const& strictAssemblyForEVM(langutil::EVMVersion _version);
@@ -98,9 +103,13 @@ protected:
 
 	bool const m_objectAccess;
 	langutil::EVMVersion const m_evmVersion;
-	std::map<YulString, BuiltinFunctionForEVM> m_functions;
+	/// Builtins by name. YulStrings carry a precomputed hash and compare by their ID,
+	/// which makes a hashed lookup much cheaper than a search in an ordered map.
+	std::unordered_map<YulString, BuiltinFunctionForEVM> m_functions;
 	std::map<std::pair<size_t, size_t>, std::shared_ptr<BuiltinFunctionForEVM const>> mutable m_verbatimFunctions;
-	std::set<YulString> m_reserved;
+	/// Dialects are shared between threads and the verbatim functions are created on demand.
+	std::mutex mutable m_verbatimFunctionsMutex;
+	std::unordered_set<YulString> m_reserved;
 };
 
 /**
@@ -30,6 +30,7 @@
 #include <libevmasm/GasMeter.h>
 
 #include <libsolutil/CommonData.h>
+#include <libsolutil/Common.h>
 
 using namespace solidity;
 using namespace solidity::yul;
@@ -111,6 +112,48 @@ bigint GasMeterVisitor::singleByteDataGas() const
 		return evmasm::GasCosts::createDataGas;
 }
 
+bigint GasMeterVisitor::specialInstructionCosts(evmasm::Instruction _instruction) const
+{
+	using evmasm::Instruction;
+	namespace GasCosts = evmasm::GasCosts;
+	langutil::EVMVersion const evmVersion = m_dialect.evmVersion();
+
+	switch (_instruction)
+	{
+	case Instruction::BALANCE:
+		return GasCosts::balanceGas(evmVersion);
+	case Instruction::EXTCODESIZE:
+	case Instruction::EXTCODECOPY:
+	case Instruction::EXTCODEHASH:
+		return GasCosts::extCodeGas(evmVersion);
+	case Instruction::SLOAD:
+		return GasCosts::sloadGas(evmVersion);
+	case Instruction::SSTORE:
+		return GasCosts::totalSstoreResetGas(evmVersion);
+	case Instruction::JUMPDEST:
+		return GasCosts::jumpdestGas;
+	case Instruction::LOG0:
+	case Instruction::LOG1:
+	case Instruction::LOG2:
+	case Instruction::LOG3:
+	case Instruction::LOG4:
+		return GasCosts::logGas + GasCosts::logTopicGas * evmasm::getLogNumber(_instruction);
+	case Instruction::CREATE:
+	case Instruction::CREATE2:
+		return GasCosts::createGas;
+	case Instruction::CALL:
+	case Instruction::CALLCODE:
+	case Instruction::DELEGATECALL:
+	case Instruction::STATICCALL:
+		return GasCosts::callGas(evmVersion);
+	case Instruction::SELFDESTRUCT:
+		return GasCosts::selfdestructGas(evmVersion);
+	default:
+		yulAssert(false, "Unexpected instruction with special gas costs.");
+	}
+	util::unreachable();
+}
+
 void GasMeterVisitor::instructionCostsInternal(evmasm::Instruction _instruction)
 {
 	if (_instruction == evmasm::Instruction::EXP)
@@ -118,7 +161,46 @@ void GasMeterVisitor::instructionCostsInternal(evmasm::Instruction _instruction)
 	else if (_instruction == evmasm::Instruction::KECCAK256)
 		// Assumes that Keccak-256 is computed on a single word (rounded up).
 		m_runGas += evmasm::GasCosts::keccak256Gas + evmasm::GasCosts::keccak256WordGas;
+	else if (evmasm::instructionInfo(_instruction, m_dialect.evmVersion()).gasPriceTier == evmasm::Tier::Special)
+		m_runGas += specialInstructionCosts(_instruction);
 	else
 		m_runGas += evmasm::GasMeter::runGas(_instruction, m_dialect.evmVersion());
 	m_dataGas += singleByteDataGas();
 }
+
+std::map<YulString, bigint> FunctionGasEstimator::run(EVMDialect const& _dialect, Block const& _ast)
+{
+	FunctionGasEstimator estimator(_dialect);
+	estimator(_ast);
+	return std::move(estimator.m_costs);
+}
+
+void FunctionGasEstimator::operator()(FunctionDefinition const& _function)
+{
+	ScopedSaveAndRestore currentCosts(m_currentCosts, &m_costs[_function.name]);
+	ASTWalker::operator()(_function);
+}
+
+void FunctionGasEstimator::operator()(FunctionCall const& _funCall)
+{
+	ASTWalker::operator()(_funCall);
+	if (BuiltinFunctionForEVM const* f = m_dialect.builtin(_funCall.functionName.name))
+		if (f->instruction)
+			addCosts(GasMeterVisitor::instructionCosts(*f->instruction, m_dialect).first);
+}
+
+void FunctionGasEstimator::operator()(Literal const&)
+{
+	addCosts(evmasm::GasMeter::runGas(evmasm::Instruction::PUSH1, m_dialect.evmVersion()));
+}
+
+void FunctionGasEstimator::operator()(Identifier const&)
+{
+	addCosts(evmasm::GasMeter::runGas(evmasm::Instruction::DUP1, m_dialect.evmVersion()));
+}
+
+void FunctionGasEstimator::addCosts(bigint const& _costs)
+{
+	if (m_currentCosts)
+		*m_currentCosts += _costs;
+}
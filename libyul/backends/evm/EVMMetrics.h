@@ -26,6 +26,8 @@
 #include <libsolutil/Numeric.h>
 #include <libevmasm/Instruction.h>
 
+#include <map>
+
 namespace solidity::yul
 {
 
@@ -94,6 +96,10 @@ private:
 	/// For EXP, it assumes that the exponent is at most 255.
 	/// Does not work particularly exact for anything apart from arithmetic.
 	void instructionCostsInternal(evmasm::Instruction _instruction);
+	/// @returns the cost of executing an instruction whose cost depends on its arguments or the state.
+	/// Assumes cold accesses, an update of an already set storage slot, no memory expansion and
+	/// no data for logs.
+	bigint specialInstructionCosts(evmasm::Instruction _instruction) const;
 
 	EVMDialect const& m_dialect;
 	bool m_isCreation = false;
@@ -101,4 +107,36 @@ private:
 	bigint m_dataGas = 0;
 };
 
+/**
+ * Static estimate of the gas needed to run the body of each function once.
+ *
+ * Every statement is counted exactly once, i.e. loop bodies are counted as a single iteration
+ * and both the taken and the skipped branches of conditionals are included. Only the run
+ * costs of EVM instructions, literals and variable accesses are counted, with the same
+ * assumptions as GasMeterVisitor. Calls to user-defined functions do not include the costs
+ * of the called function and the costs of stack manipulation and jumps are ignored.
+ */
+class FunctionGasEstimator: public ASTWalker
+{
+public:
+	/// @returns the estimated run costs of all functions defined in @a _ast by name.
+	static std::map<YulString, bigint> run(EVMDialect const& _dialect, Block const& _ast);
+
+	using ASTWalker::operator();
+	void operator()(FunctionDefinition const& _function) override;
+	void operator()(FunctionCall const& _funCall) override;
+	void operator()(Literal const& _literal) override;
+	void operator()(Identifier const& _identifier) override;
+
+private:
+	explicit FunctionGasEstimator(EVMDialect const& _dialect): m_dialect(_dialect) {}
+
+	void addCosts(bigint const& _costs);
+
+	EVMDialect const& m_dialect;
+	std::map<YulString, bigint> m_costs;
+	/// Costs of the function currently visited, null outside of functions.
+	bigint* m_currentCosts = nullptr;
+};
+
 }
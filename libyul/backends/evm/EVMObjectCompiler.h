@@ -38,11 +38,20 @@ public:
 		AbstractAssembly& _assembly,
 		EVMDialect const& _dialect,
 		bool _optimize,
-		std::optional<uint8_t> _eofVersion
+		std::optional<uint8_t> _eofVersion,
+		bool _exhaustiveStackLayoutSearch = false
 	);
 private:
-	EVMObjectCompiler(AbstractAssembly& _assembly, EVMDialect const& _dialect, std::optional<uint8_t> _eofVersion):
-		m_assembly(_assembly), m_dialect(_dialect), m_eofVersion(_eofVersion)
+	EVMObjectCompiler(
+		AbstractAssembly& _assembly,
+		EVMDialect const& _dialect,
+		std::optional<uint8_t> _eofVersion,
+		bool _exhaustiveStackLayoutSearch
+	):
+		m_assembly(_assembly),
+		m_dialect(_dialect),
+		m_eofVersion(_eofVersion),
+		m_exhaustiveStackLayoutSearch(_exhaustiveStackLayoutSearch)
 	{}
 
 	void run(Object& _object, bool _optimize);
@@ -50,6 +59,8 @@ private:
 	AbstractAssembly& m_assembly;
 	EVMDialect const& m_dialect;
 	std::optional<uint8_t> m_eofVersion;
+	/// Passed on to the optimized code transform, see @a StackLayoutGenerator::run.
+	bool m_exhaustiveStackLayoutSearch = false;
 };
 
 }
@@ -63,6 +63,16 @@ void EthAssemblyAdapter::appendInstruction(evmasm::Instruction _instruction)
 	m_assembly.append(_instruction);
 }
 
+void EthAssemblyAdapter::appendDupN(size_t _depth)
+{
+	m_assembly.append(evmasm::AssemblyItem(evmasm::DupN, _depth));
+}
+
+void EthAssemblyAdapter::appendSwapN(size_t _depth)
+{
+	m_assembly.append(evmasm::AssemblyItem(evmasm::SwapN, _depth));
+}
+
 void EthAssemblyAdapter::appendConstant(u256 const& _constant)
 {
 	m_assembly.append(_constant);
@@ -39,6 +39,15 @@ void NoOutputAssembly::appendInstruction(evmasm::Instruction _instr)
 	m_stackHeight += instructionInfo(_instr, m_evmVersion).ret - instructionInfo(_instr, m_evmVersion).args;
 }
 
+void NoOutputAssembly::appendDupN(size_t)
+{
+	m_stackHeight++;
+}
+
+void NoOutputAssembly::appendSwapN(size_t)
+{
+}
+
 void NoOutputAssembly::appendConstant(u256 const&)
 {
 	appendInstruction(evmasm::pushInstruction(1));
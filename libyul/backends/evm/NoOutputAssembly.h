@@ -52,6 +52,8 @@ public:
 	int stackHeight() const override { return m_stackHeight; }
 	void setStackHeight(int height) override { m_stackHeight = height; }
 	void appendInstruction(evmasm::Instruction _instruction) override;
+	void appendDupN(size_t _depth) override;
+	void appendSwapN(size_t _depth) override;
 	void appendConstant(u256 const& _constant) override;
 	void appendLabel(LabelID _labelId) override;
 	void appendLabelReference(LabelID _labelId) override;
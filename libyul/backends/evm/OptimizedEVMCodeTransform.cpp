@@ -45,20 +45,23 @@ std::vector<StackTooDeepError> OptimizedEVMCodeTransform::run(
 	Block const& _block,
 	EVMDialect const& _dialect,
 	BuiltinContext& _builtinContext,
-	UseNamedLabels _useNamedLabelsForFunctions
+	UseNamedLabels _useNamedLabelsForFunctions,
+	bool _exhaustiveStackLayoutSearch,
+	size_t _reachableStackDepth
 )
 {
 	std::unique_ptr<CFG> dfg = ControlFlowGraphBuilder::build(_analysisInfo, _dialect, _block);
-	StackLayout stackLayout = StackLayoutGenerator::run(*dfg);
+	StackLayout stackLayout = StackLayoutGenerator::run(*dfg, _exhaustiveStackLayoutSearch, _reachableStackDepth);
 	OptimizedEVMCodeTransform optimizedCodeTransform(
 		_assembly,
 		_builtinContext,
 		_useNamedLabelsForFunctions,
 		*dfg,
-		stackLayout
+		stackLayout,
+		_reachableStackDepth
 	);
 	// Create initial entry layout.
-	optimizedCodeTransform.createStackLayout(debugDataOf(*dfg->entry), stackLayout.blockInfos.at(dfg->entry).entryLayout);
+	optimizedCodeTransform.createStackLayout(debugDataOf(*dfg->entry), stackLayout.blockInfo(*dfg->entry).entryLayout);
 	optimizedCodeTransform(*dfg->entry);
 	for (Scope::Function const* function: dfg->functions)
 		optimizedCodeTransform(dfg->functionInfo.at(function));
@@ -177,12 +180,14 @@ OptimizedEVMCodeTransform::OptimizedEVMCodeTransform(
 	BuiltinContext& _builtinContext,
 	UseNamedLabels _useNamedLabelsForFunctions,
 	CFG const& _dfg,
-	StackLayout const& _stackLayout
+	StackLayout const& _stackLayout,
+	size_t _reachableStackDepth
 ):
 	m_assembly(_assembly),
 	m_builtinContext(_builtinContext),
 	m_dfg(_dfg),
 	m_stackLayout(_stackLayout),
+	m_reachableStackDepth(_reachableStackDepth),
 	m_functionLabels([&](){
 		std::map<CFG::FunctionInfo const*, AbstractAssembly::LabelID> functionLabels;
 		std::set<YulString> assignedFunctionNames;
@@ -260,9 +265,11 @@ void OptimizedEVMCodeTransform::createStackLayout(langutil::DebugData::ConstPtr
 			yulAssert(_i > 0 && _i < m_stack.size(), "");
 			if (_i <= 16)
 				m_assembly.appendInstruction(evmasm::swapInstruction(_i));
+			else if (_i <= m_reachableStackDepth)
+				m_assembly.appendSwapN(_i);
 			else
 			{
-				int deficit = static_cast<int>(_i) - 16;
+				int deficit = static_cast<int>(_i - m_reachableStackDepth);
 				StackSlot const& deepSlot = m_stack.at(m_stack.size() - _i - 1);
 				YulString varNameDeep = slotVariableName(deepSlot);
 				YulString varNameTop = slotVariableName(m_stack.back());
@@ -292,13 +299,18 @@ void OptimizedEVMCodeTransform::createStackLayout(langutil::DebugData::ConstPtr
 					m_assembly.appendInstruction(evmasm::dupInstruction(static_cast<unsigned>(*depth + 1)));
 					return;
 				}
+				else if (*depth < m_reachableStackDepth)
+				{
+					m_assembly.appendDupN(*depth + 1);
+					return;
+				}
 				else if (!canBeFreelyGenerated(_slot))
 				{
-					int deficit = static_cast<int>(*depth - 15);
+					int deficit = static_cast<int>(*depth - m_reachableStackDepth + 1);
 					YulString varName = slotVariableName(_slot);
 					std::string msg =
 						(varName.empty() ? "Slot " + stackSlotToString(_slot) : "Variable " + varName.str())
-						+ " is " + std::to_string(*depth - 15) + " too deep in the stack " + stackToString(m_stack);
+						+ " is " + std::to_string(deficit) + " too deep in the stack " + stackToString(m_stack);
 					m_stackErrors.emplace_back(StackTooDeepError(
 						m_currentFunctionInfo ? m_currentFunctionInfo->function.name : YulString{},
 						varName,
@@ -361,7 +373,8 @@ void OptimizedEVMCodeTransform::createStackLayout(langutil::DebugData::ConstPtr
 		[&]()
 		{
 			m_assembly.appendInstruction(evmasm::Instruction::POP);
-		}
+		},
+		m_reachableStackDepth
 	);
 	yulAssert(m_assembly.stackHeight() == static_cast<int>(m_stack.size()), "");
 }
@@ -372,7 +385,7 @@ void OptimizedEVMCodeTransform::operator()(CFG::BasicBlock const& _block)
 	yulAssert(m_generated.insert(&_block).second, "");
 
 	m_assembly.setSourceLocation(originLocationOf(_block));
-	auto const& blockInfo = m_stackLayout.blockInfos.at(&_block);
+	auto const& blockInfo = m_stackLayout.blockInfo(_block);
 
 	// Assert that the stack is valid for entering the block.
 	assertLayoutCompatibility(m_stack, blockInfo.entryLayout);
@@ -386,7 +399,7 @@ void OptimizedEVMCodeTransform::operator()(CFG::BasicBlock const& _block)
 	for (auto const& operation: _block.operations)
 	{
 		// Create required layout for entering the operation.
-		createStackLayout(debugDataOf(operation.operation), m_stackLayout.operationEntryLayout.at(&operation));
+		createStackLayout(debugDataOf(operation.operation), m_stackLayout.operationEntryLayout(operation));
 
 		// Assert that we have the inputs of the operation on stack top.
 		yulAssert(static_cast<int>(m_stack.size()) == m_assembly.stackHeight(), "");
@@ -420,7 +433,7 @@ void OptimizedEVMCodeTransform::operator()(CFG::BasicBlock const& _block)
 		[&](CFG::BasicBlock::Jump const& _jump)
 		{
 			// Create the stack expected at the jump target.
-			createStackLayout(debugDataOf(_jump), m_stackLayout.blockInfos.at(_jump.target).entryLayout);
+			createStackLayout(debugDataOf(_jump), m_stackLayout.blockInfo(*_jump.target).entryLayout);
 
 			// If this is the only jump to the block, we do not need a label and can directly continue with the target block.
 			if (!m_blockLabels.count(_jump.target) && _jump.target->entries.size() == 1)
@@ -461,8 +474,8 @@ void OptimizedEVMCodeTransform::operator()(CFG::BasicBlock const& _block)
 			m_stack.pop_back();
 
 			// Assert that we have a valid stack for both jump targets.
-			assertLayoutCompatibility(m_stack, m_stackLayout.blockInfos.at(_conditionalJump.nonZero).entryLayout);
-			assertLayoutCompatibility(m_stack, m_stackLayout.blockInfos.at(_conditionalJump.zero).entryLayout);
+			assertLayoutCompatibility(m_stack, m_stackLayout.blockInfo(*_conditionalJump.nonZero).entryLayout);
+			assertLayoutCompatibility(m_stack, m_stackLayout.blockInfo(*_conditionalJump.zero).entryLayout);
 
 			{
 				// Restore the stack afterwards for the non-zero case below.
@@ -534,7 +547,7 @@ void OptimizedEVMCodeTransform::operator()(CFG::FunctionInfo const& _functionInf
 	m_assembly.appendLabel(getFunctionLabel(_functionInfo.function));
 
 	// Create the entry layout of the function body block and visit.
-	createStackLayout(debugDataOf(_functionInfo), m_stackLayout.blockInfos.at(_functionInfo.entry).entryLayout);
+	createStackLayout(debugDataOf(_functionInfo), m_stackLayout.blockInfo(*_functionInfo.entry).entryLayout);
 	(*this)(*_functionInfo.entry);
 
 	m_stack.clear();
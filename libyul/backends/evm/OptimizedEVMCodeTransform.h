@@ -24,6 +24,7 @@
 #include <libyul/AST.h>
 #include <libyul/backends/evm/EVMDialect.h>
 #include <libyul/backends/evm/ControlFlowGraph.h>
+#include <libyul/backends/evm/StackHelpers.h>
 #include <libyul/Exceptions.h>
 #include <libyul/Scope.h>
 
@@ -47,13 +48,17 @@ public:
 	/// 2) For none of the functions 3) for the first function of each name.
 	enum class UseNamedLabels { YesAndForceUnique, Never, ForFirstFunctionOfEachName };
 
+	/// Slots deeper than 16 and at most @a _reachableStackDepth below the stack top are accessed
+	/// using DUPN and SWAPN, which requires the assembly to be EOF code.
 	[[nodiscard]] static std::vector<StackTooDeepError> run(
 		AbstractAssembly& _assembly,
 		AsmAnalysisInfo& _analysisInfo,
 		Block const& _block,
 		EVMDialect const& _dialect,
 		BuiltinContext& _builtinContext,
-		UseNamedLabels _useNamedLabelsForFunctions
+		UseNamedLabels _useNamedLabelsForFunctions,
+		bool _exhaustiveStackLayoutSearch = false,
+		size_t _reachableStackDepth = legacyReachableStackDepth
 	);
 
 	/// Generate code for the function call @a _call. Only public for using with std::visit.
@@ -68,7 +73,8 @@ private:
 		BuiltinContext& _builtinContext,
 		UseNamedLabels _useNamedLabelsForFunctions,
 		CFG const& _dfg,
-		StackLayout const& _stackLayout
+		StackLayout const& _stackLayout,
+		size_t _reachableStackDepth
 	);
 
 	/// Assert that it is valid to transition from @a _currentStack to @a _desiredStack.
@@ -101,6 +107,7 @@ private:
 	BuiltinContext& m_builtinContext;
 	CFG const& m_dfg;
 	StackLayout const& m_stackLayout;
+	size_t const m_reachableStackDepth;
 	Stack m_stack;
 	std::map<yul::FunctionCall const*, AbstractAssembly::LabelID> m_returnLabels;
 	std::map<CFG::BasicBlock const*, AbstractAssembly::LabelID> m_blockLabels;
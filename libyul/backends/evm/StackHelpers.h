@@ -30,9 +30,22 @@
 #include <range/v3/view/reverse.hpp>
 #include <range/v3/view/take.hpp>
 
+#include <optional>
+
 namespace solidity::yul
 {
 
+/// Number of slots below the stack top that can be reached by DUP1 to DUP16 and SWAP1 to SWAP16.
+constexpr size_t legacyReachableStackDepth = 16;
+/// Number of slots below the stack top that can be reached by DUPN and SWAPN (EIP-663) in EOF code.
+constexpr size_t eofReachableStackDepth = 256;
+
+/// @returns the number of slots below the stack top that code generated for @a _eofVersion can reach.
+inline size_t reachableStackDepth(std::optional<uint8_t> _eofVersion)
+{
+	return _eofVersion.has_value() ? eofReachableStackDepth : legacyReachableStackDepth;
+}
+
 inline std::string stackSlotToString(StackSlot const& _slot)
 {
 	return std::visit(util::GenericVisitor{
@@ -87,6 +100,8 @@ concept ShuffleOperationConcept = requires(ShuffleOperations ops, size_t sourceO
 	{ ops.sourceSize() } -> std::convertible_to<size_t>;
 	// Returns the number of slots in the target layout.
 	{ ops.targetSize() } -> std::convertible_to<size_t>;
+	// Returns the maximal depth of a swap or dup, e.g. 16 for SWAP16 and DUP16.
+	{ ops.reachableStackDepth() } -> std::convertible_to<size_t>;
 	// Swaps the top most slot in the source with the slot `depth` slots below the top.
 	// In terms of EVM opcodes this is supposed to be a `SWAP<depth>`.
 	// In terms of vectors this is supposed to be `std::swap(source.at(source.size() - depth - 1, source.top))`.
@@ -127,10 +142,11 @@ private:
 	static bool dupDeepSlotIfRequired(ShuffleOperations& _ops)
 	{
 		// Check if the stack is large enough for anything to potentially become unreachable.
-		if (_ops.sourceSize() < 15)
+		size_t const maxDepth = _ops.reachableStackDepth() - 1;
+		if (_ops.sourceSize() < maxDepth)
 			return false;
 		// Check whether any deep slot might still be needed later (i.e. we still need to reach it with a DUP or SWAP).
-		for (size_t sourceOffset: ranges::views::iota(0u, _ops.sourceSize() - 15))
+		for (size_t sourceOffset: ranges::views::iota(0u, _ops.sourceSize() - maxDepth))
 		{
 			// This slot needs to be moved.
 			if (!_ops.isCompatible(sourceOffset, sourceOffset))
@@ -255,10 +271,10 @@ private:
 				)
 				{
 					// We cannot swap that deep.
-					if (ops.sourceSize() - offset - 1 > 16)
+					if (ops.sourceSize() - offset - 1 > ops.reachableStackDepth())
 					{
 						// If there is a reachable slot to be removed, park the current top there.
-						for (size_t swapDepth: ranges::views::iota(1u, 17u) | ranges::views::reverse)
+						for (size_t swapDepth: ranges::views::iota(1u, ops.reachableStackDepth() + 1) | ranges::views::reverse)
 							if (ops.sourceMultiplicity(ops.sourceSize() - 1 - swapDepth) < 0)
 							{
 								ops.swap(swapDepth);
@@ -326,7 +342,8 @@ private:
 			yulAssert(ops.sourceMultiplicity(i) == 0 && (ops.targetIsArbitrary(i) || ops.targetMultiplicity(i) == 0), "");
 		yulAssert(ops.isCompatible(sourceTop, sourceTop), "");
 
-		auto swappableOffsets = ranges::views::iota(size > 17 ? size - 17 : 0u, size);
+		size_t const reachableSlots = ops.reachableStackDepth() + 1;
+		auto swappableOffsets = ranges::views::iota(size > reachableSlots ? size - reachableSlots : 0u, size);
 
 		// If we find a lower slot that is out of position, but also compatible with the top, swap that up.
 		for (size_t offset: swappableOffsets)
@@ -429,8 +446,16 @@ private:
 /// @a _pushOrDup is a function with signature void(StackSlot const&) that is called to push or dup the slot given as
 /// its argument to the stack top.
 /// @a _pop is a function with signature void() that is called when the top most slot is popped.
+/// @a _reachableStackDepth is the maximal depth of the swaps and dups the shuffling tries to restrict itself to.
 template<typename Swap, typename PushOrDup, typename Pop>
-void createStackLayout(Stack& _currentStack, Stack const& _targetStack, Swap _swap, PushOrDup _pushOrDup, Pop _pop)
+void createStackLayout(
+	Stack& _currentStack,
+	Stack const& _targetStack,
+	Swap _swap,
+	PushOrDup _pushOrDup,
+	Pop _pop,
+	size_t _reachableStackDepth = legacyReachableStackDepth
+)
 {
 	struct ShuffleOperations
 	{
@@ -439,19 +464,22 @@ void createStackLayout(Stack& _currentStack, Stack const& _targetStack, Swap _sw
 		Swap swapCallback;
 		PushOrDup pushOrDupCallback;
 		Pop popCallback;
+		size_t maxDepth;
 		Multiplicity multiplicity;
 		ShuffleOperations(
 			Stack& _currentStack,
 			Stack const& _targetStack,
 			Swap _swap,
 			PushOrDup _pushOrDup,
-			Pop _pop
+			Pop _pop,
+			size_t _maxDepth
 		):
 			currentStack(_currentStack),
 			targetStack(_targetStack),
 			swapCallback(_swap),
 			pushOrDupCallback(_pushOrDup),
-			popCallback(_pop)
+			popCallback(_pop),
+			maxDepth(_maxDepth)
 		{
 			for (auto const& slot: currentStack)
 				--multiplicity[slot];
@@ -485,6 +513,7 @@ void createStackLayout(Stack& _currentStack, Stack const& _targetStack, Swap _sw
 		}
 		size_t sourceSize() { return currentStack.size(); }
 		size_t targetSize() { return targetStack.size(); }
+		size_t reachableStackDepth() { return maxDepth; }
 		void pop()
 		{
 			popCallback();
@@ -498,7 +527,8 @@ void createStackLayout(Stack& _currentStack, Stack const& _targetStack, Swap _sw
 		}
 	};
 
-	Shuffler<ShuffleOperations>::shuffle(_currentStack, _targetStack, _swap, _pushOrDup, _pop);
+	yulAssert(_reachableStackDepth >= legacyReachableStackDepth, "");
+	Shuffler<ShuffleOperations>::shuffle(_currentStack, _targetStack, _swap, _pushOrDup, _pop, _reachableStackDepth);
 
 	yulAssert(_currentStack.size() == _targetStack.size(), "");
 	for (auto&& [current, target]: ranges::zip_view(_currentStack, _targetStack))
@@ -44,33 +44,61 @@
 #include <range/v3/view/take_last.hpp>
 #include <range/v3/view/transform.hpp>
 
+#include <algorithm>
+
+#ifdef PROFILE_OPTIMIZER_STEPS
+#include <iostream>
+#endif
+
 using namespace solidity;
 using namespace solidity::yul;
 
-StackLayout StackLayoutGenerator::run(CFG const& _cfg)
+StackLayout StackLayoutGenerator::run(
+	CFG const& _cfg,
+	bool _exhaustiveSearch,
+	size_t _reachableStackDepth,
+	size_t _simpleLayoutOperationThreshold
+)
 {
-	StackLayout stackLayout;
-	StackLayoutGenerator{stackLayout, nullptr}.processEntryPoint(*_cfg.entry);
+	StackLayout stackLayout{_cfg};
+	CombineStackCache combineStackCache{_exhaustiveSearch, _reachableStackDepth};
+	StackLayoutGenerator{stackLayout, _cfg, nullptr, combineStackCache, _simpleLayoutOperationThreshold}
+		.processEntryPoint(*_cfg.entry);
 
 	for (auto& functionInfo: _cfg.functionInfo | ranges::views::values)
-		StackLayoutGenerator{stackLayout, &functionInfo}.processEntryPoint(*functionInfo.entry, &functionInfo);
+		StackLayoutGenerator{stackLayout, _cfg, &functionInfo, combineStackCache, _simpleLayoutOperationThreshold}
+			.processEntryPoint(*functionInfo.entry, &functionInfo);
+
+#ifdef PROFILE_OPTIMIZER_STEPS
+	std::cerr << "StackLayoutGenerator combineStack cache: ";
+	std::cerr << combineStackCache.hits() << " hits, " << combineStackCache.misses() << " misses" << std::endl;
+#endif
 
 	return stackLayout;
 }
 
-std::map<YulString, std::vector<StackLayoutGenerator::StackTooDeep>> StackLayoutGenerator::reportStackTooDeep(CFG const& _cfg)
+std::map<YulString, std::vector<StackLayoutGenerator::StackTooDeep>> StackLayoutGenerator::reportStackTooDeep(
+	CFG const& _cfg,
+	size_t _reachableStackDepth,
+	bool _exhaustiveSearch
+)
 {
 	std::map<YulString, std::vector<StackLayoutGenerator::StackTooDeep>> stackTooDeepErrors;
-	stackTooDeepErrors[YulString{}] = reportStackTooDeep(_cfg, YulString{});
+	stackTooDeepErrors[YulString{}] = reportStackTooDeep(_cfg, YulString{}, _reachableStackDepth, _exhaustiveSearch);
 	for (auto const& function: _cfg.functions)
-		if (auto errors = reportStackTooDeep(_cfg, function->name); !errors.empty())
+		if (auto errors = reportStackTooDeep(_cfg, function->name, _reachableStackDepth, _exhaustiveSearch); !errors.empty())
 			stackTooDeepErrors[function->name] = std::move(errors);
 	return stackTooDeepErrors;
 }
 
-std::vector<StackLayoutGenerator::StackTooDeep> StackLayoutGenerator::reportStackTooDeep(CFG const& _cfg, YulString _functionName)
+std::vector<StackLayoutGenerator::StackTooDeep> StackLayoutGenerator::reportStackTooDeep(
+	CFG const& _cfg,
+	YulString _functionName,
+	size_t _reachableStackDepth,
+	bool _exhaustiveSearch
+)
 {
-	StackLayout stackLayout;
+	StackLayout stackLayout{_cfg};
 	CFG::FunctionInfo const* functionInfo = nullptr;
 	if (!_functionName.empty())
 	{
@@ -82,22 +110,38 @@ std::vector<StackLayoutGenerator::StackTooDeep> StackLayoutGenerator::reportStac
 		yulAssert(functionInfo, "Function not found.");
 	}
 
-	StackLayoutGenerator generator{stackLayout, functionInfo};
+	CombineStackCache combineStackCache{_exhaustiveSearch, _reachableStackDepth};
+	StackLayoutGenerator generator{stackLayout, _cfg, functionInfo, combineStackCache};
 	CFG::BasicBlock const* entry = functionInfo ? functionInfo->entry : _cfg.entry;
 	generator.processEntryPoint(*entry);
 	return generator.reportStackTooDeep(*entry);
 }
 
-StackLayoutGenerator::StackLayoutGenerator(StackLayout& _layout, CFG::FunctionInfo const* _functionInfo):
+StackLayoutGenerator::StackLayoutGenerator(
+	StackLayout& _layout,
+	CFG const& _cfg,
+	CFG::FunctionInfo const* _functionInfo,
+	CombineStackCache& _combineStackCache,
+	size_t _simpleLayoutOperationThreshold
+):
 	m_layout(_layout),
-	m_currentFunctionInfo(_functionInfo)
+	m_cfg(_cfg),
+	m_currentFunctionInfo(_functionInfo),
+	m_combineStackCache(_combineStackCache),
+	m_reachableStackDepth(_combineStackCache.reachableStackDepth()),
+	m_simpleLayoutOperationThreshold(_simpleLayoutOperationThreshold)
 {
 }
 
 namespace
 {
-/// @returns all stack too deep errors that would occur when shuffling @a _source to @a _target.
-std::vector<StackLayoutGenerator::StackTooDeep> findStackTooDeep(Stack const& _source, Stack const& _target)
+/// @returns all stack too deep errors that would occur when shuffling @a _source to @a _target,
+/// if only @a _reachableStackDepth slots below the stack top can be reached.
+std::vector<StackLayoutGenerator::StackTooDeep> findStackTooDeep(
+	Stack const& _source,
+	Stack const& _target,
+	size_t _reachableStackDepth
+)
 {
 	Stack currentStack = _source;
 	std::vector<StackLayoutGenerator::StackTooDeep> stackTooDeepErrors;
@@ -114,9 +158,9 @@ std::vector<StackLayoutGenerator::StackTooDeep> findStackTooDeep(Stack const& _s
 		_target,
 		[&](unsigned _i)
 		{
-			if (_i > 16)
+			if (_i > _reachableStackDepth)
 				stackTooDeepErrors.emplace_back(StackLayoutGenerator::StackTooDeep{
-					_i - 16,
+					_i - _reachableStackDepth,
 					getVariableChoices(currentStack | ranges::views::take_last(_i + 1))
 				});
 		},
@@ -126,14 +170,15 @@ std::vector<StackLayoutGenerator::StackTooDeep> findStackTooDeep(Stack const& _s
 				return;
 			if (
 				auto depth = util::findOffset(currentStack | ranges::views::reverse, _slot);
-				depth && *depth >= 16
+				depth && *depth >= _reachableStackDepth
 			)
 				stackTooDeepErrors.emplace_back(StackLayoutGenerator::StackTooDeep{
-					*depth - 15,
+					*depth - _reachableStackDepth + 1,
 					getVariableChoices(currentStack | ranges::views::take_last(*depth + 1))
 				});
 		},
-		[&]() {}
+		[&]() {},
+		_reachableStackDepth
 	);
 	return stackTooDeepErrors;
 }
@@ -142,8 +187,14 @@ std::vector<StackLayoutGenerator::StackTooDeep> findStackTooDeep(Stack const& _s
 /// shuffling to @a _post is cheap (excluding the input of the operation itself).
 /// If @a _generateSlotOnTheFly returns true for a slot, this slot should not occur in the ideal stack, but
 /// rather be generated on the fly during shuffling.
+/// Swaps and dups are restricted to a depth of @a _reachableStackDepth, if possible.
 template<typename Callable>
-Stack createIdealLayout(Stack const& _operationOutput, Stack const& _post, Callable _generateSlotOnTheFly)
+Stack createIdealLayout(
+	Stack const& _operationOutput,
+	Stack const& _post,
+	Callable _generateSlotOnTheFly,
+	size_t _reachableStackDepth
+)
 {
 	struct PreviousSlot { size_t slot; };
 
@@ -175,11 +226,13 @@ Stack createIdealLayout(Stack const& _operationOutput, Stack const& _post, Calla
 		std::set<StackSlot> outputs;
 		Multiplicity multiplicity;
 		Callable generateSlotOnTheFly;
+		size_t maxDepth;
 		ShuffleOperations(
 			std::vector<std::variant<PreviousSlot, StackSlot>>& _layout,
 			Stack const& _post,
-			Callable _generateSlotOnTheFly
-		): layout(_layout), post(_post), generateSlotOnTheFly(_generateSlotOnTheFly)
+			Callable _generateSlotOnTheFly,
+			size_t _maxDepth
+		): layout(_layout), post(_post), generateSlotOnTheFly(_generateSlotOnTheFly), maxDepth(_maxDepth)
 		{
 			for (auto const& layoutSlot: layout)
 				if (StackSlot const* slot = std::get_if<StackSlot>(&layoutSlot))
@@ -239,10 +292,11 @@ Stack createIdealLayout(Stack const& _operationOutput, Stack const& _post, Calla
 		}
 		size_t sourceSize() { return layout.size(); }
 		size_t targetSize() { return post.size(); }
+		size_t reachableStackDepth() { return maxDepth; }
 		void pop() { layout.pop_back(); }
 		void pushOrDupTarget(size_t _offset) { layout.push_back(post.at(_offset)); }
 	};
-	Shuffler<ShuffleOperations>::shuffle(layout, _post, _generateSlotOnTheFly);
+	Shuffler<ShuffleOperations>::shuffle(layout, _post, _generateSlotOnTheFly, _reachableStackDepth);
 
 	// Now we can construct the ideal layout before the operation.
 	// "layout" has shuffled the PreviousSlot{x} to new places using minimal operations to move the operation
@@ -281,7 +335,7 @@ Stack StackLayoutGenerator::propagateStackThroughOperation(Stack _exitStack, CFG
 
 	// Determine the ideal permutation of the slots in _exitLayout that are not operation outputs (and not to be
 	// generated on the fly), s.t. shuffling the `stack + _operation.output` to _exitLayout is cheap.
-	Stack stack = createIdealLayout(_operation.output, _exitStack, generateSlotOnTheFly);
+	Stack stack = createIdealLayout(_operation.output, _exitStack, generateSlotOnTheFly, m_reachableStackDepth);
 
 	// Make sure the resulting previous slots do not overlap with any assignmed variables.
 	if (auto const* assignment = std::get_if<CFG::Assignment>(&_operation.operation))
@@ -296,7 +350,7 @@ Stack StackLayoutGenerator::propagateStackThroughOperation(Stack _exitStack, CFG
 	// Store the exact desired operation entry layout. The stored layout will be recreated by the code transform
 	// before executing the operation. However, this recreation can produce slots that can be freely generated or
 	// are duplicated, i.e. we can compress the stack afterwards without causing problems for code generation later.
-	m_layout.operationEntryLayout[&_operation] = stack;
+	m_layout.operationEntryLayout(_operation) = stack;
 
 	// Remove anything from the stack top that can be freely generated or dupped from deeper on the stack.
 	while (!stack.empty())
@@ -305,7 +359,7 @@ Stack StackLayoutGenerator::propagateStackThroughOperation(Stack _exitStack, CFG
 			stack.pop_back();
 		else if (auto offset = util::findOffset(stack | ranges::views::reverse | ranges::views::drop(1), stack.back()))
 		{
-			if (*offset + 2 < 16)
+			if (*offset + 2 < m_reachableStackDepth)
 				stack.pop_back();
 			else
 				break;
@@ -323,7 +377,11 @@ Stack StackLayoutGenerator::propagateStackThroughBlock(Stack _exitStack, CFG::Ba
 	for (auto&& [idx, operation]: _block.operations | ranges::views::enumerate | ranges::views::reverse)
 	{
 		Stack newStack = propagateStackThroughOperation(stack, operation, _aggressiveStackCompression);
-		if (!_aggressiveStackCompression && !findStackTooDeep(newStack, stack).empty())
+		if (
+			!_aggressiveStackCompression &&
+			!m_simpleLayout &&
+			!findStackTooDeep(newStack, stack, m_reachableStackDepth).empty()
+		)
 			// If we had stack errors, run again with aggressive stack compression.
 			return propagateStackThroughBlock(std::move(_exitStack), _block, true);
 		stack = std::move(newStack);
@@ -334,8 +392,10 @@ Stack StackLayoutGenerator::propagateStackThroughBlock(Stack _exitStack, CFG::Ba
 
 void StackLayoutGenerator::processEntryPoint(CFG::BasicBlock const& _entry, CFG::FunctionInfo const* _functionInfo)
 {
+	m_simpleLayout = countOperations(_entry) > m_simpleLayoutOperationThreshold;
+
 	std::list<CFG::BasicBlock const*> toVisit{&_entry};
-	std::set<CFG::BasicBlock const*> visited;
+	std::vector<bool> visited(m_cfg.blocks.size(), false);
 
 	// TODO: check whether visiting only a subset of these in the outer iteration below is enough.
 	std::list<std::pair<CFG::BasicBlock const*, CFG::BasicBlock const*>> backwardsJumps = collectBackwardsJumps(_entry);
@@ -349,15 +409,16 @@ void StackLayoutGenerator::processEntryPoint(CFG::BasicBlock const& _entry, CFG:
 			CFG::BasicBlock const *block = *toVisit.begin();
 			toVisit.pop_front();
 
-			if (visited.count(block))
+			if (visited[block->index])
 				continue;
 
 			if (std::optional<Stack> exitLayout = getExitLayoutOrStageDependencies(*block, visited, toVisit))
 			{
-				visited.emplace(block);
-				auto& info = m_layout.blockInfos[block];
+				visited[block->index] = true;
+				auto& info = m_layout.blockInfo(*block);
 				info.exitLayout = *exitLayout;
-				info.entryLayout = propagateStackThroughBlock(info.exitLayout, *block);
+				// Without the search for stack too deep errors, the stack is always compressed aggressively.
+				info.entryLayout = propagateStackThroughBlock(info.exitLayout, *block, m_simpleLayout);
 
 				for (auto entry: block->entries)
 					toVisit.emplace_back(entry);
@@ -371,8 +432,8 @@ void StackLayoutGenerator::processEntryPoint(CFG::BasicBlock const& _entry, CFG:
 			// This block jumps backwards, but does not provide all slots required by the jump target on exit.
 			// Therefore we need to visit the subgraph between ``target`` and ``jumpingBlock`` again.
 			if (ranges::any_of(
-				m_layout.blockInfos[target].entryLayout,
-				[exitLayout = m_layout.blockInfos[jumpingBlock].exitLayout](StackSlot const& _slot) {
+				m_layout.blockInfo(*target).entryLayout,
+				[exitLayout = m_layout.blockInfo(*jumpingBlock).exitLayout](StackSlot const& _slot) {
 					return !util::contains(exitLayout, _slot);
 				}
 			))
@@ -384,10 +445,10 @@ void StackLayoutGenerator::processEntryPoint(CFG::BasicBlock const& _entry, CFG:
 				// This is not required for correctness, since the set of stack slots will match, but it may move some
 				// required stack shuffling from the loop condition to outside the loop.
 				for (CFG::BasicBlock const* entry: target->entries)
-					visited.erase(entry);
+					visited[entry->index] = false;
 				util::BreadthFirstSearch<CFG::BasicBlock const*>{{jumpingBlock}}.run(
 					[&visited, target = target](CFG::BasicBlock const* _block, auto _addChild) {
-						visited.erase(_block);
+						visited[_block->index] = false;
 						if (_block == target)
 							return;
 						for (auto const* entry: _block->entries)
@@ -403,12 +464,36 @@ void StackLayoutGenerator::processEntryPoint(CFG::BasicBlock const& _entry, CFG:
 	}
 
 	stitchConditionalJumps(_entry);
-	fillInJunk(_entry, _functionInfo);
+	if (!m_simpleLayout)
+		fillInJunk(_entry, _functionInfo);
+}
+
+size_t StackLayoutGenerator::countOperations(CFG::BasicBlock const& _entry)
+{
+	size_t numOperations = 0;
+	util::BreadthFirstSearch<CFG::BasicBlock const*>{{&_entry}}.run([&](CFG::BasicBlock const* _block, auto _addChild) {
+		numOperations += _block->operations.size();
+		std::visit(util::GenericVisitor{
+			[&](CFG::BasicBlock::MainExit const&) {},
+			[&](CFG::BasicBlock::Jump const& _jump)
+			{
+				_addChild(_jump.target);
+			},
+			[&](CFG::BasicBlock::ConditionalJump const& _conditionalJump)
+			{
+				_addChild(_conditionalJump.zero);
+				_addChild(_conditionalJump.nonZero);
+			},
+			[&](CFG::BasicBlock::FunctionReturn const&) {},
+			[&](CFG::BasicBlock::Terminated const&) {},
+		}, _block->exit);
+	});
+	return numOperations;
 }
 
 std::optional<Stack> StackLayoutGenerator::getExitLayoutOrStageDependencies(
 	CFG::BasicBlock const& _block,
-	std::set<CFG::BasicBlock const*> const& _visited,
+	std::vector<bool> const& _visited,
 	std::list<CFG::BasicBlock const*>& _toVisit
 ) const
 {
@@ -423,29 +508,28 @@ std::optional<Stack> StackLayoutGenerator::getExitLayoutOrStageDependencies(
 			if (_jump.backwards)
 			{
 				// Choose the best currently known entry layout of the jump target as initial exit.
-				// Note that this may not yet be the final layout.
-				if (auto* info = util::valueOrNullptr(m_layout.blockInfos, _jump.target))
-					return info->entryLayout;
-				return Stack{};
+				// Note that this may not yet be the final layout and is empty if the target was not visited yet.
+				return m_layout.blockInfo(*_jump.target).entryLayout;
 			}
 			// If the current iteration has already visited the jump target, start from its entry layout.
-			if (_visited.count(_jump.target))
-				return m_layout.blockInfos.at(_jump.target).entryLayout;
+			if (_visited[_jump.target->index])
+				return m_layout.blockInfo(*_jump.target).entryLayout;
 			// Otherwise stage the jump target for visit and defer the current block.
 			_toVisit.emplace_front(_jump.target);
 			return std::nullopt;
 		},
 		[&](CFG::BasicBlock::ConditionalJump const& _conditionalJump) -> std::optional<Stack>
 		{
-			bool zeroVisited = _visited.count(_conditionalJump.zero);
-			bool nonZeroVisited = _visited.count(_conditionalJump.nonZero);
+			bool zeroVisited = _visited[_conditionalJump.zero->index];
+			bool nonZeroVisited = _visited[_conditionalJump.nonZero->index];
 			if (zeroVisited && nonZeroVisited)
 			{
 				// If the current iteration has already visited both jump targets, start from its entry layout.
-				Stack stack = combineStack(
-					m_layout.blockInfos.at(_conditionalJump.zero).entryLayout,
-					m_layout.blockInfos.at(_conditionalJump.nonZero).entryLayout
-				);
+				Stack const& zeroEntryLayout = m_layout.blockInfo(*_conditionalJump.zero).entryLayout;
+				Stack const& nonZeroEntryLayout = m_layout.blockInfo(*_conditionalJump.nonZero).entryLayout;
+				Stack stack = m_simpleLayout ?
+					combineStack(zeroEntryLayout, nonZeroEntryLayout, CombineStackSearch::None, m_reachableStackDepth) :
+					m_combineStackCache.combineStack(zeroEntryLayout, nonZeroEntryLayout);
 				// Additionally, the jump condition has to be at the stack top at exit.
 				stack.emplace_back(_conditionalJump.condition);
 				return stack;
@@ -503,7 +587,7 @@ void StackLayoutGenerator::stitchConditionalJumps(CFG::BasicBlock const& _block)
 {
 	util::BreadthFirstSearch<CFG::BasicBlock const*> breadthFirstSearch{{&_block}};
 	breadthFirstSearch.run([&](CFG::BasicBlock const* _block, auto _addChild) {
-		auto& info = m_layout.blockInfos.at(_block);
+		auto& info = m_layout.blockInfo(*_block);
 		std::visit(util::GenericVisitor{
 			[&](CFG::BasicBlock::MainExit const&) {},
 			[&](CFG::BasicBlock::Jump const& _jump)
@@ -513,8 +597,8 @@ void StackLayoutGenerator::stitchConditionalJumps(CFG::BasicBlock const& _block)
 			},
 			[&](CFG::BasicBlock::ConditionalJump const& _conditionalJump)
 			{
-				auto& zeroTargetInfo = m_layout.blockInfos.at(_conditionalJump.zero);
-				auto& nonZeroTargetInfo = m_layout.blockInfos.at(_conditionalJump.nonZero);
+				auto& zeroTargetInfo = m_layout.blockInfo(*_conditionalJump.zero);
+				auto& nonZeroTargetInfo = m_layout.blockInfo(*_conditionalJump.nonZero);
 				Stack exitLayout = info.exitLayout;
 
 				// The last block must have produced the condition at the stack top.
@@ -545,7 +629,12 @@ void StackLayoutGenerator::stitchConditionalJumps(CFG::BasicBlock const& _block)
 	});
 }
 
-Stack StackLayoutGenerator::combineStack(Stack const& _stack1, Stack const& _stack2)
+Stack StackLayoutGenerator::combineStack(
+	Stack const& _stack1,
+	Stack const& _stack2,
+	CombineStackSearch _search,
+	size_t _reachableStackDepth
+)
 {
 	// TODO: it would be nicer to replace this by a constructive algorithm.
 	// Currently it uses a reduced version of the Heap Algorithm to partly brute-force, which seems
@@ -563,9 +652,9 @@ Stack StackLayoutGenerator::combineStack(Stack const& _stack1, Stack const& _sta
 	Stack stack2Tail = _stack2 | ranges::views::drop(commonPrefix.size()) | ranges::to<Stack>;
 
 	if (stack1Tail.empty())
-		return commonPrefix + compressStack(stack2Tail);
+		return commonPrefix + compressStack(stack2Tail, _reachableStackDepth);
 	if (stack2Tail.empty())
-		return commonPrefix + compressStack(stack1Tail);
+		return commonPrefix + compressStack(stack1Tail, _reachableStackDepth);
 
 	Stack candidate;
 	for (auto slot: stack1Tail)
@@ -578,24 +667,50 @@ Stack StackLayoutGenerator::combineStack(Stack const& _stack1, Stack const& _sta
 		return std::holds_alternative<LiteralSlot>(slot) || std::holds_alternative<FunctionCallReturnLabelSlot>(slot);
 	});
 
+	// Keep the slots in the order in which they occur in the input stacks.
+	if (_search == CombineStackSearch::None)
+		return commonPrefix + candidate;
+
 	auto evaluate = [&](Stack const& _candidate) -> size_t {
 		size_t numOps = 0;
 		Stack testStack = _candidate;
-		auto swap = [&](unsigned _swapDepth) { ++numOps; if (_swapDepth > 16) numOps += 1000; };
+		auto swap = [&](unsigned _swapDepth) { ++numOps; if (_swapDepth > _reachableStackDepth) numOps += 1000; };
 		auto dupOrPush = [&](StackSlot const& _slot)
 		{
 			if (canBeFreelyGenerated(_slot))
 				return;
 			auto depth = util::findOffset(ranges::concat_view(commonPrefix, testStack) | ranges::views::reverse, _slot);
-			if (depth && *depth >= 16)
+			if (depth && *depth >= _reachableStackDepth)
 				numOps += 1000;
 		};
-		createStackLayout(testStack, stack1Tail, swap, dupOrPush, [&](){});
+		createStackLayout(testStack, stack1Tail, swap, dupOrPush, [&](){}, _reachableStackDepth);
 		testStack = _candidate;
-		createStackLayout(testStack, stack2Tail, swap, dupOrPush, [&](){});
+		createStackLayout(testStack, stack2Tail, swap, dupOrPush, [&](){}, _reachableStackDepth);
 		return numOps;
 	};
 
+	if (_search == CombineStackSearch::Exhaustive && candidate.size() <= maxExhaustiveSearchSlots)
+	{
+		// Starts with the candidate itself, so that ties are resolved in favour of the order in which
+		// the slots occur in the input stacks. The result is never worse than the one of the partial search below.
+		std::vector<size_t> permutation = ranges::views::iota(0u, candidate.size()) | ranges::to<std::vector<size_t>>;
+		Stack bestCandidate = candidate;
+		size_t bestCost = evaluate(candidate);
+		while (std::next_permutation(permutation.begin(), permutation.end()))
+		{
+			Stack permutedCandidate = permutation | ranges::views::transform([&](size_t _index) {
+				return candidate[_index];
+			}) | ranges::to<Stack>;
+			size_t cost = evaluate(permutedCandidate);
+			if (cost < bestCost)
+			{
+				bestCost = cost;
+				bestCandidate = std::move(permutedCandidate);
+			}
+		}
+		return commonPrefix + bestCandidate;
+	}
+
 	// See https://en.wikipedia.org/wiki/Heap's_algorithm
 	size_t n = candidate.size();
 	Stack bestCandidate = candidate;
@@ -632,32 +747,76 @@ Stack StackLayoutGenerator::combineStack(Stack const& _stack1, Stack const& _sta
 	return commonPrefix + bestCandidate;
 }
 
+Stack StackLayoutGenerator::CombineStackCache::combineStack(Stack const& _stack1, Stack const& _stack2)
+{
+	// The shape of the stacks consists of the size of the first stack followed by the kind of each slot
+	// and the index of its first occurrence in ``distinctSlots``.
+	Stack distinctSlots;
+	std::vector<size_t> shape{_stack1.size()};
+	shape.reserve(1 + 2 * (_stack1.size() + _stack2.size()));
+	for (Stack const* stack: {&_stack1, &_stack2})
+		for (StackSlot const& slot: *stack)
+		{
+			std::optional<size_t> offset = util::findOffset(distinctSlots, slot);
+			if (!offset)
+			{
+				offset = distinctSlots.size();
+				distinctSlots.emplace_back(slot);
+			}
+			shape.emplace_back(slot.index());
+			shape.emplace_back(*offset);
+		}
+
+	if (auto* cachedResult = util::valueOrNullptr(m_results, shape))
+	{
+		++m_hits;
+		return *cachedResult | ranges::views::transform([&](size_t _offset) {
+			return distinctSlots.at(_offset);
+		}) | ranges::to<Stack>;
+	}
+
+	++m_misses;
+	Stack result = StackLayoutGenerator::combineStack(
+		_stack1,
+		_stack2,
+		m_exhaustiveSearch ? CombineStackSearch::Exhaustive : CombineStackSearch::Partial,
+		m_reachableStackDepth
+	);
+	if (m_results.size() < maxEntries)
+		m_results.emplace(std::move(shape), result | ranges::views::transform([&](StackSlot const& _slot) {
+			std::optional<size_t> offset = util::findOffset(distinctSlots, _slot);
+			yulAssert(offset, "Combined stack contains a slot that is not part of the input stacks.");
+			return *offset;
+		}) | ranges::to<std::vector<size_t>>);
+	return result;
+}
+
 std::vector<StackLayoutGenerator::StackTooDeep> StackLayoutGenerator::reportStackTooDeep(CFG::BasicBlock const& _entry) const
 {
 	std::vector<StackTooDeep> stackTooDeepErrors;
 	util::BreadthFirstSearch<CFG::BasicBlock const*> breadthFirstSearch{{&_entry}};
 	breadthFirstSearch.run([&](CFG::BasicBlock const* _block, auto _addChild) {
-		Stack currentStack = m_layout.blockInfos.at(_block).entryLayout;
+		Stack currentStack = m_layout.blockInfo(*_block).entryLayout;
 
 		for (auto const& operation: _block->operations)
 		{
-			Stack& operationEntry = m_layout.operationEntryLayout.at(&operation);
+			Stack& operationEntry = m_layout.operationEntryLayout(operation);
 
-			stackTooDeepErrors += findStackTooDeep(currentStack, operationEntry);
+			stackTooDeepErrors += findStackTooDeep(currentStack, operationEntry, m_reachableStackDepth);
 			currentStack = operationEntry;
 			for (size_t i = 0; i < operation.input.size(); i++)
 				currentStack.pop_back();
 			currentStack += operation.output;
 		}
-		// Do not attempt to create the exit layout m_layout.blockInfos.at(_block).exitLayout here,
+		// Do not attempt to create the exit layout m_layout.blockInfo(*_block).exitLayout here,
 		// since the code generator will directly move to the target entry layout.
 
 		std::visit(util::GenericVisitor{
 			[&](CFG::BasicBlock::MainExit const&) {},
 			[&](CFG::BasicBlock::Jump const& _jump)
 			{
-				Stack const& targetLayout = m_layout.blockInfos.at(_jump.target).entryLayout;
-				stackTooDeepErrors += findStackTooDeep(currentStack, targetLayout);
+				Stack const& targetLayout = m_layout.blockInfo(*_jump.target).entryLayout;
+				stackTooDeepErrors += findStackTooDeep(currentStack, targetLayout, m_reachableStackDepth);
 
 				if (!_jump.backwards)
 					_addChild(_jump.target);
@@ -665,10 +824,10 @@ std::vector<StackLayoutGenerator::StackTooDeep> StackLayoutGenerator::reportStac
 			[&](CFG::BasicBlock::ConditionalJump const& _conditionalJump)
 			{
 				for (Stack const& targetLayout: {
-					m_layout.blockInfos.at(_conditionalJump.zero).entryLayout,
-					m_layout.blockInfos.at(_conditionalJump.nonZero).entryLayout
+					m_layout.blockInfo(*_conditionalJump.zero).entryLayout,
+					m_layout.blockInfo(*_conditionalJump.nonZero).entryLayout
 				})
-					stackTooDeepErrors += findStackTooDeep(currentStack, targetLayout);
+					stackTooDeepErrors += findStackTooDeep(currentStack, targetLayout, m_reachableStackDepth);
 
 				_addChild(_conditionalJump.zero);
 				_addChild(_conditionalJump.nonZero);
@@ -680,7 +839,7 @@ std::vector<StackLayoutGenerator::StackTooDeep> StackLayoutGenerator::reportStac
 	return stackTooDeepErrors;
 }
 
-Stack StackLayoutGenerator::compressStack(Stack _stack)
+Stack StackLayoutGenerator::compressStack(Stack _stack, size_t _reachableStackDepth)
 {
 	std::optional<size_t> firstDupOffset;
 	do
@@ -698,7 +857,7 @@ Stack StackLayoutGenerator::compressStack(Stack _stack)
 				break;
 			}
 			else if (auto dupDepth = util::findOffset(_stack | ranges::views::reverse | ranges::views::drop(depth + 1), slot))
-				if (depth + *dupDepth <= 16)
+				if (depth + *dupDepth <= _reachableStackDepth)
 				{
 					firstDupOffset = _stack.size() - depth - 1;
 					break;
@@ -715,11 +874,11 @@ void StackLayoutGenerator::fillInJunk(CFG::BasicBlock const& _block, CFG::Functi
 	auto addJunkRecursive = [&](CFG::BasicBlock const* _entry, size_t _numJunk) {
 		util::BreadthFirstSearch<CFG::BasicBlock const*> breadthFirstSearch{{_entry}};
 		breadthFirstSearch.run([&](CFG::BasicBlock const* _block, auto _addChild) {
-			auto& blockInfo = m_layout.blockInfos.at(_block);
+			auto& blockInfo = m_layout.blockInfo(*_block);
 			blockInfo.entryLayout = Stack{_numJunk, JunkSlot{}} + std::move(blockInfo.entryLayout);
 			for (auto const& operation: _block->operations)
 			{
-				auto& operationEntryLayout = m_layout.operationEntryLayout.at(&operation);
+				auto& operationEntryLayout = m_layout.operationEntryLayout(operation);
 				operationEntryLayout = Stack{_numJunk, JunkSlot{}} + std::move(operationEntryLayout);
 			}
 			blockInfo.exitLayout = Stack{_numJunk, JunkSlot{}} + std::move(blockInfo.exitLayout);
@@ -743,12 +902,16 @@ void StackLayoutGenerator::fillInJunk(CFG::BasicBlock const& _block, CFG::Functi
 	/// @returns the number of operations required to transform @a _source to @a _target.
 	auto evaluateTransform = [&](Stack _source, Stack const& _target) -> size_t {
 		size_t opGas = 0;
+		// DUPN and SWAPN are priced like DUP16 and SWAP16.
 		auto swap = [&](unsigned _swapDepth)
 		{
-			if (_swapDepth > 16)
+			if (_swapDepth > m_reachableStackDepth)
 				opGas += 1000;
 			else
-				opGas += evmasm::GasMeter::runGas(evmasm::swapInstruction(_swapDepth), langutil::EVMVersion());
+				opGas += evmasm::GasMeter::runGas(
+					evmasm::swapInstruction(std::min(_swapDepth, 16u)),
+					langutil::EVMVersion()
+				);
 		};
 		auto dupOrPush = [&](StackSlot const& _slot)
 		{
@@ -758,8 +921,11 @@ void StackLayoutGenerator::fillInJunk(CFG::BasicBlock const& _block, CFG::Functi
 			{
 				if (auto depth = util::findOffset(_source | ranges::views::reverse, _slot))
 				{
-					if (*depth < 16)
-						opGas += evmasm::GasMeter::runGas(evmasm::dupInstruction(static_cast<unsigned>(*depth + 1)), langutil::EVMVersion());
+					if (*depth < m_reachableStackDepth)
+						opGas += evmasm::GasMeter::runGas(
+							evmasm::dupInstruction(static_cast<unsigned>(std::min<size_t>(*depth + 1, 16))),
+							langutil::EVMVersion()
+						);
 					else
 						opGas += 1000;
 				}
@@ -776,7 +942,7 @@ void StackLayoutGenerator::fillInJunk(CFG::BasicBlock const& _block, CFG::Functi
 			}
 		};
 		auto pop = [&]() { opGas += evmasm::GasMeter::runGas(evmasm::Instruction::POP,langutil::EVMVersion()); };
-		createStackLayout(_source, _target, swap, dupOrPush, pop);
+		createStackLayout(_source, _target, swap, dupOrPush, pop, m_reachableStackDepth);
 		return opGas;
 	};
 	/// @returns the number of junk slots to be prepended to @a _targetLayout for an optimal transition from
@@ -801,7 +967,7 @@ void StackLayoutGenerator::fillInJunk(CFG::BasicBlock const& _block, CFG::Functi
 	{
 		size_t bestNumJunk = getBestNumJunk(
 			_functionInfo->parameters | ranges::views::reverse | ranges::to<Stack>,
-			m_layout.blockInfos.at(&_block).entryLayout
+			m_layout.blockInfo(_block).entryLayout
 		);
 		if (bestNumJunk > 0)
 			addJunkRecursive(&_block, bestNumJunk);
@@ -813,9 +979,9 @@ void StackLayoutGenerator::fillInJunk(CFG::BasicBlock const& _block, CFG::Functi
 	util::BreadthFirstSearch<CFG::BasicBlock const*>{{&_block}}.run([&](CFG::BasicBlock const* _block, auto _addChild) {
 		if (_block->allowsJunk())
 		{
-			auto& blockInfo = m_layout.blockInfos.at(_block);
+			auto& blockInfo = m_layout.blockInfo(*_block);
 			Stack entryLayout = blockInfo.entryLayout;
-			Stack const& nextLayout = _block->operations.empty() ? blockInfo.exitLayout : m_layout.operationEntryLayout.at(&_block->operations.front());
+			Stack const& nextLayout = _block->operations.empty() ? blockInfo.exitLayout : m_layout.operationEntryLayout(_block->operations.front());
 			if (entryLayout != nextLayout)
 			{
 				size_t bestNumJunk = getBestNumJunk(
@@ -22,8 +22,10 @@
 #pragma once
 
 #include <libyul/backends/evm/ControlFlowGraph.h>
+#include <libyul/backends/evm/StackHelpers.h>
 
 #include <map>
+#include <vector>
 
 namespace solidity::yul
 {
@@ -37,11 +39,23 @@ struct StackLayout
 		/// The resulting stack layout after executing the block.
 		Stack exitLayout;
 	};
-	std::map<CFG::BasicBlock const*, BlockInfo> blockInfos;
-	/// For each operation the complete stack layout that:
+
+	explicit StackLayout(CFG const& _cfg):
+		blockInfos(_cfg.blocks.size()),
+		operationEntryLayouts(_cfg.numOperations)
+	{}
+
+	BlockInfo& blockInfo(CFG::BasicBlock const& _block) { return blockInfos.at(_block.index); }
+	BlockInfo const& blockInfo(CFG::BasicBlock const& _block) const { return blockInfos.at(_block.index); }
+	Stack& operationEntryLayout(CFG::Operation const& _operation) { return operationEntryLayouts.at(_operation.index); }
+	Stack const& operationEntryLayout(CFG::Operation const& _operation) const { return operationEntryLayouts.at(_operation.index); }
+
+	/// The layouts of all blocks, indexed by ``CFG::BasicBlock::index``.
+	std::vector<BlockInfo> blockInfos;
+	/// Indexed by ``CFG::Operation::index``. For each operation the complete stack layout that:
 	/// - has the slots required for the operation at the stack top.
 	/// - will have the operation result in a layout that makes it easy to achieve the next desired layout.
-	std::map<CFG::Operation const*, Stack> operationEntryLayout;
+	std::vector<Stack> operationEntryLayouts;
 };
 
 class StackLayoutGenerator
@@ -55,18 +69,102 @@ public:
 		std::vector<YulString> variableChoices;
 	};
 
-	static StackLayout run(CFG const& _cfg);
+	/// Number of operations of a function or the main entry point above which the simple layout is used
+	/// by default.
+	static constexpr size_t defaultSimpleLayoutOperationThreshold = 5000;
+
+	/// If @a _exhaustiveSearch is true, all orders of the slots are tried when combining the
+	/// layouts of two branches with at most @a maxExhaustiveSearchSlots distinct slots,
+	/// instead of only a subset of them.
+	/// @a _reachableStackDepth is the maximal depth of the swaps and dups of the generated code,
+	/// see @a reachableStackDepth.
+	/// Functions with more than @a _simpleLayoutOperationThreshold operations use the simple layout,
+	/// see @a m_simpleLayout.
+	static StackLayout run(
+		CFG const& _cfg,
+		bool _exhaustiveSearch = false,
+		size_t _reachableStackDepth = legacyReachableStackDepth,
+		size_t _simpleLayoutOperationThreshold = defaultSimpleLayoutOperationThreshold
+	);
 	/// @returns a map from function names to the stack too deep errors occurring in that function.
 	/// Requires @a _cfg to be a control flow graph generated from disambiguated Yul.
 	/// The empty string is mapped to the stack too deep errors of the main entry point.
-	static std::map<YulString, std::vector<StackTooDeep>> reportStackTooDeep(CFG const& _cfg);
+	/// Uses the default simple layout threshold, like the code transform.
+	/// @a _exhaustiveSearch has to match the setting used by the code transform, see @a run.
+	static std::map<YulString, std::vector<StackTooDeep>> reportStackTooDeep(
+		CFG const& _cfg,
+		size_t _reachableStackDepth = legacyReachableStackDepth,
+		bool _exhaustiveSearch = false
+	);
 	/// @returns all stack too deep errors in the function named @a _functionName.
 	/// Requires @a _cfg to be a control flow graph generated from disambiguated Yul.
 	/// If @a _functionName is empty, the stack too deep errors of the main entry point are reported instead.
-	static std::vector<StackTooDeep> reportStackTooDeep(CFG const& _cfg, YulString _functionName);
+	static std::vector<StackTooDeep> reportStackTooDeep(
+		CFG const& _cfg,
+		YulString _functionName,
+		size_t _reachableStackDepth = legacyReachableStackDepth,
+		bool _exhaustiveSearch = false
+	);
+
+	/// Permutations of the slots evaluated by ``combineStack``.
+	/// ``None`` keeps the order of the input stacks, ``Partial`` evaluates a linear subset of all permutations
+	/// and ``Exhaustive`` evaluates all permutations of at most @a maxExhaustiveSearchSlots slots.
+	enum class CombineStackSearch { None, Partial, Exhaustive };
+
+	/// Calculates the ideal stack layout, s.t. both @a _stack1 and @a _stack2 can be achieved with minimal
+	/// stack shuffling when starting from the returned layout.
+	/// @a _search determines which orders of the slots are evaluated.
+	static Stack combineStack(
+		Stack const& _stack1,
+		Stack const& _stack2,
+		CombineStackSearch _search,
+		size_t _reachableStackDepth
+	);
+
+	/// Upper bound for the number of slots whose permutations are all evaluated by an exhaustive
+	/// ``combineStack``. Bounds the number of evaluated layouts to 7! = 5040 per call.
+	static constexpr size_t maxExhaustiveSearchSlots = 7;
 
 private:
-	StackLayoutGenerator(StackLayout& _context, CFG::FunctionInfo const* _functionInfo);
+	/// Memoizes the results of ``combineStack``.
+	/// The result of ``combineStack`` only depends on the kinds of the slots of both stacks and on which of them
+	/// are equal, so results are keyed by this shape and can be reused for different stacks of the same shape.
+	class CombineStackCache
+	{
+	public:
+		explicit CombineStackCache(
+			bool _exhaustiveSearch = false,
+			size_t _reachableStackDepth = legacyReachableStackDepth
+		):
+			m_exhaustiveSearch(_exhaustiveSearch),
+			m_reachableStackDepth(_reachableStackDepth)
+		{}
+
+		Stack combineStack(Stack const& _stack1, Stack const& _stack2);
+
+		size_t reachableStackDepth() const { return m_reachableStackDepth; }
+
+		size_t hits() const { return m_hits; }
+		size_t misses() const { return m_misses; }
+
+	private:
+		/// Upper bound for the number of cached results.
+		static constexpr size_t maxEntries = 4096;
+		/// Maps the shape of a pair of stacks to the shape of the combined stack.
+		std::map<std::vector<size_t>, std::vector<size_t>> m_results;
+		bool m_exhaustiveSearch = false;
+		size_t m_reachableStackDepth = legacyReachableStackDepth;
+		size_t m_hits = 0;
+		size_t m_misses = 0;
+	};
+
+	StackLayoutGenerator(
+		StackLayout& _context,
+		CFG const& _cfg,
+		CFG::FunctionInfo const* _functionInfo,
+		CombineStackCache& _combineStackCache,
+		size_t _simpleLayoutOperationThreshold = defaultSimpleLayoutOperationThreshold
+	);
 
 	/// @returns the optimal entry stack layout, s.t. @a _operation can be applied to it and
 	/// the result can be transformed to @a _exitStack with minimal stack shuffling.
@@ -79,13 +177,16 @@ private:
 
 	/// Main algorithm walking the graph from entry to exit and propagating back the stack layouts to the entries.
 	/// Iteratively reruns itself along backwards jumps until the layout is stabilized.
+	/// Uses the simple layout for functions with more than @a m_simpleLayoutOperationThreshold operations,
+	/// see @a m_simpleLayout.
 	void processEntryPoint(CFG::BasicBlock const& _entry, CFG::FunctionInfo const* _functionInfo = nullptr);
 
 	/// @returns the best known exit layout of @a _block, if all dependencies are already @a _visited.
 	/// If not, adds the dependencies to @a _dependencyList and @returns std::nullopt.
+	/// @a _visited is indexed by ``CFG::BasicBlock::index``.
 	std::optional<Stack> getExitLayoutOrStageDependencies(
 		CFG::BasicBlock const& _block,
-		std::set<CFG::BasicBlock const*> const& _visited,
+		std::vector<bool> const& _visited,
 		std::list<CFG::BasicBlock const*>& _dependencyList
 	) const;
 
@@ -98,9 +199,8 @@ private:
 	/// exactly, except that slots not required after the jump are marked as `JunkSlot`s.
 	void stitchConditionalJumps(CFG::BasicBlock const& _block);
 
-	/// Calculates the ideal stack layout, s.t. both @a _stack1 and @a _stack2 can be achieved with minimal
-	/// stack shuffling when starting from the returned layout.
-	static Stack combineStack(Stack const& _stack1, Stack const& _stack2);
+	/// @returns the number of operations in all blocks reachable from @a _entry.
+	static size_t countOperations(CFG::BasicBlock const& _entry);
 
 	/// Walks through the CFG and reports any stack too deep errors that would occur when generating code for it
 	/// without countermeasures.
@@ -109,13 +209,21 @@ private:
 	/// @returns a copy of @a _stack stripped of all duplicates and slots that can be freely generated.
 	/// Attempts to create a layout that requires a minimal amount of operations to reconstruct the original
 	/// stack @a _stack.
-	static Stack compressStack(Stack _stack);
+	static Stack compressStack(Stack _stack, size_t _reachableStackDepth);
 
 	//// Fills in junk when entering branches that do not need a clean stack in case the result is cheaper.
 	void fillInJunk(CFG::BasicBlock const& _block, CFG::FunctionInfo const* _functionInfo = nullptr);
 
 	StackLayout& m_layout;
+	CFG const& m_cfg;
 	CFG::FunctionInfo const* m_currentFunctionInfo = nullptr;
+	CombineStackCache& m_combineStackCache;
+	size_t m_reachableStackDepth = legacyReachableStackDepth;
+	size_t m_simpleLayoutOperationThreshold = defaultSimpleLayoutOperationThreshold;
+	/// If true, the layouts of branches are merged without searching permutations of their slots, the stack
+	/// is always compressed aggressively instead of checking each operation for stack too deep errors, and
+	/// no junk is added. This bounds the time spent on very large functions at the cost of some stack shuffling.
+	bool m_simpleLayout = false;
 };
 
 }
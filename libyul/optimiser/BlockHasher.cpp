@@ -44,11 +44,33 @@ static constexpr uint64_t compileTimeLiteralHash(char const (&_literal)[N])
 std::map<Block const*, uint64_t> BlockHasher::run(Block const& _block)
 {
 	std::map<Block const*, uint64_t> result;
-	BlockHasher blockHasher(result);
+	BlockHasher blockHasher(&result);
 	blockHasher(_block);
 	return result;
 }
 
+uint64_t BlockHasher::run(FunctionDefinition const& _function)
+{
+	BlockHasher hasher(nullptr);
+	hasher.hash64(compileTimeLiteralHash("FunctionDefinition"));
+	hasher.hash64(_function.parameters.size());
+	hasher.hash64(_function.returnVariables.size());
+	// Parameters and return variables are treated like internally declared variables,
+	// so that the references to them in the body are hashed by their position.
+	for (auto const* variables: {&_function.parameters, &_function.returnVariables})
+		for (auto const& variable: *variables)
+		{
+			hasher.hash64(variable.type.hash());
+			yulAssert(!hasher.m_variableReferences.count(variable.name), "");
+			hasher.m_variableReferences[variable.name] = VariableReference{
+				hasher.m_internalIdentifierCount++,
+				false
+			};
+		}
+	hasher(_function.body);
+	return hasher.m_hash;
+}
+
 void BlockHasher::operator()(Literal const& _literal)
 {
 	hash64(compileTimeLiteralHash("Literal"));
@@ -185,7 +207,8 @@ void BlockHasher::operator()(Block const& _block)
 	for (auto const& statement: _block.statements)
 		subBlockHasher.visit(statement);
 
-	m_blockHashes[&_block] = subBlockHasher.m_hash;
+	if (m_blockHashes)
+		(*m_blockHashes)[&_block] = subBlockHasher.m_hash;
 
 	hash64(subBlockHasher.m_hash);
 	hash64(subBlockHasher.m_externalReferences.size());
@@ -95,12 +95,17 @@ public:
 	void operator()(Block const& _block) override;
 
 	static std::map<Block const*, uint64_t> run(Block const& _block);
+	/// @returns a hash of the function that, in contrast to the hash of its body, also takes
+	/// the number, types and order of its parameters and return variables into account.
+	/// Functions that are syntactically equal up to renaming will have identical hashes.
+	static uint64_t run(FunctionDefinition const& _function);
 
 
 private:
-	BlockHasher(std::map<Block const*, uint64_t>& _blockHashes): m_blockHashes(_blockHashes) {}
+	/// @param _blockHashes if not null, the hashes of all non-empty blocks are stored there.
+	BlockHasher(std::map<Block const*, uint64_t>* _blockHashes): m_blockHashes(_blockHashes) {}
 
-	std::map<Block const*, uint64_t>& m_blockHashes;
+	std::map<Block const*, uint64_t>* m_blockHashes = nullptr;
 
 	struct VariableReference
 	{
@@ -0,0 +1,271 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Optimiser component that moves repeated blocks of code into functions.
+ */
+
+#include <libyul/optimiser/BlockOutliner.h>
+
+#include <libyul/optimiser/ASTCopier.h>
+#include <libyul/optimiser/BlockHasher.h>
+#include <libyul/optimiser/Metrics.h>
+#include <libyul/optimiser/NameDispenser.h>
+#include <libyul/optimiser/OptimiserStep.h>
+#include <libyul/optimiser/SyntacticalEquality.h>
+#include <libyul/optimiser/TypeInfo.h>
+
+#include <libyul/AST.h>
+
+#include <libsolutil/CommonData.h>
+
+#include <range/v3/algorithm/find_if.hpp>
+#include <range/v3/algorithm/none_of.hpp>
+
+#include <algorithm>
+#include <map>
+
+using namespace solidity;
+using namespace solidity::util;
+using namespace solidity::yul;
+
+namespace
+{
+
+/**
+ * Determines whether a block can be moved into a function and collects
+ * the variables it references and declares.
+ */
+class OutlinabilityChecker: public ASTWalker
+{
+public:
+	explicit OutlinabilityChecker(TypeInfo const& _typeInfo): m_typeInfo(_typeInfo) {}
+
+	using ASTWalker::operator();
+	void operator()(Identifier const& _identifier) override
+	{
+		if (!m_declaredVariableSet.count(_identifier.name) && m_freeVariableSet.insert(_identifier.name).second)
+			freeVariables.emplace_back(TypedName{
+				_identifier.debugData,
+				_identifier.name,
+				m_typeInfo.typeOfVariable(_identifier.name)
+			});
+	}
+	void operator()(VariableDeclaration const& _varDecl) override
+	{
+		ASTWalker::operator()(_varDecl);
+		for (auto const& variable: _varDecl.variables)
+		{
+			m_declaredVariableSet.insert(variable.name);
+			declaredVariables.emplace_back(variable.name);
+		}
+	}
+	void operator()(Assignment const& _assignment) override
+	{
+		for (auto const& variable: _assignment.variableNames)
+			if (!m_declaredVariableSet.count(variable.name))
+				outlinable = false;
+		ASTWalker::operator()(_assignment);
+	}
+	void operator()(ForLoop const& _loop) override
+	{
+		++m_loopDepth;
+		ASTWalker::operator()(_loop);
+		--m_loopDepth;
+	}
+	void operator()(Break const&) override
+	{
+		if (m_loopDepth == 0)
+			outlinable = false;
+	}
+	void operator()(Continue const&) override
+	{
+		if (m_loopDepth == 0)
+			outlinable = false;
+	}
+	void operator()(Leave const&) override { outlinable = false; }
+	void operator()(FunctionDefinition const&) override { outlinable = false; }
+
+	bool outlinable = true;
+	TypedNameList freeVariables;
+	std::vector<YulString> declaredVariables;
+
+private:
+	TypeInfo const& m_typeInfo;
+	size_t m_loopDepth = 0;
+	std::set<YulString> m_freeVariableSet;
+	std::set<YulString> m_declaredVariableSet;
+};
+
+}
+
+void BlockOutliner::run(OptimiserStepContext& _context, Block& _ast)
+{
+	TypeInfo typeInfo{_context.dialect, _ast};
+	BlockOutliner outliner{typeInfo};
+	outliner(_ast);
+	std::map<Block const*, uint64_t> hashes = BlockHasher::run(_ast);
+
+	// Groups of equivalent candidates, in the order of their first occurrence.
+	std::vector<std::vector<Candidate const*>> groups;
+	std::map<uint64_t, std::vector<size_t>> groupsByHash;
+	for (Candidate const& candidate: outliner.m_candidates)
+	{
+		std::vector<size_t>& sameHash = groupsByHash[hashes.at(candidate.block)];
+		auto group = ranges::find_if(sameHash, [&](size_t _group) {
+			return equivalent(*groups[_group].front(), candidate);
+		});
+		if (group != sameHash.end())
+			groups[*group].emplace_back(&candidate);
+		else
+		{
+			sameHash.emplace_back(groups.size());
+			groups.emplace_back(std::vector<Candidate const*>{&candidate});
+		}
+	}
+	std::stable_sort(groups.begin(), groups.end(), [](auto const& _a, auto const& _b) {
+		return _a.front()->size > _b.front()->size;
+	});
+
+	std::set<Block const*> outlinedBlocks;
+	std::set<Block const*> blocksContainingOutlined;
+	std::vector<Statement> newFunctions;
+	for (auto const& group: groups)
+	{
+		// Blocks inside or around already outlined blocks have been or will be modified.
+		std::vector<Candidate const*> occurrences;
+		for (Candidate const* candidate: group)
+			if (
+				!blocksContainingOutlined.count(candidate->block) &&
+				ranges::none_of(candidate->enclosingBlocks, [&](Block const* _block) {
+					return outlinedBlocks.count(_block) > 0;
+				})
+			)
+				occurrences.emplace_back(candidate);
+
+		if (
+			occurrences.size() < 2 ||
+			!beneficial(group.front()->size, group.front()->freeVariables.size(), occurrences.size())
+		)
+			continue;
+
+		// The new function gets fresh names for all its variables to keep the names unique.
+		Candidate const& model = *occurrences.front();
+		YulString functionName = _context.dispenser.newName(YulString{"outlined"});
+		std::map<YulString, YulString> translations;
+		TypedNameList parameters;
+		for (TypedName const& variable: model.freeVariables)
+		{
+			parameters.emplace_back(TypedName{
+				variable.debugData,
+				_context.dispenser.newName(variable.name),
+				variable.type
+			});
+			translations[variable.name] = parameters.back().name;
+		}
+		for (YulString variable: model.declaredVariables)
+			translations[variable] = _context.dispenser.newName(variable);
+		newFunctions.emplace_back(FunctionDefinition{
+			model.block->debugData,
+			functionName,
+			std::move(parameters),
+			{},
+			FunctionCopier{translations}.translate(*model.block)
+		});
+
+		for (Candidate const* occurrence: occurrences)
+		{
+			outlinedBlocks.insert(occurrence->block);
+			blocksContainingOutlined.insert(occurrence->enclosingBlocks.begin(), occurrence->enclosingBlocks.end());
+
+			langutil::DebugData::ConstPtr debugData = occurrence->block->debugData;
+			FunctionCall call{debugData, Identifier{debugData, functionName}, {}};
+			for (TypedName const& variable: occurrence->freeVariables)
+				call.arguments.emplace_back(Identifier{debugData, variable.name});
+			occurrence->block->statements = make_vector<Statement>(
+				ExpressionStatement{debugData, std::move(call)}
+			);
+		}
+	}
+
+	// Only added at the end, because extending the top-level block can invalidate
+	// the references to the candidates.
+	_ast.statements += std::move(newFunctions);
+}
+
+void BlockOutliner::operator()(If& _if)
+{
+	visit(*_if.condition);
+	visitCandidate(_if.body);
+}
+
+void BlockOutliner::operator()(Switch& _switch)
+{
+	visit(*_switch.expression);
+	for (auto& _case: _switch.cases)
+		visitCandidate(_case.body);
+}
+
+void BlockOutliner::operator()(ForLoop& _loop)
+{
+	(*this)(_loop.pre);
+	visit(*_loop.condition);
+	(*this)(_loop.post);
+	visitCandidate(_loop.body);
+}
+
+void BlockOutliner::visitCandidate(Block& _block)
+{
+	OutlinabilityChecker checker{m_typeInfo};
+	checker(_block);
+	if (checker.outlinable && !_block.statements.empty())
+		m_candidates.emplace_back(Candidate{
+			&_block,
+			m_enclosingBlocks,
+			std::move(checker.freeVariables),
+			std::move(checker.declaredVariables),
+			CodeSize::codeSize(_block)
+		});
+
+	m_enclosingBlocks.emplace_back(&_block);
+	(*this)(_block);
+	m_enclosingBlocks.pop_back();
+}
+
+bool BlockOutliner::equivalent(Candidate const& _a, Candidate const& _b)
+{
+	if (_a.size != _b.size || _a.freeVariables.size() != _b.freeVariables.size())
+		return false;
+
+	// The free variables are compared like function parameters, so that they can differ
+	// in name but have to be used in the same way.
+	SyntacticallyEqual equal;
+	return
+		equal.statementEqual(
+			FunctionDefinition{{}, {}, _a.freeVariables, {}, {}},
+			FunctionDefinition{{}, {}, _b.freeVariables, {}, {}}
+		) &&
+		equal.statementEqual(*_a.block, *_b.block);
+}
+
+bool BlockOutliner::beneficial(size_t _size, size_t _parameters, size_t _occurrences)
+{
+	// Rough estimate of the size of a call, including passing the arguments
+	// and returning from the function.
+	size_t callOverhead = 3 + _parameters;
+	return (_occurrences - 1) * _size > _occurrences * callOverhead + 1;
+}
@@ -0,0 +1,97 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Optimiser component that moves repeated blocks of code into functions.
+ */
+#pragma once
+
+#include <libyul/optimiser/ASTWalker.h>
+#include <libyul/optimiser/OptimiserStep.h>
+#include <libyul/ASTForward.h>
+#include <libyul/AST.h>
+
+#include <set>
+#include <vector>
+
+namespace solidity::yul
+{
+
+struct OptimiserStepContext;
+class TypeInfo;
+
+/**
+ * Optimiser component that replaces blocks that occur multiple times in identical form
+ * (up to renaming of variables) by calls to a new function that contains a single copy
+ * of the block. It is the inverse of the FullInliner and aims at reducing the code size.
+ *
+ * The blocks considered are the bodies of if statements, switch cases and for loops.
+ * A block can only be outlined if it does not assign to variables declared outside of it,
+ * does not contain ``leave`` and does not contain ``break`` or ``continue`` statements
+ * that refer to a loop outside of it. The variables declared outside of the block that are
+ * referenced in it become the parameters of the new function.
+ *
+ * Blocks are only outlined if the saved code size is larger than the estimated overhead
+ * of the calls. Larger blocks are preferred over the blocks they contain.
+ *
+ * The new functions are added at the end of the top-level block.
+ *
+ * Prerequisites: Disambiguator, ForLoopInitRewriter, FunctionHoister
+ */
+class BlockOutliner: public ASTModifier
+{
+public:
+	static constexpr char const* name{"BlockOutliner"};
+	static void run(OptimiserStepContext& _context, Block& _ast);
+
+	using ASTModifier::operator();
+	void operator()(If& _if) override;
+	void operator()(Switch& _switch) override;
+	void operator()(ForLoop& _loop) override;
+
+private:
+	struct Candidate
+	{
+		Block* block = nullptr;
+		/// Bodies of the statements this block is contained in.
+		std::vector<Block const*> enclosingBlocks;
+		/// Variables declared outside of the block that are referenced in it,
+		/// in order of their first reference.
+		TypedNameList freeVariables;
+		/// Variables declared inside the block, in order of their declaration.
+		std::vector<YulString> declaredVariables;
+		size_t size = 0;
+	};
+
+	explicit BlockOutliner(TypeInfo const& _typeInfo): m_typeInfo(_typeInfo) {}
+
+	/// Records @a _block as a candidate if it can be outlined and visits it.
+	void visitCandidate(Block& _block);
+
+	/// @returns true if the occurrences of @a _a and @a _b can be replaced by calls
+	/// to the same function.
+	static bool equivalent(Candidate const& _a, Candidate const& _b);
+	/// @returns true if replacing the @a _occurrences of a block of size @a _size
+	/// with @a _parameters free variables by function calls reduces the code size.
+	static bool beneficial(size_t _size, size_t _parameters, size_t _occurrences);
+
+	TypeInfo const& m_typeInfo;
+	std::vector<Candidate> m_candidates;
+	std::vector<Block const*> m_enclosingBlocks;
+};
+
+}
@@ -32,10 +32,11 @@
 #include <libyul/Utilities.h>
 
 #include <libsolutil/CommonData.h>
-#include <libsolutil/cxx20.h>
 
 #include <variant>
 
+#include <range/v3/algorithm/any_of.hpp>
+#include <range/v3/algorithm/find_if.hpp>
 #include <range/v3/view/reverse.hpp>
 
 using namespace solidity;
@@ -45,10 +46,12 @@ using namespace solidity::yul;
 DataFlowAnalyzer::DataFlowAnalyzer(
 	Dialect const& _dialect,
 	MemoryAndStorage _analyzeStores,
-	std::map<YulString, SideEffects> _functionSideEffects
+	std::map<YulString, SideEffects> _functionSideEffects,
+	std::map<YulString, std::set<u256>> _functionStorageWrites
 ):
 	m_dialect(_dialect),
 	m_functionSideEffects(std::move(_functionSideEffects)),
+	m_functionStorageWrites(std::move(_functionStorageWrites)),
 	m_knowledgeBase([this](YulString _var) { return variableValue(_var); }),
 	m_analyzeStores(_analyzeStores == MemoryAndStorage::Analyze)
 {
@@ -62,6 +65,10 @@ DataFlowAnalyzer::DataFlowAnalyzer(
 			m_storeFunctionName[static_cast<unsigned>(StoreLoadLocation::Storage)] = builtin->name;
 		if (auto const* builtin = _dialect.storageLoadFunction(YulString{}))
 			m_loadFunctionName[static_cast<unsigned>(StoreLoadLocation::Storage)] = builtin->name;
+		if (auto const* builtin = _dialect.transientStorageStoreFunction(YulString{}))
+			m_storeFunctionName[static_cast<unsigned>(StoreLoadLocation::TransientStorage)] = builtin->name;
+		if (auto const* builtin = _dialect.transientStorageLoadFunction(YulString{}))
+			m_loadFunctionName[static_cast<unsigned>(StoreLoadLocation::TransientStorage)] = builtin->name;
 	}
 }
 
@@ -72,23 +79,34 @@ void DataFlowAnalyzer::operator()(ExpressionStatement& _statement)
 		if (auto vars = isSimpleStore(StoreLoadLocation::Storage, _statement))
 		{
 			ASTModifier::operator()(_statement);
-			cxx20::erase_if(m_state.environment.storage, mapTuple([&](auto&& key, auto&& value) {
+			eraseKnowledgeIf(m_state.environment.storage, &EnvironmentChanges::storage, mapTuple([&](auto&& key, auto&& value) {
 				return
 					!m_knowledgeBase.knownToBeDifferent(vars->first, key) &&
 					vars->second != value;
 			}));
-			m_state.environment.storage[vars->first] = vars->second;
+			writeKnowledge(m_state.environment.storage, &EnvironmentChanges::storage, vars->first, vars->second);
+			return;
+		}
+		else if (auto vars = isSimpleStore(StoreLoadLocation::TransientStorage, _statement))
+		{
+			ASTModifier::operator()(_statement);
+			eraseKnowledgeIf(m_state.environment.transientStorage, &EnvironmentChanges::transientStorage, mapTuple([&](auto&& key, auto&& value) {
+				return
+					!m_knowledgeBase.knownToBeDifferent(vars->first, key) &&
+					vars->second != value;
+			}));
+			writeKnowledge(m_state.environment.transientStorage, &EnvironmentChanges::transientStorage, vars->first, vars->second);
 			return;
 		}
 		else if (auto vars = isSimpleStore(StoreLoadLocation::Memory, _statement))
 		{
 			ASTModifier::operator()(_statement);
-			cxx20::erase_if(m_state.environment.memory, mapTuple([&](auto&& key, auto&& /* value */) {
+			eraseKnowledgeIf(m_state.environment.memory, &EnvironmentChanges::memory, mapTuple([&](auto&& key, auto&& /* value */) {
 				return !m_knowledgeBase.knownToBeDifferentByAtLeast32(vars->first, key);
 			}));
 			// TODO erase keccak knowledge, but in a more clever way
-			m_state.environment.keccak = {};
-			m_state.environment.memory[vars->first] = vars->second;
+			clearKnowledge(m_state.environment.keccak, &EnvironmentChanges::keccak);
+			writeKnowledge(m_state.environment.memory, &EnvironmentChanges::memory, vars->first, vars->second);
 			return;
 		}
 	}
@@ -126,10 +144,10 @@ void DataFlowAnalyzer::operator()(VariableDeclaration& _varDecl)
 void DataFlowAnalyzer::operator()(If& _if)
 {
 	clearKnowledgeIfInvalidated(*_if.condition);
-	Environment preEnvironment = m_state.environment;
+	beginBranch();
 
 	ASTModifier::operator()(_if);
-	joinKnowledge(preEnvironment);
+	joinKnowledge({endBranch()}, false);
 
 	clearValues(assignedVariableNames(_if.body));
 }
@@ -139,20 +157,21 @@ void DataFlowAnalyzer::operator()(Switch& _switch)
 	clearKnowledgeIfInvalidated(*_switch.expression);
 	visit(*_switch.expression);
 	std::set<YulString> assignedVariables;
+	// Each case starts from the environment at the start of the switch.
+	std::vector<EnvironmentChanges> caseEnds;
 	for (auto& _case: _switch.cases)
 	{
-		Environment preEnvironment = m_state.environment;
+		beginBranch();
 		(*this)(_case.body);
-		joinKnowledge(preEnvironment);
+		caseEnds.emplace_back(endBranch());
 
 		std::set<YulString> variables = assignedVariableNames(_case.body);
 		assignedVariables += variables;
 		// This is a little too destructive, we could retain the old values.
 		clearValues(variables);
-		clearKnowledgeIfInvalidated(_case.body);
 	}
-	for (auto& _case: _switch.cases)
-		clearKnowledgeIfInvalidated(_case.body);
+	bool hasDefault = ranges::any_of(_switch.cases, [](Case const& _case) { return !_case.value; });
+	joinKnowledge(caseEnds, hasDefault);
 	clearValues(assignedVariables);
 }
 
@@ -230,6 +249,14 @@ std::optional<YulString> DataFlowAnalyzer::storageValue(YulString _key) const
 		return std::nullopt;
 }
 
+std::optional<YulString> DataFlowAnalyzer::transientStorageValue(YulString _key) const
+{
+	if (YulString const* value = valueOrNullptr(m_state.environment.transientStorage, _key))
+		return *value;
+	else
+		return std::nullopt;
+}
+
 std::optional<YulString> DataFlowAnalyzer::memoryValue(YulString _key) const
 {
 	if (YulString const* value = valueOrNullptr(m_state.environment.memory, _key))
@@ -246,6 +273,14 @@ std::optional<YulString> DataFlowAnalyzer::keccakValue(YulString _start, YulStri
 		return std::nullopt;
 }
 
+std::optional<YulString> DataFlowAnalyzer::keccakValueOfContents(YulString _start, YulString _length) const
+{
+	if (auto contents = memoryContents(_start, _length))
+		if (YulString const* value = valueOrNullptr(m_state.environment.keccakOfContents, *contents))
+			return *value;
+	return std::nullopt;
+}
+
 void DataFlowAnalyzer::handleAssignment(std::set<YulString> const& _variables, Expression* _value, bool _isDeclaration)
 {
 	if (!_isDeclaration)
@@ -274,16 +309,23 @@ void DataFlowAnalyzer::handleAssignment(std::set<YulString> const& _variables, E
 		if (!_isDeclaration)
 		{
 			// assignment to slot denoted by "name"
-			m_state.environment.storage.erase(name);
+			eraseKnowledge(m_state.environment.storage, &EnvironmentChanges::storage, name);
 			// assignment to slot contents denoted by "name"
-			cxx20::erase_if(m_state.environment.storage, mapTuple([&name](auto&& /* key */, auto&& value) { return value == name; }));
+			eraseKnowledgeIf(m_state.environment.storage, &EnvironmentChanges::storage, mapTuple([&name](auto&& /* key */, auto&& value) { return value == name; }));
+			// assignment to transient slot denoted by "name"
+			eraseKnowledge(m_state.environment.transientStorage, &EnvironmentChanges::transientStorage, name);
+			// assignment to transient slot contents denoted by "name"
+			eraseKnowledgeIf(m_state.environment.transientStorage, &EnvironmentChanges::transientStorage, mapTuple([&name](auto&& /* key */, auto&& value) { return value == name; }));
 			// assignment to slot denoted by "name"
-			m_state.environment.memory.erase(name);
+			eraseKnowledge(m_state.environment.memory, &EnvironmentChanges::memory, name);
 			// assignment to slot contents denoted by "name"
-			cxx20::erase_if(m_state.environment.keccak, [&name](auto&& _item) {
+			eraseKnowledgeIf(m_state.environment.keccak, &EnvironmentChanges::keccak, [&name](auto&& _item) {
 				return _item.first.first == name || _item.first.second == name || _item.second == name;
 			});
-			cxx20::erase_if(m_state.environment.memory, mapTuple([&name](auto&& /* key */, auto&& value) { return value == name; }));
+			eraseKnowledgeIf(m_state.environment.keccakOfContents, &EnvironmentChanges::keccakOfContents, [&name](auto&& _item) {
+				return util::contains(_item.first.second, name) || _item.second == name;
+			});
+			eraseKnowledgeIf(m_state.environment.memory, &EnvironmentChanges::memory, mapTuple([&name](auto&& /* key */, auto&& value) { return value == name; }));
 		}
 	}
 
@@ -296,11 +338,17 @@ void DataFlowAnalyzer::handleAssignment(std::set<YulString> const& _variables, E
 			// On the other hand, if we knew the value in the slot
 			// already, then the sload() / mload() would have been replaced by a variable anyway.
 			if (auto key = isSimpleLoad(StoreLoadLocation::Memory, *_value))
-				m_state.environment.memory[*key] = variable;
+				writeKnowledge(m_state.environment.memory, &EnvironmentChanges::memory, *key, variable);
 			else if (auto key = isSimpleLoad(StoreLoadLocation::Storage, *_value))
-				m_state.environment.storage[*key] = variable;
+				writeKnowledge(m_state.environment.storage, &EnvironmentChanges::storage, *key, variable);
+			else if (auto key = isSimpleLoad(StoreLoadLocation::TransientStorage, *_value))
+				writeKnowledge(m_state.environment.transientStorage, &EnvironmentChanges::transientStorage, *key, variable);
 			else if (auto arguments = isKeccak(*_value))
-				m_state.environment.keccak[*arguments] = variable;
+			{
+				writeKnowledge(m_state.environment.keccak, &EnvironmentChanges::keccak, *arguments, variable);
+				if (auto contents = memoryContents(arguments->first, arguments->second))
+					writeKnowledge(m_state.environment.keccakOfContents, &EnvironmentChanges::keccakOfContents, *contents, variable);
+			}
 		}
 	}
 }
@@ -341,14 +389,20 @@ void DataFlowAnalyzer::clearValues(std::set<YulString> _variables)
 	auto eraseCondition = mapTuple([&_variables](auto&& key, auto&& value) {
 		return _variables.count(key) || _variables.count(value);
 	});
-	cxx20::erase_if(m_state.environment.storage, eraseCondition);
-	cxx20::erase_if(m_state.environment.memory, eraseCondition);
-	cxx20::erase_if(m_state.environment.keccak, [&_variables](auto&& _item) {
+	eraseKnowledgeIf(m_state.environment.storage, &EnvironmentChanges::storage, eraseCondition);
+	eraseKnowledgeIf(m_state.environment.transientStorage, &EnvironmentChanges::transientStorage, eraseCondition);
+	eraseKnowledgeIf(m_state.environment.memory, &EnvironmentChanges::memory, eraseCondition);
+	eraseKnowledgeIf(m_state.environment.keccak, &EnvironmentChanges::keccak, [&_variables](auto&& _item) {
 		return
 			_variables.count(_item.first.first) ||
 			_variables.count(_item.first.second) ||
 			_variables.count(_item.second);
 	});
+	eraseKnowledgeIf(m_state.environment.keccakOfContents, &EnvironmentChanges::keccakOfContents, [&_variables](auto&& _item) {
+		return
+			ranges::any_of(_item.first.second, [&](YulString _word) { return _variables.count(_word); }) ||
+			_variables.count(_item.second);
+	});
 
 	// Also clear variables that reference variables to be cleared.
 	std::set<YulString> referencingVariables;
@@ -376,11 +430,13 @@ void DataFlowAnalyzer::clearKnowledgeIfInvalidated(Block const& _block)
 		return;
 	SideEffectsCollector sideEffects(m_dialect, _block, &m_functionSideEffects);
 	if (sideEffects.invalidatesStorage())
-		m_state.environment.storage.clear();
+		clearStorageKnowledge(StorageAccessPropagator::writtenSlots(m_dialect, _block, m_functionStorageWrites));
+	if (sideEffects.invalidatesTransientStorage())
+		clearKnowledge(m_state.environment.transientStorage, &EnvironmentChanges::transientStorage);
 	if (sideEffects.invalidatesMemory())
 	{
-		m_state.environment.memory.clear();
-		m_state.environment.keccak.clear();
+		clearKnowledge(m_state.environment.memory, &EnvironmentChanges::memory);
+		clearKnowledge(m_state.environment.keccak, &EnvironmentChanges::keccak);
 	}
 }
 
@@ -390,14 +446,36 @@ void DataFlowAnalyzer::clearKnowledgeIfInvalidated(Expression const& _expr)
 		return;
 	SideEffectsCollector sideEffects(m_dialect, _expr, &m_functionSideEffects);
 	if (sideEffects.invalidatesStorage())
-		m_state.environment.storage.clear();
+		clearStorageKnowledge(StorageAccessPropagator::writtenSlots(
+			m_dialect,
+			_expr,
+			m_functionStorageWrites,
+			[this](YulString _variable) { return m_knowledgeBase.valueIfKnownConstant(_variable); }
+		));
+	if (sideEffects.invalidatesTransientStorage())
+		clearKnowledge(m_state.environment.transientStorage, &EnvironmentChanges::transientStorage);
 	if (sideEffects.invalidatesMemory())
 	{
-		m_state.environment.memory.clear();
-		m_state.environment.keccak.clear();
+		clearKnowledge(m_state.environment.memory, &EnvironmentChanges::memory);
+		clearKnowledge(m_state.environment.keccak, &EnvironmentChanges::keccak);
 	}
 }
 
+void DataFlowAnalyzer::clearStorageKnowledge(std::optional<std::set<u256>> const& _writtenSlots)
+{
+	if (!_writtenSlots)
+	{
+		clearKnowledge(m_state.environment.storage, &EnvironmentChanges::storage);
+		return;
+	}
+	if (_writtenSlots->empty())
+		return;
+	eraseKnowledgeIf(m_state.environment.storage, &EnvironmentChanges::storage, mapTuple([&](auto&& key, auto&& /* value */) {
+		std::optional<u256> slot = m_knowledgeBase.valueIfKnownConstant(key);
+		return !slot || _writtenSlots->count(*slot);
+	}));
+}
+
 bool DataFlowAnalyzer::inScope(YulString _variableName) const
 {
 	for (auto const& scope: m_variableScopes | ranges::views::reverse)
@@ -453,29 +531,196 @@ std::optional<std::pair<YulString, YulString>> DataFlowAnalyzer::isKeccak(Expres
 	return std::nullopt;
 }
 
-void DataFlowAnalyzer::joinKnowledge(Environment const& _olderEnvironment)
+std::optional<std::pair<u256, std::vector<YulString>>> DataFlowAnalyzer::memoryContents(
+	YulString _start,
+	YulString _length
+) const
+{
+	std::optional<u256> start = valueOfIdentifier(_start);
+	std::optional<u256> length = valueOfIdentifier(_length);
+	if (!start || !length || *length == 0 || *length % 32 != 0)
+		return std::nullopt;
+	// Every word has to be a separate entry of the memory knowledge.
+	if (*length / 32 > m_state.environment.memory.size() || *start > std::numeric_limits<u256>::max() - *length)
+		return std::nullopt;
+
+	std::vector<YulString> words;
+	for (u256 offset = *start; offset < *start + *length; offset += 32)
+	{
+		auto word = ranges::find_if(m_state.environment.memory, [&](auto const& _entry) {
+			return valueOfIdentifier(_entry.first) == offset;
+		});
+		if (word == m_state.environment.memory.end())
+			return std::nullopt;
+		words.emplace_back(word->second);
+	}
+	return std::make_pair(*start, std::move(words));
+}
+
+void DataFlowAnalyzer::beginBranch()
 {
 	if (!m_analyzeStores)
 		return;
-	joinKnowledgeHelper(m_state.environment.storage, _olderEnvironment.storage);
-	joinKnowledgeHelper(m_state.environment.memory, _olderEnvironment.memory);
-	cxx20::erase_if(m_state.environment.keccak, mapTuple([&_olderEnvironment](auto&& key, auto&& currentValue) {
-		YulString const* oldValue = valueOrNullptr(_olderEnvironment.keccak, key);
-		return !oldValue || *oldValue != currentValue;
-	}));
+	m_state.branchChanges.emplace_back();
+}
+
+DataFlowAnalyzer::EnvironmentChanges DataFlowAnalyzer::endBranch()
+{
+	if (!m_analyzeStores)
+		return {};
+	yulAssert(!m_state.branchChanges.empty());
+	EnvironmentChanges branchChanges = std::move(m_state.branchChanges.back());
+	m_state.branchChanges.pop_back();
+
+	// The changes in the branch are also changes in the enclosing branch. Keys it changed
+	// before keep the value they had at its start.
+	if (!m_state.branchChanges.empty())
+	{
+		EnvironmentChanges& outerChanges = m_state.branchChanges.back();
+		for (auto const& [key, value]: branchChanges.storage)
+			outerChanges.storage.try_emplace(key, value);
+		for (auto const& [key, value]: branchChanges.transientStorage)
+			outerChanges.transientStorage.try_emplace(key, value);
+		for (auto const& [key, value]: branchChanges.memory)
+			outerChanges.memory.try_emplace(key, value);
+		for (auto const& [key, value]: branchChanges.keccak)
+			outerChanges.keccak.try_emplace(key, value);
+		for (auto const& [key, value]: branchChanges.keccakOfContents)
+			outerChanges.keccakOfContents.try_emplace(key, value);
+	}
+
+	EnvironmentChanges branchEnd;
+	branchEnd.storage = restoreKnowledge(m_state.environment.storage, branchChanges.storage);
+	branchEnd.transientStorage = restoreKnowledge(m_state.environment.transientStorage, branchChanges.transientStorage);
+	branchEnd.memory = restoreKnowledge(m_state.environment.memory, branchChanges.memory);
+	branchEnd.keccak = restoreKnowledge(m_state.environment.keccak, branchChanges.keccak);
+	branchEnd.keccakOfContents = restoreKnowledge(m_state.environment.keccakOfContents, branchChanges.keccakOfContents);
+	return branchEnd;
+}
+
+void DataFlowAnalyzer::joinKnowledge(std::vector<EnvironmentChanges> const& _branchEnds, bool _exhaustive)
+{
+	if (!m_analyzeStores)
+		return;
+	yulAssert(!_exhaustive || !_branchEnds.empty());
+	joinKnowledgeHelper(m_state.environment.storage, &EnvironmentChanges::storage, _branchEnds, _exhaustive);
+	joinKnowledgeHelper(m_state.environment.transientStorage, &EnvironmentChanges::transientStorage, _branchEnds, _exhaustive);
+	joinKnowledgeHelper(m_state.environment.memory, &EnvironmentChanges::memory, _branchEnds, _exhaustive);
+	joinKnowledgeHelper(m_state.environment.keccak, &EnvironmentChanges::keccak, _branchEnds, _exhaustive);
+	joinKnowledgeHelper(m_state.environment.keccakOfContents, &EnvironmentChanges::keccakOfContents, _branchEnds, _exhaustive);
+}
+
+template <typename Data, typename Changes>
+void DataFlowAnalyzer::writeKnowledge(
+	Data& _data,
+	Changes EnvironmentChanges::* _changes,
+	typename Data::key_type const& _key,
+	YulString _value
+)
+{
+	auto it = _data.find(_key);
+	if (!m_state.branchChanges.empty())
+		(m_state.branchChanges.back().*_changes).try_emplace(
+			_key,
+			it != _data.end() ? std::make_optional(it->second) : std::nullopt
+		);
+	if (it != _data.end())
+		it->second = _value;
+	else
+		_data.emplace(_key, _value);
 }
 
+template <typename Data, typename Changes>
+void DataFlowAnalyzer::eraseKnowledge(Data& _data, Changes EnvironmentChanges::* _changes, typename Data::key_type const& _key)
+{
+	auto it = _data.find(_key);
+	if (it == _data.end())
+		return;
+	if (!m_state.branchChanges.empty())
+		(m_state.branchChanges.back().*_changes).try_emplace(it->first, it->second);
+	_data.erase(it);
+}
+
+template <typename Data, typename Changes>
+void DataFlowAnalyzer::clearKnowledge(Data& _data, Changes EnvironmentChanges::* _changes)
+{
+	if (!m_state.branchChanges.empty())
+		for (auto const& [key, value]: _data)
+			(m_state.branchChanges.back().*_changes).try_emplace(key, value);
+	_data.clear();
+}
+
+template <typename Data, typename Changes, typename Predicate>
+void DataFlowAnalyzer::eraseKnowledgeIf(Data& _data, Changes EnvironmentChanges::* _changes, Predicate _predicate)
+{
+	Changes* changes = m_state.branchChanges.empty() ? nullptr : &(m_state.branchChanges.back().*_changes);
+	for (auto it = _data.begin(); it != _data.end();)
+		if (_predicate(*it))
+		{
+			if (changes)
+				changes->try_emplace(it->first, it->second);
+			it = _data.erase(it);
+		}
+		else
+			++it;
+}
+
+template <typename Data, typename Changes>
+Changes DataFlowAnalyzer::restoreKnowledge(Data& _data, Changes const& _branchChanges)
+{
+	Changes branchEnd;
+	for (auto const& [key, startValue]: _branchChanges)
+	{
+		auto it = _data.find(key);
+		branchEnd.emplace(key, it != _data.end() ? std::make_optional(it->second) : std::nullopt);
+		if (startValue)
+			_data[key] = *startValue;
+		else if (it != _data.end())
+			_data.erase(it);
+	}
+	return branchEnd;
+}
+
+template <typename Data, typename Changes>
 void DataFlowAnalyzer::joinKnowledgeHelper(
-	std::unordered_map<YulString, YulString>& _this,
-	std::unordered_map<YulString, YulString> const& _older
+	Data& _data,
+	Changes EnvironmentChanges::* _changes,
+	std::vector<EnvironmentChanges> const& _branchEnds,
+	bool _exhaustive
 )
 {
-	// We clear if the key does not exist in the older map or if the value is different.
-	// This also works for memory because _older is an "older version"
-	// of m_state.environment.memory and thus any overlapping write would have cleared the keys
-	// that are not known to be different inside m_state.environment.memory already.
-	cxx20::erase_if(_this, mapTuple([&_older](auto&& key, auto&& currentValue){
-		YulString const* oldValue = valueOrNullptr(_older, key);
-		return !oldValue || *oldValue != currentValue;
-	}));
+	// Only the keys changed in one of the branches can have a different value after the join.
+	// A key keeps a value if it has that value at the end of every branch and, unless the
+	// branches are exhaustive, also at their start.
+	// This also works for memory because every entry at the end of a branch is valid there,
+	// overlapping writes in the branch would have removed it.
+	std::set<typename Data::key_type> changedKeys;
+	for (EnvironmentChanges const& branchEnd: _branchEnds)
+		for (auto const& [key, value]: branchEnd.*_changes)
+			changedKeys.insert(key);
+
+	for (auto const& key: changedKeys)
+	{
+		auto it = _data.find(key);
+		std::optional<YulString> startValue = it != _data.end() ? std::make_optional(it->second) : std::nullopt;
+		auto valueAtEnd = [&](EnvironmentChanges const& _branchEnd) {
+			std::optional<YulString> const* value = util::valueOrNullptr(_branchEnd.*_changes, key);
+			return value ? *value : startValue;
+		};
+
+		std::optional<YulString> joinedValue = _exhaustive ? valueAtEnd(_branchEnds.front()) : startValue;
+		for (EnvironmentChanges const& branchEnd: _branchEnds)
+			if (valueAtEnd(branchEnd) != joinedValue)
+			{
+				joinedValue.reset();
+				break;
+			}
+
+		if (joinedValue == startValue)
+			continue;
+		else if (joinedValue)
+			writeKnowledge(_data, _changes, key, *joinedValue);
+		else
+			eraseKnowledge(_data, _changes, key);
+	}
 }
@@ -33,7 +33,9 @@
 #include <libsolutil/Common.h>
 
 #include <map>
+#include <optional>
 #include <set>
+#include <vector>
 
 namespace solidity::yul
 {
@@ -56,21 +58,26 @@ struct AssignedValue
  *
  * A special zero constant expression is used for the default value of variables.
  *
- * The class also tracks contents in storage and memory. Both keys and values
+ * The class also tracks contents in storage, transient storage and memory. Both keys and values
  * are names of variables. Whenever such a variable is re-assigned, the knowledge
  * is cleared.
  *
- * For elementary statements, we check if it is an SSTORE(x, y) / MSTORE(x, y)
+ * For elementary statements, we check if it is an SSTORE(x, y) / TSTORE(x, y) / MSTORE(x, y)
  * If yes, visit the statement. Then record that fact and clear all storage slots t
  *   where we cannot prove x != t or y == m_storage[t] using the current values of the variables x and t.
  * Otherwise, determine if the statement invalidates storage/memory. If yes, clear all knowledge
  * about storage/memory before visiting the statement. Then visit the statement.
+ * If all writes to storage in the statement are to known constant slots, also inside the
+ * called functions, only the knowledge about slots not known to be different is cleared.
  *
  * For forward-joining control flow, storage/memory information from the branches is combined.
  * If the keys or values are different or non-existent in one branch, the key is deleted.
  * This works also for memory (where addresses overlap) because one branch is always an
  * older version of the other and thus overlapping contents would have been deleted already
  * at the point of assignment.
+ * The cases of a switch are all analyzed starting from the state before the switch.
+ * If the switch has a default case, values all cases agree on are kept, even if they
+ * were not known before the switch.
  *
  * The DataFlowAnalyzer currently does not deal with the ``leave`` statement. This is because
  * it only matters at the end of a function body, which is a point in the code a derived class
@@ -86,10 +93,15 @@ public:
 	///            Side-effects of user-defined functions. Worst-case side-effects are assumed
 	///            if this is not provided or the function is not found.
 	///            The parameter is mostly used to determine movability of expressions.
+	/// @param _functionStorageWrites
+	///            Storage slots written to by user-defined functions, as determined by the
+	///            StorageAccessPropagator. Calls to functions that are not found clear all
+	///            knowledge about storage if they write to storage.
 	explicit DataFlowAnalyzer(
 		Dialect const& _dialect,
 		MemoryAndStorage _analyzeStores,
-		std::map<YulString, SideEffects> _functionSideEffects = {}
+		std::map<YulString, SideEffects> _functionSideEffects = {},
+		std::map<YulString, std::set<u256>> _functionStorageWrites = {}
 	);
 
 	using ASTModifier::operator();
@@ -107,8 +119,13 @@ public:
 	std::set<YulString> const* references(YulString _variable) const { return util::valueOrNullptr(m_state.references, _variable); }
 	std::map<YulString, AssignedValue> const& allValues() const { return m_state.value; }
 	std::optional<YulString> storageValue(YulString _key) const;
+	std::optional<YulString> transientStorageValue(YulString _key) const;
 	std::optional<YulString> memoryValue(YulString _key) const;
 	std::optional<YulString> keccakValue(YulString _start, YulString _length) const;
+	/// @returns a variable that holds keccak256(_start, _length), if the hash of the current
+	/// contents of that memory area has been computed before. Only works for constant areas
+	/// whose words are all known.
+	std::optional<YulString> keccakValueOfContents(YulString _start, YulString _length) const;
 
 protected:
 	/// Registers the assignment.
@@ -141,17 +158,18 @@ protected:
 	enum class StoreLoadLocation {
 		Memory = 0,
 		Storage = 1,
-		Last = Storage
+		TransientStorage = 2,
+		Last = TransientStorage
 	};
 
-	/// Checks if the statement is sstore(a, b) / mstore(a, b)
+	/// Checks if the statement is sstore(a, b) / tstore(a, b) / mstore(a, b)
 	/// where a and b are variables and returns these variables in that case.
 	std::optional<std::pair<YulString, YulString>> isSimpleStore(
 		StoreLoadLocation _location,
 		ExpressionStatement const& _statement
 	) const;
 
-	/// Checks if the expression is sload(a) / mload(a)
+	/// Checks if the expression is sload(a) / tload(a) / mload(a)
 	/// where a is a variable and returns the variable in that case.
 	std::optional<YulString> isSimpleLoad(
 		StoreLoadLocation _location,
@@ -162,19 +180,44 @@ protected:
 	/// where s and l are variables and returns these variables in that case.
 	std::optional<std::pair<YulString, YulString>> isKeccak(Expression const& _expression) const;
 
+	/// @returns the constant start of the memory area [_start, _start + _length) together
+	/// with the variables that hold its words, if both @a _start and @a _length are known
+	/// constants, @a _length is a multiple of 32 and the contents of all the words are known.
+	std::optional<std::pair<u256, std::vector<YulString>>> memoryContents(YulString _start, YulString _length) const;
+
 	Dialect const& m_dialect;
 	/// Side-effects of user-defined functions. Worst-case side-effects are assumed
 	/// if this is not provided or the function is not found.
 	std::map<YulString, SideEffects> m_functionSideEffects;
+	/// Storage slots written to by user-defined functions, if known.
+	std::map<YulString, std::set<u256>> m_functionStorageWrites;
 
 private:
 	struct Environment
 	{
 		std::unordered_map<YulString, YulString> storage;
+		std::unordered_map<YulString, YulString> transientStorage;
 		std::unordered_map<YulString, YulString> memory;
 		/// If keccak[s, l] = y then y := keccak256(s, l) occurs in the code.
 		std::map<std::pair<YulString, YulString>, YulString> keccak;
+		/// If keccakOfContents[s, [w_0, ..., w_n]] = y then y := keccak256(s, 32 * (n + 1))
+		/// occurs in the code at a point where the words of memory starting at the constant
+		/// offset s were w_0, ..., w_n. Unlike @a keccak, this stays valid when memory is
+		/// modified, because it only depends on the values of the variables.
+		std::map<std::pair<u256, std::vector<YulString>>, YulString> keccakOfContents;
 	};
+
+	/// Keys of the environment written to or removed since the start of a branch, together
+	/// with their values at the start of the branch.
+	struct EnvironmentChanges
+	{
+		std::unordered_map<YulString, std::optional<YulString>> storage;
+		std::unordered_map<YulString, std::optional<YulString>> transientStorage;
+		std::unordered_map<YulString, std::optional<YulString>> memory;
+		std::map<std::pair<YulString, YulString>, std::optional<YulString>> keccak;
+		std::map<std::pair<u256, std::vector<YulString>>, std::optional<YulString>> keccakOfContents;
+	};
+
 	struct State
 	{
 		/// Current values of variables, always movable.
@@ -183,17 +226,67 @@ private:
 		std::unordered_map<YulString, std::set<YulString>> references;
 
 		Environment environment;
+		/// Changes of the environment in each of the branches currently visited, innermost last.
+		std::vector<EnvironmentChanges> branchChanges;
 	};
 
-	/// Joins knowledge about storage and memory with an older point in the control-flow.
-	/// This only works if the current state is a direct successor of the older point,
-	/// i.e. `_olderState.storage` and `_olderState.memory` cannot have additional changes.
+	/// Starts recording the changes of the environment for a later call to @a joinKnowledge.
 	/// Does nothing if memory and storage analysis is disabled / ignored.
-	void joinKnowledge(Environment const& _olderEnvironment);
+	void beginBranch();
+
+	/// Ends the innermost branch, i.e. the one started by the matching call to @a beginBranch,
+	/// and restores the knowledge about storage and memory to the state at its start.
+	/// @returns the values at the end of the branch of all entries changed in the branch.
+	/// Does nothing if memory and storage analysis is disabled / ignored.
+	EnvironmentChanges endBranch();
+
+	/// Joins knowledge about storage and memory at the start of some branches with their ends
+	/// as returned by @a endBranch. If @a _exhaustive is false, control can also flow past the branches.
+	/// Only the entries changed in the branches have to be compared, which keeps the join
+	/// independent of the size of the environment.
+	/// Does nothing if memory and storage analysis is disabled / ignored.
+	void joinKnowledge(std::vector<EnvironmentChanges> const& _branchEnds, bool _exhaustive);
+
+	/// Sets @a _key to @a _value in the given part of the environment and records the change
+	/// in the innermost branch.
+	template <typename Data, typename Changes>
+	void writeKnowledge(
+		Data& _data,
+		Changes EnvironmentChanges::* _changes,
+		typename Data::key_type const& _key,
+		YulString _value
+	);
 
-	static void joinKnowledgeHelper(
-		std::unordered_map<YulString, YulString>& _thisData,
-		std::unordered_map<YulString, YulString> const& _olderData
+	/// Removes @a _key from the given part of the environment and records the change
+	/// in the innermost branch.
+	template <typename Data, typename Changes>
+	void eraseKnowledge(Data& _data, Changes EnvironmentChanges::* _changes, typename Data::key_type const& _key);
+
+	/// Removes the entries of the given part of the environment that satisfy @a _predicate
+	/// and records the changes in the innermost branch.
+	template <typename Data, typename Changes, typename Predicate>
+	void eraseKnowledgeIf(Data& _data, Changes EnvironmentChanges::* _changes, Predicate _predicate);
+
+	/// Removes all entries of the given part of the environment and records the changes
+	/// in the innermost branch.
+	template <typename Data, typename Changes>
+	void clearKnowledge(Data& _data, Changes EnvironmentChanges::* _changes);
+
+	/// Clears the knowledge about the storage slots that are not known to be different
+	/// from @a _writtenSlots or all knowledge about storage if they are not known.
+	void clearStorageKnowledge(std::optional<std::set<u256>> const& _writtenSlots);
+
+	/// Restores the given part of the environment to the values before the changes of a branch.
+	/// @returns the values the changed keys had.
+	template <typename Data, typename Changes>
+	static Changes restoreKnowledge(Data& _data, Changes const& _branchChanges);
+
+	template <typename Data, typename Changes>
+	void joinKnowledgeHelper(
+		Data& _data,
+		Changes EnvironmentChanges::* _changes,
+		std::vector<EnvironmentChanges> const& _branchEnds,
+		bool _exhaustive
 	);
 
 	State m_state;
@@ -201,7 +294,7 @@ private:
 protected:
 	KnowledgeBase m_knowledgeBase;
 
-	/// If true, analyzes memory and storage content via mload/mstore and sload/sstore.
+	/// If true, analyzes memory, storage and transient storage content via mload/mstore, sload/sstore and tload/tstore.
 	bool m_analyzeStores = true;
 	YulString m_storeFunctionName[static_cast<unsigned>(StoreLoadLocation::Last) + 1];
 	YulString m_loadFunctionName[static_cast<unsigned>(StoreLoadLocation::Last) + 1];
@@ -30,37 +30,72 @@ using namespace solidity;
 using namespace solidity::yul;
 using namespace solidity::util;
 
-YulString Disambiguator::translateIdentifier(YulString _originalName)
+void Disambiguator::operator()(Identifier& _identifier)
 {
-	if (m_dialect.builtin(_originalName) || m_externallyUsedIdentifiers.count(_originalName))
-		return _originalName;
+	translateIdentifier(_identifier.name);
+}
 
-	assertThrow(!m_scopes.empty() && m_scopes.back(), OptimizerException, "");
-	Scope::Identifier const* id = m_scopes.back()->lookup(_originalName);
-	assertThrow(id, OptimizerException, "");
-	if (!m_translations.count(id))
-		m_translations[id] = m_nameDispenser.newName(_originalName);
-	return m_translations.at(id);
+void Disambiguator::operator()(FunctionCall& _funCall)
+{
+	(*this)(_funCall.functionName);
+	for (Expression& argument: _funCall.arguments)
+		visit(argument);
+}
+
+void Disambiguator::operator()(VariableDeclaration& _varDecl)
+{
+	translateVariables(_varDecl.variables);
+	if (_varDecl.value)
+		visit(*_varDecl.value);
 }
 
-void Disambiguator::enterScope(Block const& _block)
+void Disambiguator::operator()(FunctionDefinition& _function)
 {
-	enterScopeInternal(*m_info.scopes.at(&_block));
+	translateIdentifier(_function.name);
+
+	Scope& functionScope = *m_info.scopes.at(m_info.virtualBlocks.at(&_function).get());
+	enterScopeInternal(functionScope);
+	translateVariables(_function.parameters);
+	translateVariables(_function.returnVariables);
+	(*this)(_function.body);
+	leaveScopeInternal(functionScope);
+}
+
+void Disambiguator::operator()(ForLoop& _forLoop)
+{
+	// The variables declared in the pre block are visible in the whole loop.
+	Scope& preScope = *m_info.scopes.at(&_forLoop.pre);
+	enterScopeInternal(preScope);
+	ASTModifier::operator()(_forLoop);
+	leaveScopeInternal(preScope);
 }
 
-void Disambiguator::leaveScope(Block const& _block)
+void Disambiguator::operator()(Block& _block)
 {
-	leaveScopeInternal(*m_info.scopes.at(&_block));
+	Scope& scope = *m_info.scopes.at(&_block);
+	enterScopeInternal(scope);
+	ASTModifier::operator()(_block);
+	leaveScopeInternal(scope);
 }
 
-void Disambiguator::enterFunction(FunctionDefinition const& _function)
+void Disambiguator::translateIdentifier(YulString& _name)
 {
-	enterScopeInternal(*m_info.scopes.at(m_info.virtualBlocks.at(&_function).get()));
+	if (m_dialect.builtin(_name) || m_externallyUsedIdentifiers.count(_name))
+		return;
+
+	assertThrow(!m_scopes.empty() && m_scopes.back(), OptimizerException, "");
+	Scope::Identifier const* id = m_scopes.back()->lookup(_name);
+	assertThrow(id, OptimizerException, "");
+	auto [translation, inserted] = m_translations.try_emplace(id);
+	if (inserted)
+		translation->second = m_nameDispenser.newName(_name);
+	_name = translation->second;
 }
 
-void Disambiguator::leaveFunction(FunctionDefinition const& _function)
+void Disambiguator::translateVariables(std::vector<TypedName>& _variables)
 {
-	leaveScopeInternal(*m_info.scopes.at(m_info.virtualBlocks.at(&_function).get()));
+	for (TypedName& variable: _variables)
+		translateIdentifier(variable.name);
 }
 
 void Disambiguator::enterScopeInternal(Scope& _scope)
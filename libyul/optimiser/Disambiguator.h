@@ -23,20 +23,22 @@
 
 #include <libyul/ASTForward.h>
 #include <libyul/AsmAnalysisInfo.h>
-#include <libyul/optimiser/ASTCopier.h>
+#include <libyul/optimiser/ASTWalker.h>
 #include <libyul/optimiser/NameDispenser.h>
 
 #include <optional>
 #include <set>
+#include <unordered_map>
 
 namespace solidity::yul
 {
 struct Dialect;
 
 /**
- * Creates a copy of a Yul AST replacing all identifiers by unique names.
+ * Replaces all identifiers of a Yul AST by unique names in place.
+ * Has to be applied to the block @a _analysisInfo was created for.
  */
-class Disambiguator: public ASTCopier
+class Disambiguator: public ASTModifier
 {
 public:
 	explicit Disambiguator(
@@ -51,12 +53,19 @@ public:
 	{
 	}
 
+	/// The identifiers are visited in the order of their occurrence in the code,
+	/// which determines the names they get.
+	using ASTModifier::operator();
+	void operator()(Identifier& _identifier) override;
+	void operator()(FunctionCall& _funCall) override;
+	void operator()(VariableDeclaration& _varDecl) override;
+	void operator()(FunctionDefinition& _function) override;
+	void operator()(ForLoop& _forLoop) override;
+	void operator()(Block& _block) override;
+
 protected:
-	void enterScope(Block const& _block) override;
-	void leaveScope(Block const& _block) override;
-	void enterFunction(FunctionDefinition const& _function) override;
-	void leaveFunction(FunctionDefinition const& _function) override;
-	YulString translateIdentifier(YulString _name) override;
+	void translateIdentifier(YulString& _name);
+	void translateVariables(std::vector<TypedName>& _variables);
 
 	void enterScopeInternal(Scope& _scope);
 	void leaveScopeInternal(Scope& _scope);
@@ -66,7 +75,7 @@ protected:
 	std::set<YulString> const& m_externallyUsedIdentifiers;
 
 	std::vector<Scope*> m_scopes;
-	std::map<void const*, YulString> m_translations;
+	std::unordered_map<void const*, YulString> m_translations;
 	NameDispenser m_nameDispenser;
 };
 
@@ -16,7 +16,7 @@
 */
 // SPDX-License-Identifier: GPL-3.0
 /**
- * Optimisation stage that removes mstore and sstore operations if they store the same
+ * Optimisation stage that removes mstore, sstore and tstore operations if they store the same
  * value that is already known to be in that slot.
  */
 
@@ -57,6 +57,12 @@ void EqualStoreEliminator::visit(Statement& _statement)
 				if (*currentValue == vars->second)
 					m_pendingRemovals.insert(&_statement);
 		}
+		else if (auto vars = isSimpleStore(StoreLoadLocation::TransientStorage, *expression))
+		{
+			if (std::optional<YulString> currentValue = transientStorageValue(vars->first))
+				if (*currentValue == vars->second)
+					m_pendingRemovals.insert(&_statement);
+		}
 		else if (auto vars = isSimpleStore(StoreLoadLocation::Memory, *expression))
 		{
 			if (std::optional<YulString> currentValue = memoryValue(vars->first))
@@ -16,7 +16,7 @@
 */
 // SPDX-License-Identifier: GPL-3.0
 /**
- * Optimisation stage that removes mstore and sstore operations if they store the same
+ * Optimisation stage that removes mstore, sstore and tstore operations if they store the same
  * value that is already known to be in that slot.
  */
 
@@ -29,7 +29,7 @@ namespace solidity::yul
 {
 
 /**
- * Optimisation stage that removes mstore and sstore operations if they store the same
+ * Optimisation stage that removes mstore, sstore and tstore operations if they store the same
  * value that is already known to be in that slot.
  *
  * Works best if the code is in SSA form - without literal arguments.
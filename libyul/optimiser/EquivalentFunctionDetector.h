@@ -24,6 +24,10 @@
 #include <libyul/optimiser/BlockHasher.h>
 #include <libyul/ASTForward.h>
 
+#include <map>
+#include <unordered_map>
+#include <vector>
+
 namespace solidity::yul
 {
 
@@ -37,7 +41,7 @@ class EquivalentFunctionDetector: public ASTWalker
 public:
 	static std::map<YulString, FunctionDefinition const*> run(Block& _block)
 	{
-		EquivalentFunctionDetector detector{BlockHasher::run(_block)};
+		EquivalentFunctionDetector detector;
 		detector(_block);
 		return std::move(detector.m_duplicates);
 	}
@@ -46,10 +50,11 @@ public:
 	void operator()(FunctionDefinition const& _fun) override;
 
 private:
-	EquivalentFunctionDetector(std::map<Block const*, uint64_t> _blockHashes): m_blockHashes(std::move(_blockHashes)) {}
+	EquivalentFunctionDetector() = default;
 
-	std::map<Block const*, uint64_t> m_blockHashes;
-	std::map<uint64_t, std::vector<FunctionDefinition const*>> m_candidates;
+	/// Functions by their hash, which includes the signature, so that functions
+	/// in the same bucket are equal unless there is a hash collision.
+	std::unordered_map<uint64_t, std::vector<FunctionDefinition const*>> m_candidates;
 	std::map<YulString, FunctionDefinition const*> m_duplicates;
 };
 
@@ -25,6 +25,7 @@
 #include <libyul/optimiser/FunctionGrouper.h>
 #include <libyul/optimiser/NameCollector.h>
 #include <libyul/optimiser/OptimizerUtilities.h>
+#include <libyul/optimiser/OptimiserStep.h>
 #include <libyul/Exceptions.h>
 #include <libyul/AST.h>
 
@@ -39,7 +40,22 @@ using namespace solidity::yul;
 
 void ExpressionJoiner::run(OptimiserStepContext& _context, Block& _ast)
 {
-	ExpressionJoiner{_ast}(_ast);
+	std::set<YulString> changedFunctions;
+	run(_context, _ast, std::nullopt, changedFunctions);
+}
+
+void ExpressionJoiner::run(
+	OptimiserStepContext& _context,
+	Block& _ast,
+	std::optional<std::set<YulString>> const& _functions,
+	std::set<YulString>& o_changedFunctions
+)
+{
+	ExpressionJoiner joiner{_ast, _context.expressionPool};
+	if (_functions)
+		joiner.m_functionsToProcess = &*_functions;
+	joiner(_ast);
+	o_changedFunctions += joiner.m_changedFunctions;
 	FunctionGrouper::run(_context, _ast);
 }
 
@@ -49,6 +65,23 @@ void ExpressionJoiner::operator()(FunctionCall& _funCall)
 	handleArguments(_funCall.arguments);
 }
 
+void ExpressionJoiner::operator()(FunctionDefinition& _functionDefinition)
+{
+	if (m_insideFunction)
+	{
+		ASTModifier::operator()(_functionDefinition);
+		return;
+	}
+	if (m_functionsToProcess && !m_functionsToProcess->count(_functionDefinition.name))
+		return;
+
+	ScopedSaveAndRestore insideFunction(m_insideFunction, true);
+	ScopedSaveAndRestore changed(m_changed, false);
+	ASTModifier::operator()(_functionDefinition);
+	if (m_changed)
+		m_changedFunctions.insert(_functionDefinition.name);
+}
+
 void ExpressionJoiner::operator()(Block& _block)
 {
 	resetLatestStatementPointer();
@@ -59,7 +92,11 @@ void ExpressionJoiner::operator()(Block& _block)
 		m_latestStatementInBlock = i;
 	}
 
+	// Every joined variable declaration leaves an empty block behind.
+	size_t const statementCount = _block.statements.size();
 	removeEmptyBlocks(_block);
+	if (_block.statements.size() != statementCount)
+		m_changed = true;
 	resetLatestStatementPointer();
 }
 
@@ -72,6 +109,7 @@ void ExpressionJoiner::visit(Expression& _e)
 		{
 			VariableDeclaration& varDecl = std::get<VariableDeclaration>(*latestStatement());
 			_e = std::move(*varDecl.value);
+			m_expressionPool.release(std::move(varDecl.value));
 
 			// Delete the variable declaration (also get the moved-from structure back into a sane state)
 			*latestStatement() = Block();
@@ -83,7 +121,8 @@ void ExpressionJoiner::visit(Expression& _e)
 		ASTModifier::visit(_e);
 }
 
-ExpressionJoiner::ExpressionJoiner(Block& _ast)
+ExpressionJoiner::ExpressionJoiner(Block& _ast, ExpressionPool& _expressionPool):
+	m_expressionPool(_expressionPool)
 {
 	m_references = VariableReferencesCounter::countReferences(_ast);
 }
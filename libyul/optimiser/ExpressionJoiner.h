@@ -25,11 +25,14 @@
 #include <libyul/optimiser/ASTWalker.h>
 
 #include <map>
+#include <optional>
+#include <set>
 
 namespace solidity::yul
 {
 
 class NameCollector;
+class ExpressionPool;
 struct OptimiserStepContext;
 
 /**
@@ -65,7 +68,8 @@ struct OptimiserStepContext;
  * Any function call or opcode will reset this pointer. If an identifier
  * is encountered that was declared in the "latest statement", it is replaced
  * by the value of the declaration, the "latest statement" is replaced
- * by an empty block and the pointer is decremented.
+ * by an empty block and the pointer is decremented. The allocation of the
+ * value is kept in the ExpressionPool of the optimiser step context.
  * A block also resets the latest statement pointer.
  */
 class ExpressionJoiner: public ASTModifier
@@ -73,12 +77,20 @@ class ExpressionJoiner: public ASTModifier
 public:
 	static constexpr char const* name{"ExpressionJoiner"};
 	static void run(OptimiserStepContext&, Block& _ast);
+	/// Only processes the code outside of functions and the top-level functions in @a _functions.
+	static void run(
+		OptimiserStepContext&,
+		Block& _ast,
+		std::optional<std::set<YulString>> const& _functions,
+		std::set<YulString>& o_changedFunctions
+	);
 
 private:
-	explicit ExpressionJoiner(Block& _ast);
+	ExpressionJoiner(Block& _ast, ExpressionPool& _expressionPool);
 
 	void operator()(Block& _block) override;
 	void operator()(FunctionCall&) override;
+	void operator()(FunctionDefinition&) override;
 
 	using ASTModifier::visit;
 	void visit(Expression& _e) override;
@@ -94,6 +106,11 @@ private:
 	Block* m_currentBlock = nullptr;            ///< Pointer to current block holding the statement being visited.
 	size_t m_latestStatementInBlock = 0;        ///< Offset to m_currentBlock's statements of the last visited statement.
 	std::map<YulString, size_t> m_references;   ///< Holds reference counts to all variable declarations in current block.
+	std::set<YulString> const* m_functionsToProcess = nullptr; ///< If set, the top-level functions not contained in it are skipped.
+	std::set<YulString> m_changedFunctions;     ///< Names of the top-level functions that were changed.
+	bool m_insideFunction = false;
+	bool m_changed = false;                     ///< Whether the current top-level function was changed.
+	ExpressionPool& m_expressionPool;           ///< Receives the values of the removed variable declarations.
 };
 
 }
@@ -0,0 +1,49 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Free list of heap-allocated Yul expressions shared by optimiser steps.
+ */
+
+#include <libyul/optimiser/ExpressionPool.h>
+
+#include <libyul/AST.h>
+
+using namespace solidity;
+using namespace solidity::yul;
+
+ExpressionPool::ExpressionPool() = default;
+ExpressionPool::ExpressionPool(ExpressionPool&&) = default;
+ExpressionPool& ExpressionPool::operator=(ExpressionPool&&) = default;
+ExpressionPool::~ExpressionPool() = default;
+
+std::unique_ptr<Expression> ExpressionPool::create(Expression&& _expression)
+{
+	if (m_released.empty())
+		return std::make_unique<Expression>(std::move(_expression));
+
+	std::unique_ptr<Expression> expression = std::move(m_released.back());
+	m_released.pop_back();
+	*expression = std::move(_expression);
+	return expression;
+}
+
+void ExpressionPool::release(std::unique_ptr<Expression> _expression)
+{
+	if (_expression)
+		m_released.emplace_back(std::move(_expression));
+}
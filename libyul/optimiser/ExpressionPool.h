@@ -0,0 +1,59 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Free list of heap-allocated Yul expressions shared by optimiser steps.
+ */
+
+#pragma once
+
+#include <libyul/ASTForward.h>
+
+#include <memory>
+#include <vector>
+
+namespace solidity::yul
+{
+
+/**
+ * Keeps the allocations of expressions released by one optimiser step, e.g. the values of the
+ * variable declarations removed by the ExpressionJoiner, so that the steps introducing new
+ * variable declarations, e.g. the ExpressionSplitter and the SSATransform, can reuse them
+ * instead of allocating new ones every time the optimiser loop splits code again.
+ *
+ * Not thread-safe, must not be used by steps that process functions concurrently.
+ */
+class ExpressionPool
+{
+public:
+	ExpressionPool();
+	ExpressionPool(ExpressionPool&&);
+	ExpressionPool& operator=(ExpressionPool&&);
+	~ExpressionPool();
+
+	/// @returns a heap-allocated expression holding @a _expression, reusing a released
+	/// allocation if there is one.
+	std::unique_ptr<Expression> create(Expression&& _expression);
+	/// Keeps the allocation of @a _expression for reuse. Its value, which is usually
+	/// already moved from, is discarded.
+	void release(std::unique_ptr<Expression> _expression);
+
+private:
+	std::vector<std::unique_ptr<Expression>> m_released;
+};
+
+}
@@ -34,7 +34,9 @@ using namespace solidity::yul;
 
 void ExpressionSimplifier::run(OptimiserStepContext& _context, Block& _ast)
 {
-	ExpressionSimplifier{_context.dialect}(_ast);
+	processFunctionsConcurrently(_context.parallelism, _ast, [&](Block& _part) {
+		ExpressionSimplifier{_context.dialect}(_part);
+	});
 }
 
 void ExpressionSimplifier::visit(Expression& _expression)
@@ -38,7 +38,7 @@ using namespace solidity::langutil;
 void ExpressionSplitter::run(OptimiserStepContext& _context, Block& _ast)
 {
 	TypeInfo typeInfo(_context.dialect, _ast);
-	ExpressionSplitter{_context.dialect, _context.dispenser, typeInfo}(_ast);
+	ExpressionSplitter{_context.dialect, _context.dispenser, typeInfo, _context.expressionPool}(_ast);
 }
 
 void ExpressionSplitter::operator()(FunctionCall& _funCall)
@@ -104,7 +104,7 @@ void ExpressionSplitter::outlineExpression(Expression& _expr)
 	m_statementsToPrefix.emplace_back(VariableDeclaration{
 		debugData,
 		{{TypedName{debugData, var, type}}},
-		std::make_unique<Expression>(std::move(_expr))
+		m_expressionPool.create(std::move(_expr))
 	});
 	_expr = Identifier{debugData, var};
 	m_typeInfo.setVariableType(var, type);
@@ -34,6 +34,7 @@ namespace solidity::yul
 struct Dialect;
 struct OptimiserStepContext;
 class TypeInfo;
+class ExpressionPool;
 
 /**
  * Optimiser component that modifies an AST in place, turning complex
@@ -72,11 +73,13 @@ private:
 	explicit ExpressionSplitter(
 		Dialect const& _dialect,
 		NameDispenser& _nameDispenser,
-		TypeInfo& _typeInfo
+		TypeInfo& _typeInfo,
+		ExpressionPool& _expressionPool
 	):
 		m_dialect(_dialect),
 		m_nameDispenser(_nameDispenser),
-		m_typeInfo(_typeInfo)
+		m_typeInfo(_typeInfo),
+		m_expressionPool(_expressionPool)
 	{ }
 
 	/// Replaces the expression by a variable if it is a function call or functional
@@ -90,6 +93,7 @@ private:
 	Dialect const& m_dialect;
 	NameDispenser& m_nameDispenser;
 	TypeInfo& m_typeInfo;
+	ExpressionPool& m_expressionPool;
 };
 
 }
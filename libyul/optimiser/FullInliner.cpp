@@ -28,7 +28,6 @@
 #include <libyul/optimiser/Metrics.h>
 #include <libyul/optimiser/SSAValueTracker.h>
 #include <libyul/optimiser/Semantics.h>
-#include <libyul/optimiser/CallGraphGenerator.h>
 #include <libyul/backends/evm/EVMDialect.h>
 #include <libyul/Exceptions.h>
 #include <libyul/AST.h>
@@ -37,7 +36,7 @@
 #include <libsolutil/CommonData.h>
 #include <libsolutil/Visitor.h>
 
-#include <range/v3/action/remove.hpp>
+#include <range/v3/view/map.hpp>
 #include <range/v3/view/reverse.hpp>
 #include <range/v3/view/zip.hpp>
 
@@ -46,16 +45,30 @@ using namespace solidity::yul;
 
 void FullInliner::run(OptimiserStepContext& _context, Block& _ast)
 {
-	FullInliner inliner{_ast, _context.dispenser, _context.dialect};
+	FullInliner inliner{
+		_ast,
+		_context.dispenser,
+		_context.dialect,
+		_context.expectedExecutionsPerDeployment,
+		_context.executionProfile
+	};
 	inliner.run(Pass::InlineTiny);
 	inliner.run(Pass::InlineRest);
 }
 
-FullInliner::FullInliner(Block& _ast, NameDispenser& _dispenser, Dialect const& _dialect):
+FullInliner::FullInliner(
+	Block& _ast,
+	NameDispenser& _dispenser,
+	Dialect const& _dialect,
+	std::optional<size_t> _expectedExecutionsPerDeployment,
+	std::map<YulString, size_t> const& _executionProfile
+):
 	m_ast(_ast),
 	m_recursiveFunctions(CallGraphGenerator::callGraph(_ast).recursiveFunctions()),
 	m_nameDispenser(_dispenser),
-	m_dialect(_dialect)
+	m_dialect(_dialect),
+	m_expectedExecutionsPerDeployment(_expectedExecutionsPerDeployment),
+	m_executionProfile(_executionProfile)
 {
 
 	// Determine constants
@@ -79,8 +92,9 @@ FullInliner::FullInliner(Block& _ast, NameDispenser& _dispenser, Dialect const&
 		// Always inline functions that are only called once.
 		if (references[fun.name] == 1)
 			m_singleUse.emplace(fun.name);
-		updateCodeSize(fun);
 	}
+	for (auto const& [name, fun]: m_functions)
+		updateFunctionInfo(*fun);
 
 	// Check for memory guard.
 	std::vector<FunctionCall*> memoryGuardCalls = FunctionCallFinder::run(
@@ -118,7 +132,7 @@ void FullInliner::run(Pass _pass)
 	for (FunctionDefinition* fun: functions)
 	{
 		handleBlock(fun->name, fun->body);
-		updateCodeSize(*fun);
+		updateFunctionInfo(*fun);
 	}
 
 	for (auto& statement: m_ast.statements)
@@ -128,49 +142,41 @@ void FullInliner::run(Pass _pass)
 
 std::map<YulString, size_t> FullInliner::callDepths() const
 {
-	CallGraph cg = CallGraphGenerator::callGraph(m_ast);
-	cg.functionCalls.erase(""_yulstring);
-
-	// Remove calls to builtin functions.
-	for (auto& call: cg.functionCalls)
-		for (auto it = call.second.begin(); it != call.second.end();)
-			if (m_dialect.builtin(*it))
-				it = call.second.erase(it);
-			else
-				++it;
+	// Assign the depths layer by layer, starting with the functions that do not call
+	// any other function. A function is assigned the next depth as soon as all its
+	// callees have been assigned one.
+	std::map<YulString, size_t> remainingCallees;
+	std::map<YulString, std::vector<YulString>> callers;
+	std::vector<YulString> currentLayer;
+	for (auto const& [fun, callees]: m_callees)
+	{
+		remainingCallees[fun] = callees.size();
+		for (YulString callee: callees)
+			callers[callee].emplace_back(fun);
+		if (callees.empty())
+			currentLayer.emplace_back(fun);
+	}
 
 	std::map<YulString, size_t> depths;
 	size_t currentDepth = 0;
-
-	while (true)
+	while (!currentLayer.empty())
 	{
-		std::vector<YulString> removed;
-		for (auto it = cg.functionCalls.begin(); it != cg.functionCalls.end();)
+		std::vector<YulString> nextLayer;
+		for (YulString fun: currentLayer)
 		{
-			auto const& [fun, callees] = *it;
-			if (callees.empty())
-			{
-				removed.emplace_back(fun);
-				depths[fun] = currentDepth;
-				it = cg.functionCalls.erase(it);
-			}
-			else
-				++it;
+			depths[fun] = currentDepth;
+			for (YulString caller: callers[fun])
+				if (--remainingCallees.at(caller) == 0)
+					nextLayer.emplace_back(caller);
 		}
-
-		for (auto& call: cg.functionCalls)
-			for (YulString toBeRemoved: removed)
-				ranges::actions::remove(call.second, toBeRemoved);
-
+		currentLayer = std::move(nextLayer);
 		currentDepth++;
-
-		if (removed.empty())
-			break;
 	}
 
-	// Only recursive functions left here.
-	for (auto const& fun: cg.functionCalls)
-		depths[fun.first] = currentDepth;
+	// Only recursive functions and functions calling them left here.
+	for (auto const& [fun, count]: remainingCallees)
+		if (count > 0)
+			depths[fun] = currentDepth + 1;
 
 	return depths;
 }
@@ -222,6 +228,13 @@ bool FullInliner::shallInline(FunctionCall const& _funCall, YulString _callSite)
 	if (m_singleUse.count(calledFunction->name))
 		return true;
 
+	// Inlining a function that is called several times increases the code size,
+	// which does not pay off in code that is rarely executed.
+	std::optional<bool> const hotCallSite = executedMoreOftenThanExpected(_callSite);
+	if (hotCallSite == false)
+		return false;
+	size_t const sizeFactor = hotCallSite == true ? 2 : 1;
+
 	// Constant arguments might provide a means for further optimization, so they cause a bonus.
 	bool constantArg = false;
 	for (auto const& argument: _funCall.arguments)
@@ -234,7 +247,19 @@ bool FullInliner::shallInline(FunctionCall const& _funCall, YulString _callSite)
 			break;
 		}
 
-	return (size < (aggressiveInlining ? 8u : 6u) || (constantArg && size < (aggressiveInlining ? 16u : 12u)));
+	return
+		size < sizeFactor * (aggressiveInlining ? 8u : 6u) ||
+		(constantArg && size < sizeFactor * (aggressiveInlining ? 16u : 12u));
+}
+
+std::optional<bool> FullInliner::executedMoreOftenThanExpected(YulString _function) const
+{
+	if (!m_expectedExecutionsPerDeployment)
+		return std::nullopt;
+	size_t const* executions = util::valueOrNullptr(m_executionProfile, _function);
+	if (!executions || *executions == *m_expectedExecutionsPerDeployment)
+		return std::nullopt;
+	return *executions > *m_expectedExecutionsPerDeployment;
 }
 
 void FullInliner::tentativelyUpdateCodeSize(YulString _function, YulString _callSite)
@@ -242,9 +267,18 @@ void FullInliner::tentativelyUpdateCodeSize(YulString _function, YulString _call
 	m_functionSizes.at(_callSite) += m_functionSizes.at(_function);
 }
 
-void FullInliner::updateCodeSize(FunctionDefinition const& _fun)
+void FullInliner::updateFunctionInfo(FunctionDefinition const& _fun)
 {
 	m_functionSizes[_fun.name] = CodeSize::codeSize(_fun.body);
+
+	// Calls inside nested functions are attributed to the enclosing function,
+	// since only top-level functions are inlined.
+	std::set<YulString>& callees = m_callees[_fun.name];
+	callees.clear();
+	for (auto const& calls: CallGraphGenerator::callGraph(_fun.body).functionCalls | ranges::views::values)
+		for (YulString callee: calls)
+			if (m_functions.count(callee))
+				callees.insert(callee);
 }
 
 void FullInliner::handleBlock(YulString _currentFunctionName, Block& _block)
@@ -254,8 +288,7 @@ void FullInliner::handleBlock(YulString _currentFunctionName, Block& _block)
 
 bool FullInliner::recursive(FunctionDefinition const& _fun) const
 {
-	std::map<YulString, size_t> references = ReferencesCounter::countReferences(_fun);
-	return references[_fun.name] > 0;
+	return m_callees.at(_fun.name).count(_fun.name) > 0;
 }
 
 void InlineModifier::operator()(Block& _block)
@@ -298,6 +331,13 @@ std::vector<Statement> InlineModifier::performInline(Statement& _statement, Func
 	assertThrow(!!function, OptimizerException, "Attempt to inline invalid function.");
 
 	m_driver.tentativelyUpdateCodeSize(function->name, m_currentFunction);
+	// One declaration per parameter and return variable, the body and one assignment
+	// or declaration per return variable.
+	newStatements.reserve(
+		function->parameters.size() +
+		2 * function->returnVariables.size() +
+		function->body.statements.size()
+	);
 
 	// helper function to create a new variable that is supposed to model
 	// an existing variable.
@@ -30,6 +30,7 @@
 
 #include <liblangutil/SourceLocation.h>
 
+#include <map>
 #include <optional>
 #include <set>
 #include <utility>
@@ -64,6 +65,10 @@ class NameCollector;
  * code of f, with replacements: a -> f_a, b -> f_b, c -> f_c
  * let z := f_c
  *
+ * Functions with several calls are inlined more readily into functions that the execution
+ * profile expects to be executed more often than the deployed code in general, and only
+ * inlined if it does not increase the code size into functions expected to be executed less often.
+ *
  * Prerequisites: Disambiguator
  * More efficient if run after: Function Hoister, Expression Splitter
  */
@@ -93,15 +98,28 @@ public:
 private:
 	enum Pass { InlineTiny, InlineRest };
 
-	FullInliner(Block& _ast, NameDispenser& _dispenser, Dialect const& _dialect);
+	FullInliner(
+		Block& _ast,
+		NameDispenser& _dispenser,
+		Dialect const& _dialect,
+		std::optional<size_t> _expectedExecutionsPerDeployment,
+		std::map<YulString, size_t> const& _executionProfile
+	);
 	void run(Pass _pass);
 
+	/// @returns true if the execution profile expects @a _function to be executed more often than
+	/// the code in general, false if less often and nullopt if the profile does not decide it.
+	std::optional<bool> executedMoreOftenThanExpected(YulString _function) const;
+
 	/// @returns a map containing the maximum depths of a call chain starting at each
 	/// function. For recursive functions, the value is one larger than for all others.
 	std::map<YulString, size_t> callDepths() const;
 
-	void updateCodeSize(FunctionDefinition const& _fun);
+	/// Recomputes the code size and the called functions of @a _fun.
+	/// Has to be called whenever the body of the function was modified.
+	void updateFunctionInfo(FunctionDefinition const& _fun);
 	void handleBlock(YulString _currentFunctionName, Block& _block);
+	/// @returns true if @a _fun calls itself.
 	bool recursive(FunctionDefinition const& _fun) const;
 
 	Pass m_pass;
@@ -120,8 +138,14 @@ private:
 	/// Variables that are constants (used for inlining heuristic)
 	std::set<YulString> m_constants;
 	std::map<YulString, size_t> m_functionSizes;
+	/// The functions called by each function. Only the function bodies are modified
+	/// during inlining, so this is updated together with the size after each function.
+	std::map<YulString, std::set<YulString>> m_callees;
 	NameDispenser& m_nameDispenser;
 	Dialect const& m_dialect;
+	/// The value nullopt represents creation code.
+	std::optional<size_t> m_expectedExecutionsPerDeployment;
+	std::map<YulString, size_t> const& m_executionProfile;
 };
 
 /**
@@ -44,12 +44,19 @@ using namespace solidity::yul;
 void LoadResolver::run(OptimiserStepContext& _context, Block& _ast)
 {
 	bool containsMSize = MSizeFinder::containsMSize(_context.dialect, _ast);
-	LoadResolver{
-		_context.dialect,
-		SideEffectsPropagator::sideEffects(_context.dialect, CallGraphGenerator::callGraph(_ast)),
-		containsMSize,
-		_context.expectedExecutionsPerDeployment
-	}(_ast);
+	std::map<YulString, SideEffects> const functionSideEffects =
+		SideEffectsPropagator::sideEffects(_context.dialect, CallGraphGenerator::callGraph(_ast));
+	std::map<YulString, std::set<u256>> const functionStorageWrites =
+		StorageAccessPropagator::writtenSlots(_context.dialect, _ast);
+	processFunctionsConcurrently(_context.parallelism, _ast, [&](Block& _part) {
+		LoadResolver{
+			_context.dialect,
+			functionSideEffects,
+			functionStorageWrites,
+			containsMSize,
+			_context.expectedExecutionsPerDeployment
+		}(_part);
+	});
 }
 
 void LoadResolver::visit(Expression& _e)
@@ -62,17 +69,25 @@ void LoadResolver::visit(Expression& _e)
 			tryResolve(_e, StoreLoadLocation::Memory, funCall->arguments);
 		else if (funCall->functionName.name == m_loadFunctionName[static_cast<unsigned>(StoreLoadLocation::Storage)])
 			tryResolve(_e, StoreLoadLocation::Storage, funCall->arguments);
+		else if (funCall->functionName.name == m_loadFunctionName[static_cast<unsigned>(StoreLoadLocation::TransientStorage)])
+			tryResolve(_e, StoreLoadLocation::TransientStorage, funCall->arguments);
 		else if (!m_containsMSize && funCall->functionName.name == m_dialect.hashFunction({}))
 		{
 			Identifier const* start = std::get_if<Identifier>(&funCall->arguments.at(0));
 			Identifier const* length = std::get_if<Identifier>(&funCall->arguments.at(1));
 			if (start && length)
-				if (auto const& value = keccakValue(start->name, length->name))
-					if (inScope(*value))
-					{
-						_e = Identifier{debugDataOf(_e), *value};
-						return;
-					}
+			{
+				std::optional<YulString> value = keccakValue(start->name, length->name);
+				if (!value || !inScope(*value))
+					// The memory area might have been overwritten with the same contents,
+					// as it happens for repeated mapping accesses.
+					value = keccakValueOfContents(start->name, length->name);
+				if (value && inScope(*value))
+				{
+					_e = Identifier{debugDataOf(_e), *value};
+					return;
+				}
+			}
 			tryEvaluateKeccak(_e, funCall->arguments);
 		}
 	}
@@ -94,6 +109,12 @@ void LoadResolver::tryResolve(
 			if (inScope(*value))
 				_e = Identifier{debugDataOf(_e), *value};
 	}
+	else if (_location == StoreLoadLocation::TransientStorage)
+	{
+		if (auto value = transientStorageValue(key))
+			if (inScope(*value))
+				_e = Identifier{debugDataOf(_e), *value};
+	}
 	else if (!m_containsMSize && _location == StoreLoadLocation::Memory)
 		if (auto value = memoryValue(key))
 			if (inScope(*value))
@@ -29,12 +29,18 @@ namespace solidity::yul
 {
 
 /**
- * Optimisation stage that replaces expressions of type ``sload(x)`` and ``mload(x)`` by the value
- * currently stored in storage resp. memory, if known.
+ * Optimisation stage that replaces expressions of type ``sload(x)``, ``tload(x)`` and ``mload(x)`` by the value
+ * currently stored in storage, transient storage resp. memory, if known.
  *
  * Also evaluates simple ``keccak256(a, c)`` when the value at memory location `a` is known and `c`
  * is a constant `<= 32`.
  *
+ * Replaces ``keccak256(a, c)`` by a variable holding a previous hash of the same memory area,
+ * either if memory was not modified in between or if `a` and `c` are constants and all words
+ * of the area are known to contain the same values as at the time of the previous hash.
+ *
+ * Knowledge about storage survives calls to functions that only write to other constant slots.
+ *
  * Works best if the code is in SSA form.
  *
  * Prerequisite: Disambiguator, ForLoopInitRewriter.
@@ -50,10 +56,16 @@ private:
 	LoadResolver(
 		Dialect const& _dialect,
 		std::map<YulString, SideEffects> _functionSideEffects,
+		std::map<YulString, std::set<u256>> _functionStorageWrites,
 		bool _containsMSize,
 		std::optional<size_t> _expectedExecutionsPerDeployment
 	):
-		DataFlowAnalyzer(_dialect, MemoryAndStorage::Analyze, std::move(_functionSideEffects)),
+		DataFlowAnalyzer(
+			_dialect,
+			MemoryAndStorage::Analyze,
+			std::move(_functionSideEffects),
+			std::move(_functionStorageWrites)
+		),
 		m_containsMSize(_containsMSize),
 		m_expectedExecutionsPerDeployment(std::move(_expectedExecutionsPerDeployment))
 	{}
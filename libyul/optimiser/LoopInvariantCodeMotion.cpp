@@ -20,23 +20,109 @@
 
 #include <libyul/optimiser/CallGraphGenerator.h>
 #include <libyul/optimiser/NameCollector.h>
+#include <libyul/optimiser/OptimizerUtilities.h>
 #include <libyul/optimiser/Semantics.h>
 #include <libyul/optimiser/SSAValueTracker.h>
 #include <libyul/AST.h>
+#include <libevmasm/Instruction.h>
 #include <libsolutil/CommonData.h>
 
+#include <range/v3/algorithm/all_of.hpp>
+#include <range/v3/view/map.hpp>
+
 #include <utility>
 
 using namespace solidity;
 using namespace solidity::yul;
 
+namespace
+{
+
+/// Collects the locations written to by the sstore, mstore and mstore8 calls that are visited.
+class WrittenLocationCollector: public ASTWalker
+{
+public:
+	WrittenLocationCollector(
+		Dialect const& _dialect,
+		std::set<YulString> const& _ssaVariables,
+		std::map<YulString, SideEffects> const& _functionSideEffects,
+		std::optional<std::vector<Expression const*>>& o_storage,
+		std::optional<std::vector<Expression const*>>& o_memory
+	):
+		m_dialect(_dialect),
+		m_ssaVariables(_ssaVariables),
+		m_functionSideEffects(_functionSideEffects),
+		m_storage(o_storage),
+		m_memory(o_memory)
+	{}
+
+	using ASTWalker::operator();
+	void operator()(FunctionCall const& _functionCall) override
+	{
+		ASTWalker::operator()(_functionCall);
+
+		YulString functionName = _functionCall.functionName.name;
+		SideEffects sideEffects = SideEffects::worst();
+		if (BuiltinFunction const* f = m_dialect.builtin(functionName))
+			sideEffects = f->sideEffects;
+		else if (SideEffects const* functionSideEffects = util::valueOrNullptr(m_functionSideEffects, functionName))
+			sideEffects = *functionSideEffects;
+
+		std::optional<evmasm::Instruction> instruction = toEVMInstruction(m_dialect, functionName);
+		if (sideEffects.storage == SideEffects::Write)
+			record(m_storage, instruction == evmasm::Instruction::SSTORE, _functionCall);
+		if (sideEffects.memory == SideEffects::Write)
+			record(m_memory, instruction == evmasm::Instruction::MSTORE || instruction == evmasm::Instruction::MSTORE8, _functionCall);
+	}
+
+private:
+	void record(std::optional<std::vector<Expression const*>>& _locations, bool _isStore, FunctionCall const& _store)
+	{
+		if (!_locations)
+			return;
+		// The location of a store can only be related to other locations if it cannot
+		// change during the loop, i.e. if it is a literal or an SSA variable.
+		Expression const* location = _isStore ? &_store.arguments.front() : nullptr;
+		if (
+			location &&
+			(
+				std::holds_alternative<Literal>(*location) ||
+				(std::holds_alternative<Identifier>(*location) && m_ssaVariables.count(std::get<Identifier>(*location).name))
+			)
+		)
+			_locations->emplace_back(location);
+		else
+			_locations.reset();
+	}
+
+	Dialect const& m_dialect;
+	std::set<YulString> const& m_ssaVariables;
+	std::map<YulString, SideEffects> const& m_functionSideEffects;
+	std::optional<std::vector<Expression const*>>& m_storage;
+	std::optional<std::vector<Expression const*>>& m_memory;
+};
+
+}
+
 void LoopInvariantCodeMotion::run(OptimiserStepContext& _context, Block& _ast)
 {
 	std::map<YulString, SideEffects> functionSideEffects =
 		SideEffectsPropagator::sideEffects(_context.dialect, CallGraphGenerator::callGraph(_ast));
 	bool containsMSize = MSizeFinder::containsMSize(_context.dialect, _ast);
-	std::set<YulString> ssaVars = SSAValueTracker::ssaVariables(_ast);
-	LoopInvariantCodeMotion{_context.dialect, ssaVars, functionSideEffects, containsMSize}(_ast);
+	SSAValueTracker ssaValueTracker;
+	ssaValueTracker(_ast);
+	std::set<YulString> ssaVars;
+	for (auto const& [name, value]: ssaValueTracker.values())
+		ssaVars.insert(name);
+	// Only provide the values of variables that cannot change inside a loop once they are declared.
+	std::map<YulString, AssignedValue> ssaValues;
+	for (auto const& [name, value]: ssaValueTracker.values())
+		if (ranges::all_of(
+			VariableReferencesCounter::countReferences(*value) | ranges::views::keys,
+			[&](YulString _reference) { return ssaVars.count(_reference) > 0; }
+		))
+			ssaValues[name] = AssignedValue{value, 0};
+	LoopInvariantCodeMotion{_context.dialect, ssaVars, ssaValues, functionSideEffects, containsMSize}(_ast);
 }
 
 void LoopInvariantCodeMotion::operator()(Block& _block)
@@ -57,8 +143,9 @@ void LoopInvariantCodeMotion::operator()(Block& _block)
 bool LoopInvariantCodeMotion::canBePromoted(
 	VariableDeclaration const& _varDecl,
 	std::set<YulString> const& _varsDefinedInCurrentScope,
-	SideEffects const& _forLoopSideEffects
-) const
+	SideEffects const& _forLoopSideEffects,
+	WrittenLocations const& _writtenLocations
+)
 {
 	// A declaration can be promoted iff
 	// 1. Its LHS is a SSA variable
@@ -74,18 +161,76 @@ bool LoopInvariantCodeMotion::canBePromoted(
 			if (_varsDefinedInCurrentScope.count(ref.first) || !m_ssaVariables.count(ref.first))
 				return false;
 		SideEffectsCollector sideEffects{m_dialect, *_varDecl.value, &m_functionSideEffects};
-		if (!sideEffects.movableRelativeTo(_forLoopSideEffects, m_containsMSize))
+		if (
+			!sideEffects.movableRelativeTo(_forLoopSideEffects, m_containsMSize) &&
+			!loadsUnwrittenLocation(*_varDecl.value, _writtenLocations)
+		)
 			return false;
 	}
 	return true;
 }
 
+bool LoopInvariantCodeMotion::loadsUnwrittenLocation(
+	Expression const& _value,
+	WrittenLocations const& _writtenLocations
+)
+{
+	FunctionCall const* load = std::get_if<FunctionCall>(&_value);
+	if (!load || load->arguments.size() != 1)
+		return false;
+	Expression const& location = load->arguments.front();
+	if (!std::holds_alternative<Literal>(location) && !std::holds_alternative<Identifier>(location))
+		return false;
+
+	auto difference = [&](Expression const& _other) -> std::optional<u256> {
+		if (std::holds_alternative<Identifier>(location) && std::holds_alternative<Identifier>(_other))
+			return m_knowledgeBase.differenceIfKnownConstant(
+				std::get<Identifier>(location).name,
+				std::get<Identifier>(_other).name
+			);
+		std::optional<u256> value = m_knowledgeBase.valueIfKnownConstant(location);
+		std::optional<u256> otherValue = m_knowledgeBase.valueIfKnownConstant(_other);
+		if (value && otherValue)
+			return *value - *otherValue;
+		return std::nullopt;
+	};
+
+	std::optional<evmasm::Instruction> instruction = toEVMInstruction(m_dialect, load->functionName.name);
+	if (instruction == evmasm::Instruction::SLOAD && _writtenLocations.storage)
+		return ranges::all_of(*_writtenLocations.storage, [&](Expression const* _written) {
+			std::optional<u256> d = difference(*_written);
+			return d && *d != 0;
+		});
+	// A mstore8 only writes one of the 32 bytes from its location, so requiring a distance
+	// of 32 bytes is conservative for it.
+	else if (instruction == evmasm::Instruction::MLOAD && _writtenLocations.memory && !m_containsMSize)
+		return ranges::all_of(*_writtenLocations.memory, [&](Expression const* _written) {
+			std::optional<u256> d = difference(*_written);
+			return d && *d >= 32 && *d <= u256(0) - 32;
+		});
+	return false;
+}
+
+LoopInvariantCodeMotion::WrittenLocations LoopInvariantCodeMotion::writtenLocations(ForLoop const& _for) const
+{
+	WrittenLocations locations;
+	WrittenLocationCollector{
+		m_dialect,
+		m_ssaVariables,
+		m_functionSideEffects,
+		locations.storage,
+		locations.memory
+	}(_for);
+	return locations;
+}
+
 std::optional<std::vector<Statement>> LoopInvariantCodeMotion::rewriteLoop(ForLoop& _for)
 {
 	assertThrow(_for.pre.statements.empty(), OptimizerException, "");
 
 	auto forLoopSideEffects =
 		SideEffectsCollector{m_dialect, _for, &m_functionSideEffects}.sideEffects();
+	WrittenLocations const loopWrittenLocations = writtenLocations(_for);
 
 	std::vector<Statement> replacement;
 	for (Block* block: {&_for.post, &_for.body})
@@ -98,7 +243,7 @@ std::optional<std::vector<Statement>> LoopInvariantCodeMotion::rewriteLoop(ForLo
 				if (std::holds_alternative<VariableDeclaration>(_s))
 				{
 					VariableDeclaration const& varDecl = std::get<VariableDeclaration>(_s);
-					if (canBePromoted(varDecl, varsDefinedInScope, forLoopSideEffects))
+					if (canBePromoted(varDecl, varsDefinedInScope, forLoopSideEffects, loopWrittenLocations))
 					{
 						replacement.emplace_back(std::move(_s));
 						// Do not add the variables declared here to varsDefinedInScope because we are moving them.
@@ -18,6 +18,8 @@
 #pragma once
 
 #include <libyul/optimiser/ASTWalker.h>
+#include <libyul/optimiser/DataFlowAnalyzer.h>
+#include <libyul/optimiser/KnowledgeBase.h>
 #include <libyul/optimiser/Semantics.h>
 #include <libyul/optimiser/OptimiserStep.h>
 
@@ -32,6 +34,10 @@ namespace solidity::yul
  * Only statements at the top level in a loop's body or post block are considered, i.e variable
  * declarations inside conditional branches will not be moved out of the loop.
  *
+ * A single ``sload`` or ``mload`` is moved even if the loop writes to storage or memory,
+ * as long as all writes are ``sstore``, ``mstore`` or ``mstore8`` to locations that are
+ * known to be different from the one that is loaded.
+ *
  * Requirements:
  * - The Disambiguator, ForLoopInitRewriter and FunctionHoister must be run upfront.
  * - Expression splitter and SSA transform should be run upfront to obtain better result.
@@ -46,15 +52,25 @@ public:
 	void operator()(Block& _block) override;
 
 private:
+	/// Locations written by a loop. Not set if the loop writes to the data location
+	/// in a different way than via sstore, mstore or mstore8 or to an unknown location.
+	struct WrittenLocations
+	{
+		std::optional<std::vector<Expression const*>> storage = std::vector<Expression const*>{};
+		std::optional<std::vector<Expression const*>> memory = std::vector<Expression const*>{};
+	};
+
 	explicit LoopInvariantCodeMotion(
 		Dialect const& _dialect,
 		std::set<YulString> const& _ssaVariables,
+		std::map<YulString, AssignedValue> const& _ssaValues,
 		std::map<YulString, SideEffects> const& _functionSideEffects,
 		bool _containsMSize
 	):
 		m_containsMSize(_containsMSize),
 		m_dialect(_dialect),
 		m_ssaVariables(_ssaVariables),
+		m_knowledgeBase(_ssaValues),
 		m_functionSideEffects(_functionSideEffects)
 	{ }
 
@@ -62,13 +78,21 @@ private:
 	bool canBePromoted(
 		VariableDeclaration const& _varDecl,
 		std::set<YulString> const& _varsDefinedInCurrentScope,
-		SideEffects const& _forLoopSideEffects
-	) const;
+		SideEffects const& _forLoopSideEffects,
+		WrittenLocations const& _writtenLocations
+	);
+	/// @returns true if @a _value is a load from storage or memory that is not affected
+	/// by any of @a _writtenLocations.
+	bool loadsUnwrittenLocation(Expression const& _value, WrittenLocations const& _writtenLocations);
+	WrittenLocations writtenLocations(ForLoop const& _for) const;
 	std::optional<std::vector<Statement>> rewriteLoop(ForLoop& _for);
 
 	bool m_containsMSize = true;
 	Dialect const& m_dialect;
 	std::set<YulString> const& m_ssaVariables;
+	/// Knowledge about the SSA variables whose values only depend on other SSA variables
+	/// and thus do not change inside a loop that does not declare them.
+	KnowledgeBase m_knowledgeBase;
 	std::map<YulString, SideEffects> const& m_functionSideEffects;
 };
 
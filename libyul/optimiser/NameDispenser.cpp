@@ -47,13 +47,46 @@ NameDispenser::NameDispenser(Dialect const& _dialect, std::set<YulString> _usedN
 
 YulString NameDispenser::newName(YulString _nameHint)
 {
-	YulString name = _nameHint;
-	while (illegalName(name))
+	if (!illegalName(_nameHint))
+	{
+		m_usedNames.emplace(_nameHint);
+		return _nameHint;
+	}
+
+	// Names only ever become illegal until the next reset, so counter values known to result
+	// in illegal names for this hint can be skipped instead of being probed again.
+	auto& [illegalFrom, illegalTo] = m_illegalCounters.try_emplace(_nameHint, 1, 0).first->second;
+	size_t const firstProbe = m_counter + 1;
+	std::string candidate = _nameHint.str() + "_";
+	size_t const prefixLength = candidate.size();
+	YulString name;
+	while (true)
 	{
 		m_counter++;
-		name = YulString(_nameHint.str() + "_" + std::to_string(m_counter));
+		if (illegalFrom <= m_counter && m_counter <= illegalTo)
+		{
+			m_counter = illegalTo;
+			continue;
+		}
+		candidate.resize(prefixLength);
+		candidate += std::to_string(m_counter);
+		name = YulString(candidate);
+		if (!illegalName(name))
+			break;
 	}
 	m_usedNames.emplace(name);
+
+	// All counter values from the first probe up to the returned name are illegal now.
+	if (illegalFrom <= m_counter + 1 && firstProbe <= illegalTo + 1)
+	{
+		illegalFrom = std::min(illegalFrom, firstProbe);
+		illegalTo = std::max(illegalTo, m_counter);
+	}
+	else
+	{
+		illegalFrom = firstProbe;
+		illegalTo = m_counter;
+	}
 	return name;
 }
 
@@ -66,4 +99,5 @@ void NameDispenser::reset(Block const& _ast)
 {
 	m_usedNames = NameCollector(_ast).names() + m_reservedNames;
 	m_counter = 0;
+	m_illegalCounters.clear();
 }
@@ -24,6 +24,7 @@
 
 #include <libyul/YulString.h>
 
+#include <map>
 #include <set>
 
 namespace solidity::yul
@@ -65,6 +66,9 @@ private:
 	std::set<YulString> m_usedNames;
 	std::set<YulString> m_reservedNames;
 	size_t m_counter = 0;
+	/// For each name hint, a range of values of m_counter that are known to yield names
+	/// that are no longer available, so that newName does not try them again.
+	std::map<YulString, std::pair<size_t, size_t>> m_illegalCounters;
 };
 
 }
@@ -19,17 +19,20 @@
 #pragma once
 
 #include <libyul/Exceptions.h>
+#include <libyul/optimiser/ExpressionPool.h>
+#include <libyul/YulString.h>
 
+#include <map>
 #include <optional>
 #include <string>
 #include <set>
+#include <utility>
 
 namespace solidity::yul
 {
 
 struct Dialect;
 struct Block;
-class YulString;
 class NameDispenser;
 
 struct OptimiserStepContext
@@ -39,6 +42,13 @@ struct OptimiserStepContext
 	std::set<YulString> const& reservedIdentifiers;
 	/// The value nullopt represents creation code
 	std::optional<size_t> expectedExecutionsPerDeployment;
+	/// Maximum number of threads the steps that process functions independently may use.
+	size_t parallelism = 1;
+	/// Expected number of executions per deployment of individual functions, replacing
+	/// expectedExecutionsPerDeployment for them. Empty for creation code.
+	std::map<YulString, size_t> executionProfile = {};
+	/// Allocations of expressions released by steps for reuse by later steps.
+	ExpressionPool expressionPool = {};
 };
 
 
@@ -52,6 +62,18 @@ struct OptimiserStep
 	virtual ~OptimiserStep() = default;
 
 	virtual void run(OptimiserStepContext&, Block&) const = 0;
+	/// @returns true if the step can be restricted to a selection of the functions, i.e. if it
+	/// transforms each function independently of the code of the other functions.
+	virtual bool supportsFunctionSelection() const = 0;
+	/// Runs the step only on the code outside of functions and on the top-level functions
+	/// in @a _functions (all of them if nullopt) and adds the names of the functions it
+	/// changed to @a o_changedFunctions. Only valid if supportsFunctionSelection() is true.
+	virtual void run(
+		OptimiserStepContext&,
+		Block&,
+		std::optional<std::set<YulString>> const& _functions,
+		std::set<YulString>& o_changedFunctions
+	) const = 0;
 	/// @returns non-nullopt if the step cannot be run, for example because it requires
 	/// an SMT solver to be loaded, but none is available. In that case, the string
 	/// contains a human-readable reason.
@@ -73,6 +95,21 @@ private:
 	public:
 		static constexpr bool value = decltype(test<T>(0))::value;
 	};
+	template<typename T>
+	struct HasFunctionSelectingRunMethod
+	{
+	private:
+		template<typename U> static auto test(int) -> decltype(U::run(
+			std::declval<OptimiserStepContext&>(),
+			std::declval<Block&>(),
+			std::declval<std::optional<std::set<YulString>> const&>(),
+			std::declval<std::set<YulString>&>()
+		), std::true_type());
+		template<typename> static std::false_type test(...);
+
+	public:
+		static constexpr bool value = decltype(test<T>(0))::value;
+	};
 
 public:
 	OptimiserStepInstance(): OptimiserStep{Step::name} {}
@@ -80,6 +117,22 @@ public:
 	{
 		Step::run(_context, _ast);
 	}
+	bool supportsFunctionSelection() const override
+	{
+		return HasFunctionSelectingRunMethod<Step>::value;
+	}
+	void run(
+		OptimiserStepContext& _context,
+		Block& _ast,
+		std::optional<std::set<YulString>> const& _functions,
+		std::set<YulString>& o_changedFunctions
+	) const override
+	{
+		if constexpr (HasFunctionSelectingRunMethod<Step>::value)
+			Step::run(_context, _ast, _functions, o_changedFunctions);
+		else
+			yulAssert(false, "Step " + name + " does not support function selection.");
+	}
 	std::optional<std::string> invalidInCurrentEnvironment() const override
 	{
 		if constexpr (HasInvalidInCurrentEnvironmentMethod<Step>::value)
@@ -28,8 +28,13 @@
 
 #include <liblangutil/Token.h>
 #include <libsolutil/CommonData.h>
+#include <libsolutil/Parallel.h>
 
 #include <range/v3/action/remove_if.hpp>
+#include <range/v3/algorithm/count_if.hpp>
+#include <range/v3/range/conversion.hpp>
+#include <range/v3/view/transform.hpp>
+#include <range/v3/view/zip.hpp>
 
 using namespace solidity;
 using namespace solidity::langutil;
@@ -47,6 +52,49 @@ bool hasLeadingOrTrailingDot(std::string_view const _s)
 
 }
 
+void yul::processFunctionsConcurrently(size_t _jobs, Block& _ast, std::function<void(Block&)> const& _process)
+{
+	size_t const functionCount = static_cast<size_t>(ranges::count_if(
+		_ast.statements,
+		[](Statement const& _statement) { return std::holds_alternative<FunctionDefinition>(_statement); }
+	));
+	if (_jobs <= 1 || functionCount <= 1)
+	{
+		_process(_ast);
+		return;
+	}
+
+	// A few groups per thread balance the load if the functions differ in size.
+	size_t const groupCount = std::min(functionCount, 4 * _jobs);
+	std::vector<Block> parts;
+	parts.reserve(1 + groupCount);
+	for (size_t part = 0; part < 1 + groupCount; ++part)
+		parts.emplace_back(Block{_ast.debugData, {}});
+	// The part each top-level statement was moved to, in the original order.
+	std::vector<size_t> origin;
+	origin.reserve(_ast.statements.size());
+	size_t functionIndex = 0;
+	for (Statement& statement: _ast.statements)
+	{
+		size_t part = 0;
+		if (std::holds_alternative<FunctionDefinition>(statement))
+			part = 1 + (functionIndex++ * groupCount) / functionCount;
+		parts[part].statements.emplace_back(std::move(statement));
+		origin.push_back(part);
+	}
+
+	std::vector<size_t> sizes = parts | ranges::views::transform([](Block const& _part) {
+		return _part.statements.size();
+	}) | ranges::to<std::vector>;
+	util::runInParallel(_jobs, parts.size(), [&](size_t _index) { _process(parts[_index]); });
+	for (auto&& [part, size]: ranges::views::zip(parts, sizes))
+		yulAssert(part.statements.size() == size, "Top-level statements were added or removed.");
+
+	std::vector<size_t> nextStatement(parts.size(), 0);
+	for (auto&& [statement, part]: ranges::views::zip(_ast.statements, origin))
+		statement = std::move(parts[part].statements[nextStatement[part]++]);
+}
+
 void yul::removeEmptyBlocks(Block& _block)
 {
 	auto isEmptyBlock = [](Statement const& _st) -> bool {
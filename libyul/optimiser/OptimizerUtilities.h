@@ -28,6 +28,7 @@
 #include <libyul/optimiser/ASTWalker.h>
 #include <liblangutil/EVMVersion.h>
 
+#include <functional>
 #include <optional>
 
 namespace solidity::evmasm
@@ -54,6 +55,16 @@ std::optional<evmasm::Instruction> toEVMInstruction(Dialect const& _dialect, Yul
 /// It returns the default EVM version if dialect is not an EVMDialect.
 langutil::EVMVersion const evmVersionFromDialect(Dialect const& _dialect);
 
+/// Splits the top-level statements of @a _ast into parts, calls @a _process once on each part
+/// and puts the statements back in their original order. One part contains all the statements that
+/// are not function definitions, the others contain contiguous groups of top-level function
+/// definitions. Up to @a _jobs parts are processed concurrently.
+/// This is only valid if processing a function definition does not depend on any code outside of it
+/// and processing the other code does not depend on the function definitions, i.e. if @a _process
+/// has the same effect on a part as on the whole block. Any analysis of the whole block has to be
+/// performed beforehand. @a _process must not add or remove top-level statements.
+void processFunctionsConcurrently(size_t _jobs, Block& _ast, std::function<void(Block&)> const& _process);
+
 class StatementRemover: public ASTModifier
 {
 public:
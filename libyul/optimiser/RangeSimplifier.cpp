@@ -0,0 +1,510 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Optimiser component that replaces comparisons by constants based on the ranges of values.
+ */
+
+#include <libyul/optimiser/RangeSimplifier.h>
+
+#include <libyul/optimiser/NameCollector.h>
+#include <libyul/optimiser/OptimizerUtilities.h>
+#include <libyul/optimiser/Semantics.h>
+#include <libyul/AST.h>
+#include <libyul/ControlFlowSideEffectsCollector.h>
+#include <libyul/Dialect.h>
+#include <libyul/Utilities.h>
+
+#include <libevmasm/Instruction.h>
+
+#include <libsolutil/CommonData.h>
+
+#include <range/v3/algorithm/any_of.hpp>
+
+#include <algorithm>
+#include <limits>
+
+using namespace solidity;
+using namespace solidity::yul;
+using namespace solidity::util;
+
+using Instruction = evmasm::Instruction;
+
+namespace
+{
+
+/// Determines whether a loop body contains a ``break`` that exits the loop.
+class BreakFinder: public ASTWalker
+{
+public:
+	static bool containsBreak(Block const& _body)
+	{
+		BreakFinder finder;
+		finder(_body);
+		return finder.m_found;
+	}
+
+	using ASTWalker::operator();
+	void operator()(Break const&) override { m_found = true; }
+	void operator()(ForLoop const&) override {}
+	void operator()(FunctionDefinition const&) override {}
+
+private:
+	bool m_found = false;
+};
+
+/// @returns true if @a _mask is of the form ``2**k - 1``.
+bool isLowBitMask(u256 const& _mask)
+{
+	return (_mask & (_mask + 1)) == 0;
+}
+
+}
+
+void RangeSimplifier::run(OptimiserStepContext& _context, Block& _ast)
+{
+	RangeSimplifier{
+		_context.dialect,
+		ControlFlowSideEffectsCollector{_context.dialect, _ast}.functionSideEffectsNamed()
+	}(_ast);
+}
+
+void RangeSimplifier::operator()(VariableDeclaration& _varDecl)
+{
+	ASTModifier::operator()(_varDecl);
+
+	std::optional<Range> range;
+	if (_varDecl.variables.size() == 1)
+		range = _varDecl.value ? rangeOf(*_varDecl.value) : Range{0, 0};
+
+	std::set<YulString> names;
+	for (auto const& variable: _varDecl.variables)
+		names.insert(variable.name);
+	clear(names);
+
+	if (!range)
+		return;
+	YulString name = _varDecl.variables.front().name;
+	m_state.ranges[name] = *range;
+
+	if (auto const* funCall = std::get_if<FunctionCall>(_varDecl.value.get()))
+		if (std::optional<Instruction> instruction = toEVMInstruction(m_dialect, funCall->functionName.name))
+			if (
+				*instruction == Instruction::LT ||
+				*instruction == Instruction::GT ||
+				*instruction == Instruction::EQ ||
+				*instruction == Instruction::ISZERO ||
+				*instruction == Instruction::AND ||
+				*instruction == Instruction::OR
+			)
+			{
+				MovableChecker checker{m_dialect, *_varDecl.value};
+				if (checker.movable())
+					m_state.conditions[name] = {_varDecl.value.get(), checker.referencedVariables()};
+			}
+}
+
+void RangeSimplifier::operator()(Assignment& _assignment)
+{
+	ASTModifier::operator()(_assignment);
+
+	std::optional<Range> range;
+	if (_assignment.variableNames.size() == 1)
+		range = rangeOf(*_assignment.value);
+
+	std::set<YulString> names;
+	for (auto const& variable: _assignment.variableNames)
+		names.insert(variable.name);
+	clear(names);
+
+	if (range)
+		m_state.ranges[_assignment.variableNames.front().name] = *range;
+}
+
+void RangeSimplifier::operator()(If& _if)
+{
+	visit(*_if.condition);
+
+	State preState = m_state;
+	assume(*_if.condition, true);
+	(*this)(_if.body);
+	m_state = std::move(preState);
+
+	if (
+		!_if.body.statements.empty() &&
+		TerminationFinder(m_dialect, &m_functionSideEffects).controlFlowKind(_if.body.statements.back()) !=
+			TerminationFinder::ControlFlow::FlowOut
+	)
+		assume(*_if.condition, false);
+	else
+		clear(assignedVariableNames(_if.body));
+}
+
+void RangeSimplifier::operator()(Switch& _switch)
+{
+	visit(*_switch.expression);
+
+	State preState = m_state;
+	std::set<YulString> assignedInCases;
+	for (auto& _case: _switch.cases)
+	{
+		m_state = preState;
+		if (_case.value)
+			restrict(*_switch.expression, rangeOf(*_case.value));
+		(*this)(_case.body);
+		assignedInCases += assignedVariableNames(_case.body);
+	}
+	m_state = std::move(preState);
+	clear(assignedInCases);
+}
+
+void RangeSimplifier::operator()(ForLoop& _for)
+{
+	(*this)(_for.pre);
+
+	std::set<YulString> assignedInBody = assignedVariableNames(_for.body);
+	clear(assignedInBody + assignedVariableNames(_for.post));
+
+	// This state holds at every evaluation of the condition.
+	visit(*_for.condition);
+	State conditionState = m_state;
+
+	assume(*_for.condition, true);
+	(*this)(_for.body);
+
+	m_state = conditionState;
+	assume(*_for.condition, true);
+	clear(assignedInBody);
+	(*this)(_for.post);
+
+	m_state = std::move(conditionState);
+	if (!BreakFinder::containsBreak(_for.body))
+		assume(*_for.condition, false);
+}
+
+void RangeSimplifier::operator()(FunctionDefinition& _funDef)
+{
+	State outerState = std::move(m_state);
+	m_state = {};
+	for (auto const& returnVariable: _funDef.returnVariables)
+		m_state.ranges[returnVariable.name] = Range{0, 0};
+	ASTModifier::operator()(_funDef);
+	m_state = std::move(outerState);
+}
+
+void RangeSimplifier::visit(Expression& _expression)
+{
+	ASTModifier::visit(_expression);
+
+	auto* funCall = std::get_if<FunctionCall>(&_expression);
+	if (!funCall || !MovableChecker{m_dialect, _expression}.movable())
+		return;
+
+	if (std::optional<bool> value = evaluate(*funCall))
+		_expression = Literal{
+			debugDataOf(_expression),
+			LiteralKind::Number,
+			*value ? "1"_yulstring : "0"_yulstring,
+			{}
+		};
+	else if (toEVMInstruction(m_dialect, funCall->functionName.name) == Instruction::AND)
+		for (size_t maskIndex: {0u, 1u})
+			if (auto const* mask = std::get_if<Literal>(&funCall->arguments[maskIndex]))
+			{
+				u256 maskValue = valueOfLiteral(*mask);
+				Expression& value = funCall->arguments[1 - maskIndex];
+				if (isLowBitMask(maskValue) && rangeOf(value).max <= maskValue)
+				{
+					Expression replacement = std::move(value);
+					_expression = std::move(replacement);
+					return;
+				}
+			}
+}
+
+RangeSimplifier::Range RangeSimplifier::rangeOf(Expression const& _expression) const
+{
+	if (auto const* literal = std::get_if<Literal>(&_expression))
+	{
+		u256 value = valueOfLiteral(*literal);
+		return {value, value};
+	}
+	if (auto const* identifier = std::get_if<Identifier>(&_expression))
+	{
+		auto it = m_state.ranges.find(identifier->name);
+		return it == m_state.ranges.end() ? Range{} : it->second;
+	}
+
+	auto const* funCall = std::get_if<FunctionCall>(&_expression);
+	if (!funCall)
+		return {};
+	std::optional<Instruction> instruction = toEVMInstruction(m_dialect, funCall->functionName.name);
+	if (!instruction)
+		return {};
+
+	std::vector<Expression> const& arguments = funCall->arguments;
+	switch (*instruction)
+	{
+	case Instruction::LT:
+	case Instruction::GT:
+	case Instruction::SLT:
+	case Instruction::SGT:
+	case Instruction::EQ:
+	case Instruction::ISZERO:
+		return {0, 1};
+	case Instruction::BYTE:
+		return {0, 0xff};
+	case Instruction::AND:
+		return {0, std::min(rangeOf(arguments[0]).max, rangeOf(arguments[1]).max)};
+	case Instruction::MOD:
+	{
+		Range value = rangeOf(arguments[0]);
+		Range divisor = rangeOf(arguments[1]);
+		if (divisor.max == 0)
+			return {0, 0};
+		if (value.max < divisor.min)
+			return value;
+		return {0, std::min(value.max, divisor.max - 1)};
+	}
+	case Instruction::DIV:
+	{
+		Range value = rangeOf(arguments[0]);
+		Range divisor = rangeOf(arguments[1]);
+		// Division by zero results in zero.
+		if (divisor.min == 0)
+			return {0, value.max};
+		return {value.min / divisor.max, value.max / divisor.min};
+	}
+	case Instruction::SHR:
+	{
+		Range shift = rangeOf(arguments[0]);
+		Range value = rangeOf(arguments[1]);
+		auto shifted = [](u256 const& _value, u256 const& _shift) -> u256 {
+			return _shift >= 256 ? u256(0) : u256(_value >> static_cast<unsigned>(_shift));
+		};
+		return {shifted(value.min, shift.max), shifted(value.max, shift.min)};
+	}
+	case Instruction::ADD:
+	{
+		Range a = rangeOf(arguments[0]);
+		Range b = rangeOf(arguments[1]);
+		if (bigint(a.max) + b.max > std::numeric_limits<u256>::max())
+			return {};
+		return {a.min + b.min, a.max + b.max};
+	}
+	case Instruction::SUB:
+	{
+		Range a = rangeOf(arguments[0]);
+		Range b = rangeOf(arguments[1]);
+		if (a.min < b.max)
+			return {};
+		return {a.min - b.max, a.max - b.min};
+	}
+	case Instruction::MUL:
+	{
+		Range a = rangeOf(arguments[0]);
+		Range b = rangeOf(arguments[1]);
+		if (bigint(a.max) * b.max > std::numeric_limits<u256>::max())
+			return {};
+		return {a.min * b.min, a.max * b.max};
+	}
+	default:
+		return {};
+	}
+}
+
+std::optional<bool> RangeSimplifier::evaluate(FunctionCall const& _funCall) const
+{
+	std::optional<Instruction> instruction = toEVMInstruction(m_dialect, _funCall.functionName.name);
+	if (!instruction)
+		return std::nullopt;
+
+	std::vector<Expression> const& arguments = _funCall.arguments;
+	auto lessThan = [&](Expression const& _a, Expression const& _b) -> std::optional<bool> {
+		if (knownLessThan(_a, _b))
+			return true;
+		if (knownLessThan(_b, _a) || rangeOf(_b).max <= rangeOf(_a).min)
+			return false;
+		auto const* a = std::get_if<Identifier>(&_a);
+		auto const* b = std::get_if<Identifier>(&_b);
+		if (a && b && a->name == b->name)
+			return false;
+		return std::nullopt;
+	};
+
+	switch (*instruction)
+	{
+	case Instruction::LT:
+		return lessThan(arguments[0], arguments[1]);
+	case Instruction::GT:
+		return lessThan(arguments[1], arguments[0]);
+	case Instruction::EQ:
+	{
+		Range a = rangeOf(arguments[0]);
+		Range b = rangeOf(arguments[1]);
+		if (a.max < b.min || b.max < a.min || knownLessThan(arguments[0], arguments[1]) || knownLessThan(arguments[1], arguments[0]))
+			return false;
+		return std::nullopt;
+	}
+	case Instruction::ISZERO:
+	{
+		Range value = rangeOf(arguments[0]);
+		if (value.min > 0)
+			return false;
+		if (value.max == 0)
+			return true;
+		return std::nullopt;
+	}
+	default:
+		return std::nullopt;
+	}
+}
+
+bool RangeSimplifier::knownLessThan(Expression const& _a, Expression const& _b) const
+{
+	if (rangeOf(_a).max < rangeOf(_b).min)
+		return true;
+	auto const* a = std::get_if<Identifier>(&_a);
+	auto const* b = std::get_if<Identifier>(&_b);
+	return a && b && m_state.lessThan.count({a->name, b->name});
+}
+
+void RangeSimplifier::assume(Expression const& _condition, bool _value)
+{
+	if (auto const* identifier = std::get_if<Identifier>(&_condition))
+	{
+		restrict(_condition, _value ? Range{1, std::numeric_limits<u256>::max()} : Range{0, 0});
+		if (auto const* condition = valueOrNullptr(m_state.conditions, identifier->name))
+			assume(*condition->first, _value);
+		return;
+	}
+
+	auto const* funCall = std::get_if<FunctionCall>(&_condition);
+	if (!funCall)
+		return;
+	std::optional<Instruction> instruction = toEVMInstruction(m_dialect, funCall->functionName.name);
+	if (!instruction)
+		return;
+
+	std::vector<Expression> const& arguments = funCall->arguments;
+	switch (*instruction)
+	{
+	case Instruction::ISZERO:
+		assume(arguments[0], !_value);
+		break;
+	case Instruction::LT:
+		if (_value)
+			assumeLessThan(arguments[0], arguments[1]);
+		else
+			assumeLessOrEqual(arguments[1], arguments[0]);
+		break;
+	case Instruction::GT:
+		if (_value)
+			assumeLessThan(arguments[1], arguments[0]);
+		else
+			assumeLessOrEqual(arguments[0], arguments[1]);
+		break;
+	case Instruction::EQ:
+		if (_value)
+		{
+			Range a = rangeOf(arguments[0]);
+			restrict(arguments[0], rangeOf(arguments[1]));
+			restrict(arguments[1], a);
+		}
+		else
+			for (size_t valueIndex: {0u, 1u})
+				if (auto const* literal = std::get_if<Literal>(&arguments[1 - valueIndex]))
+				{
+					u256 excluded = valueOfLiteral(*literal);
+					Range range = rangeOf(arguments[valueIndex]);
+					if (range.min == excluded && range.max > excluded)
+						restrict(arguments[valueIndex], {excluded + 1, range.max});
+					else if (range.max == excluded && range.min < excluded)
+						restrict(arguments[valueIndex], {range.min, excluded - 1});
+				}
+		break;
+	case Instruction::AND:
+		// If a bitwise conjunction is nonzero, both operands are nonzero.
+		if (_value)
+		{
+			assume(arguments[0], true);
+			assume(arguments[1], true);
+		}
+		break;
+	case Instruction::OR:
+		if (!_value)
+		{
+			assume(arguments[0], false);
+			assume(arguments[1], false);
+		}
+		break;
+	default:
+		break;
+	}
+}
+
+void RangeSimplifier::assumeLessThan(Expression const& _a, Expression const& _b)
+{
+	Range a = rangeOf(_a);
+	Range b = rangeOf(_b);
+	if (b.max > 0)
+		restrict(_a, {0, b.max - 1});
+	if (a.min < std::numeric_limits<u256>::max())
+		restrict(_b, {a.min + 1, std::numeric_limits<u256>::max()});
+
+	auto const* aIdentifier = std::get_if<Identifier>(&_a);
+	auto const* bIdentifier = std::get_if<Identifier>(&_b);
+	if (aIdentifier && bIdentifier)
+		m_state.lessThan.emplace(aIdentifier->name, bIdentifier->name);
+}
+
+void RangeSimplifier::assumeLessOrEqual(Expression const& _a, Expression const& _b)
+{
+	Range a = rangeOf(_a);
+	Range b = rangeOf(_b);
+	restrict(_a, {0, b.max});
+	restrict(_b, {a.min, std::numeric_limits<u256>::max()});
+}
+
+void RangeSimplifier::restrict(Expression const& _expression, Range const& _range)
+{
+	auto const* identifier = std::get_if<Identifier>(&_expression);
+	if (!identifier)
+		return;
+	Range& range = m_state.ranges[identifier->name];
+	range.min = std::max(range.min, _range.min);
+	range.max = std::min(range.max, _range.max);
+}
+
+void RangeSimplifier::clear(std::set<YulString> const& _variables)
+{
+	for (YulString variable: _variables)
+	{
+		m_state.ranges.erase(variable);
+		m_state.conditions.erase(variable);
+	}
+	for (auto it = m_state.lessThan.begin(); it != m_state.lessThan.end();)
+		if (_variables.count(it->first) || _variables.count(it->second))
+			it = m_state.lessThan.erase(it);
+		else
+			++it;
+	for (auto it = m_state.conditions.begin(); it != m_state.conditions.end();)
+		if (ranges::any_of(it->second.second, [&](YulString _name) { return _variables.count(_name); }))
+			it = m_state.conditions.erase(it);
+		else
+			++it;
+}
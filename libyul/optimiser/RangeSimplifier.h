@@ -0,0 +1,138 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Optimiser component that replaces comparisons by constants based on the ranges of values.
+ */
+#pragma once
+
+#include <libyul/optimiser/ASTWalker.h>
+#include <libyul/optimiser/OptimiserStep.h>
+#include <libyul/ASTForward.h>
+#include <libyul/ControlFlowSideEffects.h>
+#include <libyul/YulString.h>
+#include <libsolutil/Numeric.h>
+
+#include <map>
+#include <optional>
+#include <set>
+#include <utility>
+
+namespace solidity::yul
+{
+
+struct Dialect;
+
+/**
+ * Range simplifier.
+ *
+ * Keeps track of lower and upper bounds of variables and of relations of the form
+ * ``a < b`` between variables and uses them to replace comparisons whose outcome is
+ * already determined by constants.
+ *
+ * Bounds are derived from literals, from the values of expressions like ``and(x, c)``,
+ * ``mod(x, c)``, ``shr(c, x)``, comparisons and additions that cannot overflow, and from
+ * the conditions of control-flow statements: In the body of ``if c { ... }`` and of a
+ * for loop, the condition is known to be true. After an ``if`` whose body does not flow out
+ * and after a for loop whose body does not contain ``break``, it is known to be false.
+ * Conditions can be combinations of ``lt``, ``gt``, ``eq`` with a literal, ``iszero``,
+ * ``and`` and ``or``, or variables that were declared with such a value.
+ *
+ * The following expressions are simplified, if they are movable:
+ *  - ``lt(a, b)``, ``gt(a, b)``, ``eq(a, b)`` and ``iszero(a)`` to ``0`` or ``1``
+ *  - ``and(x, 2**k - 1)`` to ``x`` if ``x`` is known to be at most ``2**k - 1``
+ *
+ * This removes repeated array bounds checks and overflow checks of loop counters
+ * that are bounded by the loop condition.
+ *
+ * Everything known about a variable is forgotten when it is assigned to. Knowledge is
+ * not propagated into function definitions.
+ *
+ * Works best with the ExpressionSplitter having been run, since then the conditions
+ * and the operands of comparisons are variables.
+ *
+ * Prerequisite: Disambiguator, ForLoopInitRewriter.
+ */
+class RangeSimplifier: public ASTModifier
+{
+public:
+	static constexpr char const* name{"RangeSimplifier"};
+	static void run(OptimiserStepContext& _context, Block& _ast);
+
+	using ASTModifier::operator();
+	void operator()(VariableDeclaration& _varDecl) override;
+	void operator()(Assignment& _assignment) override;
+	void operator()(If& _if) override;
+	void operator()(Switch& _switch) override;
+	void operator()(ForLoop& _for) override;
+	void operator()(FunctionDefinition& _funDef) override;
+
+	using ASTModifier::visit;
+	void visit(Expression& _expression) override;
+
+private:
+	/// Inclusive lower and upper bound of a value.
+	struct Range
+	{
+		u256 min = 0;
+		u256 max = u256(-1);
+	};
+
+	struct State
+	{
+		std::map<YulString, Range> ranges;
+		/// Pairs of variables ``(a, b)`` such that ``a < b``.
+		std::set<std::pair<YulString, YulString>> lessThan;
+		/// Values of variables that are combinations of comparisons, together with
+		/// the variables they reference.
+		std::map<YulString, std::pair<Expression const*, std::set<YulString>>> conditions;
+	};
+
+	explicit RangeSimplifier(
+		Dialect const& _dialect,
+		std::map<YulString, ControlFlowSideEffects> _sideEffects
+	):
+		m_dialect(_dialect), m_functionSideEffects(std::move(_sideEffects))
+	{}
+
+	/// @returns the range of values @a _expression can evaluate to.
+	Range rangeOf(Expression const& _expression) const;
+	/// @returns the value of the comparison or ``iszero`` call @a _funCall if it is
+	/// determined by the current knowledge.
+	std::optional<bool> evaluate(FunctionCall const& _funCall) const;
+	/// @returns true if ``_a < _b`` is known to hold.
+	bool knownLessThan(Expression const& _a, Expression const& _b) const;
+
+	/// Records that @a _condition evaluates to a nonzero value if @a _value is true
+	/// and to zero otherwise.
+	void assume(Expression const& _condition, bool _value);
+	/// Records that ``_a < _b`` holds.
+	void assumeLessThan(Expression const& _a, Expression const& _b);
+	/// Records that ``_a <= _b`` holds.
+	void assumeLessOrEqual(Expression const& _a, Expression const& _b);
+	/// Restricts the range of @a _expression if it is a variable.
+	void restrict(Expression const& _expression, Range const& _range);
+
+	/// Forgets everything about the given variables.
+	void clear(std::set<YulString> const& _variables);
+
+	Dialect const& m_dialect;
+	std::map<YulString, ControlFlowSideEffects> m_functionSideEffects;
+	State m_state;
+};
+
+}
@@ -24,6 +24,7 @@
 
 #include <libyul/optimiser/NameCollector.h>
 #include <libyul/optimiser/NameDispenser.h>
+#include <libyul/optimiser/VariableNumbering.h>
 #include <libyul/AST.h>
 
 #include <libsolutil/CommonData.h>
@@ -47,11 +48,13 @@ public:
 	explicit IntroduceSSA(
 		NameDispenser& _nameDispenser,
 		std::set<YulString> const& _variablesToReplace,
-		TypeInfo& _typeInfo
+		TypeInfo& _typeInfo,
+		ExpressionPool& _expressionPool
 	):
 		m_nameDispenser(_nameDispenser),
 		m_variablesToReplace(_variablesToReplace),
-		m_typeInfo(_typeInfo)
+		m_typeInfo(_typeInfo),
+		m_expressionPool(_expressionPool)
 	{ }
 
 	void operator()(Block& _block) override;
@@ -60,6 +63,7 @@ private:
 	NameDispenser& m_nameDispenser;
 	std::set<YulString> const& m_variablesToReplace;
 	TypeInfo const& m_typeInfo;
+	ExpressionPool& m_expressionPool;
 };
 
 
@@ -96,7 +100,7 @@ void IntroduceSSA::operator()(Block& _block)
 					statements.emplace_back(VariableDeclaration{
 						debugData,
 						{TypedName{debugData, oldName, var.type}},
-						std::make_unique<Expression>(Identifier{debugData, newName})
+						m_expressionPool.create(Identifier{debugData, newName})
 					});
 				}
 				std::get<VariableDeclaration>(statements.front()).variables = std::move(newVariables);
@@ -126,7 +130,7 @@ void IntroduceSSA::operator()(Block& _block)
 					statements.emplace_back(Assignment{
 						debugData,
 						{Identifier{debugData, oldName}},
-						std::make_unique<Expression>(Identifier{debugData, newName})
+						m_expressionPool.create(Identifier{debugData, newName})
 					});
 				}
 				std::get<VariableDeclaration>(statements.front()).variables = std::move(newVariables);
@@ -149,11 +153,13 @@ public:
 	explicit IntroduceControlFlowSSA(
 		NameDispenser& _nameDispenser,
 		std::set<YulString> const& _variablesToReplace,
-		TypeInfo const& _typeInfo
+		TypeInfo const& _typeInfo,
+		ExpressionPool& _expressionPool
 	):
 		m_nameDispenser(_nameDispenser),
 		m_variablesToReplace(_variablesToReplace),
-		m_typeInfo(_typeInfo)
+		m_typeInfo(_typeInfo),
+		m_expressionPool(_expressionPool)
 	{ }
 
 	void operator()(FunctionDefinition& _function) override;
@@ -169,6 +175,7 @@ private:
 	/// Variables that do not have a specific value.
 	util::UniqueVector<YulString> m_variablesToReassign;
 	TypeInfo const& m_typeInfo;
+	ExpressionPool& m_expressionPool;
 };
 
 void IntroduceControlFlowSSA::operator()(FunctionDefinition& _function)
@@ -233,7 +240,7 @@ void IntroduceControlFlowSSA::operator()(Block& _block)
 				toPrepend.emplace_back(VariableDeclaration{
 					debugDataOf(_s),
 					{TypedName{debugDataOf(_s), newName, m_typeInfo.typeOfVariable(toReassign)}},
-					std::make_unique<Expression>(Identifier{debugDataOf(_s), toReassign})
+					m_expressionPool.create(Identifier{debugDataOf(_s), toReassign})
 				});
 				assignedVariables.pushBack(toReassign);
 			}
@@ -282,7 +289,8 @@ class PropagateValues: public ASTModifier
 {
 public:
 	explicit PropagateValues(std::set<YulString> const& _variablesToReplace):
-		m_variablesToReplace(_variablesToReplace)
+		m_variablesToReplace(_variablesToReplace),
+		m_currentVariableValues(m_variablesToReplace.size())
 	{ }
 
 	void operator()(Identifier& _identifier) override;
@@ -292,17 +300,22 @@ public:
 	void operator()(Block& _block) override;
 
 private:
-	/// This is a set of all variables that are assigned to anywhere in the code.
+	void setValue(size_t _variable, YulString _value);
+
+	/// Numbering of all variables that are assigned to anywhere in the code.
 	/// Variables that are only declared but never re-assigned are not touched.
-	std::set<YulString> const& m_variablesToReplace;
-	std::map<YulString, YulString> m_currentVariableValues;
-	std::set<YulString> m_clearAtEndOfBlock;
+	VariableNumbering const m_variablesToReplace;
+	/// Current value of each variable to replace, indexed by its number.
+	/// An empty string means that the value is not known.
+	std::vector<YulString> m_currentVariableValues;
+	std::vector<size_t> m_clearAtEndOfBlock;
 };
 
 void PropagateValues::operator()(Identifier& _identifier)
 {
-	if (m_currentVariableValues.count(_identifier.name))
-		_identifier.name = m_currentVariableValues[_identifier.name];
+	if (std::optional<size_t> index = m_variablesToReplace.index(_identifier.name))
+		if (!m_currentVariableValues[*index].empty())
+			_identifier.name = m_currentVariableValues[*index];
 }
 
 void PropagateValues::operator()(VariableDeclaration& _varDecl)
@@ -313,24 +326,19 @@ void PropagateValues::operator()(VariableDeclaration& _varDecl)
 		return;
 
 	YulString variable = _varDecl.variables.front().name;
-	if (m_variablesToReplace.count(variable))
+	if (std::optional<size_t> index = m_variablesToReplace.index(variable))
 	{
 		// `let a := a_1` - regular declaration of non-SSA variable
 		yulAssert(std::holds_alternative<Identifier>(*_varDecl.value), "");
-		m_currentVariableValues[variable] = std::get<Identifier>(*_varDecl.value).name;
-		m_clearAtEndOfBlock.insert(variable);
+		setValue(*index, std::get<Identifier>(*_varDecl.value).name);
 	}
 	else if (_varDecl.value && std::holds_alternative<Identifier>(*_varDecl.value))
 	{
 		// `let a_1 := a` - assignment to SSA variable after a branch.
-		YulString value = std::get<Identifier>(*_varDecl.value).name;
-		if (m_variablesToReplace.count(value))
-		{
+		if (std::optional<size_t> valueIndex = m_variablesToReplace.index(std::get<Identifier>(*_varDecl.value).name))
 			// This is safe because `a_1` is not a "variable to replace" and thus
 			// will not be re-assigned.
-			m_currentVariableValues[value] = variable;
-			m_clearAtEndOfBlock.insert(value);
-		}
+			setValue(*valueIndex, variable);
 	}
 }
 
@@ -341,13 +349,12 @@ void PropagateValues::operator()(Assignment& _assignment)
 
 	if (_assignment.variableNames.size() != 1)
 		return;
-	YulString name = _assignment.variableNames.front().name;
-	if (!m_variablesToReplace.count(name))
+	std::optional<size_t> index = m_variablesToReplace.index(_assignment.variableNames.front().name);
+	if (!index)
 		return;
 
 	yulAssert(_assignment.value && std::holds_alternative<Identifier>(*_assignment.value), "");
-	m_currentVariableValues[name] = std::get<Identifier>(*_assignment.value).name;
-	m_clearAtEndOfBlock.insert(name);
+	setValue(*index, std::get<Identifier>(*_assignment.value).name);
 }
 
 void PropagateValues::operator()(ForLoop& _for)
@@ -355,7 +362,8 @@ void PropagateValues::operator()(ForLoop& _for)
 	yulAssert(_for.pre.statements.empty(), "For loop init rewriter not run.");
 
 	for (auto const& var: assignedVariableNames(_for.body) + assignedVariableNames(_for.post))
-		m_currentVariableValues.erase(var);
+		if (std::optional<size_t> index = m_variablesToReplace.index(var))
+			m_currentVariableValues[*index] = {};
 
 	visit(*_for.condition);
 	(*this)(_for.body);
@@ -364,25 +372,31 @@ void PropagateValues::operator()(ForLoop& _for)
 
 void PropagateValues::operator()(Block& _block)
 {
-	std::set<YulString> clearAtParentBlock = std::move(m_clearAtEndOfBlock);
+	std::vector<size_t> clearAtParentBlock = std::move(m_clearAtEndOfBlock);
 	m_clearAtEndOfBlock.clear();
 
 	ASTModifier::operator()(_block);
 
-	for (auto const& var: m_clearAtEndOfBlock)
-		m_currentVariableValues.erase(var);
+	for (size_t index: m_clearAtEndOfBlock)
+		m_currentVariableValues[index] = {};
 
 	m_clearAtEndOfBlock = std::move(clearAtParentBlock);
 }
 
+void PropagateValues::setValue(size_t _variable, YulString _value)
+{
+	m_currentVariableValues[_variable] = _value;
+	m_clearAtEndOfBlock.emplace_back(_variable);
+}
+
 }
 
 void SSATransform::run(OptimiserStepContext& _context, Block& _ast)
 {
 	TypeInfo typeInfo(_context.dialect, _ast);
 	std::set<YulString> assignedVariables = assignedVariableNames(_ast);
-	IntroduceSSA{_context.dispenser, assignedVariables, typeInfo}(_ast);
-	IntroduceControlFlowSSA{_context.dispenser, assignedVariables, typeInfo}(_ast);
+	IntroduceSSA{_context.dispenser, assignedVariables, typeInfo, _context.expressionPool}(_ast);
+	IntroduceControlFlowSSA{_context.dispenser, assignedVariables, typeInfo, _context.expressionPool}(_ast);
 	PropagateValues{assignedVariables}(_ast);
 }
 
@@ -22,9 +22,11 @@
 #include <libyul/optimiser/Semantics.h>
 
 #include <libyul/optimiser/OptimizerUtilities.h>
+#include <libyul/optimiser/NameCollector.h>
 #include <libyul/Exceptions.h>
 #include <libyul/AST.h>
 #include <libyul/Dialect.h>
+#include <libyul/Utilities.h>
 
 #include <libevmasm/SemanticInformation.h>
 
@@ -135,32 +137,256 @@ std::map<YulString, SideEffects> SideEffectsPropagator::sideEffects(
 		ret[function].cannotLoop = false;
 	}
 
+	// The side effects of a function are those of all the code reachable from it. All functions
+	// of one strongly connected component of the call graph can reach each other and thus
+	// have the same side effects. The components are found with Tarjan's algorithm, which
+	// completes each component after all components it calls, so each of them is visited once.
+	std::map<YulString, size_t> index;
+	std::map<YulString, size_t> lowLink;
+	std::vector<YulString> stack;
+	std::set<YulString> onStack;
+	auto visit = [&](YulString _function, auto&& _recurse) -> void {
+		size_t const functionIndex = index.size();
+		index[_function] = functionIndex;
+		lowLink[_function] = functionIndex;
+		stack.emplace_back(_function);
+		onStack.insert(_function);
+		for (YulString callee: _directCallGraph.functionCalls.at(_function))
+		{
+			if (_dialect.builtin(callee))
+				continue;
+			if (!index.count(callee))
+			{
+				_recurse(callee, _recurse);
+				lowLink[_function] = std::min(lowLink[_function], lowLink[callee]);
+			}
+			else if (onStack.count(callee))
+				lowLink[_function] = std::min(lowLink[_function], index[callee]);
+		}
+		if (lowLink[_function] != functionIndex)
+			return;
+
+		std::vector<YulString> members;
+		do
+		{
+			members.emplace_back(stack.back());
+			stack.pop_back();
+			onStack.erase(members.back());
+		}
+		while (members.back() != _function);
+
+		// The entries of callees outside of the component are already complete.
+		SideEffects sideEffects;
+		for (YulString member: members)
+		{
+			if (SideEffects const* memberSideEffects = util::valueOrNullptr(ret, member))
+				sideEffects += *memberSideEffects;
+			for (YulString callee: _directCallGraph.functionCalls.at(member))
+				if (BuiltinFunction const* f = _dialect.builtin(callee))
+					sideEffects += f->sideEffects;
+				else if (SideEffects const* calleeSideEffects = util::valueOrNullptr(ret, callee))
+					sideEffects += *calleeSideEffects;
+		}
+		for (YulString member: members)
+			ret[member] = sideEffects;
+	};
 	for (auto const& call: _directCallGraph.functionCalls)
+		if (!index.count(call.first))
+			visit(call.first, visit);
+	return ret;
+}
+
+namespace
+{
+
+/// Collects the storage slots written to (if @a _effect is Write) or read from (if @a _effect is Read)
+/// by a piece of code and the user-defined functions it calls. See StorageAccessPropagator.
+class StorageAccessCollector: public ASTWalker
+{
+public:
+	StorageAccessCollector(
+		Dialect const& _dialect,
+		SideEffects::Effect _effect,
+		std::set<YulString> _assignedVariables,
+		std::function<std::optional<u256>(YulString)> _variableValue = {}
+	):
+		m_dialect(_dialect),
+		m_effect(_effect),
+		m_assignedVariables(std::move(_assignedVariables)),
+		m_variableValue(std::move(_variableValue))
+	{}
+
+	using ASTWalker::operator();
+	void operator()(VariableDeclaration const& _varDecl) override
 	{
-		YulString funName = call.first;
-		SideEffects sideEffects;
-		auto _visit = [&, visited = std::set<YulString>{}](YulString _function, auto&& _recurse) mutable {
-			if (!visited.insert(_function).second)
+		for (auto const& variable: _varDecl.variables)
+			m_declaredVariables.insert(variable.name);
+		if (_varDecl.variables.size() == 1 && !m_assignedVariables.count(_varDecl.variables.front().name))
+			if (Literal const* literal = std::get_if<Literal>(_varDecl.value.get()))
+				m_constants[_varDecl.variables.front().name] = valueOfLiteral(*literal);
+		ASTWalker::operator()(_varDecl);
+	}
+	void operator()(FunctionDefinition const& _function) override
+	{
+		for (auto const& variable: _function.parameters + _function.returnVariables)
+			m_declaredVariables.insert(variable.name);
+		ASTWalker::operator()(_function);
+	}
+	void operator()(FunctionCall const& _funCall) override
+	{
+		ASTWalker::operator()(_funCall);
+		if (BuiltinFunction const* builtin = m_dialect.builtin(_funCall.functionName.name))
+		{
+			if (builtin->sideEffects.storage < m_effect || !m_slots)
 				return;
-			if (sideEffects == SideEffects::worst())
+			BuiltinFunction const* storageStore = m_dialect.storageStoreFunction(YulString{});
+			BuiltinFunction const* storageLoad = m_dialect.storageLoadFunction(YulString{});
+			bool isStore = storageStore && builtin->name == storageStore->name;
+			bool isLoad = storageLoad && builtin->name == storageLoad->name;
+			if (m_effect == SideEffects::Read && isStore)
 				return;
-			if (BuiltinFunction const* f = _dialect.builtin(_function))
-				sideEffects += f->sideEffects;
-			else
-			{
-				if (ret.count(_function))
-					sideEffects += ret[_function];
-				for (YulString callee: _directCallGraph.functionCalls.at(_function))
-					_recurse(callee, _recurse);
-			}
-		};
-		for (auto const& _v: call.second)
-			_visit(_v, _visit);
-		ret[funName] += sideEffects;
+			if ((m_effect == SideEffects::Write && isStore) || (m_effect == SideEffects::Read && isLoad))
+				if (std::optional<u256> slot = slotValue(_funCall.arguments.front()))
+				{
+					m_slots->insert(*slot);
+					return;
+				}
+			m_slots.reset();
+		}
+		else
+			m_calledFunctions.insert(_funCall.functionName.name);
+	}
+
+	/// @returns the slots accessed by builtin functions or nullopt if they are not known.
+	std::optional<std::set<u256>> const& slots() const { return m_slots; }
+	std::set<YulString> const& calledFunctions() const { return m_calledFunctions; }
+
+private:
+	std::optional<u256> slotValue(Expression const& _slot) const
+	{
+		if (Literal const* literal = std::get_if<Literal>(&_slot))
+			return valueOfLiteral(*literal);
+		else if (Identifier const* identifier = std::get_if<Identifier>(&_slot))
+		{
+			if (u256 const* value = util::valueOrNullptr(m_constants, identifier->name))
+				return *value;
+			else if (m_variableValue && !m_declaredVariables.count(identifier->name))
+				return m_variableValue(identifier->name);
+		}
+		return std::nullopt;
+	}
+
+	Dialect const& m_dialect;
+	SideEffects::Effect m_effect;
+	/// Variables assigned to anywhere in the code.
+	std::set<YulString> m_assignedVariables;
+	/// Values of variables declared outside of the code.
+	std::function<std::optional<u256>(YulString)> m_variableValue;
+	std::set<YulString> m_declaredVariables;
+	std::map<YulString, u256> m_constants;
+	std::optional<std::set<u256>> m_slots = std::set<u256>{};
+	std::set<YulString> m_calledFunctions;
+};
+
+std::optional<std::set<u256>> combineAccessedSlots(
+	StorageAccessCollector const& _collector,
+	std::map<YulString, std::set<u256>> const& _functionAccessedSlots
+)
+{
+	std::optional<std::set<u256>> slots = _collector.slots();
+	for (YulString function: _collector.calledFunctions())
+	{
+		if (!slots)
+			break;
+		if (std::set<u256> const* functionSlots = util::valueOrNullptr(_functionAccessedSlots, function))
+			*slots += *functionSlots;
+		else
+			slots.reset();
+	}
+	return slots;
+}
+
+std::map<YulString, std::set<u256>> functionAccessedSlots(
+	Dialect const& _dialect,
+	Block const& _ast,
+	SideEffects::Effect _effect
+)
+{
+	std::map<YulString, std::set<YulString>> calledFunctions;
+	std::map<YulString, std::set<u256>> ret;
+	for (auto const& [name, function]: allFunctionDefinitions(_ast))
+	{
+		StorageAccessCollector collector{_dialect, _effect, assignedVariableNames(function->body)};
+		collector(function->body);
+		if (collector.slots())
+		{
+			ret[name] = *collector.slots();
+			calledFunctions[name] = collector.calledFunctions();
+		}
+	}
+
+	// Propagate the accesses along the calls until nothing changes. The sets
+	// only grow and are bounded by the slots occurring in the code.
+	bool changed = true;
+	while (changed)
+	{
+		changed = false;
+		for (auto const& [name, callees]: calledFunctions)
+		{
+			if (!ret.count(name))
+				continue;
+			std::set<u256>& slots = ret.at(name);
+			size_t previousSize = slots.size();
+			for (YulString callee: callees)
+				if (std::set<u256> const* calleeSlots = util::valueOrNullptr(ret, callee))
+					slots += *calleeSlots;
+				else
+				{
+					ret.erase(name);
+					break;
+				}
+			if (!ret.count(name) || ret.at(name).size() != previousSize)
+				changed = true;
+		}
 	}
 	return ret;
 }
 
+}
+
+std::map<YulString, std::set<u256>> StorageAccessPropagator::writtenSlots(Dialect const& _dialect, Block const& _ast)
+{
+	return functionAccessedSlots(_dialect, _ast, SideEffects::Write);
+}
+
+std::map<YulString, std::set<u256>> StorageAccessPropagator::readSlots(Dialect const& _dialect, Block const& _ast)
+{
+	return functionAccessedSlots(_dialect, _ast, SideEffects::Read);
+}
+
+std::optional<std::set<u256>> StorageAccessPropagator::writtenSlots(
+	Dialect const& _dialect,
+	Expression const& _expression,
+	std::map<YulString, std::set<u256>> const& _functionWrittenSlots,
+	std::function<std::optional<u256>(YulString)> const& _variableValue
+)
+{
+	StorageAccessCollector collector{_dialect, SideEffects::Write, {}, _variableValue};
+	collector.visit(_expression);
+	return combineAccessedSlots(collector, _functionWrittenSlots);
+}
+
+std::optional<std::set<u256>> StorageAccessPropagator::writtenSlots(
+	Dialect const& _dialect,
+	Block const& _block,
+	std::map<YulString, std::set<u256>> const& _functionWrittenSlots
+)
+{
+	StorageAccessCollector collector{_dialect, SideEffects::Write, assignedVariableNames(_block)};
+	collector(_block);
+	return combineAccessedSlots(collector, _functionWrittenSlots);
+}
+
 MovableChecker::MovableChecker(Dialect const& _dialect, Expression const& _expression):
 	MovableChecker(_dialect)
 {
@@ -27,6 +27,10 @@
 #include <libyul/optimiser/ASTWalker.h>
 #include <libyul/optimiser/CallGraphGenerator.h>
 
+#include <libsolutil/Numeric.h>
+
+#include <functional>
+#include <optional>
 #include <set>
 
 namespace solidity::yul
@@ -111,6 +115,7 @@ public:
 	}
 	bool cannotLoop() const { return m_sideEffects.cannotLoop; }
 	bool invalidatesStorage() const { return m_sideEffects.storage == SideEffects::Write; }
+	bool invalidatesTransientStorage() const { return m_sideEffects.transientStorage == SideEffects::Write; }
 	bool invalidatesMemory() const { return m_sideEffects.memory == SideEffects::Write; }
 
 	SideEffects sideEffects() { return m_sideEffects; }
@@ -136,6 +141,44 @@ public:
 	);
 };
 
+/**
+ * This class can be used to determine the storage slots written to or read from by user-defined
+ * functions and pieces of code, including the accesses of the functions they call.
+ *
+ * The written slots are only known if all writes to storage are ``sstore`` calls whose slot is
+ * a number literal or a variable that is declared with a number literal as its value and
+ * never re-assigned. The same holds for the read slots and ``sload`` calls.
+ */
+class StorageAccessPropagator
+{
+public:
+	/// @returns the storage slots written to by the user-defined functions in @a _ast.
+	/// Functions whose written slots are not known are not contained in the result.
+	static std::map<YulString, std::set<u256>> writtenSlots(Dialect const& _dialect, Block const& _ast);
+
+	/// @returns the storage slots read from by the user-defined functions in @a _ast.
+	/// Functions whose read slots are not known are not contained in the result.
+	static std::map<YulString, std::set<u256>> readSlots(Dialect const& _dialect, Block const& _ast);
+
+	/// @returns the storage slots written to by @a _expression or nullopt if they are not known.
+	/// @param _functionWrittenSlots the written slots of user-defined functions as returned above.
+	/// @param _variableValue returns the value of a variable at the point of the expression, if known.
+	static std::optional<std::set<u256>> writtenSlots(
+		Dialect const& _dialect,
+		Expression const& _expression,
+		std::map<YulString, std::set<u256>> const& _functionWrittenSlots,
+		std::function<std::optional<u256>(YulString)> const& _variableValue
+	);
+
+	/// @returns the storage slots written to by @a _block or nullopt if they are not known.
+	/// @param _functionWrittenSlots the written slots of user-defined functions as returned above.
+	static std::optional<std::set<u256>> writtenSlots(
+		Dialect const& _dialect,
+		Block const& _block,
+		std::map<YulString, std::set<u256>> const& _functionWrittenSlots
+	);
+};
+
 /**
  * Class that can be used to find out if certain code contains the MSize instruction
  * or a verbatim bytecode builtin (which is always assumed that it could contain MSize).
@@ -47,7 +47,8 @@ SimplificationRules::Rule const* SimplificationRules::findFirstMatch(
 	if (!instruction)
 		return nullptr;
 
-	static std::map<std::optional<EVMVersion>, std::unique_ptr<SimplificationRules>> evmRules;
+	// The rules keep track of the current match state, so each thread needs its own copy.
+	static thread_local std::map<std::optional<EVMVersion>, std::unique_ptr<SimplificationRules>> evmRules;
 
 	std::optional<EVMVersion> version;
 	if (yul::EVMDialect const* evmDialect = dynamic_cast<yul::EVMDialect const*>(&_dialect))
@@ -59,19 +60,47 @@ SimplificationRules::Rule const* SimplificationRules::findFirstMatch(
 	SimplificationRules& rules = *evmRules[version];
 	assertThrow(rules.isInitialized(), OptimizerException, "Rule list not properly initialized.");
 
-	for (auto const& rule: rules.m_rules[uint8_t(instruction->first)])
-	{
+	std::vector<ArgumentShape> argumentShapes;
+	argumentShapes.reserve(instruction->second->size());
+	for (Expression const& argument: *instruction->second)
+		argumentShapes.emplace_back(argumentShape(argument, _dialect, _ssaValues));
+
+	return rules.m_rules.findFirst(instruction->first, argumentShapes, [&](Rule const& _rule) {
 		rules.resetMatchGroups();
-		if (rule.pattern.matches(_expr, _dialect, _ssaValues))
-			if (!rule.feasible || rule.feasible())
-				return &rule;
-	}
-	return nullptr;
+		return _rule.pattern.matches(_expr, _dialect, _ssaValues) && (!_rule.feasible || _rule.feasible());
+	});
 }
 
 bool SimplificationRules::isInitialized() const
 {
-	return !m_rules[uint8_t(evmasm::Instruction::ADD)].empty();
+	return !m_rules.rules(evmasm::Instruction::ADD).empty();
+}
+
+ArgumentShape SimplificationRules::argumentShape(
+	Expression const& _argument,
+	Dialect const& _dialect,
+	std::function<AssignedValue const*(YulString)> const& _ssaValues
+)
+{
+	// Direct function calls as arguments are never matched, see Pattern::matches.
+	if (std::holds_alternative<FunctionCall>(_argument))
+		return {ArgumentShape::Kind::None, {}};
+
+	// Resolve the variable like Pattern::matches does for constants and operations.
+	Expression const* argument = &_argument;
+	if (std::holds_alternative<Identifier>(_argument))
+		if (AssignedValue const* value = _ssaValues(std::get<Identifier>(_argument).name))
+			if (value->value)
+				argument = value->value;
+
+	if (std::holds_alternative<Literal>(*argument))
+	{
+		if (std::get<Literal>(*argument).kind == LiteralKind::Number)
+			return {ArgumentShape::Kind::Constant, {}};
+	}
+	else if (auto instructionAndArgs = instructionAndArguments(_dialect, *argument))
+		return {ArgumentShape::Kind::Operation, instructionAndArgs->first};
+	return {};
 }
 
 std::optional<std::pair<evmasm::Instruction, std::vector<Expression> const*>>
@@ -86,15 +115,15 @@ std::optional<std::pair<evmasm::Instruction, std::vector<Expression> const*>>
 	return {};
 }
 
-void SimplificationRules::addRules(std::vector<Rule> const& _rules)
+void SimplificationRules::addRules(std::vector<Rule> _rules)
 {
-	for (auto const& r: _rules)
-		addRule(r);
+	for (auto& r: _rules)
+		addRule(std::move(r));
 }
 
-void SimplificationRules::addRule(Rule const& _rule)
+void SimplificationRules::addRule(Rule _rule)
 {
-	m_rules[uint8_t(_rule.pattern.instruction())].push_back(_rule);
+	m_rules.add(std::move(_rule));
 }
 
 SimplificationRules::SimplificationRules(std::optional<langutil::EVMVersion> _evmVersion)
@@ -121,14 +150,14 @@ SimplificationRules::SimplificationRules(std::optional<langutil::EVMVersion> _ev
 	assertThrow(isInitialized(), OptimizerException, "Rule list not properly initialized.");
 }
 
-yul::Pattern::Pattern(evmasm::Instruction _instruction, std::initializer_list<Pattern> _arguments):
+yul::Pattern::Pattern(evmasm::Instruction _instruction, std::vector<Pattern> _arguments):
 	m_kind(PatternKind::Operation),
 	m_instruction(_instruction),
-	m_arguments(_arguments)
+	m_arguments(std::move(_arguments))
 {
 }
 
-void Pattern::setMatchGroup(unsigned _group, std::map<unsigned, Expression const*>& _matchGroups)
+void Pattern::setMatchGroup(unsigned _group, evmasm::MatchGroups<Expression>& _matchGroups)
 {
 	m_matchGroup = _group;
 	m_matchGroups = &_matchGroups;
@@ -202,11 +231,9 @@ bool Pattern::matches(
 		// on the variables and not their values.
 		// The assumption is that CSE or local value numbering has been done prior to this step.
 
-		if (m_matchGroups->count(m_matchGroup))
+		if (Expression const* firstMatch = m_matchGroups->get(m_matchGroup))
 		{
 			assertThrow(m_kind == PatternKind::Any, OptimizerException, "Match group repetition for non-any.");
-			Expression const* firstMatch = (*m_matchGroups)[m_matchGroup];
-			assertThrow(firstMatch, OptimizerException, "Match set but to null.");
 			assertThrow(
 				!std::holds_alternative<FunctionCall>(_expr) &&
 				!std::holds_alternative<FunctionCall>(*firstMatch),
@@ -217,12 +244,12 @@ bool Pattern::matches(
 			return SyntacticallyEqual{}(*firstMatch, _expr);
 		}
 		else if (m_kind == PatternKind::Any)
-			(*m_matchGroups)[m_matchGroup] = &_expr;
+			m_matchGroups->set(m_matchGroup, &_expr);
 		else
 		{
 			assertThrow(m_kind == PatternKind::Constant, OptimizerException, "Match group set for operation.");
 			// We do not use _expr here, because we want the actual number.
-			(*m_matchGroups)[m_matchGroup] = expr;
+			m_matchGroups->set(m_matchGroup, expr);
 		}
 	}
 	return true;
@@ -234,6 +261,20 @@ evmasm::Instruction Pattern::instruction() const
 	return m_instruction;
 }
 
+ArgumentShape Pattern::shape() const
+{
+	switch (m_kind)
+	{
+	case PatternKind::Operation:
+		return {ArgumentShape::Kind::Operation, m_instruction};
+	case PatternKind::Constant:
+		return {ArgumentShape::Kind::Constant, {}};
+	case PatternKind::Any:
+		break;
+	}
+	return {};
+}
+
 Expression Pattern::toExpression(langutil::DebugData::ConstPtr const& _debugData, langutil::EVMVersion _evmVersion) const
 {
 	if (matchGroup())
@@ -268,6 +309,7 @@ Expression const& Pattern::matchGroupValue() const
 {
 	assertThrow(m_matchGroup > 0, OptimizerException, "");
 	assertThrow(!!m_matchGroups, OptimizerException, "");
-	assertThrow((*m_matchGroups)[m_matchGroup], OptimizerException, "");
-	return *(*m_matchGroups)[m_matchGroup];
+	Expression const* value = m_matchGroups->get(m_matchGroup);
+	assertThrow(value, OptimizerException, "");
+	return *value;
 }
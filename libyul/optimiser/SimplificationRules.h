@@ -75,13 +75,21 @@ public:
 	instructionAndArguments(Dialect const& _dialect, Expression const& _expr);
 
 private:
-	void addRules(std::vector<Rule> const& _rules);
-	void addRule(Rule const& _rule);
+	/// @returns the shape of an argument of an expression to be matched,
+	/// resolving variables with known values.
+	static evmasm::ArgumentShape argumentShape(
+		Expression const& _argument,
+		Dialect const& _dialect,
+		std::function<AssignedValue const*(YulString)> const& _ssaValues
+	);
+
+	void addRules(std::vector<Rule> _rules);
+	void addRule(Rule _rule);
 
 	void resetMatchGroups() { m_matchGroups.clear(); }
 
-	std::map<unsigned, Expression const*> m_matchGroups;
-	std::vector<evmasm::SimplificationRule<Pattern>> m_rules[256];
+	evmasm::MatchGroups<Expression> m_matchGroups;
+	evmasm::SimplificationRuleTable<Pattern> m_rules;
 };
 
 enum class PatternKind
@@ -112,11 +120,11 @@ public:
 	// Matches a specific constant value.
 	Pattern(u256 const& _value): m_kind(PatternKind::Constant), m_data(std::make_shared<u256>(_value)) {}
 	// Matches a given instruction with given arguments
-	Pattern(evmasm::Instruction _instruction, std::initializer_list<Pattern> _arguments = {});
+	Pattern(evmasm::Instruction _instruction, std::vector<Pattern> _arguments = {});
 	/// Sets this pattern to be part of the match group with the identifier @a _group.
 	/// Inside one rule, all patterns in the same match group have to match expressions from the
 	/// same expression equivalence class.
-	void setMatchGroup(unsigned _group, std::map<unsigned, Expression const*>& _matchGroups);
+	void setMatchGroup(unsigned _group, evmasm::MatchGroups<Expression>& _matchGroups);
 	unsigned matchGroup() const { return m_matchGroup; }
 	bool matches(
 		Expression const& _expr,
@@ -124,13 +132,16 @@ public:
 		std::function<AssignedValue const*(YulString)> const& _ssaValues
 	) const;
 
-	std::vector<Pattern> arguments() const { return m_arguments; }
+	std::vector<Pattern> const& arguments() const { return m_arguments; }
 
 	/// @returns the data of the matched expression if this pattern is part of a match group.
 	u256 d() const;
 
 	evmasm::Instruction instruction() const;
 
+	/// @returns the shape of the expressions matched by this pattern.
+	evmasm::ArgumentShape shape() const;
+
 	/// Turns this pattern into an actual expression. Should only be called
 	/// for patterns resulting from an action, i.e. with match groups assigned.
 	Expression toExpression(langutil::DebugData::ConstPtr const& _debugData, langutil::EVMVersion _evmVersion) const;
@@ -143,7 +154,7 @@ private:
 	std::shared_ptr<u256> m_data; ///< Only valid if m_kind is Constant
 	std::vector<Pattern> m_arguments;
 	unsigned m_matchGroup = 0;
-	std::map<unsigned, Expression const*>* m_matchGroups = nullptr;
+	evmasm::MatchGroups<Expression>* m_matchGroups = nullptr;
 };
 
 }
@@ -21,6 +21,7 @@
 
 #include <libyul/optimiser/StackCompressor.h>
 
+#include <libyul/optimiser/ASTCopier.h>
 #include <libyul/optimiser/NameCollector.h>
 #include <libyul/optimiser/Rematerialiser.h>
 #include <libyul/optimiser/UnusedPruner.h>
@@ -40,6 +41,9 @@
 
 #include <libsolutil/CommonData.h>
 
+#include <range/v3/range/conversion.hpp>
+#include <range/v3/view/map.hpp>
+
 using namespace solidity;
 using namespace solidity::yul;
 
@@ -181,6 +185,31 @@ void eliminateVariables(
 	UnusedPruner::runUntilStabilised(_dialect, _ast, _allowMSizeOptimization, nullptr, allFunctions);
 }
 
+/// @returns a copy of @a _object in which only the functions in @a _functions, and the code outside
+/// of functions if @a _functions contains the empty name, keep their code. All other functions
+/// keep their signature but get an empty body. This suffices to check the compilability of the
+/// retained functions, because the code transform generates each function independently.
+Object withCodeOnlyOf(Object const& _object, std::set<YulString> const& _functions)
+{
+	Object result = _object;
+	result.code = std::make_shared<Block>(Block{_object.code->debugData, {}});
+	result.code->statements.reserve(_object.code->statements.size());
+	for (Statement const& statement: _object.code->statements)
+		if (auto const* function = std::get_if<FunctionDefinition>(&statement); function && !_functions.count(function->name))
+			result.code->statements.emplace_back(FunctionDefinition{
+				function->debugData,
+				function->name,
+				function->parameters,
+				function->returnVariables,
+				Block{function->body.debugData, {}}
+			});
+		else if (std::holds_alternative<Block>(statement) && !_functions.count(YulString{}))
+			result.code->statements.emplace_back(Block{std::get<Block>(statement).debugData, {}});
+		else
+			result.code->statements.emplace_back(ASTCopier{}.translate(statement));
+	return result;
+}
+
 void eliminateVariablesOptimizedCodegen(
 	Dialect const& _dialect,
 	Block& _ast,
@@ -258,19 +287,23 @@ bool StackCompressor::run(
 	{
 		yul::AsmAnalysisInfo analysisInfo = yul::AsmAnalyzer::analyzeStrictAssertCorrect(_dialect, _object);
 		std::unique_ptr<CFG> cfg = ControlFlowGraphBuilder::build(analysisInfo, _dialect, *_object.code);
-		eliminateVariablesOptimizedCodegen(
-			_dialect,
-			*_object.code,
-			StackLayoutGenerator::reportStackTooDeep(*cfg),
-			allowMSizeOptimization
-		);
+		run(_dialect, _object, StackLayoutGenerator::reportStackTooDeep(*cfg));
 	}
 	else
+	{
+		// Eliminating variables in some functions does not affect the compilability of the others,
+		// so after the first iteration, only the functions that still had a deficit are checked.
+		std::optional<std::set<YulString>> uncompilableFunctions;
 		for (size_t iterations = 0; iterations < _maxIterations; iterations++)
 		{
-			std::map<YulString, int> stackSurplus = CompilabilityChecker(_dialect, _object, _optimizeStackAllocation).stackDeficit;
+			std::map<YulString, int> stackSurplus = CompilabilityChecker(
+				_dialect,
+				uncompilableFunctions ? withCodeOnlyOf(_object, *uncompilableFunctions) : _object,
+				_optimizeStackAllocation
+			).stackDeficit;
 			if (stackSurplus.empty())
 				return true;
+			uncompilableFunctions = ranges::views::keys(stackSurplus) | ranges::to<std::set<YulString>>;
 			eliminateVariables(
 				_dialect,
 				*_object.code,
@@ -278,6 +311,25 @@ bool StackCompressor::run(
 				allowMSizeOptimization
 			);
 		}
+	}
 	return false;
 }
 
+void StackCompressor::run(
+	Dialect const& _dialect,
+	Object& _object,
+	std::map<YulString, std::vector<StackLayoutGenerator::StackTooDeep>> const& _stackTooDeepErrors
+)
+{
+	yulAssert(
+		_object.code &&
+		_object.code->statements.size() > 0 && std::holds_alternative<Block>(_object.code->statements.at(0)),
+		"Need to run the function grouper before the stack compressor."
+	);
+	eliminateVariablesOptimizedCodegen(
+		_dialect,
+		*_object.code,
+		_stackTooDeepErrors,
+		!MSizeFinder::containsMSize(_dialect, *_object.code)
+	);
+}
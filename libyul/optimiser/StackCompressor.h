@@ -22,9 +22,12 @@
 
 #pragma once
 
+#include <libyul/backends/evm/StackLayoutGenerator.h>
 #include <libyul/Object.h>
 
+#include <map>
 #include <memory>
+#include <vector>
 
 namespace solidity::yul
 {
@@ -52,6 +55,14 @@ public:
 		bool _optimizeStackAllocation,
 		size_t _maxIterations
 	);
+	/// Try to remove local variables to resolve the @a _stackTooDeepErrors that the
+	/// StackLayoutGenerator determined for the current code of @a _object.
+	/// Only to be used for the optimized code generator.
+	static void run(
+		Dialect const& _dialect,
+		Object& _object,
+		std::map<YulString, std::vector<StackLayoutGenerator::StackTooDeep>> const& _stackTooDeepErrors
+	);
 };
 
 }
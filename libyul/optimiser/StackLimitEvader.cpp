@@ -16,6 +16,7 @@
 */
 
 #include <libyul/optimiser/StackLimitEvader.h>
+#include <libyul/optimiser/ASTWalker.h>
 #include <libyul/optimiser/CallGraphGenerator.h>
 #include <libyul/optimiser/FunctionCallFinder.h>
 #include <libyul/optimiser/NameDispenser.h>
@@ -41,6 +42,37 @@ using namespace solidity::yul;
 
 namespace
 {
+/**
+ * Determines the nested blocks each variable is declared in. The parameters and return
+ * variables of functions are in scope in the whole function and get an empty list.
+ */
+struct VariableScopeCollector: ASTWalker
+{
+	using ASTWalker::operator();
+	void operator()(FunctionDefinition const& _function) override
+	{
+		ScopedSaveAndRestore outerBlocks(blocks, {});
+		for (TypedName const& variable: ranges::concat_view(_function.parameters, _function.returnVariables))
+			variableScopes[variable.name] = {};
+		ASTWalker::operator()(_function);
+	}
+	void operator()(VariableDeclaration const& _declaration) override
+	{
+		for (TypedName const& variable: _declaration.variables)
+			variableScopes[variable.name] = blocks;
+		ASTWalker::operator()(_declaration);
+	}
+	void operator()(Block const& _block) override
+	{
+		blocks.emplace_back(&_block);
+		ASTWalker::operator()(_block);
+		blocks.pop_back();
+	}
+
+	std::vector<Block const*> blocks;
+	std::map<YulString, std::vector<Block const*>> variableScopes;
+};
+
 /**
  * Walks the call graph using a Depth-First-Search assigning memory slots to variables.
  * - The leaves of the call graph will get the lowest slot, increasing towards the root.
@@ -51,8 +83,9 @@ namespace
  * - Determine the maximum value ``n`` of the values of ``slotsRequiredForFunction`` among the children.
  * - If the function itself contains variables that need memory slots, but is contained in a cycle,
  *   abort the process as failure.
- * - If not, assign each variable its slot starting from ``n`` (incrementing it).
- * - Assign ``n`` to ``slotsRequiredForFunction`` of the function.
+ * - If not, assign each variable the lowest slot starting from ``n`` that is not used by another variable
+ *   of the function whose scope overlaps, i.e. variables declared in disjoint blocks share slots.
+ * - Assign the number of the slot after the highest slot used to ``slotsRequiredForFunction`` of the function.
  */
 struct MemoryOffsetAllocator
 {
@@ -69,6 +102,21 @@ struct MemoryOffsetAllocator
 			for (YulString child: callGraph.at(_function))
 				requiredSlots = std::max(run(child), requiredSlots);
 
+		uint64_t const firstSlot = requiredSlots;
+		std::vector<YulString> allocatedVariables;
+		auto allocate = [&](YulString _variable) {
+			std::set<uint64_t> usedSlots;
+			for (YulString other: allocatedVariables)
+				if (scopesOverlap(_variable, other))
+					usedSlots.insert(slotAllocations.at(other));
+			uint64_t slot = firstSlot;
+			while (usedSlots.count(slot))
+				++slot;
+			slotAllocations[_variable] = slot;
+			allocatedVariables.emplace_back(_variable);
+			requiredSlots = std::max(requiredSlots, slot + 1);
+		};
+
 		if (auto const* unreachables = util::valueOrNullptr(unreachableVariables, _function))
 		{
 			if (FunctionDefinition const* functionDefinition = util::valueOrDefault(functionDefinitions, _function, nullptr, util::allow_copy))
@@ -80,7 +128,7 @@ struct MemoryOffsetAllocator
 						functionDefinition->parameters,
 						functionDefinition->returnVariables
 					) | ranges::views::take(totalArgCount - 16))
-						slotAllocations[var.name] = requiredSlots++;
+						allocate(var.name);
 
 			// Assign slots for all variables that become unreachable in the function body, if the above did not
 			// assign a slot for them already.
@@ -88,12 +136,24 @@ struct MemoryOffsetAllocator
 				// The empty case is a function with too many arguments or return values,
 				// which was already handled above.
 				if (!variable.empty() && !slotAllocations.count(variable))
-					slotAllocations[variable] = requiredSlots++;
+					allocate(variable);
 		}
 
 		return slotsRequiredForFunction[_function] = requiredSlots;
 	}
 
+	/// @returns false if the scopes of the two variables are known to be disjoint.
+	bool scopesOverlap(YulString _variable1, YulString _variable2) const
+	{
+		auto const* scope1 = util::valueOrNullptr(variableScopes, _variable1);
+		auto const* scope2 = util::valueOrNullptr(variableScopes, _variable2);
+		if (!scope1 || !scope2)
+			return true;
+		// The scopes overlap if one of the variables is declared in a block containing the other.
+		size_t const commonLength = std::min(scope1->size(), scope2->size());
+		return std::equal(scope1->begin(), scope1->begin() + static_cast<ptrdiff_t>(commonLength), scope2->begin());
+	}
+
 	/// Maps function names to the set of unreachable variables in that function.
 	/// An empty variable name means that the function has too many arguments or return variables.
 	std::map<YulString, std::vector<YulString>> const& unreachableVariables;
@@ -101,6 +161,8 @@ struct MemoryOffsetAllocator
 	std::map<YulString, std::vector<YulString>> const& callGraph;
 	/// Maps the name of each user-defined function to its definition.
 	std::map<YulString, FunctionDefinition const*> const& functionDefinitions;
+	/// Maps variable names to the nested blocks they are declared in.
+	std::map<YulString, std::vector<Block const*>> const& variableScopes;
 
 	/// Maps variable names to the memory slot the respective variable is assigned.
 	std::map<YulString, uint64_t> slotAllocations{};
@@ -199,7 +261,15 @@ void StackLimitEvader::run(
 
 	std::map<YulString, FunctionDefinition const*> functionDefinitions = allFunctionDefinitions(*_object.code);
 
-	MemoryOffsetAllocator memoryOffsetAllocator{_unreachableVariables, callGraph.functionCalls, functionDefinitions};
+	VariableScopeCollector scopeCollector;
+	scopeCollector(*_object.code);
+
+	MemoryOffsetAllocator memoryOffsetAllocator{
+		_unreachableVariables,
+		callGraph.functionCalls,
+		functionDefinitions,
+		scopeCollector.variableScopes
+	};
 	uint64_t requiredSlots = memoryOffsetAllocator.run();
 	yulAssert(requiredSlots < (uint64_t(1) << 32) - 1, "");
 
@@ -40,7 +40,8 @@ struct Object;
  * call graph is reported as unreachable, the process is aborted.
  *
  * Offsets are assigned to the variables, s.t. on every path through the call graph each variable gets a unique offset
- * in memory. However, distinct paths through the call graph can use the same memory offsets for their variables.
+ * in memory. However, distinct paths through the call graph can use the same memory offsets for their variables,
+ * and so can variables of the same function that are declared in disjoint blocks.
  *
  * The current arguments to the ``memoryguard`` calls are used as base memory offset and then replaced by the offset past
  * the last memory offset used for a variable on any path through the call graph.
@@ -21,9 +21,11 @@
 
 #include <libyul/optimiser/Suite.h>
 
+#include <libyul/optimiser/ASTCopier.h>
 #include <libyul/optimiser/Disambiguator.h>
 #include <libyul/optimiser/VarDeclInitializer.h>
 #include <libyul/optimiser/BlockFlattener.h>
+#include <libyul/optimiser/BlockOutliner.h>
 #include <libyul/optimiser/CallGraphGenerator.h>
 #include <libyul/optimiser/CircularReferencesPruner.h>
 #include <libyul/optimiser/ControlFlowSimplifier.h>
@@ -43,6 +45,7 @@
 #include <libyul/optimiser/ForLoopInitRewriter.h>
 #include <libyul/optimiser/ForLoopConditionIntoBody.h>
 #include <libyul/optimiser/FunctionSpecializer.h>
+#include <libyul/optimiser/RangeSimplifier.h>
 #include <libyul/optimiser/Rematerialiser.h>
 #include <libyul/optimiser/UnusedFunctionParameterPruner.h>
 #include <libyul/optimiser/UnusedPruner.h>
@@ -63,6 +66,8 @@
 #include <libyul/optimiser/Metrics.h>
 #include <libyul/optimiser/NameSimplifier.h>
 #include <libyul/backends/evm/ConstantOptimiser.h>
+#include <libyul/backends/evm/ControlFlowGraphBuilder.h>
+#include <libyul/backends/evm/StackLayoutGenerator.h>
 #include <libyul/AsmAnalysis.h>
 #include <libyul/AsmAnalysisInfo.h>
 #include <libyul/AsmPrinter.h>
@@ -77,35 +82,57 @@
 
 #include <range/v3/view/map.hpp>
 #include <range/v3/action/remove.hpp>
+#include <range/v3/algorithm/all_of.hpp>
 #include <range/v3/algorithm/count.hpp>
 #include <range/v3/algorithm/none_of.hpp>
 
+#include <chrono>
 #include <limits>
 #include <tuple>
+#include <utility>
 
 #ifdef PROFILE_OPTIMIZER_STEPS
-#include <chrono>
 #include <fmt/format.h>
+#include <algorithm>
+#include <iostream>
 #endif
 
 using namespace solidity;
 using namespace solidity::yul;
-#ifdef PROFILE_OPTIMIZER_STEPS
 using namespace std::chrono;
-#endif
 using namespace std::string_literals;
 
 namespace
 {
 
+/// @returns the stack too deep errors of the optimized code generator in the code of @a _object
+/// when generating code for @a _eofVersion, with or without @a _exhaustiveStackLayoutSearch.
+std::map<YulString, std::vector<StackLayoutGenerator::StackTooDeep>> reportStackTooDeep(
+	EVMDialect const& _dialect,
+	Object const& _object,
+	std::optional<uint8_t> _eofVersion,
+	bool _exhaustiveStackLayoutSearch
+)
+{
+	AsmAnalysisInfo analysisInfo = AsmAnalyzer::analyzeStrictAssertCorrect(_dialect, _object);
+	std::unique_ptr<CFG> cfg = ControlFlowGraphBuilder::build(analysisInfo, _dialect, *_object.code);
+	return StackLayoutGenerator::reportStackTooDeep(
+		*cfg,
+		reachableStackDepth(_eofVersion),
+		_exhaustiveStackLayoutSearch
+	);
+}
+
 #ifdef PROFILE_OPTIMIZER_STEPS
-void outputPerformanceMetrics(map<string, int64_t> const& _metrics)
+void outputPerformanceMetrics(OptimiserProfile const& _profile)
 {
-	vector<pair<string, int64_t>> durations(_metrics.begin(), _metrics.end());
-	sort(
+	std::vector<std::pair<std::string, int64_t>> durations;
+	for (auto const& [step, stepProfile]: _profile.steps)
+		durations.emplace_back(step, stepProfile.durationInMicroseconds);
+	std::sort(
 		durations.begin(),
 		durations.end(),
-		[](pair<string, int64_t> const& _lhs, pair<string, int64_t> const& _rhs) -> bool
+		[](std::pair<std::string, int64_t> const& _lhs, std::pair<std::string, int64_t> const& _rhs) -> bool
 		{
 			return _lhs.second < _rhs.second;
 		}
@@ -115,25 +142,25 @@ void outputPerformanceMetrics(map<string, int64_t> const& _metrics)
 	for (auto&& [step, durationInMicroseconds]: durations)
 		totalDurationInMicroseconds += durationInMicroseconds;
 
-	cerr << "Performance metrics of optimizer steps" << endl;
-	cerr << "======================================" << endl;
+	std::cerr << "Performance metrics of optimizer steps" << std::endl;
+	std::cerr << "======================================" << std::endl;
 	constexpr double microsecondsInSecond = 1000000;
 	for (auto&& [step, durationInMicroseconds]: durations)
 	{
 		double percentage = 100.0 * static_cast<double>(durationInMicroseconds) / static_cast<double>(totalDurationInMicroseconds);
 		double sec = static_cast<double>(durationInMicroseconds) / microsecondsInSecond;
-		cerr << fmt::format("{:>7.3f}% ({} s): {}", percentage, sec, step) << endl;
+		std::cerr << fmt::format("{:>7.3f}% ({} s): {}", percentage, sec, step) << std::endl;
 	}
 	double totalDurationInSeconds = static_cast<double>(totalDurationInMicroseconds) / microsecondsInSecond;
-	cerr << "--------------------------------------" << endl;
-	cerr << fmt::format("{:>7}% ({:.3f} s)", 100, totalDurationInSeconds) << endl;
+	std::cerr << "--------------------------------------" << std::endl;
+	std::cerr << fmt::format("{:>7}% ({:.3f} s)", 100, totalDurationInSeconds) << std::endl;
 }
 #endif
 
 }
 
 
-void OptimiserSuite::run(
+bool OptimiserSuite::run(
 	Dialect const& _dialect,
 	GasMeter const* _meter,
 	Object& _object,
@@ -141,7 +168,13 @@ void OptimiserSuite::run(
 	std::string_view _optimisationSequence,
 	std::string_view _optimisationCleanupSequence,
 	std::optional<size_t> _expectedExecutionsPerDeployment,
-	std::set<YulString> const& _externallyUsedIdentifiers
+	std::set<YulString> const& _externallyUsedIdentifiers,
+	OptimiserProfile* o_profile,
+	size_t _parallelism,
+	std::map<YulString, size_t> const& _executionProfile,
+	std::optional<TimeBudget> const& _timeBudget,
+	std::optional<uint8_t> _eofVersion,
+	bool _exhaustiveStackLayoutSearch
 )
 {
 	EVMDialect const* evmDialect = dynamic_cast<EVMDialect const*>(&_dialect);
@@ -153,25 +186,38 @@ void OptimiserSuite::run(
 	std::set<YulString> reservedIdentifiers = _externallyUsedIdentifiers;
 	reservedIdentifiers += _dialect.fixedFunctionNames();
 
-	*_object.code = std::get<Block>(Disambiguator(
-		_dialect,
-		*_object.analysisInfo,
-		reservedIdentifiers
-	)(*_object.code));
 	Block& ast = *_object.code;
+	Disambiguator(_dialect, *_object.analysisInfo, reservedIdentifiers)(ast);
 
 	NameDispenser dispenser{_dialect, ast, reservedIdentifiers};
-	OptimiserStepContext context{_dialect, dispenser, reservedIdentifiers, _expectedExecutionsPerDeployment};
+	OptimiserStepContext context{
+		_dialect,
+		dispenser,
+		reservedIdentifiers,
+		_expectedExecutionsPerDeployment,
+		_parallelism,
+		_executionProfile
+	};
 
-	OptimiserSuite suite(context, Debug::None);
+#ifdef PROFILE_OPTIMIZER_STEPS
+	OptimiserProfile localProfile;
+	if (!o_profile)
+		o_profile = &localProfile;
+#endif
+	OptimiserSuite suite(context, Debug::None, o_profile);
 
 	// Some steps depend on properties ensured by FunctionHoister, BlockFlattener, FunctionGrouper and
 	// ForLoopInitRewriter. Run them first to be able to run arbitrary sequences safely.
 	suite.runSequence("hgfo", ast);
 
 	NameSimplifier::run(suite.m_context, ast);
-	// Now the user-supplied part
+	// Now the user-supplied part, which can be stopped at any step because of the preparation above.
+	if (_timeBudget)
+		suite.m_deadline = _timeBudget->deadline;
 	suite.runSequence(_optimisationSequence, ast);
+	// The rest is needed for a canonical form and to avoid "Stack too deep" errors, so it always runs.
+	bool const withinTimeBudget = !suite.m_deadlineExceeded;
+	suite.m_deadline.reset();
 
 	// This is a tuning parameter, but actually just prevents infinite loops.
 	size_t stackCompressorMaxIterations = 16;
@@ -188,7 +234,7 @@ void OptimiserSuite::run(
 		);
 
 	// Run the user-supplied clean up sequence
-	suite.runSequence(_optimisationCleanupSequence, ast);
+	suite.runSequence(withinTimeBudget ? _optimisationCleanupSequence : _timeBudget->fallbackCleanupSequence, ast);
 	// Hard-coded FunctionGrouper step is used to bring the AST into a canonical form required by the StackCompressor
 	// and StackLimitEvader. This is hard-coded as the last step, as some previously executed steps may break the
 	// aforementioned form, thus causing the StackCompressor/StackLimitEvader to throw.
@@ -197,17 +243,22 @@ void OptimiserSuite::run(
 	if (evmDialect)
 	{
 		yulAssert(_meter, "");
-		ConstantOptimiser{*evmDialect, *_meter}(ast);
+		std::map<YulString, GasMeter> functionMeters;
+		if (_expectedExecutionsPerDeployment)
+			for (auto const& [function, executions]: _executionProfile)
+				functionMeters.emplace(function, GasMeter{*evmDialect, false, executions});
+		ConstantOptimiser{*evmDialect, *_meter, std::move(functionMeters)}(ast);
 		if (usesOptimizedCodeGenerator)
 		{
-			StackCompressor::run(
-				_dialect,
-				_object,
-				_optimizeStackAllocation,
-				stackCompressorMaxIterations
-			);
-			if (evmDialect->providesObjectAccess())
-				StackLimitEvader::run(suite.m_context, _object);
+			// The stack too deep errors are only determined again for the StackLimitEvader
+			// if the StackCompressor had to change the code.
+			auto stackTooDeepErrors = reportStackTooDeep(*evmDialect, _object, _eofVersion, _exhaustiveStackLayoutSearch);
+			if (!ranges::all_of(stackTooDeepErrors | ranges::views::values, [](auto const& _errors) { return _errors.empty(); }))
+			{
+				StackCompressor::run(_dialect, _object, stackTooDeepErrors);
+				stackTooDeepErrors = reportStackTooDeep(*evmDialect, _object, _eofVersion, _exhaustiveStackLayoutSearch);
+			}
+			StackLimitEvader::run(suite.m_context, _object, stackTooDeepErrors);
 		}
 		else if (evmDialect->providesObjectAccess() && _optimizeStackAllocation)
 			StackLimitEvader::run(suite.m_context, _object);
@@ -218,10 +269,11 @@ void OptimiserSuite::run(
 	VarNameCleaner::run(suite.m_context, ast);
 
 #ifdef PROFILE_OPTIMIZER_STEPS
-	outputPerformanceMetrics(suite.m_durationPerStepInMicroseconds);
+	outputPerformanceMetrics(*o_profile);
 #endif
 
 	*_object.analysisInfo = AsmAnalyzer::analyzeStrictAssertCorrect(_dialect, _object);
+	return withinTimeBudget;
 }
 
 namespace
@@ -245,10 +297,11 @@ std::map<std::string, std::unique_ptr<OptimiserStep>> optimiserStepCollection()
 
 std::map<std::string, std::unique_ptr<OptimiserStep>> const& OptimiserSuite::allSteps()
 {
-	static std::map<std::string, std::unique_ptr<OptimiserStep>> instance;
-	if (instance.empty())
-		instance = optimiserStepCollection<
+	// Initialized as part of the declaration so that concurrent first calls are safe.
+	static std::map<std::string, std::unique_ptr<OptimiserStep>> const instance =
+		optimiserStepCollection<
 			BlockFlattener,
+			BlockOutliner,
 			CircularReferencesPruner,
 			CommonSubexpressionEliminator,
 			ConditionalSimplifier,
@@ -273,6 +326,7 @@ std::map<std::string, std::unique_ptr<OptimiserStep>> const& OptimiserSuite::all
 			LoopInvariantCodeMotion,
 			UnusedAssignEliminator,
 			UnusedStoreEliminator,
+			RangeSimplifier,
 			Rematerialiser,
 			SSAReverser,
 			SSATransform,
@@ -290,6 +344,7 @@ std::map<std::string, char> const& OptimiserSuite::stepNameToAbbreviationMap()
 {
 	static std::map<std::string, char> lookupTable{
 		{BlockFlattener::name,                'f'},
+		{BlockOutliner::name,                 'B'},
 		{CircularReferencesPruner::name,      'l'},
 		{CommonSubexpressionEliminator::name, 'c'},
 		{ConditionalSimplifier::name,         'C'},
@@ -314,6 +369,7 @@ std::map<std::string, char> const& OptimiserSuite::stepNameToAbbreviationMap()
 		{LoopInvariantCodeMotion::name,       'M'},
 		{UnusedAssignEliminator::name,        'r'},
 		{UnusedStoreEliminator::name,         'S'},
+		{RangeSimplifier::name,               'R'},
 		{Rematerialiser::name,                'm'},
 		{SSAReverser::name,                   'V'},
 		{SSATransform::name,                  'a'},
@@ -465,43 +521,92 @@ void OptimiserSuite::runSequence(std::string_view _stepAbbreviations, Block& _as
 	// NOTE: If _repeatUntilStable is false, the value will not be used so do not calculate it.
 	size_t codeSize = (_repeatUntilStable ? CodeSize::codeSizeIncludingFunctions(_ast) : 0);
 
+	// If all steps of the repeated part transform each function independently of the other functions,
+	// a function that is not changed in one round is not changed in any later round either.
+	// In that case, only the functions changed in the previous round are processed again.
+	std::optional<FunctionSelection> selection;
+	if (_repeatUntilStable && ranges::all_of(subsequences, [&](auto const& _subsequence) {
+		auto const& [subsequence, repeat] = _subsequence;
+		return !repeat && ranges::all_of(abbreviationsToSteps(subsequence), [](std::string const& _step) {
+			return allSteps().at(_step)->supportsFunctionSelection();
+		});
+	}))
+		selection.emplace();
+
+	// Only the rounds of the outermost repeated part of the sequence are profiled separately.
+	bool const profileRounds = m_profile && _repeatUntilStable && !m_profiledRound.has_value();
 	for (size_t round = 0; round < MaxRounds; ++round)
 	{
+		if (profileRounds)
+			m_profiledRound = round;
 		for (auto const& [subsequence, repeat]: subsequences)
 		{
 			if (repeat)
 				runSequence(subsequence, _ast, true);
 			else
-				runSequence(abbreviationsToSteps(subsequence), _ast);
+				runSequence(abbreviationsToSteps(subsequence), _ast, selection ? &*selection : nullptr);
 		}
+		if (profileRounds)
+			m_profiledRound.reset();
 
-		if (!_repeatUntilStable)
+		if (!_repeatUntilStable || (m_deadline && m_deadlineExceeded))
 			break;
 
 		size_t newSize = CodeSize::codeSizeIncludingFunctions(_ast);
 		if (newSize == codeSize)
 			break;
 		codeSize = newSize;
+
+		if (selection)
+			selection->functions = std::exchange(selection->changedFunctions, {});
 	}
 }
 
 void OptimiserSuite::runSequence(std::vector<std::string> const& _steps, Block& _ast)
 {
+	runSequence(_steps, _ast, nullptr);
+}
+
+void OptimiserSuite::runSequence(std::vector<std::string> const& _steps, Block& _ast, FunctionSelection* _selection)
+{
+	auto runStep = [&](OptimiserStep const& _step)
+	{
+		if (_selection)
+			_step.run(m_context, _ast, _selection->functions, _selection->changedFunctions);
+		else
+			_step.run(m_context, _ast);
+	};
+
 	std::unique_ptr<Block> copy;
 	if (m_debug == Debug::PrintChanges)
 		copy = std::make_unique<Block>(std::get<Block>(ASTCopier{}(_ast)));
 	for (std::string const& step: _steps)
 	{
+		if (deadlineExceeded())
+			return;
 		if (m_debug == Debug::PrintStep)
 			std::cout << "Running " << step << std::endl;
-#ifdef PROFILE_OPTIMIZER_STEPS
-		steady_clock::time_point startTime = steady_clock::now();
-#endif
-		allSteps().at(step)->run(m_context, _ast);
-#ifdef PROFILE_OPTIMIZER_STEPS
-		steady_clock::time_point endTime = steady_clock::now();
-		m_durationPerStepInMicroseconds[step] += duration_cast<microseconds>(endTime - startTime).count();
-#endif
+		if (m_profile)
+		{
+			OptimiserStepProfile stepProfile;
+			stepProfile.invocations = 1;
+			stepProfile.codeSizeBefore = CodeSize::codeSizeIncludingFunctions(_ast);
+			steady_clock::time_point startTime = steady_clock::now();
+			runStep(*allSteps().at(step));
+			steady_clock::time_point endTime = steady_clock::now();
+			stepProfile.durationInMicroseconds = duration_cast<microseconds>(endTime - startTime).count();
+			stepProfile.codeSizeAfter = CodeSize::codeSizeIncludingFunctions(_ast);
+
+			m_profile->steps[step] += stepProfile;
+			if (m_profiledRound.has_value())
+			{
+				if (m_profile->rounds.size() <= *m_profiledRound)
+					m_profile->rounds.resize(*m_profiledRound + 1);
+				m_profile->rounds[*m_profiledRound][step] += stepProfile;
+			}
+		}
+		else
+			runStep(*allSteps().at(step));
 		if (m_debug == Debug::PrintChanges)
 		{
 			// TODO should add switch to also compare variable names!
@@ -516,3 +621,60 @@ void OptimiserSuite::runSequence(std::vector<std::string> const& _steps, Block&
 		}
 	}
 }
+
+bool OptimiserSuite::deadlineExceeded()
+{
+	if (!m_deadline)
+		return false;
+	if (!m_deadlineExceeded && steady_clock::now() >= *m_deadline)
+		m_deadlineExceeded = true;
+	return m_deadlineExceeded;
+}
+
+OptimiserStepProfile& OptimiserStepProfile::operator+=(OptimiserStepProfile const& _other)
+{
+	invocations += _other.invocations;
+	durationInMicroseconds += _other.durationInMicroseconds;
+	codeSizeBefore += _other.codeSizeBefore;
+	codeSizeAfter += _other.codeSizeAfter;
+	return *this;
+}
+
+Json OptimiserStepProfile::toJson() const
+{
+	Json result;
+	result["invocations"] = invocations;
+	result["durationInMicroseconds"] = durationInMicroseconds;
+	result["codeSizeBefore"] = codeSizeBefore;
+	result["codeSizeAfter"] = codeSizeAfter;
+	return result;
+}
+
+OptimiserProfile& OptimiserProfile::operator+=(OptimiserProfile const& _other)
+{
+	for (auto const& [step, stepProfile]: _other.steps)
+		steps[step] += stepProfile;
+	if (rounds.size() < _other.rounds.size())
+		rounds.resize(_other.rounds.size());
+	for (size_t round = 0; round < _other.rounds.size(); ++round)
+		for (auto const& [step, stepProfile]: _other.rounds[round])
+			rounds[round][step] += stepProfile;
+	return *this;
+}
+
+Json OptimiserProfile::toJson() const
+{
+	auto stepsToJson = [](std::map<std::string, OptimiserStepProfile> const& _steps) {
+		Json result = Json::object();
+		for (auto const& [step, stepProfile]: _steps)
+			result[step] = stepProfile.toJson();
+		return result;
+	};
+
+	Json result;
+	result["steps"] = stepsToJson(steps);
+	result["rounds"] = Json::array();
+	for (auto const& roundSteps: rounds)
+		result["rounds"].emplace_back(stepsToJson(roundSteps));
+	return result;
+}
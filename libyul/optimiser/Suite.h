@@ -26,11 +26,16 @@
 #include <libyul/optimiser/OptimiserStep.h>
 #include <libyul/optimiser/NameDispenser.h>
 #include <liblangutil/EVMVersion.h>
+#include <libsolutil/JSON.h>
 
+#include <chrono>
+#include <map>
+#include <optional>
 #include <set>
 #include <string>
 #include <string_view>
 #include <memory>
+#include <vector>
 
 namespace solidity::yul
 {
@@ -40,6 +45,36 @@ struct Dialect;
 class GasMeter;
 struct Object;
 
+/**
+ * Resource usage of an optimiser step, summed up over all its invocations.
+ */
+struct OptimiserStepProfile
+{
+	size_t invocations = 0;
+	int64_t durationInMicroseconds = 0;
+	/// Code sizes in terms of CodeSize::codeSizeIncludingFunctions before and after the invocations.
+	size_t codeSizeBefore = 0;
+	size_t codeSizeAfter = 0;
+
+	OptimiserStepProfile& operator+=(OptimiserStepProfile const& _other);
+	Json toJson() const;
+};
+
+/**
+ * Resource usage of the optimiser steps run on the code of an object.
+ */
+struct OptimiserProfile
+{
+	/// Profiles of all invocations of the steps by step name.
+	std::map<std::string, OptimiserStepProfile> steps;
+	/// Profiles of the steps invoked in each round of the outermost repeated part ("[...]")
+	/// of the sequence.
+	std::vector<std::map<std::string, OptimiserStepProfile>> rounds;
+
+	OptimiserProfile& operator+=(OptimiserProfile const& _other);
+	Json toJson() const;
+};
+
 /**
  * Optimiser suite that combines all steps and also provides the settings for the heuristics.
  * Only optimizes the code of the provided object, does not descend into the sub-objects.
@@ -59,10 +94,30 @@ public:
 		PrintStep,
 		PrintChanges
 	};
-	OptimiserSuite(OptimiserStepContext& _context, Debug _debug = Debug::None): m_context(_context), m_debug(_debug) {}
+
+	/// Point in time after which no further steps of the optimisation sequence are started.
+	/// The cleanup sequence is then replaced by @a fallbackCleanupSequence, which is run in full.
+	struct TimeBudget
+	{
+		std::chrono::steady_clock::time_point deadline;
+		std::string_view fallbackCleanupSequence;
+	};
+
+	/// If @a _profile is given, the resource usage of all steps run is added to it.
+	OptimiserSuite(OptimiserStepContext& _context, Debug _debug = Debug::None, OptimiserProfile* _profile = nullptr):
+		m_context(_context),
+		m_debug(_debug),
+		m_profile(_profile)
+	{}
 
 	/// The value nullopt for `_expectedExecutionsPerDeployment` represents creation code.
-	static void run(
+	/// If @a o_profile is given, the resource usage of the optimiser steps is added to it.
+	/// Steps that process functions independently use up to @a _parallelism threads.
+	/// @a _executionProfile replaces `_expectedExecutionsPerDeployment` for the functions it contains.
+	/// @returns false if @a _timeBudget was exceeded, i.e. if part of the sequence was skipped.
+	/// Stack too deep errors are determined for code generated for @a _eofVersion
+	/// with or without @a _exhaustiveStackLayoutSearch, see StackLayoutGenerator::run.
+	static bool run(
 		Dialect const& _dialect,
 		GasMeter const* _meter,
 		Object& _object,
@@ -70,7 +125,13 @@ public:
 		std::string_view _optimisationSequence,
 		std::string_view _optimisationCleanupSequence,
 		std::optional<size_t> _expectedExecutionsPerDeployment,
-		std::set<YulString> const& _externallyUsedIdentifiers = {}
+		std::set<YulString> const& _externallyUsedIdentifiers = {},
+		OptimiserProfile* o_profile = nullptr,
+		size_t _parallelism = 1,
+		std::map<YulString, size_t> const& _executionProfile = {},
+		std::optional<TimeBudget> const& _timeBudget = std::nullopt,
+		std::optional<uint8_t> _eofVersion = std::nullopt,
+		bool _exhaustiveStackLayoutSearch = false
 	);
 
 	/// Ensures that specified sequence of step abbreviations is well-formed and can be executed.
@@ -89,11 +150,30 @@ public:
 	static std::map<char, std::string> const& stepAbbreviationToNameMap();
 
 private:
+	/// Top-level functions the steps of a repeated part of the sequence are restricted to
+	/// and the functions they changed in the current round.
+	struct FunctionSelection
+	{
+		/// All functions if nullopt.
+		std::optional<std::set<YulString>> functions;
+		std::set<YulString> changedFunctions;
+	};
+
+	/// If @a _selection is given, all steps have to support function selection.
+	void runSequence(std::vector<std::string> const& _steps, Block& _ast, FunctionSelection* _selection);
+
+	/// @returns true if there is a deadline and it has passed. Remembers this, so that all remaining
+	/// steps are skipped until the deadline is removed.
+	bool deadlineExceeded();
+
 	OptimiserStepContext& m_context;
 	Debug m_debug;
-#ifdef PROFILE_OPTIMIZER_STEPS
-	std::map<std::string, int64_t> m_durationPerStepInMicroseconds;
-#endif
+	OptimiserProfile* m_profile = nullptr;
+	/// Round of the outermost repeated part of the sequence currently being run, if profiling.
+	std::optional<size_t> m_profiledRound;
+	/// No steps are started after this point in time.
+	std::optional<std::chrono::steady_clock::time_point> m_deadline;
+	bool m_deadlineExceeded = false;
 };
 
 }
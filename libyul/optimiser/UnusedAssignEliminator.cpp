@@ -33,23 +33,45 @@
 #include <range/v3/action/remove_if.hpp>
 
 #include <iostream>
+#include <mutex>
 
 using namespace solidity;
 using namespace solidity::yul;
 
 void UnusedAssignEliminator::run(OptimiserStepContext& _context, Block& _ast)
 {
-	UnusedAssignEliminator uae{
-		_context.dialect,
-		ControlFlowSideEffectsCollector{_context.dialect, _ast}.functionSideEffectsNamed()
-	};
-	uae(_ast);
+	std::set<YulString> changedFunctions;
+	run(_context, _ast, std::nullopt, changedFunctions);
+}
 
-	uae.m_storesToRemove += uae.m_allStores - uae.m_usedStores;
+void UnusedAssignEliminator::run(
+	OptimiserStepContext& _context,
+	Block& _ast,
+	std::optional<std::set<YulString>> const& _functions,
+	std::set<YulString>& o_changedFunctions
+)
+{
+	std::map<YulString, ControlFlowSideEffects> const controlFlowSideEffects =
+		ControlFlowSideEffectsCollector{_context.dialect, _ast}.functionSideEffectsNamed();
+	std::mutex changedFunctionsMutex;
+	processFunctionsConcurrently(_context.parallelism, _ast, [&](Block& _part) {
+		UnusedAssignEliminator uae{_context.dialect, controlFlowSideEffects};
+		if (_functions)
+			uae.m_functionsToProcess = &*_functions;
+		uae(_part);
+
+		uae.m_storesToRemove += uae.m_allStores - uae.m_usedStores;
+		{
+			std::lock_guard<std::mutex> lock(changedFunctionsMutex);
+			o_changedFunctions += uae.m_changedFunctions;
+		}
 
-	std::set<Statement const*> toRemove{uae.m_storesToRemove.begin(), uae.m_storesToRemove.end()};
-	StatementRemover remover{toRemove};
-	remover(_ast);
+		if (uae.m_storesToRemove.empty())
+			return;
+		std::set<Statement const*> toRemove{uae.m_storesToRemove.begin(), uae.m_storesToRemove.end()};
+		StatementRemover remover{toRemove};
+		remover(_part);
+	});
 }
 
 void UnusedAssignEliminator::operator()(Identifier const& _identifier)
@@ -66,12 +88,20 @@ void UnusedAssignEliminator::operator()(Assignment const& _assignment)
 
 void UnusedAssignEliminator::operator()(FunctionDefinition const& _functionDefinition)
 {
+	bool const topLevel = !m_insideFunction;
+	if (topLevel && m_functionsToProcess && !m_functionsToProcess->count(_functionDefinition.name))
+		return;
+
 	ScopedSaveAndRestore outerReturnVariables(m_returnVariables, {});
+	ScopedSaveAndRestore insideFunction(m_insideFunction, true);
 
 	for (auto const& retParam: _functionDefinition.returnVariables)
 		m_returnVariables.insert(retParam.name);
 
+	size_t const storesToRemoveBefore = m_storesToRemove.size();
 	UnusedStoreBase::operator()(_functionDefinition);
+	if (topLevel && m_storesToRemove.size() != storesToRemoveBefore)
+		m_changedFunctions.insert(_functionDefinition.name);
 }
 
 void UnusedAssignEliminator::operator()(FunctionCall const& _functionCall)
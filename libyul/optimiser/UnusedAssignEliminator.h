@@ -29,6 +29,8 @@
 #include <libyul/optimiser/Semantics.h>
 
 #include <map>
+#include <optional>
+#include <set>
 #include <vector>
 
 namespace solidity::yul
@@ -118,6 +120,13 @@ class UnusedAssignEliminator: public UnusedStoreBase
 public:
 	static constexpr char const* name{"UnusedAssignEliminator"};
 	static void run(OptimiserStepContext&, Block& _ast);
+	/// Only processes the code outside of functions and the top-level functions in @a _functions.
+	static void run(
+		OptimiserStepContext&,
+		Block& _ast,
+		std::optional<std::set<YulString>> const& _functions,
+		std::set<YulString>& o_changedFunctions
+	);
 
 	explicit UnusedAssignEliminator(
 		Dialect const& _dialect,
@@ -145,6 +154,11 @@ private:
 
 	std::set<YulString> m_returnVariables;
 	std::map<YulString, ControlFlowSideEffects> m_controlFlowSideEffects;
+	/// If set, the top-level functions not contained in it are skipped.
+	std::set<YulString> const* m_functionsToProcess = nullptr;
+	/// Names of the top-level functions that contain assignments to be removed.
+	std::set<YulString> m_changedFunctions;
+	bool m_insideFunction = false;
 };
 
 }
@@ -28,6 +28,7 @@
 #include <libyul/optimiser/SSAValueTracker.h>
 #include <libyul/optimiser/DataFlowAnalyzer.h>
 #include <libyul/optimiser/KnowledgeBase.h>
+#include <libyul/optimiser/NameCollector.h>
 #include <libyul/ControlFlowSideEffectsCollector.h>
 #include <libyul/AST.h>
 
@@ -49,11 +50,38 @@ static std::string const one{"@ 1"};
 static std::string const thirtyTwo{"@ 32"};
 
 
+namespace
+{
+
+/// @returns the function definitions in @a _ast such that every function that is not
+/// recursive comes before all functions calling it.
+std::vector<FunctionDefinition const*> functionsInCallOrder(CallGraph const& _callGraph, Block const& _ast)
+{
+	std::map<YulString, FunctionDefinition const*> functions = allFunctionDefinitions(_ast);
+	std::vector<FunctionDefinition const*> result;
+	std::set<YulString> visited;
+	auto visit = [&](YulString _function, auto&& _recurse) -> void {
+		if (!visited.insert(_function).second)
+			return;
+		if (auto const* callees = util::valueOrNullptr(_callGraph.functionCalls, _function))
+			for (YulString callee: *callees)
+				_recurse(callee, _recurse);
+		if (FunctionDefinition const* const* function = util::valueOrNullptr(functions, _function))
+			result.emplace_back(*function);
+	};
+	for (auto const& function: functions)
+		visit(function.first, visit);
+	return result;
+}
+
+}
+
 void UnusedStoreEliminator::run(OptimiserStepContext& _context, Block& _ast)
 {
+	CallGraph const callGraph = CallGraphGenerator::callGraph(_ast);
 	std::map<YulString, SideEffects> functionSideEffects = SideEffectsPropagator::sideEffects(
 		_context.dialect,
-		CallGraphGenerator::callGraph(_ast)
+		callGraph
 	);
 
 	SSAValueTracker ssaValues;
@@ -68,14 +96,40 @@ void UnusedStoreEliminator::run(OptimiserStepContext& _context, Block& _ast)
 	values[YulString{one}] = AssignedValue{&oneLiteral, {}};
 	values[YulString{thirtyTwo}] = AssignedValue{&thirtyTwoLiteral, {}};
 
+	// The slots read by functions are referred to by special constants as well.
+	std::list<Expression> slotLiterals;
+	std::map<YulString, std::vector<YulString>> functionStorageReads;
+	for (auto const& [function, slots]: StorageAccessPropagator::readSlots(_context.dialect, _ast))
+	{
+		if (slots.size() > c_maxSlotsReadByFunction)
+			continue;
+		std::vector<YulString>& slotNames = functionStorageReads[function];
+		for (u256 const& slot: slots)
+		{
+			YulString slotName{"@ " + slot.str()};
+			if (!values.count(slotName))
+				values[slotName] = AssignedValue{
+					&slotLiterals.emplace_back(Literal{{}, LiteralKind::Number, YulString{slot.str()}, {}}),
+					{}
+				};
+			slotNames.emplace_back(slotName);
+		}
+	}
+
 	bool const ignoreMemory = MSizeFinder::containsMSize(_context.dialect, _ast);
 	UnusedStoreEliminator rse{
 		_context.dialect,
 		functionSideEffects,
 		ControlFlowSideEffectsCollector{_context.dialect, _ast}.functionSideEffectsNamed(),
 		values,
-		ignoreMemory
+		ignoreMemory,
+		std::move(functionStorageReads),
+		callGraph.recursiveFunctions()
 	};
+	// Functions are visited before their callers, so that the stores still undecided
+	// at the end of a function are known at its calls.
+	for (FunctionDefinition const* function: functionsInCallOrder(callGraph, _ast))
+		rse(*function);
 	rse(_ast);
 
 	auto evmDialect = dynamic_cast<EVMDialect const*>(&_context.dialect);
@@ -84,9 +138,14 @@ void UnusedStoreEliminator::run(OptimiserStepContext& _context, Block& _ast)
 	else
 		rse.markActiveAsUsed(Location::Memory);
 	rse.markActiveAsUsed(Location::Storage);
+	rse.markActiveAsUsed(Location::TransientStorage);
 	rse.m_storesToRemove += rse.m_allStores - rse.m_usedStores;
+	rse.m_usedByCallers += rse.m_usedStores;
 
-	std::set<Statement const*> toRemove{rse.m_storesToRemove.begin(), rse.m_storesToRemove.end()};
+	std::set<Statement const*> toRemove;
+	for (Statement const* store: rse.m_storesToRemove)
+		if (!rse.m_usedByCallers.count(store))
+			toRemove.insert(store);
 	StatementRemover remover{toRemove};
 	remover(_ast);
 }
@@ -96,13 +155,17 @@ UnusedStoreEliminator::UnusedStoreEliminator(
 	std::map<YulString, SideEffects> const& _functionSideEffects,
 	std::map<YulString, ControlFlowSideEffects> _controlFlowSideEffects,
 	std::map<YulString, AssignedValue> const& _ssaValues,
-	bool _ignoreMemory
+	bool _ignoreMemory,
+	std::map<YulString, std::vector<YulString>> _functionStorageReads,
+	std::set<YulString> _recursiveFunctions
 ):
 	UnusedStoreBase(_dialect),
 	m_ignoreMemory(_ignoreMemory),
 	m_functionSideEffects(_functionSideEffects),
 	m_controlFlowSideEffects(_controlFlowSideEffects),
 	m_ssaValues(_ssaValues),
+	m_functionStorageReads(std::move(_functionStorageReads)),
+	m_recursiveFunctions(std::move(_recursiveFunctions)),
 	m_knowledgeBase(_ssaValues)
 {}
 
@@ -120,21 +183,60 @@ void UnusedStoreEliminator::operator()(FunctionCall const& _functionCall)
 		sideEffects = m_controlFlowSideEffects.at(_functionCall.functionName.name);
 
 	if (sideEffects.canTerminate)
+	{
 		markActiveAsUsed(Location::Storage);
+		markActiveAsUsed(Location::TransientStorage);
+	}
 	if (!sideEffects.canContinue)
 	{
 		clearActive(Location::Memory);
 		if (!sideEffects.canTerminate)
+		{
 			clearActive(Location::Storage);
+			clearActive(Location::TransientStorage);
+		}
 	}
+	else if (auto const* stores = util::valueOrNullptr(m_storesActiveAtFunctionEnd, _functionCall.functionName.name))
+		// The stores of the function that were undecided at its end are decided here.
+		for (auto const& [statement, operation]: *stores)
+		{
+			m_storeOperations[statement] = operation;
+			activeStorageStores().insert(statement);
+		}
 }
 
 void UnusedStoreEliminator::operator()(FunctionDefinition const& _functionDefinition)
 {
+	if (!m_visitedFunctions.insert(&_functionDefinition).second)
+		return;
 	ScopedSaveAndRestore storeOperations(m_storeOperations, {});
 	UnusedStoreBase::operator()(_functionDefinition);
 }
 
+void UnusedStoreEliminator::finalizeFunctionDefinition(FunctionDefinition const& _functionDefinition)
+{
+	if (!m_recursiveFunctions.count(_functionDefinition.name))
+	{
+		// Stores to constant storage slots are only affected by the code after the call,
+		// independent of the arguments of the call.
+		std::vector<std::pair<Statement const*, Operation>>& stores = m_storesActiveAtFunctionEnd[_functionDefinition.name];
+		for (Statement const* statement: activeStorageStores())
+		{
+			Operation const& operation = m_storeOperations.at(statement);
+			if (
+				stores.size() < c_maxStoresActiveAtFunctionEnd &&
+				operation.start &&
+				m_knowledgeBase.valueIfKnownConstant(*operation.start)
+			)
+				stores.emplace_back(statement, operation);
+		}
+		for (auto const& store: stores)
+			activeStorageStores().erase(store.first);
+	}
+	markActiveAsUsed();
+	m_usedByCallers += m_usedStores;
+}
+
 
 void UnusedStoreEliminator::operator()(Leave const&)
 {
@@ -167,6 +269,7 @@ void UnusedStoreEliminator::visit(Statement const& _statement)
 	// This way the assert below should be triggered on any change.
 	using evmasm::SemanticInformation;
 	bool isStorageWrite = (*instruction == Instruction::SSTORE);
+	bool isTransientStorageWrite = (*instruction == Instruction::TSTORE);
 	bool isMemoryWrite =
 		*instruction == Instruction::EXTCODECOPY ||
 		*instruction == Instruction::CODECOPY ||
@@ -180,9 +283,10 @@ void UnusedStoreEliminator::visit(Statement const& _statement)
 		*instruction != Instruction::MCOPY &&
 		SemanticInformation::otherState(*instruction) != SemanticInformation::Write && (
 			SemanticInformation::storage(*instruction) == SemanticInformation::Write ||
+			SemanticInformation::transientStorage(*instruction) == SemanticInformation::Write ||
 			(!m_ignoreMemory && SemanticInformation::memory(*instruction) == SemanticInformation::Write)
 		);
-	yulAssert(isCandidateForRemoval == (isStorageWrite || (!m_ignoreMemory && isMemoryWrite)));
+	yulAssert(isCandidateForRemoval == (isStorageWrite || isTransientStorageWrite || (!m_ignoreMemory && isMemoryWrite)));
 	if (isCandidateForRemoval)
 	{
 		if (*instruction == Instruction::RETURNDATACOPY)
@@ -211,13 +315,7 @@ void UnusedStoreEliminator::visit(Statement const& _statement)
 		m_allStores.insert(&_statement);
 		std::vector<Operation> operations = operationsFromFunctionCall(*funCall);
 		yulAssert(operations.size() == 1, "");
-		if (operations.front().location == Location::Storage)
-			activeStorageStores().insert(&_statement);
-		else
-		{
-			yulAssert(operations.front().location == Location::Memory, "");
-			activeMemoryStores().insert(&_statement);
-		}
+		activeStores(operations.front().location).insert(&_statement);
 		m_storeOperations[&_statement] = std::move(operations.front());
 	}
 }
@@ -242,8 +340,16 @@ std::vector<UnusedStoreEliminator::Operation> UnusedStoreEliminator::operationsF
 		// Unknown read is worse than unknown write.
 		if (sideEffects.memory != SideEffects::Effect::None)
 			result.emplace_back(Operation{Location::Memory, Effect::Read, {}, {}});
+		if (sideEffects.transientStorage != SideEffects::Effect::None)
+			result.emplace_back(Operation{Location::TransientStorage, Effect::Read, {}, {}});
 		if (sideEffects.storage != SideEffects::Effect::None)
-			result.emplace_back(Operation{Location::Storage, Effect::Read, {}, {}});
+		{
+			if (auto const* slots = util::valueOrNullptr(m_functionStorageReads, functionName))
+				for (YulString slot: *slots)
+					result.emplace_back(Operation{Location::Storage, Effect::Read, slot, YulString(one)});
+			else
+				result.emplace_back(Operation{Location::Storage, Effect::Read, {}, {}});
+		}
 		return result;
 	}
 
@@ -274,11 +380,7 @@ std::vector<UnusedStoreEliminator::Operation> UnusedStoreEliminator::operationsF
 
 void UnusedStoreEliminator::applyOperation(UnusedStoreEliminator::Operation const& _operation)
 {
-	std::set<Statement const*>& active =
-		_operation.location == Location::Storage ?
-		activeStorageStores() :
-		activeMemoryStores();
-
+	std::set<Statement const*>& active = activeStores(_operation.location);
 
 	for (auto it = active.begin(); it != active.end();)
 	{
@@ -305,7 +407,7 @@ bool UnusedStoreEliminator::knownUnrelated(
 {
 	if (_op1.location != _op2.location)
 		return true;
-	if (_op1.location == Location::Storage)
+	if (_op1.location == Location::Storage || _op1.location == Location::TransientStorage)
 	{
 		if (_op1.start && _op2.start)
 		{
@@ -380,6 +482,9 @@ bool UnusedStoreEliminator::knownCovered(
 		(_covered.length && _covered.length == _covering.length)
 	)
 		return true;
+	if (_covered.location != Location::Memory && _covered.start && _covering.start)
+		if (m_knowledgeBase.differenceIfKnownConstant(*_covered.start, *_covering.start) == u256(0))
+			return true;
 	if (_covered.location == Location::Memory)
 	{
 		if (_covered.length && m_knowledgeBase.knownToBeZero(*_covered.length))
@@ -422,6 +527,9 @@ void UnusedStoreEliminator::markActiveAsUsed(
 	if (_onlyLocation == std::nullopt || _onlyLocation == Location::Storage)
 		for (Statement const* statement: activeStorageStores())
 			m_usedStores.insert(statement);
+	if (_onlyLocation == std::nullopt || _onlyLocation == Location::TransientStorage)
+		for (Statement const* statement: activeTransientStorageStores())
+			m_usedStores.insert(statement);
 	clearActive(_onlyLocation);
 }
 
@@ -433,6 +541,8 @@ void UnusedStoreEliminator::clearActive(
 		activeMemoryStores() = {};
 	if (_onlyLocation == std::nullopt || _onlyLocation == Location::Storage)
 		activeStorageStores() = {};
+	if (_onlyLocation == std::nullopt || _onlyLocation == Location::TransientStorage)
+		activeTransientStorageStores() = {};
 }
 
 std::optional<YulString> UnusedStoreEliminator::identifierNameIfSSA(Expression const& _expression) const
@@ -31,6 +31,8 @@
 
 #include <libevmasm/SemanticInformation.h>
 
+#include <libsolutil/Assertions.h>
+
 #include <map>
 #include <vector>
 
@@ -40,7 +42,7 @@ struct Dialect;
 struct AssignedValue;
 
 /**
- * Optimizer component that removes sstore and memory store statements if conditions are met for their removal.
+ * Optimizer component that removes sstore, tstore and memory store statements if conditions are met for their removal.
  * In case of an sstore, if all outgoing code paths revert (due to an explicit revert(), invalid(),
  * or infinite recursion) or lead to another ``sstore`` for which the optimizer can tell that it will overwrite the first store,
  * the statement will be removed.
@@ -50,7 +52,18 @@ struct AssignedValue;
  * to sstore, as we don't know whether the memory location will be read once we leave the function's scope,
  * so the statement will be removed only if all code code paths lead to a memory overwrite.
  *
- * The m_store member of UnusedStoreBase uses the key "m" for memory and "s" for storage stores.
+ * Functions are analysed before the functions calling them. Stores to constant storage slots that
+ * are still undecided at the end of a non-recursive function are decided at the calls of the function,
+ * i.e. they are removed if every caller overwrites them before reading them. At a call,
+ * only the constant storage slots read by the called function, if known, count as reads.
+ * The number of such stores and slots per function is limited to bound the runtime.
+ *
+ * Stores to transient storage (``tstore``) are treated like stores to storage: the value remains
+ * visible to later calls in the same transaction, so they are only removed if all outgoing
+ * code paths revert or overwrite them.
+ *
+ * The m_store member of UnusedStoreBase uses the key "m" for memory, "s" for storage and "t" for
+ * transient storage stores.
  *
  * Best run in SSA form.
  *
@@ -67,7 +80,9 @@ public:
 		std::map<YulString, SideEffects> const& _functionSideEffects,
 		std::map<YulString, ControlFlowSideEffects> _controlFlowSideEffects,
 		std::map<YulString, AssignedValue> const& _ssaValues,
-		bool _ignoreMemory
+		bool _ignoreMemory,
+		std::map<YulString, std::vector<YulString>> _functionStorageReads = {},
+		std::set<YulString> _recursiveFunctions = {}
 	);
 
 	using UnusedStoreBase::operator();
@@ -94,16 +109,24 @@ public:
 private:
 	std::set<Statement const*>& activeMemoryStores() { return m_activeStores["m"_yulstring]; }
 	std::set<Statement const*>& activeStorageStores() { return m_activeStores["s"_yulstring]; }
+	std::set<Statement const*>& activeTransientStorageStores() { return m_activeStores["t"_yulstring]; }
+	std::set<Statement const*>& activeStores(Location _location)
+	{
+		switch (_location)
+		{
+		case Location::Memory: return activeMemoryStores();
+		case Location::Storage: return activeStorageStores();
+		case Location::TransientStorage: return activeTransientStorageStores();
+		}
+		util::unreachable();
+	}
 
 	void shortcutNestedLoop(ActiveStores const&) override
 	{
 		// We might only need to do this for newly introduced stores in the loop.
 		markActiveAsUsed();
 	}
-	void finalizeFunctionDefinition(FunctionDefinition const&) override
-	{
-		markActiveAsUsed();
-	}
+	void finalizeFunctionDefinition(FunctionDefinition const& _functionDefinition) override;
 
 	std::vector<Operation> operationsFromFunctionCall(FunctionCall const& _functionCall) const;
 	void applyOperation(Operation const& _operation);
@@ -115,12 +138,29 @@ private:
 
 	std::optional<YulString> identifierNameIfSSA(Expression const& _expression) const;
 
+	/// Maximum number of stores per function that are decided at the calls of the function.
+	static size_t constexpr c_maxStoresActiveAtFunctionEnd = 16;
+	/// Maximum number of storage slots read by a function that are tracked individually.
+	static size_t constexpr c_maxSlotsReadByFunction = 32;
+
 	bool const m_ignoreMemory;
 	std::map<YulString, SideEffects> const& m_functionSideEffects;
 	std::map<YulString, ControlFlowSideEffects> m_controlFlowSideEffects;
 	std::map<YulString, AssignedValue> const& m_ssaValues;
 
 	std::map<Statement const*, Operation> m_storeOperations;
+	/// Names of the constant storage slots read by user-defined functions. Functions whose
+	/// read slots are not known are not contained.
+	std::map<YulString, std::vector<YulString>> m_functionStorageReads;
+	/// Functions that can be called while they are executing. Their stores are decided
+	/// at the end of the function.
+	std::set<YulString> m_recursiveFunctions;
+	/// Stores that are still undecided at the end of the respective function, together
+	/// with their operations.
+	std::map<YulString, std::vector<std::pair<Statement const*, Operation>>> m_storesActiveAtFunctionEnd;
+	/// Stores of called functions that were used in the caller.
+	std::set<Statement const*> m_usedByCallers;
+	std::set<FunctionDefinition const*> m_visitedFunctions;
 
 	KnowledgeBase mutable m_knowledgeBase;
 };
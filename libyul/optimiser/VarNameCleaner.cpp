@@ -26,7 +26,6 @@
 #include <climits>
 #include <iterator>
 #include <string>
-#include <regex>
 #include <limits>
 
 using namespace solidity::yul;
@@ -55,6 +54,8 @@ void VarNameCleaner::operator()(FunctionDefinition& _funDef)
 	m_usedNames = m_namesToKeep;
 	std::map<YulString, YulString> globalTranslatedNames;
 	swap(globalTranslatedNames, m_translatedNames);
+	std::map<YulString, size_t> globalNextSuffix;
+	swap(globalNextSuffix, m_nextSuffix);
 
 	renameVariables(_funDef.parameters);
 	renameVariables(_funDef.returnVariables);
@@ -62,6 +63,7 @@ void VarNameCleaner::operator()(FunctionDefinition& _funDef)
 
 	swap(globalUsedNames, m_usedNames);
 	swap(globalTranslatedNames, m_translatedNames);
+	swap(globalNextSuffix, m_nextSuffix);
 
 	m_insideFunction = false;
 }
@@ -93,18 +95,23 @@ void VarNameCleaner::operator()(Identifier& _identifier)
 		_identifier.name = name->second;
 }
 
-YulString VarNameCleaner::findCleanName(YulString const& _name) const
+YulString VarNameCleaner::findCleanName(YulString const& _name)
 {
 	auto newName = stripSuffix(_name);
 	if (!isUsedName(newName))
 		return newName;
 
 	// create new name with suffix (by finding a free identifier)
-	for (size_t i = 1; i < std::numeric_limits<decltype(i)>::max(); ++i)
+	size_t& nextSuffix = m_nextSuffix.try_emplace(newName, 1).first->second;
+	std::string newNameSuffixed = newName.str() + "_";
+	size_t const prefixLength = newNameSuffixed.size();
+	for (; nextSuffix < std::numeric_limits<size_t>::max(); ++nextSuffix)
 	{
-		YulString newNameSuffixed = YulString{newName.str() + "_" + std::to_string(i)};
-		if (!isUsedName(newNameSuffixed))
-			return newNameSuffixed;
+		newNameSuffixed.resize(prefixLength);
+		newNameSuffixed += std::to_string(nextSuffix);
+		YulString candidate{newNameSuffixed};
+		if (!isUsedName(candidate))
+			return candidate;
 	}
 	yulAssert(false, "Exhausted by attempting to find an available suffix.");
 }
@@ -116,10 +123,22 @@ bool VarNameCleaner::isUsedName(YulString const& _name) const
 
 YulString VarNameCleaner::stripSuffix(YulString const& _name) const
 {
-	static std::regex const suffixRegex("(_+[0-9]+)+$");
-
-	std::smatch suffixMatch;
-	if (regex_search(_name.str(), suffixMatch, suffixRegex))
-		return {YulString{suffixMatch.prefix().str()}};
-	return _name;
+	// Removes the longest suffix matching the regular expression "(_+[0-9]+)+$".
+	std::string const& name = _name.str();
+	size_t end = name.size();
+	while (true)
+	{
+		size_t digitsStart = end;
+		while (digitsStart > 0 && std::isdigit(static_cast<unsigned char>(name[digitsStart - 1])))
+			--digitsStart;
+		size_t underscoresStart = digitsStart;
+		while (underscoresStart > 0 && name[underscoresStart - 1] == '_')
+			--underscoresStart;
+		if (digitsStart == end || underscoresStart == digitsStart)
+			break;
+		end = underscoresStart;
+	}
+	if (end == name.size())
+		return _name;
+	return YulString{name.substr(0, end)};
 }
@@ -75,7 +75,7 @@ private:
 
 	/// Looks out for a "clean name" the given @p name could be trimmed down to.
 	/// @returns a trimmed down and "clean name" in case it found one, none otherwise.
-	YulString findCleanName(YulString const& name) const;
+	YulString findCleanName(YulString const& name);
 
 	/// Tests whether a given name was already used within this pass
 	/// or was set to be kept.
@@ -92,6 +92,10 @@ private:
 	/// Maps old to new names.
 	std::map<YulString, YulString> m_translatedNames;
 
+	/// Smallest suffix that might still be free for each suffix-stripped name. Since names are
+	/// never removed from m_usedNames, the suffixes below it do not have to be tried again.
+	std::map<YulString, size_t> m_nextSuffix;
+
 	/// Whether the traverse is inside a function definition.
 	/// Used to assert that a function definition cannot be inside another.
 	bool m_insideFunction = false;
@@ -0,0 +1,61 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Dense numbering of a set of Yul variables.
+ */
+
+#pragma once
+
+#include <libyul/YulString.h>
+
+#include <cstddef>
+#include <optional>
+#include <set>
+#include <unordered_map>
+
+namespace solidity::yul
+{
+
+/**
+ * Assigns the indices 0, 1, ..., size() - 1 to a set of variables, so that analyses that keep
+ * information per variable can store it in vectors and bitsets indexed by these numbers
+ * instead of in maps keyed by the variable names.
+ *
+ * Variables are numbered in the order in which they occur in the given set.
+ */
+class VariableNumbering
+{
+public:
+	explicit VariableNumbering(std::set<YulString> const& _variables);
+
+	/// @returns the number of variables.
+	size_t size() const { return m_indices.size(); }
+	/// @returns the index of @a _variable or nullopt if it is not part of the numbering.
+	std::optional<size_t> index(YulString _variable) const
+	{
+		auto it = m_indices.find(_variable);
+		if (it == m_indices.end())
+			return std::nullopt;
+		return it->second;
+	}
+
+private:
+	std::unordered_map<YulString, size_t> m_indices;
+};
+
+}
@@ -0,0 +1,134 @@
+#!/usr/bin/env python3
+
+"""
+Runs soltest in several processes in parallel, each executing one shard of the tests (see the
+--shard option of soltest), and merges their JUnit reports into a single one.
+
+Usage:
+    scripts/soltest_shards.py [--jobs N] [--soltest PATH] [--output FILE] [-- SOLTEST_ARGS...]
+    scripts/soltest_shards.py --merge-only --output FILE REPORT...
+"""
+
+from argparse import ArgumentParser, REMAINDER
+from pathlib import Path
+import os
+import subprocess
+import sys
+import tempfile
+import xml.etree.ElementTree as ET
+
+PROJECT_ROOT = Path(__file__).parents[1]
+COUNTED_ATTRIBUTES = ['tests', 'failures', 'errors', 'skipped']
+
+
+def test_suites(report_path: Path) -> list:
+    root = ET.parse(report_path).getroot()
+    return [root] if root.tag == 'testsuite' else root.findall('testsuite')
+
+
+def merge_reports(report_paths: list, output_path: Path) -> dict:
+    merged = ET.Element('testsuites')
+    totals = {attribute: 0 for attribute in COUNTED_ATTRIBUTES}
+    time = 0.0
+    failed_tests = []
+
+    for index, report_path in enumerate(report_paths):
+        for suite in test_suites(report_path):
+            suite.set('name', f"{suite.get('name', 'SolidityTests')} (shard {index + 1}/{len(report_paths)})")
+            for attribute in COUNTED_ATTRIBUTES:
+                totals[attribute] += int(suite.get(attribute, '0'))
+            time += float(suite.get('time', '0'))
+            for test_case in suite.iter('testcase'):
+                if test_case.find('failure') is not None or test_case.find('error') is not None:
+                    failed_tests.append(f"{test_case.get('classname', '')}/{test_case.get('name', '')}")
+            merged.append(suite)
+
+    for attribute, value in totals.items():
+        merged.set(attribute, str(value))
+    merged.set('time', f"{time:.3f}")
+    ET.ElementTree(merged).write(output_path, encoding='utf-8', xml_declaration=True)
+
+    totals['failed_tests'] = failed_tests
+    return totals
+
+
+def run_shards(soltest: Path, jobs: int, soltest_args: list, report_dir: Path) -> tuple:
+    processes = []
+    for shard in range(1, jobs + 1):
+        log_path = report_dir / f'shard_{shard}.log'
+        report_path = report_dir / f'shard_{shard}.xml'
+        command = [
+            str(soltest),
+            '--color_output=no',
+            f'--logger=JUNIT,error,{report_path}',
+            '--logger=HRF,error,stdout',
+            '--',
+            *soltest_args,
+            f'--shard={shard}/{jobs}',
+        ]
+        with open(log_path, 'w', encoding='utf-8') as log_file:
+            processes.append((
+                subprocess.Popen(command, stdout=log_file, stderr=subprocess.STDOUT),
+                log_path,
+                report_path,
+            ))
+
+    report_paths = []
+    success = True
+    for shard, (process, log_path, report_path) in enumerate(processes, start=1):
+        if process.wait() != 0:
+            success = False
+            print(f"Shard {shard}/{jobs} failed with exit code {process.returncode}:")
+            print(log_path.read_text(encoding='utf-8'))
+        if report_path.exists():
+            report_paths.append(report_path)
+        else:
+            success = False
+            print(f"Shard {shard}/{jobs} did not produce a report.")
+    return success, report_paths
+
+
+def main():
+    parser = ArgumentParser(description="Run soltest in parallel shards and merge their JUnit reports.")
+    parser.add_argument('--jobs', type=int, default=os.cpu_count(), help="Number of shards to run in parallel.")
+    parser.add_argument(
+        '--soltest',
+        type=Path,
+        default=PROJECT_ROOT / 'build' / 'test' / 'soltest',
+        help="Path to the soltest executable."
+    )
+    parser.add_argument('--output', type=Path, default=Path('soltest_report.xml'), help="Path of the merged report.")
+    parser.add_argument(
+        '--merge-only',
+        action='store_true',
+        help="Do not run soltest, only merge the JUnit reports given as arguments."
+    )
+    parser.add_argument('arguments', nargs=REMAINDER, help="Arguments passed to soltest or reports to merge.")
+    options = parser.parse_args()
+
+    arguments = options.arguments[1:] if options.arguments[:1] == ['--'] else options.arguments
+    if options.merge_only:
+        success = True
+        report_paths = [Path(argument) for argument in arguments]
+        if len(report_paths) == 0:
+            parser.error("No reports to merge.")
+        totals = merge_reports(report_paths, options.output)
+    else:
+        if options.jobs < 1:
+            parser.error("The number of jobs must be at least 1.")
+        with tempfile.TemporaryDirectory(prefix='soltest-shards-') as report_dir:
+            success, report_paths = run_shards(options.soltest, options.jobs, arguments, Path(report_dir))
+            totals = merge_reports(report_paths, options.output)
+
+    print(
+        f"{totals['tests']} tests, {totals['failures']} failures, {totals['errors']} errors, "
+        f"{totals['skipped']} skipped. Merged report written to {options.output}."
+    )
+    for test in totals['failed_tests']:
+        print(f"FAILED: {test}")
+
+    return 0 if success and not totals['failed_tests'] else 1
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -54,6 +54,7 @@
 #include <libsolutil/CommonData.h>
 #include <libsolutil/CommonIO.h>
 #include <libsolutil/JSON.h>
+#include <libsolutil/Parallel.h>
 
 #include <algorithm>
 #include <fstream>
@@ -308,6 +309,31 @@ void CommandLineInterface::handleIROptimized(std::string const& _contractName)
 	}
 }
 
+void CommandLineInterface::handleOptimizerProfile(std::string const& _contractName)
+{
+	solAssert(CompilerInputModes.count(m_options.input.mode) == 1);
+
+	if (!m_options.compiler.outputs.optimizerProfile)
+		return;
+
+	if (!m_options.output.dir.empty())
+		createFile(
+			m_compiler->filesystemFriendlyName(_contractName) + "_optimizer_profile.json",
+			util::jsonPrint(
+				m_compiler->yulIROptimizerProfile(_contractName),
+				m_options.formatting.json
+			)
+		);
+	else
+	{
+		sout() << "Optimizer profile:" << std::endl;
+		sout() << util::jsonPrint(
+			m_compiler->yulIROptimizerProfile(_contractName),
+			m_options.formatting.json
+		) << std::endl;
+	}
+}
+
 void CommandLineInterface::handleIROptimizedAst(std::string const& _contractName)
 {
 	solAssert(CompilerInputModes.count(m_options.input.mode) == 1);
@@ -353,7 +379,7 @@ void CommandLineInterface::handleSignatureHashes(std::string const& _contract)
 	if (!m_options.compiler.outputs.signatureHashes)
 		return;
 
-	Json interfaceSymbols = m_compiler->interfaceSymbols(_contract);
+	Json const& interfaceSymbols = m_compiler->interfaceSymbols(_contract);
 	std::string out = "Function signatures:\n";
 	for (auto const& [name, value]: interfaceSymbols["methods"].items())
 		out += value.get<std::string>() + ": " + name + "\n";
@@ -607,6 +633,7 @@ void CommandLineInterface::readInputFiles()
 
 	if (
 		m_options.input.mode != InputMode::LanguageServer &&
+		!m_options.input.server &&
 		m_fileReader.sourceUnits().empty() &&
 		!m_standardJsonInput.has_value()
 	)
@@ -626,15 +653,19 @@ std::map<std::string, Json> CommandLineInterface::parseAstFromInput()
 		astAssert(jsonParseStrict(sourceCode, ast), "Input file could not be parsed to JSON");
 		astAssert(ast.contains("sources"), "Invalid Format for import-JSON: Must have 'sources'-object");
 
-		for (auto const& [src, value]: ast["sources"].items())
+		// Every source of the file gets the complete file as its content, so it is only printed once.
+		std::string const compactSource = util::jsonCompactPrint(ast);
+		for (auto const& item: ast["sources"].items())
 		{
+			std::string const& src = item.key();
+			Json& value = item.value();
 			std::string astKey = value.contains("ast") ? "ast" : "AST";
 
-			astAssert(ast["sources"][src].contains(astKey), "astkey is not member");
-			astAssert(ast["sources"][src][astKey]["nodeType"].get<std::string>() == "SourceUnit",  "Top-level node should be a 'SourceUnit'");
+			astAssert(value.contains(astKey), "astkey is not member");
+			astAssert(value[astKey]["nodeType"].get<std::string>() == "SourceUnit",  "Top-level node should be a 'SourceUnit'");
 			astAssert(sourceJsons.count(src) == 0, "All sources must have unique names");
 			sourceJsons.emplace(src, std::move(value[astKey]));
-			tmpSources[src] = util::jsonCompactPrint(ast);
+			tmpSources[src] = compactSource;
 		}
 	}
 
@@ -649,19 +680,40 @@ void CommandLineInterface::createFile(std::string const& _fileName, std::string
 
 	solAssert(!m_options.output.dir.empty());
 
-	// NOTE: create_directories() raises an exception if the path consists solely of '.' or '..'
-	// (or equivalent such as './././.'). Paths like 'a/b/.' and 'a/b/..' are fine though.
-	// The simplest workaround is to use an absolute path.
-	fs::create_directories(fs::absolute(m_options.output.dir));
-
 	std::string pathName = (m_options.output.dir / _fileName).string();
-	if (fs::exists(pathName) && !m_options.output.overwriteFiles)
+	auto pendingFile = std::find_if(
+		m_pendingFiles.begin(),
+		m_pendingFiles.end(),
+		[&](auto const& _file) { return _file.first == pathName; }
+	);
+	if ((pendingFile != m_pendingFiles.end() || fs::exists(pathName)) && !m_options.output.overwriteFiles)
 		solThrow(CommandLineOutputError, "Refusing to overwrite existing file \"" + pathName + "\" (use --overwrite to force).");
 
-	std::ofstream outFile(pathName);
-	outFile << _data;
-	if (!outFile)
-		solThrow(CommandLineOutputError, "Could not write to file \"" + pathName + "\".");
+	if (pendingFile != m_pendingFiles.end())
+		pendingFile->second = _data;
+	else
+		m_pendingFiles.emplace_back(std::move(pathName), _data);
+}
+
+void CommandLineInterface::writePendingFiles()
+{
+	if (m_pendingFiles.empty())
+		return;
+
+	// NOTE: create_directories() raises an exception if the path consists solely of '.' or '..'
+	// (or equivalent such as './././.'). Paths like 'a/b/.' and 'a/b/..' are fine though.
+	// The simplest workaround is to use an absolute path.
+	boost::filesystem::create_directories(boost::filesystem::absolute(m_options.output.dir));
+
+	std::vector<std::pair<std::string, std::string>> files = std::move(m_pendingFiles);
+	m_pendingFiles.clear();
+	util::runInParallel(m_options.output.jobs, files.size(), [&](size_t _index) {
+		auto const& [pathName, data] = files[_index];
+		std::ofstream outFile(pathName);
+		outFile << data;
+		if (!outFile)
+			solThrow(CommandLineOutputError, "Could not write to file \"" + pathName + "\".");
+	});
 }
 
 void CommandLineInterface::createJson(std::string const& _fileName, std::string const& _json)
@@ -745,10 +797,16 @@ void CommandLineInterface::processInput()
 		break;
 	case InputMode::StandardJson:
 	{
+		if (m_options.input.server)
+		{
+			serveStandardJson();
+			break;
+		}
 		solAssert(m_standardJsonInput.has_value());
 
 		StandardCompiler compiler(m_universalCallback.callback(), m_options.formatting.json);
-		sout() << compiler.compile(std::move(m_standardJsonInput.value())) << std::endl;
+		compiler.compile(m_standardJsonInput.value(), sout());
+		sout() << std::endl;
 		m_standardJsonInput.reset();
 		break;
 	}
@@ -772,8 +830,10 @@ void CommandLineInterface::processInput()
 		handleCombinedJSON();
 		handleBytecode(m_assemblyStack->contractNames().front());
 		handleEVMAssembly(m_assemblyStack->contractNames().front());
+		writePendingFiles();
 		break;
 	}
+	solAssert(m_pendingFiles.empty());
 }
 
 void CommandLineInterface::printVersion()
@@ -838,6 +898,10 @@ void CommandLineInterface::compile()
 		m_compiler->setRemappings(m_options.input.remappings);
 		m_compiler->setLibraries(m_options.linker.libraries);
 		m_compiler->setViaIR(m_options.output.viaIR);
+		m_compiler->setParallelism(m_options.output.jobs);
+		m_compiler->setCacheDirectory(m_options.output.cacheDir);
+		m_solverCommand.setCacheDirectory(m_options.output.cacheDir);
+		m_solverCommand.setPersistentSessions(m_options.modelChecker.persistentSolvers);
 		m_compiler->setEVMVersion(m_options.output.evmVersion);
 		m_compiler->setEOFVersion(m_options.output.eofVersion);
 		m_compiler->setRevertStringBehaviour(m_options.output.revertStrings);
@@ -848,8 +912,10 @@ void CommandLineInterface::compile()
 			m_options.compiler.outputs.ir ||
 			m_options.compiler.outputs.irOptimized ||
 			m_options.compiler.outputs.irAstJson ||
-			m_options.compiler.outputs.irOptimizedAstJson
+			m_options.compiler.outputs.irOptimizedAstJson ||
+			m_options.compiler.outputs.optimizerProfile
 		);
+		m_compiler->enableOptimizerProfiling(m_options.compiler.outputs.optimizerProfile);
 		m_compiler->enableEvmBytecodeGeneration(
 			m_options.compiler.estimateGas ||
 			m_options.compiler.outputs.asm_ ||
@@ -1075,6 +1141,26 @@ void CommandLineInterface::handleAst()
 	}
 }
 
+void CommandLineInterface::serveStandardJson()
+{
+	solAssert(m_options.input.server);
+	solAssert(m_options.formatting.json.format == JsonFormat::Compact);
+
+	// The compiler and its global state are kept for all inputs.
+	StandardCompiler compiler(m_universalCallback.callback(), m_options.formatting.json);
+	std::string input;
+	while (std::getline(m_sin, input))
+	{
+		if (boost::trim_copy(input).empty())
+			continue;
+
+		// Files loaded by the import callback for one input must not be visible to the next one.
+		m_fileReader.setSourceUnits({});
+		compiler.compile(input, sout());
+		sout() << std::endl;
+	}
+}
+
 void CommandLineInterface::serveLSP()
 {
 	lsp::StdioTransport transport;
@@ -1200,6 +1286,9 @@ void CommandLineInterface::assembleYul(yul::YulStack::Language _language, yul::Y
 				DebugInfoSelection::Default()
 		);
 
+		stack.setParallelism(m_options.output.jobs);
+		stack.enableOptimizerProfiling(m_options.compiler.outputs.optimizerProfile);
+
 		if (!stack.parseAndAnalyze(src.first, src.second))
 			successful = false;
 		else
@@ -1259,6 +1348,11 @@ void CommandLineInterface::assembleYul(yul::YulStack::Language _language, yul::Y
 			sout() << "AST:" << std::endl << std::endl;
 			sout() << util::jsonPrint(stack.astJson(), m_options.formatting.json) << std::endl;
 		}
+		if (m_options.compiler.outputs.optimizerProfile)
+		{
+			sout() << std::endl << "Optimizer profile:" << std::endl;
+			sout() << util::jsonPrint(stack.optimizerProfilesJson(), m_options.formatting.json) << std::endl;
+		}
 		solAssert(_targetMachine == yul::YulStack::Machine::EVM, "");
 		if (m_options.compiler.outputs.asm_)
 		{
@@ -1303,6 +1397,7 @@ void CommandLineInterface::outputCompilationResults()
 			handleIRAst(contract);
 			handleIROptimized(contract);
 			handleIROptimizedAst(contract);
+			handleOptimizerProfile(contract);
 			handleSignatureHashes(contract);
 			handleMetadata(contract);
 			handleABI(contract);
@@ -1312,6 +1407,8 @@ void CommandLineInterface::outputCompilationResults()
 		} // end of contracts iteration
 	}
 
+	writePendingFiles();
+
 	if (!m_hasOutput)
 	{
 		if (!m_options.output.dir.empty())
@@ -36,6 +36,8 @@
 #include <iostream>
 #include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace solidity::frontend
 {
@@ -88,6 +90,8 @@ private:
 	void compile();
 	void assembleFromEVMAssemblyJSON();
 	void serveLSP();
+	/// Compiles the Standard JSON inputs on the lines of standard input until its end.
+	void serveStandardJson();
 	void link();
 	void writeLinkedFiles();
 	/// @returns the ``// <identifier> -> name`` hint for library placeholders.
@@ -108,6 +112,7 @@ private:
 	void handleIRAst(std::string const& _contract);
 	void handleIROptimized(std::string const& _contract);
 	void handleIROptimizedAst(std::string const& _contract);
+	void handleOptimizerProfile(std::string const& _contract);
 	void handleBytecode(std::string const& _contract);
 	void handleSignatureHashes(std::string const& _contract);
 	void handleMetadata(std::string const& _contract);
@@ -122,7 +127,7 @@ private:
 	/// or standard-json output
 	std::map<std::string, Json> parseAstFromInput();
 
-	/// Create a file in the given directory
+	/// Create a file in the given directory. The file is only written by writePendingFiles().
 	/// @arg _fileName the name of the file
 	/// @arg _data to be written
 	void createFile(std::string const& _fileName, std::string const& _data);
@@ -132,6 +137,10 @@ private:
 	/// @arg _json json string to be written
 	void createJson(std::string const& _fileName, std::string const& _json);
 
+	/// Writes the files requested via createFile(), distributing them over the number of
+	/// threads given by --jobs, so that slow file systems do not serialise the output.
+	void writePendingFiles();
+
 	/// Returns the stream that should receive normal output. Sets m_hasOutput to true if the
 	/// stream has ever been used unless @arg _markAsUsed is set to false.
 	std::ostream& sout(bool _markAsUsed = true);
@@ -146,6 +155,8 @@ private:
 	std::ostream& m_sout;
 	std::ostream& m_serr;
 	bool m_hasOutput = false;
+	/// Paths and contents of the files created by createFile() that were not written yet.
+	std::vector<std::pair<std::string, std::string>> m_pendingFiles;
 	FileReader m_fileReader;
 	SMTSolverCommand m_solverCommand;
 	UniversalCallback m_universalCallback{&m_fileReader, m_solverCommand};
@@ -44,6 +44,7 @@ static std::string const g_strAllowPaths = "allow-paths";
 static std::string const g_strBasePath = "base-path";
 static std::string const g_strIncludePath = "include-path";
 static std::string const g_strAssemble = "assemble";
+static std::string const g_strCacheDir = "cache-dir";
 static std::string const g_strCombinedJson = "combined-json";
 static std::string const g_strEVM = "evm";
 static std::string const g_strEVMVersion = "evm-version";
@@ -59,6 +60,7 @@ static std::string const g_strYul = "yul";
 static std::string const g_strYulDialect = "yul-dialect";
 static std::string const g_strDebugInfo = "debug-info";
 static std::string const g_strIPFS = "ipfs";
+static std::string const g_strJobs = "jobs";
 static std::string const g_strLicense = "license";
 static std::string const g_strLibraries = "libraries";
 static std::string const g_strLink = "link";
@@ -72,12 +74,16 @@ static std::string const g_strModelCheckerDivModNoSlacks = "model-checker-div-mo
 static std::string const g_strModelCheckerEngine = "model-checker-engine";
 static std::string const g_strModelCheckerExtCalls = "model-checker-ext-calls";
 static std::string const g_strModelCheckerInvariants = "model-checker-invariants";
+static std::string const g_strModelCheckerParallelQueries = "model-checker-parallel-queries";
+static std::string const g_strModelCheckerPersistentSolvers = "model-checker-persistent-solvers";
 static std::string const g_strModelCheckerPrintQuery = "model-checker-print-query";
+static std::string const g_strModelCheckerRaceSolvers = "model-checker-race-solvers";
 static std::string const g_strModelCheckerShowProvedSafe = "model-checker-show-proved-safe";
 static std::string const g_strModelCheckerShowUnproved = "model-checker-show-unproved";
 static std::string const g_strModelCheckerShowUnsupported = "model-checker-show-unsupported";
 static std::string const g_strModelCheckerSolvers = "model-checker-solvers";
 static std::string const g_strModelCheckerTargets = "model-checker-targets";
+static std::string const g_strModelCheckerTimeBudget = "model-checker-time-budget";
 static std::string const g_strModelCheckerTimeout = "model-checker-timeout";
 static std::string const g_strModelCheckerBMCLoopIterations = "model-checker-bmc-loop-iterations";
 static std::string const g_strNone = "none";
@@ -85,6 +91,7 @@ static std::string const g_strNoOptimizeYul = "no-optimize-yul";
 static std::string const g_strNoImportCallback = "no-import-callback";
 static std::string const g_strOptimize = "optimize";
 static std::string const g_strOptimizeRuns = "optimize-runs";
+static std::string const g_strOptimizeTimeBudget = "optimize-time-budget";
 static std::string const g_strOptimizeYul = "optimize-yul";
 static std::string const g_strYulOptimizations = "yul-optimizations";
 static std::string const g_strOutputDir = "output-dir";
@@ -102,6 +109,7 @@ static std::set<std::string> const g_revertStringsArgs
 	revertStringsToString(RevertStrings::VerboseDebug)
 };
 
+static std::string const g_strServer = "server";
 static std::string const g_strSources = "sources";
 static std::string const g_strSourceList = "sourceList";
 static std::string const g_strStandardJSON = "standard-json";
@@ -231,10 +239,13 @@ bool CommandLineOptions::operator==(CommandLineOptions const& _other) const noex
 		input.allowedDirectories == _other.input.allowedDirectories &&
 		input.ignoreMissingFiles == _other.input.ignoreMissingFiles &&
 		input.noImportCallback == _other.input.noImportCallback &&
+		input.server == _other.input.server &&
 		output.dir == _other.output.dir &&
 		output.overwriteFiles == _other.output.overwriteFiles &&
 		output.evmVersion == _other.output.evmVersion &&
 		output.viaIR == _other.output.viaIR &&
+		output.jobs == _other.output.jobs &&
+		output.cacheDir == _other.output.cacheDir &&
 		output.revertStrings == _other.output.revertStrings &&
 		output.debugInfoSelection == _other.output.debugInfoSelection &&
 		output.stopAfter == _other.output.stopAfter &&
@@ -255,9 +266,11 @@ bool CommandLineOptions::operator==(CommandLineOptions const& _other) const noex
 		optimizer.optimizeEvmasm == _other.optimizer.optimizeEvmasm &&
 		optimizer.optimizeYul == _other.optimizer.optimizeYul &&
 		optimizer.expectedExecutionsPerDeployment == _other.optimizer.expectedExecutionsPerDeployment &&
+		optimizer.timeBudget == _other.optimizer.timeBudget &&
 		optimizer.yulSteps == _other.optimizer.yulSteps &&
 		modelChecker.initialize == _other.modelChecker.initialize &&
-		modelChecker.settings == _other.modelChecker.settings;
+		modelChecker.settings == _other.modelChecker.settings &&
+		modelChecker.persistentSolvers == _other.modelChecker.persistentSolvers;
 }
 
 OptimiserSettings CommandLineOptions::optimiserSettings() const
@@ -278,6 +291,9 @@ OptimiserSettings CommandLineOptions::optimiserSettings() const
 	if (optimizer.expectedExecutionsPerDeployment.has_value())
 		settings.expectedExecutionsPerDeployment = optimizer.expectedExecutionsPerDeployment.value();
 
+	if (optimizer.timeBudget.has_value())
+		settings.yulOptimiserTimeBudget = std::chrono::milliseconds(optimizer.timeBudget.value());
+
 	if (optimizer.yulSteps.has_value())
 	{
 		std::string const fullSequence = optimizer.yulSteps.value();
@@ -339,7 +355,15 @@ void CommandLineParser::parseInputPathsAndRemappings()
 				m_options.input.paths.insert(positionalArg);
 		}
 
-	if (m_options.input.mode == InputMode::StandardJson)
+	if (m_options.input.mode == InputMode::StandardJson && m_options.input.server)
+	{
+		if (!m_options.input.paths.empty() || m_options.input.addStdin)
+			solThrow(
+				CommandLineValidationError,
+				"--" + g_strServer + " reads the inputs from standard input and does not accept input files."
+			);
+	}
+	else if (m_options.input.mode == InputMode::StandardJson)
 	{
 		if (m_options.input.paths.size() > 1 || (m_options.input.paths.size() == 1 && m_options.input.addStdin))
 			solThrow(
@@ -472,6 +496,7 @@ void CommandLineParser::parseOutputSelection()
 			CompilerOutputs::componentName(&CompilerOutputs::binary),
 			CompilerOutputs::componentName(&CompilerOutputs::irOptimized),
 			CompilerOutputs::componentName(&CompilerOutputs::astCompactJson),
+			CompilerOutputs::componentName(&CompilerOutputs::optimizerProfile),
 		};
 		static std::set<std::string> const evmAssemblyJsonImportModeOutputs = {
 			CompilerOutputs::componentName(&CompilerOutputs::asm_),
@@ -627,6 +652,19 @@ General Information)").c_str(),
 			g_strViaIR.c_str(),
 			"Turn on compilation mode via the IR."
 		)
+		(
+			(g_strJobs + ",j").c_str(),
+			po::value<unsigned>()->value_name("n"),
+			"Use up to n threads to optimize the IR of independent contracts and Yul objects "
+			"and to generate code from it concurrently. The output does not depend on the number of threads."
+		)
+		(
+			g_strCacheDir.c_str(),
+			po::value<std::string>()->value_name("path"),
+			"Store the optimized IR of contracts in the given directory and reuse it in later compilations "
+			"with the same settings. The answers of SMT solvers called via their binaries are stored there as well. "
+			"The output does not depend on the state of the cache."
+		)
 		(
 			g_strRevertStrings.c_str(),
 			po::value<std::string>()->value_name(util::joinHumanReadable(g_revertStringsArgs, ",")),
@@ -654,6 +692,13 @@ General Information)").c_str(),
 			"Switch to Standard JSON input / output mode, ignoring all options. "
 			"It reads from standard input, if no input file was given, otherwise it reads from the provided input file. The result will be written to standard output."
 		)
+		(
+			g_strServer.c_str(),
+			("Keep the compiler running in Standard JSON mode and compile successive inputs, one per line "
+			"of standard input, until its end. The output for each input is written as a single line to "
+			"standard output. Use 'settings.trace' to get the time spent on each input. "
+			"Only valid together with --" + g_strStandardJSON + ".").c_str()
+		)
 		(
 			g_strLink.c_str(),
 			("Switch to linker mode, ignoring all options apart from --" + g_strLibraries + " "
@@ -755,6 +800,7 @@ General Information)").c_str(),
 		(CompilerOutputs::componentName(&CompilerOutputs::irAstJson).c_str(), "AST of Intermediate Representation (IR) of all contracts in a compact JSON format.")
 		(CompilerOutputs::componentName(&CompilerOutputs::irOptimized).c_str(), "Optimized Intermediate Representation (IR) of all contracts.")
 		(CompilerOutputs::componentName(&CompilerOutputs::irOptimizedAstJson).c_str(), "AST of optimized Intermediate Representation (IR) of all contracts in a compact JSON format.")
+		(CompilerOutputs::componentName(&CompilerOutputs::optimizerProfile).c_str(), "Time and code size changes of the Yul optimizer steps run on the IR of all contracts in JSON format.")
 		(CompilerOutputs::componentName(&CompilerOutputs::signatureHashes).c_str(), "Function signature hashes of the contracts.")
 		(CompilerOutputs::componentName(&CompilerOutputs::natspecUser).c_str(), "Natspec user documentation of all contracts.")
 		(CompilerOutputs::componentName(&CompilerOutputs::natspecDev).c_str(), "Natspec developer documentation of all contracts.")
@@ -809,6 +855,13 @@ General Information)").c_str(),
 			"The number of runs specifies roughly how often each opcode of the deployed code will be executed across the lifetime of the contract. "
 			"Lower values will optimize more for initial deployment cost, higher values will optimize more for high-frequency usage."
 		)
+		(
+			g_strOptimizeTimeBudget.c_str(),
+			po::value<unsigned>()->value_name("ms"),
+			"Maximum time in milliseconds the Yul optimizer may spend on each contract. "
+			"Once it is exceeded, the remaining optimization steps are skipped, only the default clean-up "
+			"sequence is run and a warning is issued. The resulting bytecode then depends on the speed of the machine."
+		)
 		(
 			g_strOptimizeYul.c_str(),
 			("Enable Yul optimizer (independently of the EVM assembly optimizer). "
@@ -859,10 +912,26 @@ General Information)").c_str(),
 			" Multiple types of invariants can be selected at the same time, separated by a comma and no spaces."
 			" By default no invariants are reported."
 		)
+		(
+			g_strModelCheckerParallelQueries.c_str(),
+			po::value<unsigned>()->value_name("n"),
+			"Send up to n CHC queries concurrently to the Horn solver, if it is used via SMT-LIB2 (eld)."
+			" The results do not depend on the order in which the queries finish."
+			" Default is 1."
+		)
+		(
+			g_strModelCheckerPersistentSolvers.c_str(),
+			"Keep the processes of solvers called via their binaries running and send all queries to them,"
+			" instead of starting a new process for every query. Currently only supported for cvc5."
+		)
 		(
 			g_strModelCheckerPrintQuery.c_str(),
 			"Print the queries created by the SMTChecker in the SMTLIB2 format."
 		)
+		(
+			g_strModelCheckerRaceSolvers.c_str(),
+			"Send each BMC query to all selected solvers concurrently and use the first definitive answer."
+		)
 		(
 			g_strModelCheckerShowProvedSafe.c_str(),
 			"Show all targets that were proved safe separately."
@@ -887,6 +956,13 @@ General Information)").c_str(),
 			"Multiple targets can be selected at the same time, separated by a comma and no spaces."
 			" By default all targets except underflow and overflow are selected."
 		)
+		(
+			g_strModelCheckerTimeBudget.c_str(),
+			po::value<unsigned>()->value_name("ms"),
+			"Set the total time in milliseconds that the queries of all model checker engines may take."
+			" Once it has run out, the remaining verification targets are not checked."
+			" By default there is no time budget."
+		)
 		(
 			g_strModelCheckerTimeout.c_str(),
 			po::value<unsigned>()->value_name("ms"),
@@ -992,6 +1068,9 @@ void CommandLineParser::processArgs()
 		// TODO: This should eventually contain all options.
 		{g_strExperimentalViaIR, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
 		{g_strViaIR, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
+		{g_strJobs, {InputMode::Compiler, InputMode::CompilerWithASTImport, InputMode::Assembler}},
+		{g_strCacheDir, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
+		{g_strServer, {InputMode::StandardJson}},
 		{g_strMetadataLiteral, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
 		{g_strNoCBORMetadata, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
 		{g_strMetadataHash, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
@@ -999,11 +1078,15 @@ void CommandLineParser::processArgs()
 		{g_strModelCheckerDivModNoSlacks, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
 		{g_strModelCheckerEngine, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
 		{g_strModelCheckerInvariants, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
+		{g_strModelCheckerParallelQueries, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
+		{g_strModelCheckerPersistentSolvers, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
 		{g_strModelCheckerPrintQuery, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
+		{g_strModelCheckerRaceSolvers, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
 		{g_strModelCheckerShowProvedSafe, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
 		{g_strModelCheckerShowUnproved, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
 		{g_strModelCheckerShowUnsupported, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
 		{g_strModelCheckerSolvers, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
+		{g_strModelCheckerTimeBudget, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
 		{g_strModelCheckerTimeout, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
 		{g_strModelCheckerBMCLoopIterations, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
 		{g_strModelCheckerContracts, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
@@ -1079,7 +1162,7 @@ void CommandLineParser::processArgs()
 				"Option --" + g_strOptimizeRuns + " is only valid in compiler and assembler modes."
 			);
 
-		for (std::string const& option: {g_strOptimize, g_strNoOptimizeYul, g_strOptimizeYul, g_strYulOptimizations})
+		for (std::string const& option: {g_strOptimize, g_strNoOptimizeYul, g_strOptimizeYul, g_strYulOptimizations, g_strOptimizeTimeBudget})
 			if (m_args.count(option) > 0)
 				solThrow(
 					CommandLineValidationError,
@@ -1130,6 +1213,14 @@ void CommandLineParser::processArgs()
 
 	m_options.output.overwriteFiles = (m_args.count(g_strOverwrite) > 0);
 
+	m_options.input.server = (m_args.count(g_strServer) > 0);
+	if (m_options.input.server && (m_args.count(g_strPrettyJson) > 0 || !m_args[g_strJsonIndent].defaulted()))
+		solThrow(
+			CommandLineValidationError,
+			"--" + g_strServer + " writes each output as a single line and cannot be combined with --" +
+			g_strPrettyJson + " or --" + g_strJsonIndent + "."
+		);
+
 	if (m_args.count(g_strPrettyJson) > 0)
 	{
 		m_options.formatting.json.format = util::JsonFormat::Pretty;
@@ -1212,6 +1303,21 @@ void CommandLineParser::processArgs()
 		m_options.output.eofVersion = 1;
 	}
 
+	if (m_args.count(g_strJobs))
+	{
+		unsigned jobs = m_args[g_strJobs].as<unsigned>();
+		if (jobs == 0)
+			solThrow(CommandLineValidationError, "Invalid option for --" + g_strJobs + ": The number of jobs must be positive.");
+		m_options.output.jobs = jobs;
+	}
+
+	if (m_args.count(g_strCacheDir))
+	{
+		m_options.output.cacheDir = m_args[g_strCacheDir].as<std::string>();
+		if (m_options.output.cacheDir.empty())
+			solThrow(CommandLineValidationError, "Invalid option for --" + g_strCacheDir + ": The path must not be empty.");
+	}
+
 	if (m_args.count(g_strNoOptimizeYul) > 0 && m_args.count(g_strOptimizeYul) > 0)
 		solThrow(
 			CommandLineValidationError,
@@ -1225,6 +1331,8 @@ void CommandLineParser::processArgs()
 	);
 	if (!m_args[g_strOptimizeRuns].defaulted())
 		m_options.optimizer.expectedExecutionsPerDeployment = m_args.at(g_strOptimizeRuns).as<unsigned>();
+	if (m_args.count(g_strOptimizeTimeBudget))
+		m_options.optimizer.timeBudget = m_args.at(g_strOptimizeTimeBudget).as<unsigned>();
 
 	if (m_args.count(g_strYulOptimizations))
 	{
@@ -1375,6 +1483,23 @@ void CommandLineParser::processArgs()
 		m_options.modelChecker.settings.invariants = *invs;
 	}
 
+	if (m_args.count(g_strModelCheckerParallelQueries))
+	{
+		unsigned parallelQueries = m_args[g_strModelCheckerParallelQueries].as<unsigned>();
+		if (parallelQueries == 0)
+			solThrow(
+				CommandLineValidationError,
+				"Invalid option for --" + g_strModelCheckerParallelQueries + ": The number of queries must be positive."
+			);
+		m_options.modelChecker.settings.parallelQueries = parallelQueries;
+	}
+
+	if (m_args.count(g_strModelCheckerPersistentSolvers))
+		m_options.modelChecker.persistentSolvers = true;
+
+	if (m_args.count(g_strModelCheckerRaceSolvers))
+		m_options.modelChecker.settings.raceSolvers = true;
+
 	if (m_args.count(g_strModelCheckerShowProvedSafe))
 		m_options.modelChecker.settings.showProvedSafe = true;
 
@@ -1409,6 +1534,9 @@ void CommandLineParser::processArgs()
 		m_options.modelChecker.settings.targets = *targets;
 	}
 
+	if (m_args.count(g_strModelCheckerTimeBudget))
+		m_options.modelChecker.settings.timeBudget = m_args[g_strModelCheckerTimeBudget].as<unsigned>();
+
 	if (m_args.count(g_strModelCheckerTimeout))
 		m_options.modelChecker.settings.timeout = m_args[g_strModelCheckerTimeout].as<unsigned>();
 
@@ -1426,11 +1554,14 @@ void CommandLineParser::processArgs()
 		m_args.count(g_strModelCheckerEngine) ||
 		m_args.count(g_strModelCheckerExtCalls) ||
 		m_args.count(g_strModelCheckerInvariants) ||
+		m_args.count(g_strModelCheckerParallelQueries) ||
+		m_args.count(g_strModelCheckerRaceSolvers) ||
 		m_args.count(g_strModelCheckerShowProvedSafe) ||
 		m_args.count(g_strModelCheckerShowUnproved) ||
 		m_args.count(g_strModelCheckerShowUnsupported) ||
 		m_args.count(g_strModelCheckerSolvers) ||
 		m_args.count(g_strModelCheckerTargets) ||
+		m_args.count(g_strModelCheckerTimeBudget) ||
 		m_args.count(g_strModelCheckerTimeout);
 	m_options.output.viaIR = (m_args.count(g_strExperimentalViaIR) > 0 || m_args.count(g_strViaIR) > 0);
 
@@ -81,6 +81,7 @@ struct CompilerOutputs
 			{"ir-ast-json", &CompilerOutputs::irAstJson},
 			{"ir-optimized", &CompilerOutputs::irOptimized},
 			{"ir-optimized-ast-json", &CompilerOutputs::irOptimizedAstJson},
+			{"profile-optimizer", &CompilerOutputs::optimizerProfile},
 			{"hashes", &CompilerOutputs::signatureHashes},
 			{"userdoc", &CompilerOutputs::natspecUser},
 			{"devdoc", &CompilerOutputs::natspecDev},
@@ -101,6 +102,7 @@ struct CompilerOutputs
 	bool irAstJson = false;
 	bool irOptimized = false;
 	bool irOptimizedAstJson = false;
+	bool optimizerProfile = false;
 	bool signatureHashes = false;
 	bool natspecUser = false;
 	bool natspecDev = false;
@@ -176,6 +178,9 @@ struct CommandLineOptions
 		FileReader::FileSystemPathSet allowedDirectories;
 		bool ignoreMissingFiles = false;
 		bool noImportCallback = false;
+		/// Whether successive Standard JSON inputs are read from standard input (one per line)
+		/// until its end, instead of a single one.
+		bool server = false;
 	} input;
 
 	struct
@@ -184,6 +189,8 @@ struct CommandLineOptions
 		bool overwriteFiles = false;
 		langutil::EVMVersion evmVersion;
 		bool viaIR = false;
+		size_t jobs = 1;
+		boost::filesystem::path cacheDir;
 		RevertStrings revertStrings = RevertStrings::Default;
 		std::optional<langutil::DebugInfoSelection> debugInfoSelection;
 		CompilerStack::State stopAfter = CompilerStack::State::CompilationSuccessful;
@@ -228,12 +235,16 @@ struct CommandLineOptions
 		bool optimizeYul = false;
 		std::optional<unsigned> expectedExecutionsPerDeployment;
 		std::optional<std::string> yulSteps;
+		/// Time budget of the Yul optimizer per contract in milliseconds.
+		std::optional<unsigned> timeBudget;
 	} optimizer;
 
 	struct
 	{
 		bool initialize = false;
 		ModelCheckerSettings settings;
+		/// Keep solver processes running and send all queries to them instead of starting a process per query.
+		bool persistentSolvers = false;
 	} modelChecker;
 };
 
@@ -16,6 +16,7 @@
 */
 // SPDX-License-Identifier: GPL-3.0
 
+#include <cctype>
 #include <stdexcept>
 #include <iostream>
 #include <test/Common.h>
@@ -111,6 +112,7 @@ void CommonOptions::addOptions()
 		("vm", po::value<std::vector<fs::path>>(&vmPaths), "path to evmc library, can be supplied multiple times.")
 		("batches", po::value<size_t>(&this->batches)->default_value(1), "set number of batches to split the tests into")
 		("selected-batch", po::value<size_t>(&this->selectedBatch)->default_value(0), "zero-based number of batch to execute")
+		("shard", po::value<std::string>(&shardString), "execute only shard i out of n, given as i/n with 1 <= i <= n; tests are assigned to shards by a hash of their name")
 		("no-semantic-tests", po::bool_switch(&disableSemanticTests)->default_value(disableSemanticTests), "disable semantic tests")
 		("no-smt", po::bool_switch(&disableSMT)->default_value(disableSMT), "disable SMT checker")
 		("optimize", po::bool_switch(&optimize)->default_value(optimize), "enables optimization")
@@ -118,7 +120,8 @@ void CommonOptions::addOptions()
 		("enforce-gas-cost-min-value", po::value(&enforceGasTestMinValue)->default_value(enforceGasTestMinValue), "Threshold value to enforce adding gas checks to a test.")
 		("abiencoderv1", po::bool_switch(&useABIEncoderV1)->default_value(useABIEncoderV1), "enables abi encoder v1")
 		("show-messages", po::bool_switch(&showMessages)->default_value(showMessages), "enables message output")
-		("show-metadata", po::bool_switch(&showMetadata)->default_value(showMetadata), "enables metadata output");
+		("show-metadata", po::bool_switch(&showMetadata)->default_value(showMetadata), "enables metadata output")
+		("bytecode-cache-dir", po::value<fs::path>(&bytecodeCacheDir), "directory in which to cache the bytecode of semantic tests across runs");
 }
 
 void CommonOptions::validate() const
@@ -177,6 +180,24 @@ bool CommonOptions::parse(int argc, char const* const* argv)
 				BOOST_THROW_EXCEPTION(std::runtime_error("Invalid EOF version: " + std::to_string(eofVersion)));
 			m_eofVersion = 1;
 		}
+		if (arguments.count("shard"))
+		{
+			if (!arguments["batches"].defaulted() || !arguments["selected-batch"].defaulted())
+				BOOST_THROW_EXCEPTION(std::runtime_error("--shard cannot be combined with --batches or --selected-batch."));
+			std::vector<std::string> parts;
+			boost::split(parts, shardString, boost::is_any_of("/"));
+			auto isNumber = [](std::string const& _part) {
+				return !_part.empty() && _part.size() <= 9 && ranges::all_of(_part, [](unsigned char _c) { return std::isdigit(_c); });
+			};
+			if (parts.size() != 2 || !isNumber(parts[0]) || !isNumber(parts[1]))
+				BOOST_THROW_EXCEPTION(std::runtime_error("Invalid shard: " + shardString + " (expected i/n)."));
+			size_t shard = std::stoul(parts[0]);
+			batches = std::stoul(parts[1]);
+			if (shard < 1 || shard > batches)
+				BOOST_THROW_EXCEPTION(std::runtime_error("Invalid shard: " + shardString + " (expected 1 <= i <= n)."));
+			selectedBatch = shard - 1;
+			batchByName = true;
+		}
 
 		for (auto const& parsedOption: parsedOptions.options)
 			if (parsedOption.position_key >= 0)
@@ -245,6 +266,21 @@ void CommonOptions::printSelectedOptions(std::ostream& _stream, std::string cons
 	_stream << _linePrefix << "Run Settings: " << toString(_selectedOptions) << std::endl;
 }
 
+bool Batcher::checkAndAdvance(std::string_view _testName)
+{
+	if (!m_byName)
+		return (m_counter++) % m_batches == m_offset;
+
+	// FNV-1a, since the assignment must not depend on the standard library implementation.
+	uint64_t hash = 14695981039346656037u;
+	for (char c: _testName)
+	{
+		hash ^= static_cast<uint8_t>(c);
+		hash *= 1099511628211u;
+	}
+	return hash % m_batches == m_offset;
+}
+
 langutil::EVMVersion CommonOptions::evmVersion() const
 {
 	if (!evmVersionString.empty())
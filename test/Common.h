@@ -29,6 +29,8 @@
 #include <boost/program_options.hpp>
 #include <boost/test/unit_test.hpp>
 
+#include <string_view>
+
 namespace solidity::test
 {
 
@@ -63,6 +65,10 @@ struct CommonOptions
 	bool showMetadata = false;
 	size_t batches = 1;
 	size_t selectedBatch = 0;
+	/// If true, tests are assigned to batches by a hash of their name instead of in turn.
+	/// Set by --shard, which also sets @a batches and @a selectedBatch.
+	bool batchByName = false;
+	boost::filesystem::path bytecodeCacheDir;
 
 	langutil::EVMVersion evmVersion() const;
 	std::optional<uint8_t> eofVersion() const { return m_eofVersion; }
@@ -92,6 +98,7 @@ protected:
 
 private:
 	std::string evmVersionString;
+	std::string shardString;
 	std::optional<uint8_t> m_eofVersion;
 	static std::unique_ptr<CommonOptions const> m_singleton;
 };
@@ -110,25 +117,30 @@ bool loadVMs(CommonOptions const& _options);
 
 /**
  * Component to help with splitting up all tests into batches.
+ * Tests are either assigned to the batches in turn, in the order in which they are checked, or by
+ * a hash of their name. The latter keeps the assignment of a test stable when other tests are
+ * added or removed, so that runs of separate processes can be compared and merged.
  */
 class Batcher
 {
 public:
-	Batcher(size_t _offset, size_t _batches):
+	Batcher(size_t _offset, size_t _batches, bool _byName = false):
 		m_offset(_offset),
-		m_batches(_batches)
+		m_batches(_batches),
+		m_byName(_byName)
 	{
 		solAssert(m_batches > 0 && m_offset < m_batches);
 	}
 	Batcher(Batcher const&) = delete;
 	Batcher& operator=(Batcher const&) = delete;
 
-	bool checkAndAdvance() { return (m_counter++) % m_batches == m_offset; }
+	/// @returns true if the test named @a _testName belongs to the selected batch.
+	bool checkAndAdvance(std::string_view _testName);
 
 private:
 	size_t const m_offset;
 	size_t const m_batches;
+	bool const m_byName;
 	size_t m_counter = 0;
 };
-
 }
@@ -183,6 +183,33 @@ void EVMHost::reset()
 	}
 }
 
+EVMHost::Snapshot EVMHost::snapshot() const
+{
+	return std::make_shared<State const>(State{
+		accounts,
+		tx_context,
+		block_hash,
+		recorded_logs,
+		recorded_selfdestructs,
+		m_newlyCreatedAccounts,
+		m_totalCodeDepositGas
+	});
+}
+
+void EVMHost::restore(Snapshot const& _snapshot)
+{
+	assertThrow(_snapshot, Exception, "Invalid snapshot.");
+	accounts = _snapshot->accounts;
+	tx_context = _snapshot->txContext;
+	block_hash = _snapshot->blockHash;
+	recorded_logs = _snapshot->recordedLogs;
+	recorded_selfdestructs = _snapshot->recordedSelfdestructs;
+	m_newlyCreatedAccounts = _snapshot->newlyCreatedAccounts;
+	m_totalCodeDepositGas = _snapshot->totalCodeDepositGas;
+	recorded_calls.clear();
+	recorded_account_accesses.clear();
+}
+
 void EVMHost::newTransactionFrame()
 {
 	// Clear EIP-2929 account access indicator
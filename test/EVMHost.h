@@ -32,7 +32,8 @@
 
 #include <boost/filesystem.hpp>
 
-#include<unordered_set>
+#include <memory>
+#include <unordered_set>
 
 namespace solidity::test
 {
@@ -82,6 +83,27 @@ public:
 	/// Reset entire state (including accounts).
 	void reset();
 
+	/// State of the chain between two transactions, as stored by @a snapshot.
+	struct State
+	{
+		std::unordered_map<evmc::address, evmc::MockedAccount> accounts;
+		evmc_tx_context txContext;
+		evmc::bytes32 blockHash;
+		std::vector<evmc::MockedHost::log_record> recordedLogs;
+		std::unordered_map<evmc::address, std::vector<evmc::address>> recordedSelfdestructs;
+		std::unordered_set<evmc::address> newlyCreatedAccounts;
+		u256 totalCodeDepositGas;
+	};
+	/// Snapshots are immutable, so that copies of them share the same state.
+	using Snapshot = std::shared_ptr<State const>;
+
+	/// @returns a snapshot of the current state, which can be restored any number of times.
+	/// Only valid between transactions.
+	Snapshot snapshot() const;
+	/// Sets the state to @a _snapshot, which has to be taken from a host with the same EVM version.
+	/// Clears the records of calls and account accesses like @a reset.
+	void restore(Snapshot const& _snapshot);
+
 	/// Start new block.
 	void newBlock()
 	{
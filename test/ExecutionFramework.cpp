@@ -86,6 +86,18 @@ void ExecutionFramework::reset()
 			EVMHost::convertToEVMC(u256(1) << 100);
 }
 
+ExecutionFramework::Snapshot ExecutionFramework::snapshot() const
+{
+	return {m_evmcHost->snapshot(), m_sender, m_contractAddress};
+}
+
+void ExecutionFramework::restore(Snapshot const& _snapshot)
+{
+	m_evmcHost->restore(_snapshot.host);
+	m_sender = _snapshot.sender;
+	m_contractAddress = _snapshot.contractAddress;
+}
+
 std::pair<bool, std::string> ExecutionFramework::compareAndCreateMessage(
 	bytes const& _result,
 	bytes const& _expectation
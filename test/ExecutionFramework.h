@@ -277,6 +277,17 @@ protected:
 	void selectVM(evmc_capabilities _cap = evmc_capabilities::EVMC_CAPABILITY_EVM1);
 	void reset();
 
+	/// State of the chain, the sender and the current contract, which can be restored
+	/// any number of times, e.g. to run different calls on a contract deployed only once.
+	struct Snapshot
+	{
+		EVMHost::Snapshot host;
+		util::h160 sender;
+		util::h160 contractAddress;
+	};
+	Snapshot snapshot() const;
+	void restore(Snapshot const& _snapshot);
+
 	void sendMessage(bytes const& _data, bool _isCreation, u256 const& _value = 0);
 	void sendEther(util::h160 const& _to, u256 const& _value);
 	size_t currentTimestamp();
@@ -84,4 +84,8 @@ Testsuite const g_interactiveTestsuites[] = {
 	{"Function Dependency Graph",   "libsolidity", "functionDependencyGraphTests",  false, false, &FunctionDependencyGraphTest::create},
 };
 
+/// Semantic tests exercising realistic contracts, whose gas expectations serve as a baseline for the
+/// runtime cost of the generated code. Only run by `isoltest --gas-benchmarks`.
+Testsuite const g_gasBenchmarks{"Gas Benchmarks", "benchmarks", "gas", false, true, &SemanticTest::create};
+
 }
@@ -0,0 +1,124 @@
+/// Constant product pool with a swap fee of 0.3%, in the style of a Uniswap V2 pair.
+/// The two pooled tokens are kept as internal balances to keep the benchmark self-contained.
+contract ConstantProductPool {
+    event Mint(address indexed sender, uint256 amount0, uint256 amount1, uint256 liquidity);
+    event Burn(address indexed sender, uint256 amount0, uint256 amount1, uint256 liquidity);
+    event Swap(address indexed sender, bool zeroForOne, uint256 amountIn, uint256 amountOut);
+
+    uint256 public constant MINIMUM_LIQUIDITY = 1000;
+
+    uint112 public reserve0;
+    uint112 public reserve1;
+    uint256 public totalSupply;
+    mapping(address => uint256) public liquidityOf;
+    mapping(address => uint256) public balance0Of;
+    mapping(address => uint256) public balance1Of;
+
+    function faucet(uint256 amount0, uint256 amount1) external {
+        balance0Of[msg.sender] += amount0;
+        balance1Of[msg.sender] += amount1;
+    }
+
+    function addLiquidity(uint256 amount0, uint256 amount1) external returns (uint256 liquidity) {
+        balance0Of[msg.sender] -= amount0;
+        balance1Of[msg.sender] -= amount1;
+        (uint256 r0, uint256 r1) = (reserve0, reserve1);
+        uint256 supply = totalSupply;
+        if (supply == 0) {
+            liquidity = sqrt(amount0 * amount1) - MINIMUM_LIQUIDITY;
+            // The minimum liquidity is locked forever.
+            supply = MINIMUM_LIQUIDITY;
+        } else
+            liquidity = min(amount0 * supply / r0, amount1 * supply / r1);
+        require(liquidity > 0);
+        totalSupply = supply + liquidity;
+        liquidityOf[msg.sender] += liquidity;
+        _update(r0 + amount0, r1 + amount1);
+        emit Mint(msg.sender, amount0, amount1, liquidity);
+    }
+
+    function removeLiquidity(uint256 liquidity) external returns (uint256 amount0, uint256 amount1) {
+        (uint256 r0, uint256 r1) = (reserve0, reserve1);
+        uint256 supply = totalSupply;
+        amount0 = liquidity * r0 / supply;
+        amount1 = liquidity * r1 / supply;
+        liquidityOf[msg.sender] -= liquidity;
+        totalSupply = supply - liquidity;
+        balance0Of[msg.sender] += amount0;
+        balance1Of[msg.sender] += amount1;
+        _update(r0 - amount0, r1 - amount1);
+        emit Burn(msg.sender, amount0, amount1, liquidity);
+    }
+
+    function swap(bool zeroForOne, uint256 amountIn, uint256 minAmountOut) external returns (uint256 amountOut) {
+        (uint256 r0, uint256 r1) = (reserve0, reserve1);
+        if (zeroForOne) {
+            amountOut = getAmountOut(amountIn, r0, r1);
+            require(amountOut >= minAmountOut);
+            balance0Of[msg.sender] -= amountIn;
+            balance1Of[msg.sender] += amountOut;
+            _update(r0 + amountIn, r1 - amountOut);
+        } else {
+            amountOut = getAmountOut(amountIn, r1, r0);
+            require(amountOut >= minAmountOut);
+            balance1Of[msg.sender] -= amountIn;
+            balance0Of[msg.sender] += amountOut;
+            _update(r0 - amountOut, r1 + amountIn);
+        }
+        emit Swap(msg.sender, zeroForOne, amountIn, amountOut);
+    }
+
+    function getAmountOut(uint256 amountIn, uint256 reserveIn, uint256 reserveOut) public pure returns (uint256) {
+        uint256 amountInWithFee = amountIn * 997;
+        return amountInWithFee * reserveOut / (reserveIn * 1000 + amountInWithFee);
+    }
+
+    function _update(uint256 balance0, uint256 balance1) private {
+        require(balance0 <= type(uint112).max && balance1 <= type(uint112).max);
+        reserve0 = uint112(balance0);
+        reserve1 = uint112(balance1);
+    }
+
+    function min(uint256 x, uint256 y) private pure returns (uint256) {
+        return x < y ? x : y;
+    }
+
+    function sqrt(uint256 y) private pure returns (uint256 z) {
+        if (y > 3) {
+            z = y;
+            uint256 x = y / 2 + 1;
+            while (x < z) {
+                z = x;
+                x = (y / x + x) / 2;
+            }
+        } else if (y != 0)
+            z = 1;
+    }
+}
+// ----
+// faucet(uint256,uint256): 1000000, 4000000 ->
+// addLiquidity(uint256,uint256): 100000, 400000 -> 199000
+// ~ emit Mint(address,uint256,uint256,uint256): #0x1212121212121212121212121212120000000012, 0x0186a0, 0x061a80, 0x030958
+// totalSupply() -> 200000
+// getAmountOut(uint256,uint256,uint256): 1000, 100000, 400000 -> 3948
+// account: 1 -> 0x1212121212121212121212121212120000001012
+// faucet(uint256,uint256): 50000, 0 ->
+// swap(bool,uint256,uint256): true, 1000, 5000 -> FAILURE
+// swap(bool,uint256,uint256): true, 10000, 0 -> 36264
+// ~ emit Swap(address,bool,uint256,uint256): #0x1212121212121212121212121212120000001012, true, 0x2710, 0x8da8
+// swap(bool,uint256,uint256): true, 10000, 30000 -> 30227
+// ~ emit Swap(address,bool,uint256,uint256): #0x1212121212121212121212121212120000001012, true, 0x2710, 0x7613
+// swap(bool,uint256,uint256): false, 20000, 0 -> 6769
+// ~ emit Swap(address,bool,uint256,uint256): #0x1212121212121212121212121212120000001012, false, 0x4e20, 0x1a71
+// reserve0() -> 113231
+// reserve1() -> 353509
+// account: 0 -> 0x1212121212121212121212121212120000000012
+// addLiquidity(uint256,uint256): 50000, 200000 -> 88315
+// ~ emit Mint(address,uint256,uint256,uint256): #0x1212121212121212121212121212120000000012, 0xc350, 0x030d40, 0x0158fb
+// removeLiquidity(uint256): 100000 -> 56615, 191980
+// ~ emit Burn(address,uint256,uint256,uint256): #0x1212121212121212121212121212120000000012, 0xdd27, 0x02edec, 0x0186a0
+// liquidityOf(address): 0x1212121212121212121212121212120000000012 -> 187315
+// balance0Of(address): 0x1212121212121212121212121212120000000012 -> 906615
+// balance1Of(address): 0x1212121212121212121212121212120000000012 -> 3591980
+// balance0Of(address): 0x1212121212121212121212121212120000001012 -> 36769
+// balance1Of(address): 0x1212121212121212121212121212120000001012 -> 46491
@@ -0,0 +1,71 @@
+contract ERC20 {
+    event Transfer(address indexed from, address indexed to, uint256 value);
+    event Approval(address indexed owner, address indexed spender, uint256 value);
+
+    string public name = "Benchmark Token";
+    uint8 public constant decimals = 18;
+    uint256 public totalSupply;
+    mapping(address => uint256) public balanceOf;
+    mapping(address => mapping(address => uint256)) public allowance;
+
+    constructor() {
+        _mint(msg.sender, 1000000);
+    }
+
+    function transfer(address to, uint256 amount) external returns (bool) {
+        _transfer(msg.sender, to, amount);
+        return true;
+    }
+
+    function approve(address spender, uint256 amount) external returns (bool) {
+        allowance[msg.sender][spender] = amount;
+        emit Approval(msg.sender, spender, amount);
+        return true;
+    }
+
+    function transferFrom(address from, address to, uint256 amount) external returns (bool) {
+        uint256 allowed = allowance[from][msg.sender];
+        if (allowed != type(uint256).max) {
+            require(allowed >= amount);
+            unchecked { allowance[from][msg.sender] = allowed - amount; }
+        }
+        _transfer(from, to, amount);
+        return true;
+    }
+
+    function _transfer(address from, address to, uint256 amount) internal {
+        require(to != address(0));
+        uint256 fromBalance = balanceOf[from];
+        require(fromBalance >= amount);
+        unchecked { balanceOf[from] = fromBalance - amount; }
+        balanceOf[to] += amount;
+        emit Transfer(from, to, amount);
+    }
+
+    function _mint(address to, uint256 amount) internal {
+        totalSupply += amount;
+        balanceOf[to] += amount;
+        emit Transfer(address(0), to, amount);
+    }
+}
+// ----
+// constructor()
+// ~ emit Transfer(address,address,uint256): #0x00, #0x1212121212121212121212121212120000000012, 0x0f4240
+// name() -> 0x20, 15, "Benchmark Token"
+// totalSupply() -> 1000000
+// transfer(address,uint256): 0x1212121212121212121212121212120000001012, 1000 -> true
+// ~ emit Transfer(address,address,uint256): #0x1212121212121212121212121212120000000012, #0x1212121212121212121212121212120000001012, 0x03e8
+// transfer(address,uint256): 0x1212121212121212121212121212120000001012, 1000 -> true
+// ~ emit Transfer(address,address,uint256): #0x1212121212121212121212121212120000000012, #0x1212121212121212121212121212120000001012, 0x03e8
+// approve(address,uint256): 0x1212121212121212121212121212120000001012, 5000 -> true
+// ~ emit Approval(address,address,uint256): #0x1212121212121212121212121212120000000012, #0x1212121212121212121212121212120000001012, 0x1388
+// account: 1 -> 0x1212121212121212121212121212120000001012
+// transferFrom(address,address,uint256): 0x1212121212121212121212121212120000000012, 0x02, 3000 -> true
+// ~ emit Transfer(address,address,uint256): #0x1212121212121212121212121212120000000012, #0x02, 0x0bb8
+// allowance(address,address): 0x1212121212121212121212121212120000000012, 0x1212121212121212121212121212120000001012 -> 2000
+// balanceOf(address): 0x1212121212121212121212121212120000000012 -> 995000
+// balanceOf(address): 0x02 -> 3000
+// transfer(address,uint256): 0x02, 2001 -> FAILURE
+// transfer(address,uint256): 0x02, 2000 -> true
+// ~ emit Transfer(address,address,uint256): #0x1212121212121212121212121212120000001012, #0x02, 0x07d0
+// balanceOf(address): 0x1212121212121212121212121212120000001012 -> 0
@@ -0,0 +1,88 @@
+interface IERC721Receiver {
+    function onERC721Received(address operator, address from, uint256 id, bytes calldata data) external returns (bytes4);
+}
+
+contract ERC721 {
+    event Transfer(address indexed from, address indexed to, uint256 indexed id);
+    event Approval(address indexed owner, address indexed spender, uint256 indexed id);
+    event ApprovalForAll(address indexed owner, address indexed operator, bool approved);
+
+    mapping(uint256 => address) internal _ownerOf;
+    mapping(address => uint256) public balanceOf;
+    mapping(uint256 => address) public getApproved;
+    mapping(address => mapping(address => bool)) public isApprovedForAll;
+    uint256 public nextTokenId = 1;
+
+    function ownerOf(uint256 id) public view returns (address owner) {
+        owner = _ownerOf[id];
+        require(owner != address(0));
+    }
+
+    function mint(address to) external returns (uint256 id) {
+        require(to != address(0));
+        id = nextTokenId++;
+        unchecked { balanceOf[to]++; }
+        _ownerOf[id] = to;
+        emit Transfer(address(0), to, id);
+    }
+
+    function approve(address spender, uint256 id) external {
+        address owner = _ownerOf[id];
+        require(msg.sender == owner || isApprovedForAll[owner][msg.sender]);
+        getApproved[id] = spender;
+        emit Approval(owner, spender, id);
+    }
+
+    function setApprovalForAll(address operator, bool approved) external {
+        isApprovedForAll[msg.sender][operator] = approved;
+        emit ApprovalForAll(msg.sender, operator, approved);
+    }
+
+    function transferFrom(address from, address to, uint256 id) public {
+        require(from == _ownerOf[id]);
+        require(to != address(0));
+        require(msg.sender == from || isApprovedForAll[from][msg.sender] || msg.sender == getApproved[id]);
+        unchecked {
+            balanceOf[from]--;
+            balanceOf[to]++;
+        }
+        _ownerOf[id] = to;
+        delete getApproved[id];
+        emit Transfer(from, to, id);
+    }
+
+    function safeTransferFrom(address from, address to, uint256 id) external {
+        transferFrom(from, to, id);
+        require(
+            to.code.length == 0 ||
+            IERC721Receiver(to).onERC721Received(msg.sender, from, id, "") == IERC721Receiver.onERC721Received.selector
+        );
+    }
+}
+// ----
+// mint(address): 0x1212121212121212121212121212120000000012 -> 1
+// ~ emit Transfer(address,address,uint256): #0x00, #0x1212121212121212121212121212120000000012, #0x01
+// mint(address): 0x1212121212121212121212121212120000000012 -> 2
+// ~ emit Transfer(address,address,uint256): #0x00, #0x1212121212121212121212121212120000000012, #0x02
+// mint(address): 0x1212121212121212121212121212120000001012 -> 3
+// ~ emit Transfer(address,address,uint256): #0x00, #0x1212121212121212121212121212120000001012, #0x03
+// balanceOf(address): 0x1212121212121212121212121212120000000012 -> 2
+// ownerOf(uint256): 3 -> 0x1212121212121212121212121212120000001012
+// approve(address,uint256): 0x1212121212121212121212121212120000001012, 1 ->
+// ~ emit Approval(address,address,uint256): #0x1212121212121212121212121212120000000012, #0x1212121212121212121212121212120000001012, #0x01
+// getApproved(uint256): 1 -> 0x1212121212121212121212121212120000001012
+// account: 1 -> 0x1212121212121212121212121212120000001012
+// transferFrom(address,address,uint256): 0x1212121212121212121212121212120000000012, 0x1212121212121212121212121212120000001012, 1 ->
+// ~ emit Transfer(address,address,uint256): #0x1212121212121212121212121212120000000012, #0x1212121212121212121212121212120000001012, #0x01
+// getApproved(uint256): 1 -> 0
+// transferFrom(address,address,uint256): 0x1212121212121212121212121212120000000012, 0x1212121212121212121212121212120000001012, 2 -> FAILURE
+// account: 0 -> 0x1212121212121212121212121212120000000012
+// setApprovalForAll(address,bool): 0x1212121212121212121212121212120000001012, true ->
+// ~ emit ApprovalForAll(address,address,bool): #0x1212121212121212121212121212120000000012, #0x1212121212121212121212121212120000001012, true
+// account: 1 -> 0x1212121212121212121212121212120000001012
+// safeTransferFrom(address,address,uint256): 0x1212121212121212121212121212120000000012, 0x1234, 2 ->
+// ~ emit Transfer(address,address,uint256): #0x1212121212121212121212121212120000000012, #0x1234, #0x02
+// ownerOf(uint256): 2 -> 0x1234
+// balanceOf(address): 0x1212121212121212121212121212120000000012 -> 0
+// balanceOf(address): 0x1212121212121212121212121212120000001012 -> 2
+// ownerOf(uint256): 4 -> FAILURE
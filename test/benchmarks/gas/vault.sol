@@ -0,0 +1,75 @@
+/// Tokenised vault in the style of ERC-4626, with a virtual share and asset to make the
+/// exchange rate robust against donations. The underlying asset is kept as an internal
+/// balance to keep the benchmark self-contained.
+contract Vault {
+    event Deposit(address indexed sender, address indexed owner, uint256 assets, uint256 shares);
+    event Withdraw(address indexed sender, address indexed receiver, address indexed owner, uint256 assets, uint256 shares);
+
+    mapping(address => uint256) public assetBalanceOf;
+    mapping(address => uint256) public balanceOf;
+    uint256 public totalSupply;
+    uint256 public totalAssets;
+
+    function faucet(uint256 assets) external {
+        assetBalanceOf[msg.sender] += assets;
+    }
+
+    function convertToShares(uint256 assets) public view returns (uint256) {
+        return assets * (totalSupply + 1) / (totalAssets + 1);
+    }
+
+    function convertToAssets(uint256 shares) public view returns (uint256) {
+        return shares * (totalAssets + 1) / (totalSupply + 1);
+    }
+
+    function deposit(uint256 assets, address receiver) external returns (uint256 shares) {
+        shares = convertToShares(assets);
+        require(shares != 0);
+        assetBalanceOf[msg.sender] -= assets;
+        totalAssets += assets;
+        totalSupply += shares;
+        balanceOf[receiver] += shares;
+        emit Deposit(msg.sender, receiver, assets, shares);
+    }
+
+    /// Simulates the profit of a strategy by adding assets without minting shares.
+    function harvest(uint256 profit) external {
+        assetBalanceOf[msg.sender] -= profit;
+        totalAssets += profit;
+    }
+
+    function redeem(uint256 shares, address receiver, address owner) external returns (uint256 assets) {
+        require(msg.sender == owner);
+        assets = convertToAssets(shares);
+        require(assets != 0);
+        balanceOf[owner] -= shares;
+        totalSupply -= shares;
+        totalAssets -= assets;
+        assetBalanceOf[receiver] += assets;
+        emit Withdraw(msg.sender, receiver, owner, assets, shares);
+    }
+}
+// ----
+// faucet(uint256): 1000000 ->
+// deposit(uint256,address): 100000, 0x1212121212121212121212121212120000000012 -> 100000
+// ~ emit Deposit(address,address,uint256,uint256): #0x1212121212121212121212121212120000000012, #0x1212121212121212121212121212120000000012, 0x0186a0, 0x0186a0
+// account: 1 -> 0x1212121212121212121212121212120000001012
+// faucet(uint256): 1000000 ->
+// deposit(uint256,address): 50000, 0x1212121212121212121212121212120000001012 -> 50000
+// ~ emit Deposit(address,address,uint256,uint256): #0x1212121212121212121212121212120000001012, #0x1212121212121212121212121212120000001012, 0xc350, 0xc350
+// account: 0 -> 0x1212121212121212121212121212120000000012
+// harvest(uint256): 30000 ->
+// convertToAssets(uint256): 100000 -> 119999
+// convertToShares(uint256): 1000 -> 833
+// account: 1 -> 0x1212121212121212121212121212120000001012
+// deposit(uint256,address): 50000, 0x1212121212121212121212121212120000001012 -> 41666
+// ~ emit Deposit(address,address,uint256,uint256): #0x1212121212121212121212121212120000001012, #0x1212121212121212121212121212120000001012, 0xc350, 0xa2c2
+// redeem(uint256,address,address): 100000, 0x1212121212121212121212121212120000001012, 0x1212121212121212121212121212120000000012 -> FAILURE
+// account: 0 -> 0x1212121212121212121212121212120000000012
+// redeem(uint256,address,address): 100000, 0x1212121212121212121212121212120000000012, 0x1212121212121212121212121212120000000012 -> 120000
+// ~ emit Withdraw(address,address,address,uint256,uint256): #0x1212121212121212121212121212120000000012, #0x1212121212121212121212121212120000000012, #0x1212121212121212121212121212120000000012, 0x01d4c0, 0x0186a0
+// totalAssets() -> 110000
+// totalSupply() -> 91666
+// assetBalanceOf(address): 0x1212121212121212121212121212120000000012 -> 990000
+// balanceOf(address): 0x1212121212121212121212121212120000001012 -> 91666
+// convertToAssets(uint256): 91666 -> 109999
@@ -2,6 +2,8 @@
 
 #------------------------------------------------------------------------------
 # Bash script to run optimizer performance tests.
+# For the time and allocations of the individual stages of the pipeline,
+# run the benchmarks with the in-process solbench tool (test/tools/solbench.cpp).
 # ------------------------------------------------------------------------------
 # This file is part of solidity.
 #
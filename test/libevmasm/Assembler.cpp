@@ -420,6 +420,152 @@ BOOST_AUTO_TEST_CASE(subobject_encode_decode)
 	BOOST_CHECK(assembly.decodeSubPath(assembly.encodeSubPath(subPath)) == subPath);
 }
 
+BOOST_AUTO_TEST_CASE(parallel_sub_assembly_optimisation)
+{
+	EVMVersion evmVersion = solidity::test::CommonOptions::get().evmVersion();
+	auto createAssembly = [&]() {
+		auto fillWithRedundantCode = [](Assembly& _assembly) {
+			AssemblyItem tag = _assembly.newTag();
+			_assembly.append(u256(1));
+			_assembly.append(u256(2));
+			_assembly.append(Instruction::ADD);
+			_assembly.append(Instruction::DUP1);
+			_assembly.append(Instruction::POP);
+			_assembly.appendJumpI(tag);
+			_assembly.append(Instruction::STOP);
+			_assembly.append(u256(3));
+			_assembly.append(tag);
+			_assembly.append(u256(1));
+			_assembly.append(u256(2));
+			_assembly.append(Instruction::ADD);
+			_assembly.append(u256(0));
+			_assembly.append(Instruction::MSTORE);
+			_assembly.append(Instruction::STOP);
+		};
+		auto assembly = std::make_shared<Assembly>(evmVersion, true, std::string{});
+		fillWithRedundantCode(*assembly);
+		// Shared by the last two sub-assemblies, which thus have to be optimised in order.
+		auto sharedSubSub = std::make_shared<Assembly>(evmVersion, false, std::string{});
+		fillWithRedundantCode(*sharedSubSub);
+		for (size_t i = 0; i < 4; ++i)
+		{
+			auto sub = std::make_shared<Assembly>(evmVersion, false, std::string{});
+			fillWithRedundantCode(*sub);
+			if (i >= 2)
+				sub->appendSubroutine(sharedSubSub);
+			assembly->appendSubroutine(sub);
+		}
+		return assembly;
+	};
+
+	auto settings = Assembly::OptimiserSettings::translateSettings(OptimiserSettings::full(), evmVersion);
+	std::shared_ptr<Assembly> serial = createAssembly();
+	serial->optimise(settings);
+	for (size_t jobs: std::vector<size_t>{2, 4, 16})
+	{
+		std::shared_ptr<Assembly> parallel = createAssembly();
+		settings.parallelism = jobs;
+		parallel->optimise(settings);
+		BOOST_CHECK_EQUAL(parallel->assemblyString(), serial->assemblyString());
+		BOOST_CHECK(parallel->assemble().bytecode == serial->assemble().bytecode);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(parallel_assembly)
+{
+	EVMVersion evmVersion = solidity::test::CommonOptions::get().evmVersion();
+	auto createAssembly = [&]() {
+		auto assembly = std::make_shared<Assembly>(evmVersion, true, std::string{});
+		// Shared by the last two sub-assemblies, which thus have to be assembled in order.
+		auto sharedSubSub = std::make_shared<Assembly>(evmVersion, false, std::string{});
+		sharedSubSub->appendLibraryAddress("L2");
+		for (size_t i = 0; i < 4; ++i)
+		{
+			auto sub = std::make_shared<Assembly>(evmVersion, false, std::string{});
+			sub->append(u256(i));
+			sub->appendLibraryAddress(i % 2 ? "L1" : "L2");
+			if (i >= 2)
+				sub->append(sub->appendSubroutine(sharedSubSub));
+			assembly->append(assembly->appendSubroutine(sub));
+		}
+		return assembly;
+	};
+
+	LinkerObject serial = createAssembly()->assemble();
+	for (size_t jobs: std::vector<size_t>{2, 4, 16})
+	{
+		LinkerObject parallel = createAssembly()->assemble(jobs);
+		BOOST_CHECK(parallel.bytecode == serial.bytecode);
+		BOOST_CHECK(parallel.linkReferences == serial.linkReferences);
+	}
+
+	BOOST_REQUIRE_EQUAL(serial.linkReferences.size(), 6);
+	serial.link({{"L1", util::h160(0x01)}});
+	BOOST_CHECK_EQUAL(serial.linkReferences.size(), 4);
+	for (auto const& [offset, library]: serial.linkReferences)
+		BOOST_CHECK_EQUAL(library, "L2");
+	serial.link({{"L1", util::h160(0x01)}, {"L2", util::h160(0x02)}});
+	BOOST_CHECK(serial.linkReferences.empty());
+}
+
+BOOST_AUTO_TEST_CASE(streaming_disassembly)
+{
+	langutil::EVMVersion evmVersion = solidity::test::CommonOptions::get().evmVersion();
+	// PUSH2 0x0102, INVALID, STOP, PUSH2 with a truncated immediate.
+	bytes const code{0x61, 0x01, 0x02, 0xfe, 0x00, 0x61, 0x03};
+
+	std::vector<size_t> offsets;
+	std::vector<size_t> immediateSizes;
+	for (DisassembledInstruction const& instruction: instructions(bytesConstRef(&code), evmVersion))
+	{
+		offsets.push_back(instruction.offset);
+		immediateSizes.push_back(instruction.immediate.size());
+	}
+	BOOST_CHECK((offsets == std::vector<size_t>{0, 3, 4, 5}));
+	BOOST_CHECK((immediateSizes == std::vector<size_t>{2, 0, 0, 1}));
+
+	std::string const expectation = disassemble(code, evmVersion);
+	BOOST_CHECK_EQUAL(expectation, "PUSH2 0x102 INVALID STOP PUSH2 0x300 ");
+
+	std::string output = "prefix ";
+	disassemble(bytesConstRef(&code), evmVersion, output);
+	BOOST_CHECK_EQUAL(output, "prefix " + expectation);
+
+	bytes const other{0x60, 0x00, 0x56};
+	std::vector<std::string> results;
+	disassemble(
+		{bytesConstRef(&code), bytesConstRef(&other)},
+		evmVersion,
+		[&](size_t _index, std::string_view _disassembly) {
+			BOOST_CHECK_EQUAL(_index, results.size());
+			results.emplace_back(_disassembly);
+		}
+	);
+	BOOST_CHECK((results == std::vector<std::string>{expectation, "PUSH1 0x0 JUMP "}));
+}
+
+BOOST_AUTO_TEST_CASE(dupn_swapn)
+{
+	langutil::EVMVersion evmVersion = solidity::test::CommonOptions::get().evmVersion();
+	Assembly assembly{evmVersion, false, {}};
+	assembly.append(u256(1));
+	assembly.append(AssemblyItem(AssemblyItemType::DupN, 17));
+	assembly.append(AssemblyItem(AssemblyItemType::SwapN, 20));
+	BOOST_CHECK_EQUAL(AssemblyItem(AssemblyItemType::DupN, 17).toAssemblyText(assembly), "dupn(17)");
+	BOOST_CHECK_EQUAL(AssemblyItem(AssemblyItemType::SwapN, 20).toAssemblyText(assembly), "swapn(20)");
+
+	// The immediate is the depth reduced by one.
+	bytes const code = assembly.assemble().bytecode;
+	BOOST_CHECK((code == bytes{0x60, 0x01, 0xe6, 0x10, 0xe7, 0x13}));
+
+	InstructionInfo const& dupN = instructionInfo(Instruction::DUPN, evmVersion);
+	BOOST_CHECK(isValidInstruction(Instruction::DUPN));
+	BOOST_CHECK(isValidInstruction(Instruction::SWAPN));
+	BOOST_CHECK_EQUAL(dupN.name, "DUPN");
+	BOOST_CHECK_EQUAL(dupN.additional, 1);
+	BOOST_CHECK_EQUAL(disassemble(code, evmVersion), "PUSH1 0x1 DUPN 0x10 SWAPN 0x13 ");
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // end namespaces
@@ -24,6 +24,7 @@
 #include <test/Common.h>
 
 #include <libevmasm/CommonSubexpressionEliminator.h>
+#include <libevmasm/ConstantOptimiser.h>
 #include <libevmasm/PeepholeOptimiser.h>
 #include <libevmasm/Inliner.h>
 #include <libevmasm/JumpdestRemover.h>
@@ -194,6 +195,35 @@ BOOST_AUTO_TEST_CASE(cse_assign_immutable_breaks)
 	BOOST_REQUIRE(cse.feedItems(input.begin(), input.end(), false) == input.begin() + 2);
 }
 
+BOOST_AUTO_TEST_CASE(cse_budget)
+{
+	AssemblyItems input = addDummyLocations(AssemblyItems{
+		u256(1),
+		u256(2),
+		Instruction::ADD,
+		u256(3),
+		Instruction::MUL,
+		Instruction::CALLVALUE,
+		Instruction::ADD
+	});
+
+	evmasm::CommonSubexpressionEliminator unlimited{evmasm::KnownState()};
+	BOOST_CHECK(unlimited.feedItems(input.begin(), input.end(), false) == input.end());
+	BOOST_CHECK(!unlimited.budgetExceeded());
+
+	evmasm::CommonSubexpressionEliminator limitedSize{evmasm::KnownState()};
+	BOOST_CHECK(limitedSize.feedItems(input.begin(), input.end(), false, 4) == input.begin() + 4);
+	BOOST_CHECK(limitedSize.budgetExceeded());
+	AssemblyItems output = limitedSize.getOptimizedItems();
+	AssemblyItems expectation{u256(3), Instruction::DUP1};
+	BOOST_CHECK_EQUAL_COLLECTIONS(expectation.begin(), expectation.end(), output.begin(), output.end());
+
+	// The first three items create the classes of 1, 2 and 3 = 1 + 2.
+	evmasm::CommonSubexpressionEliminator limitedClasses{evmasm::KnownState()};
+	BOOST_CHECK(limitedClasses.feedItems(input.begin(), input.end(), false, 2000, 3) == input.begin() + 3);
+	BOOST_CHECK(limitedClasses.budgetExceeded());
+}
+
 BOOST_AUTO_TEST_CASE(cse_intermediate_swap)
 {
 	evmasm::KnownState state;
@@ -1048,6 +1078,32 @@ BOOST_AUTO_TEST_CASE(peephole_pop_calldatasize)
 	BOOST_CHECK(items.empty());
 }
 
+BOOST_AUTO_TEST_CASE(peephole_repeated_runs)
+{
+	// Each run only enables the next change next to the previous one, so this
+	// checks that later runs revisit the items around the changes.
+	AssemblyItems filler{u256(7), u256(8), Instruction::SSTORE};
+	AssemblyItems items = filler;
+	for (auto const& item: AssemblyItems{u256(1), u256(2), u256(3), Instruction::ADD, Instruction::ADD, Instruction::POP})
+		items.push_back(item);
+	for (auto const& item: filler)
+		items.push_back(item);
+	AssemblyItems expectation = filler;
+	for (auto const& item: filler)
+		expectation.push_back(item);
+
+	PeepholeOptimiser peepOpt(items);
+	size_t runs = 0;
+	while (peepOpt.optimise())
+		BOOST_REQUIRE(++runs < 10);
+	BOOST_CHECK_EQUAL(runs, 5);
+	BOOST_CHECK_EQUAL_COLLECTIONS(
+		items.begin(), items.end(),
+		expectation.begin(), expectation.end()
+	);
+	BOOST_CHECK(!peepOpt.optimise());
+}
+
 BOOST_AUTO_TEST_CASE(peephole_commutative_swap1)
 {
 	std::vector<Instruction> ops{
@@ -1242,6 +1298,22 @@ BOOST_AUTO_TEST_CASE(jumpdest_removal)
 	);
 }
 
+BOOST_AUTO_TEST_CASE(jumpdest_removal_referenced_tags_of_subs)
+{
+	AssemblyItems items{
+		AssemblyItem(PushTag, 1),
+		AssemblyItem(PushTag, 2).toSubAssemblyTag(0),
+		AssemblyItem(PushTag, 3).toSubAssemblyTag(2),
+		AssemblyItem(PushTag, 4).toSubAssemblyTag(0),
+		AssemblyItem(PushTag, 5).toSubAssemblyTag(7),
+	};
+	std::vector<std::set<size_t>> expectation{{2, 4}, {}, {3}};
+	std::vector<std::set<size_t>> referencedTags = JumpdestRemover::referencedTagsOfSubs(items, 3);
+	BOOST_CHECK(referencedTags == expectation);
+	for (size_t subId = 0; subId < 3; ++subId)
+		BOOST_CHECK(referencedTags[subId] == JumpdestRemover::referencedTags(items, subId));
+}
+
 BOOST_AUTO_TEST_CASE(jumpdest_removal_subassemblies)
 {
 	// This tests that tags from subassemblies are not removed
@@ -1915,6 +1987,26 @@ BOOST_AUTO_TEST_CASE(inliner_invalid)
 }
 
 
+BOOST_AUTO_TEST_CASE(constant_optimiser_cache)
+{
+	langutil::EVMVersion evmVersion = solidity::test::CommonOptions::get().evmVersion();
+	u256 const mask = (u256(0x1234) << 200) - 1;
+	auto optimise = [&]() {
+		Assembly assembly(evmVersion, false, std::string{});
+		assembly.append(mask);
+		assembly.append(Instruction::AND);
+		assembly.append(mask);
+		ConstantOptimisationMethod::optimiseConstants(false, 200, evmVersion, assembly);
+		return assembly.items();
+	};
+
+	AssemblyItems const first = optimise();
+	size_t const hits = ConstantOptimisationMethod::cacheStatistics().hits;
+	AssemblyItems const second = optimise();
+	BOOST_CHECK_EQUAL(ConstantOptimisationMethod::cacheStatistics().hits, hits + 1);
+	BOOST_CHECK_EQUAL_COLLECTIONS(first.begin(), first.end(), second.begin(), second.end());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // end namespaces
@@ -130,6 +130,31 @@ BOOST_AUTO_TEST_CASE(translateLineColumnToPosition)
 	BOOST_CHECK_EQUAL(toPosition(2, 2, "ABC\nDEF\nGHI\n"), 10);
 }
 
+BOOST_AUTO_TEST_CASE(translatePositionToLineColumn)
+{
+	CharStream stream{"ABC\nDEF\n\nGHI", "source"};
+	auto check = [&](int _position, int _line, int _column) {
+		LineColumn lineColumn = stream.translatePositionToLineColumn(_position);
+		BOOST_CHECK_EQUAL(lineColumn.line, _line);
+		BOOST_CHECK_EQUAL(lineColumn.column, _column);
+	};
+
+	check(0, 0, 0);
+	check(2, 0, 2);
+	check(3, 0, 3);
+	check(4, 1, 0);
+	check(7, 1, 3);
+	check(8, 2, 0);
+	check(9, 3, 0);
+	check(11, 3, 2);
+	// Positions past the end are clamped to the end of the source.
+	check(12, 3, 3);
+	check(100, 3, 3);
+
+	BOOST_CHECK_EQUAL(CharStream("", "source").translatePositionToLineColumn(0).line, 0);
+	BOOST_CHECK_EQUAL(CharStream("", "source").translatePositionToLineColumn(0).column, 0);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }
@@ -30,6 +30,7 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include <mutex>
 #include <string>
 
 
@@ -112,6 +113,46 @@ BOOST_AUTO_TEST_CASE(context_dependent_remappings_order_independent_2)
 	BOOST_CHECK(c.compile());
 }
 
+BOOST_AUTO_TEST_CASE(concurrent_import_reads)
+{
+	std::mutex mutex;
+	std::map<std::string, size_t> reads;
+	auto readFile = [&](std::string const& _kind, std::string const& _path) -> ReadCallback::Result {
+		BOOST_REQUIRE(_kind == ReadCallback::kindString(ReadCallback::Kind::ReadFile));
+		std::lock_guard<std::mutex> lock(mutex);
+		++reads[_path];
+		if (_path == "missing.sol")
+			return {false, "Not found."};
+		return {true, "contract " + _path.substr(0, 1) + " {} pragma solidity >=0.0;"};
+	};
+
+	CompilerStack c(readFile);
+	c.setParallelism(4);
+	c.setConcurrentImportReads(true);
+	c.setSources({
+		{"main.sol", "import \"a.sol\"; import \"b.sol\"; import \"c.sol\"; import \"a.sol\"; import \"d.sol\"; import \"e.sol\"; contract Main {} pragma solidity >=0.0;"}
+	});
+	c.setEVMVersion(solidity::test::CommonOptions::get().evmVersion());
+	BOOST_CHECK(c.compile());
+	BOOST_CHECK(reads == (std::map<std::string, size_t>{{"a.sol", 1}, {"b.sol", 1}, {"c.sol", 1}, {"d.sol", 1}, {"e.sol", 1}}));
+
+	reads.clear();
+	CompilerStack d(readFile);
+	d.setParallelism(4);
+	d.setConcurrentImportReads(true);
+	d.setSources({
+		{"main.sol", "import \"a.sol\"; import \"missing.sol\"; import \"missing.sol\"; contract Main {} pragma solidity >=0.0;"}
+	});
+	d.setEVMVersion(solidity::test::CommonOptions::get().evmVersion());
+	BOOST_CHECK(!d.compile());
+	size_t parserErrors = 0;
+	for (auto const& error: d.errors())
+		if (error->type() == langutil::Error::Type::ParserError)
+			++parserErrors;
+	BOOST_CHECK_EQUAL(parserErrors, 2);
+	BOOST_CHECK(reads == (std::map<std::string, size_t>{{"a.sol", 1}, {"missing.sol", 1}}));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // end namespaces
@@ -64,6 +64,17 @@ Json compile(std::string const& _input, CStyleReadFileCallback _callback = nullp
 	return ret;
 }
 
+Json compileBatch(std::string const& _inputs)
+{
+	char* output_ptr = solidity_compile_batch(_inputs.c_str(), nullptr, nullptr);
+	std::string output(output_ptr);
+	solidity_free(output_ptr);
+	solidity_reset();
+	Json ret;
+	BOOST_REQUIRE(util::jsonParseStrict(output, ret));
+	return ret;
+}
+
 char* stringToSolidity(std::string const& _input)
 {
 	char* ptr = solidity_alloc(_input.length());
@@ -178,6 +189,47 @@ BOOST_AUTO_TEST_CASE(with_callback)
 	BOOST_CHECK(containsError(result, "ParserError", "Source \"notfound.sol\" not found: Callback not supported."));
 }
 
+BOOST_AUTO_TEST_CASE(batch_compilation)
+{
+	char const* input = R"(
+	[
+		{
+			"language": "Solidity",
+			"sources": {
+				"fileA": {
+					"content": "contract A { }"
+				}
+			},
+			"settings": {
+				"outputSelection": { "*": { "*": ["evm.bytecode.object"] } }
+			}
+		},
+		{
+			"language": "Solidity",
+			"sources": {
+				"fileB": {
+					"content": "import \"missing.sol\"; contract B { }"
+				}
+			}
+		}
+	]
+	)";
+	Json result = compileBatch(input);
+	BOOST_REQUIRE(result.is_array());
+	BOOST_REQUIRE(result.size() == 2);
+
+	BOOST_CHECK(result[0]["contracts"]["fileA"]["A"]["evm"]["bytecode"]["object"].is_string());
+	BOOST_CHECK(!result[1].contains("contracts"));
+	BOOST_CHECK(containsError(result[1], "ParserError", "Source \"missing.sol\" not found: File not supplied initially."));
+}
+
+BOOST_AUTO_TEST_CASE(batch_compilation_invalid_input)
+{
+	Json result = compileBatch(R"({"language": "Solidity"})");
+	BOOST_REQUIRE(result.is_object());
+	BOOST_CHECK(containsError(result, "JSONError", "Input must be an array of standard JSON inputs."));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // end namespaces
@@ -3837,6 +3837,42 @@ BOOST_AUTO_TEST_CASE(strip_reason_strings)
 	)
 }
 
+BOOST_AUTO_TEST_CASE(restore_snapshot)
+{
+	char const* sourceCode = R"(
+		contract C {
+			uint public x = 1;
+			event Set(uint);
+			function set(uint _x) public { x = _x; emit Set(_x); }
+			function create() public returns (address) { return address(new D()); }
+		}
+		contract D {}
+	)";
+	ALSO_VIA_YUL(
+		compileAndRun(sourceCode, 0, "C");
+		Snapshot const deployed = snapshot();
+		h160 const deployedAddress = m_contractAddress;
+
+		bytes firstCreated;
+		for (u256 value: {u256(2), u256(3)})
+		{
+			callContractFunction("set(uint256)", value);
+			ABI_CHECK(callContractFunction("x()"), encodeArgs(value));
+			// The nonce of the contract is restored as well, so the same address is used again.
+			bytes const created = callContractFunction("create()");
+			if (firstCreated.empty())
+				firstCreated = created;
+			else
+				ABI_CHECK(created, firstCreated);
+			setAccount(1);
+			restore(deployed);
+			BOOST_CHECK_EQUAL(m_contractAddress, deployedAddress);
+			BOOST_CHECK_EQUAL(m_sender, account(0));
+			ABI_CHECK(callContractFunction("x()"), encodeArgs(1));
+		}
+	)
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // end namespaces
@@ -28,7 +28,11 @@
 #include <libyul/Exceptions.h>
 #include <liblangutil/Exceptions.h>
 #include <liblangutil/SourceReferenceFormatter.h>
+#include <libsolidity/interface/CompilationCache.h>
+#include <libsolutil/CommonData.h>
+#include <libsolutil/Keccak256.h>
 
+#include <boost/dll/runtime_symbol_info.hpp>
 #include <boost/test/framework.hpp>
 
 #include <cstdlib>
@@ -40,6 +44,31 @@ using namespace solidity::frontend::test;
 using namespace solidity::langutil;
 using namespace solidity::test;
 
+namespace
+{
+
+/// @returns a string that changes whenever the running test binary is rebuilt, so that bytecode
+/// cached by a different build of the compiler is never used, or an empty string if it is unknown.
+std::string const& testBinaryIdentity()
+{
+	static std::string const identity = []() -> std::string {
+		boost::system::error_code error;
+		boost::filesystem::path const executable = boost::dll::program_location(error);
+		if (error)
+			return {};
+		std::uintmax_t const size = boost::filesystem::file_size(executable, error);
+		if (error)
+			return {};
+		std::time_t const modified = boost::filesystem::last_write_time(executable, error);
+		if (error)
+			return {};
+		return executable.string() + ":" + std::to_string(size) + ":" + std::to_string(modified);
+	}();
+	return identity;
+}
+
+}
+
 bytes SolidityExecutionFramework::multiSourceCompileContract(
 	std::map<std::string, std::string> const& _sourceCode,
 	std::optional<std::string> const& _mainSourceName,
@@ -68,7 +97,30 @@ bytes SolidityExecutionFramework::multiSourceCompileContract(
 	}
 	m_compiler.setMetadataHash(m_metadataHash);
 
-	if (!m_compiler.compile())
+	// The metadata covers the sources and all settings that influence the bytecode.
+	std::optional<CompilationCache> cache;
+	if (m_cacheBytecode && !CommonOptions::get().bytecodeCacheDir.empty() && !testBinaryIdentity().empty())
+		cache.emplace(CommonOptions::get().bytecodeCacheDir);
+	std::optional<util::h256> cacheKey;
+
+	bool success = true;
+	if (cache)
+	{
+		success = m_compiler.parseAndAnalyze();
+		if (success)
+		{
+			std::string contractName(_contractName.empty() ? m_compiler.lastContractName(_mainSourceName) : _contractName);
+			cacheKey = util::keccak256(testBinaryIdentity() + "\n" + contractName + "\n" + m_compiler.metadata(contractName));
+			if (std::optional<std::string> cachedBytecode = cache->load(*cacheKey))
+			{
+				if (m_showMetadata)
+					std::cout << "metadata: " << m_compiler.metadata(contractName) << std::endl;
+				return util::asBytes(*cachedBytecode);
+			}
+		}
+	}
+
+	if (!success || !m_compiler.compile())
 	{
 		// The testing framework expects an exception for
 		// "unimplemented" yul IR generation.
@@ -85,6 +137,8 @@ bytes SolidityExecutionFramework::multiSourceCompileContract(
 	BOOST_REQUIRE(obj.linkReferences.empty());
 	if (m_showMetadata)
 		std::cout << "metadata: " << m_compiler.metadata(contractName) << std::endl;
+	if (cacheKey)
+		cache->store(*cacheKey, util::asString(obj.bytecode));
 	return obj.bytecode;
 }
 
@@ -86,6 +86,10 @@ protected:
 	bool m_compileViaYul = false;
 	bool m_showMetadata = false;
 	bool m_appendCBORMetadata = true;
+	/// Whether to use the bytecode cache given by ``--bytecode-cache-dir``. The compiler then only
+	/// runs the analysis for cached contracts, so this can only be set by tests that do not access
+	/// anything else than the bytecode and analysis results.
+	bool m_cacheBytecode = false;
 	CompilerStack::MetadataHash m_metadataHash = CompilerStack::MetadataHash::IPFS;
 	RevertStrings m_revertStrings = RevertStrings::Default;
 };
@@ -245,6 +245,44 @@ BOOST_AUTO_TEST_CASE(encoded_sizes)
 	BOOST_CHECK_EQUAL(twoDimArray.calldataEncodedSize(false), 9 * 3 * 32);
 }
 
+BOOST_AUTO_TEST_CASE(composite_types_are_shared)
+{
+	Type const* uint8 = TypeProvider::uint(8);
+	ArrayType const* dynamicArray = TypeProvider::array(DataLocation::Memory, uint8);
+	BOOST_CHECK(TypeProvider::array(DataLocation::Memory, uint8) == dynamicArray);
+	BOOST_CHECK(TypeProvider::array(DataLocation::Storage, uint8) != dynamicArray);
+
+	ArrayType const* staticArray = TypeProvider::array(DataLocation::Memory, uint8, 3);
+	BOOST_CHECK(TypeProvider::array(DataLocation::Memory, uint8, 3) == staticArray);
+	BOOST_CHECK(TypeProvider::array(DataLocation::Memory, uint8, 4) != staticArray);
+	BOOST_CHECK(TypeProvider::withLocation(staticArray, DataLocation::CallData, true) == TypeProvider::withLocation(staticArray, DataLocation::CallData, true));
+
+	BOOST_CHECK(TypeProvider::array(DataLocation::CallData, true) == TypeProvider::array(DataLocation::CallData, true));
+
+	MappingType const* mapping = TypeProvider::mapping(uint8, "a", dynamicArray, "");
+	BOOST_CHECK(TypeProvider::mapping(uint8, "a", dynamicArray, "") == mapping);
+	BOOST_CHECK(TypeProvider::mapping(uint8, "b", dynamicArray, "") != mapping);
+
+	TupleType const* tuple = TypeProvider::tuple({uint8, dynamicArray, nullptr});
+	BOOST_CHECK(TypeProvider::tuple({uint8, dynamicArray, nullptr}) == tuple);
+	BOOST_CHECK(TypeProvider::tuple({uint8, dynamicArray}) != tuple);
+
+	BOOST_CHECK(TypeProvider::typeType(uint8) == TypeProvider::typeType(uint8));
+	BOOST_CHECK(TypeProvider::typeType(uint8) != TypeProvider::typeType(dynamicArray));
+}
+
+BOOST_AUTO_TEST_CASE(declaration_types_are_shared)
+{
+	int64_t id = 0;
+	ContractDefinition c(++id, SourceLocation{}, std::make_shared<std::string>("C"), SourceLocation{}, {}, {}, {}, ContractKind::Contract);
+	BOOST_CHECK(c.type() == c.type());
+
+	EnumDefinition e(++id, {}, std::make_shared<std::string>("E"), {}, {}, {});
+	auto value = std::make_shared<EnumValue>(++id, SourceLocation{}, std::make_shared<std::string>("A"));
+	value->annotation().scope = &e;
+	BOOST_CHECK(value->type() == dynamic_cast<TypeType const&>(*e.type()).actualType());
+}
+
 BOOST_AUTO_TEST_CASE(helper_bool_result)
 {
 	BoolResult r1{true};
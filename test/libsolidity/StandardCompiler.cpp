@@ -22,16 +22,20 @@
 
 #include <string>
 #include <boost/test/unit_test.hpp>
+#include <boost/algorithm/string/predicate.hpp>
 #include <boost/algorithm/string/replace.hpp>
 #include <libsolidity/interface/OptimiserSettings.h>
 #include <libsolidity/interface/StandardCompiler.h>
 #include <libsolidity/interface/Version.h>
 #include <libsolutil/JSON.h>
+#include <libsolutil/Keccak256.h>
 #include <libsolutil/CommonData.h>
 #include <test/Metadata.h>
 
 #include <algorithm>
+#include <map>
 #include <set>
+#include <sstream>
 
 using namespace solidity::evmasm;
 using namespace std::string_literals;
@@ -347,6 +351,155 @@ BOOST_AUTO_TEST_CASE(optimizer_runs_not_an_unsigned_number)
 	BOOST_CHECK(containsError(result, "JSONError", "The \"runs\" setting must be an unsigned number."));
 }
 
+BOOST_AUTO_TEST_CASE(optimizer_time_budget_not_an_unsigned_number)
+{
+	char const* input = R"(
+	{
+		"language": "Solidity",
+		"settings": {
+			"optimizer": {
+				"enabled": true,
+				"timeBudget": -1
+			}
+		},
+		"sources": {
+			"empty": {
+				"content": ""
+			}
+		}
+	}
+	)";
+	Json result = compile(input);
+	BOOST_CHECK(containsError(result, "JSONError", "The \"timeBudget\" setting must be an unsigned number."));
+}
+
+BOOST_AUTO_TEST_CASE(optimizer_time_budget_exceeded)
+{
+	auto compileWithBudget = [](std::string const& _budget) {
+		std::string input = R"(
+		{
+			"language": "Solidity",
+			"settings": {
+				"viaIR": true,
+				"optimizer": { "enabled": true)" + _budget + R"( },
+				"outputSelection": { "*": { "*": ["evm.bytecode.object"] } }
+			},
+			"sources": {
+				"A.sol": {
+					"content": "// SPDX-License-Identifier: GPL-3.0\npragma solidity >=0.0; contract A { function f(uint x) public pure returns (uint) { return x * 2; } }"
+				}
+			}
+		}
+		)";
+		return compile(input);
+	};
+
+	auto budgetWarnings = [](Json const& _result) {
+		size_t count = 0;
+		for (Json const& error: _result.value("errors", Json::array()))
+			if (error["errorCode"] == "4521")
+			{
+				BOOST_CHECK_EQUAL(error["severity"], "warning");
+				++count;
+			}
+		return count;
+	};
+
+	// A budget of zero skips the whole optimisation sequence, but still produces valid code.
+	Json result = compileWithBudget(R"(, "timeBudget": 0)");
+	BOOST_REQUIRE(containsAtMostWarnings(result));
+	BOOST_CHECK_EQUAL(budgetWarnings(result), 1);
+	std::string const limitedBytecode = result["contracts"]["A.sol"]["A"]["evm"]["bytecode"]["object"].get<std::string>();
+	BOOST_CHECK(!limitedBytecode.empty());
+
+	result = compileWithBudget(R"(, "timeBudget": 3600000)");
+	BOOST_REQUIRE(containsAtMostWarnings(result));
+	BOOST_CHECK_EQUAL(budgetWarnings(result), 0);
+	result = compileWithBudget("");
+	BOOST_REQUIRE(containsAtMostWarnings(result));
+	BOOST_CHECK_EQUAL(budgetWarnings(result), 0);
+	BOOST_CHECK(result["contracts"]["A.sol"]["A"]["evm"]["bytecode"]["object"].get<std::string>() != limitedBytecode);
+}
+
+BOOST_AUTO_TEST_CASE(optimizer_time_budget_exceeded_yul)
+{
+	char const* input = R"(
+	{
+		"language": "Yul",
+		"settings": {
+			"optimizer": { "enabled": true, "timeBudget": 0 },
+			"outputSelection": { "*": { "*": ["evm.bytecode.object"] } }
+		},
+		"sources": {
+			"A": {
+				"content": "{ let x := 1 sstore(0, add(x, 2)) }"
+			}
+		}
+	}
+	)";
+	Json result = compile(input);
+	BOOST_REQUIRE(containsAtMostWarnings(result));
+	BOOST_REQUIRE_EQUAL(result["errors"].size(), 1);
+	BOOST_CHECK_EQUAL(result["errors"][0]["errorCode"], "6832");
+	Json contractResult = getContractResult(result, "A", "object");
+	BOOST_CHECK(!contractResult["evm"]["bytecode"]["object"].get<std::string>().empty());
+}
+
+BOOST_AUTO_TEST_CASE(optimizer_execution_profile_not_an_unsigned_number)
+{
+	char const* input = R"(
+	{
+		"language": "Solidity",
+		"settings": {
+			"optimizer": {
+				"enabled": true,
+				"details": {
+					"yul": true,
+					"yulDetails": {
+						"executionProfile": {"fun_f_12": "often"}
+					}
+				}
+			}
+		},
+		"sources": {
+			"empty": {
+				"content": ""
+			}
+		}
+	}
+	)";
+	Json result = compile(input);
+	BOOST_CHECK(containsError(
+		result,
+		"JSONError",
+		"The number of executions of \"fun_f_12\" in \"settings.optimizer.details.yulDetails.executionProfile\" must be an unsigned number."
+	));
+}
+
+BOOST_AUTO_TEST_CASE(optimizer_dispatch_profile_not_an_object)
+{
+	char const* input = R"**(
+	{
+		"language": "Solidity",
+		"settings": {
+			"optimizer": {
+				"enabled": true,
+				"details": {
+					"dispatchProfile": ["transfer(address,uint256)"]
+				}
+			}
+		},
+		"sources": {
+			"empty": {
+				"content": ""
+			}
+		}
+	}
+	)**";
+	Json result = compile(input);
+	BOOST_CHECK(containsError(result, "JSONError", "\"settings.optimizer.details.dispatchProfile\" must be an object."));
+}
+
 BOOST_AUTO_TEST_CASE(basic_compilation)
 {
 	char const* input = R"(
@@ -1225,6 +1378,80 @@ BOOST_AUTO_TEST_CASE(optimizer_settings_details_different)
 	BOOST_CHECK(optimizer["runs"].get<unsigned>() == 600);
 }
 
+BOOST_AUTO_TEST_CASE(optimizer_settings_execution_profile)
+{
+	char const* input = R"(
+	{
+		"language": "Solidity",
+		"settings": {
+			"viaIR": true,
+			"optimizer": {
+				"enabled": true,
+				"details": {
+					"yul": true,
+					"yulDetails": {
+						"executionProfile": {"fun_f_12": 100000, "fun_g_20": 1}
+					}
+				}
+			}
+		},
+		"sources": {
+			"fileA": {
+				"content": "contract A { }"
+			}
+		}
+	}
+	)";
+	Json result = compile(input);
+	BOOST_CHECK(containsAtMostWarnings(result));
+	Json contract = getContractResult(result, "fileA", "A");
+	BOOST_CHECK(contract.is_object());
+	BOOST_CHECK(contract["metadata"].is_string());
+	Json metadata;
+	BOOST_CHECK(util::jsonParseStrict(contract["metadata"].get<std::string>(), metadata));
+
+	Json const& profile = metadata["settings"]["optimizer"]["details"]["yulDetails"]["executionProfile"];
+	BOOST_CHECK(profile.is_object());
+	BOOST_CHECK_EQUAL(profile.size(), 2);
+	BOOST_CHECK(profile["fun_f_12"].get<unsigned>() == 100000);
+	BOOST_CHECK(profile["fun_g_20"].get<unsigned>() == 1);
+}
+
+BOOST_AUTO_TEST_CASE(optimizer_settings_exhaustive_stack_layout_search)
+{
+	char const* input = R"(
+	{
+		"language": "Solidity",
+		"settings": {
+			"viaIR": true,
+			"optimizer": {
+				"enabled": true,
+				"details": {
+					"yul": true,
+					"yulDetails": {
+						"exhaustiveStackLayoutSearch": true
+					}
+				}
+			},
+			"outputSelection": { "*": { "*": ["metadata", "evm.bytecode.object"] } }
+		},
+		"sources": {
+			"fileA": {
+				"content": "contract A { function f(uint a, uint b, uint c) public pure returns (uint) { if (a > b) return c - a; return b * c; } }"
+			}
+		}
+	}
+	)";
+	Json result = compile(input);
+	BOOST_CHECK(containsAtMostWarnings(result));
+	Json contract = getContractResult(result, "fileA", "A");
+	BOOST_CHECK(contract.is_object());
+	BOOST_CHECK(!contract["evm"]["bytecode"]["object"].get<std::string>().empty());
+	Json metadata;
+	BOOST_CHECK(util::jsonParseStrict(contract["metadata"].get<std::string>(), metadata));
+	BOOST_CHECK(metadata["settings"]["optimizer"]["details"]["yulDetails"]["exhaustiveStackLayoutSearch"].get<bool>());
+}
+
 BOOST_AUTO_TEST_CASE(metadata_without_compilation)
 {
 	// NOTE: the contract code here should fail to compile due to "out of stack"
@@ -1783,6 +2010,441 @@ BOOST_AUTO_TEST_CASE(source_location_of_bare_block)
 	BOOST_REQUIRE(sourceMap.find(sourceRef) != std::string::npos);
 }
 
+BOOST_AUTO_TEST_CASE(parallelism_not_a_positive_number)
+{
+	for (std::string value: {"0", "-1", "\"4\"", "true"})
+	{
+		std::string input = R"(
+		{
+			"language": "Solidity",
+			"settings": {
+				"parallelism": )" + value + R"(
+			},
+			"sources": {
+				"empty": {
+					"content": ""
+				}
+			}
+		}
+		)";
+		Json result = compile(input);
+		BOOST_CHECK(containsError(result, "JSONError", "\"settings.parallelism\" must be a positive integer."));
+	}
+}
+
+BOOST_AUTO_TEST_CASE(parallelism_does_not_affect_output)
+{
+	auto inputWithParallelism = [](size_t _jobs) {
+		return R"(
+		{
+			"language": "Solidity",
+			"settings": {
+				"viaIR": true,
+				"optimizer": { "enabled": true },
+				"parallelism": )" + std::to_string(_jobs) + R"(,
+				"outputSelection": { "*": { "*": ["evm.bytecode", "evm.deployedBytecode", "irOptimized", "metadata"] } }
+			},
+			"sources": {
+				"A.sol": {
+					"content": "contract A { function f() public returns (address) { return address(new B()); } } contract B { uint public x = 7; }"
+				},
+				"C.sol": {
+					"content": "import \"A.sol\"; contract C is B { function g() public view returns (uint) { return x + 1; } } contract D { function h() public returns (bytes memory) { new A(); return type(C).creationCode; } }"
+				}
+			}
+		}
+		)";
+	};
+
+	Json sequentialResult = compile(inputWithParallelism(1));
+	BOOST_REQUIRE(containsAtMostWarnings(sequentialResult));
+	for (size_t jobs: std::vector<size_t>{2, 4, 16})
+	{
+		Json parallelResult = compile(inputWithParallelism(jobs));
+		BOOST_REQUIRE(containsAtMostWarnings(parallelResult));
+		BOOST_CHECK_EQUAL(util::jsonCompactPrint(parallelResult), util::jsonCompactPrint(sequentialResult));
+	}
+}
+
+BOOST_AUTO_TEST_CASE(optimizer_profile)
+{
+	char const* input = R"(
+	{
+		"language": "Solidity",
+		"settings": {
+			"viaIR": true,
+			"optimizer": { "enabled": true },
+			"outputSelection": {
+				"A.sol": { "A": ["irOptimizerProfile"] },
+				"B.sol": { "*": ["*"] }
+			}
+		},
+		"sources": {
+			"A.sol": {
+				"content": "contract A { function f(uint x) public pure returns (uint) { return x * 2; } }"
+			},
+			"B.sol": {
+				"content": "contract B { function g(uint x) public pure returns (uint) { return x + 1; } }"
+			}
+		}
+	}
+	)";
+	Json result = compile(input);
+	BOOST_REQUIRE(containsAtMostWarnings(result));
+
+	Json const& profile = result["contracts"]["A.sol"]["A"]["irOptimizerProfile"];
+	// Creation and deployed object.
+	BOOST_REQUIRE(profile.is_object());
+	BOOST_REQUIRE_EQUAL(profile.size(), 2);
+	for (auto const& [objectName, objectProfile]: profile.items())
+	{
+		BOOST_CHECK(boost::starts_with(objectName, "A_"));
+		Json const& steps = objectProfile["steps"];
+		BOOST_REQUIRE(steps.contains("ExpressionSimplifier"));
+		BOOST_CHECK(steps["ExpressionSimplifier"]["invocations"].get<size_t>() > 0);
+		BOOST_CHECK(steps["ExpressionSimplifier"]["codeSizeBefore"].get<size_t>() > 0);
+		BOOST_CHECK(!objectProfile["rounds"].empty());
+	}
+
+	// The profile is not deterministic and hence not matched by the wildcard.
+	BOOST_CHECK(!result["contracts"]["B.sol"]["B"].contains("irOptimizerProfile"));
+}
+
+BOOST_AUTO_TEST_CASE(ir_optimized_gas_estimates)
+{
+	char const* input = R"(
+	{
+		"language": "Solidity",
+		"settings": {
+			"viaIR": true,
+			"outputSelection": {
+				"A.sol": { "A": ["irOptimizedGasEstimates"] }
+			}
+		},
+		"sources": {
+			"A.sol": {
+				"content": "contract A { function f(uint x) public pure returns (uint) { return x * 2; } }"
+			}
+		}
+	}
+	)";
+	Json result = compile(input);
+	BOOST_REQUIRE(containsAtMostWarnings(result));
+
+	Json const& estimates = result["contracts"]["A.sol"]["A"]["irOptimizedGasEstimates"];
+	// Creation and deployed object.
+	BOOST_REQUIRE(estimates.is_object());
+	BOOST_REQUIRE_EQUAL(estimates.size(), 2);
+	bool foundF = false;
+	for (auto const& objectEstimates: estimates)
+		for (auto const& [functionName, function]: objectEstimates.items())
+		{
+			BOOST_REQUIRE(function["gas"].is_string());
+			if (boost::starts_with(functionName, "fun_f_"))
+			{
+				foundF = true;
+				BOOST_CHECK(std::stoul(function["gas"].get<std::string>()) > 0);
+				BOOST_REQUIRE(function["src"].is_string());
+				BOOST_CHECK(boost::ends_with(function["src"].get<std::string>(), ":0"));
+			}
+		}
+	BOOST_CHECK(foundF);
+}
+
+BOOST_AUTO_TEST_CASE(previous_metadata_hashes)
+{
+	auto compileWithPreviousHashes = [](Json const& _previousMetadataHashes) {
+		Json input = Json::parse(R"(
+		{
+			"language": "Solidity",
+			"settings": {
+				"outputSelection": { "*": { "*": ["metadata", "evm.bytecode.object"] } }
+			},
+			"sources": {
+				"A.sol": { "content": "contract A { function f() public pure returns (uint) { return 1; } }" },
+				"B.sol": { "content": "import \"A.sol\"; contract B { function g() public returns (address) { return address(new A()); } }" }
+			}
+		}
+		)");
+		if (!_previousMetadataHashes.is_null())
+			input["settings"]["previousMetadataHashes"] = _previousMetadataHashes;
+		Json result = compile(util::jsonCompactPrint(input));
+		BOOST_REQUIRE(containsAtMostWarnings(result));
+		return result["contracts"];
+	};
+	auto metadataHash = [](Json const& _contract) {
+		return "0x" + util::keccak256(_contract["metadata"].get<std::string>()).hex();
+	};
+
+	Json contracts = compileWithPreviousHashes({});
+	BOOST_CHECK(!contracts["A.sol"]["A"].contains("unchanged"));
+	std::string const hashA = metadataHash(contracts["A.sol"]["A"]);
+	std::string const hashB = metadataHash(contracts["B.sol"]["B"]);
+	std::string const bytecodeB = contracts["B.sol"]["B"]["evm"]["bytecode"]["object"].get<std::string>();
+
+	Json previous;
+	previous["A.sol"]["A"] = hashA;
+	previous["B.sol"]["B"] = "0x" + std::string(64, '0');
+	contracts = compileWithPreviousHashes(previous);
+	BOOST_CHECK(contracts["A.sol"]["A"]["unchanged"] == true);
+	BOOST_CHECK(!contracts["A.sol"]["A"].contains("evm"));
+	BOOST_CHECK_EQUAL(metadataHash(contracts["A.sol"]["A"]), hashA);
+	// The code of an unchanged contract is still generated if a changed one depends on it.
+	BOOST_CHECK(!contracts["B.sol"]["B"].contains("unchanged"));
+	BOOST_CHECK_EQUAL(contracts["B.sol"]["B"]["evm"]["bytecode"]["object"].get<std::string>(), bytecodeB);
+
+	previous["B.sol"]["B"] = hashB;
+	contracts = compileWithPreviousHashes(previous);
+	BOOST_CHECK(contracts["A.sol"]["A"]["unchanged"] == true);
+	BOOST_CHECK(contracts["B.sol"]["B"]["unchanged"] == true);
+	BOOST_CHECK(!contracts["B.sol"]["B"].contains("evm"));
+}
+
+BOOST_AUTO_TEST_CASE(previous_metadata_hashes_invalid)
+{
+	char const* input = R"(
+	{
+		"language": "Solidity",
+		"settings": {
+			"previousMetadataHashes": { "A.sol": { "A": "0x1234" } }
+		},
+		"sources": {
+			"A.sol": { "content": "contract A {}" }
+		}
+	}
+	)";
+	Json result = compile(input);
+	BOOST_CHECK(containsError(
+		result,
+		"JSONError",
+		"\"settings.previousMetadataHashes.A.sol.A\" must be a 0x-prefixed Keccak-256 hash."
+	));
+}
+
+BOOST_AUTO_TEST_CASE(trace)
+{
+	char const* input = R"(
+	{
+		"language": "Solidity",
+		"settings": {
+			"viaIR": true,
+			"optimizer": { "enabled": true },
+			"trace": true,
+			"outputSelection": { "*": { "*": ["evm.bytecode.object"] } }
+		},
+		"sources": {
+			"A.sol": {
+				"content": "contract A { function f(uint x) public pure returns (uint) { return x * 2; } }"
+			}
+		}
+	}
+	)";
+	Json result = compile(input);
+	BOOST_REQUIRE(containsAtMostWarnings(result));
+	BOOST_REQUIRE(result.contains("trace"));
+	BOOST_CHECK_EQUAL(result["trace"]["displayTimeUnit"], "ms");
+
+	std::set<std::string> phases;
+	for (Json const& event: result["trace"]["traceEvents"])
+	{
+		if (event["ph"] == "C")
+		{
+			// Peak memory usage, only reported on some platforms.
+			BOOST_CHECK_EQUAL(event["name"], "peakMemory");
+			BOOST_CHECK(event["args"]["bytes"].get<size_t>() > 0);
+			continue;
+		}
+		BOOST_CHECK_EQUAL(event["ph"], "X");
+		BOOST_CHECK(event["dur"].get<int64_t>() >= 0);
+		if (event.contains("args") && event["args"].contains("peakMemory"))
+			BOOST_CHECK(event["args"]["peakMemoryIncrease"].get<size_t>() <= event["args"]["peakMemory"].get<size_t>());
+		phases.insert(event["name"].get<std::string>());
+	}
+	for (std::string phase: {
+		"StandardCompiler::compile",
+		"Parser",
+		"TypeChecker",
+		"ViewPureChecker",
+		"IRGenerator",
+		"YulStack::optimize",
+		"Assembly::optimise",
+		"Assembly::assemble"
+	})
+		BOOST_CHECK_MESSAGE(phases.count(phase), "Missing phase " + phase);
+}
+
+BOOST_AUTO_TEST_CASE(trace_pruned_pipeline)
+{
+	auto tracedPhases = [](std::string const& _outputSelection) {
+		std::string input = R"(
+		{
+			"language": "Solidity",
+			"settings": {
+				"viaIR": true,
+				"optimizer": { "enabled": true },
+				"trace": true,
+				"outputSelection": { "A.sol": { "B": [)" + _outputSelection + R"(] } }
+			},
+			"sources": {
+				"A.sol": {
+					"content": "contract A { function f() public pure returns (uint) { return 2; } } contract B { function g() public returns (address) { return address(new A()); } }"
+				}
+			}
+		}
+		)";
+		Json result = compile(input);
+		BOOST_REQUIRE(containsAtMostWarnings(result));
+		BOOST_REQUIRE(result.contains("trace"));
+		std::multimap<std::string, std::string> phases;
+		for (Json const& event: result["trace"]["traceEvents"])
+			if (event["ph"] == "X")
+				phases.emplace(
+					event["name"].get<std::string>(),
+					event.contains("args") ? event["args"].value("target", "") : ""
+				);
+		return phases;
+	};
+
+	// Only the ABI is requested, so no code is generated.
+	auto phases = tracedPhases(R"("abi")");
+	BOOST_CHECK(phases.count("TypeChecker"));
+	for (std::string phase: {"IRGenerator", "CompilerStack::optimizeIR", "YulStack::optimize", "Assembly::assemble"})
+		BOOST_CHECK_MESSAGE(!phases.count(phase), "Unexpected phase " + phase);
+
+	// The IR of the dependency is only optimized as part of the requested contract.
+	phases = tracedPhases(R"("evm.bytecode.object")");
+	BOOST_REQUIRE_EQUAL(phases.count("CompilerStack::optimizeIR"), 1);
+	BOOST_CHECK_EQUAL(phases.find("CompilerStack::optimizeIR")->second, "A.sol:B");
+}
+
+BOOST_AUTO_TEST_CASE(trace_invalid)
+{
+	char const* input = R"(
+	{
+		"language": "Solidity",
+		"settings": { "trace": 1 },
+		"sources": { "A.sol": { "content": "contract A {}" } }
+	}
+	)";
+	Json result = compile(input);
+	BOOST_CHECK(containsError(result, "JSONError", "\"settings.trace\" must be a Boolean."));
+
+	result = compile(R"({"language": "Solidity", "sources": { "A.sol": { "content": "contract A {}" } }})");
+	BOOST_CHECK(!result.contains("trace"));
+}
+
+BOOST_AUTO_TEST_CASE(streamed_output)
+{
+	std::vector<std::string> inputs{
+		R"({
+			"language": "Solidity",
+			"settings": {
+				"outputSelection": { "*": { "*": ["abi", "evm.bytecode.object", "evm.methodIdentifiers"], "": ["ast"] } }
+			},
+			"sources": {
+				"B.sol": { "content": "pragma solidity >=0.0; contract B { function f() public {} } contract A {}" },
+				"A.sol": { "content": "pragma solidity >=0.0; import \"B.sol\"; contract C is B { uint x; }" },
+				"A": { "content": "pragma solidity >=0.0; contract Z {}" }
+			}
+		})",
+		R"({
+			"language": "Solidity",
+			"settings": { "outputSelection": { "*": { "": ["ast"] } } },
+			"sources": { "A.sol": { "content": "contract A { function f() public { uint x; } }" } }
+		})",
+		R"({"language": "Solidity", "sources": { "A.sol": { "content": "contract A { syntax error" } }})",
+		R"({"language": "Yul", "sources": { "A.yul": { "content": "{ sstore(0, 1) }" } }})",
+		"{ not json"
+	};
+	for (util::JsonFormat const& format: {
+		util::JsonFormat{util::JsonFormat::Compact},
+		util::JsonFormat{util::JsonFormat::Pretty, 4}
+	})
+		for (std::string const& input: inputs)
+		{
+			solidity::frontend::StandardCompiler compiler({}, format);
+			std::ostringstream streamed;
+			compiler.compile(input, streamed);
+			BOOST_CHECK_EQUAL(streamed.str(), compiler.compile(input));
+		}
+}
+
+BOOST_AUTO_TEST_CASE(import_callback_batch_and_prefetch)
+{
+	std::map<std::string, std::string> const files{
+		{"B.sol", "import \"D.sol\"; contract B is D {}"},
+		{"C.sol", "contract C {}"},
+		{"D.sol", "contract D {}"}
+	};
+	std::vector<std::pair<std::string, std::string>> calls;
+	auto readCallback = [&](std::string const& _kind, std::string const& _data) -> ReadCallback::Result {
+		calls.emplace_back(_kind, _data);
+		if (_kind == ReadCallback::kindString(ReadCallback::Kind::ReadFiles))
+		{
+			Json contents = Json::object();
+			for (auto const& path: Json::parse(_data))
+				if (files.count(path.get<std::string>()))
+					contents[path.get<std::string>()] = files.at(path.get<std::string>());
+			return {true, util::jsonCompactPrint(contents)};
+		}
+		if (files.count(_data))
+			return {true, files.at(_data)};
+		return {false, "not found"};
+	};
+	auto compileWith = [&](std::string const& _importCallback) {
+		std::string input = R"(
+		{
+			"language": "Solidity",
+			"settings": {
+				)" + _importCallback + R"(
+				"outputSelection": { "*": { "": ["ast"], "*": ["evm.bytecode.object"] } }
+			},
+			"sources": {
+				"A.sol": { "content": "import \"B.sol\"; import \"C.sol\"; contract A is B, C {}" }
+			}
+		}
+		)";
+		calls.clear();
+		solidity::frontend::StandardCompiler compiler(readCallback);
+		Json ret;
+		BOOST_REQUIRE(util::jsonParseStrict(compiler.compile(input), ret));
+		BOOST_REQUIRE(containsAtMostWarnings(ret));
+		return ret;
+	};
+
+	Json const unbatched = compileWith("");
+	BOOST_CHECK_EQUAL(calls.size(), 3);
+
+	Json const batched = compileWith(R"("importCallback": { "batch": true, "prefetch": ["D.sol", "E.sol"] },)");
+	// The second level is prefetched. The missing E.sol is requested once more but not reported.
+	BOOST_REQUIRE_EQUAL(calls.size(), 2);
+	BOOST_CHECK_EQUAL(calls[0].first, "sources");
+	BOOST_CHECK_EQUAL(calls[0].second, R"(["B.sol","C.sol","D.sol","E.sol"])");
+	BOOST_CHECK_EQUAL(calls[1].first, "source");
+	BOOST_CHECK_EQUAL(calls[1].second, "E.sol");
+	BOOST_CHECK(batched["sources"] == unbatched["sources"]);
+	BOOST_CHECK(batched["contracts"] == unbatched["contracts"]);
+}
+
+BOOST_AUTO_TEST_CASE(import_callback_invalid)
+{
+	std::vector<std::pair<std::string, std::string>> const cases{
+		{R"([])", "\"settings.importCallback\" must be an object."},
+		{R"({ "batch": 1 })", "\"settings.importCallback.batch\" must be a Boolean."},
+		{R"({ "prefetch": "D.sol" })", "\"settings.importCallback.prefetch\" must be an array of strings."},
+		{R"({ "prefetch": [1] })", "\"settings.importCallback.prefetch\" must be an array of strings."},
+		{R"({ "depth": 1 })", "Unknown key \"depth\""}
+	};
+	for (auto const& [importCallback, message]: cases)
+	{
+		Json result = compile(
+			R"({"language": "Solidity", "settings": {"importCallback": )" + importCallback +
+			R"(}, "sources": {"A.sol": {"content": ""}}})"
+		);
+		BOOST_CHECK(containsError(result, "JSONError", message));
+	}
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // end namespaces
@@ -31,11 +31,17 @@ contract C {
     }
 
     function f() public {
-        /// AdditionLoopExpression: isSimpleCounterLoop
-        for(uint i = 0; i < 42; i = i + 1) {
+        /// AdditionOfTwoLoopExpression: isSimpleCounterLoop
+        for(uint i = 0; i < 42; i = i + 2) {
         }
-        /// ShortHandAdditionLoopExpression: isSimpleCounterLoop
-        for(uint i = 0; i < 42; i += 1) {
+        /// ShortHandAdditionOfTwoLoopExpression: isSimpleCounterLoop
+        for(uint i = 0; i < 42; i += 2) {
+        }
+        /// AdditionOtherVariableLoopExpression: isSimpleCounterLoop
+        for(uint i = 0; i < 42; i = z + 1) {
+        }
+        /// GreaterThanCounterLHS: isSimpleCounterLoop
+        for(uint i = 1; i > 0; ++i) {
         }
         /// SimplePreDecrement: isSimpleCounterLoop
         for(uint i = 42; i > 0; --i) {
@@ -136,8 +142,10 @@ contract C {
     }
 }
 // ----
-// AdditionLoopExpression: false
-// ShortHandAdditionLoopExpression: false
+// AdditionOfTwoLoopExpression: false
+// ShortHandAdditionOfTwoLoopExpression: false
+// AdditionOtherVariableLoopExpression: false
+// GreaterThanCounterLHS: false
 // SimplePreDecrement: false
 // SimplePosDecrement: false
 // MultiplicationLoopExpression: false
@@ -12,6 +12,15 @@ contract C {
         /// SimplePosIncrement: isSimpleCounterLoop
         for(int i = 0; i < 42; i++) {
         }
+        /// AdditionLoopExpression: isSimpleCounterLoop
+        for(uint i = 0; i < 42; i = i + 1) {
+        }
+        /// ShortHandAdditionLoopExpression: isSimpleCounterLoop
+        for(uint i = 0; i < 42; i += 1) {
+        }
+        /// ReversedCondition: isSimpleCounterLoop
+        for(uint i = 0; 42 > i; ++i) {
+        }
         uint x;
         /// CounterReadLoopBody: isSimpleCounterLoop
         for(uint i = 0; i < 42; i++) {
@@ -60,6 +69,9 @@ contract C {
 // ----
 // SimplePreIncrement: true
 // SimplePosIncrement: true
+// AdditionLoopExpression: true
+// ShortHandAdditionLoopExpression: true
+// ReversedCondition: true
 // CounterReadLoopBody: true
 // LocalVarConditionRHS: true
 // EmptyInitExpression: true
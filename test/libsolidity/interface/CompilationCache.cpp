@@ -0,0 +1,135 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+/// Unit tests for libsolidity/interface/CompilationCache.h
+
+#include <libsolidity/interface/CompilationCache.h>
+#include <libsolidity/interface/CompilerStack.h>
+
+#include <test/Common.h>
+#include <test/FilesystemUtils.h>
+
+#include <libsolutil/Keccak256.h>
+#include <libsolutil/TemporaryDirectory.h>
+
+#include <boost/filesystem.hpp>
+#include <boost/test/unit_test.hpp>
+
+using namespace solidity::util;
+using namespace solidity::test;
+
+#define TEST_CASE_NAME (boost::unit_test::framework::current_test_case().p_name)
+
+namespace solidity::frontend::test
+{
+
+namespace
+{
+
+std::vector<boost::filesystem::path> cacheEntries(boost::filesystem::path const& _directory)
+{
+	std::vector<boost::filesystem::path> entries;
+	for (auto const& entry: boost::filesystem::directory_iterator(_directory))
+		entries.push_back(entry.path());
+	return entries;
+}
+
+void compileViaIR(CompilerStack& _compiler, std::string const& _sourceCode)
+{
+	_compiler.setSources({{"a.sol", _sourceCode}});
+	_compiler.setEVMVersion(CommonOptions::get().evmVersion());
+	_compiler.setEOFVersion(CommonOptions::get().eofVersion());
+	_compiler.setViaIR(true);
+	_compiler.enableIRGeneration();
+	_compiler.setOptimiserSettings(OptimiserSettings::standard());
+	BOOST_REQUIRE(_compiler.compile());
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE(CompilationCacheTest)
+
+BOOST_AUTO_TEST_CASE(load_missing_entry)
+{
+	TemporaryDirectory tempDir(TEST_CASE_NAME);
+	CompilationCache cache(tempDir.path() / "cache");
+
+	BOOST_TEST(!cache.load(keccak256("key")).has_value());
+	BOOST_TEST(!boost::filesystem::exists(tempDir.path() / "cache"));
+}
+
+BOOST_AUTO_TEST_CASE(store_and_load)
+{
+	TemporaryDirectory tempDir(TEST_CASE_NAME);
+	CompilationCache cache(tempDir.path() / "cache");
+
+	cache.store(keccak256("a"), "content of a");
+	cache.store(keccak256("b"), "");
+	BOOST_CHECK(cache.load(keccak256("a")) == std::optional<std::string>("content of a"));
+	BOOST_CHECK(cache.load(keccak256("b")) == std::optional<std::string>(""));
+	BOOST_TEST(!cache.load(keccak256("c")).has_value());
+
+	cache.store(keccak256("a"), "new content of a");
+	BOOST_CHECK(cache.load(keccak256("a")) == std::optional<std::string>("new content of a"));
+	BOOST_TEST(cacheEntries(cache.directory()).size() == 2);
+}
+
+BOOST_AUTO_TEST_CASE(compiler_stack_output_does_not_depend_on_cache)
+{
+	std::string const sourceCode = R"(
+		pragma solidity >=0.0;
+		contract C {
+			function f(uint x) public pure returns (uint) { return x * 2 + 1; }
+		}
+		contract D {
+			function g() public returns (address) { return address(new C()); }
+		}
+	)";
+
+	CompilerStack uncached;
+	compileViaIR(uncached, sourceCode);
+
+	TemporaryDirectory tempDir(TEST_CASE_NAME);
+	for (size_t run = 0; run < 3; ++run)
+	{
+		if (run == 2)
+			// Corrupted entries must be ignored.
+			for (boost::filesystem::path const& entry: cacheEntries(tempDir.path()))
+			{
+				boost::filesystem::remove(entry);
+				createFileWithContent(entry, "{");
+			}
+
+		CompilerStack cached;
+		cached.setCacheDirectory(tempDir.path());
+		compileViaIR(cached, sourceCode);
+		BOOST_TEST(!cacheEntries(tempDir.path()).empty());
+
+		for (std::string const& contractName: std::vector<std::string>{"C", "D"})
+		{
+			BOOST_TEST(cached.yulIROptimized(contractName) == uncached.yulIROptimized(contractName));
+			BOOST_TEST(cached.yulIROptimizedAst(contractName) == uncached.yulIROptimizedAst(contractName));
+			BOOST_TEST(cached.object(contractName).bytecode == uncached.object(contractName).bytecode);
+			BOOST_TEST(cached.runtimeObject(contractName).bytecode == uncached.runtimeObject(contractName).bytecode);
+		}
+	}
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
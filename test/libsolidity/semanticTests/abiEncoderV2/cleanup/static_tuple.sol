@@ -0,0 +1,20 @@
+pragma abicoder v2;
+
+contract C {
+    enum E { A, B, C }
+    function f(uint8 a, bool b, uint256 c, address d, E e, bytes2 g) external pure returns (uint256) {
+        return a + (b ? uint256(1) : 0) + c + uint160(d) + uint8(e) + uint16(g);
+    }
+    function h(uint256 a, bytes32 b) external pure returns (uint256, bytes32) {
+        return (a, b);
+    }
+}
+// ----
+// f(uint8,bool,uint256,address,uint8,bytes2): 1, 1, 2, 3, 2, left(0x0001) -> 9
+// f(uint8,bool,uint256,address,uint8,bytes2): 0x0100, 1, 2, 3, 2, left(0x0001) -> FAILURE
+// f(uint8,bool,uint256,address,uint8,bytes2): 1, 2, 2, 3, 2, left(0x0001) -> FAILURE
+// f(uint8,bool,uint256,address,uint8,bytes2): 1, 1, 2, 0x010000000000000000000000000000000000000003, 2, left(0x0001) -> FAILURE
+// f(uint8,bool,uint256,address,uint8,bytes2): 1, 1, 2, 3, 3, left(0x0001) -> FAILURE
+// f(uint8,bool,uint256,address,uint8,bytes2): 1, 1, 2, 3, 2, left(0x000101) -> FAILURE
+// f(uint8,bool,uint256,address,uint8,bytes2): 1, 1, 2, 3, 2 -> FAILURE
+// h(uint256,bytes32): -1, -1 -> -1, -1
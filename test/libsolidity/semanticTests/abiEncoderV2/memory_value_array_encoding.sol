@@ -0,0 +1,38 @@
+pragma abicoder v2;
+
+contract C {
+    function f() public pure returns (uint256[] memory x) {
+        x = new uint256[](3);
+        x[0] = 1;
+        x[1] = 2;
+        x[2] = 3;
+    }
+    function g() public pure returns (bytes32[3] memory x, uint256 y) {
+        x[0] = "a";
+        x[2] = "c";
+        y = 9;
+    }
+    function h() public pure returns (bytes memory) {
+        uint256[] memory x = new uint256[](2);
+        x[0] = 3;
+        x[1] = 4;
+        return abi.encodePacked(x);
+    }
+    function i() public pure returns (uint256[][] memory x) {
+        x = new uint256[][](2);
+        x[0] = new uint256[](1);
+        x[0][0] = 5;
+        x[1] = new uint256[](2);
+        x[1][0] = 6;
+        x[1][1] = 7;
+    }
+    function j() public pure returns (uint256[] memory) {
+        return new uint256[](0);
+    }
+}
+// ----
+// f() -> 0x20, 3, 1, 2, 3
+// g() -> 0x6100000000000000000000000000000000000000000000000000000000000000, 0, 0x6300000000000000000000000000000000000000000000000000000000000000, 9
+// h() -> 0x20, 0x40, 3, 4
+// i() -> 0x20, 2, 0x40, 0x80, 1, 5, 2, 6, 7
+// j() -> 0x20, 0
@@ -0,0 +1,41 @@
+contract C {
+    function addUint8(uint8 x) public pure returns (uint8) {
+        return x + 5;
+    }
+    function subUint8(uint8 x) public pure returns (uint8) {
+        return x - 5;
+    }
+    function constantFirst(uint16 x) public pure returns (uint16) {
+        return 300 + x;
+    }
+    function widened(uint8 x) public pure returns (uint16) {
+        return x + 300;
+    }
+    function addInt8(int8 x) public pure returns (int8) {
+        return x + (-100);
+    }
+    function subInt8(int8 x) public pure returns (int8) {
+        return x - (-128);
+    }
+    function compound(uint x) public pure returns (uint) {
+        x += 1;
+        x -= 2;
+        return x;
+    }
+}
+// ----
+// addUint8(uint8): 250 -> 255
+// addUint8(uint8): 251 -> FAILURE, hex"4e487b71", 0x11
+// subUint8(uint8): 5 -> 0
+// subUint8(uint8): 4 -> FAILURE, hex"4e487b71", 0x11
+// constantFirst(uint16): 65235 -> 65535
+// constantFirst(uint16): 65236 -> FAILURE, hex"4e487b71", 0x11
+// widened(uint8): 255 -> 555
+// addInt8(int8): 127 -> 27
+// addInt8(int8): -28 -> -128
+// addInt8(int8): -29 -> FAILURE, hex"4e487b71", 0x11
+// subInt8(int8): -1 -> 127
+// subInt8(int8): 0 -> FAILURE, hex"4e487b71", 0x11
+// compound(uint256): 1 -> 0
+// compound(uint256): 0 -> FAILURE, hex"4e487b71", 0x11
+// compound(uint256): -1 -> FAILURE, hex"4e487b71", 0x11
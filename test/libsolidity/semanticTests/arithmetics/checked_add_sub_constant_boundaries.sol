@@ -0,0 +1,54 @@
+contract C {
+    function incUint(uint x) public pure returns (uint) {
+        return x + 1;
+    }
+    function addMaxUint(uint x) public pure returns (uint) {
+        return x + (2**256 - 1);
+    }
+    function subMaxUint(uint x) public pure returns (uint) {
+        return x - (2**256 - 1);
+    }
+    function incInt(int x) public pure returns (int) {
+        return x + 1;
+    }
+    function decInt(int x) public pure returns (int) {
+        return x - 1;
+    }
+    function addMaxInt(int x) public pure returns (int) {
+        return x + (2**255 - 1);
+    }
+    function addMinInt(int x) public pure returns (int) {
+        return x + (-2**255);
+    }
+    function addInt8(int8 x) public pure returns (int8) {
+        return x + 127;
+    }
+    function subInt8(int8 x) public pure returns (int8) {
+        return x - 127;
+    }
+}
+// ----
+// incUint(uint256): -2 -> -1
+// incUint(uint256): -1 -> FAILURE, hex"4e487b71", 0x11
+// addMaxUint(uint256): 0 -> -1
+// addMaxUint(uint256): 1 -> FAILURE, hex"4e487b71", 0x11
+// subMaxUint(uint256): -1 -> 0
+// subMaxUint(uint256): -2 -> FAILURE, hex"4e487b71", 0x11
+// incInt(int256): 0x7ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffe -> 0x7fffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+// incInt(int256): 0x7fffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff -> FAILURE, hex"4e487b71", 0x11
+// incInt(int256): -1 -> 0
+// decInt(int256): -57896044618658097711785492504343953926634992332820282019728792003956564819967 -> -57896044618658097711785492504343953926634992332820282019728792003956564819968
+// decInt(int256): -57896044618658097711785492504343953926634992332820282019728792003956564819968 -> FAILURE, hex"4e487b71", 0x11
+// decInt(int256): 0 -> -1
+// addMaxInt(int256): 0 -> 0x7fffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+// addMaxInt(int256): 1 -> FAILURE, hex"4e487b71", 0x11
+// addMaxInt(int256): -57896044618658097711785492504343953926634992332820282019728792003956564819968 -> -1
+// addMinInt(int256): 0 -> -57896044618658097711785492504343953926634992332820282019728792003956564819968
+// addMinInt(int256): -1 -> FAILURE, hex"4e487b71", 0x11
+// addMinInt(int256): 0x7fffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff -> -1
+// addInt8(int8): 0 -> 127
+// addInt8(int8): 1 -> FAILURE, hex"4e487b71", 0x11
+// addInt8(int8): -128 -> -1
+// subInt8(int8): -1 -> -128
+// subInt8(int8): -2 -> FAILURE, hex"4e487b71", 0x11
+// subInt8(int8): 127 -> 0
@@ -0,0 +1,33 @@
+contract C {
+    uint8[] a;
+    uint16[5] b;
+
+    function fill(uint n) public returns (uint, uint8, uint8) {
+        uint8[] memory x = new uint8[](n);
+        for (uint i = 0; i < n; i++)
+            x[i] = uint8(i + 1);
+        a = x;
+        return (a.length, a[0], a[n - 1]);
+    }
+    function slot(uint i) public view returns (uint v) {
+        uint8[] storage s = a;
+        assembly {
+            mstore(0, s.slot)
+            v := sload(add(keccak256(0, 0x20), i))
+        }
+    }
+    function g() public returns (uint16, uint16, uint v) {
+        uint16[5] memory y = [uint16(1), 2, 3, 4, 5];
+        b = y;
+        assembly { v := sload(b.slot) }
+        return (b[0], b[4], v);
+    }
+}
+// ----
+// fill(uint256): 35 -> 35, 1, 35
+// slot(uint256): 0 -> 0x201f1e1d1c1b1a191817161514131211100f0e0d0c0b0a090807060504030201
+// slot(uint256): 1 -> 0x232221
+// fill(uint256): 2 -> 2, 1, 2
+// slot(uint256): 0 -> 0x0201
+// slot(uint256): 1 -> 0
+// g() -> 1, 5, 0x050004000300020001
@@ -0,0 +1,29 @@
+// The legacy code generator only copies memory with CompilerUtils::memoryCopy
+// and memoryCopy32 when encoding with ABI coder v1.
+pragma abicoder v1;
+
+contract C {
+    function f(bytes memory a, bytes memory b) public pure returns (bytes memory) {
+        return abi.encodePacked(a, b, a);
+    }
+    function g(bytes memory a) public pure returns (bytes memory) {
+        return bytes.concat(a, "xyz", a);
+    }
+    function h(uint[] memory a) public pure returns (bytes memory) {
+        return abi.encodePacked(a);
+    }
+    function paddedToDirtyMemory(bytes memory a) public pure returns (bytes memory) {
+        assembly {
+            let p := mload(0x40)
+            for { let i := 0 } lt(i, 0x200) { i := add(i, 0x20) } { mstore(add(p, i), not(0)) }
+        }
+        return abi.encode(a);
+    }
+}
+// ====
+// EVMVersion: >=cancun
+// ----
+// f(bytes,bytes): 0x40, 0x80, 3, "abc", 2, "de" -> 0x20, 8, "abcdeabc"
+// g(bytes): 0x20, 2, "ab" -> 0x20, 7, "abxyzab"
+// h(uint256[]): 0x20, 2, 1, 2 -> 0x20, 0x40, 1, 2
+// paddedToDirtyMemory(bytes): 0x20, 33, "abcdefghijklmnopqrstuvwxyz012345", "6" -> 0x20, 0x80, 0x20, 33, "abcdefghijklmnopqrstuvwxyz012345", "6"
@@ -0,0 +1,28 @@
+contract C {
+    bytes s;
+
+    function set(uint n) public {
+        bytes memory x = new bytes(n);
+        for (uint i = 0; i < n; i++)
+            x[i] = bytes1(uint8(0x41 + i % 26));
+        s = x;
+    }
+    function copy() public view returns (bytes memory) {
+        bytes memory y = s;
+        return y;
+    }
+    function packed() public view returns (bytes memory) {
+        return abi.encodePacked(s, s);
+    }
+}
+// ----
+// copy() -> 0x20, 0
+// packed() -> 0x20, 0
+// set(uint256): 3 ->
+// copy() -> 0x20, 3, "ABC"
+// packed() -> 0x20, 6, "ABCABC"
+// set(uint256): 31 ->
+// copy() -> 0x20, 31, "ABCDEFGHIJKLMNOPQRSTUVWXYZABCDE"
+// set(uint256): 32 ->
+// copy() -> 0x20, 32, "ABCDEFGHIJKLMNOPQRSTUVWXYZABCDEF"
+// packed() -> 0x20, 64, "ABCDEFGHIJKLMNOPQRSTUVWXYZABCDEF", "ABCDEFGHIJKLMNOPQRSTUVWXYZABCDEF"
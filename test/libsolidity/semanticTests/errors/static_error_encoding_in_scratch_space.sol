@@ -0,0 +1,14 @@
+error Small(uint a, bytes4 b, bool c);
+error Large(uint a, uint b, uint c, uint d);
+contract C {
+    function f(uint a) public pure {
+        revert Small(a, 0x01020304, true);
+    }
+    function g() public pure {
+        bytes memory m = new bytes(10);
+        revert Large(1, 2, 3, m.length);
+    }
+}
+// ----
+// f(uint256): 7 -> FAILURE, hex"d0c30877", 7, 0x0102030400000000000000000000000000000000000000000000000000000000, true
+// g() -> FAILURE, hex"61695187", 1, 2, 3, 10
@@ -0,0 +1,30 @@
+contract C {
+    uint x;
+    function fail() internal pure {
+        revert("fail");
+    }
+    function loopForever(uint a) internal pure {
+        if (a == 0)
+            fail();
+        loopForever(a - 1);
+    }
+    function f() public returns (uint) {
+        x = 1;
+        fail();
+        x = 2;
+        return x;
+    }
+    function g() public returns (uint) {
+        x = 3;
+        loopForever(1);
+        x = 4;
+        return x;
+    }
+    function h() public view returns (uint) {
+        return x;
+    }
+}
+// ----
+// f() -> FAILURE, hex"08c379a0", 0x20, 4, "fail"
+// g() -> FAILURE, hex"08c379a0", 0x20, 4, "fail"
+// h() -> 0
@@ -0,0 +1,57 @@
+contract C {
+    uint public fallbackDataLength;
+    uint public received;
+
+    function f0() external pure returns (uint) { return 0; }
+    function f1() external pure returns (uint) { return 1; }
+    function f2() external pure returns (uint) { return 2; }
+    function f3() external pure returns (uint) { return 3; }
+    function f4() external pure returns (uint) { return 4; }
+    function f5() external pure returns (uint) { return 5; }
+    function f6() external pure returns (uint) { return 6; }
+    function f7() external pure returns (uint) { return 7; }
+    function f8() external pure returns (uint) { return 8; }
+    function f9() external pure returns (uint) { return 9; }
+    function f10() external pure returns (uint) { return 10; }
+    function f11() external pure returns (uint) { return 11; }
+    function f12() external pure returns (uint) { return 12; }
+    function f13() external pure returns (uint) { return 13; }
+    function f14() external pure returns (uint) { return 14; }
+    function f15() external pure returns (uint) { return 15; }
+
+    fallback() external payable {
+        fallbackDataLength = msg.data.length;
+    }
+
+    receive() external payable {
+        received += msg.value;
+    }
+}
+// ====
+// allowNonExistingFunctions: true
+// ----
+// f0() -> 0
+// f1() -> 1
+// f2() -> 2
+// f3() -> 3
+// f4() -> 4
+// f5() -> 5
+// f6() -> 6
+// f7() -> 7
+// f8() -> 8
+// f9() -> 9
+// f10() -> 10
+// f11() -> 11
+// f12() -> 12
+// f13() -> 13
+// f14() -> 14
+// f15() -> 15
+// fallbackDataLength() -> 0
+// (): 42 ->
+// fallbackDataLength() -> 32
+// g(uint256): 7 ->
+// fallbackDataLength() -> 36
+// received() -> 0
+// (), 3 wei ->
+// received() -> 3
+// fallbackDataLength() -> 36
@@ -0,0 +1,25 @@
+contract A {
+    uint immutable public x = 2**200 + 1;
+}
+contract C is A {
+    uint public early = w;
+    uint immutable w = 5;
+    int16 immutable a = -300;
+    bytes4 immutable b = 0x12345678;
+    uint immutable public y = x - 1;
+    uint public z;
+
+    constructor() {
+        z = x + w;
+    }
+
+    function f() public view returns (uint, uint, int16, bytes4, uint) {
+        return (x * 2, w, a, b, y);
+    }
+}
+// ----
+// x() -> 1606938044258990275541962092341162602522202993782792835301377
+// y() -> 1606938044258990275541962092341162602522202993782792835301376
+// early() -> 0
+// z() -> 1606938044258990275541962092341162602522202993782792835301382
+// f() -> 3213876088517980551083924184682325205044405987565585670602754, 5, -300, 0x1234567800000000000000000000000000000000000000000000000000000000, 1606938044258990275541962092341162602522202993782792835301376
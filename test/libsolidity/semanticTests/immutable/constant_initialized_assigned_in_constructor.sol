@@ -0,0 +1,21 @@
+contract C {
+    int immutable x = 1;
+    uint immutable y = 2;
+    uint immutable public z = 3;
+    uint8 immutable w = 255;
+    uint immutable u = 9;
+
+    constructor() {
+        x = -x * 5;
+        y += 40;
+        z = y + 1;
+        delete w;
+    }
+
+    function f() public view returns (int, uint, uint, uint8, uint) {
+        return (x, y, z, w, u);
+    }
+}
+// ----
+// f() -> -5, 42, 43, 0, 9
+// z() -> 43
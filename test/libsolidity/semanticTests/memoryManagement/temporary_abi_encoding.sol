@@ -0,0 +1,31 @@
+contract C {
+    function memorySize() internal pure returns (uint s) {
+        assembly { s := mload(0x40) }
+    }
+    function hashes(uint n) public pure returns (uint) {
+        uint before = memorySize();
+        bytes32 h;
+        for (uint i = 0; i < n; i++)
+            h = keccak256(abi.encode(h, i));
+        assert(h != 0);
+        return memorySize() - before;
+    }
+    function calls(uint n) public returns (uint) {
+        uint before = memorySize();
+        for (uint i = 0; i < n; i++)
+        {
+            (bool success, bytes memory result) = address(this).call(abi.encodeCall(this.id, (i)));
+            require(success && abi.decode(result, (uint)) == i);
+        }
+        // Only the return data remains allocated.
+        return memorySize() - before;
+    }
+    function id(uint x) external pure returns (uint) {
+        return x;
+    }
+}
+// ====
+// compileViaYul: true
+// ----
+// hashes(uint256): 10 -> 0
+// calls(uint256): 10 -> 0x0280
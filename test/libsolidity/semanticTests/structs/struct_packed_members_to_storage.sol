@@ -0,0 +1,45 @@
+contract C {
+    struct S {
+        uint128 a;
+        uint64 b;
+        uint32 c;
+        uint256 d;
+    }
+    struct T {
+        uint128 x;
+        bytes16 y;
+    }
+
+    S s;
+    S s2;
+    T t;
+
+    function fromMemory() public returns (uint128, uint64, uint32, uint256) {
+        s = S(1, 2, 3, 4);
+        return (s.a, s.b, s.c, s.d);
+    }
+    function padding() public returns (bytes32 r) {
+        assembly { sstore(s.slot, shl(224, 0xffffffff)) }
+        s = S(1, 2, 3, 4);
+        assembly { r := sload(s.slot) }
+    }
+    function fromStorage() public returns (uint128, uint64, uint32, uint256) {
+        s2 = s;
+        return (s2.a, s2.b, s2.c, s2.d);
+    }
+    function fromCalldata(S calldata _s) public returns (uint128, uint64, uint32, uint256) {
+        s = _s;
+        return (s.a, s.b, s.c, s.d);
+    }
+    function fullSlot() public returns (bytes32 r) {
+        assembly { sstore(t.slot, not(0)) }
+        t = T(7, "x");
+        assembly { r := sload(t.slot) }
+    }
+}
+// ----
+// fromMemory() -> 1, 2, 3, 4
+// padding() -> 0xffffffff00000003000000000000000200000000000000000000000000000001
+// fromStorage() -> 1, 2, 3, 4
+// fromCalldata((uint128,uint64,uint32,uint256)): 9, 8, 7, 6 -> 9, 8, 7, 6
+// fullSlot() -> 0x7800000000000000000000000000000000000000000000000000000000000007
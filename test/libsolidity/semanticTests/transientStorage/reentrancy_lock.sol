@@ -0,0 +1,44 @@
+contract C {
+    uint x;
+    bool transient locked;
+    uint128 public transient a;
+    uint128 transient b;
+
+    modifier nonReentrant() {
+        require(!locked, "Reentrant call.");
+        locked = true;
+        _;
+        delete locked;
+    }
+
+    function enter(bool _reenter) external nonReentrant returns (uint) {
+        if (_reenter)
+            this.enter(false);
+        return 1;
+    }
+
+    function enterTwice() external returns (uint) {
+        return this.enter(false) + this.enter(false);
+    }
+
+    function layout() external returns (uint t0, uint t1, uint s0, uint128 r) {
+        a = 1;
+        b = 2;
+        x = 3;
+        a += 4;
+        r = this.a();
+        assembly {
+            t0 := tload(0)
+            t1 := tload(1)
+            s0 := sload(0)
+        }
+    }
+}
+// ====
+// EVMVersion: >=cancun
+// ----
+// enter(bool): false -> 1
+// enter(bool): true -> FAILURE, hex"08c379a0", 0x20, 15, "Reentrant call."
+// enterTwice() -> 2
+// layout() -> 0x0500, 2, 3, 5
+// a() -> 0
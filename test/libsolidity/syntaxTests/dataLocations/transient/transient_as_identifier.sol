@@ -0,0 +1,7 @@
+contract C {
+    uint transient;
+    function f() public view returns (uint) {
+        return transient;
+    }
+}
+// ----
@@ -0,0 +1,9 @@
+contract C {
+    uint constant transient x = 1;
+    uint immutable transient y;
+}
+// ====
+// EVMVersion: >=cancun
+// ----
+// DeclarationError 2502: (17-46): Transient cannot be used as data location for constant or immutable variables.
+// DeclarationError 2502: (52-78): Transient cannot be used as data location for constant or immutable variables.
@@ -0,0 +1,7 @@
+contract C {
+    bool transient locked;
+}
+// ====
+// EVMVersion: <cancun
+// ----
+// TypeError 3938: (17-38): Transient storage is only available for EVM versions cancun and later.
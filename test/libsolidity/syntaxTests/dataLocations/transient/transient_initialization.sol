@@ -0,0 +1,7 @@
+contract C {
+    uint transient x = 1;
+}
+// ====
+// EVMVersion: >=cancun
+// ----
+// DeclarationError 5059: (36-37): Initialization of transient storage state variables is not supported.
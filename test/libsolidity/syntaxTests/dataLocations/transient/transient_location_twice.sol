@@ -0,0 +1,5 @@
+contract C {
+    uint transient transient x;
+}
+// ----
+// ParserError 9362: (32-41): Location already specified.
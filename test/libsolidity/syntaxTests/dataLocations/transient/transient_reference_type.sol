@@ -0,0 +1,9 @@
+contract C {
+    uint[] transient a;
+    mapping(uint => uint) transient m;
+}
+// ====
+// EVMVersion: >=cancun
+// ----
+// TypeError 8838: (17-35): Transient storage is only implemented for state variables of value type.
+// TypeError 8838: (41-74): Transient storage is only implemented for state variables of value type.
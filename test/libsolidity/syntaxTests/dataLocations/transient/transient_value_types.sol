@@ -0,0 +1,9 @@
+contract C {
+    uint transient x;
+    bool public transient locked;
+    address internal transient owner;
+    function() external transient callback;
+}
+// ====
+// EVMVersion: >=cancun
+// ----
@@ -0,0 +1,17 @@
+==== Source: A.sol ====
+pragma experimental solidity;
+
+import std.stub;
+==== Source: B.sol ====
+pragma experimental solidity;
+
+import std.stub;
+// ====
+// EVMVersion: >=constantinople
+// compileViaYul: true
+// ----
+// Warning 2264: (std.stub:63-92): Experimental features are turned on. Do not use experimental features on live deployments.
+// Warning 2264: (A.sol:0-29): Experimental features are turned on. Do not use experimental features on live deployments.
+// Warning 2264: (B.sol:0-29): Experimental features are turned on. Do not use experimental features on live deployments.
+// Info 4164: (std.stub:94-117): Inferred type: () -> ()
+// Info 4164: (std.stub:111-113): Inferred type: ()
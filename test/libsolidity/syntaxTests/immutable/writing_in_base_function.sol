@@ -0,0 +1,8 @@
+contract A {
+    uint immutable x = 1;
+    function f() public { x = 2; }
+}
+contract B is A {}
+contract C is B {}
+// ----
+// TypeError 1581: (65-66): Cannot write to immutable here: Immutable variables can only be initialized inline or assigned directly in the constructor.
@@ -24,6 +24,7 @@
 
 #include <cstdint>
 #include <sstream>
+#include <unordered_set>
 
 
 namespace solidity::util::test
@@ -212,6 +213,28 @@ BOOST_AUTO_TEST_CASE(comparison)
 	BOOST_CHECK(!(a < b));
 	BOOST_CHECK(d < c);
 	BOOST_CHECK(FixedHash<32>{} < a);
+	BOOST_CHECK(!(c < a));
+	BOOST_CHECK(FixedHash<20>("0000000000000000000000000000000000000001") < FixedHash<20>("0000000000000000000000000000000000000002"));
+	BOOST_CHECK(FixedHash<20>("00000000000000000000000000000000000000ff") < FixedHash<20>("0100000000000000000000000000000000000000"));
+	BOOST_CHECK(!(FixedHash<20>("0100000000000000000000000000000000000000") < FixedHash<20>("00000000000000000000000000000000000000ff")));
+}
+
+BOOST_AUTO_TEST_CASE(hashing)
+{
+	FixedHash<32> a("c5d2460186f7233c927e7db2dcc703c0e500b653ca82273b7bfad8045d85a470");
+	FixedHash<32> b("c5d2460186f7233c927e7db2dcc703c0e500b653ca82273b7bfad8045d85a470");
+	FixedHash<32> c("c5d2460186f7233c927e7db2dcc703c0e500b653ca82273b7bfad8045d85a471");
+	BOOST_CHECK_EQUAL(std::hash<FixedHash<32>>{}(a), std::hash<FixedHash<32>>{}(b));
+	BOOST_CHECK(std::hash<FixedHash<32>>{}(a) != std::hash<FixedHash<32>>{}(c));
+
+	// The bytes beyond the last full word are also taken into account.
+	std::unordered_set<h160> addresses;
+	for (unsigned i = 1; i <= 10; ++i)
+		addresses.insert(h160(h160::Arith(i)));
+	BOOST_CHECK_EQUAL(addresses.size(), 10);
+	BOOST_CHECK(std::hash<h160>{}(h160(h160::Arith(1))) != std::hash<h160>{}(h160(h160::Arith(2))));
+	BOOST_CHECK(addresses.count(h160(h160::Arith(7))));
+	BOOST_CHECK(!addresses.count(h160(h160::Arith(11))));
 }
 
 BOOST_AUTO_TEST_CASE(indexing)
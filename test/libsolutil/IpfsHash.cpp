@@ -105,6 +105,19 @@ BOOST_AUTO_TEST_CASE(test_multi_level_tree)
 	BOOST_CHECK_EQUAL(ipfsHashBase58(data), "QmaTb1sT9hrSXJLmf8bxJ9NuwndiHuMLsgNLgkS2eXu3Xj");
 }
 
+BOOST_AUTO_TEST_CASE(test_parallel)
+{
+	size_t length = 1024 * 1024 * 3 + 17;
+	std::string data;
+	data.resize(length, 0);
+	for (size_t i = 0; i < length; ++i)
+		data[i] = static_cast<char>(i % 251);
+	std::string const expectation = ipfsHashBase58(data);
+	for (size_t parallelism: std::vector<size_t>{2, 4, 16})
+		BOOST_CHECK_EQUAL(ipfsHashBase58(data, parallelism), expectation);
+	BOOST_CHECK_EQUAL(ipfsHashBase58("Solidity\n", 4), "QmSsm9M7PQRBnyiz1smizk8hZw3URfk8fSeHzeTo3oZidS");
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }
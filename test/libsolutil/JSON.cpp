@@ -26,6 +26,8 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include <sstream>
+
 
 namespace solidity::util::test
 {
@@ -331,6 +333,28 @@ BOOST_AUTO_TEST_CASE(json_range_checks)
 	BOOST_CHECK_THROW(get<float>(underflow["v"]), InvalidType);
 }
 
+BOOST_AUTO_TEST_CASE(stream_writer)
+{
+	Json const document = Json::parse(R"({"a": {"x": [1, {"s": "line\nbreak"}], "y": {}}, "b": {}, "c": "\u00e9"})");
+	for (JsonFormat const& format: {JsonFormat{JsonFormat::Compact}, JsonFormat{JsonFormat::Pretty}, JsonFormat{JsonFormat::Pretty, 4}})
+	{
+		std::ostringstream stream;
+		JsonStreamWriter writer(stream, format);
+		writer.beginObject();
+		writer.beginObject("a");
+		writer.member("x", document["a"]["x"]);
+		writer.member("y", document["a"]["y"]);
+		writer.endObject();
+		writer.beginObject("b");
+		BOOST_CHECK_EQUAL(writer.depth(), 2);
+		writer.endObject();
+		writer.member("c", document["c"]);
+		writer.endObject();
+		BOOST_CHECK_EQUAL(writer.depth(), 0);
+		BOOST_CHECK_EQUAL(stream.str(), jsonPrint(document, format));
+	}
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }
@@ -68,6 +68,35 @@ BOOST_AUTO_TEST_CASE(strings)
 	);
 }
 
+BOOST_AUTO_TEST_CASE(many)
+{
+	// Lengths around the block size of 136 bytes, so that inputs with different
+	// numbers of blocks are mixed and some of them are hashed together.
+	std::vector<bytes> inputs;
+	for (size_t length: std::vector<size_t>{0, 1, 31, 32, 64, 135, 136, 137, 200, 271, 272, 273, 1000, 4096})
+		for (size_t seed = 0; seed < 5; ++seed)
+		{
+			bytes input(length);
+			for (size_t i = 0; i < length; ++i)
+				input[i] = static_cast<uint8_t>(seed * 31 + i * 7);
+			inputs.emplace_back(std::move(input));
+		}
+
+	std::vector<bytesConstRef> refs;
+	for (bytes const& input: inputs)
+		refs.emplace_back(&input);
+	std::vector<h256> hashes = keccak256Many(refs);
+
+	BOOST_REQUIRE_EQUAL(hashes.size(), inputs.size());
+	for (size_t i = 0; i < inputs.size(); ++i)
+		BOOST_CHECK_EQUAL(hashes[i], keccak256(inputs[i]));
+	BOOST_CHECK(keccak256Many({}).empty());
+	BOOST_CHECK_EQUAL(
+		keccak256Many({bytesConstRef("test")}).front(),
+		FixedHash<32>("0x9c22ff5f21f0b81b113e63f7db6da94fedef11b2119b4088b89664fb9a3cb658")
+	);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }
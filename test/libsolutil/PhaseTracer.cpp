@@ -0,0 +1,161 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Unit tests for the phase tracer.
+ */
+
+#include <libsolutil/PhaseTracer.h>
+#include <libsolutil/Parallel.h>
+
+#include <boost/test/unit_test.hpp>
+
+#include <memory>
+#include <set>
+#include <vector>
+
+namespace solidity::util::test
+{
+
+BOOST_AUTO_TEST_SUITE(PhaseTracerTest)
+
+BOOST_AUTO_TEST_CASE(no_active_tracer)
+{
+	BOOST_CHECK(!PhaseTracer::current());
+	PhaseTracer::Scope scope("ignored");
+	BOOST_CHECK(!PhaseTracer::current());
+}
+
+BOOST_AUTO_TEST_CASE(nested_scopes)
+{
+	PhaseTracer tracer;
+	{
+		PhaseTracer::Activation activation(&tracer);
+		BOOST_CHECK_EQUAL(PhaseTracer::current(), &tracer);
+		PhaseTracer::Scope outer("outer");
+		{
+			PhaseTracer::Scope inner("inner", "target");
+		}
+	}
+	BOOST_CHECK(!PhaseTracer::current());
+	// Scopes created without an active tracer are not recorded.
+	{
+		PhaseTracer::Scope scope("ignored");
+	}
+
+	std::vector<PhaseTracer::Event> events = tracer.events();
+	BOOST_REQUIRE_EQUAL(events.size(), 2);
+	BOOST_CHECK_EQUAL(events[0].name, "inner");
+	BOOST_CHECK_EQUAL(events[0].target, "target");
+	BOOST_CHECK_EQUAL(events[1].name, "outer");
+	BOOST_CHECK(events[1].target.empty());
+	BOOST_CHECK(events[1].start <= events[0].start);
+	BOOST_CHECK(events[0].start + events[0].duration <= events[1].start + events[1].duration);
+	BOOST_CHECK_EQUAL(events[0].thread, 0);
+	BOOST_CHECK_EQUAL(events[1].thread, 0);
+
+	Json trace = tracer.toJson();
+	BOOST_CHECK_EQUAL(trace["displayTimeUnit"], "ms");
+	// The phases come first, followed by a memory counter for each of them if it is available.
+	size_t const expectedEvents = peakResidentMemory() ? 4 : 2;
+	BOOST_REQUIRE_EQUAL(trace["traceEvents"].size(), expectedEvents);
+	Json const& inner = trace["traceEvents"][0];
+	BOOST_CHECK_EQUAL(inner["name"], "inner");
+	BOOST_CHECK_EQUAL(inner["ph"], "X");
+	BOOST_CHECK_EQUAL(inner["args"]["target"], "target");
+	BOOST_CHECK(!trace["traceEvents"][1].contains("args") || !trace["traceEvents"][1]["args"].contains("target"));
+	for (size_t i = 2; i < expectedEvents; ++i)
+	{
+		BOOST_CHECK_EQUAL(trace["traceEvents"][i]["ph"], "C");
+		BOOST_CHECK_EQUAL(trace["traceEvents"][i]["name"], "peakMemory");
+	}
+
+	tracer.clear();
+	BOOST_CHECK(tracer.events().empty());
+}
+
+BOOST_AUTO_TEST_CASE(memory_usage)
+{
+	PhaseTracer tracer;
+	PhaseTracer::Activation activation(&tracer);
+	std::vector<std::unique_ptr<std::vector<char>>> blocks;
+	{
+		PhaseTracer::Scope scope("allocating");
+		for (size_t i = 0; i < 16; ++i)
+			blocks.push_back(std::make_unique<std::vector<char>>(1024, 'x'));
+	}
+
+	std::vector<PhaseTracer::Event> events = tracer.events();
+	BOOST_REQUIRE_EQUAL(events.size(), 1);
+	if (events[0].peakMemory)
+	{
+		BOOST_CHECK(*events[0].peakMemory > 0);
+		BOOST_CHECK(events[0].peakMemoryIncrease <= *events[0].peakMemory);
+	}
+	BOOST_CHECK_EQUAL(events[0].allocations.has_value(), allocationsTracked());
+	if (events[0].allocations)
+	{
+		BOOST_CHECK(events[0].allocations->allocations >= 32);
+		BOOST_CHECK(events[0].allocations->bytes >= 16 * 1024);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(nested_activations)
+{
+	PhaseTracer first;
+	PhaseTracer second;
+	PhaseTracer::Activation firstActivation(&first);
+	{
+		PhaseTracer::Activation secondActivation(&second);
+		PhaseTracer::Scope scope("second");
+		{
+			PhaseTracer::Activation disabled(nullptr);
+			PhaseTracer::Scope ignored("ignored");
+		}
+	}
+	{
+		PhaseTracer::Scope scope("first");
+	}
+	BOOST_REQUIRE_EQUAL(first.events().size(), 1);
+	BOOST_CHECK_EQUAL(first.events()[0].name, "first");
+	BOOST_REQUIRE_EQUAL(second.events().size(), 1);
+	BOOST_CHECK_EQUAL(second.events()[0].name, "second");
+}
+
+BOOST_AUTO_TEST_CASE(propagated_into_parallel_tasks)
+{
+	PhaseTracer tracer;
+	PhaseTracer::Activation activation(&tracer);
+	runInParallel(4, 8, [](size_t _index) {
+		PhaseTracer::Scope scope("task", std::to_string(_index));
+	});
+
+	std::vector<PhaseTracer::Event> events = tracer.events();
+	BOOST_REQUIRE_EQUAL(events.size(), 8);
+	std::set<std::string> targets;
+	for (PhaseTracer::Event const& event: events)
+	{
+		BOOST_CHECK_EQUAL(event.name, "task");
+		BOOST_CHECK(event.thread < 4);
+		targets.insert(event.target);
+	}
+	BOOST_CHECK_EQUAL(targets.size(), 8);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
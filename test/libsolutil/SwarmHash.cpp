@@ -102,6 +102,21 @@ BOOST_AUTO_TEST_CASE(bzz_hash_nonzero)
 	BOOST_CHECK_EQUAL(bzzr1HashHex(sequence(4096 * 130)), "59de730bf6c67a941f3b2ffa2f920acfaa1713695ad5deea12b4a121e5f23fa1");
 }
 
+BOOST_AUTO_TEST_CASE(bzz_hash_parallel)
+{
+	for (size_t length: std::vector<size_t>{4097, 4096 * 128 + 31, 4096 * 130, 4096 * 128 * 3 + 5})
+	{
+		bytes data = sequence(length);
+		std::string const expectation = bzzr1HashHex(data);
+		for (size_t parallelism: std::vector<size_t>{2, 4, 16})
+			BOOST_CHECK_EQUAL(toHex(bzzr1Hash(data, parallelism).asBytes()), expectation);
+	}
+	BOOST_CHECK_EQUAL(
+		toHex(bzzr1Hash(sequence(4096 * 130), 4).asBytes()),
+		"59de730bf6c67a941f3b2ffa2f920acfaa1713695ad5deea12b4a121e5f23fa1"
+	);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }
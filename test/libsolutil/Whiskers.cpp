@@ -240,6 +240,18 @@ BOOST_AUTO_TEST_CASE(invalid_param_rendered)
 	BOOST_CHECK_EQUAL(m.render(), templ);
 }
 
+BOOST_AUTO_TEST_CASE(template_reused)
+{
+	std::string templ = "<?c><a><!c>-</c><#l>[<x>]</l>";
+	std::vector<std::map<std::string, std::string>> list(2);
+	list[0]["x"] = "1";
+	list[1]["x"] = "2";
+	BOOST_CHECK_EQUAL(Whiskers(templ)("a", "A")("c", true)("l", list).render(), "A[1][2]");
+	BOOST_CHECK_EQUAL(Whiskers(templ)("a", "B")("c", false)("l", std::vector<std::map<std::string, std::string>>{}).render(), "-");
+	Whiskers m(templ);
+	BOOST_CHECK_THROW(m("c", true)("l", list).render(), WhiskersError);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }
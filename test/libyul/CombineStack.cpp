@@ -0,0 +1,106 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Unit tests for the combination of the stack layouts of two branches by the stack layout generator.
+ */
+
+#include <libyul/backends/evm/StackHelpers.h>
+#include <libyul/backends/evm/StackLayoutGenerator.h>
+
+#include <boost/test/unit_test.hpp>
+
+namespace solidity::yul::test
+{
+
+namespace
+{
+using CombineStackSearch = StackLayoutGenerator::CombineStackSearch;
+
+/// @returns the number of swaps needed to reach both @a _stack1 and @a _stack2 from @a _combined.
+size_t countSwaps(Stack const& _combined, Stack const& _stack1, Stack const& _stack2)
+{
+	size_t swaps = 0;
+	for (Stack const* target: {&_stack1, &_stack2})
+	{
+		Stack stack = _combined;
+		createStackLayout(stack, *target, [&](unsigned) { ++swaps; }, [](StackSlot const&) {}, [](){});
+	}
+	return swaps;
+}
+}
+
+BOOST_AUTO_TEST_SUITE(YulCombineStack)
+
+BOOST_AUTO_TEST_CASE(exhaustive_search_finds_cheaper_layout)
+{
+	Scope::Variable const a{YulString{}, YulString{"a"}};
+	Scope::Variable const b{YulString{}, YulString{"b"}};
+	Scope::Variable const c{YulString{}, YulString{"c"}};
+	Stack const stack1{VariableSlot{a}};
+	Stack const stack2{VariableSlot{b}, VariableSlot{c}};
+
+	Stack const inputOrder = StackLayoutGenerator::combineStack(
+		stack1,
+		stack2,
+		CombineStackSearch::None,
+		legacyReachableStackDepth
+	);
+	BOOST_CHECK_EQUAL(stackToString(inputOrder), "[ a b c ]");
+
+	// None of the orders evaluated by the partial search needs less than two swaps.
+	Stack const partial = StackLayoutGenerator::combineStack(
+		stack1,
+		stack2,
+		CombineStackSearch::Partial,
+		legacyReachableStackDepth
+	);
+	BOOST_CHECK_EQUAL(stackToString(partial), "[ a b c ]");
+	BOOST_CHECK_EQUAL(countSwaps(partial, stack1, stack2), 2);
+
+	// With c below b, stack2 is reached by a single SWAP2 followed by a POP.
+	Stack const exhaustive = StackLayoutGenerator::combineStack(
+		stack1,
+		stack2,
+		CombineStackSearch::Exhaustive,
+		legacyReachableStackDepth
+	);
+	BOOST_CHECK_EQUAL(stackToString(exhaustive), "[ a c b ]");
+	BOOST_CHECK_EQUAL(countSwaps(exhaustive, stack1, stack2), 1);
+}
+
+BOOST_AUTO_TEST_CASE(common_prefix_is_kept)
+{
+	Scope::Variable const x{YulString{}, YulString{"x"}};
+	Scope::Variable const a{YulString{}, YulString{"a"}};
+	Scope::Variable const b{YulString{}, YulString{"b"}};
+	Scope::Variable const c{YulString{}, YulString{"c"}};
+	Stack const stack1{VariableSlot{x}, VariableSlot{a}};
+	Stack const stack2{VariableSlot{x}, VariableSlot{b}, VariableSlot{c}};
+
+	for (CombineStackSearch search: {CombineStackSearch::Partial, CombineStackSearch::Exhaustive})
+	{
+		Stack const combined = StackLayoutGenerator::combineStack(stack1, stack2, search, legacyReachableStackDepth);
+		BOOST_REQUIRE(!combined.empty());
+		BOOST_CHECK(combined.front() == stack1.front());
+		BOOST_CHECK_EQUAL(combined.size(), 4);
+	}
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
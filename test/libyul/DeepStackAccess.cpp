@@ -0,0 +1,148 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Unit tests for the access of stack slots deeper than 16 via DUPN and SWAPN in EOF code.
+ */
+
+#include <libyul/YulStack.h>
+#include <libyul/backends/evm/ControlFlowGraphBuilder.h>
+#include <libyul/backends/evm/EthAssemblyAdapter.h>
+#include <libyul/backends/evm/EVMDialect.h>
+#include <libyul/backends/evm/EVMObjectCompiler.h>
+#include <libyul/backends/evm/StackHelpers.h>
+#include <libyul/backends/evm/StackLayoutGenerator.h>
+
+#include <libevmasm/Assembly.h>
+
+#include <boost/test/unit_test.hpp>
+
+#include <range/v3/algorithm/any_of.hpp>
+
+using namespace solidity::langutil;
+using namespace solidity::evmasm;
+
+namespace solidity::yul::test
+{
+
+namespace
+{
+// a1 is used before and after the other 16 variables are, so it has to be kept below all of them.
+std::string const deepStackSource = R"({
+	sstore(0, f(calldataload(0)))
+	function f(a1) -> v {
+		let a2 := calldataload(mul(2, 4))
+		let a3 := calldataload(mul(3, 4))
+		let a4 := calldataload(mul(4, 4))
+		let a5 := calldataload(mul(5, 4))
+		let a6 := calldataload(mul(6, 4))
+		let a7 := calldataload(mul(7, 4))
+		let a8 := calldataload(mul(8, 4))
+		let a9 := calldataload(mul(9, 4))
+		let a10 := calldataload(mul(10, 4))
+		let a11 := calldataload(mul(11, 4))
+		let a12 := calldataload(mul(12, 4))
+		let a13 := calldataload(mul(13, 4))
+		let a14 := calldataload(mul(14, 4))
+		let a15 := calldataload(mul(15, 4))
+		let a16 := calldataload(mul(16, 4))
+		let a17 := calldataload(mul(17, 4))
+		sstore(0, a1)
+		sstore(mul(17, 4), a17)
+		sstore(mul(16, 4), a16)
+		sstore(mul(15, 4), a15)
+		sstore(mul(14, 4), a14)
+		sstore(mul(13, 4), a13)
+		sstore(mul(12, 4), a12)
+		sstore(mul(11, 4), a11)
+		sstore(mul(10, 4), a10)
+		sstore(mul(9, 4), a9)
+		sstore(mul(8, 4), a8)
+		sstore(mul(7, 4), a7)
+		sstore(mul(6, 4), a6)
+		sstore(mul(5, 4), a5)
+		sstore(mul(4, 4), a4)
+		sstore(mul(3, 4), a3)
+		sstore(mul(2, 4), a2)
+		sstore(mul(1, 4), a1)
+	}
+})";
+
+std::unique_ptr<YulStack> parseForEOF(std::string const& _source)
+{
+	frontend::OptimiserSettings settings = frontend::OptimiserSettings::none();
+	settings.runYulOptimiser = false;
+	settings.optimizeStackAllocation = true;
+	auto stack = std::make_unique<YulStack>(
+		EVMVersion{},
+		1,
+		YulStack::Language::StrictAssembly,
+		settings,
+		DebugInfoSelection::All()
+	);
+	BOOST_REQUIRE(stack->parseAndAnalyze("", _source));
+	return stack;
+}
+}
+
+BOOST_AUTO_TEST_SUITE(YulDeepStackAccess)
+
+BOOST_AUTO_TEST_CASE(stack_too_deep_depends_on_reachable_depth)
+{
+	auto stack = parseForEOF(deepStackSource);
+	Object const& object = *stack->parserResult();
+	std::unique_ptr<CFG> cfg = ControlFlowGraphBuilder::build(
+		*object.analysisInfo,
+		EVMDialect::strictAssemblyForEVMObjects(EVMVersion{}),
+		*object.code
+	);
+
+	auto legacyErrors = StackLayoutGenerator::reportStackTooDeep(*cfg, legacyReachableStackDepth);
+	BOOST_CHECK(legacyErrors.count(YulString{"f"}));
+
+	auto eofErrors = StackLayoutGenerator::reportStackTooDeep(*cfg, eofReachableStackDepth);
+	BOOST_CHECK(eofErrors.at(YulString{}).empty());
+	BOOST_CHECK(!eofErrors.count(YulString{"f"}));
+}
+
+BOOST_AUTO_TEST_CASE(eof_code_uses_dupn_and_swapn)
+{
+	auto stack = parseForEOF(deepStackSource);
+	Assembly assembly{EVMVersion{}, false, {}};
+	EthAssemblyAdapter adapter(assembly);
+	// Throws a StackTooDeepError if any slot cannot be reached.
+	EVMObjectCompiler::compile(
+		*stack->parserResult(),
+		adapter,
+		EVMDialect::strictAssemblyForEVMObjects(EVMVersion{}),
+		true,
+		1
+	);
+
+	auto isDeepAccess = [](AssemblyItem const& _item) {
+		return _item.type() == AssemblyItemType::DupN || _item.type() == AssemblyItemType::SwapN;
+	};
+	BOOST_CHECK(ranges::any_of(assembly.items(), isDeepAccess));
+	// Slots up to a depth of 16 are still reached via DUP1 to DUP16 and SWAP1 to SWAP16.
+	for (AssemblyItem const& item: assembly.items())
+		if (isDeepAccess(item))
+			BOOST_CHECK(item.data() > 16);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
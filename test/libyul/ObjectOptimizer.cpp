@@ -0,0 +1,171 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Unit tests for the cache of optimized Yul objects.
+ */
+
+#include <libyul/ObjectOptimizer.h>
+
+#include <test/Common.h>
+
+#include <libyul/AsmPrinter.h>
+#include <libyul/AST.h>
+#include <libyul/Object.h>
+#include <libyul/YulStack.h>
+#include <libyul/backends/evm/EVMDialect.h>
+
+#include <libsolutil/Keccak256.h>
+
+#include <boost/test/unit_test.hpp>
+
+#include <memory>
+#include <string>
+
+using namespace solidity::langutil;
+
+namespace solidity::yul::test
+{
+
+namespace
+{
+
+std::string const nestedSource = R"(
+	object "A" {
+		code {
+			datacopy(0, dataoffset("X"), datasize("X"))
+			datacopy(0, dataoffset("B"), datasize("B"))
+			return(0, add(datasize("X"), datasize("B")))
+		}
+		object "X" {
+			code {
+				function f(a) -> b { b := add(mul(a, 2), 1) }
+				sstore(0, f(f(calldataload(0))))
+			}
+		}
+		object "B" {
+			code {
+				datacopy(0, dataoffset("X"), datasize("X"))
+				return(0, datasize("X"))
+			}
+			object "X" {
+				code {
+					function f(a) -> b { b := add(mul(a, 2), 1) }
+					sstore(0, f(f(calldataload(0))))
+				}
+			}
+		}
+	}
+)";
+
+std::unique_ptr<YulStack> parseAndOptimize(std::string const& _source, std::shared_ptr<ObjectOptimizer> _objectOptimizer)
+{
+	auto stack = std::make_unique<YulStack>(
+		solidity::test::CommonOptions::get().evmVersion(),
+		solidity::test::CommonOptions::get().eofVersion(),
+		YulStack::Language::StrictAssembly,
+		frontend::OptimiserSettings::full(),
+		DebugInfoSelection::All()
+	);
+	BOOST_REQUIRE(stack->parseAndAnalyze("", _source));
+	if (_objectOptimizer)
+		stack->setObjectOptimizer(std::move(_objectOptimizer));
+	stack->optimize();
+	return stack;
+}
+
+Object const& subObject(Object const& _object, std::string const& _name)
+{
+	auto it = _object.subIndexByName.find(YulString{_name});
+	BOOST_REQUIRE(it != _object.subIndexByName.end());
+	auto const* object = dynamic_cast<Object const*>(_object.subObjects.at(it->second).get());
+	BOOST_REQUIRE(object);
+	return *object;
+}
+
+std::string printCode(Object const& _object)
+{
+	return AsmPrinter(
+		EVMDialect::strictAssemblyForEVMObjects(solidity::test::CommonOptions::get().evmVersion()),
+		_object.debugData->sourceNames,
+		DebugInfoSelection::All()
+	)(*_object.code);
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE(ObjectOptimizerTest)
+
+BOOST_AUTO_TEST_CASE(cache_key)
+{
+	std::unique_ptr<YulStack> stack = std::make_unique<YulStack>(
+		solidity::test::CommonOptions::get().evmVersion(),
+		solidity::test::CommonOptions::get().eofVersion(),
+		YulStack::Language::StrictAssembly,
+		frontend::OptimiserSettings::none(),
+		DebugInfoSelection::All()
+	);
+	BOOST_REQUIRE(stack->parseAndAnalyze("", nestedSource));
+	Object const& a = *stack->parserResult();
+	Object const& x = subObject(a, "X");
+	Object const& nestedX = subObject(subObject(a, "B"), "X");
+	Dialect const& dialect = EVMDialect::strictAssemblyForEVMObjects(solidity::test::CommonOptions::get().evmVersion());
+
+	BOOST_TEST(ObjectOptimizer::cacheKey(x, dialect, "s") == ObjectOptimizer::cacheKey(nestedX, dialect, "s"));
+	BOOST_TEST(ObjectOptimizer::cacheKey(x, dialect, "s") != ObjectOptimizer::cacheKey(x, dialect, "t"));
+	BOOST_TEST(ObjectOptimizer::cacheKey(x, dialect, "s") != ObjectOptimizer::cacheKey(a, dialect, "s"));
+}
+
+BOOST_AUTO_TEST_CASE(store_and_load)
+{
+	std::unique_ptr<YulStack> stack = parseAndOptimize(nestedSource, nullptr);
+	Object const& x = subObject(*stack->parserResult(), "X");
+
+	ObjectOptimizer objectOptimizer;
+	util::h256 const key = util::keccak256("key");
+	BOOST_TEST(!objectOptimizer.cachedCode(key));
+
+	objectOptimizer.storeCode(key, *x.code);
+	std::shared_ptr<Block const> cachedCode = objectOptimizer.cachedCode(key);
+	BOOST_REQUIRE(cachedCode);
+	// The cache holds a copy of the code.
+	BOOST_TEST(cachedCode.get() != x.code.get());
+	BOOST_TEST(
+		AsmPrinter(EVMDialect::strictAssemblyForEVMObjects(solidity::test::CommonOptions::get().evmVersion()))(*cachedCode) ==
+		AsmPrinter(EVMDialect::strictAssemblyForEVMObjects(solidity::test::CommonOptions::get().evmVersion()))(*x.code)
+	);
+}
+
+BOOST_AUTO_TEST_CASE(output_does_not_depend_on_cache)
+{
+	std::unique_ptr<YulStack> referenceStack = parseAndOptimize(nestedSource, nullptr);
+
+	auto objectOptimizer = std::make_shared<ObjectOptimizer>();
+	// The second run reuses the code of all objects optimized in the first one.
+	for (size_t run = 0; run < 2; ++run)
+	{
+		std::unique_ptr<YulStack> stack = parseAndOptimize(nestedSource, objectOptimizer);
+		BOOST_TEST(stack->print() == referenceStack->print());
+
+		Object const& a = *stack->parserResult();
+		BOOST_TEST(printCode(subObject(a, "X")) == printCode(subObject(subObject(a, "B"), "X")));
+	}
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
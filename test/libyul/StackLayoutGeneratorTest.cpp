@@ -50,6 +50,10 @@ StackLayoutGeneratorTest::StackLayoutGeneratorTest(std::string const& _filename)
 	m_source = m_reader.source();
 	auto dialectName = m_reader.stringSetting("dialect", "evm");
 	m_dialect = &dialect(dialectName, solidity::test::CommonOptions::get().evmVersion());
+	m_simpleLayoutOperationThreshold = m_reader.sizetSetting(
+		"simpleLayoutOperationThreshold",
+		StackLayoutGenerator::defaultSimpleLayoutOperationThreshold
+	);
 	m_expectation = m_reader.simpleExpectations();
 }
 
@@ -129,12 +133,12 @@ private:
 				}
 			}, entry->exit);
 
-		auto const& blockInfo = m_stackLayout.blockInfos.at(&_block);
+		auto const& blockInfo = m_stackLayout.blockInfo(_block);
 		m_stream << stackToString(blockInfo.entryLayout) << "\\l\\\n";
 		for (auto const& operation: _block.operations)
 		{
-			auto entryLayout = m_stackLayout.operationEntryLayout.at(&operation);
-			m_stream << stackToString(m_stackLayout.operationEntryLayout.at(&operation)) << "\\l\\\n";
+			auto entryLayout = m_stackLayout.operationEntryLayout(operation);
+			m_stream << stackToString(m_stackLayout.operationEntryLayout(operation)) << "\\l\\\n";
 			std::visit(util::GenericVisitor{
 				[&](CFG::FunctionCall const& _call) {
 					m_stream << _call.function.get().name.str();
@@ -225,7 +229,12 @@ TestCase::TestResult StackLayoutGeneratorTest::run(std::ostream& _stream, std::s
 	std::ostringstream output;
 
 	std::unique_ptr<CFG> cfg = ControlFlowGraphBuilder::build(*analysisInfo, *m_dialect, *object->code);
-	StackLayout stackLayout = StackLayoutGenerator::run(*cfg);
+	StackLayout stackLayout = StackLayoutGenerator::run(
+		*cfg,
+		false,
+		legacyReachableStackDepth,
+		m_simpleLayoutOperationThreshold
+	);
 
 	output << "digraph CFG {\nnodesep=0.7;\nnode[shape=box];\n\n";
 	StackLayoutPrinter printer{output, stackLayout};
@@ -38,6 +38,7 @@ public:
 	TestResult run(std::ostream& _stream, std::string const& _linePrefix = "", bool const _formatted = false) override;
 private:
 	Dialect const* m_dialect = nullptr;
+	size_t m_simpleLayoutOperationThreshold = 0;
 };
 }
 }
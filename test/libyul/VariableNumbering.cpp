@@ -0,0 +1,57 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Unit tests for the dense numbering of Yul variables.
+ */
+
+#include <libyul/optimiser/VariableNumbering.h>
+
+#include <boost/test/unit_test.hpp>
+
+namespace solidity::yul::test
+{
+
+BOOST_AUTO_TEST_SUITE(YulVariableNumbering)
+
+BOOST_AUTO_TEST_CASE(empty)
+{
+	VariableNumbering numbering{std::set<YulString>{}};
+	BOOST_CHECK_EQUAL(numbering.size(), 0);
+	BOOST_CHECK(!numbering.index(YulString{"x"}));
+}
+
+BOOST_AUTO_TEST_CASE(indices_follow_set_order)
+{
+	std::set<YulString> const variables{YulString{"a"}, YulString{"b"}, YulString{"c"}, YulString{"a_1"}};
+	VariableNumbering numbering{variables};
+	BOOST_REQUIRE_EQUAL(numbering.size(), variables.size());
+
+	size_t expectedIndex = 0;
+	for (YulString variable: variables)
+	{
+		BOOST_REQUIRE(numbering.index(variable));
+		BOOST_CHECK_EQUAL(*numbering.index(variable), expectedIndex);
+		++expectedIndex;
+	}
+	BOOST_CHECK(!numbering.index(YulString{"d"}));
+	BOOST_CHECK(!numbering.index(YulString{}));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
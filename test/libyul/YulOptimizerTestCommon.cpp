@@ -19,6 +19,7 @@
 #include <test/libyul/YulOptimizerTestCommon.h>
 
 #include <libyul/optimiser/BlockFlattener.h>
+#include <libyul/optimiser/BlockOutliner.h>
 #include <libyul/optimiser/VarDeclInitializer.h>
 #include <libyul/optimiser/VarNameCleaner.h>
 #include <libyul/optimiser/ControlFlowSimplifier.h>
@@ -48,6 +49,7 @@
 #include <libyul/optimiser/UnusedPruner.h>
 #include <libyul/optimiser/ExpressionJoiner.h>
 #include <libyul/optimiser/OptimiserStep.h>
+#include <libyul/optimiser/RangeSimplifier.h>
 #include <libyul/optimiser/SSAReverser.h>
 #include <libyul/optimiser/SSATransform.h>
 #include <libyul/optimiser/Semantics.h>
@@ -274,6 +276,11 @@ YulOptimizerTestCommon::YulOptimizerTestCommon(
 			ExpressionJoiner::run(*m_context, *m_ast);
 			ExpressionJoiner::run(*m_context, *m_ast);
 		}},
+		{"rangeSimplifier", [&]() {
+			disambiguate();
+			ForLoopInitRewriter::run(*m_context, *m_ast);
+			RangeSimplifier::run(*m_context, *m_ast);
+		}},
 		{"loopInvariantCodeMotion", [&]() {
 			disambiguate();
 			ForLoopInitRewriter::run(*m_context, *m_ast);
@@ -298,6 +305,12 @@ YulOptimizerTestCommon::YulOptimizerTestCommon(
 			FunctionHoister::run(*m_context, *m_ast);
 			EquivalentFunctionCombiner::run(*m_context, *m_ast);
 		}},
+		{"blockOutliner", [&]() {
+			disambiguate();
+			ForLoopInitRewriter::run(*m_context, *m_ast);
+			FunctionHoister::run(*m_context, *m_ast);
+			BlockOutliner::run(*m_context, *m_ast);
+		}},
 		{"ssaReverser", [&]() {
 			disambiguate();
 			SSAReverser::run(*m_context, *m_ast);
@@ -442,7 +455,7 @@ std::shared_ptr<Block> YulOptimizerTestCommon::run()
 
 void YulOptimizerTestCommon::disambiguate()
 {
-	*m_object->code = std::get<Block>(Disambiguator(*m_dialect, *m_analysisInfo)(*m_object->code));
+	Disambiguator(*m_dialect, *m_analysisInfo)(*m_object->code);
 	m_analysisInfo.reset();
 	updateContext();
 }
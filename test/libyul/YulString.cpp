@@ -0,0 +1,102 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Unit tests for the YulString repository.
+ */
+
+#include <libyul/YulString.h>
+
+#include <boost/test/unit_test.hpp>
+
+#include <thread>
+#include <vector>
+
+namespace solidity::yul::test
+{
+
+BOOST_AUTO_TEST_SUITE(YulStringTest)
+
+BOOST_AUTO_TEST_CASE(empty_string)
+{
+	BOOST_CHECK(YulString{}.empty());
+	BOOST_CHECK(YulString{""}.empty());
+	BOOST_CHECK(YulString{} == YulString{""});
+	BOOST_CHECK_EQUAL(YulString{}.str(), "");
+	BOOST_CHECK(!YulString{"x"}.empty());
+}
+
+BOOST_AUTO_TEST_CASE(equal_strings_share_id)
+{
+	YulString a{"yul_string_test_a"};
+	YulString b{"yul_string_test_b"};
+	BOOST_CHECK(a == YulString{"yul_string_test_a"});
+	BOOST_CHECK(a != b);
+	BOOST_CHECK_EQUAL(a.str(), "yul_string_test_a");
+	BOOST_CHECK_EQUAL(b.str(), "yul_string_test_b");
+}
+
+BOOST_AUTO_TEST_CASE(many_strings)
+{
+	// Enough strings to fill multiple storage segments of every shard.
+	std::vector<YulString> strings;
+	for (size_t i = 0; i < 20000; ++i)
+		strings.emplace_back("yul_string_test_many_" + std::to_string(i));
+
+	for (size_t i = 0; i < strings.size(); ++i)
+	{
+		BOOST_REQUIRE_EQUAL(strings[i].str(), "yul_string_test_many_" + std::to_string(i));
+		BOOST_REQUIRE(strings[i] == YulString{"yul_string_test_many_" + std::to_string(i)});
+	}
+}
+
+BOOST_AUTO_TEST_CASE(concurrent_interning)
+{
+	size_t const threadCount = 8;
+	size_t const stringCount = 2000;
+	std::vector<std::vector<YulString>> results(threadCount);
+
+	std::vector<std::thread> threads;
+	for (size_t thread = 0; thread < threadCount; ++thread)
+		threads.emplace_back([&, thread]() {
+			// Every thread creates the same strings, but in a different order.
+			for (size_t i = 0; i < stringCount; ++i)
+			{
+				size_t index = (i + thread * 97) % stringCount;
+				YulString string{"yul_string_test_concurrent_" + std::to_string(index)};
+				if (string.str() != "yul_string_test_concurrent_" + std::to_string(index))
+					return;
+				results[thread].push_back(string);
+			}
+		});
+	for (std::thread& thread: threads)
+		thread.join();
+
+	for (size_t thread = 0; thread < threadCount; ++thread)
+	{
+		BOOST_REQUIRE_EQUAL(results[thread].size(), stringCount);
+		for (size_t i = 0; i < stringCount; ++i)
+		{
+			size_t index = (i + thread * 97) % stringCount;
+			BOOST_CHECK(results[thread][i] == YulString{"yul_string_test_concurrent_" + std::to_string(index)});
+		}
+	}
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
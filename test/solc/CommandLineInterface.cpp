@@ -29,6 +29,7 @@
 #include <liblangutil/SemVerHandler.h>
 #include <test/FilesystemUtils.h>
 
+#include <libsolutil/CommonIO.h>
 #include <libsolutil/JSON.h>
 #include <libsolutil/TemporaryDirectory.h>
 
@@ -1105,6 +1106,39 @@ BOOST_AUTO_TEST_CASE(cli_no_output)
 	BOOST_REQUIRE(result.success);
 }
 
+BOOST_AUTO_TEST_CASE(cli_output_dir_concurrent_writes)
+{
+	TemporaryDirectory tempDir(TEST_CASE_NAME);
+	std::string const contractSource = R"(
+		// SPDX-License-Identifier: GPL-3.0
+		pragma solidity >=0.0;
+		contract A {}
+		contract B { function f() public {} }
+	)";
+	std::vector<std::string> const commandLine = {
+		"solc",
+		"-",
+		"--bin",
+		"--abi",
+		"--jobs=4",
+		"--output-dir=" + tempDir.path().string(),
+	};
+
+	OptionsReaderAndMessages result = runCLI(commandLine, contractSource);
+	BOOST_TEST(result.stderrContent == "");
+	BOOST_REQUIRE(result.success);
+	for (std::string const fileName: {"A.bin", "A.abi", "B.bin", "B.abi"})
+		BOOST_TEST(boost::filesystem::file_size(tempDir.path() / fileName) > 0);
+	BOOST_TEST(readFileAsString(tempDir.path() / "A.abi") == "[]");
+
+	// No file is written if one of them already exists.
+	boost::filesystem::remove(tempDir.path() / "B.abi");
+	result = runCLI(commandLine, contractSource);
+	BOOST_TEST(!result.success);
+	BOOST_TEST(boost::algorithm::contains(result.stderrContent, "Refusing to overwrite existing file"));
+	BOOST_TEST(!boost::filesystem::exists(tempDir.path() / "B.abi"));
+}
+
 BOOST_AUTO_TEST_CASE(standard_json_include_paths)
 {
 	TemporaryDirectory tempDir({"base/", "include/", "lib/nested/"}, TEST_CASE_NAME);
@@ -120,6 +120,8 @@ BOOST_AUTO_TEST_CASE(cli_mode_options)
 			"--evm-version=spuriousDragon",
 			"--via-ir",
 			"--experimental-via-ir",
+			"--jobs=4",
+			"--cache-dir=/tmp/cache",
 			"--revert-strings=strip",
 			"--debug-info=location",
 			"--pretty-json",
@@ -130,7 +132,7 @@ BOOST_AUTO_TEST_CASE(cli_mode_options)
 				"dir1/file1.sol:L=0x1234567890123456789012345678901234567890,"
 				"dir2/file2.sol:L=0x1111122222333334444455555666667777788888",
 			"--ast-compact-json", "--asm", "--asm-json", "--opcodes", "--bin", "--bin-runtime", "--abi",
-			"--ir", "--ir-ast-json", "--ir-optimized", "--ir-optimized-ast-json", "--hashes", "--userdoc", "--devdoc", "--metadata", "--storage-layout",
+			"--ir", "--ir-ast-json", "--ir-optimized", "--ir-optimized-ast-json", "--profile-optimizer", "--hashes", "--userdoc", "--devdoc", "--metadata", "--storage-layout",
 			"--gas",
 			"--combined-json="
 				"abi,metadata,bin,bin-runtime,opcodes,asm,storage-layout,generated-sources,generated-sources-runtime,"
@@ -140,6 +142,7 @@ BOOST_AUTO_TEST_CASE(cli_mode_options)
 			"--optimize",
 			"--optimize-yul",
 			"--optimize-runs=1000",
+			"--optimize-time-budget=500",
 			"--yul-optimizations=agf",
 			"--model-checker-bmc-loop-iterations=2",
 			"--model-checker-contracts=contract1.yul:A,contract2.yul:B",
@@ -147,11 +150,15 @@ BOOST_AUTO_TEST_CASE(cli_mode_options)
 			"--model-checker-engine=bmc",
 			"--model-checker-ext-calls=trusted",
 			"--model-checker-invariants=contract,reentrancy",
+			"--model-checker-parallel-queries=4",
+			"--model-checker-persistent-solvers",
+			"--model-checker-race-solvers",
 			"--model-checker-show-proved-safe",
 			"--model-checker-show-unproved",
 			"--model-checker-show-unsupported",
 			"--model-checker-solvers=z3,smtlib2",
 			"--model-checker-targets=underflow,divByZero",
+			"--model-checker-time-budget=1000",
 			"--model-checker-timeout=5"
 		};
 
@@ -179,6 +186,8 @@ BOOST_AUTO_TEST_CASE(cli_mode_options)
 		expectedOptions.output.overwriteFiles = true;
 		expectedOptions.output.evmVersion = EVMVersion::spuriousDragon();
 		expectedOptions.output.viaIR = true;
+		expectedOptions.output.jobs = 4;
+		expectedOptions.output.cacheDir = "/tmp/cache";
 		expectedOptions.output.revertStrings = RevertStrings::Strip;
 		expectedOptions.output.debugInfoSelection = DebugInfoSelection::fromString("location");
 		expectedOptions.formatting.json = JsonFormat{JsonFormat::Pretty, 7};
@@ -192,7 +201,7 @@ BOOST_AUTO_TEST_CASE(cli_mode_options)
 			true, true, true, true, true,
 			true, true, true, true, true,
 			true, true, true, true, true,
-			true,
+			true, true,
 		};
 		expectedOptions.compiler.estimateGas = true;
 		expectedOptions.compiler.combinedJsonRequests = {
@@ -207,6 +216,7 @@ BOOST_AUTO_TEST_CASE(cli_mode_options)
 		expectedOptions.optimizer.optimizeYul = true;
 		expectedOptions.optimizer.expectedExecutionsPerDeployment = 1000;
 		expectedOptions.optimizer.yulSteps = "agf";
+		expectedOptions.optimizer.timeBudget = 500;
 
 		expectedOptions.modelChecker.initialize = true;
 		expectedOptions.modelChecker.settings = {
@@ -216,14 +226,18 @@ BOOST_AUTO_TEST_CASE(cli_mode_options)
 			{true, false},
 			{ModelCheckerExtCalls::Mode::TRUSTED},
 			{{InvariantType::Contract, InvariantType::Reentrancy}},
+			4, // --model-checker-parallel-queries
 			false, // --model-checker-print-query
+			true, // --model-checker-race-solvers
 			true,
 			true,
 			true,
 			{false, false, true, true},
 			{{VerificationTargetType::Underflow, VerificationTargetType::DivByZero}},
+			1000, // --model-checker-time-budget
 			5,
 		};
+		expectedOptions.modelChecker.persistentSolvers = true;
 
 		CommandLineOptions parsedOptions = parseCommandLine(commandLine);
 
@@ -266,6 +280,38 @@ BOOST_AUTO_TEST_CASE(via_ir_options)
 		BOOST_TEST(parseCommandLine({"solc", viaIrOption, "contract.sol"}).output.viaIR);
 }
 
+BOOST_AUTO_TEST_CASE(jobs_option)
+{
+	BOOST_TEST(parseCommandLine({"solc", "contract.sol"}).output.jobs == 1);
+	BOOST_TEST(parseCommandLine({"solc", "--jobs=8", "contract.sol"}).output.jobs == 8);
+	BOOST_TEST(parseCommandLine({"solc", "-j", "3", "contract.sol"}).output.jobs == 3);
+
+	std::string const expectedErrorMessage = "Invalid option for --jobs: The number of jobs must be positive.";
+	auto hasCorrectMessage = [&](CommandLineValidationError const& _exception) { return _exception.what() == expectedErrorMessage; };
+	BOOST_CHECK_EXCEPTION(parseCommandLine({"solc", "--jobs=0", "contract.sol"}), CommandLineValidationError, hasCorrectMessage);
+}
+
+BOOST_AUTO_TEST_CASE(server_option)
+{
+	BOOST_TEST(!parseCommandLine({"solc", "--standard-json"}).input.server);
+
+	CommandLineOptions parsedOptions = parseCommandLine({"solc", "--standard-json", "--server"});
+	BOOST_TEST(parsedOptions.input.mode == InputMode::StandardJson);
+	BOOST_TEST(parsedOptions.input.server);
+	BOOST_TEST(!parsedOptions.input.addStdin);
+	BOOST_TEST(parsedOptions.input.paths.empty());
+
+	std::string const expectedInputFileMessage = "--server reads the inputs from standard input and does not accept input files.";
+	auto hasInputFileMessage = [&](CommandLineValidationError const& _exception) { return _exception.what() == expectedInputFileMessage; };
+	BOOST_CHECK_EXCEPTION(parseCommandLine({"solc", "--standard-json", "--server", "input.json"}), CommandLineValidationError, hasInputFileMessage);
+	BOOST_CHECK_EXCEPTION(parseCommandLine({"solc", "--standard-json", "--server", "-"}), CommandLineValidationError, hasInputFileMessage);
+
+	std::string const expectedFormatMessage = "--server writes each output as a single line and cannot be combined with --pretty-json or --json-indent.";
+	auto hasFormatMessage = [&](CommandLineValidationError const& _exception) { return _exception.what() == expectedFormatMessage; };
+	BOOST_CHECK_EXCEPTION(parseCommandLine({"solc", "--standard-json", "--server", "--pretty-json"}), CommandLineValidationError, hasFormatMessage);
+	BOOST_CHECK_EXCEPTION(parseCommandLine({"solc", "--standard-json", "--server", "--json-indent=2"}), CommandLineValidationError, hasFormatMessage);
+}
+
 BOOST_AUTO_TEST_CASE(assembly_mode_options)
 {
 	static std::vector<std::tuple<std::vector<std::string>, YulStack::Machine, YulStack::Language>> const allowedCombinations = {
@@ -423,8 +469,14 @@ BOOST_AUTO_TEST_CASE(invalid_options_input_modes_combinations)
 		// TODO: This should eventually contain all options.
 		{"--experimental-via-ir", {"--assemble", "--yul", "--strict-assembly", "--standard-json", "--link"}},
 		{"--via-ir", {"--assemble", "--yul", "--strict-assembly", "--standard-json", "--link"}},
+		{"--jobs=2", {"--standard-json", "--link"}},
+		{"--cache-dir=/tmp/cache", {"--assemble", "--yul", "--strict-assembly", "--standard-json", "--link"}},
+		{"--server", {"--assemble", "--yul", "--strict-assembly", "--link"}},
 		{"--metadata-literal", {"--assemble", "--yul", "--strict-assembly", "--standard-json", "--link"}},
 		{"--metadata-hash=swarm", {"--assemble", "--yul", "--strict-assembly", "--standard-json", "--link"}},
+		{"--model-checker-parallel-queries=4", {"--assemble", "--yul", "--strict-assembly", "--standard-json", "--link"}},
+		{"--model-checker-persistent-solvers", {"--assemble", "--yul", "--strict-assembly", "--standard-json", "--link"}},
+		{"--model-checker-race-solvers", {"--assemble", "--yul", "--strict-assembly", "--standard-json", "--link"}},
 		{"--model-checker-show-proved-safe", {"--assemble", "--yul", "--strict-assembly", "--standard-json", "--link"}},
 		{"--model-checker-show-unproved", {"--assemble", "--yul", "--strict-assembly", "--standard-json", "--link"}},
 		{"--model-checker-show-unsupported", {"--assemble", "--yul", "--strict-assembly", "--standard-json", "--link"}},
@@ -432,6 +484,7 @@ BOOST_AUTO_TEST_CASE(invalid_options_input_modes_combinations)
 		{"--model-checker-engine=bmc", {"--assemble", "--yul", "--strict-assembly", "--standard-json", "--link"}},
 		{"--model-checker-invariants=contract,reentrancy", {"--assemble", "--yul", "--strict-assembly", "--standard-json", "--link"}},
 		{"--model-checker-solvers=z3,smtlib2", {"--assemble", "--yul", "--strict-assembly", "--standard-json", "--link"}},
+		{"--model-checker-time-budget=1000", {"--assemble", "--yul", "--strict-assembly", "--standard-json", "--link"}},
 		{"--model-checker-timeout=5", {"--assemble", "--yul", "--strict-assembly", "--standard-json", "--link"}},
 		{"--model-checker-contracts=contract1.yul:A,contract2.yul:B", {"--assemble", "--yul", "--strict-assembly", "--standard-json", "--link"}},
 		{"--model-checker-targets=underflow,divByZero", {"--assemble", "--yul", "--strict-assembly", "--standard-json", "--link"}}
@@ -74,7 +74,7 @@ public:
 
 	void visit(test_case const& _testCase) override
 	{
-		if (!m_batcher.checkAndAdvance())
+		if (!m_batcher.checkAndAdvance(_testCase.full_name()))
 			// disabling them would be nicer, but it does not work like this:
 			// const_cast<test_case&>(_testCase).p_run_status.value = test_unit::RS_DISABLED;
 			m_path.back()->remove(_testCase.p_id);
@@ -171,7 +171,7 @@ int registerTests(
 	else
 	{
 		// TODO would be better to set the test to disabled.
-		if (_batcher.checkAndAdvance())
+		if (_batcher.checkAndAdvance(fullpath.lexically_relative(solidity::test::CommonOptions::get().testPath).generic_string()))
 		{
 			// This must be a vector of unique_ptrs because Boost.Test keeps the equivalent of a string_view to the filename
 			// that is passed in. If the strings were stored directly in the vector, pointers/references to them would be
@@ -241,8 +241,10 @@ test_suite* init_unit_test_suite(int /*argc*/, char* /*argv*/[])
 		if (!solidity::test::CommonOptions::get().enforceGasTest)
 			std::cout << std::endl << "WARNING :: Gas Cost Expectations are not being enforced" << std::endl << std::endl;
 
-		Batcher batcher(CommonOptions::get().selectedBatch, CommonOptions::get().batches);
-		if (CommonOptions::get().batches > 1)
+		Batcher batcher(CommonOptions::get().selectedBatch, CommonOptions::get().batches, CommonOptions::get().batchByName);
+		if (CommonOptions::get().batchByName)
+			std::cout << "Shard " << CommonOptions::get().selectedBatch + 1 << " out of " << CommonOptions::get().batches << std::endl;
+		else if (CommonOptions::get().batches > 1)
 			std::cout << "Batch " << CommonOptions::get().selectedBatch << " out of " << CommonOptions::get().batches << std::endl;
 
 		// Batch the boost tests
@@ -66,9 +66,11 @@ void IsolTestOptions::addOptions()
 	CommonOptions::addOptions();
 	options.add_options()
 		("editor", po::value<std::string>(&editor)->default_value(editorPath()), "Path to editor for opening test files.")
+		("jobs,j", po::value<size_t>(&jobs)->default_value(jobs), "Number of worker processes running the test cases concurrently. Failing test cases are run again one by one, in order.")
 		("help", po::bool_switch(&showHelp)->default_value(showHelp), "Show this help screen.")
 		("no-color", po::bool_switch(&noColor)->default_value(noColor), "Don't use colors.")
 		("accept-updates", po::bool_switch(&acceptUpdates)->default_value(acceptUpdates), "Automatically accept expectation updates.")
+		("gas-benchmarks", po::bool_switch(&gasBenchmarks)->default_value(gasBenchmarks), "Only run the gas benchmarks in test/benchmarks/gas and enforce the gas cost of every call.")
 		("test,t", po::value<std::string>(&testFilter)->default_value("*/*"), "Filters which test units to include.");
 }
 
@@ -83,6 +85,11 @@ bool IsolTestOptions::parse(int _argc, char const* const* _argv)
 	}
 
 	enforceGasTest = enforceGasTest || (evmVersion() == langutil::EVMVersion{} && !useABIEncoderV1);
+	if (gasBenchmarks)
+	{
+		enforceGasTest = true;
+		enforceGasTestMinValue = 0;
+	}
 
 	return shouldContinue;
 }
@@ -97,6 +104,10 @@ void IsolTestOptions::validate() const
 		ConfigException,
 		"Invalid test unit filter - can only contain '" + filterString + ": " + testFilter
 	);
+	assertThrow(jobs > 0, ConfigException, "The number of jobs has to be positive.");
+#if defined(_WIN32)
+	assertThrow(jobs == 1, ConfigException, "Running test cases concurrently is not supported on Windows.");
+#endif
 }
 
 }
@@ -34,6 +34,8 @@ struct IsolTestOptions: CommonOptions
 	bool acceptUpdates = false;
 	std::string testFilter = std::string{};
 	std::string editor = std::string{};
+	size_t jobs = 1;
+	bool gasBenchmarks = false;
 
 	explicit IsolTestOptions();
 	void addOptions() override;
@@ -0,0 +1,430 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <test/tools/Microbenchmarks.h>
+
+#include <libyul/AST.h>
+#include <libyul/AsmAnalysisInfo.h>
+#include <libyul/Exceptions.h>
+#include <libyul/Object.h>
+#include <libyul/YulStack.h>
+#include <libyul/YulString.h>
+#include <libyul/backends/evm/ControlFlowGraphBuilder.h>
+#include <libyul/backends/evm/EVMDialect.h>
+#include <libyul/backends/evm/StackLayoutGenerator.h>
+#include <libyul/optimiser/DataFlowAnalyzer.h>
+#include <libyul/optimiser/KnowledgeBase.h>
+#include <libyul/optimiser/SimplificationRules.h>
+
+#include <libevmasm/Assembly.h>
+
+#include <liblangutil/CharStream.h>
+#include <liblangutil/DebugInfoSelection.h>
+#include <liblangutil/Scanner.h>
+
+#include <libsolidity/interface/OptimiserSettings.h>
+
+#include <libsolutil/Keccak256.h>
+#include <libsolutil/Whiskers.h>
+
+#include <functional>
+#include <map>
+#include <memory>
+
+using namespace solidity;
+using namespace solidity::langutil;
+using namespace solidity::util;
+using namespace solidity::yul;
+
+namespace
+{
+
+using Clock = std::chrono::steady_clock;
+
+/// Runs the measured operation the given number of times and returns the time it took.
+/// Anything that should not be measured has to be done before, when the body is created.
+using Body = std::function<Clock::duration(size_t _iterations)>;
+
+char const* const SoliditySource = R"(
+// SPDX-License-Identifier: GPL-3.0
+pragma solidity >=0.8.0;
+
+/// @title A token with allowances.
+contract Token {
+	mapping(address => uint256) public balanceOf;
+	mapping(address => mapping(address => uint256)) public allowance;
+	uint256 public totalSupply;
+
+	event Transfer(address indexed from, address indexed to, uint256 value);
+	event Approval(address indexed owner, address indexed spender, uint256 value);
+
+	error InsufficientBalance(uint256 available, uint256 required);
+
+	constructor(uint256 _initialSupply) {
+		balanceOf[msg.sender] = _initialSupply;
+		totalSupply = _initialSupply;
+	}
+
+	function transfer(address _to, uint256 _value) external returns (bool) {
+		_transfer(msg.sender, _to, _value);
+		return true;
+	}
+
+	function approve(address _spender, uint256 _value) external returns (bool) {
+		allowance[msg.sender][_spender] = _value;
+		emit Approval(msg.sender, _spender, _value);
+		return true;
+	}
+
+	function transferFrom(address _from, address _to, uint256 _value) external returns (bool) {
+		uint256 allowed = allowance[_from][msg.sender];
+		if (allowed != type(uint256).max)
+			allowance[_from][msg.sender] = allowed - _value;
+		_transfer(_from, _to, _value);
+		return true;
+	}
+
+	function _transfer(address _from, address _to, uint256 _value) internal {
+		uint256 balance = balanceOf[_from];
+		if (balance < _value)
+			revert InsufficientBalance(balance, _value);
+		unchecked { balanceOf[_from] = balance - _value; }
+		balanceOf[_to] += _value;
+		emit Transfer(_from, _to, _value);
+	}
+}
+)";
+
+char const* const YulSource = R"(
+{
+	function checked_add(x, y) -> sum
+	{
+		sum := add(x, y)
+		if gt(x, sum) { revert(0, 0) }
+	}
+	function sum_array(offset, length) -> total
+	{
+		for { let i := 0 } lt(i, length) { i := add(i, 1) }
+		{
+			total := checked_add(total, calldataload(add(offset, mul(i, 0x20))))
+		}
+	}
+	function store_pair(slot, a, b)
+	{
+		sstore(slot, a)
+		sstore(add(slot, 1), b)
+	}
+	function dispatch(selector) -> result
+	{
+		switch selector
+		case 0x01 { result := sum_array(4, calldataload(4)) }
+		case 0x02
+		{
+			store_pair(calldataload(4), calldataload(36), calldataload(68))
+			result := 1
+		}
+		default { result := keccak256(0, calldatasize()) }
+	}
+	mstore(0x40, 0x80)
+	let r := dispatch(shr(224, calldataload(0)))
+	mstore(0, r)
+	return(0, 0x20)
+}
+)";
+
+/// Expressions that are matched by the simplification rules (and some that are not).
+char const* const SimplifiableYulSource = R"(
+{
+	let x := calldataload(0)
+	let a := add(x, 0)
+	let b := mul(x, 1)
+	let c := sub(x, x)
+	let d := and(x, not(0))
+	let e := add(add(x, 1), 2)
+	let f := iszero(iszero(lt(x, 5)))
+	let g := shr(0, x)
+	let h := div(x, 32)
+	let i := xor(x, calldataload(32))
+}
+)";
+
+/// Variables in SSA form, with constant differences between some of them.
+char const* const KnowledgeBaseYulSource = R"(
+{
+	let a := calldataload(0)
+	let b := add(a, 32)
+	let c := add(b, 64)
+	let d := sub(c, 1)
+	let e := 7
+	let f := add(e, 9)
+	sstore(a, f)
+}
+)";
+
+char const* const WhiskersTemplate = R"(
+function <functionName>(headStart, dataEnd) <?hasReturn>-> <retParams></hasReturn> {
+	if slt(sub(dataEnd, headStart), <minimumSize>) { <revertString>() }
+	<#members>
+	{
+		let offset := <offset>
+		<?+dynamic>
+		let length := calldataload(add(headStart, offset))
+		<name> := <decode>(add(headStart, offset), length, dataEnd)
+		<!+dynamic>
+		<name> := <decode>(add(headStart, offset), dataEnd)
+		</+dynamic>
+	}
+	</members>
+}
+)";
+
+/// Stores the address of the value in a volatile variable so that the compiler cannot
+/// remove the computation of the value as dead code.
+void const* volatile g_sink = nullptr;
+
+template<typename T>
+void doNotOptimize(T const& _value)
+{
+	g_sink = &_value;
+}
+
+template<typename Operation>
+Clock::duration timeIterations(size_t _iterations, Operation&& _operation)
+{
+	auto const start = Clock::now();
+	for (size_t i = 0; i < _iterations; ++i)
+		_operation();
+	return Clock::now() - start;
+}
+
+std::shared_ptr<YulStack> parseYul(std::string const& _source)
+{
+	auto stack = std::make_shared<YulStack>(
+		EVMVersion{},
+		std::nullopt,
+		YulStack::Language::StrictAssembly,
+		frontend::OptimiserSettings::minimal(),
+		DebugInfoSelection::Default()
+	);
+	bool const success = stack->parseAndAnalyze("", _source);
+	yulAssert(success && stack->errors().empty(), "Invalid benchmark source.");
+	return stack;
+}
+
+/// @returns the values of the variable declarations in the outermost block of the program.
+std::vector<Expression const*> declaredValues(Block const& _block)
+{
+	std::vector<Expression const*> values;
+	for (Statement const& statement: _block.statements)
+		if (auto const* declaration = std::get_if<VariableDeclaration>(&statement))
+			values.push_back(declaration->value.get());
+	return values;
+}
+
+Body yulStringRepositoryBenchmark()
+{
+	// Mostly existing names, like in the optimiser, which looks names up far more often than it
+	// creates them.
+	auto names = std::make_shared<std::vector<std::string>>();
+	for (size_t i = 0; i < 100; ++i)
+		names->push_back("usr$variable_" + std::to_string(i));
+
+	return [names](size_t _iterations) {
+		return timeIterations(_iterations, [&]() {
+			for (std::string const& name: *names)
+				doNotOptimize(YulStringRepository::instance().stringToHandle(name));
+		});
+	};
+}
+
+Body keccak256Benchmark(size_t _size)
+{
+	auto input = std::make_shared<bytes>(_size, uint8_t(0x42));
+	return [input](size_t _iterations) {
+		return timeIterations(_iterations, [&]() {
+			doNotOptimize(keccak256(*input));
+		});
+	};
+}
+
+Body scannerBenchmark()
+{
+	auto stream = std::make_shared<CharStream>(SoliditySource, "");
+	auto scanner = std::make_shared<Scanner>(*stream);
+	return [stream, scanner](size_t _iterations) {
+		return timeIterations(_iterations, [&]() {
+			scanner->reset();
+			while (scanner->next() != Token::EOS)
+				doNotOptimize(scanner->currentToken());
+		});
+	};
+}
+
+Body whiskersBenchmark()
+{
+	return [](size_t _iterations) {
+		return timeIterations(_iterations, [&]() {
+			std::vector<std::map<std::string, std::string>> members;
+			for (size_t i = 0; i < 4; ++i)
+				members.push_back({
+					{"offset", std::to_string(i * 32)},
+					{"name", "value" + std::to_string(i)},
+					{"decode", i % 2 ? "abi_decode_t_bytes" : "abi_decode_t_uint256"},
+					{"dynamic", i % 2 ? "true" : ""},
+				});
+			Whiskers templ(WhiskersTemplate);
+			templ("functionName", "abi_decode_tuple_t_uint256_t_bytes");
+			templ("hasReturn", true);
+			templ("retParams", "value0, value1, value2, value3");
+			templ("minimumSize", "128");
+			templ("revertString", "revert_error_dbdddcbe895c83990c08b3492a0e83918d802a52331272ac6fdb6a7c4aea3b1b");
+			templ("members", members);
+			doNotOptimize(templ.render());
+		});
+	};
+}
+
+Body knowledgeBaseBenchmark()
+{
+	std::shared_ptr<YulStack> stack = parseYul(KnowledgeBaseYulSource);
+	auto ssaValues = std::make_shared<std::map<YulString, AssignedValue>>();
+	for (Statement const& statement: stack->parserResult()->code->statements)
+		if (auto const* declaration = std::get_if<VariableDeclaration>(&statement))
+			(*ssaValues)[declaration->variables.front().name] = AssignedValue{declaration->value.get(), 0};
+
+	return [stack, ssaValues](size_t _iterations) {
+		YulString const a{"a"}, b{"b"}, c{"c"}, d{"d"}, e{"e"}, f{"f"};
+		return timeIterations(_iterations, [&]() {
+			KnowledgeBase knowledge(*ssaValues);
+			doNotOptimize(knowledge.knownToBeDifferent(a, c));
+			doNotOptimize(knowledge.differenceIfKnownConstant(b, d));
+			doNotOptimize(knowledge.knownToBeDifferentByAtLeast32(a, b));
+			doNotOptimize(knowledge.knownToBeZero(e));
+			doNotOptimize(knowledge.valueIfKnownConstant(f));
+		});
+	};
+}
+
+Body simplificationRulesBenchmark()
+{
+	std::shared_ptr<YulStack> stack = parseYul(SimplifiableYulSource);
+	auto expressions = std::make_shared<std::vector<Expression const*>>(declaredValues(*stack->parserResult()->code));
+	Dialect const& dialect = EVMDialect::strictAssemblyForEVMObjects(EVMVersion{});
+
+	return [stack, expressions, &dialect](size_t _iterations) {
+		auto const noSSAValues = [](YulString) -> AssignedValue const* { return nullptr; };
+		return timeIterations(_iterations, [&]() {
+			for (Expression const* expression: *expressions)
+				doNotOptimize(SimplificationRules::findFirstMatch(*expression, dialect, noSSAValues));
+		});
+	};
+}
+
+Body stackLayoutGeneratorBenchmark()
+{
+	std::shared_ptr<YulStack> stack = parseYul(YulSource);
+	Object const& object = *stack->parserResult();
+	std::shared_ptr<CFG> cfg = ControlFlowGraphBuilder::build(
+		*object.analysisInfo,
+		EVMDialect::strictAssemblyForEVMObjects(EVMVersion{}),
+		*object.code
+	);
+
+	return [stack, cfg](size_t _iterations) {
+		return timeIterations(_iterations, [&]() {
+			doNotOptimize(StackLayoutGenerator::run(*cfg));
+		});
+	};
+}
+
+Body assemblyBenchmark()
+{
+	std::shared_ptr<evmasm::Assembly> assembly = parseYul(YulSource)->assembleEVMWithDeployed().first;
+	yulAssert(assembly && assembly->numSubs() == 0);
+
+	return [assembly](size_t _iterations) {
+		// An assembly caches its bytecode, so each iteration needs a fresh copy, which is not
+		// measured. Assembling takes long enough for the overhead of the separate measurements
+		// not to matter.
+		Clock::duration duration{};
+		for (size_t i = 0; i < _iterations; ++i)
+		{
+			evmasm::Assembly const copy(*assembly);
+			auto const start = Clock::now();
+			doNotOptimize(copy.assemble());
+			duration += Clock::now() - start;
+		}
+		return duration;
+	};
+}
+
+std::vector<std::pair<std::string, std::function<Body()>>> const& microbenchmarks()
+{
+	static std::vector<std::pair<std::string, std::function<Body()>>> const benchmarks = {
+		{"YulStringRepository::stringToHandle/100", yulStringRepositoryBenchmark},
+		{"keccak256/32", []() { return keccak256Benchmark(32); }},
+		{"keccak256/1024", []() { return keccak256Benchmark(1024); }},
+		{"Scanner::next", scannerBenchmark},
+		{"Whiskers::render", whiskersBenchmark},
+		{"KnowledgeBase", knowledgeBaseBenchmark},
+		{"SimplificationRules::findFirstMatch/10", simplificationRulesBenchmark},
+		{"StackLayoutGenerator::run", stackLayoutGeneratorBenchmark},
+		{"Assembly::assemble", assemblyBenchmark},
+	};
+	return benchmarks;
+}
+
+}
+
+std::vector<std::string> solidity::test::microbenchmarkNames()
+{
+	std::vector<std::string> names;
+	for (auto const& [name, factory]: microbenchmarks())
+		names.push_back(name);
+	return names;
+}
+
+std::vector<solidity::test::MicrobenchmarkResult> solidity::test::runMicrobenchmarks(
+	std::string const& _filter,
+	std::chrono::milliseconds _minTime
+)
+{
+	std::vector<MicrobenchmarkResult> results;
+	for (auto const& [name, factory]: microbenchmarks())
+	{
+		if (name.find(_filter) == std::string::npos)
+			continue;
+
+		Body const body = factory();
+		size_t iterations = 1;
+		Clock::duration duration = body(iterations);
+		while (duration < _minTime)
+		{
+			iterations *= 2;
+			duration = body(iterations);
+		}
+
+		results.push_back({
+			name,
+			iterations,
+			static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count()) /
+				static_cast<double>(iterations)
+		});
+	}
+	return results;
+}
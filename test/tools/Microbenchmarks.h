@@ -0,0 +1,50 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Micro-benchmarks of the core data structures and algorithms of the compiler.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace solidity::test
+{
+
+struct MicrobenchmarkResult
+{
+	std::string name;
+	/// Number of iterations in the measured batch.
+	size_t iterations = 0;
+	double nanosecondsPerIteration = 0;
+};
+
+/// @returns the names of all available micro-benchmarks.
+std::vector<std::string> microbenchmarkNames();
+
+/// Runs the micro-benchmarks whose names contain @a _filter. The number of iterations of each
+/// is doubled until a batch takes at least @a _minTime, and only the last batch is reported.
+std::vector<MicrobenchmarkResult> runMicrobenchmarks(
+	std::string const& _filter,
+	std::chrono::milliseconds _minTime
+);
+
+}
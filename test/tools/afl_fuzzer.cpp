@@ -107,6 +107,35 @@ Allowed options)",
 		inputs.emplace_back("");
 
 	bool optimize = !arguments.count("without-optimizer");
+	auto runInput = [&](std::string const& _input) {
+		if (arguments.count("const-opt"))
+			FuzzerUtil::testConstantOptimizer(_input, quiet);
+		else if (arguments.count("standard-json"))
+			FuzzerUtil::testStandardCompiler(_input, quiet);
+		else
+			FuzzerUtil::testCompilerJsonInterface(_input, optimize, quiet);
+		FuzzerUtil::finishRun();
+	};
+
+	if (!arguments.count("const-opt"))
+		FuzzerUtil::initialize();
+
+#ifdef __AFL_HAVE_MANUAL_CONTROL
+	// Persistent mode of afl-clang-fast: The fork server is only started now, so that the state built
+	// by initialize() is inherited by all processes, and each of them handles many inputs from stdin.
+	// Failures are not caught, so that AFL sees them.
+	if (inputs.size() == 1 && inputs.front().empty())
+	{
+		__AFL_INIT();
+		while (__AFL_LOOP(1000))
+		{
+			std::cin.clear();
+			runInput(readUntilEnd(std::cin));
+		}
+		return 0;
+	}
+#endif
+
 	int retResult = 0;
 
 	for (std::string const& inputFile: inputs)
@@ -119,12 +148,7 @@ Allowed options)",
 
 		try
 		{
-			if (arguments.count("const-opt"))
-				FuzzerUtil::testConstantOptimizer(input, quiet);
-			else if (arguments.count("standard-json"))
-				FuzzerUtil::testStandardCompiler(input, quiet);
-			else
-				FuzzerUtil::testCompilerJsonInterface(input, optimize, quiet);
+			runInput(input);
 		}
 		catch (...)
 		{
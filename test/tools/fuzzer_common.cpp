@@ -24,6 +24,8 @@
 
 #include <libsolutil/JSON.h>
 
+#include <libyul/YulString.h>
+
 #include <libevmasm/Assembly.h>
 #include <libevmasm/ConstantOptimiser.h>
 
@@ -111,12 +113,15 @@ void FuzzerUtil::testCompiler(
 			frontend::ModelCheckerEngine::All(),
 			frontend::ModelCheckerExtCalls{},
 			frontend::ModelCheckerInvariants::All(),
+			/*parallelQueries=*/1,
 			/*printQuery=*/false,
+			/*raceSolvers=*/false,
 			/*showProvedSafe=*/false,
 			/*showUnproved=*/false,
 			/*showUnsupported=*/false,
 			smtutil::SMTSolverChoice::All(),
 			frontend::ModelCheckerTargets::Default(),
+			/*timeBudget=*/std::nullopt,
 			/*timeout=*/1
 		});
 	}
@@ -144,6 +149,28 @@ void FuzzerUtil::testCompiler(
 	}
 }
 
+void FuzzerUtil::initialize()
+{
+	StringMap sources{{"", R"(
+		// SPDX-License-Identifier: GPL-3.0
+		pragma solidity >=0.0;
+		contract C {
+			uint[] a;
+			function f(uint _x) public returns (uint) { a.push(_x); return a.length * _x + 1; }
+		}
+	)"}};
+	for (bool optimize: {false, true})
+		for (bool compileViaYul: {false, true})
+			testCompiler(sources, optimize, /*_rand=*/0, /*_forceSMT=*/false, compileViaYul);
+}
+
+void FuzzerUtil::finishRun()
+{
+	static size_t runs = 0;
+	if (++runs % RepositoryResetInterval == 0)
+		yul::YulStringRepository::reset();
+}
+
 void FuzzerUtil::runCompiler(std::string const& _input, bool _quiet)
 {
 	if (!_quiet)
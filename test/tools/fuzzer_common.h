@@ -47,4 +47,13 @@ struct FuzzerUtil
 	/// Adds the experimental SMTChecker pragma to each source file in the
 	/// source map.
 	static void forceSMT(solidity::StringMap& _input);
+	/// Builds the process-wide state of the compiler that does not depend on the input, e.g. the
+	/// Yul dialects and the simplification rules, by compiling a small contract with and without
+	/// the optimizer. Harnesses that process many inputs in one process call this once up front.
+	static void initialize();
+	/// Called by such harnesses after each input. Clears the YulString repository every
+	/// @a RepositoryResetInterval inputs, which bounds its memory usage while keeping the state
+	/// built on top of it, which is dropped together with it, for most inputs.
+	static void finishRun();
+	static constexpr size_t RepositoryResetInterval = 1000;
 };
@@ -29,13 +29,23 @@
 #include <boost/filesystem.hpp>
 
 #include <cstdlib>
+#include <functional>
 #include <iostream>
+#include <map>
+#include <optional>
 #include <queue>
 #include <regex>
+#include <sstream>
 #include <utility>
+#include <vector>
 
 #if defined(_WIN32)
 #include <windows.h>
+#else
+#include <poll.h>
+#include <signal.h>
+#include <sys/wait.h>
+#include <unistd.h>
 #endif
 
 using namespace solidity;
@@ -112,7 +122,8 @@ public:
 		Skipped
 	};
 
-	Result process();
+	/// Runs the test case if it matches the filter and prints the outcome to @a _stream.
+	Result process(std::ostream& _stream);
 
 	static TestStats processPath(
 		TestCreator _testCaseCreator,
@@ -145,7 +156,7 @@ private:
 
 bool TestTool::m_exitRequested = false;
 
-TestTool::Result TestTool::process()
+TestTool::Result TestTool::process(std::ostream& _stream)
 {
 	bool formatted{!m_options.noColor};
 
@@ -153,7 +164,7 @@ TestTool::Result TestTool::process()
 	{
 		if (m_filter.matches(m_path, m_name))
 		{
-			(AnsiColorized(std::cout, formatted, {BOLD}) << m_name << ": ").flush();
+			(AnsiColorized(_stream, formatted, {BOLD}) << m_name << ": ").flush();
 
 			m_test = m_testCaseCreator(TestCase::Config{
 				m_path.string(),
@@ -169,22 +180,22 @@ TestTool::Result TestTool::process()
 				switch (TestCase::TestResult result = m_test->run(outputMessages, "  ", formatted))
 				{
 					case TestCase::TestResult::Success:
-						AnsiColorized(std::cout, formatted, {BOLD, GREEN}) << "OK" << std::endl;
+						AnsiColorized(_stream, formatted, {BOLD, GREEN}) << "OK" << std::endl;
 						return Result::Success;
 					default:
-						AnsiColorized(std::cout, formatted, {BOLD, RED}) << "FAIL" << std::endl;
+						AnsiColorized(_stream, formatted, {BOLD, RED}) << "FAIL" << std::endl;
 
-						AnsiColorized(std::cout, formatted, {BOLD, CYAN}) << "  Contract:" << std::endl;
-						m_test->printSource(std::cout, "    ", formatted);
-						m_test->printSettings(std::cout, "    ", formatted);
+						AnsiColorized(_stream, formatted, {BOLD, CYAN}) << "  Contract:" << std::endl;
+						m_test->printSource(_stream, "    ", formatted);
+						m_test->printSettings(_stream, "    ", formatted);
 
-						std::cout << std::endl << outputMessages.str() << std::endl;
+						_stream << std::endl << outputMessages.str() << std::endl;
 						return result == TestCase::TestResult::FatalError ? Result::Exception : Result::Failure;
 				}
 			}
 			else
 			{
-				AnsiColorized(std::cout, formatted, {BOLD, YELLOW}) << "NOT RUN" << std::endl;
+				AnsiColorized(_stream, formatted, {BOLD, YELLOW}) << "NOT RUN" << std::endl;
 				return Result::Skipped;
 			}
 		}
@@ -193,19 +204,19 @@ TestTool::Result TestTool::process()
 	}
 	catch (boost::exception const& _e)
 	{
-		AnsiColorized(std::cout, formatted, {BOLD, RED}) <<
+		AnsiColorized(_stream, formatted, {BOLD, RED}) <<
 			"Exception during test: " << boost::diagnostic_information(_e) << std::endl;
 		return Result::Exception;
 	}
 	catch (std::exception const& _e)
 	{
-		AnsiColorized(std::cout, formatted, {BOLD, RED}) <<
+		AnsiColorized(_stream, formatted, {BOLD, RED}) <<
 			"Exception during test: " << boost::diagnostic_information(_e) << std::endl;
 		return Result::Exception;
 	}
 	catch (...)
 	{
-		AnsiColorized(std::cout, formatted, {BOLD, RED}) <<
+		AnsiColorized(_stream, formatted, {BOLD, RED}) <<
 			"Unknown exception during test: " << boost::current_exception_diagnostic_information() << std::endl;
 		return Result::Exception;
 	}
@@ -264,6 +275,178 @@ TestTool::Request TestTool::handleResponse(bool _exception)
 	}
 }
 
+#if !defined(_WIN32)
+/// Runs test cases in forked worker processes, which is safe unlike threads because the global
+/// state of the compiler is not shared and every worker gets its own instance of the VMs.
+/// Each worker sends the result and output of its test cases in order through its own pipe.
+class TestWorkers
+{
+public:
+	using RunTest = std::function<std::pair<TestTool::Result, std::string>(size_t)>;
+
+	/// Starts up to @a _jobs workers, the i-th of which runs the test cases with the indices
+	/// _indices[i], _indices[i + _jobs], ... using @a _runTest.
+	TestWorkers(size_t _jobs, std::vector<size_t> const& _indices, RunTest const& _runTest)
+	{
+		// Prevent buffered output from being printed again by the workers.
+		std::cout.flush();
+		std::cerr.flush();
+		size_t const workerCount = std::min(_jobs, _indices.size());
+		for (size_t worker = 0; worker < workerCount; ++worker)
+		{
+			int fds[2];
+			if (pipe(fds) != 0)
+			{
+				stop();
+				throw std::runtime_error("Could not create a pipe for a worker process.");
+			}
+			pid_t pid = fork();
+			if (pid < 0)
+			{
+				stop();
+				throw std::runtime_error("Could not start a worker process.");
+			}
+			if (pid == 0)
+			{
+				close(fds[0]);
+				for (Worker const& other: m_workers)
+					close(other.fd);
+				for (size_t i = worker; i < _indices.size(); i += workerCount)
+				{
+					auto [result, output] = _runTest(_indices[i]);
+					std::string const record =
+						std::to_string(_indices[i]) + " " +
+						std::to_string(static_cast<int>(result)) + " " +
+						std::to_string(output.size()) + "\n" +
+						output;
+					if (!writeAll(fds[1], record))
+						break;
+				}
+				close(fds[1]);
+				_exit(EXIT_SUCCESS);
+			}
+			close(fds[1]);
+			m_workers.push_back({pid, fds[0], {}});
+			for (size_t i = worker; i < _indices.size(); i += workerCount)
+				m_workerOfTest[_indices[i]] = worker;
+		}
+	}
+
+	~TestWorkers() { stop(); }
+
+	/// Waits for the result of the test case with index @a _index, which has to be one of the
+	/// indices given to the constructor, and returns it along with the output of the test case.
+	std::pair<TestTool::Result, std::string> result(size_t _index)
+	{
+		Worker const& worker = m_workers.at(m_workerOfTest.at(_index));
+		while (!m_results.count(_index) && worker.fd >= 0)
+			receive();
+
+		auto it = m_results.find(_index);
+		if (it == m_results.end())
+			return {TestTool::Result::Exception, "Worker process terminated unexpectedly.\n"};
+		auto result = std::move(it->second);
+		m_results.erase(it);
+		return result;
+	}
+
+private:
+	struct Worker
+	{
+		pid_t pid;
+		int fd;
+		std::string buffer;
+	};
+
+	static bool writeAll(int _fd, std::string const& _data)
+	{
+		for (size_t written = 0; written < _data.size();)
+		{
+			ssize_t count = write(_fd, _data.data() + written, _data.size() - written);
+			if (count < 0 && errno != EINTR)
+				return false;
+			if (count > 0)
+				written += static_cast<size_t>(count);
+		}
+		return true;
+	}
+
+	/// Reads from all pipes that have data and stores the complete records.
+	void receive()
+	{
+		std::vector<pollfd> fds;
+		std::vector<Worker*> workers;
+		for (Worker& worker: m_workers)
+			if (worker.fd >= 0)
+			{
+				fds.push_back({worker.fd, POLLIN, 0});
+				workers.push_back(&worker);
+			}
+		if (poll(fds.data(), static_cast<nfds_t>(fds.size()), -1) < 0)
+		{
+			if (errno == EINTR)
+				return;
+			throw std::runtime_error("Could not wait for the worker processes.");
+		}
+
+		for (size_t i = 0; i < fds.size(); ++i)
+		{
+			if (!(fds[i].revents & (POLLIN | POLLHUP | POLLERR)))
+				continue;
+			Worker& worker = *workers[i];
+			char data[4096];
+			ssize_t count = read(worker.fd, data, sizeof(data));
+			if (count > 0)
+			{
+				worker.buffer.append(data, static_cast<size_t>(count));
+				parseRecords(worker);
+			}
+			else if (count == 0 || errno != EINTR)
+			{
+				close(worker.fd);
+				worker.fd = -1;
+				waitpid(worker.pid, nullptr, 0);
+			}
+		}
+	}
+
+	void parseRecords(Worker& _worker)
+	{
+		while (true)
+		{
+			size_t headerEnd = _worker.buffer.find('\n');
+			if (headerEnd == std::string::npos)
+				return;
+			std::istringstream header(_worker.buffer.substr(0, headerEnd));
+			size_t index = 0;
+			int result = 0;
+			size_t size = 0;
+			header >> index >> result >> size;
+			if (_worker.buffer.size() < headerEnd + 1 + size)
+				return;
+			m_results[index] = {static_cast<TestTool::Result>(result), _worker.buffer.substr(headerEnd + 1, size)};
+			_worker.buffer.erase(0, headerEnd + 1 + size);
+		}
+	}
+
+	void stop()
+	{
+		for (Worker& worker: m_workers)
+			if (worker.fd >= 0)
+			{
+				kill(worker.pid, SIGTERM);
+				close(worker.fd);
+				worker.fd = -1;
+				waitpid(worker.pid, nullptr, 0);
+			}
+	}
+
+	std::vector<Worker> m_workers;
+	std::map<size_t, size_t> m_workerOfTest;
+	std::map<size_t, std::pair<TestTool::Result, std::string>> m_results;
+};
+#endif
+
 TestStats TestTool::processPath(
 	TestCreator _testCaseCreator,
 	TestOptions const& _options,
@@ -272,20 +455,18 @@ TestStats TestTool::processPath(
 	solidity::test::Batcher& _batcher
 )
 {
+	// Collect the test files first, so that they can be distributed among the workers.
+	std::vector<fs::path> testPaths;
 	std::queue<fs::path> paths;
 	paths.push(_path);
-	int successCount = 0;
-	int testCount = 0;
-	int skippedCount = 0;
-
 	while (!paths.empty())
 	{
 		auto currentPath = paths.front();
+		paths.pop();
 
 		fs::path fullpath = _basepath / currentPath;
 		if (fs::is_directory(fullpath))
 		{
-			paths.pop();
 			for (auto const& entry: boost::iterator_range<fs::directory_iterator>(
 				fs::directory_iterator(fullpath),
 				fs::directory_iterator()
@@ -293,56 +474,113 @@ TestStats TestTool::processPath(
 				if (fs::is_directory(entry.path()) || TestCase::isTestFilename(entry.path().filename()))
 					paths.push(currentPath / entry.path().filename());
 		}
-		else if (m_exitRequested)
+		else
+			testPaths.push_back(currentPath);
+	}
+
+	std::vector<bool> selected;
+	std::vector<size_t> selectedIndices;
+	for (size_t i = 0; i < testPaths.size(); ++i)
+	{
+		selected.push_back(!m_exitRequested && _batcher.checkAndAdvance(
+			(_basepath / testPaths[i]).lexically_relative(solidity::test::CommonOptions::get().testPath).generic_string()
+		));
+		if (selected.back())
+			selectedIndices.push_back(i);
+	}
+
+#if !defined(_WIN32)
+	// The workers run all test cases once and the ones that fail are run again here,
+	// in order, so that they can be updated interactively.
+	std::unique_ptr<TestWorkers> workers;
+	if (_options.jobs > 1 && !selectedIndices.empty())
+		workers = std::make_unique<TestWorkers>(_options.jobs, selectedIndices, [&](size_t _index) {
+			std::ostringstream output;
+			TestTool testTool(
+				_testCaseCreator,
+				_options,
+				_basepath / testPaths[_index],
+				testPaths[_index].generic_path().string()
+			);
+			Result result = testTool.process(output);
+			return std::make_pair(result, output.str());
+		});
+#endif
+
+	int successCount = 0;
+	int testCount = 0;
+	int skippedCount = 0;
+
+	bool rerun = false;
+	for (size_t i = 0; i < testPaths.size();)
+	{
+		fs::path const& currentPath = testPaths[i];
+		bool const isRerun = rerun;
+		rerun = false;
+		if (m_exitRequested)
 		{
 			++testCount;
-			paths.pop();
+			++i;
+			continue;
 		}
-		else if (!_batcher.checkAndAdvance())
+		else if (!selected[i])
 		{
-			paths.pop();
+			++i;
 			++skippedCount;
+			continue;
 		}
-		else
+
+		++testCount;
+		TestTool testTool(
+			_testCaseCreator,
+			_options,
+			_basepath / currentPath,
+			currentPath.generic_path().string()
+		);
+		std::optional<Result> result;
+#if !defined(_WIN32)
+		if (workers && !isRerun)
 		{
-			++testCount;
-			TestTool testTool(
-				_testCaseCreator,
-				_options,
-				fullpath,
-				currentPath.generic_path().string()
-			);
-			auto result = testTool.process();
+			auto [workerResult, output] = workers->result(i);
+			if (workerResult == Result::Success || workerResult == Result::Skipped)
+			{
+				std::cout << output;
+				result = workerResult;
+			}
+		}
+#endif
+		if (!result)
+			result = testTool.process(std::cout);
 
-			switch(result)
+		switch(*result)
+		{
+		case Result::Failure:
+		case Result::Exception:
+			switch(testTool.handleResponse(*result == Result::Exception))
 			{
-			case Result::Failure:
-			case Result::Exception:
-				switch(testTool.handleResponse(result == Result::Exception))
-				{
-				case Request::Quit:
-					paths.pop();
-					m_exitRequested = true;
-					break;
-				case Request::Rerun:
-					std::cout << "Re-running test case..." << std::endl;
-					--testCount;
-					break;
-				case Request::Skip:
-					paths.pop();
-					++skippedCount;
-					break;
-				}
+			case Request::Quit:
+				++i;
+				m_exitRequested = true;
 				break;
-			case Result::Success:
-				paths.pop();
-				++successCount;
+			case Request::Rerun:
+				std::cout << "Re-running test case..." << std::endl;
+				--testCount;
+				rerun = true;
 				break;
-			case Result::Skipped:
-				paths.pop();
+			case Request::Skip:
+				++i;
 				++skippedCount;
 				break;
 			}
+			break;
+		case Result::Success:
+			++i;
+			++successCount;
+			break;
+		case Result::Skipped:
+			++i;
+			++skippedCount;
+			break;
 		}
 	}
 
@@ -450,26 +688,35 @@ int main(int argc, char const *argv[])
 		TestStats global_stats{0, 0};
 		std::cout << "Running tests..." << std::endl << std::endl;
 
-		Batcher batcher(CommonOptions::get().selectedBatch, CommonOptions::get().batches);
-		if (CommonOptions::get().batches > 1)
+		Batcher batcher(CommonOptions::get().selectedBatch, CommonOptions::get().batches, CommonOptions::get().batchByName);
+		if (CommonOptions::get().batchByName)
+			std::cout << "Shard " << CommonOptions::get().selectedBatch + 1 << " out of " << CommonOptions::get().batches << std::endl;
+		else if (CommonOptions::get().batches > 1)
 			std::cout << "Batch " << CommonOptions::get().selectedBatch << " out of " << CommonOptions::get().batches << std::endl;
 
 		// Actually run the tests.
 		// Interactive tests are added in InteractiveTests.h
-		for (auto const& ts: g_interactiveTestsuites)
+		std::vector<Testsuite const*> testsuites;
+		if (options.gasBenchmarks)
+			testsuites.push_back(&g_gasBenchmarks);
+		else
+			for (auto const& ts: g_interactiveTestsuites)
+				testsuites.push_back(&ts);
+
+		for (Testsuite const* ts: testsuites)
 		{
-			if (ts.needsVM && options.disableSemanticTests)
+			if (ts->needsVM && options.disableSemanticTests)
 				continue;
 
-			if (ts.smt && options.disableSMT)
+			if (ts->smt && options.disableSMT)
 				continue;
 
 			auto stats = runTestSuite(
-				ts.testCaseCreator,
+				ts->testCaseCreator,
 				options,
-				options.testPath / ts.path,
-				ts.subpath,
-				ts.title,
+				options.testPath / ts->path,
+				ts->subpath,
+				ts->title,
 				batcher
 			);
 			if (stats)
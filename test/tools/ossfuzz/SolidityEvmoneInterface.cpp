@@ -31,14 +31,14 @@ using namespace solidity::util;
 
 std::optional<CompilerOutput> SolidityCompilationFramework::compileContract()
 {
-	m_compiler.setSources(m_compilerInput.sourceCode);
-	m_compiler.setLibraries(m_compilerInput.libraryAddresses);
-	m_compiler.setEVMVersion(m_compilerInput.evmVersion);
-	m_compiler.setOptimiserSettings(m_compilerInput.optimiserSettings);
-	m_compiler.setViaIR(m_compilerInput.viaIR);
-	if (!m_compiler.compile())
+	if (m_compiler.state() == CompilerStack::Empty)
 	{
-		if (m_compilerInput.debugFailure)
+		m_compiler.setSources(m_compilerInput.sourceCode);
+		m_compiler.setLibraries(m_compilerInput.libraryAddresses);
+		m_compiler.setEVMVersion(m_compilerInput.evmVersion);
+		m_compiler.setOptimiserSettings(m_compilerInput.optimiserSettings);
+		m_compiler.setViaIR(m_compilerInput.viaIR);
+		if (!m_compiler.compile() && m_compilerInput.debugFailure)
 		{
 			std::cerr << "Compiling contract failed" << std::endl;
 			std::cerr << SourceReferenceFormatter::formatErrorInformation(
@@ -46,19 +46,19 @@ std::optional<CompilerOutput> SolidityCompilationFramework::compileContract()
 				m_compiler
 			);
 		}
-		return {};
 	}
+	if (!m_compiler.compilationSuccessful())
+		return {};
+
+	std::string contractName;
+	if (m_compilerInput.contractName.empty())
+		contractName = m_compiler.lastContractName();
 	else
-	{
-		std::string contractName;
-		if (m_compilerInput.contractName.empty())
-			contractName = m_compiler.lastContractName();
-		else
-			contractName = m_compilerInput.contractName;
-		evmasm::LinkerObject obj = m_compiler.object(contractName);
-		Json methodIdentifiers = m_compiler.interfaceSymbols(contractName)["methods"];
-		return CompilerOutput{obj.bytecode, methodIdentifiers};
-	}
+		contractName = m_compilerInput.contractName;
+	evmasm::LinkerObject obj = m_compiler.object(contractName);
+	obj.link(m_compilerInput.libraryAddresses);
+	Json methodIdentifiers = m_compiler.interfaceSymbols(contractName)["methods"];
+	return CompilerOutput{obj.bytecode, methodIdentifiers};
 }
 
 bool EvmoneUtility::zeroWord(uint8_t const* _result, size_t _length)
@@ -128,13 +128,46 @@ evmc::Result EvmoneUtility::deployAndExecute(
 }
 
 evmc::Result EvmoneUtility::compileDeployAndExecute(std::string _fuzzIsabelle)
+{
+	std::vector<evmc::Result> results = compileDeployAndExecute(
+		std::vector<OptimiserSettings>{m_compilerInput.optimiserSettings},
+		_fuzzIsabelle
+	);
+	return std::move(results.front());
+}
+
+std::vector<evmc::Result> EvmoneUtility::compileDeployAndExecute(
+	std::vector<OptimiserSettings> const& _optimiserSettings,
+	std::string const& _fuzzIsabelle
+)
+{
+	EVMHost::Snapshot const initialState = m_evmHost.snapshot();
+	std::vector<evmc::Result> results;
+	// The compiler relies on global state and thus the settings are compiled one after another.
+	for (OptimiserSettings const& settings: _optimiserSettings)
+	{
+		if (!results.empty())
+			m_evmHost.restore(initialState);
+		CompilerInput input = m_compilerInput;
+		input.optimiserSettings = settings;
+		SolidityCompilationFramework compilationFramework(input);
+		results.emplace_back(compileDeployAndExecute(compilationFramework, _fuzzIsabelle));
+	}
+	return results;
+}
+
+evmc::Result EvmoneUtility::compileDeployAndExecute(
+	SolidityCompilationFramework& _compilationFramework,
+	std::string const& _fuzzIsabelle
+)
 {
 	std::map<std::string, h160> libraryAddressMap;
-	// Stage 1: Compile and deploy library if present.
+	// Stage 1: Compile and deploy library if present. The sources are compiled once,
+	// the address of the library is linked into the contract afterwards.
 	if (!m_libraryName.empty())
 	{
-		m_compilationFramework.contractName(m_libraryName);
-		auto compilationOutput = m_compilationFramework.compileContract();
+		_compilationFramework.contractName(m_libraryName);
+		auto compilationOutput = _compilationFramework.compileContract();
 		solAssert(compilationOutput.has_value(), "Compiling library failed");
 		CompilerOutput cOutput = compilationOutput.value();
 		// Deploy contract and signal failure if deploy failed
@@ -143,14 +176,15 @@ evmc::Result EvmoneUtility::compileDeployAndExecute(std::string _fuzzIsabelle)
 			createResult.status_code == EVMC_SUCCESS,
 			"SolidityEvmoneInterface: Library deployment failed"
 		);
-		libraryAddressMap[m_libraryName] = EVMHost::convertFromEVMC(createResult.create_address);
-		m_compilationFramework.libraryAddresses(libraryAddressMap);
+		libraryAddressMap[_compilationFramework.fullyQualifiedName(m_libraryName)] =
+			EVMHost::convertFromEVMC(createResult.create_address);
+		_compilationFramework.libraryAddresses(libraryAddressMap);
 	}
 
 	// Stage 2: Compile, deploy, and execute contract, optionally using library
 	// address map.
-	m_compilationFramework.contractName(m_contractName);
-	auto cOutput = m_compilationFramework.compileContract();
+	_compilationFramework.contractName(m_contractName);
+	auto cOutput = _compilationFramework.compileContract();
 	solAssert(cOutput.has_value(), "Compiling contract failed");
 	solAssert(
 		!cOutput->byteCode.empty() && !cOutput->methodIdentifiersInContract.empty(),
@@ -174,11 +208,11 @@ evmc::Result EvmoneUtility::compileDeployAndExecute(std::string _fuzzIsabelle)
 	);
 }
 
-std::optional<CompilerOutput> EvmoneUtility::compileContract()
+std::optional<CompilerOutput> EvmoneUtility::compileContract(SolidityCompilationFramework& _compilationFramework)
 {
 	try
 	{
-		return m_compilationFramework.compileContract();
+		return _compilationFramework.compileContract();
 	}
 	catch (evmasm::StackTooDeepException const&)
 	{
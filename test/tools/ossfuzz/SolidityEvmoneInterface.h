@@ -83,7 +83,8 @@ public:
 	{
 		m_compilerInput.contractName = _contractName;
 	}
-	/// Sets library addresses to @param _libraryAddresses.
+	/// Sets library addresses to @param _libraryAddresses, keyed by fully qualified library name.
+	/// They are linked into the bytecode, so that they can be set after compilation.
 	void libraryAddresses(std::map<std::string, solidity::util::h160> _libraryAddresses)
 	{
 		m_compilerInput.libraryAddresses = std::move(_libraryAddresses);
@@ -93,9 +94,16 @@ public:
 	{
 		return m_compiler.interfaceSymbols(_contractName)["methods"];
 	}
+	/// @returns the fully qualified name of the contract called @param _contractName.
+	/// Requires a successful compilation.
+	std::string fullyQualifiedName(std::string const& _contractName) const
+	{
+		return m_compiler.contractDefinition(_contractName).fullyQualifiedName();
+	}
 	/// @returns Compilation output comprising EVM bytecode and list of
 	/// method identifiers in contract if compilation is successful,
-	/// null value otherwise.
+	/// null value otherwise. The sources are only compiled by the first
+	/// call, later calls return the output of another contract.
 	std::optional<CompilerOutput> compileContract();
 private:
 	frontend::CompilerStack m_compiler;
@@ -113,7 +121,7 @@ public:
 		std::string const& _methodName
 	):
 		m_evmHost(_evmHost),
-		m_compilationFramework(_compilerInput),
+		m_compilerInput(std::move(_compilerInput)),
 		m_contractName(_contractName),
 		m_libraryName(_libraryName),
 		m_methodName(_methodName)
@@ -123,6 +131,16 @@ public:
 	/// @param _isabelleData contains encoding data to be passed to the
 	/// isabelle test entry point.
 	evmc::Result compileDeployAndExecute(std::string _isabelleData = {});
+	/// @returns the results returned by the EVM host on compiling, deploying,
+	/// and executing test configuration once for each of @param _optimiserSettings,
+	/// in the same order. All runs start from the state of the host at the time
+	/// of the call, which is restored from a snapshot in between.
+	/// @param _isabelleData contains encoding data to be passed to the
+	/// isabelle test entry point.
+	std::vector<evmc::Result> compileDeployAndExecute(
+		std::vector<frontend::OptimiserSettings> const& _optimiserSettings,
+		std::string const& _isabelleData = {}
+	);
 	/// Compares the contents of the memory address pointed to
 	/// by `_result` of `_length` bytes to u256 zero.
 	/// @returns true if `_result` is zero, false
@@ -152,17 +170,23 @@ private:
 		bytes const& _byteCode,
 		std::string const& _hexEncodedInput
 	);
+	/// Compiles, deploys and executes the test configuration using
+	/// @param _compilationFramework.
+	evmc::Result compileDeployAndExecute(
+		SolidityCompilationFramework& _compilationFramework,
+		std::string const& _isabelleData
+	);
 	/// Compiles contract named @param _contractName present in
 	/// @param _sourceCode, optionally using a precompiled library
 	/// specified via a library mapping and an optimisation setting.
 	/// @returns a pair containing the generated byte code and method
 	/// identifiers for methods in @param _contractName.
-	std::optional<CompilerOutput> compileContract();
+	std::optional<CompilerOutput> compileContract(SolidityCompilationFramework& _compilationFramework);
 
 	/// EVM Host implementation
 	solidity::test::EVMHost& m_evmHost;
-	/// Solidity compilation framework
-	SolidityCompilationFramework m_compilationFramework;
+	/// Compiler input, the optimiser settings are replaced for batched runs.
+	CompilerInput m_compilerInput;
 	/// Contract name
 	std::string m_contractName;
 	/// Library name
@@ -24,9 +24,17 @@
 
 using namespace solidity::frontend::test;
 
-// Prototype as we can't use the FuzzerInterface.h header.
+// Prototypes as we can't use the FuzzerInterface.h header.
+extern "C" int LLVMFuzzerInitialize(int* _argc, char*** _argv);
 extern "C" int LLVMFuzzerTestOneInput(uint8_t const* _data, size_t _size);
 
+extern "C" int LLVMFuzzerInitialize(int*, char***)
+{
+	// Keeps the construction of the state shared by all inputs out of the first runs.
+	FuzzerUtil::initialize();
+	return 0;
+}
+
 extern "C" int LLVMFuzzerTestOneInput(uint8_t const* _data, size_t _size)
 {
 	if (_size <= 600)
@@ -52,8 +60,8 @@ extern "C" int LLVMFuzzerTestOneInput(uint8_t const* _data, size_t _size)
 		}
 		catch (std::runtime_error const&)
 		{
-			return 0;
 		}
+		FuzzerUtil::finishRun();
 	}
 	return 0;
 }
@@ -0,0 +1,126 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Proto fuzzer that flags programs whose optimisation takes disproportionately long
+ * compared to their size, in order to catch optimiser steps with superlinear run time.
+ */
+
+#include <test/tools/ossfuzz/yulProto.pb.h>
+#include <test/tools/ossfuzz/protoToYul.h>
+
+#include <libyul/YulStack.h>
+#include <libyul/Exceptions.h>
+
+#include <liblangutil/DebugInfoSelection.h>
+#include <liblangutil/EVMVersion.h>
+
+#include <src/libfuzzer/libfuzzer_macro.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+using namespace solidity;
+using namespace solidity::langutil;
+using namespace solidity::yul;
+using namespace solidity::yul::test::yul_fuzzer;
+
+namespace
+{
+
+/// Time in microseconds per byte of source that the optimiser may take, can be overridden
+/// using the environment variable YUL_PERF_FUZZER_US_PER_BYTE.
+unsigned const defaultMicrosecondsPerByte = 2000;
+/// Programs optimised faster than this (in milliseconds, environment variable
+/// YUL_PERF_FUZZER_MIN_MS) are never reported, so that timing noise on small inputs is ignored.
+unsigned const defaultMinimumMilliseconds = 200;
+/// Larger programs are skipped, since their optimisation takes too long to fuzz efficiently.
+size_t const maxSourceSize = 5000;
+
+unsigned environmentValue(char const* _name, unsigned _default)
+{
+	if (char const* value = getenv(_name))
+		return static_cast<unsigned>(std::strtoul(value, nullptr, 10));
+	return _default;
+}
+
+}
+
+DEFINE_PROTO_FUZZER(Program const& _input)
+{
+	ProtoConverter converter;
+	std::string yul_source = converter.programToString(_input);
+	EVMVersion version = converter.version();
+
+	if (char const* dump_path = getenv("PROTO_FUZZER_DUMP_PATH"))
+	{
+		// With libFuzzer binary run this to generate a YUL source file x.yul:
+		// PROTO_FUZZER_DUMP_PATH=x.yul ./a.out proto-input
+		std::ofstream of(dump_path);
+		of.write(yul_source.data(), static_cast<std::streamsize>(yul_source.size()));
+	}
+
+	if (yul_source.size() > maxSourceSize)
+		return;
+
+	static unsigned const microsecondsPerByte =
+		environmentValue("YUL_PERF_FUZZER_US_PER_BYTE", defaultMicrosecondsPerByte);
+	static unsigned const minimumMilliseconds =
+		environmentValue("YUL_PERF_FUZZER_MIN_MS", defaultMinimumMilliseconds);
+
+	YulStringRepository::reset();
+
+	YulStack stack(
+		version,
+		std::nullopt,
+		YulStack::Language::StrictAssembly,
+		solidity::frontend::OptimiserSettings::full(),
+		DebugInfoSelection::All()
+	);
+
+	if (
+		!stack.parseAndAnalyze("source", yul_source) ||
+		!stack.parserResult()->code ||
+		!stack.parserResult()->analysisInfo ||
+		Error::containsErrors(stack.errors())
+	)
+		yulAssert(false, "Proto fuzzer generated malformed program");
+
+	auto start = std::chrono::steady_clock::now();
+	stack.optimize();
+	auto duration = std::chrono::duration_cast<std::chrono::microseconds>(
+		std::chrono::steady_clock::now() - start
+	);
+
+	auto limit = std::max(
+		std::chrono::microseconds(microsecondsPerByte * yul_source.size()),
+		std::chrono::microseconds(std::chrono::milliseconds(minimumMilliseconds))
+	);
+	if (duration > limit)
+	{
+		std::cerr <<
+			"Optimising " << yul_source.size() << " bytes of Yul took " <<
+			duration.count() << "us, more than the limit of " << limit.count() << "us:" <<
+			std::endl << yul_source << std::endl;
+		// Abort, so that the input is recorded by the fuzzing engine.
+		std::abort();
+	}
+}
@@ -0,0 +1,464 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Compile-time benchmark of the stages of the compilation pipeline.
+ */
+
+#include <test/tools/Microbenchmarks.h>
+
+#include <libsolidity/interface/CompilerStack.h>
+#include <libsolidity/interface/OptimiserSettings.h>
+#include <libsolidity/interface/Version.h>
+
+#include <libyul/YulString.h>
+
+#include <libsolutil/CommonIO.h>
+#include <libsolutil/Exceptions.h>
+#include <libsolutil/JSON.h>
+#include <libsolutil/MemoryUsage.h>
+#include <libsolutil/PhaseTracer.h>
+
+#include <boost/filesystem.hpp>
+#include <boost/program_options.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <new>
+#include <string>
+#include <vector>
+
+using namespace solidity;
+using namespace solidity::util;
+using namespace solidity::frontend;
+
+namespace po = boost::program_options;
+
+namespace
+{
+
+#if defined(SOLC_TRACK_ALLOCATIONS)
+
+// The global operator new is already replaced by libsolutil, which counts the allocations of each thread.
+// The pipeline is run on a single thread, so the counters belong to the stage being measured.
+AllocationCounters allocationsSoFar()
+{
+	return allocationCounters();
+}
+
+}
+
+#else
+
+// Counters of the allocations done through the global operator new, replaced below.
+// The pipeline is run on a single thread, so the counters belong to the stage being measured.
+std::atomic<size_t> g_allocationCount = 0;
+std::atomic<size_t> g_allocatedBytes = 0;
+
+AllocationCounters allocationsSoFar()
+{
+	return {g_allocationCount, g_allocatedBytes};
+}
+
+}
+
+void* operator new(size_t _size)
+{
+	++g_allocationCount;
+	g_allocatedBytes += _size;
+	if (void* pointer = std::malloc(_size == 0 ? 1 : _size))
+		return pointer;
+	throw std::bad_alloc();
+}
+
+void operator delete(void* _pointer) noexcept
+{
+	std::free(_pointer);
+}
+
+void operator delete(void* _pointer, size_t) noexcept
+{
+	std::free(_pointer);
+}
+
+#endif
+
+namespace
+{
+
+struct Configuration
+{
+	std::string pipeline;
+	std::string optimizer;
+	bool viaIR = false;
+	OptimiserSettings optimiserSettings;
+};
+
+/// Time and allocations of one stage in all repetitions.
+struct StageSamples
+{
+	std::vector<int64_t> microseconds;
+	std::vector<size_t> allocations;
+	std::vector<size_t> allocatedBytes;
+};
+
+template<typename T>
+T median(std::vector<T> _samples)
+{
+	if (_samples.empty())
+		return T{};
+	auto middle = _samples.begin() + static_cast<std::ptrdiff_t>(_samples.size() / 2);
+	std::nth_element(_samples.begin(), middle, _samples.end());
+	return *middle;
+}
+
+Json samplesToJson(StageSamples const& _samples)
+{
+	Json result;
+	result["medianMicroseconds"] = median(_samples.microseconds);
+	result["minMicroseconds"] = *std::min_element(_samples.microseconds.begin(), _samples.microseconds.end());
+	result["maxMicroseconds"] = *std::max_element(_samples.microseconds.begin(), _samples.microseconds.end());
+	if (!_samples.allocations.empty())
+	{
+		result["medianAllocations"] = median(_samples.allocations);
+		result["medianAllocatedBytes"] = median(_samples.allocatedBytes);
+	}
+	return result;
+}
+
+class Benchmark
+{
+public:
+	Benchmark(std::string _sourceName, std::string _source, Configuration _configuration):
+		m_sourceName(std::move(_sourceName)),
+		m_source(std::move(_source)),
+		m_configuration(std::move(_configuration))
+	{}
+
+	/// Runs the whole pipeline once. The results are only recorded if @a _record is true.
+	/// @returns false if the compilation failed.
+	bool run(bool _record)
+	{
+		yul::YulStringRepository::reset();
+		auto tracer = std::make_shared<PhaseTracer>();
+		CompilerStack compilerStack;
+		compilerStack.setSources({{m_sourceName, m_source}});
+		compilerStack.setViaIR(m_configuration.viaIR);
+		compilerStack.setOptimiserSettings(m_configuration.optimiserSettings);
+		compilerStack.setTracer(tracer);
+
+		try
+		{
+			bool success =
+				measure("parse", _record, [&]() { return compilerStack.parse(); }) &&
+				measure("analyze", _record, [&]() { return compilerStack.analyze(); }) &&
+				measure("compile", _record, [&]() { return compilerStack.compile(); });
+			if (!success)
+			{
+				m_error = "Compilation failed.";
+				for (auto const& error: compilerStack.errors())
+					if (langutil::Error::isError(error->type()))
+					{
+						m_error = error->what();
+						break;
+					}
+			}
+			if (!success || !_record)
+				return success;
+		}
+		catch (util::Exception const& _exception)
+		{
+			// The legacy pipeline can fail with "Stack too deep".
+			m_error = _exception.what();
+			return false;
+		}
+
+		std::map<std::string, int64_t> phaseDurations;
+		for (PhaseTracer::Event const& event: tracer->events())
+			phaseDurations[event.name] += event.duration;
+		for (auto const& [name, duration]: phaseDurations)
+			m_phases[name].microseconds.push_back(duration);
+
+		m_bytecodeSize = 0;
+		for (std::string const& contractName: compilerStack.contractNames())
+			m_bytecodeSize += compilerStack.object(contractName).bytecode.size();
+		return true;
+	}
+
+	Json toJson(bool _success) const
+	{
+		Json result;
+		result["file"] = m_sourceName;
+		result["pipeline"] = m_configuration.pipeline;
+		result["optimizer"] = m_configuration.optimizer;
+		result["success"] = _success;
+		if (!_success)
+		{
+			result["error"] = m_error;
+			return result;
+		}
+		result["bytecodeSize"] = m_bytecodeSize;
+		result["stages"] = Json::object();
+		for (auto const& [name, samples]: m_stages)
+			result["stages"][name] = samplesToJson(samples);
+		// Phases that ran more than once per compilation are summed up per repetition.
+		result["phases"] = Json::object();
+		for (auto const& [name, samples]: m_phases)
+			result["phases"][name] = samplesToJson(samples);
+		return result;
+	}
+
+private:
+	template<typename Stage>
+	bool measure(std::string const& _name, bool _record, Stage const& _stage)
+	{
+		AllocationCounters const allocationsBefore = allocationsSoFar();
+		auto const start = std::chrono::steady_clock::now();
+		bool const success = _stage();
+		auto const end = std::chrono::steady_clock::now();
+		if (_record)
+		{
+			StageSamples& samples = m_stages[_name];
+			samples.microseconds.push_back(std::chrono::duration_cast<std::chrono::microseconds>(end - start).count());
+			AllocationCounters const allocationsAfter = allocationsSoFar();
+			samples.allocations.push_back(allocationsAfter.allocations - allocationsBefore.allocations);
+			samples.allocatedBytes.push_back(allocationsAfter.bytes - allocationsBefore.bytes);
+		}
+		return success;
+	}
+
+	std::string m_sourceName;
+	std::string m_source;
+	Configuration m_configuration;
+	std::map<std::string, StageSamples> m_stages;
+	std::map<std::string, StageSamples> m_phases;
+	size_t m_bytecodeSize = 0;
+	std::string m_error;
+};
+
+/// Writes the report to the file given in the "output" option or to stdout.
+/// @returns false if the file could not be written.
+bool writeReport(Json const& _report, po::variables_map const& _arguments)
+{
+	std::string const output = jsonPrettyPrint(_report);
+	if (_arguments.count("output"))
+	{
+		std::ofstream outputFile(_arguments["output"].as<std::string>());
+		outputFile << output << std::endl;
+		if (!outputFile)
+		{
+			std::cerr << "Could not write to " << _arguments["output"].as<std::string>() << std::endl;
+			return false;
+		}
+	}
+	else
+		std::cout << output << std::endl;
+	return true;
+}
+
+}
+
+int main(int argc, char** argv)
+{
+	try
+	{
+		size_t repetitions = 5;
+		size_t warmup = 1;
+		size_t minTime = 500;
+		std::string filter;
+		std::vector<std::string> pipelines;
+		std::vector<std::string> optimizerPresets;
+		po::options_description options(
+			R"(solbench, compile-time benchmark of the compiler pipeline.
+	Usage: solbench [Options] <file>...
+	Compiles every <file> with the legacy and the via-IR pipeline and with
+	the minimal and the standard optimizer settings, in-process and on a
+	single thread. Reports the median time and allocations of the parsing,
+	analysis and code generation stages and the median time of the phases
+	within them over all repetitions as JSON.
+	With --micro, runs micro-benchmarks of the core data structures of the
+	compiler instead and reports the time per iteration.
+
+	Allowed options)",
+			po::options_description::m_default_line_length,
+			po::options_description::m_default_line_length - 23);
+		options.add_options()
+			(
+				"input-file",
+				po::value<std::vector<std::string>>(),
+				"input file"
+			)
+			(
+				"repeat",
+				po::value<size_t>(&repetitions)->default_value(repetitions),
+				"number of measured compilations per file and configuration"
+			)
+			(
+				"warmup",
+				po::value<size_t>(&warmup)->default_value(warmup),
+				"number of unmeasured compilations before the measured ones"
+			)
+			(
+				"pipeline",
+				po::value<std::vector<std::string>>(&pipelines)->multitoken(),
+				"pipelines to run: legacy, via-ir (default: both)"
+			)
+			(
+				"optimizer",
+				po::value<std::vector<std::string>>(&optimizerPresets)->multitoken(),
+				"optimizer settings to use: minimal, standard (default: both)"
+			)
+			(
+				"micro",
+				"run the micro-benchmarks instead of compiling input files"
+			)
+			(
+				"filter",
+				po::value<std::string>(&filter),
+				"only run the micro-benchmarks whose names contain this string"
+			)
+			(
+				"min-time",
+				po::value<size_t>(&minTime)->default_value(minTime),
+				"minimum time in milliseconds of the measured batch of iterations of a micro-benchmark"
+			)
+			(
+				"list",
+				"list the available micro-benchmarks"
+			)
+			(
+				"output,o",
+				po::value<std::string>(),
+				"write the JSON report to this file instead of stdout"
+			)
+			("help,h", "Show this help screen.");
+
+		po::positional_options_description filesPositions;
+		filesPositions.add("input-file", -1);
+
+		po::variables_map arguments;
+		po::command_line_parser cmdLineParser(argc, argv);
+		cmdLineParser.options(options).positional(filesPositions);
+		po::store(cmdLineParser.run(), arguments);
+		po::notify(arguments);
+
+		if (arguments.count("help"))
+		{
+			std::cout << options;
+			return 0;
+		}
+		if (arguments.count("list"))
+		{
+			for (std::string const& name: test::microbenchmarkNames())
+				std::cout << name << std::endl;
+			return 0;
+		}
+
+		Json report;
+		report["compilerVersion"] = VersionString;
+		if (arguments.count("micro"))
+		{
+			report["microbenchmarks"] = Json::array();
+			for (test::MicrobenchmarkResult const& result: test::runMicrobenchmarks(filter, std::chrono::milliseconds(minTime)))
+			{
+				std::cerr << result.name << std::endl;
+				Json entry;
+				entry["name"] = result.name;
+				entry["iterations"] = result.iterations;
+				entry["nanosecondsPerIteration"] = result.nanosecondsPerIteration;
+				report["microbenchmarks"].emplace_back(std::move(entry));
+			}
+			return writeReport(report, arguments) ? 0 : 1;
+		}
+
+		if (!arguments.count("input-file") || repetitions == 0)
+		{
+			std::cout << options;
+			return 1;
+		}
+		if (pipelines.empty())
+			pipelines = {"legacy", "via-ir"};
+		if (optimizerPresets.empty())
+			optimizerPresets = {"minimal", "standard"};
+
+		std::vector<Configuration> configurations;
+		for (std::string const& pipeline: pipelines)
+			for (std::string const& optimizer: optimizerPresets)
+			{
+				if (pipeline != "legacy" && pipeline != "via-ir")
+				{
+					std::cerr << "Invalid pipeline: " << pipeline << std::endl;
+					return 1;
+				}
+				if (optimizer != "minimal" && optimizer != "standard")
+				{
+					std::cerr << "Invalid optimizer settings: " << optimizer << std::endl;
+					return 1;
+				}
+				configurations.push_back({
+					pipeline,
+					optimizer,
+					pipeline == "via-ir",
+					optimizer == "minimal" ? OptimiserSettings::minimal() : OptimiserSettings::standard()
+				});
+			}
+
+		report["repetitions"] = repetitions;
+		report["benchmarks"] = Json::array();
+		for (std::string const& inputFile: arguments["input-file"].as<std::vector<std::string>>())
+		{
+			std::string const source = readFileAsString(inputFile);
+			std::string const sourceName = boost::filesystem::path(inputFile).filename().string();
+			for (Configuration const& configuration: configurations)
+			{
+				std::cerr << sourceName << " (" << configuration.pipeline << ", " << configuration.optimizer << ")" << std::endl;
+				Benchmark benchmark(sourceName, source, configuration);
+				bool success = true;
+				for (size_t i = 0; i < warmup && success; ++i)
+					success = benchmark.run(false);
+				for (size_t i = 0; i < repetitions && success; ++i)
+					success = benchmark.run(true);
+				report["benchmarks"].emplace_back(benchmark.toJson(success));
+			}
+		}
+
+		if (!writeReport(report, arguments))
+			return 1;
+	}
+	catch (po::error const& _exception)
+	{
+		std::cerr << _exception.what() << std::endl;
+		return 1;
+	}
+	catch (FileNotFound const& _exception)
+	{
+		std::cerr << "File not found: " << (_exception.comment() ? *_exception.comment() : "") << std::endl;
+		return 1;
+	}
+	catch (NotAFile const& _exception)
+	{
+		std::cerr << "Not a file: " << (_exception.comment() ? *_exception.comment() : "") << std::endl;
+		return 1;
+	}
+
+	return 0;
+}
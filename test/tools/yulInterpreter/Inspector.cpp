@@ -52,8 +52,16 @@ void InspectedInterpreter::run(
 	bool _disableMemoryTrace
 )
 {
-	Scope scope;
-	InspectedInterpreter{_inspector, _state, _dialect, scope, _disableExternalCalls, _disableMemoryTrace}(_ast);
+	ResolvedNames names{_dialect, _ast};
+	InspectedInterpreter{
+		_inspector,
+		_state,
+		_dialect,
+		names,
+		_disableExternalCalls,
+		_disableMemoryTrace,
+		std::vector<u256>(names.frameSize())
+	}(_ast);
 }
 
 Inspector::NodeAction Inspector::queryUser(langutil::DebugData const& _data, std::map<YulString, u256> const& _variables)
@@ -141,14 +149,29 @@ std::string Inspector::currentSource(langutil::DebugData const& _data) const
 
 u256 InspectedInterpreter::evaluate(Expression const& _expression)
 {
-	InspectedExpressionEvaluator ev(m_inspector, m_state, m_dialect, *m_scope, m_variables, m_disableExternalCalls, m_disableMemoryTrace);
+	InspectedExpressionEvaluator ev(m_inspector, m_state, m_dialect, m_names, m_frame, liveVariables(), m_disableExternalCalls, m_disableMemoryTrace);
 	ev.visit(_expression);
 	return ev.value();
 }
 
 std::vector<u256> InspectedInterpreter::evaluateMulti(Expression const& _expression)
 {
-	InspectedExpressionEvaluator ev(m_inspector, m_state, m_dialect, *m_scope, m_variables, m_disableExternalCalls, m_disableMemoryTrace);
+	InspectedExpressionEvaluator ev(m_inspector, m_state, m_dialect, m_names, m_frame, liveVariables(), m_disableExternalCalls, m_disableMemoryTrace);
 	ev.visit(_expression);
 	return ev.values();
 }
+
+void InspectedInterpreter::operator()(VariableDeclaration const& _node)
+{
+	helper(_node);
+	for (TypedName const& variable: _node.variables)
+		m_liveVariables.emplace_back(variable.name, m_names.slot(variable));
+}
+
+std::map<YulString, u256> InspectedInterpreter::liveVariables() const
+{
+	std::map<YulString, u256> variables;
+	for (auto const& [name, slot]: m_liveVariables)
+		variables[name] = m_frame.at(slot);
+	return variables;
+}
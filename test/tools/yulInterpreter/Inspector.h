@@ -113,42 +113,57 @@ public:
 		std::shared_ptr<Inspector> _inspector,
 		InterpreterState& _state,
 		Dialect const& _dialect,
-		Scope& _scope,
+		ResolvedNames const& _names,
 		bool _disableExternalCalls,
 		bool _disableMemoryTracing,
-		std::map<YulString, u256> _variables = {}
+		std::vector<u256> _frame,
+		std::vector<std::pair<YulString, size_t>> _liveVariables = {}
 	):
-		Interpreter(_state, _dialect, _scope, _disableExternalCalls, _disableMemoryTracing, _variables),
-		m_inspector(_inspector)
+		Interpreter(_state, _dialect, _names, _disableExternalCalls, _disableMemoryTracing, std::move(_frame)),
+		m_inspector(_inspector),
+		m_liveVariables(std::move(_liveVariables))
 	{
 	}
 
 	void operator()(ExpressionStatement const& _node) override { helper(_node); }
 	void operator()(Assignment const& _node) override { helper(_node); }
-	void operator()(VariableDeclaration const& _node) override { helper(_node); }
+	void operator()(VariableDeclaration const& _node) override;
 	void operator()(If const& _node) override { helper(_node); }
 	void operator()(Switch const& _node) override { helper(_node); }
-	void operator()(ForLoop const& _node) override { helper(_node); }
+	void operator()(ForLoop const& _node) override { scopedHelper(_node); }
 	void operator()(Break const& _node) override { helper(_node); }
 	void operator()(Continue const& _node) override { helper(_node); }
 	void operator()(Leave const& _node) override { helper(_node); }
-	void operator()(Block const& _node) override { helper(_node); }
+	void operator()(Block const& _node) override { scopedHelper(_node); }
 protected:
 	/// Asserts that the expression evaluates to exactly one value and returns it.
 	u256 evaluate(Expression const& _expression) override;
 	/// Evaluates the expression and returns its value.
 	std::vector<u256> evaluateMulti(Expression const& _expression) override;
 private:
+	/// @returns the names and values of the variables that are currently in scope.
+	std::map<YulString, u256> liveVariables() const;
+
 	std::shared_ptr<Inspector> m_inspector;
+	/// Names and slots of the variables that are currently in scope.
+	std::vector<std::pair<YulString, size_t>> m_liveVariables;
 
 	template <typename ConcreteNode>
 	void helper(ConcreteNode const& _node)
 	{
-		m_inspector->interactiveVisit(*_node.debugData, m_variables, [&]() {
+		m_inspector->interactiveVisit(*_node.debugData, liveVariables(), [&]() {
 			Interpreter::operator()(_node);
 		});
 	}
 
+	/// Like helper(), but also removes the variables declared inside of the node.
+	template <typename ConcreteNode>
+	void scopedHelper(ConcreteNode const& _node)
+	{
+		size_t numVariables = m_liveVariables.size();
+		helper(_node);
+		m_liveVariables.resize(numVariables);
+	}
 };
 
 
@@ -159,19 +174,21 @@ public:
 		std::shared_ptr<Inspector> _inspector,
 		InterpreterState& _state,
 		Dialect const& _dialect,
-		Scope& _scope,
-		std::map<YulString, u256> const& _variables,
+		ResolvedNames const& _names,
+		std::vector<u256> const& _frame,
+		std::map<YulString, u256> _liveVariables,
 		bool _disableExternalCalls,
 		bool _disableMemoryTrace
 	):
-		ExpressionEvaluator(_state, _dialect, _scope, _variables, _disableExternalCalls, _disableMemoryTrace),
-		m_inspector(_inspector)
+		ExpressionEvaluator(_state, _dialect, _names, _frame, _disableExternalCalls, _disableMemoryTrace),
+		m_inspector(_inspector),
+		m_liveVariables(std::move(_liveVariables))
 	{}
 
 	template <typename ConcreteNode>
 	void helper(ConcreteNode const& _node)
 	{
-		m_inspector->interactiveVisit(*_node.debugData, m_variables, [&]() {
+		m_inspector->interactiveVisit(*_node.debugData, m_liveVariables, [&]() {
 			ExpressionEvaluator::operator()(_node);
 		});
 	}
@@ -180,19 +197,25 @@ public:
 	void operator()(Identifier const& _node) override { helper(_node); }
 	void operator()(FunctionCall const& _node) override { helper(_node); }
 protected:
-	std::unique_ptr<Interpreter> makeInterpreterCopy(std::map<YulString, u256> _variables = {}) const override
+	std::unique_ptr<Interpreter> makeInterpreterCopy(FunctionDefinition const& _function, std::vector<u256> _frame) const override
 	{
+		std::vector<std::pair<YulString, size_t>> liveVariables;
+		for (TypedName const& parameter: _function.parameters)
+			liveVariables.emplace_back(parameter.name, m_names.slot(parameter));
+		for (TypedName const& returnVariable: _function.returnVariables)
+			liveVariables.emplace_back(returnVariable.name, m_names.slot(returnVariable));
 		return std::make_unique<InspectedInterpreter>(
 			m_inspector,
 			m_state,
 			m_dialect,
-			m_scope,
+			m_names,
 			m_disableExternalCalls,
 			m_disableMemoryTrace,
-			std::move(_variables)
+			std::move(_frame),
+			std::move(liveVariables)
 		);
 	}
-	std::unique_ptr<Interpreter> makeInterpreterNew(InterpreterState& _state, Scope& _scope) const override
+	std::unique_ptr<Interpreter> makeInterpreterNew(InterpreterState& _state) const override
 	{
 		return std::make_unique<InspectedInterpreter>(
 			std::make_unique<Inspector>(
@@ -201,13 +224,16 @@ protected:
 			),
 			_state,
 			m_dialect,
-			_scope,
+			m_names,
 			m_disableExternalCalls,
-			m_disableMemoryTrace
+			m_disableMemoryTrace,
+			std::vector<u256>(m_names.frameSize())
 		);
 	}
 private:
 	std::shared_ptr<Inspector> m_inspector;
+	/// Names and values of the variables in scope when the evaluator was created.
+	std::map<YulString, u256> m_liveVariables;
 };
 
 }
@@ -31,9 +31,11 @@
 #include <liblangutil/Exceptions.h>
 
 #include <libsolutil/FixedHash.h>
+#include <libsolutil/Visitor.h>
 
 #include <range/v3/view/reverse.hpp>
 
+#include <algorithm>
 #include <ostream>
 #include <variant>
 
@@ -43,6 +45,85 @@ using namespace solidity::yul::test;
 
 using solidity::util::h256;
 
+template <typename Visitor>
+void Memory::forEachPage(u256 _offset, size_t _size, Visitor&& _visit)
+{
+	size_t done = 0;
+	while (done < _size)
+	{
+		size_t pageOffset = static_cast<size_t>(_offset % s_pageSize);
+		size_t chunk = std::min(_size - done, s_pageSize - pageOffset);
+		_visit(_offset / s_pageSize, pageOffset, done, chunk);
+		done += chunk;
+		_offset += chunk;
+	}
+}
+
+uint8_t Memory::read(u256 const& _offset) const
+{
+	auto it = m_pages.find(_offset / s_pageSize);
+	return it == m_pages.end() ? 0 : it->second[static_cast<size_t>(_offset % s_pageSize)];
+}
+
+bytes Memory::read(u256 const& _offset, size_t _size) const
+{
+	bytes data(_size, uint8_t(0));
+	forEachPage(_offset, _size, [&](u256 const& _page, size_t _pageOffset, size_t _dataOffset, size_t _chunk) {
+		auto it = m_pages.find(_page);
+		if (it != m_pages.end())
+			std::copy_n(it->second.begin() + static_cast<std::ptrdiff_t>(_pageOffset), _chunk, data.begin() + static_cast<std::ptrdiff_t>(_dataOffset));
+	});
+	return data;
+}
+
+u256 Memory::readWord(u256 const& _offset) const
+{
+	size_t pageOffset = static_cast<size_t>(_offset % s_pageSize);
+	if (pageOffset + 32 <= s_pageSize)
+	{
+		auto it = m_pages.find(_offset / s_pageSize);
+		if (it == m_pages.end())
+			return 0;
+		return u256(h256(bytesConstRef(it->second.data() + pageOffset, 32)));
+	}
+	return u256(h256(read(_offset, 32)));
+}
+
+void Memory::write(u256 const& _offset, uint8_t _value)
+{
+	write(_offset, &_value, 1);
+}
+
+void Memory::write(u256 const& _offset, uint8_t const* _data, size_t _size)
+{
+	forEachPage(_offset, _size, [&](u256 const& _page, size_t _pageOffset, size_t _dataOffset, size_t _chunk) {
+		auto it = m_pages.find(_page);
+		if (it == m_pages.end())
+		{
+			// Writing zeros to a page that was never written does not change anything.
+			if (std::all_of(_data + _dataOffset, _data + _dataOffset + _chunk, [](uint8_t _byte) { return _byte == 0; }))
+				return;
+			it = m_pages.emplace(_page, Page{}).first;
+		}
+		std::copy_n(_data + _dataOffset, _chunk, it->second.begin() + static_cast<std::ptrdiff_t>(_pageOffset));
+	});
+}
+
+void Memory::clear(u256 const& _offset, size_t _size)
+{
+	forEachPage(_offset, _size, [&](u256 const& _page, size_t _pageOffset, size_t, size_t _chunk) {
+		auto it = m_pages.find(_page);
+		if (it != m_pages.end())
+			std::fill_n(it->second.begin() + static_cast<std::ptrdiff_t>(_pageOffset), _chunk, uint8_t(0));
+	});
+}
+
+void Memory::writeWord(u256 const& _offset, u256 const& _value)
+{
+	h256 const word(_value);
+	write(_offset, word.data(), 32);
+}
+
 void InterpreterState::dumpStorage(std::ostream& _out) const
 {
 	for (auto const& [slot, value]: storage)
@@ -65,12 +146,13 @@ void InterpreterState::dumpTraceAndState(std::ostream& _out, bool _disableMemory
 	if (!_disableMemoryTrace)
 	{
 		_out << "Memory dump:\n";
-		std::map<u256, u256> words;
-		for (auto const& [offset, value]: memory)
-			words[(offset / 0x20) * 0x20] |= u256(uint32_t(value)) << (256 - 8 - 8 * static_cast<size_t>(offset % 0x20));
-		for (auto const& [offset, value]: words)
-			if (value != 0)
-				_out << "  " << std::uppercase << std::hex << std::setw(4) << offset << ": " << h256(value).hex() << std::endl;
+		for (auto const& [page, data]: memory.pages())
+			for (size_t offset = 0; offset < Memory::s_pageSize; offset += 0x20)
+			{
+				h256 const word(bytesConstRef(data.data() + offset, 0x20));
+				if (word != h256{})
+					_out << "  " << std::uppercase << std::hex << std::setw(4) << page * Memory::s_pageSize + offset << ": " << word.hex() << std::endl;
+			}
 	}
 	_out << "Storage dump:" << std::endl;
 	dumpStorage(_out);
@@ -107,6 +189,204 @@ void InterpreterState::dumpTraceAndState(std::ostream& _out, bool _disableMemory
 	}
 }
 
+class ResolvedNames::Resolver
+{
+public:
+	Resolver(ResolvedNames& _names, Dialect const& _dialect): m_names(_names), m_dialect(_dialect) {}
+
+	/// Resolves the names in @a _body, which starts a new frame with the given variables.
+	/// @returns the size of the frame.
+	size_t resolveFrame(Block const& _body, std::vector<TypedName const*> const& _variables)
+	{
+		std::vector<std::pair<YulString, size_t>> outerVariables = std::move(m_variables);
+		size_t outerFrameSize = m_frameSize;
+		m_variables.clear();
+		m_frameSize = 0;
+		for (TypedName const* variable: _variables)
+			declare(*variable);
+
+		(*this)(_body);
+
+		size_t frameSize = m_frameSize;
+		m_variables = std::move(outerVariables);
+		m_frameSize = outerFrameSize;
+		return frameSize;
+	}
+
+	void operator()(Block const& _block)
+	{
+		std::map<YulString, FunctionDefinition const*> functions;
+		for (auto const& statement: _block.statements)
+			if (auto const* function = std::get_if<FunctionDefinition>(&statement))
+				functions.emplace(function->name, function);
+		m_functionScopes.emplace_back(std::move(functions));
+
+		size_t numVariables = m_variables.size();
+		for (auto const& statement: _block.statements)
+			visit(statement);
+		m_variables.resize(numVariables);
+
+		m_functionScopes.pop_back();
+	}
+
+	void visit(Statement const& _statement)
+	{
+		std::visit(util::GenericVisitor{
+			[&](ExpressionStatement const& _expressionStatement) { visit(_expressionStatement.expression); },
+			[&](Assignment const& _assignment) {
+				yulAssert(_assignment.value);
+				visit(*_assignment.value);
+				for (Identifier const& variable: _assignment.variableNames)
+					resolveVariable(variable);
+			},
+			[&](VariableDeclaration const& _declaration) {
+				if (_declaration.value)
+					visit(*_declaration.value);
+				for (TypedName const& variable: _declaration.variables)
+					declare(variable);
+			},
+			[&](If const& _if) {
+				yulAssert(_if.condition);
+				visit(*_if.condition);
+				(*this)(_if.body);
+			},
+			[&](Switch const& _switch) {
+				yulAssert(_switch.expression);
+				visit(*_switch.expression);
+				for (Case const& switchCase: _switch.cases)
+				{
+					if (switchCase.value)
+						visit(*switchCase.value);
+					(*this)(switchCase.body);
+				}
+			},
+			[&](FunctionDefinition const& _function) {
+				std::vector<TypedName const*> variables;
+				for (TypedName const& parameter: _function.parameters)
+					variables.emplace_back(&parameter);
+				for (TypedName const& returnVariable: _function.returnVariables)
+					variables.emplace_back(&returnVariable);
+				m_functionFrameSizes[&_function] = resolveFrame(_function.body, variables);
+			},
+			[&](ForLoop const& _forLoop) {
+				// The variables of the pre block stay visible in the rest of the loop.
+				size_t numVariables = m_variables.size();
+				for (auto const& statement: _forLoop.pre.statements)
+					visit(statement);
+				yulAssert(_forLoop.condition);
+				visit(*_forLoop.condition);
+				(*this)(_forLoop.body);
+				(*this)(_forLoop.post);
+				m_variables.resize(numVariables);
+			},
+			[&](Break const&) {},
+			[&](Continue const&) {},
+			[&](Leave const&) {},
+			[&](Block const& _block) { (*this)(_block); }
+		}, _statement);
+	}
+
+	void visit(Expression const& _expression)
+	{
+		std::visit(util::GenericVisitor{
+			[&](FunctionCall const& _call) {
+				for (Expression const& argument: _call.arguments)
+					visit(argument);
+				m_names.m_callTargets[&_call] = resolveFunction(_call.functionName.name);
+			},
+			[&](Identifier const& _identifier) { resolveVariable(_identifier); },
+			[&](Literal const&) {}
+		}, _expression);
+	}
+
+	/// Sets the frame sizes of the called functions, which are only known after all
+	/// function definitions have been resolved.
+	void finalize()
+	{
+		for (auto& [call, target]: m_names.m_callTargets)
+			if (target.function)
+				target.frameSize = m_functionFrameSizes.at(target.function);
+	}
+
+private:
+	void declare(TypedName const& _variable)
+	{
+		size_t slot = m_variables.size();
+		m_variables.emplace_back(_variable.name, slot);
+		m_frameSize = std::max(m_frameSize, m_variables.size());
+		m_names.m_declarationSlots[&_variable] = slot;
+	}
+
+	void resolveVariable(Identifier const& _identifier)
+	{
+		for (auto const& [name, slot]: m_variables | ranges::views::reverse)
+			if (name == _identifier.name)
+			{
+				m_names.m_identifierSlots[&_identifier] = slot;
+				return;
+			}
+		yulAssert(false, "Variable not found.");
+	}
+
+	CallTarget resolveFunction(YulString _name) const
+	{
+		CallTarget target;
+		if ((target.builtin = m_dialect.builtin(_name)))
+		{
+			if (EVMDialect const* dialect = dynamic_cast<EVMDialect const*>(&m_dialect))
+				target.evmBuiltin = dialect->builtin(_name);
+			return target;
+		}
+		for (auto const& functions: m_functionScopes | ranges::views::reverse)
+			if (functions.count(_name))
+			{
+				target.function = functions.at(_name);
+				return target;
+			}
+		yulAssert(false, "Function not found.");
+		return target;
+	}
+
+	ResolvedNames& m_names;
+	Dialect const& m_dialect;
+	/// Variables visible in the current frame and their slots, innermost last.
+	std::vector<std::pair<YulString, size_t>> m_variables;
+	size_t m_frameSize = 0;
+	/// Functions visible at the current position, innermost block last. Unlike variables,
+	/// these remain visible inside of nested function definitions.
+	std::vector<std::map<YulString, FunctionDefinition const*>> m_functionScopes;
+	std::map<FunctionDefinition const*, size_t> m_functionFrameSizes;
+};
+
+ResolvedNames::ResolvedNames(Dialect const& _dialect, Block const& _ast):
+	m_ast(_ast)
+{
+	Resolver resolver{*this, _dialect};
+	m_frameSize = resolver.resolveFrame(_ast, {});
+	resolver.finalize();
+}
+
+size_t ResolvedNames::slot(TypedName const& _variable) const
+{
+	auto it = m_declarationSlots.find(&_variable);
+	yulAssert(it != m_declarationSlots.end(), "Unresolved variable declaration.");
+	return it->second;
+}
+
+size_t ResolvedNames::slot(Identifier const& _identifier) const
+{
+	auto it = m_identifierSlots.find(&_identifier);
+	yulAssert(it != m_identifierSlots.end(), "Unresolved identifier.");
+	return it->second;
+}
+
+ResolvedNames::CallTarget const& ResolvedNames::callTarget(FunctionCall const& _call) const
+{
+	auto it = m_callTargets.find(&_call);
+	yulAssert(it != m_callTargets.end(), "Unresolved function call.");
+	return it->second;
+}
+
 void Interpreter::run(
 	InterpreterState& _state,
 	Dialect const& _dialect,
@@ -115,8 +395,15 @@ void Interpreter::run(
 	bool _disableMemoryTrace
 )
 {
-	Scope scope;
-	Interpreter{_state, _dialect, scope, _disableExternalCalls, _disableMemoryTrace}(_ast);
+	ResolvedNames names{_dialect, _ast};
+	Interpreter{
+		_state,
+		_dialect,
+		names,
+		_disableExternalCalls,
+		_disableMemoryTrace,
+		std::vector<u256>(names.frameSize())
+	}(_ast);
 }
 
 void Interpreter::operator()(ExpressionStatement const& _expressionStatement)
@@ -130,11 +417,7 @@ void Interpreter::operator()(Assignment const& _assignment)
 	std::vector<u256> values = evaluateMulti(*_assignment.value);
 	solAssert(values.size() == _assignment.variableNames.size(), "");
 	for (size_t i = 0; i < values.size(); ++i)
-	{
-		YulString varName = _assignment.variableNames.at(i).name;
-		solAssert(m_variables.count(varName), "");
-		m_variables[varName] = values.at(i);
-	}
+		m_frame[m_names.slot(_assignment.variableNames.at(i))] = values.at(i);
 }
 
 void Interpreter::operator()(VariableDeclaration const& _declaration)
@@ -145,12 +428,7 @@ void Interpreter::operator()(VariableDeclaration const& _declaration)
 
 	solAssert(values.size() == _declaration.variables.size(), "");
 	for (size_t i = 0; i < values.size(); ++i)
-	{
-		YulString varName = _declaration.variables.at(i).name;
-		solAssert(!m_variables.count(varName), "");
-		m_variables[varName] = values.at(i);
-		m_scope->names.emplace(varName, nullptr);
-	}
+		m_frame[m_names.slot(_declaration.variables.at(i))] = values.at(i);
 }
 
 void Interpreter::operator()(If const& _if)
@@ -182,9 +460,6 @@ void Interpreter::operator()(ForLoop const& _forLoop)
 {
 	solAssert(_forLoop.condition, "");
 
-	enterScope(_forLoop.pre);
-	ScopeGuard g([this]{ leaveScope(); });
-
 	for (auto const& statement: _forLoop.pre.statements)
 	{
 		visit(statement);
@@ -229,15 +504,6 @@ void Interpreter::operator()(Leave const&)
 
 void Interpreter::operator()(Block const& _block)
 {
-	enterScope(_block);
-	// Register functions.
-	for (auto const& statement: _block.statements)
-		if (std::holds_alternative<FunctionDefinition>(statement))
-		{
-			FunctionDefinition const& funDef = std::get<FunctionDefinition>(statement);
-			m_scope->names.emplace(funDef.name, &funDef);
-		}
-
 	for (auto const& statement: _block.statements)
 	{
 		incrementStep();
@@ -245,44 +511,22 @@ void Interpreter::operator()(Block const& _block)
 		if (m_state.controlFlowState != ControlFlowState::Default)
 			break;
 	}
-
-	leaveScope();
 }
 
 u256 Interpreter::evaluate(Expression const& _expression)
 {
-	ExpressionEvaluator ev(m_state, m_dialect, *m_scope, m_variables, m_disableExternalCalls, m_disableMemoryTrace);
+	ExpressionEvaluator ev(m_state, m_dialect, m_names, m_frame, m_disableExternalCalls, m_disableMemoryTrace);
 	ev.visit(_expression);
 	return ev.value();
 }
 
 std::vector<u256> Interpreter::evaluateMulti(Expression const& _expression)
 {
-	ExpressionEvaluator ev(m_state, m_dialect, *m_scope, m_variables, m_disableExternalCalls, m_disableMemoryTrace);
+	ExpressionEvaluator ev(m_state, m_dialect, m_names, m_frame, m_disableExternalCalls, m_disableMemoryTrace);
 	ev.visit(_expression);
 	return ev.values();
 }
 
-void Interpreter::enterScope(Block const& _block)
-{
-	if (!m_scope->subScopes.count(&_block))
-		m_scope->subScopes[&_block] = std::make_unique<Scope>(Scope{
-			{},
-			{},
-			m_scope
-		});
-	m_scope = m_scope->subScopes[&_block].get();
-}
-
-void Interpreter::leaveScope()
-{
-	for (auto const& [var, funDeclaration]: m_scope->names)
-		if (!funDeclaration)
-			m_variables.erase(var);
-	m_scope = m_scope->parent;
-	yulAssert(m_scope, "");
-}
-
 void Interpreter::incrementStep()
 {
 	m_state.numSteps++;
@@ -304,62 +548,50 @@ void ExpressionEvaluator::operator()(Literal const& _literal)
 
 void ExpressionEvaluator::operator()(Identifier const& _identifier)
 {
-	solAssert(m_variables.count(_identifier.name), "");
 	incrementStep();
-	setValue(m_variables.at(_identifier.name));
+	setValue(m_frame[m_names.slot(_identifier)]);
 }
 
 void ExpressionEvaluator::operator()(FunctionCall const& _funCall)
 {
+	ResolvedNames::CallTarget const& target = m_names.callTarget(_funCall);
 	std::vector<std::optional<LiteralKind>> const* literalArguments = nullptr;
-	if (BuiltinFunction const* builtin = m_dialect.builtin(_funCall.functionName.name))
-		if (!builtin->literalArguments.empty())
-			literalArguments = &builtin->literalArguments;
+	if (target.builtin && !target.builtin->literalArguments.empty())
+		literalArguments = &target.builtin->literalArguments;
 	evaluateArgs(_funCall.arguments, literalArguments);
 
-	if (EVMDialect const* dialect = dynamic_cast<EVMDialect const*>(&m_dialect))
+	if (BuiltinFunctionForEVM const* fun = target.evmBuiltin)
 	{
-		if (BuiltinFunctionForEVM const* fun = dialect->builtin(_funCall.functionName.name))
-		{
-			EVMInstructionInterpreter interpreter(dialect->evmVersion(), m_state, m_disableMemoryTrace);
+		EVMDialect const& dialect = dynamic_cast<EVMDialect const&>(m_dialect);
+		EVMInstructionInterpreter interpreter(dialect.evmVersion(), m_state, m_disableMemoryTrace);
 
-			u256 const value = interpreter.evalBuiltin(*fun, _funCall.arguments, values());
+		u256 const value = interpreter.evalBuiltin(*fun, _funCall.arguments, values());
 
-			if (
-				!m_disableExternalCalls &&
-				fun->instruction &&
-				evmasm::isCallInstruction(*fun->instruction)
-			)
-				runExternalCall(*fun->instruction);
+		if (
+			!m_disableExternalCalls &&
+			fun->instruction &&
+			evmasm::isCallInstruction(*fun->instruction)
+		)
+			runExternalCall(*fun->instruction);
 
-			setValue(value);
-			return;
-		}
+		setValue(value);
+		return;
 	}
 
-	Scope* scope = &m_scope;
-	for (; scope; scope = scope->parent)
-		if (scope->names.count(_funCall.functionName.name))
-			break;
-	yulAssert(scope, "");
-
-	FunctionDefinition const* fun = scope->names.at(_funCall.functionName.name);
+	FunctionDefinition const* fun = target.function;
 	yulAssert(fun, "Function not found.");
 	yulAssert(m_values.size() == fun->parameters.size(), "");
-	std::map<YulString, u256> variables;
-	for (size_t i = 0; i < fun->parameters.size(); ++i)
-		variables[fun->parameters.at(i).name] = m_values.at(i);
-	for (size_t i = 0; i < fun->returnVariables.size(); ++i)
-		variables[fun->returnVariables.at(i).name] = 0;
+	std::vector<u256> frame(target.frameSize);
+	std::copy(m_values.begin(), m_values.end(), frame.begin());
 
 	m_state.controlFlowState = ControlFlowState::Default;
-	std::unique_ptr<Interpreter> interpreter = makeInterpreterCopy(std::move(variables));
+	std::unique_ptr<Interpreter> interpreter = makeInterpreterCopy(*fun, std::move(frame));
 	(*interpreter)(fun->body);
 	m_state.controlFlowState = ControlFlowState::Default;
 
 	m_values.clear();
 	for (auto const& retVar: fun->returnVariables)
-		m_values.emplace_back(interpreter->valueOfVariable(retVar.name));
+		m_values.emplace_back(interpreter->valueOfSlot(m_names.slot(retVar)));
 }
 
 u256 ExpressionEvaluator::value() const
@@ -455,41 +687,20 @@ void ExpressionEvaluator::runExternalCall(evmasm::Instruction _instruction)
 	if (values()[1] != util::h160::Arith(m_state.address))
 		return;
 
-	Scope tmpScope;
 	InterpreterState tmpState;
 	tmpState.calldata = m_state.readMemory(memInOffset, memInSize);
 	tmpState.callvalue = callvalue;
 	tmpState.numInstance = m_state.numInstance + 1;
+	tmpState.disableTrace = m_state.disableTrace;
 
 	yulAssert(tmpState.numInstance < 1024, "Detected more than 1024 recursive calls, aborting...");
 
 	// Create new interpreter for the called contract
-	std::unique_ptr<Interpreter> newInterpreter = makeInterpreterNew(tmpState, tmpScope);
-
-	Scope* abstractRootScope = &m_scope;
-	Scope* fileScope = nullptr;
-	Block const* ast = nullptr;
-
-	// Find file scope
-	while (abstractRootScope->parent)
-	{
-		fileScope = abstractRootScope;
-		abstractRootScope = abstractRootScope->parent;
-	}
-
-	// Get AST for file scope
-	for (auto&& [block, scope]: abstractRootScope->subScopes)
-		if (scope.get() == fileScope)
-		{
-			ast = block;
-			break;
-		}
-
-	yulAssert(ast);
+	std::unique_ptr<Interpreter> newInterpreter = makeInterpreterNew(tmpState);
 
 	try
 	{
-		(*newInterpreter)(*ast);
+		(*newInterpreter)(m_names.ast());
 	}
 	catch (ExplicitlyTerminatedWithReturn const&)
 	{
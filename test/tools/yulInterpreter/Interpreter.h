@@ -31,11 +31,16 @@
 
 #include <libsolutil/Exceptions.h>
 
+#include <array>
 #include <map>
+#include <unordered_map>
+#include <vector>
 
 namespace solidity::yul
 {
 struct Dialect;
+struct BuiltinFunction;
+struct BuiltinFunctionForEVM;
 }
 
 namespace solidity::yul::test
@@ -73,12 +78,49 @@ enum class ControlFlowState
 	Leave
 };
 
+/**
+ * Sparse memory of the interpreter. It is allocated in pages of s_pageSize bytes on the first
+ * non-zero write to a page, bytes that were never written read as zero. Offsets wrap around at 2**256.
+ */
+class Memory
+{
+public:
+	static constexpr size_t s_pageSize = 1024;
+	using Page = std::array<uint8_t, s_pageSize>;
+
+	uint8_t read(u256 const& _offset) const;
+	/// @returns the @a _size bytes starting at @a _offset.
+	bytes read(u256 const& _offset, size_t _size) const;
+	/// @returns the 32 bytes starting at @a _offset as a big-endian word.
+	u256 readWord(u256 const& _offset) const;
+
+	void write(u256 const& _offset, uint8_t _value);
+	/// Writes @a _size bytes of @a _data to @a _offset.
+	void write(u256 const& _offset, uint8_t const* _data, size_t _size);
+	/// Sets @a _size bytes starting at @a _offset to zero.
+	void clear(u256 const& _offset, size_t _size);
+	/// Writes @a _value to the 32 bytes starting at @a _offset in big-endian order.
+	void writeWord(u256 const& _offset, u256 const& _value);
+
+	/// @returns the allocated pages, keyed by their offset divided by s_pageSize.
+	std::map<u256, Page> const& pages() const { return m_pages; }
+
+private:
+	/// Calls @a _visit with the page index, the offset inside of the page, the offset inside of
+	/// the range and the size of each part of the range of @a _size bytes starting at @a _offset
+	/// that is contained in a single page.
+	template <typename Visitor>
+	static void forEachPage(u256 _offset, size_t _size, Visitor&& _visit);
+
+	std::map<u256, Page> m_pages;
+};
+
 struct InterpreterState
 {
 	bytes calldata;
 	bytes returndata;
-	std::map<u256, uint8_t> memory;
-	/// This is different than memory.size() because we ignore gas.
+	Memory memory;
+	/// This is different than the size of the allocated memory because we ignore gas.
 	u256 msize;
 	std::map<util::h256, util::h256> storage;
 	std::map<util::h256, util::h256> transientStorage;
@@ -104,6 +146,9 @@ struct InterpreterState
 	u256 blobbasefee = 0x01;
 	/// Log of changes / effects. Sholud be structured data in the future.
 	std::vector<std::string> trace;
+	/// If set, nothing is added to the trace. Avoids the costs of tracing when only the final
+	/// state or the time of the execution matters.
+	bool disableTrace = false;
 	/// This is actually an input parameter that more or less limits the runtime.
 	size_t maxTraceSize = 0;
 	size_t maxSteps = 0;
@@ -132,22 +177,49 @@ struct InterpreterState
 	bytes readMemory(u256 const& _offset, u256 const& _size)
 	{
 		yulAssert(_size <= 0xffff, "Too large read.");
-		bytes data(size_t(_size), uint8_t(0));
-		for (size_t i = 0; i < data.size(); ++i)
-			data[i] = memory[_offset + i];
-		return data;
+		return memory.read(_offset, size_t(_size));
 	}
 };
 
 /**
- * Scope structure built and maintained during execution.
+ * Names of an AST resolved before it is executed. The outermost block and each function body get
+ * a frame of variable slots, starting with the parameters and return variables of the function,
+ * so that variables are accessed by index instead of by name. Slots are reused by sibling blocks.
+ * Function calls are bound to the called builtin or function definition.
  */
-struct Scope
+class ResolvedNames
 {
-	/// Used for variables and functions. Value is nullptr for variables.
-	std::map<YulString, FunctionDefinition const*> names;
-	std::map<Block const*, std::unique_ptr<Scope>> subScopes;
-	Scope* parent = nullptr;
+public:
+	ResolvedNames(Dialect const& _dialect, Block const& _ast);
+
+	struct CallTarget
+	{
+		BuiltinFunction const* builtin = nullptr;
+		/// Only set for builtins of an EVM dialect.
+		BuiltinFunctionForEVM const* evmBuiltin = nullptr;
+		FunctionDefinition const* function = nullptr;
+		/// Size of the frame of @a function.
+		size_t frameSize = 0;
+	};
+
+	Block const& ast() const { return m_ast; }
+	/// @returns the size of the frame of the outermost block.
+	size_t frameSize() const { return m_frameSize; }
+
+	/// @returns the slot of the variable declared by @a _variable.
+	size_t slot(TypedName const& _variable) const;
+	/// @returns the slot of the variable referenced by @a _identifier.
+	size_t slot(Identifier const& _identifier) const;
+	CallTarget const& callTarget(FunctionCall const& _call) const;
+
+private:
+	class Resolver;
+
+	Block const& m_ast;
+	size_t m_frameSize = 0;
+	std::unordered_map<TypedName const*, size_t> m_declarationSlots;
+	std::unordered_map<Identifier const*, size_t> m_identifierSlots;
+	std::unordered_map<FunctionCall const*, CallTarget> m_callTargets;
 };
 
 /**
@@ -168,18 +240,20 @@ public:
 		bool _disableMemoryTracing
 	);
 
+	/// @param _frame the values of the variables, has to be of the size of the frame of the
+	/// executed function or of the outermost block according to @a _names.
 	Interpreter(
 		InterpreterState& _state,
 		Dialect const& _dialect,
-		Scope& _scope,
+		ResolvedNames const& _names,
 		bool _disableExternalCalls,
 		bool _disableMemoryTracing,
-		std::map<YulString, u256> _variables = {}
+		std::vector<u256> _frame
 	):
 		m_dialect(_dialect),
 		m_state(_state),
-		m_variables(std::move(_variables)),
-		m_scope(&_scope),
+		m_names(_names),
+		m_frame(std::move(_frame)),
 		m_disableExternalCalls(_disableExternalCalls),
 		m_disableMemoryTrace(_disableMemoryTracing)
 	{
@@ -200,7 +274,7 @@ public:
 	bytes returnData() const { return m_state.returndata; }
 	std::vector<std::string> const& trace() const { return m_state.trace; }
 
-	u256 valueOfVariable(YulString _name) const { return m_variables.at(_name); }
+	u256 valueOfSlot(size_t _slot) const { return m_frame.at(_slot); }
 
 protected:
 	/// Asserts that the expression evaluates to exactly one value and returns it.
@@ -208,18 +282,15 @@ protected:
 	/// Evaluates the expression and returns its value.
 	virtual std::vector<u256> evaluateMulti(Expression const& _expression);
 
-	void enterScope(Block const& _block);
-	void leaveScope();
-
 	/// Increment interpreter step count, throwing exception if step limit
 	/// is reached.
 	void incrementStep();
 
 	Dialect const& m_dialect;
 	InterpreterState& m_state;
-	/// Values of variables.
-	std::map<YulString, u256> m_variables;
-	Scope* m_scope;
+	ResolvedNames const& m_names;
+	/// Values of variables, by slot.
+	std::vector<u256> m_frame;
 	/// If not set, external calls (e.g. using `call()`) to the same contract
 	/// are evaluated in a new parser instance.
 	bool m_disableExternalCalls;
@@ -235,15 +306,15 @@ public:
 	ExpressionEvaluator(
 		InterpreterState& _state,
 		Dialect const& _dialect,
-		Scope& _scope,
-		std::map<YulString, u256> const& _variables,
+		ResolvedNames const& _names,
+		std::vector<u256> const& _frame,
 		bool _disableExternalCalls,
 		bool _disableMemoryTrace
 	):
 		m_state(_state),
 		m_dialect(_dialect),
-		m_variables(_variables),
-		m_scope(_scope),
+		m_names(_names),
+		m_frame(_frame),
 		m_disableExternalCalls(_disableExternalCalls),
 		m_disableMemoryTrace(_disableMemoryTrace)
 	{}
@@ -259,25 +330,28 @@ public:
 
 protected:
 	void runExternalCall(evmasm::Instruction _instruction);
-	virtual std::unique_ptr<Interpreter> makeInterpreterCopy(std::map<YulString, u256> _variables = {}) const
+	/// @returns an interpreter for the body of @a _function, with the given frame.
+	virtual std::unique_ptr<Interpreter> makeInterpreterCopy(FunctionDefinition const&, std::vector<u256> _frame) const
 	{
 		return std::make_unique<Interpreter>(
 			m_state,
 			m_dialect,
-			m_scope,
+			m_names,
 			m_disableExternalCalls,
 			m_disableMemoryTrace,
-			std::move(_variables)
+			std::move(_frame)
 		);
 	}
-	virtual std::unique_ptr<Interpreter> makeInterpreterNew(InterpreterState& _state, Scope& _scope) const
+	/// @returns an interpreter for the whole AST, with the given state.
+	virtual std::unique_ptr<Interpreter> makeInterpreterNew(InterpreterState& _state) const
 	{
 		return std::make_unique<Interpreter>(
 			_state,
 			m_dialect,
-			_scope,
+			m_names,
 			m_disableExternalCalls,
-			m_disableMemoryTrace
+			m_disableMemoryTrace,
+			std::vector<u256>(m_names.frameSize())
 		);
 	}
 
@@ -297,9 +371,9 @@ protected:
 
 	InterpreterState& m_state;
 	Dialect const& m_dialect;
-	/// Values of variables.
-	std::map<YulString, u256> const& m_variables;
-	Scope& m_scope;
+	ResolvedNames const& m_names;
+	/// Values of variables, by slot.
+	std::vector<u256> const& m_frame;
 	/// Current value of the expression
 	std::vector<u256> m_values;
 	/// Current expression nesting level
@@ -0,0 +1,124 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Yul interpreter with per-function profiling.
+ */
+
+#include <test/tools/yulInterpreter/Profiler.h>
+
+#include <libyul/backends/evm/EVMMetrics.h>
+
+#include <fmt/format.h>
+
+#include <algorithm>
+
+using namespace solidity;
+using namespace solidity::yul;
+using namespace solidity::yul::test;
+
+void ExecutionProfile::enter(FunctionDefinition const* _function)
+{
+	Entry& entry = m_entries[_function];
+	++entry.calls;
+	m_callStack.push_back(&entry);
+}
+
+void ExecutionProfile::leave()
+{
+	yulAssert(!m_callStack.empty());
+	m_callStack.pop_back();
+}
+
+void ExecutionProfile::countInstruction(evmasm::Instruction _instruction)
+{
+	yulAssert(!m_callStack.empty());
+
+	auto it = m_instructionCosts.find(_instruction);
+	if (it == m_instructionCosts.end())
+		it = m_instructionCosts.emplace(
+			_instruction,
+			GasMeterVisitor::instructionCosts(_instruction, m_dialect).first
+		).first;
+
+	++m_callStack.back()->instructions;
+	m_callStack.back()->gas += it->second;
+}
+
+void ExecutionProfile::print(std::ostream& _out) const
+{
+	std::vector<std::pair<FunctionDefinition const*, Entry>> entries(m_entries.begin(), m_entries.end());
+	std::stable_sort(entries.begin(), entries.end(), [](auto const& _a, auto const& _b) {
+		return _a.second.gas > _b.second.gas;
+	});
+
+	_out << fmt::format("{:<40} {:>10} {:>14} {:>16}\n", "Function", "Calls", "Instructions", "Gas");
+	for (auto const& [function, entry]: entries)
+		_out << fmt::format(
+			"{:<40} {:>10} {:>14} {:>16}\n",
+			function ? function->name.str() : "<main>",
+			entry.calls,
+			entry.instructions,
+			entry.gas.str()
+		);
+}
+
+void ProfiledInterpreter::run(
+	ExecutionProfile& _profile,
+	InterpreterState& _state,
+	Dialect const& _dialect,
+	Block const& _ast,
+	bool _disableExternalCalls,
+	bool _disableMemoryTrace
+)
+{
+	ResolvedNames names{_dialect, _ast};
+	ProfiledInterpreter{
+		_profile,
+		nullptr,
+		_state,
+		_dialect,
+		names,
+		_disableExternalCalls,
+		_disableMemoryTrace,
+		std::vector<u256>(names.frameSize())
+	}(_ast);
+}
+
+u256 ProfiledInterpreter::evaluate(Expression const& _expression)
+{
+	ProfiledExpressionEvaluator ev(m_profile, m_state, m_dialect, m_names, m_frame, m_disableExternalCalls, m_disableMemoryTrace);
+	ev.visit(_expression);
+	return ev.value();
+}
+
+std::vector<u256> ProfiledInterpreter::evaluateMulti(Expression const& _expression)
+{
+	ProfiledExpressionEvaluator ev(m_profile, m_state, m_dialect, m_names, m_frame, m_disableExternalCalls, m_disableMemoryTrace);
+	ev.visit(_expression);
+	return ev.values();
+}
+
+void ProfiledExpressionEvaluator::operator()(FunctionCall const& _funCall)
+{
+	// Counted before the evaluation, so that instructions terminating the execution are included.
+	if (BuiltinFunctionForEVM const* builtin = m_names.callTarget(_funCall).evmBuiltin)
+		if (builtin->instruction)
+			m_profile.countInstruction(*builtin->instruction);
+
+	ExpressionEvaluator::operator()(_funCall);
+}
@@ -0,0 +1,168 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Yul interpreter with per-function profiling.
+ */
+
+#pragma once
+
+#include <test/tools/yulInterpreter/Interpreter.h>
+
+#include <libyul/AST.h>
+#include <libyul/backends/evm/EVMDialect.h>
+
+#include <map>
+#include <memory>
+#include <ostream>
+#include <vector>
+
+namespace solidity::yul::test
+{
+
+/**
+ * Numbers of EVM instructions executed by each Yul function and their gas costs. Only the
+ * instructions directly in the body of a function count towards it, not the ones in the functions
+ * it calls. Code outside of functions is attributed to the null function.
+ *
+ * The gas costs are the static costs of the instructions as estimated by @a GasMeter, i.e.
+ * memory expansion, stack operations and jumps are not included.
+ */
+class ExecutionProfile
+{
+public:
+	struct Entry
+	{
+		size_t calls = 0;
+		size_t instructions = 0;
+		bigint gas = 0;
+	};
+
+	explicit ExecutionProfile(EVMDialect const& _dialect): m_dialect(_dialect) {}
+
+	/// Starts attributing instructions to @a _function until the matching call to leave().
+	void enter(FunctionDefinition const* _function);
+	void leave();
+	void countInstruction(evmasm::Instruction _instruction);
+
+	std::map<FunctionDefinition const*, Entry> const& entries() const { return m_entries; }
+
+	/// Prints a table of all functions that were called, by descending gas costs.
+	void print(std::ostream& _out) const;
+
+private:
+	EVMDialect const& m_dialect;
+	std::map<FunctionDefinition const*, Entry> m_entries;
+	std::vector<Entry*> m_callStack;
+	/// Gas costs of the instructions executed so far.
+	std::map<evmasm::Instruction, bigint> m_instructionCosts;
+};
+
+/**
+ * Yul interpreter that records the executed instructions in an @a ExecutionProfile.
+ * An instance is created for each call of a function and attributes the instructions to that
+ * function while it exists.
+ */
+class ProfiledInterpreter: public Interpreter
+{
+public:
+	static void run(
+		ExecutionProfile& _profile,
+		InterpreterState& _state,
+		Dialect const& _dialect,
+		Block const& _ast,
+		bool _disableExternalCalls,
+		bool _disableMemoryTracing
+	);
+
+	/// @param _function the function whose body is executed, nullptr for the outermost block.
+	ProfiledInterpreter(
+		ExecutionProfile& _profile,
+		FunctionDefinition const* _function,
+		InterpreterState& _state,
+		Dialect const& _dialect,
+		ResolvedNames const& _names,
+		bool _disableExternalCalls,
+		bool _disableMemoryTracing,
+		std::vector<u256> _frame
+	):
+		Interpreter(_state, _dialect, _names, _disableExternalCalls, _disableMemoryTracing, std::move(_frame)),
+		m_profile(_profile)
+	{
+		m_profile.enter(_function);
+	}
+	~ProfiledInterpreter() override { m_profile.leave(); }
+
+protected:
+	u256 evaluate(Expression const& _expression) override;
+	std::vector<u256> evaluateMulti(Expression const& _expression) override;
+
+private:
+	ExecutionProfile& m_profile;
+};
+
+class ProfiledExpressionEvaluator: public ExpressionEvaluator
+{
+public:
+	ProfiledExpressionEvaluator(
+		ExecutionProfile& _profile,
+		InterpreterState& _state,
+		Dialect const& _dialect,
+		ResolvedNames const& _names,
+		std::vector<u256> const& _frame,
+		bool _disableExternalCalls,
+		bool _disableMemoryTrace
+	):
+		ExpressionEvaluator(_state, _dialect, _names, _frame, _disableExternalCalls, _disableMemoryTrace),
+		m_profile(_profile)
+	{}
+
+	void operator()(FunctionCall const& _funCall) override;
+
+protected:
+	std::unique_ptr<Interpreter> makeInterpreterCopy(FunctionDefinition const& _function, std::vector<u256> _frame) const override
+	{
+		return std::make_unique<ProfiledInterpreter>(
+			m_profile,
+			&_function,
+			m_state,
+			m_dialect,
+			m_names,
+			m_disableExternalCalls,
+			m_disableMemoryTrace,
+			std::move(_frame)
+		);
+	}
+	std::unique_ptr<Interpreter> makeInterpreterNew(InterpreterState& _state) const override
+	{
+		return std::make_unique<ProfiledInterpreter>(
+			m_profile,
+			nullptr,
+			_state,
+			m_dialect,
+			m_names,
+			m_disableExternalCalls,
+			m_disableMemoryTrace,
+			std::vector<u256>(m_names.frameSize())
+		);
+	}
+
+private:
+	ExecutionProfile& m_profile;
+};
+
+}
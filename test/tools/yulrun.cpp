@@ -21,6 +21,7 @@
 
 #include <test/tools/yulInterpreter/Interpreter.h>
 #include <test/tools/yulInterpreter/Inspector.h>
+#include <test/tools/yulInterpreter/Profiler.h>
 
 #include <libyul/AsmAnalysisInfo.h>
 #include <libyul/AsmAnalysis.h>
@@ -39,6 +40,7 @@
 
 #include <boost/program_options.hpp>
 
+#include <chrono>
 #include <string>
 #include <memory>
 #include <iostream>
@@ -75,7 +77,7 @@ std::pair<std::shared_ptr<Block>, std::shared_ptr<AsmAnalysisInfo>> parse(std::s
 	}
 }
 
-void interpret(std::string const& _source, bool _inspect, bool _disableExternalCalls)
+void interpret(std::string const& _source, bytes const& _calldata, bool _inspect, bool _disableExternalCalls)
 {
 	std::shared_ptr<Block> ast;
 	std::shared_ptr<AsmAnalysisInfo> analysisInfo;
@@ -84,6 +86,7 @@ void interpret(std::string const& _source, bool _inspect, bool _disableExternalC
 		return;
 
 	InterpreterState state;
+	state.calldata = _calldata;
 	state.maxTraceSize = 10000;
 	try
 	{
@@ -102,6 +105,51 @@ void interpret(std::string const& _source, bool _inspect, bool _disableExternalC
 	state.dumpTraceAndState(std::cout, /*disableMemoryTracing=*/false);
 }
 
+/// Runs the program @a _runs times without tracing, each time from a fresh state, and prints the
+/// time it took. With @a _profile also prints the instructions executed by each function.
+void benchmark(std::string const& _source, bytes const& _calldata, size_t _runs, bool _profile, bool _disableExternalCalls)
+{
+	std::shared_ptr<Block> ast;
+	std::shared_ptr<AsmAnalysisInfo> analysisInfo;
+	tie(ast, analysisInfo) = parse(_source);
+	if (!ast || !analysisInfo)
+		return;
+
+	EVMDialect const& dialect(EVMDialect::strictAssemblyForEVMObjects(langutil::EVMVersion{}));
+	ResolvedNames names{dialect, *ast};
+	ExecutionProfile profile{dialect};
+
+	auto start = std::chrono::steady_clock::now();
+	for (size_t run = 0; run < _runs; ++run)
+	{
+		InterpreterState state;
+		state.calldata = _calldata;
+		state.disableTrace = true;
+		try
+		{
+			std::vector<u256> frame(names.frameSize());
+			if (_profile)
+				ProfiledInterpreter(profile, nullptr, state, dialect, names, _disableExternalCalls, /*disableMemoryTracing=*/false, std::move(frame))(*ast);
+			else
+				Interpreter(state, dialect, names, _disableExternalCalls, /*disableMemoryTracing=*/false, std::move(frame))(*ast);
+		}
+		catch (InterpreterTerminatedGeneric const&)
+		{
+		}
+	}
+	auto duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+	std::cout << "Runs: " << _runs << std::endl;
+	std::cout << "Total time: " << duration.count() / 1000 << " ms" << std::endl;
+	if (_runs > 0)
+		std::cout << "Time per run: " << duration.count() / static_cast<long>(_runs) << " us" << std::endl;
+	if (_profile)
+	{
+		std::cout << std::endl;
+		profile.print(std::cout);
+	}
+}
+
 }
 
 int main(int argc, char** argv)
@@ -110,6 +158,7 @@ int main(int argc, char** argv)
 		R"(yulrun, the Yul interpreter.
 Usage: yulrun [Options] < input
 Reads a single source from stdin, runs it and prints a trace of all side-effects.
+With --repeat or --profile, runs it without tracing and prints timing information instead.
 
 Allowed options)",
 		po::options_description::m_default_line_length,
@@ -118,6 +167,9 @@ Allowed options)",
 		("help", "Show this help screen.")
 		("enable-external-calls", "Enable external calls")
 		("interactive", "Run interactive")
+		("calldata", po::value<std::string>(), "Calldata to run the program with, in hex.")
+		("repeat", po::value<size_t>(), "Run the program the given number of times and print the time it took.")
+		("profile", "Print the instructions executed by each function and their gas costs, summed over all runs.")
 		("input-file", po::value<std::vector<std::string>>(), "input file");
 	po::positional_options_description filesPositions;
 	filesPositions.add("input-file", -1);
@@ -161,7 +213,31 @@ Allowed options)",
 		else
 			input = readUntilEnd(std::cin);
 
-		interpret(input, arguments.count("interactive"), !arguments.count("enable-external-calls"));
+		bytes calldata;
+		if (arguments.count("calldata"))
+		{
+			try
+			{
+				calldata = fromHex(arguments["calldata"].as<std::string>(), WhenError::Throw);
+			}
+			catch (BadHexCharacter const&)
+			{
+				std::cerr << "Invalid calldata: " << arguments["calldata"].as<std::string>() << std::endl;
+				return 1;
+			}
+		}
+
+		bool const disableExternalCalls = !arguments.count("enable-external-calls");
+		if (arguments.count("repeat") || arguments.count("profile"))
+			benchmark(
+				input,
+				calldata,
+				arguments.count("repeat") ? arguments["repeat"].as<size_t>() : 1,
+				arguments.count("profile"),
+				disableExternalCalls
+			);
+		else
+			interpret(input, calldata, arguments.count("interactive"), disableExternalCalls);
 	}
 
 	return 0;
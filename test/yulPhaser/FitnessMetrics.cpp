@@ -237,6 +237,63 @@ BOOST_FIXTURE_TEST_CASE(evaluate_should_multiply_the_result_by_scaling_factor, P
 	BOOST_TEST(RelativeProgramSize(m_program, nullptr, 4, m_weights).evaluate(m_chromosome) == round(10000.0 * sizeRatio));
 }
 
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE(ProgramGasCostTest)
+
+BOOST_FIXTURE_TEST_CASE(evaluate_should_compute_gas_cost_of_the_optimised_program, ProgramBasedMetricFixture)
+{
+	size_t fitness = ProgramGasCost(m_program, nullptr, 200).evaluate(m_chromosome);
+
+	BOOST_TEST(fitness != m_program.gasCost(200));
+	BOOST_TEST(fitness == m_optimisedProgram.gasCost(200));
+}
+
+BOOST_FIXTURE_TEST_CASE(evaluate_should_be_able_to_use_program_cache_if_available, ProgramBasedMetricFixture)
+{
+	size_t fitness = ProgramGasCost(std::nullopt, m_programCache, 200).evaluate(m_chromosome);
+
+	BOOST_TEST(fitness == m_optimisedProgram.gasCost(200));
+	BOOST_TEST(m_programCache->size() == m_chromosome.length());
+}
+
+BOOST_FIXTURE_TEST_CASE(evaluate_should_weigh_execution_cost_by_expected_executions, ProgramBasedMetricFixture)
+{
+	size_t fitnessSingleRun = ProgramGasCost(m_program, nullptr, 1).evaluate(m_chromosome);
+	size_t fitnessManyRuns = ProgramGasCost(m_program, nullptr, 1000).evaluate(m_chromosome);
+
+	BOOST_TEST(fitnessSingleRun < fitnessManyRuns);
+	BOOST_TEST(fitnessManyRuns == m_optimisedProgram.gasCost(1000));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE(RelativeProgramGasCostTest)
+
+BOOST_FIXTURE_TEST_CASE(evaluate_should_compute_the_gas_cost_ratio_between_optimised_program_and_original_program, ProgramBasedMetricFixture)
+{
+	BOOST_TEST(
+		RelativeProgramGasCost(m_program, nullptr, 3, 200).evaluate(m_chromosome) ==
+		round(1000.0 * double(m_optimisedProgram.gasCost(200)) / double(m_program.gasCost(200)))
+	);
+}
+
+BOOST_FIXTURE_TEST_CASE(evaluate_should_return_one_if_number_of_repetitions_is_zero, ProgramBasedMetricFixture)
+{
+	RelativeProgramGasCost metric(m_program, nullptr, 3, 200, 0);
+
+	BOOST_TEST(metric.evaluate(m_chromosome) == 1000);
+}
+
+BOOST_FIXTURE_TEST_CASE(evaluate_should_return_one_if_the_original_program_gas_cost_is_zero, ProgramBasedMetricFixture)
+{
+	CharStream sourceStream = CharStream("{}", "");
+	Program program = std::get<Program>(Program::load(sourceStream));
+
+	RelativeProgramGasCost metric(program, nullptr, 3, 200);
+
+	BOOST_TEST(metric.evaluate(m_chromosome) == 1000);
+	BOOST_TEST(metric.evaluate(Chromosome("")) == 1000);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE(FitnessMetricCombinationTest)
 
@@ -258,6 +315,16 @@ BOOST_FIXTURE_TEST_CASE(FitnessMetricSum_evaluate_should_compute_sum_of_values_r
 	BOOST_TEST(metric.metrics() == m_simpleMetrics);
 }
 
+BOOST_FIXTURE_TEST_CASE(FitnessMetricWeightedAverage_evaluate_should_compute_weighted_average_of_values_returned_by_metrics_passed_to_it, FitnessMetricCombinationFixture)
+{
+	FitnessMetricWeightedAverage metric(m_simpleMetrics, {1, 0, 3});
+
+	assert(m_simpleMetrics.size() == 3);
+	BOOST_TEST(metric.evaluate(m_chromosome) == (m_fitness[0] + 3 * m_fitness[2]) / 4);
+	BOOST_TEST(metric.metrics() == m_simpleMetrics);
+	BOOST_TEST(metric.weights() == (std::vector<size_t>{1, 0, 3}));
+}
+
 BOOST_FIXTURE_TEST_CASE(FitnessMetricMaximum_evaluate_should_compute_maximum_of_values_returned_by_metrics_passed_to_it, FitnessMetricCombinationFixture)
 {
 	FitnessMetricMaximum metric(m_simpleMetrics);
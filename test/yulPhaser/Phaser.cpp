@@ -88,6 +88,9 @@ protected:
 		/* metricAggregator = */ MetricAggregatorChoice::Average,
 		/* relativeMetricScale = */ 5,
 		/* chromosomeRepetitions = */ 1,
+		/* expectedExecutions = */ 200,
+		/* codeSizeWeight = */ 1,
+		/* gasCostWeight = */ 1,
 	};
 	CodeWeights const m_weights{};
 };
@@ -236,6 +239,51 @@ BOOST_FIXTURE_TEST_CASE(build_should_set_relative_metric_scale, FitnessMetricFac
 	BOOST_TEST(relativeProgramSizeMetric->fixedPointPrecision() == m_options.relativeMetricScale);
 }
 
+BOOST_FIXTURE_TEST_CASE(build_should_set_expected_executions_of_gas_cost_metrics, FitnessMetricFactoryFixture)
+{
+	m_options.metric = MetricChoice::RelativeGasCost;
+	m_options.metricAggregator = MetricAggregatorChoice::Average;
+	m_options.expectedExecutions = 10;
+	std::unique_ptr<FitnessMetric> metric = FitnessMetricFactory::build(m_options, {m_programs[0]}, {nullptr}, m_weights);
+	BOOST_REQUIRE(metric != nullptr);
+
+	auto averageMetric = dynamic_cast<FitnessMetricAverage*>(metric.get());
+	BOOST_REQUIRE(averageMetric != nullptr);
+	BOOST_REQUIRE(averageMetric->metrics().size() == 1);
+	BOOST_REQUIRE(averageMetric->metrics()[0] != nullptr);
+
+	auto relativeGasCostMetric = dynamic_cast<RelativeProgramGasCost*>(averageMetric->metrics()[0].get());
+	BOOST_REQUIRE(relativeGasCostMetric != nullptr);
+	BOOST_TEST(relativeGasCostMetric->expectedExecutions() == m_options.expectedExecutions);
+	BOOST_TEST(relativeGasCostMetric->fixedPointPrecision() == m_options.relativeMetricScale);
+}
+
+BOOST_FIXTURE_TEST_CASE(build_should_combine_relative_size_and_gas_cost_in_weighted_metric, FitnessMetricFactoryFixture)
+{
+	m_options.metric = MetricChoice::Weighted;
+	m_options.metricAggregator = MetricAggregatorChoice::Sum;
+	m_options.codeSizeWeight = 2;
+	m_options.gasCostWeight = 3;
+	std::unique_ptr<FitnessMetric> metric = FitnessMetricFactory::build(m_options, {m_programs[0]}, {nullptr}, m_weights);
+	BOOST_REQUIRE(metric != nullptr);
+
+	auto sumMetric = dynamic_cast<FitnessMetricSum*>(metric.get());
+	BOOST_REQUIRE(sumMetric != nullptr);
+	BOOST_REQUIRE(sumMetric->metrics().size() == 1);
+
+	auto weightedMetric = dynamic_cast<FitnessMetricWeightedAverage*>(sumMetric->metrics()[0].get());
+	BOOST_REQUIRE(weightedMetric != nullptr);
+	BOOST_TEST(weightedMetric->weights() == (std::vector<size_t>{2, 3}));
+	BOOST_REQUIRE(weightedMetric->metrics().size() == 2);
+
+	auto relativeProgramSizeMetric = dynamic_cast<RelativeProgramSize*>(weightedMetric->metrics()[0].get());
+	auto relativeGasCostMetric = dynamic_cast<RelativeProgramGasCost*>(weightedMetric->metrics()[1].get());
+	BOOST_REQUIRE(relativeProgramSizeMetric != nullptr);
+	BOOST_REQUIRE(relativeGasCostMetric != nullptr);
+	BOOST_TEST(toString(relativeProgramSizeMetric->program()) == toString(m_programs[0]));
+	BOOST_TEST(toString(relativeGasCostMetric->program()) == toString(m_programs[0]));
+}
+
 BOOST_FIXTURE_TEST_CASE(build_should_create_metric_for_each_input_program, FitnessMetricFactoryFixture)
 {
 	std::unique_ptr<FitnessMetric> metric = FitnessMetricFactory::build(
@@ -403,6 +403,43 @@ BOOST_AUTO_TEST_CASE(codeSize)
 	BOOST_TEST(program.codeSize(CodeWeights{}) == CodeSize::codeSizeIncludingFunctions(program.ast()));
 }
 
+BOOST_AUTO_TEST_CASE(gasCost_should_grow_with_expected_executions)
+{
+	std::string sourceCode(
+		"{\n"
+		"    sstore(0, sload(1))\n"
+		"    log1(0, 0, 2)\n"
+		"    pop(call(gas(), 0, 0, 0, 0, 0, 0))\n"
+		"}\n"
+	);
+	CharStream sourceStream(sourceCode, current_test_case().p_name);
+	Program program = get<Program>(Program::load(sourceStream));
+
+	BOOST_TEST(program.gasCost(1) > 0);
+	BOOST_TEST(program.gasCost(1) < program.gasCost(10));
+}
+
+BOOST_AUTO_TEST_CASE(gasCost_should_include_calls_to_user_defined_functions)
+{
+	CharStream sourceStreamWithCall(
+		"{\n"
+		"    function f() {}\n"
+		"    f()\n"
+		"}\n",
+		current_test_case().p_name
+	);
+	CharStream sourceStreamWithoutCall(
+		"{\n"
+		"    function f() {}\n"
+		"}\n",
+		current_test_case().p_name
+	);
+	Program programWithCall = get<Program>(Program::load(sourceStreamWithCall));
+	Program programWithoutCall = get<Program>(Program::load(sourceStreamWithoutCall));
+
+	BOOST_TEST(programWithCall.gasCost(200) > programWithoutCall.gasCost(200));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE_END()
 
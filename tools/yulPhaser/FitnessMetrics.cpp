@@ -74,6 +74,26 @@ size_t RelativeProgramSize::evaluate(Chromosome const& _chromosome)
 	));
 }
 
+size_t ProgramGasCost::evaluate(Chromosome const& _chromosome)
+{
+	return optimisedProgram(_chromosome).gasCost(m_expectedExecutions);
+}
+
+size_t RelativeProgramGasCost::evaluate(Chromosome const& _chromosome)
+{
+	double const scalingFactor = std::pow(10, m_fixedPointPrecision);
+
+	size_t unoptimisedCost = optimisedProgram(Chromosome("")).gasCost(m_expectedExecutions);
+	if (unoptimisedCost == 0)
+		return static_cast<size_t>(scalingFactor);
+
+	size_t optimisedCost = optimisedProgram(_chromosome).gasCost(m_expectedExecutions);
+
+	return static_cast<size_t>(std::round(
+		double(optimisedCost) / double(unoptimisedCost) * scalingFactor
+	));
+}
+
 size_t FitnessMetricAverage::evaluate(Chromosome const& _chromosome)
 {
 	assert(m_metrics.size() > 0);
@@ -96,6 +116,23 @@ size_t FitnessMetricSum::evaluate(Chromosome const& _chromosome)
 	return total;
 }
 
+size_t FitnessMetricWeightedAverage::evaluate(Chromosome const& _chromosome)
+{
+	assert(m_metrics.size() > 0);
+
+	size_t total = 0;
+	size_t totalWeight = 0;
+	for (size_t i = 0; i < m_metrics.size(); ++i)
+		if (m_weights[i] > 0)
+		{
+			total += m_weights[i] * m_metrics[i]->evaluate(_chromosome);
+			totalWeight += m_weights[i];
+		}
+	assert(totalWeight > 0);
+
+	return total / totalWeight;
+}
+
 size_t FitnessMetricMaximum::evaluate(Chromosome const& _chromosome)
 {
 	assert(m_metrics.size() > 0);
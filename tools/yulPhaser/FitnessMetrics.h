@@ -132,6 +132,63 @@ private:
 	size_t m_fixedPointPrecision;
 };
 
+/**
+ * Fitness metric based on the estimated gas cost of a specific program after applying the
+ * optimisations from the chromosome to it. The cost includes deployment and
+ * @a _expectedExecutions runs of the code, which mirrors the trade-off controlled by the
+ * `--optimize-runs` option of the compiler.
+ */
+class ProgramGasCost: public ProgramBasedMetric
+{
+public:
+	explicit ProgramGasCost(
+		std::optional<Program> _program,
+		std::shared_ptr<ProgramCache> _programCache,
+		size_t _expectedExecutions,
+		size_t _repetitionCount = 1
+	):
+		ProgramBasedMetric(std::move(_program), std::move(_programCache), yul::CodeWeights{}, _repetitionCount),
+		m_expectedExecutions(_expectedExecutions) {}
+
+	size_t expectedExecutions() const { return m_expectedExecutions; }
+
+	size_t evaluate(Chromosome const& _chromosome) override;
+
+private:
+	size_t m_expectedExecutions;
+};
+
+/**
+ * Fitness metric based on the estimated gas cost of a specific program after applying the
+ * optimisations from the chromosome to it in relation to the original, unoptimised program.
+ *
+ * Like @a RelativeProgramSize, the class multiplies the ratio by 10^@a _fixedPointPrecision
+ * before rounding it.
+ */
+class RelativeProgramGasCost: public ProgramBasedMetric
+{
+public:
+	explicit RelativeProgramGasCost(
+		std::optional<Program> _program,
+		std::shared_ptr<ProgramCache> _programCache,
+		size_t _fixedPointPrecision,
+		size_t _expectedExecutions,
+		size_t _repetitionCount = 1
+	):
+		ProgramBasedMetric(std::move(_program), std::move(_programCache), yul::CodeWeights{}, _repetitionCount),
+		m_fixedPointPrecision(_fixedPointPrecision),
+		m_expectedExecutions(_expectedExecutions) {}
+
+	size_t fixedPointPrecision() const { return m_fixedPointPrecision; }
+	size_t expectedExecutions() const { return m_expectedExecutions; }
+
+	size_t evaluate(Chromosome const& _chromosome) override;
+
+private:
+	size_t m_fixedPointPrecision;
+	size_t m_expectedExecutions;
+};
+
 /**
  * Abstract base class for fitness metrics that compute their value based on values of multiple
  * other, nested metrics.
@@ -168,6 +225,31 @@ public:
 	size_t evaluate(Chromosome const& _chromosome) override;
 };
 
+/**
+ * Fitness metric that returns the average of values of its nested metrics, each multiplied by
+ * the corresponding weight.
+ */
+class FitnessMetricWeightedAverage: public FitnessMetricCombination
+{
+public:
+	explicit FitnessMetricWeightedAverage(
+		std::vector<std::shared_ptr<FitnessMetric>> _metrics,
+		std::vector<size_t> _weights
+	):
+		FitnessMetricCombination(std::move(_metrics)),
+		m_weights(std::move(_weights))
+	{
+		assert(m_weights.size() == m_metrics.size());
+	}
+
+	std::vector<size_t> const& weights() const { return m_weights; }
+
+	size_t evaluate(Chromosome const& _chromosome) override;
+
+private:
+	std::vector<size_t> m_weights;
+};
+
 /**
  * Fitness metric that returns the highest of values of its nested metrics.
  */
@@ -68,6 +68,9 @@ std::map<MetricChoice, std::string> MetricChoiceToStringMap =
 {
 	{MetricChoice::CodeSize, "code-size"},
 	{MetricChoice::RelativeCodeSize, "relative-code-size"},
+	{MetricChoice::GasCost, "gas-cost"},
+	{MetricChoice::RelativeGasCost, "relative-gas-cost"},
+	{MetricChoice::Weighted, "weighted"},
 };
 std::map<std::string, MetricChoice> const StringToMetricChoiceMap = invertMap(MetricChoiceToStringMap);
 
@@ -218,6 +221,9 @@ FitnessMetricFactory::Options FitnessMetricFactory::Options::fromCommandLine(po:
 		_arguments["metric-aggregator"].as<MetricAggregatorChoice>(),
 		_arguments["relative-metric-scale"].as<size_t>(),
 		_arguments["chromosome-repetitions"].as<size_t>(),
+		_arguments["expected-executions"].as<size_t>(),
+		_arguments["code-size-weight"].as<size_t>(),
+		_arguments["gas-cost-weight"].as<size_t>(),
 	};
 }
 
@@ -258,6 +264,67 @@ std::unique_ptr<FitnessMetric> FitnessMetricFactory::build(
 				));
 			break;
 		}
+		case MetricChoice::GasCost:
+		{
+			for (size_t i = 0; i < _programs.size(); ++i)
+				metrics.push_back(std::make_unique<ProgramGasCost>(
+					_programCaches[i] != nullptr ? std::optional<Program>{} : std::move(_programs[i]),
+					std::move(_programCaches[i]),
+					_options.expectedExecutions,
+					_options.chromosomeRepetitions
+				));
+			break;
+		}
+		case MetricChoice::RelativeGasCost:
+		{
+			for (size_t i = 0; i < _programs.size(); ++i)
+				metrics.push_back(std::make_unique<RelativeProgramGasCost>(
+					_programCaches[i] != nullptr ? std::optional<Program>{} : std::move(_programs[i]),
+					std::move(_programCaches[i]),
+					_options.relativeMetricScale,
+					_options.expectedExecutions,
+					_options.chromosomeRepetitions
+				));
+			break;
+		}
+		case MetricChoice::Weighted:
+		{
+			assertThrow(
+				_options.codeSizeWeight + _options.gasCostWeight > 0,
+				solidity::util::Exception,
+				"At least one of the metric weights must be non-zero."
+			);
+
+			// Both metrics are relative so that values of different magnitudes can be combined.
+			// They share the cache (if any) to avoid optimising the same program twice.
+			for (size_t i = 0; i < _programs.size(); ++i)
+			{
+				std::optional<Program> program = _programCaches[i] != nullptr ?
+					std::optional<Program>{} :
+					std::optional<Program>{std::move(_programs[i])};
+
+				metrics.push_back(std::make_unique<FitnessMetricWeightedAverage>(
+					std::vector<std::shared_ptr<FitnessMetric>>{
+						std::make_shared<RelativeProgramSize>(
+							program,
+							_programCaches[i],
+							_options.relativeMetricScale,
+							_weights,
+							_options.chromosomeRepetitions
+						),
+						std::make_shared<RelativeProgramGasCost>(
+							std::move(program),
+							_programCaches[i],
+							_options.relativeMetricScale,
+							_options.expectedExecutions,
+							_options.chromosomeRepetitions
+						),
+					},
+					std::vector<size_t>{_options.codeSizeWeight, _options.gasCostWeight}
+				));
+			}
+			break;
+		}
 		default:
 			assertThrow(false, solidity::util::Exception, "Invalid MetricChoice value.");
 	}
@@ -647,7 +714,14 @@ Phaser::CommandLineDescription Phaser::buildCommandLineDescription()
 				"\n"
 				"AVAILABLE METRICS:\n"
 				"* " + toString(MetricChoice::CodeSize) + "\n" +
-				"* " + toString(MetricChoice::RelativeCodeSize)
+				"* " + toString(MetricChoice::RelativeCodeSize) + "\n" +
+				"* " + toString(MetricChoice::GasCost) + "\n" +
+				"* " + toString(MetricChoice::RelativeGasCost) + "\n" +
+				"* " + toString(MetricChoice::Weighted) + "\n"
+				"\n"
+				"Gas costs are estimated statically, without executing the code. "
+				"The " + toString(MetricChoice::Weighted) + " metric combines relative code size "
+				"and relative gas cost using the weights given in --code-size-weight and --gas-cost-weight."
 			).c_str()
 		)
 		(
@@ -681,6 +755,23 @@ Phaser::CommandLineDescription Phaser::buildCommandLineDescription()
 			po::value<size_t>()->value_name("<COUNT>")->default_value(1),
 			"Number of times to repeat the sequence optimisation steps represented by a chromosome."
 		)
+		(
+			"expected-executions",
+			po::value<size_t>()->value_name("<COUNT>")->default_value(200),
+			"Number of times the code is expected to be executed over the lifetime of the contract. "
+			"Used by the gas cost metrics to weigh the cost of deployment against the cost of execution, "
+			"in the same way as the --optimize-runs option of the compiler."
+		)
+		(
+			"code-size-weight",
+			po::value<size_t>()->value_name("<WEIGHT>")->default_value(1),
+			("Weight of the relative code size in the " + toString(MetricChoice::Weighted) + " metric.").c_str()
+		)
+		(
+			"gas-cost-weight",
+			po::value<size_t>()->value_name("<WEIGHT>")->default_value(1),
+			("Weight of the relative gas cost in the " + toString(MetricChoice::Weighted) + " metric.").c_str()
+		)
 	;
 	keywordDescription.add(metricsDescription);
 
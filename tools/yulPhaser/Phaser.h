@@ -76,6 +76,9 @@ enum class MetricChoice
 {
 	CodeSize,
 	RelativeCodeSize,
+	GasCost,
+	RelativeGasCost,
+	Weighted,
 };
 
 enum class MetricAggregatorChoice
@@ -158,6 +161,9 @@ public:
 		MetricAggregatorChoice metricAggregator;
 		size_t relativeMetricScale;
 		size_t chromosomeRepetitions;
+		size_t expectedExecutions;
+		size_t codeSizeWeight;
+		size_t gasCostWeight;
 
 		static Options fromCommandLine(boost::program_options::variables_map const& _arguments);
 	};
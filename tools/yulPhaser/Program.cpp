@@ -30,6 +30,9 @@
 #include <libyul/ObjectParser.h>
 #include <libyul/YulString.h>
 #include <libyul/backends/evm/EVMDialect.h>
+#include <libyul/backends/evm/EVMMetrics.h>
+#include <libyul/optimiser/ASTCopier.h>
+#include <libyul/optimiser/ASTWalker.h>
 #include <libyul/optimiser/Disambiguator.h>
 #include <libyul/optimiser/ForLoopInitRewriter.h>
 #include <libyul/optimiser/FunctionGrouper.h>
@@ -58,6 +61,49 @@ std::ostream& operator<<(std::ostream& _stream, Program const& _program);
 
 }
 
+namespace
+{
+
+/**
+ * Sums up the gas costs of all instructions, literals and identifiers in the code.
+ * Calls to user-defined functions are charged as a jump in and a jump out. Control flow is not
+ * taken into account, i.e. every statement is assumed to be executed the same number of times.
+ */
+class GasCostEstimator: public ASTWalker
+{
+public:
+	GasCostEstimator(EVMDialect const& _dialect, size_t _expectedExecutions):
+		m_dialect(_dialect),
+		m_gasMeter(_dialect, false, _expectedExecutions)
+	{}
+
+	bigint cost() const { return m_cost; }
+
+	using ASTWalker::operator();
+	void operator()(FunctionCall const& _funCall) override
+	{
+		ASTWalker::operator()(_funCall);
+
+		BuiltinFunctionForEVM const* builtin = m_dialect.builtin(_funCall.functionName.name);
+		if (!builtin)
+			m_cost += 2 * m_gasMeter.instructionCosts(evmasm::Instruction::JUMP);
+		else if (builtin->instruction)
+			m_cost += m_gasMeter.instructionCosts(*builtin->instruction);
+		else
+			// Builtins without an instruction, like datasize(), are replaced with constants.
+			m_cost += m_gasMeter.instructionCosts(evmasm::Instruction::PUSH1);
+	}
+	void operator()(Literal const& _literal) override { m_cost += m_gasMeter.costs(_literal); }
+	void operator()(Identifier const& _identifier) override { m_cost += m_gasMeter.costs(_identifier); }
+
+private:
+	EVMDialect const& m_dialect;
+	GasMeter m_gasMeter;
+	bigint m_cost = 0;
+};
+
+}
+
 Program::Program(Program const& program):
 	m_ast(std::make_unique<Block>(std::get<Block>(ASTCopier{}(*program.m_ast)))),
 	m_dialect{program.m_dialect},
@@ -85,7 +131,7 @@ std::variant<Program, ErrorList> Program::load(CharStream& _sourceCode)
 		dialect,
 		disambiguateAST(
 			dialect,
-			*std::get<std::unique_ptr<Block>>(astOrErrors),
+			std::move(std::get<std::unique_ptr<Block>>(astOrErrors)),
 			*std::get<std::unique_ptr<AsmAnalysisInfo>>(analysisInfoOrErrors)
 		)
 	);
@@ -171,14 +217,15 @@ std::variant<std::unique_ptr<AsmAnalysisInfo>, ErrorList> Program::analyzeAST(Di
 
 std::unique_ptr<Block> Program::disambiguateAST(
 	Dialect const& _dialect,
-	Block const& _ast,
+	std::unique_ptr<Block> _ast,
 	AsmAnalysisInfo const& _analysisInfo
 )
 {
 	std::set<YulString> const externallyUsedIdentifiers = {};
 	Disambiguator disambiguator(_dialect, _analysisInfo, externallyUsedIdentifiers);
+	disambiguator(*_ast);
 
-	return std::make_unique<Block>(std::get<Block>(disambiguator(_ast)));
+	return _ast;
 }
 
 std::unique_ptr<Block> Program::applyOptimisationSteps(
@@ -204,6 +251,13 @@ std::unique_ptr<Block> Program::applyOptimisationSteps(
 	return _ast;
 }
 
+size_t Program::gasCost(size_t _expectedExecutions) const
+{
+	GasCostEstimator estimator(dynamic_cast<EVMDialect const&>(m_dialect), _expectedExecutions);
+	estimator(*m_ast);
+	return static_cast<size_t>(estimator.cost());
+}
+
 size_t Program::computeCodeSize(Block const& _ast, CodeWeights const& _weights)
 {
 	return CodeSize::codeSizeIncludingFunctions(_ast, _weights);
@@ -76,6 +76,9 @@ public:
 	void optimise(std::vector<std::string> const& _optimisationSteps);
 
 	size_t codeSize(yul::CodeWeights const& _weights) const { return computeCodeSize(*m_ast, _weights); }
+	/// @returns a static estimate of the gas spent on deploying the program and executing each
+	/// of its statements @a _expectedExecutions times.
+	size_t gasCost(size_t _expectedExecutions) const;
 	yul::Block const& ast() const { return *m_ast; }
 
 	friend std::ostream& operator<<(std::ostream& _stream, Program const& _program);
@@ -101,7 +104,7 @@ private:
 	);
 	static std::unique_ptr<yul::Block> disambiguateAST(
 		yul::Dialect const& _dialect,
-		yul::Block const& _ast,
+		std::unique_ptr<yul::Block> _ast,
 		yul::AsmAnalysisInfo const& _analysisInfo
 	);
 	static std::unique_ptr<yul::Block> applyOptimisationSteps(